@@ -0,0 +1,413 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "CallInstrumentation.h"
+
+using namespace System;
+using namespace System::Threading;
+using namespace System::Diagnostics;
+using namespace System::Collections::Generic;
+
+namespace SlimDX
+{
+	// Counters for a single call site. Only the thread that owns the table writes to them, with plain
+	// increments; snapshots read them from other threads, so a snapshot may miss calls that are still
+	// being recorded. A 64-bit write is not atomic in a 32-bit process, so readers go through Read.
+	ref class CallSiteCounters
+	{
+	public:
+		const char* Function;
+		int Line;
+		Int64 Calls;
+		Int64 Failures;
+		Int64 Samples;
+		Int64 SampledTicks;
+		array<Int64>^ Histogram;
+
+		CallSiteCounters( const char* function, int line )
+		: Function( function ), Line( line )
+		{
+			Histogram = gcnew array<Int64>( CallSiteStatistics::HistogramBucketCount );
+		}
+
+		// The counters only grow, so a value that reads the same twice in a row was not torn by a
+		// concurrent write of its two halves.
+		static Int64 Read( Int64% value )
+		{
+			Int64 first = Thread::VolatileRead( value );
+			for( ;; )
+			{
+				Int64 second = Thread::VolatileRead( value );
+				if( second == first )
+					return first;
+
+				first = second;
+			}
+		}
+
+		void Add( CallSiteCounters^ other )
+		{
+			Calls += Read( other->Calls );
+			Failures += Read( other->Failures );
+			Samples += Read( other->Samples );
+			SampledTicks += Read( other->SampledTicks );
+
+			for( int i = 0; i < Histogram->Length; ++i )
+				Histogram[i] += Read( other->Histogram[i] );
+		}
+
+		static Int64 MakeKey( const char* function, int line )
+		{
+			return ( static_cast<Int64>( reinterpret_cast<INT_PTR>( function ) ) << 16 ) | ( line & 0xFFFF );
+		}
+	};
+
+	// The call sites seen by a single thread. New sites are appended to Sites before Count is
+	// published, so readers that load Count first never see an unfilled slot.
+	ref class CallSiteTable
+	{
+	public:
+		Thread^ Owner;
+		Dictionary<Int64, CallSiteCounters^>^ Lookup;
+		array<CallSiteCounters^>^ Sites;
+		volatile int Count;
+
+		Int64 LastKey;
+		CallSiteCounters^ Last;
+
+		CallSiteTable( Thread^ owner )
+		: Owner( owner )
+		{
+			Lookup = gcnew Dictionary<Int64, CallSiteCounters^>();
+			Sites = gcnew array<CallSiteCounters^>( 64 );
+		}
+
+		CallSiteCounters^ Find( const char* function, int line )
+		{
+			Int64 key = CallSiteCounters::MakeKey( function, line );
+			if( Last != nullptr && LastKey == key )
+				return Last;
+
+			CallSiteCounters^ counters;
+			if( !Lookup->TryGetValue( key, counters ) )
+			{
+				counters = gcnew CallSiteCounters( function, line );
+				Lookup->Add( key, counters );
+
+				int count = Count;
+				if( count == Sites->Length )
+				{
+					array<CallSiteCounters^>^ sites = gcnew array<CallSiteCounters^>( count * 2 );
+					Array::Copy( Sites, sites, count );
+					Sites = sites;
+				}
+
+				Sites[count] = counters;
+				Count = count + 1;
+			}
+
+			LastKey = key;
+			Last = counters;
+			return counters;
+		}
+	};
+
+	static CallInstrumentation::CallInstrumentation()
+	{
+		m_SampleInterval = 16;
+		m_NanosecondsPerTick = 1.0e9 / Stopwatch::Frequency;
+		m_TimeSpanTicksPerTick = static_cast<double>( TimeSpan::TicksPerSecond ) / Stopwatch::Frequency;
+
+		m_Tables = gcnew List<CallSiteTable^>();
+		m_Retired = gcnew Dictionary<Int64, CallSiteCounters^>();
+		m_SyncObject = gcnew Object();
+		m_BaselineTimestamp = Stopwatch::GetTimestamp();
+		m_FrameTimestamp = m_BaselineTimestamp;
+	}
+
+	CallInstrumentation::CallInstrumentation()
+	{
+	}
+
+	void CallInstrumentation::Enabled::set( bool value )
+	{
+		m_Enabled = value;
+	}
+
+	int CallInstrumentation::SampleInterval::get()
+	{
+		return m_SampleInterval;
+	}
+
+	void CallInstrumentation::SampleInterval::set( int value )
+	{
+		if( value < 1 )
+			throw gcnew ArgumentOutOfRangeException( "value", "The sample interval must be greater than zero." );
+
+		m_SampleInterval = value;
+	}
+
+	CallInstrumentationSnapshot^ CallInstrumentation::LastFrame::get()
+	{
+		return m_LastFrame;
+	}
+
+	void CallInstrumentation::Begin()
+	{
+		if( --m_Countdown > 0 )
+		{
+			// Clears a start time left behind by a call that threw before it could be recorded.
+			m_Start = 0;
+			return;
+		}
+
+		m_Countdown = m_SampleInterval;
+		m_Start = Stopwatch::GetTimestamp();
+	}
+
+	void CallInstrumentation::Begin( const char* expression )
+	{
+		// An expression without a call in it is a result code stored before the recording macro ran.
+		// Its call was wrapped in TIME_CALL, which already started the timer.
+		if( strchr( expression, '(' ) == 0 )
+			return;
+
+		Begin();
+	}
+
+	void CallInstrumentation::End( int hr, const char* function, int line )
+	{
+		Int64 start = m_Start;
+		Int64 elapsed = start != 0 ? Stopwatch::GetTimestamp() - start : -1;
+		m_Start = 0;
+
+		CallSiteTable^ table = m_Table;
+		if( table == nullptr )
+			table = RegisterThread();
+
+		CallSiteCounters^ counters = table->Find( function, line );
+		++counters->Calls;
+		if( hr < 0 )
+			++counters->Failures;
+
+		if( elapsed >= 0 )
+		{
+			++counters->Samples;
+			counters->SampledTicks += elapsed;
+
+			UInt64 nanoseconds = static_cast<UInt64>( elapsed * m_NanosecondsPerTick );
+			int bucket = 0;
+			while( nanoseconds > 1 && bucket < CallSiteStatistics::HistogramBucketCount - 1 )
+			{
+				nanoseconds >>= 1;
+				++bucket;
+			}
+
+			++counters->Histogram[bucket];
+		}
+	}
+
+	CallSiteTable^ CallInstrumentation::RegisterThread()
+	{
+		CallSiteTable^ table = gcnew CallSiteTable( Thread::CurrentThread );
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			// every new thread prunes the tables of threads that have exited, so thread churn does not grow the list
+			RetireTables();
+			m_Tables->Add( table );
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		m_Table = table;
+		return table;
+	}
+
+	void CallInstrumentation::AddCounters( Dictionary<Int64, CallSiteCounters^>^ totals, CallSiteCounters^ site )
+	{
+		Int64 key = CallSiteCounters::MakeKey( site->Function, site->Line );
+
+		CallSiteCounters^ total;
+		if( !totals->TryGetValue( key, total ) )
+		{
+			total = gcnew CallSiteCounters( site->Function, site->Line );
+			totals->Add( key, total );
+		}
+
+		total->Add( site );
+	}
+
+	void CallInstrumentation::RetireTables()
+	{
+		// An exited thread writes no more counts, so its table is folded into the retired totals and dropped.
+		for( int i = m_Tables->Count - 1; i >= 0; --i )
+		{
+			CallSiteTable^ table = m_Tables[i];
+			if( table->Owner->IsAlive )
+				continue;
+
+			for( int site = 0; site < table->Count; ++site )
+				AddCounters( m_Retired, table->Sites[site] );
+
+			m_Tables->RemoveAt( i );
+		}
+	}
+
+	Dictionary<Int64, CallSiteCounters^>^ CallInstrumentation::Collect()
+	{
+		array<CallSiteTable^>^ tables;
+		Dictionary<Int64, CallSiteCounters^>^ totals = gcnew Dictionary<Int64, CallSiteCounters^>();
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			RetireTables();
+			tables = m_Tables->ToArray();
+
+			for each( CallSiteCounters^ site in m_Retired->Values )
+				AddCounters( totals, site );
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		for each( CallSiteTable^ table in tables )
+		{
+			int count = table->Count;
+			array<CallSiteCounters^>^ sites = table->Sites;
+
+			for( int i = 0; i < count; ++i )
+				AddCounters( totals, sites[i] );
+		}
+
+		return totals;
+	}
+
+	CallInstrumentationSnapshot^ CallInstrumentation::CreateSnapshot( Dictionary<Int64, CallSiteCounters^>^ current, Dictionary<Int64, CallSiteCounters^>^ baseline, Int64 elapsed )
+	{
+		List<CallSiteStatistics^>^ sites = gcnew List<CallSiteStatistics^>( current->Count );
+
+		for each( KeyValuePair<Int64, CallSiteCounters^> pair in current )
+		{
+			CallSiteCounters^ site = pair.Value;
+			CallSiteCounters^ previous = nullptr;
+			if( baseline != nullptr )
+				baseline->TryGetValue( pair.Key, previous );
+
+			Int64 calls = site->Calls;
+			Int64 failures = site->Failures;
+			Int64 samples = site->Samples;
+			Int64 ticks = site->SampledTicks;
+			array<Int64>^ histogram = safe_cast<array<Int64>^>( site->Histogram->Clone() );
+
+			if( previous != nullptr )
+			{
+				calls -= previous->Calls;
+				failures -= previous->Failures;
+				samples -= previous->Samples;
+				ticks -= previous->SampledTicks;
+
+				for( int i = 0; i < histogram->Length; ++i )
+					histogram[i] -= previous->Histogram[i];
+			}
+
+			if( calls <= 0 )
+				continue;
+
+			TimeSpan sampledTime = TimeSpan::FromTicks( static_cast<Int64>( ticks * m_TimeSpanTicksPerTick ) );
+			sites->Add( gcnew CallSiteStatistics( gcnew String( site->Function ), site->Line, calls, failures, samples, sampledTime, histogram ) );
+		}
+
+		sites->Sort( gcnew Comparison<CallSiteStatistics^>( &CallInstrumentation::CompareSites ) );
+		return gcnew CallInstrumentationSnapshot( sites, TimeSpan::FromTicks( static_cast<Int64>( elapsed * m_TimeSpanTicksPerTick ) ) );
+	}
+
+	int CallInstrumentation::CompareSites( CallSiteStatistics^ left, CallSiteStatistics^ right )
+	{
+		int result = right->EstimatedTotalTime.CompareTo( left->EstimatedTotalTime );
+		if( result != 0 )
+			return result;
+
+		return right->CallCount.CompareTo( left->CallCount );
+	}
+
+	CallInstrumentationSnapshot^ CallInstrumentation::TakeSnapshot()
+	{
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			Int64 now = Stopwatch::GetTimestamp();
+			return CreateSnapshot( Collect(), m_Baseline, now - m_BaselineTimestamp );
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+	}
+
+	CallInstrumentationSnapshot^ CallInstrumentation::EndFrame()
+	{
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			Int64 now = Stopwatch::GetTimestamp();
+			Dictionary<Int64, CallSiteCounters^>^ current = Collect();
+
+			m_LastFrame = CreateSnapshot( current, m_FrameStart, now - m_FrameTimestamp );
+			m_FrameStart = current;
+			m_FrameTimestamp = now;
+
+			return m_LastFrame;
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+	}
+
+	void CallInstrumentation::Reset()
+	{
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			Dictionary<Int64, CallSiteCounters^>^ current = Collect();
+
+			m_Baseline = current;
+			m_FrameStart = current;
+			m_BaselineTimestamp = Stopwatch::GetTimestamp();
+			m_FrameTimestamp = m_BaselineTimestamp;
+			m_LastFrame = nullptr;
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+	}
+}
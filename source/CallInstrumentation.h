@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "CallInstrumentationSnapshot.h"
+
+namespace SlimDX
+{
+	ref class CallSiteCounters;
+	ref class CallSiteTable;
+
+#ifdef XMLDOCS
+	ref class Configuration;
+#endif
+
+	/// <summary>
+	/// Gathers per call site statistics for the API calls SlimDX makes on behalf of the application.
+	/// </summary>
+	/// <remarks>
+	/// Collection is turned on with <see cref="Configuration::EnableCallInstrumentation"/>. Every call that produces a
+	/// <see cref="Result">result code</see> is counted, and the latency of one call in every <see cref="SampleInterval"/>
+	/// is measured. Each thread writes to its own counters without locking; they are only combined when a snapshot is requested.
+	/// Latency is measured from the start of the API call, either inside the recording macro or, where the result code is
+	/// stored in a local variable first, from the <c>TIME_CALL</c> wrapper around the call.
+	/// </remarks>
+	public ref class CallInstrumentation sealed
+	{
+	private:
+		static bool m_Enabled;
+		static int m_SampleInterval;
+		static double m_NanosecondsPerTick;
+		static double m_TimeSpanTicksPerTick;
+
+		static System::Collections::Generic::List<CallSiteTable^>^ m_Tables;
+		static System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ m_Retired;
+		static System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ m_Baseline;
+		static System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ m_FrameStart;
+		static System::Int64 m_BaselineTimestamp;
+		static System::Int64 m_FrameTimestamp;
+		static CallInstrumentationSnapshot^ m_LastFrame;
+		static Object^ m_SyncObject;
+
+		[System::ThreadStatic]
+		static CallSiteTable^ m_Table;
+
+		[System::ThreadStatic]
+		static System::Int64 m_Start;
+
+		[System::ThreadStatic]
+		static int m_Countdown;
+
+		static CallInstrumentation();
+		CallInstrumentation();
+
+		static CallSiteTable^ RegisterThread();
+		static void RetireTables();
+		static void AddCounters( System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ totals, CallSiteCounters^ site );
+		static System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ Collect();
+		static CallInstrumentationSnapshot^ CreateSnapshot( System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ current,
+			System::Collections::Generic::Dictionary<System::Int64, CallSiteCounters^>^ baseline, System::Int64 elapsed );
+		static int CompareSites( CallSiteStatistics^ left, CallSiteStatistics^ right );
+
+	internal:
+		// Read by the recording macros on every call, so the getter stays in the header where it can be inlined.
+		static property bool Enabled
+		{
+			bool get() { return m_Enabled; }
+			void set( bool value );
+		}
+
+		static void Begin();
+		static void Begin( const char* expression );
+		static void End( int hr, const char* function, int line );
+
+	public:
+		/// <summary>
+		/// Gets or sets how many calls a thread makes for each call whose latency is measured. A value of 1 measures
+		/// every call. The default value is 16.
+		/// </summary>
+		static property int SampleInterval
+		{
+			int get();
+			void set( int value );
+		}
+
+		/// <summary>
+		/// Gets the snapshot returned by the most recent call to <see cref="EndFrame"/>, or <c>null</c> if no frame has ended
+		/// since instrumentation was last reset.
+		/// </summary>
+		static property CallInstrumentationSnapshot^ LastFrame
+		{
+			CallInstrumentationSnapshot^ get();
+		}
+
+		/// <summary>
+		/// Gathers the statistics of all calls made since instrumentation was last reset.
+		/// </summary>
+		/// <returns>A snapshot of the gathered statistics.</returns>
+		static CallInstrumentationSnapshot^ TakeSnapshot();
+
+		/// <summary>
+		/// Marks the end of a frame and gathers the statistics of all calls made since the previous frame ended.
+		/// </summary>
+		/// <returns>A snapshot of the statistics gathered for the frame.</returns>
+		static CallInstrumentationSnapshot^ EndFrame();
+
+		/// <summary>
+		/// Discards all statistics gathered so far.
+		/// </summary>
+		static void Reset();
+	};
+}
@@ -0,0 +1,70 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "CallInstrumentationSnapshot.h"
+
+using namespace System;
+using namespace System::Globalization;
+using namespace System::Collections::Generic;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+	CallInstrumentationSnapshot::CallInstrumentationSnapshot( IList<CallSiteStatistics^>^ sites, TimeSpan duration )
+	: m_Duration( duration )
+	{
+		m_Sites = gcnew ReadOnlyCollection<CallSiteStatistics^>( sites );
+
+		for each( CallSiteStatistics^ site in sites )
+		{
+			m_CallCount += site->CallCount;
+			m_FailureCount += site->FailureCount;
+		}
+	}
+
+	ReadOnlyCollection<CallSiteStatistics^>^ CallInstrumentationSnapshot::Sites::get()
+	{
+		return m_Sites;
+	}
+
+	Int64 CallInstrumentationSnapshot::CallCount::get()
+	{
+		return m_CallCount;
+	}
+
+	Int64 CallInstrumentationSnapshot::FailureCount::get()
+	{
+		return m_FailureCount;
+	}
+
+	TimeSpan CallInstrumentationSnapshot::Duration::get()
+	{
+		return m_Duration;
+	}
+
+	String^ CallInstrumentationSnapshot::ToString()
+	{
+		return String::Format( CultureInfo::CurrentCulture, "{0} calls from {1} sites, {2} failed, over {3}",
+			m_CallCount, m_Sites->Count, m_FailureCount, m_Duration );
+	}
+}
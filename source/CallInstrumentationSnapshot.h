@@ -0,0 +1,81 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "CallSiteStatistics.h"
+
+namespace SlimDX
+{
+	/// <summary>
+	/// Holds the call statistics gathered by <see cref="CallInstrumentation"/> over a period of time.
+	/// </summary>
+	public ref class CallInstrumentationSnapshot sealed
+	{
+	private:
+		System::Collections::ObjectModel::ReadOnlyCollection<CallSiteStatistics^>^ m_Sites;
+		System::Int64 m_CallCount;
+		System::Int64 m_FailureCount;
+		System::TimeSpan m_Duration;
+
+	internal:
+		CallInstrumentationSnapshot( System::Collections::Generic::IList<CallSiteStatistics^>^ sites, System::TimeSpan duration );
+
+	public:
+		/// <summary>
+		/// Gets the call sites that were used during the period, ordered by decreasing estimated total time.
+		/// </summary>
+		property System::Collections::ObjectModel::ReadOnlyCollection<CallSiteStatistics^>^ Sites
+		{
+			System::Collections::ObjectModel::ReadOnlyCollection<CallSiteStatistics^>^ get();
+		}
+
+		/// <summary>
+		/// Gets the total number of calls made during the period.
+		/// </summary>
+		property System::Int64 CallCount
+		{
+			System::Int64 get();
+		}
+
+		/// <summary>
+		/// Gets the total number of calls that returned a failure code during the period.
+		/// </summary>
+		property System::Int64 FailureCount
+		{
+			System::Int64 get();
+		}
+
+		/// <summary>
+		/// Gets the length of the period covered by the snapshot.
+		/// </summary>
+		property System::TimeSpan Duration
+		{
+			System::TimeSpan get();
+		}
+
+		/// <summary>
+		/// Converts the value of the object to its equivalent string representation.
+		/// </summary>
+		/// <returns>The string representation of the value of this instance.</returns>
+		virtual System::String^ ToString() override;
+	};
+}
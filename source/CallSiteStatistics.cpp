@@ -0,0 +1,96 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "CallSiteStatistics.h"
+
+using namespace System;
+using namespace System::Globalization;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+	CallSiteStatistics::CallSiteStatistics( String^ functionName, int line, Int64 callCount, Int64 failureCount,
+		Int64 sampleCount, TimeSpan sampledTime, array<Int64>^ latencyHistogram )
+	: m_FunctionName( functionName ), m_Line( line ), m_CallCount( callCount ), m_FailureCount( failureCount ),
+	  m_SampleCount( sampleCount ), m_SampledTime( sampledTime )
+	{
+		m_LatencyHistogram = gcnew ReadOnlyCollection<Int64>( latencyHistogram );
+	}
+
+	String^ CallSiteStatistics::FunctionName::get()
+	{
+		return m_FunctionName;
+	}
+
+	int CallSiteStatistics::Line::get()
+	{
+		return m_Line;
+	}
+
+	Int64 CallSiteStatistics::CallCount::get()
+	{
+		return m_CallCount;
+	}
+
+	Int64 CallSiteStatistics::FailureCount::get()
+	{
+		return m_FailureCount;
+	}
+
+	Int64 CallSiteStatistics::SampleCount::get()
+	{
+		return m_SampleCount;
+	}
+
+	TimeSpan CallSiteStatistics::SampledTime::get()
+	{
+		return m_SampledTime;
+	}
+
+	TimeSpan CallSiteStatistics::AverageLatency::get()
+	{
+		if( m_SampleCount == 0 )
+			return TimeSpan::Zero;
+
+		return TimeSpan::FromTicks( m_SampledTime.Ticks / m_SampleCount );
+	}
+
+	TimeSpan CallSiteStatistics::EstimatedTotalTime::get()
+	{
+		if( m_SampleCount == 0 )
+			return TimeSpan::Zero;
+
+		return TimeSpan::FromTicks( static_cast<Int64>( static_cast<double>( m_SampledTime.Ticks ) * m_CallCount / m_SampleCount ) );
+	}
+
+	ReadOnlyCollection<Int64>^ CallSiteStatistics::LatencyHistogram::get()
+	{
+		return m_LatencyHistogram;
+	}
+
+	String^ CallSiteStatistics::ToString()
+	{
+		return String::Format( CultureInfo::CurrentCulture, "{0}({1}): {2} calls, {3} failed, {4} average",
+			m_FunctionName, m_Line, m_CallCount, m_FailureCount, AverageLatency );
+	}
+}
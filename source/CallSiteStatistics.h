@@ -0,0 +1,130 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	/// <summary>
+	/// Describes the calls made from a single call site within SlimDX over an instrumented period.
+	/// </summary>
+	/// <remarks>
+	/// Latencies are sampled, so <see cref="SampleCount"/> is normally smaller than <see cref="CallCount"/>.
+	/// Bucket <c>i</c> of the <see cref="LatencyHistogram"/> counts samples that took at least 2^i and less
+	/// than 2^(i+1) nanoseconds; the first bucket also holds faster samples and the last one slower samples.
+	/// </remarks>
+	public ref class CallSiteStatistics sealed
+	{
+	private:
+		System::String^ m_FunctionName;
+		int m_Line;
+		System::Int64 m_CallCount;
+		System::Int64 m_FailureCount;
+		System::Int64 m_SampleCount;
+		System::TimeSpan m_SampledTime;
+		System::Collections::ObjectModel::ReadOnlyCollection<System::Int64>^ m_LatencyHistogram;
+
+	internal:
+		literal int HistogramBucketCount = 32;
+
+		CallSiteStatistics( System::String^ functionName, int line, System::Int64 callCount, System::Int64 failureCount,
+			System::Int64 sampleCount, System::TimeSpan sampledTime, array<System::Int64>^ latencyHistogram );
+
+	public:
+		/// <summary>
+		/// Gets the fully qualified name of the SlimDX method that made the calls.
+		/// </summary>
+		property System::String^ FunctionName
+		{
+			System::String^ get();
+		}
+
+		/// <summary>
+		/// Gets the source line of the call site within <see cref="FunctionName"/>.
+		/// </summary>
+		property int Line
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Gets the number of calls made from the call site.
+		/// </summary>
+		property System::Int64 CallCount
+		{
+			System::Int64 get();
+		}
+
+		/// <summary>
+		/// Gets the number of calls that returned a failure code.
+		/// </summary>
+		property System::Int64 FailureCount
+		{
+			System::Int64 get();
+		}
+
+		/// <summary>
+		/// Gets the number of calls whose latency was measured.
+		/// </summary>
+		property System::Int64 SampleCount
+		{
+			System::Int64 get();
+		}
+
+		/// <summary>
+		/// Gets the total time spent in the sampled calls.
+		/// </summary>
+		property System::TimeSpan SampledTime
+		{
+			System::TimeSpan get();
+		}
+
+		/// <summary>
+		/// Gets the average latency of the sampled calls.
+		/// </summary>
+		property System::TimeSpan AverageLatency
+		{
+			System::TimeSpan get();
+		}
+
+		/// <summary>
+		/// Gets the time spent in all calls, extrapolated from the sampled calls.
+		/// </summary>
+		property System::TimeSpan EstimatedTotalTime
+		{
+			System::TimeSpan get();
+		}
+
+		/// <summary>
+		/// Gets the number of samples in each power of two latency bucket, measured in nanoseconds.
+		/// </summary>
+		property System::Collections::ObjectModel::ReadOnlyCollection<System::Int64>^ LatencyHistogram
+		{
+			System::Collections::ObjectModel::ReadOnlyCollection<System::Int64>^ get();
+		}
+
+		/// <summary>
+		/// Converts the value of the object to its equivalent string representation.
+		/// </summary>
+		/// <returns>The string representation of the value of this instance.</returns>
+		virtual System::String^ ToString() override;
+	};
+}
@@ -21,6 +21,7 @@
 * THE SOFTWARE.
 */
 
+#include "CallInstrumentation.h"
 #include "Configuration.h"
 
 namespace SlimDX
@@ -37,6 +38,16 @@ namespace SlimDX
 	Configuration::Configuration()
 	{
 	}
+
+	bool Configuration::EnableCallInstrumentation::get()
+	{
+		return CallInstrumentation::Enabled;
+	}
+
+	void Configuration::EnableCallInstrumentation::set( bool value )
+	{
+		CallInstrumentation::Enabled = value;
+	}
 	
 	bool Configuration::TryGetResultWatch( Result result, ResultWatchFlags% flags )
 	{
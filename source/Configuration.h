@@ -28,6 +28,10 @@ using System::Runtime::InteropServices::OutAttribute;
 
 namespace SlimDX
 {
+#ifdef XMLDOCS
+	ref class CallInstrumentation;
+#endif
+
 	/// <summary>
 	/// Used to control global options that affect all of SlimDX.
 	/// </summary>
@@ -52,12 +56,31 @@ namespace SlimDX
 		/// impact on performance. The default value is <c>false</c>.</remarks>
 		static property bool EnableObjectTracking;
 
+		/// <summary>
+		/// Gets or sets whether SlimDX gathers call counts, failure counts and sampled latencies for each call site that
+		/// produces a <see cref="Result">result code</see>. The default value is <c>false</c>.
+		/// </summary>
+		/// <remarks>The gathered statistics are available through <see cref="CallInstrumentation"/>. While disabled,
+		/// instrumentation costs a single flag test per call.</remarks>
+		static property bool EnableCallInstrumentation
+		{
+			bool get();
+			void set( bool value );
+		}
+
 		/// <summary>
 		/// Gets or sets whether SlimDX defaults to throwing exceptions on <see cref="Result">result codes</see>
 		/// that indicate errors. The default value is <c>true</c>.
 		/// </summary>
 		static property bool ThrowOnError;
 
+		/// <summary>
+		/// Gets or sets whether every call stores its result code for <see cref="Result::Last"/>, as earlier versions did.
+		/// If set to <c>false</c>, only failed calls are stored and successful calls do not touch thread-static storage.
+		/// The default value is <c>false</c>.
+		/// </summary>
+		static property bool AlwaysRecordLastResult;
+
 		/// <summary>
 		/// Gets or sets whether SlimDX defaults to throwing exceptions when a shader or effect compilation fails. The default value is <c>true</c>.
 		/// </summary>
@@ -70,6 +93,13 @@ namespace SlimDX
 		/// </summary>
 		static property bool DetectDoubleDispose;
 
+		/// <summary>
+		/// Gets or sets whether DirectWrite text renderer callbacks reuse the glyph run, underline and strikethrough objects they
+		/// receive within a single draw call. If set to <c>true</c>, those objects are only valid until the callback returns.
+		/// The default value is <c>false</c>.
+		/// </summary>
+		static property bool ReuseTextRendererArguments;
+
 		/// <summary>
 		/// Gets or sets the SlimDX wide timer object.
 		/// </summary>
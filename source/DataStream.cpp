@@ -190,6 +190,14 @@ namespace SlimDX
 		}
 		
 		m_Buffer = 0;
+		m_Size = 0;
+		m_Position = 0;
+	}
+
+	void DataStream::CheckDisposed()
+	{
+		if( m_Buffer == 0 )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
 	}
 
 	char* DataStream::RawPointer::get()
@@ -232,6 +240,8 @@ namespace SlimDX
 
 	Int64 DataStream::Seek( Int64 offset, SeekOrigin origin )
 	{
+		CheckDisposed();
+
 		Int64 targetPosition = 0;
 
 		switch( origin )
@@ -261,6 +271,7 @@ namespace SlimDX
 	generic<typename T> where T : value class
 	void DataStream::Write( T value )
 	{
+		CheckDisposed();
 		if( !m_CanWrite )
 			throw gcnew NotSupportedException();
 
@@ -280,6 +291,7 @@ namespace SlimDX
 	generic<typename T> where T : value class
 	void DataStream::WriteRange( array<T>^ data, int offset, int count )
 	{
+		CheckDisposed();
 		if( !m_CanWrite )
 			throw gcnew NotSupportedException();
 		
@@ -296,6 +308,7 @@ namespace SlimDX
 	
 	void DataStream::WriteRange( IntPtr source, Int64 count )
 	{
+		CheckDisposed();
 		if( !m_CanWrite )
 			throw gcnew NotSupportedException();
 		
@@ -313,6 +326,7 @@ namespace SlimDX
 	generic<typename T> where T : value class
 	T DataStream::Read()
 	{
+		CheckDisposed();
 		if( !m_CanRead )
 			throw gcnew NotSupportedException();
 
@@ -334,6 +348,7 @@ namespace SlimDX
 	generic<typename T> where T : value class
 	int DataStream::ReadRange( array<T>^ buffer, int offset, int count )
 	{
+		CheckDisposed();
 		if( !m_CanRead )
 			throw gcnew NotSupportedException();
 		
@@ -352,6 +367,7 @@ namespace SlimDX
 	generic<typename T> where T : value class
 	array<T>^ DataStream::ReadRange( int count )
 	{
+		CheckDisposed();
 		if( !m_CanRead )
 			throw gcnew NotSupportedException();
 		if( count < 0 )
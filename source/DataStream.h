@@ -53,6 +53,8 @@ namespace SlimDX
 
 		System::Runtime::InteropServices::GCHandle m_GCHandle;
 
+		void CheckDisposed();
+
 	internal:
 		DataStream( ID3DXBuffer *buffer );
 		DataStream( void* buffer, System::Int64 sizeInBytes, bool canRead, bool canWrite, bool makeCopy );
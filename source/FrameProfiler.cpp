@@ -0,0 +1,350 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "math/Color4.h"
+
+#include "FrameProfiler.h"
+#include "Performance.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Diagnostics;
+using namespace System::Collections::Generic;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+	ProfilerScope::ProfilerScope( FrameProfiler^ profiler )
+	: m_Profiler( profiler )
+	{
+	}
+
+	ProfilerScope::~ProfilerScope()
+	{
+		m_Profiler->EndScope( Index );
+	}
+
+	FrameProfiler::FrameProfiler()
+	{
+		Initialize( nullptr );
+	}
+
+	FrameProfiler::FrameProfiler( IGpuTimestampSource^ source )
+	{
+		Initialize( source );
+	}
+
+	void FrameProfiler::Initialize( IGpuTimestampSource^ source )
+	{
+		if( source != nullptr && source->FrameLatency <= 0 )
+			throw gcnew ArgumentException( "The timestamp source must allow at least one frame in flight.", "source" );
+
+		m_Source = source;
+		m_Pending = gcnew Queue<PendingFrame^>();
+		m_FreeFrames = gcnew Stack<PendingFrame^>();
+		m_ScopeObjects = gcnew List<ProfilerScope^>();
+		m_History = gcnew Dictionary<String^, ScopeHistory^>();
+		m_HistoryOrder = gcnew List<String^>();
+		m_Timestamps = gcnew array<Int64>( 64 );
+		m_HistoryLength = 60;
+		m_OpenScope = -1;
+	}
+
+	int FrameProfiler::HistoryLength::get()
+	{
+		return m_HistoryLength;
+	}
+
+	void FrameProfiler::HistoryLength::set( int value )
+	{
+		if( value <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "value", "The history length must be greater than zero." );
+
+		m_HistoryLength = value;
+		ResetStatistics();
+	}
+
+	int FrameProfiler::WriteTimestamp()
+	{
+		if( m_Source == nullptr )
+			return -1;
+
+		int slot = m_Current->TimestampCount++;
+		m_Source->WriteTimestamp( m_Current->Number, slot );
+		return slot;
+	}
+
+	void FrameProfiler::BeginFrame()
+	{
+		if( m_Current != nullptr )
+			throw gcnew InvalidOperationException( "The previous frame has not ended." );
+
+		if( m_Source != nullptr )
+		{
+			// The source can only hold FrameLatency frames, so the oldest ones are given up on rather than waited for.
+			ResolveFrames( false );
+			while( m_Pending->Count >= m_Source->FrameLatency )
+			{
+				PendingFrame^ dropped = m_Pending->Dequeue();
+				++m_DroppedFrameCount;
+				Resolve( dropped, false, 0, false );
+				m_FreeFrames->Push( dropped );
+			}
+		}
+
+		PendingFrame^ frame = m_FreeFrames->Count > 0 ? m_FreeFrames->Pop() : gcnew PendingFrame();
+		if( frame->Scopes == nullptr )
+			frame->Scopes = gcnew array<ScopeRecord>( 16 );
+
+		frame->Number = m_FrameNumber;
+		frame->ScopeCount = 1;
+		frame->TimestampCount = 0;
+		m_Current = frame;
+
+		if( m_Source != nullptr )
+			m_Source->BeginFrame( m_FrameNumber );
+
+		frame->Scopes[0].Name = "Frame";
+		frame->Scopes[0].Parent = -1;
+		frame->Scopes[0].GpuBegin = WriteTimestamp();
+		frame->Scopes[0].CpuBegin = Stopwatch::GetTimestamp();
+
+		m_OpenScope = 0;
+		m_Depth = 0;
+	}
+
+	void FrameProfiler::EndFrame()
+	{
+		if( m_Current == nullptr )
+			throw gcnew InvalidOperationException( "No frame is in progress." );
+		if( m_OpenScope != 0 )
+			throw gcnew InvalidOperationException( "All scopes must be ended before the frame ends." );
+
+		PendingFrame^ frame = m_Current;
+		frame->Scopes[0].CpuEnd = Stopwatch::GetTimestamp();
+		frame->Scopes[0].GpuEnd = WriteTimestamp();
+
+		if( m_Source != nullptr )
+			m_Source->EndFrame( frame->Number );
+
+		m_Pending->Enqueue( frame );
+		m_Current = nullptr;
+		m_OpenScope = -1;
+		++m_FrameNumber;
+
+		ResolveFrames( false );
+	}
+
+	ProfilerScope^ FrameProfiler::BeginScope( String^ name )
+	{
+		if( name == nullptr )
+			throw gcnew ArgumentNullException( "name" );
+		if( m_Current == nullptr )
+			throw gcnew InvalidOperationException( "A frame must be begun before scopes can be recorded." );
+
+		if( m_EmitPerformanceMarkers )
+			Performance::BeginEvent( Color4( 1.0f, 1.0f, 1.0f ), name );
+
+		PendingFrame^ frame = m_Current;
+		if( frame->ScopeCount == frame->Scopes->Length )
+			Array::Resize( frame->Scopes, frame->Scopes->Length * 2 );
+
+		int index = frame->ScopeCount++;
+		frame->Scopes[index].Name = name;
+		frame->Scopes[index].Parent = m_OpenScope;
+		frame->Scopes[index].GpuBegin = WriteTimestamp();
+		frame->Scopes[index].CpuBegin = Stopwatch::GetTimestamp();
+		m_OpenScope = index;
+
+		while( m_ScopeObjects->Count <= m_Depth )
+			m_ScopeObjects->Add( gcnew ProfilerScope( this ) );
+
+		ProfilerScope^ scope = m_ScopeObjects[m_Depth++];
+		scope->Index = index;
+		return scope;
+	}
+
+	void FrameProfiler::EndScope()
+	{
+		EndScope( m_OpenScope );
+	}
+
+	void FrameProfiler::EndScope( int index )
+	{
+		if( m_Current == nullptr || m_OpenScope <= 0 )
+			throw gcnew InvalidOperationException( "There is no open scope to end." );
+		if( index != m_OpenScope )
+			throw gcnew InvalidOperationException( "Scopes must be ended in the reverse of the order they were begun." );
+
+		PendingFrame^ frame = m_Current;
+		frame->Scopes[index].CpuEnd = Stopwatch::GetTimestamp();
+		frame->Scopes[index].GpuEnd = WriteTimestamp();
+
+		m_OpenScope = frame->Scopes[index].Parent;
+		--m_Depth;
+
+		if( m_EmitPerformanceMarkers )
+			Performance::EndEvent();
+	}
+
+	void FrameProfiler::Flush()
+	{
+		ResolveFrames( true );
+	}
+
+	void FrameProfiler::ResolveFrames( bool force )
+	{
+		while( m_Pending->Count > 0 )
+		{
+			PendingFrame^ frame = m_Pending->Peek();
+
+			if( m_Source == nullptr )
+			{
+				Resolve( frame, false, 0, false );
+			}
+			else
+			{
+				if( m_Timestamps->Length < frame->TimestampCount )
+					m_Timestamps = gcnew array<Int64>( Math::Max( frame->TimestampCount, m_Timestamps->Length * 2 ) );
+
+				Int64 frequency;
+				bool isDisjoint;
+				if( m_Source->TryGetTimestamps( frame->Number, m_Timestamps, frame->TimestampCount, frequency, isDisjoint ) )
+				{
+					Resolve( frame, true, frequency, isDisjoint );
+				}
+				else if( force )
+				{
+					++m_DroppedFrameCount;
+					Resolve( frame, false, 0, false );
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			m_Pending->Dequeue();
+			m_FreeFrames->Push( frame );
+		}
+	}
+
+	void FrameProfiler::Resolve( PendingFrame^ frame, bool hasGpuData, Int64 frequency, bool isDisjoint )
+	{
+		bool hasGpuTimings = hasGpuData && !isDisjoint && frequency > 0;
+		double cpuScale = 1000.0 / Stopwatch::Frequency;
+		double gpuScale = hasGpuTimings ? 1000.0 / frequency : 0.0;
+
+		Int64 cpuOrigin = frame->Scopes[0].CpuBegin;
+		Int64 gpuOrigin = hasGpuTimings ? m_Timestamps[frame->Scopes[0].GpuBegin] : 0;
+
+		array<ProfilerNode^>^ nodes = gcnew array<ProfilerNode^>( frame->ScopeCount );
+		for( int i = 0; i < frame->ScopeCount; ++i )
+		{
+			ScopeRecord record = frame->Scopes[i];
+
+			double gpuStart = Double::NaN;
+			double gpuTime = Double::NaN;
+			if( hasGpuTimings )
+			{
+				gpuStart = ( m_Timestamps[record.GpuBegin] - gpuOrigin ) * gpuScale;
+				gpuTime = ( m_Timestamps[record.GpuEnd] - m_Timestamps[record.GpuBegin] ) * gpuScale;
+			}
+
+			nodes[i] = gcnew ProfilerNode( record.Name, record.Parent >= 0 ? nodes[record.Parent] : nullptr,
+				( record.CpuBegin - cpuOrigin ) * cpuScale, ( record.CpuEnd - record.CpuBegin ) * cpuScale, gpuStart, gpuTime );
+			AddHistory( nodes[i] );
+
+			frame->Scopes[i].Name = nullptr;
+		}
+
+		m_LastFrame = gcnew ProfilerFrame( frame->Number, nodes[0], hasGpuTimings, hasGpuData && isDisjoint );
+		FrameResolved( this, gcnew ProfilerFrameEventArgs( m_LastFrame ) );
+	}
+
+	void FrameProfiler::AddHistory( ProfilerNode^ node )
+	{
+		ScopeHistory^ history;
+		if( !m_History->TryGetValue( node->Path, history ) )
+		{
+			history = gcnew ScopeHistory();
+			history->CpuTimes = gcnew array<double>( m_HistoryLength );
+			history->GpuTimes = gcnew array<double>( m_HistoryLength );
+
+			m_History->Add( node->Path, history );
+			m_HistoryOrder->Add( node->Path );
+		}
+
+		history->CpuTimes[history->Next] = node->CpuTime;
+		history->GpuTimes[history->Next] = node->GpuTime;
+		history->Next = ( history->Next + 1 ) % history->CpuTimes->Length;
+		if( history->Count < history->CpuTimes->Length )
+			++history->Count;
+	}
+
+	void FrameProfiler::ResetStatistics()
+	{
+		m_History->Clear();
+		m_HistoryOrder->Clear();
+	}
+
+	ReadOnlyCollection<ProfilerStatistics^>^ FrameProfiler::GetStatistics()
+	{
+		List<ProfilerStatistics^>^ statistics = gcnew List<ProfilerStatistics^>( m_HistoryOrder->Count );
+
+		for each( String^ path in m_HistoryOrder )
+		{
+			ScopeHistory^ history = m_History[path];
+			statistics->Add( gcnew ProfilerStatistics( path, history->CpuTimes, history->GpuTimes, history->Count ) );
+		}
+
+		return gcnew ReadOnlyCollection<ProfilerStatistics^>( statistics );
+	}
+
+	void FrameProfiler::WriteStatisticsJson( TextWriter^ writer )
+	{
+		if( writer == nullptr )
+			throw gcnew ArgumentNullException( "writer" );
+
+		ReadOnlyCollection<ProfilerStatistics^>^ statistics = GetStatistics();
+
+		writer->Write( '[' );
+		for( int i = 0; i < statistics->Count; ++i )
+		{
+			if( i > 0 )
+				writer->Write( ',' );
+			statistics[i]->WriteJson( writer );
+		}
+		writer->Write( ']' );
+	}
+
+	void FrameProfiler::WriteStatisticsCsv( TextWriter^ writer )
+	{
+		if( writer == nullptr )
+			throw gcnew ArgumentNullException( "writer" );
+
+		writer->WriteLine( "Path,Samples,CpuAverage,CpuMinimum,CpuMaximum,GpuSamples,GpuAverage,GpuMinimum,GpuMaximum" );
+		for each( ProfilerStatistics^ statistics in GetStatistics() )
+			statistics->WriteCsv( writer );
+	}
+}
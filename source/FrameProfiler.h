@@ -0,0 +1,259 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "IGpuTimestampSource.h"
+#include "ProfilerFrame.h"
+#include "ProfilerStatistics.h"
+
+namespace SlimDX
+{
+	ref class FrameProfiler;
+
+#ifdef XMLDOCS
+	ref class Performance;
+#endif
+
+	/// <summary>
+	/// Ends a <see cref="FrameProfiler"/> scope when disposed.
+	/// </summary>
+	/// <remarks>
+	/// Scope objects are owned and reused by the profiler, so they must not be kept after being disposed.
+	/// </remarks>
+	public ref class ProfilerScope sealed
+	{
+	private:
+		FrameProfiler^ m_Profiler;
+
+	internal:
+		int Index;
+
+		ProfilerScope( FrameProfiler^ profiler );
+
+	public:
+		/// <summary>
+		/// Ends the scope.
+		/// </summary>
+		~ProfilerScope();
+	};
+
+	/// <summary>
+	/// Records nested CPU and GPU timings for each frame and keeps rolling statistics for every scope.
+	/// </summary>
+	/// <remarks>
+	/// CPU times are measured when scopes begin and end. GPU times are read from an <see cref="IGpuTimestampSource"/>
+	/// some frames later, without stalling; if they are still unavailable once <see cref="IGpuTimestampSource::FrameLatency"/>
+	/// newer frames have begun, the frame is resolved with CPU times only. A profiler is meant to be used from a single thread.
+	/// </remarks>
+	public ref class FrameProfiler sealed
+	{
+	private:
+		value class ScopeRecord
+		{
+		public:
+			System::String^ Name;
+			int Parent;
+			System::Int64 CpuBegin;
+			System::Int64 CpuEnd;
+			int GpuBegin;
+			int GpuEnd;
+		};
+
+		ref class PendingFrame
+		{
+		public:
+			System::Int64 Number;
+			array<ScopeRecord>^ Scopes;
+			int ScopeCount;
+			int TimestampCount;
+		};
+
+		ref class ScopeHistory
+		{
+		public:
+			array<double>^ CpuTimes;
+			array<double>^ GpuTimes;
+			int Count;
+			int Next;
+		};
+
+		IGpuTimestampSource^ m_Source;
+		System::Collections::Generic::Queue<PendingFrame^>^ m_Pending;
+		System::Collections::Generic::Stack<PendingFrame^>^ m_FreeFrames;
+		System::Collections::Generic::List<ProfilerScope^>^ m_ScopeObjects;
+		System::Collections::Generic::Dictionary<System::String^, ScopeHistory^>^ m_History;
+		System::Collections::Generic::List<System::String^>^ m_HistoryOrder;
+		array<System::Int64>^ m_Timestamps;
+		PendingFrame^ m_Current;
+		ProfilerFrame^ m_LastFrame;
+		System::Int64 m_FrameNumber;
+		int m_OpenScope;
+		int m_Depth;
+		int m_HistoryLength;
+		int m_DroppedFrameCount;
+		bool m_EmitPerformanceMarkers;
+
+		void Initialize( IGpuTimestampSource^ source );
+		int WriteTimestamp();
+		void ResolveFrames( bool force );
+		void Resolve( PendingFrame^ frame, bool hasGpuData, System::Int64 frequency, bool isDisjoint );
+		void AddHistory( ProfilerNode^ node );
+
+	internal:
+		void EndScope( int index );
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="FrameProfiler"/> class that measures CPU times only.
+		/// </summary>
+		FrameProfiler();
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="FrameProfiler"/> class.
+		/// </summary>
+		/// <param name="source">The source of GPU timestamps, or <c>null</c> to measure CPU times only.</param>
+		FrameProfiler( IGpuTimestampSource^ source );
+
+		/// <summary>
+		/// Marks the start of a frame.
+		/// </summary>
+		void BeginFrame();
+
+		/// <summary>
+		/// Marks the end of the current frame and resolves any earlier frames whose GPU timings have become available.
+		/// </summary>
+		void EndFrame();
+
+		/// <summary>
+		/// Begins a scope nested within the innermost open scope of the current frame.
+		/// </summary>
+		/// <param name="name">The name of the scope.</param>
+		/// <returns>An object that ends the scope when disposed.</returns>
+		ProfilerScope^ BeginScope( System::String^ name );
+
+		/// <summary>
+		/// Ends the innermost open scope of the current frame.
+		/// </summary>
+		void EndScope();
+
+		/// <summary>
+		/// Resolves every pending frame, using GPU timings only for frames whose results are already available.
+		/// </summary>
+		void Flush();
+
+		/// <summary>
+		/// Discards the rolling statistics gathered so far.
+		/// </summary>
+		void ResetStatistics();
+
+		/// <summary>
+		/// Gets the rolling statistics of every scope path seen since the statistics were last reset.
+		/// </summary>
+		/// <returns>The statistics, in the order the scope paths were first seen.</returns>
+		System::Collections::ObjectModel::ReadOnlyCollection<ProfilerStatistics^>^ GetStatistics();
+
+		/// <summary>
+		/// Writes the rolling statistics as a JSON array.
+		/// </summary>
+		/// <param name="writer">The writer that receives the JSON text.</param>
+		void WriteStatisticsJson( System::IO::TextWriter^ writer );
+
+		/// <summary>
+		/// Writes the rolling statistics as comma separated values, one line per scope path, preceded by a header line.
+		/// </summary>
+		/// <param name="writer">The writer that receives the CSV text.</param>
+		void WriteStatisticsCsv( System::IO::TextWriter^ writer );
+
+		/// <summary>
+		/// Occurs when the timings of a frame have been resolved.
+		/// </summary>
+		event System::EventHandler<ProfilerFrameEventArgs^>^ FrameResolved;
+
+		/// <summary>
+		/// Gets the source of GPU timestamps, or <c>null</c> if the profiler measures CPU times only.
+		/// </summary>
+		property IGpuTimestampSource^ TimestampSource
+		{
+			IGpuTimestampSource^ get() { return m_Source; }
+		}
+
+		/// <summary>
+		/// Gets the most recently resolved frame, or <c>null</c> if no frame has been resolved yet.
+		/// </summary>
+		property ProfilerFrame^ LastFrame
+		{
+			ProfilerFrame^ get() { return m_LastFrame; }
+		}
+
+		/// <summary>
+		/// Gets the number of the current frame, or of the next frame if none is in progress.
+		/// </summary>
+		property System::Int64 FrameNumber
+		{
+			System::Int64 get() { return m_FrameNumber; }
+		}
+
+		/// <summary>
+		/// Gets whether a frame is in progress.
+		/// </summary>
+		property bool IsFrameActive
+		{
+			bool get() { return m_Current != nullptr; }
+		}
+
+		/// <summary>
+		/// Gets the number of ended frames whose timings have not been resolved yet.
+		/// </summary>
+		property int PendingFrameCount
+		{
+			int get() { return m_Pending->Count; }
+		}
+
+		/// <summary>
+		/// Gets the number of frames that were resolved without GPU timings because the GPU results were not ready in time.
+		/// </summary>
+		property int DroppedFrameCount
+		{
+			int get() { return m_DroppedFrameCount; }
+		}
+
+		/// <summary>
+		/// Gets or sets the number of frames each scope's rolling statistics cover. Changing the value resets the statistics.
+		/// The default value is 60.
+		/// </summary>
+		property int HistoryLength
+		{
+			int get();
+			void set( int value );
+		}
+
+		/// <summary>
+		/// Gets or sets whether scopes are also reported to PIX through <see cref="Performance::BeginEvent"/> and
+		/// <see cref="Performance::EndEvent"/>. The default value is <c>false</c>.
+		/// </summary>
+		property bool EmitPerformanceMarkers
+		{
+			bool get() { return m_EmitPerformanceMarkers; }
+			void set( bool value ) { m_EmitPerformanceMarkers = value; }
+		}
+	};
+}
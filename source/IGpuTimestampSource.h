@@ -0,0 +1,80 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+using System::Runtime::InteropServices::OutAttribute;
+
+namespace SlimDX
+{
+#ifdef XMLDOCS
+	ref class FrameProfiler;
+#endif
+
+	/// <summary>
+	/// Supplies GPU timestamps to a <see cref="FrameProfiler"/>.
+	/// </summary>
+	/// <remarks>
+	/// Timestamps are written into numbered slots, starting at zero for each frame, and are read back once the GPU has
+	/// finished the frame. Implementations only need to keep the data for the most recent <see cref="FrameLatency"/> frames;
+	/// the profiler stops asking for a frame once that many newer frames have begun.
+	/// </remarks>
+	public interface struct IGpuTimestampSource
+	{
+		/// <summary>
+		/// Gets the number of frames whose timestamps can be pending at once.
+		/// </summary>
+		property int FrameLatency
+		{
+			int get();
+		}
+
+		/// <summary>
+		/// Marks the start of a frame's timestamps.
+		/// </summary>
+		/// <param name="frame">The number of the frame.</param>
+		virtual void BeginFrame( System::Int64 frame ) = 0;
+
+		/// <summary>
+		/// Writes a timestamp into a slot of the current frame.
+		/// </summary>
+		/// <param name="frame">The number of the current frame.</param>
+		/// <param name="slot">The zero-based slot to write.</param>
+		virtual void WriteTimestamp( System::Int64 frame, int slot ) = 0;
+
+		/// <summary>
+		/// Marks the end of a frame's timestamps.
+		/// </summary>
+		/// <param name="frame">The number of the frame.</param>
+		virtual void EndFrame( System::Int64 frame ) = 0;
+
+		/// <summary>
+		/// Reads back the timestamps of a completed frame without waiting for the GPU.
+		/// </summary>
+		/// <param name="frame">The number of the frame.</param>
+		/// <param name="timestamps">Receives the timestamps, indexed by slot.</param>
+		/// <param name="count">The number of slots to read.</param>
+		/// <param name="frequency">When the method returns <c>true</c>, receives the frequency of the timestamp counter in Hz.</param>
+		/// <param name="isDisjoint">When the method returns <c>true</c>, receives whether the counter was discontinuous during the frame.</param>
+		/// <returns><c>true</c> if the timestamps were available; otherwise, <c>false</c>.</returns>
+		virtual bool TryGetTimestamps( System::Int64 frame, array<System::Int64>^ timestamps, int count, [Out] System::Int64% frequency, [Out] bool% isDisjoint ) = 0;
+	};
+}
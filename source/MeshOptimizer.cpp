@@ -0,0 +1,186 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <string.h>
+
+#include "MeshOptimizer.h"
+#include "MeshOptimizerKernels.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+	static void CheckCounts( int indexCount, bool triangles, int vertexCount )
+	{
+		if( indexCount < 0 || ( triangles && indexCount % 3 != 0 ) )
+			throw gcnew ArgumentOutOfRangeException( "indexCount", triangles ? "The index count must be a non-negative multiple of three." : "The index count must not be negative." );
+		if( vertexCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexCount", "The vertex count must not be negative." );
+	}
+
+	static void CheckCacheSize( int cacheSize )
+	{
+		if( cacheSize <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "cacheSize", "The cache size must be greater than zero." );
+	}
+
+	static void CheckVertices( DataStream^ vertices, int vertexCount, int vertexStride )
+	{
+		if( vertices == nullptr )
+			throw gcnew ArgumentNullException( "vertices" );
+		if( vertexStride <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexStride", "The vertex stride must be greater than zero." );
+		if( vertices->RemainingLength < static_cast<Int64>( vertexCount ) * vertexStride )
+			throw gcnew ArgumentException( "The data stream is too small for the vertex count.", "vertices" );
+	}
+
+	static void ReadIndices( DataStream^ indices, int indexCount, bool use32BitIndices, int vertexCount, std::vector<unsigned int>& result )
+	{
+		if( indices == nullptr )
+			throw gcnew ArgumentNullException( "indices" );
+		if( indices->RemainingLength < static_cast<Int64>( indexCount ) * ( use32BitIndices ? 4 : 2 ) )
+			throw gcnew ArgumentException( "The data stream is too small for the index count.", "indices" );
+
+		result.resize( indexCount > 0 ? indexCount : 1 );
+		if( use32BitIndices )
+		{
+			memcpy( &result[0], indices->PositionPointer, indexCount * sizeof( unsigned int ) );
+		}
+		else
+		{
+			const unsigned short* source = reinterpret_cast<const unsigned short*>( indices->PositionPointer );
+			for( int i = 0; i < indexCount; ++i )
+				result[i] = source[i];
+		}
+
+		for( int i = 0; i < indexCount; ++i )
+		{
+			if( result[i] >= static_cast<unsigned int>( vertexCount ) )
+				throw gcnew ArgumentException( "The index data refers to vertices beyond the vertex count.", "indices" );
+		}
+	}
+
+	static void WriteIndices( DataStream^ indices, int indexCount, bool use32BitIndices, const std::vector<unsigned int>& values )
+	{
+		if( !indices->CanWrite )
+			throw gcnew NotSupportedException( "The index stream is not writable." );
+
+		if( use32BitIndices )
+		{
+			memcpy( indices->PositionPointer, &values[0], indexCount * sizeof( unsigned int ) );
+		}
+		else
+		{
+			unsigned short* destination = reinterpret_cast<unsigned short*>( indices->PositionPointer );
+			for( int i = 0; i < indexCount; ++i )
+				destination[i] = static_cast<unsigned short>( values[i] );
+		}
+	}
+
+	void MeshOptimizer::OptimizeVertexCache( DataStream^ indices, int indexCount, bool use32BitIndices, int vertexCount, int cacheSize )
+	{
+		CheckCounts( indexCount, true, vertexCount );
+		CheckCacheSize( cacheSize );
+
+		std::vector<unsigned int> source;
+		ReadIndices( indices, indexCount, use32BitIndices, vertexCount, source );
+		if( indexCount == 0 )
+			return;
+
+		std::vector<unsigned int> result( indexCount );
+		OptimizeVertexCacheOrder( &source[0], indexCount, vertexCount, cacheSize, &result[0] );
+		WriteIndices( indices, indexCount, use32BitIndices, result );
+	}
+
+	void MeshOptimizer::OptimizeOverdraw( DataStream^ indices, int indexCount, bool use32BitIndices, DataStream^ vertices, int vertexCount,
+		int vertexStride, int positionOffset, int cacheSize, float threshold )
+	{
+		CheckCounts( indexCount, true, vertexCount );
+		CheckCacheSize( cacheSize );
+		CheckVertices( vertices, vertexCount, vertexStride );
+		if( positionOffset < 0 || positionOffset + 3 * static_cast<int>( sizeof( float ) ) > vertexStride )
+			throw gcnew ArgumentOutOfRangeException( "positionOffset", "The position must lie within the vertex." );
+		if( !( threshold >= 1.0f ) )
+			throw gcnew ArgumentOutOfRangeException( "threshold", "The threshold must be at least one." );
+
+		std::vector<unsigned int> source;
+		ReadIndices( indices, indexCount, use32BitIndices, vertexCount, source );
+		if( indexCount == 0 )
+			return;
+
+		std::vector<unsigned int> result( indexCount );
+		OptimizeOverdrawOrder( &source[0], indexCount, reinterpret_cast<const unsigned char*>( vertices->PositionPointer ), vertexCount,
+			vertexStride, positionOffset, cacheSize, threshold, &result[0] );
+		WriteIndices( indices, indexCount, use32BitIndices, result );
+	}
+
+	array<int>^ MeshOptimizer::OptimizeVertexFetch( DataStream^ indices, int indexCount, bool use32BitIndices, DataStream^ vertices, int vertexCount, int vertexStride )
+	{
+		CheckCounts( indexCount, false, vertexCount );
+		CheckVertices( vertices, vertexCount, vertexStride );
+		if( !vertices->CanWrite )
+			throw gcnew NotSupportedException( "The vertex stream is not writable." );
+
+		std::vector<unsigned int> values;
+		ReadIndices( indices, indexCount, use32BitIndices, vertexCount, values );
+
+		std::vector<unsigned int> remap;
+		BuildVertexFetchRemap( &values[0], indexCount, vertexCount, remap );
+
+		array<int>^ vertexRemap = gcnew array<int>( vertexCount );
+		if( vertexCount == 0 )
+			return vertexRemap;
+
+		std::vector<unsigned int> inverse( vertexCount );
+		for( int v = 0; v < vertexCount; ++v )
+		{
+			vertexRemap[v] = static_cast<int>( remap[v] );
+			inverse[remap[v]] = v;
+		}
+
+		for( int i = 0; i < indexCount; ++i )
+			values[i] = inverse[values[i]];
+
+		unsigned char* data = reinterpret_cast<unsigned char*>( vertices->PositionPointer );
+		std::vector<unsigned char> original( data, data + static_cast<size_t>( vertexCount ) * vertexStride );
+		for( int v = 0; v < vertexCount; ++v )
+			memcpy( data + static_cast<size_t>( v ) * vertexStride, &original[static_cast<size_t>( remap[v] ) * vertexStride], vertexStride );
+
+		if( indexCount > 0 )
+			WriteIndices( indices, indexCount, use32BitIndices, values );
+
+		return vertexRemap;
+	}
+
+	VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache( DataStream^ indices, int indexCount, bool use32BitIndices, int vertexCount, int cacheSize )
+	{
+		CheckCounts( indexCount, true, vertexCount );
+		CheckCacheSize( cacheSize );
+
+		std::vector<unsigned int> values;
+		ReadIndices( indices, indexCount, use32BitIndices, vertexCount, values );
+
+		int transformed = CountTransformedVertices( &values[0], indexCount, vertexCount, cacheSize );
+		int referenced = CountReferencedVertices( &values[0], indexCount, vertexCount );
+		return VertexCacheStatistics( indexCount / 3, referenced, transformed, cacheSize );
+	}
+}
@@ -0,0 +1,99 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "DataStream.h"
+#include "VertexCacheStatistics.h"
+
+namespace SlimDX
+{
+	/// <summary>
+	/// Reorders and analyzes triangle lists for the post transform vertex cache, without depending on D3DX.
+	/// </summary>
+	/// <remarks>
+	/// Index data is read from, and written back to, the current position of the stream, which is left unchanged; indices may be 16 or 32 bits wide.
+	/// Reordering triangles across subsets would break attribute tables, so for meshes with several subsets the
+	/// triangle optimizers should be run once per attribute range. The results work with both Direct3D 9 and Direct3D 10 meshes,
+	/// and can be measured with <see cref="AnalyzeVertexCache"/> before and after optimizing.
+	/// </remarks>
+	/// <unmanaged>None</unmanaged>
+	public ref class MeshOptimizer sealed
+	{
+	private:
+		MeshOptimizer() { }
+
+	public:
+		/// <summary>
+		/// Reorders the triangles of an indexed triangle list to reduce the number of vertices transformed.
+		/// </summary>
+		/// <param name="indices">The index data to reorder in place.</param>
+		/// <param name="indexCount">The number of indices; a multiple of three.</param>
+		/// <param name="use32BitIndices"><c>true</c> if the indices are 32 bits wide; <c>false</c> if they are 16 bits wide.</param>
+		/// <param name="vertexCount">The number of vertices referenced by the index data.</param>
+		/// <param name="cacheSize">The number of entries in the post transform cache to optimize for; 16 to 32 suits most hardware.</param>
+		static void OptimizeVertexCache( DataStream^ indices, int indexCount, bool use32BitIndices, int vertexCount, int cacheSize );
+
+		/// <summary>
+		/// Reorders clusters of a vertex cache optimized triangle list so that triangles likely to occlude others are drawn first.
+		/// </summary>
+		/// <param name="indices">The index data to reorder in place; it should already have been passed to <see cref="OptimizeVertexCache"/>.</param>
+		/// <param name="indexCount">The number of indices; a multiple of three.</param>
+		/// <param name="use32BitIndices"><c>true</c> if the indices are 32 bits wide; <c>false</c> if they are 16 bits wide.</param>
+		/// <param name="vertices">The vertex data, holding a three component floating point position in each vertex.</param>
+		/// <param name="vertexCount">The number of vertices.</param>
+		/// <param name="vertexStride">The size of each vertex, in bytes.</param>
+		/// <param name="positionOffset">The offset of the position within each vertex, in bytes.</param>
+		/// <param name="cacheSize">The number of entries in the post transform cache.</param>
+		/// <param name="threshold">
+		/// How much the average cache miss ratio may grow in exchange for finer clusters; 1 keeps the cache efficiency
+		/// of the input and 1.05 is a good balance.
+		/// </param>
+		static void OptimizeOverdraw( DataStream^ indices, int indexCount, bool use32BitIndices, DataStream^ vertices, int vertexCount,
+			int vertexStride, int positionOffset, int cacheSize, float threshold );
+
+		/// <summary>
+		/// Reorders vertices into the order they are first used by the index data, which improves memory locality for vertex fetch.
+		/// </summary>
+		/// <param name="indices">The index data, which is rewritten in place to refer to the new vertex order.</param>
+		/// <param name="indexCount">The number of indices.</param>
+		/// <param name="use32BitIndices"><c>true</c> if the indices are 32 bits wide; <c>false</c> if they are 16 bits wide.</param>
+		/// <param name="vertices">The vertex data to reorder in place.</param>
+		/// <param name="vertexCount">The number of vertices.</param>
+		/// <param name="vertexStride">The size of each vertex, in bytes.</param>
+		/// <returns>
+		/// An array of integers, one per vertex, holding the original index of each vertex in its new position.
+		/// Vertices that are never referenced are moved to the end.
+		/// </returns>
+		static array<int>^ OptimizeVertexFetch( DataStream^ indices, int indexCount, bool use32BitIndices, DataStream^ vertices, int vertexCount, int vertexStride );
+
+		/// <summary>
+		/// Measures how an indexed triangle list performs with a first-in first-out post transform cache.
+		/// </summary>
+		/// <param name="indices">The index data to analyze.</param>
+		/// <param name="indexCount">The number of indices; a multiple of three.</param>
+		/// <param name="use32BitIndices"><c>true</c> if the indices are 32 bits wide; <c>false</c> if they are 16 bits wide.</param>
+		/// <param name="vertexCount">The number of vertices referenced by the index data.</param>
+		/// <param name="cacheSize">The number of entries in the simulated cache.</param>
+		/// <returns>The measured cache statistics.</returns>
+		static VertexCacheStatistics AnalyzeVertexCache( DataStream^ indices, int indexCount, bool use32BitIndices, int vertexCount, int cacheSize );
+	};
+}
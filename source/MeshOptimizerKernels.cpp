@@ -0,0 +1,417 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <math.h>
+#include <algorithm>
+
+#include "MeshOptimizerKernels.h"
+
+// The optimizers have no dependency on Direct3D or the CLR, so they are compiled as plain native code.
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+	namespace
+	{
+		// Forsyth's scoring constants.
+		const float CacheDecayPower = 1.5f;
+		const float LastTriangleScore = 0.75f;
+		const float ValenceBoostScale = 2.0f;
+		const float ValenceBoostPower = 0.5f;
+
+		// The largest cache modelled; real hardware caches are far smaller.
+		const int MaximumCacheSize = 64;
+
+		struct Adjacency
+		{
+			std::vector<int> Offsets;
+			std::vector<int> Triangles;
+		};
+
+		void BuildAdjacency( const unsigned int* indices, int indexCount, int vertexCount, Adjacency& adjacency )
+		{
+			adjacency.Offsets.assign( vertexCount + 1, 0 );
+			for( int i = 0; i < indexCount; ++i )
+				++adjacency.Offsets[indices[i] + 1];
+
+			for( int v = 0; v < vertexCount; ++v )
+				adjacency.Offsets[v + 1] += adjacency.Offsets[v];
+
+			std::vector<int> fill( adjacency.Offsets.begin(), adjacency.Offsets.end() - 1 );
+			adjacency.Triangles.resize( indexCount );
+			for( int i = 0; i < indexCount; ++i )
+				adjacency.Triangles[fill[indices[i]]++] = i / 3;
+		}
+
+		float VertexScore( int cachePosition, int remainingTriangles, int cacheSize )
+		{
+			if( remainingTriangles == 0 )
+				return -1.0f;
+
+			float score = 0.0f;
+			if( cachePosition >= 0 )
+			{
+				if( cachePosition < 3 )
+					score = LastTriangleScore;
+				else
+					score = powf( 1.0f - static_cast<float>( cachePosition - 3 ) / ( cacheSize - 3 ), CacheDecayPower );
+			}
+
+			return score + ValenceBoostScale * powf( static_cast<float>( remainingTriangles ), -ValenceBoostPower );
+		}
+
+		// Counts misses of a FIFO cache over a run of triangles, starting cold.
+		class FifoCache
+		{
+		private:
+			std::vector<unsigned int> m_Stamps;
+			unsigned int m_Time;
+			int m_Size;
+
+		public:
+			FifoCache( int vertexCount, int cacheSize )
+				: m_Stamps( vertexCount, 0 ), m_Time( 1 ), m_Size( cacheSize )
+			{
+			}
+
+			void Reset()
+			{
+				// entries older than the cache size are misses, so advancing time past them empties the cache
+				m_Time += m_Size;
+			}
+
+			bool Access( unsigned int vertex )
+			{
+				if( m_Stamps[vertex] != 0 && m_Time - m_Stamps[vertex] < static_cast<unsigned int>( m_Size ) )
+					return false;
+
+				m_Stamps[vertex] = ++m_Time;
+				return true;
+			}
+		};
+	}
+
+	void OptimizeVertexCacheOrder( const unsigned int* indices, int indexCount, int vertexCount, int cacheSize, unsigned int* destination )
+	{
+		int triangleCount = indexCount / 3;
+		if( triangleCount == 0 )
+			return;
+
+		cacheSize = cacheSize < 4 ? 4 : ( cacheSize > MaximumCacheSize ? MaximumCacheSize : cacheSize );
+
+		Adjacency adjacency;
+		BuildAdjacency( indices, indexCount, vertexCount, adjacency );
+
+		std::vector<int> remaining( vertexCount );
+		std::vector<int> cachePosition( vertexCount, -1 );
+		std::vector<float> vertexScores( vertexCount );
+		for( int v = 0; v < vertexCount; ++v )
+		{
+			remaining[v] = adjacency.Offsets[v + 1] - adjacency.Offsets[v];
+			vertexScores[v] = VertexScore( -1, remaining[v], cacheSize );
+		}
+
+		std::vector<float> triangleScores( triangleCount );
+		std::vector<bool> emitted( triangleCount, false );
+		for( int t = 0; t < triangleCount; ++t )
+			triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+
+		// three extra slots hold the vertices pushed out by the last triangle while scores are updated
+		int cache[MaximumCacheSize + 3];
+		int newCache[MaximumCacheSize + 3];
+		int cacheCount = 0;
+
+		int bestTriangle = 0;
+		for( int t = 1; t < triangleCount; ++t )
+		{
+			if( triangleScores[t] > triangleScores[bestTriangle] )
+				bestTriangle = t;
+		}
+
+		int nextUnemitted = 0;
+		for( int output = 0; output < triangleCount; ++output )
+		{
+			if( bestTriangle < 0 )
+			{
+				// nothing in the cache touches a remaining triangle; continue from the first one left
+				while( emitted[nextUnemitted] )
+					++nextUnemitted;
+				bestTriangle = nextUnemitted;
+			}
+
+			const unsigned int* triangle = indices + bestTriangle * 3;
+			destination[output * 3 + 0] = triangle[0];
+			destination[output * 3 + 1] = triangle[1];
+			destination[output * 3 + 2] = triangle[2];
+			emitted[bestTriangle] = true;
+
+			// the emitted triangle's vertices move to the front of the cache
+			int newCount = 0;
+			for( int k = 0; k < 3; ++k )
+			{
+				int vertex = static_cast<int>( triangle[k] );
+				if( k == 0 || ( vertex != newCache[0] && vertex != newCache[newCount - 1] ) )
+					newCache[newCount++] = vertex;
+				--remaining[vertex];
+
+				// unlink the triangle so adjacency only lists triangles still to be emitted
+				int first = adjacency.Offsets[vertex];
+				int count = remaining[vertex] + 1;
+				for( int a = first; a < first + count; ++a )
+				{
+					if( adjacency.Triangles[a] == bestTriangle )
+					{
+						adjacency.Triangles[a] = adjacency.Triangles[first + count - 1];
+						break;
+					}
+				}
+			}
+
+			int triangleVertices = newCount;
+			for( int c = 0; c < cacheCount; ++c )
+			{
+				int vertex = cache[c];
+				bool present = false;
+				for( int k = 0; k < triangleVertices; ++k )
+					present = present || newCache[k] == vertex;
+
+				if( !present )
+					newCache[newCount++] = vertex;
+			}
+
+			for( int c = 0; c < newCount; ++c )
+			{
+				int vertex = newCache[c];
+				cachePosition[vertex] = c < cacheSize ? c : -1;
+			}
+
+			// rescore the affected vertices and the triangles that still use them, picking the best for next time
+			bestTriangle = -1;
+			float bestScore = -1.0f;
+			for( int c = 0; c < newCount; ++c )
+			{
+				int vertex = newCache[c];
+				float score = VertexScore( cachePosition[vertex], remaining[vertex], cacheSize );
+				float delta = score - vertexScores[vertex];
+				vertexScores[vertex] = score;
+
+				int first = adjacency.Offsets[vertex];
+				for( int a = first; a < first + remaining[vertex]; ++a )
+				{
+					int t = adjacency.Triangles[a];
+					triangleScores[t] += delta;
+				}
+			}
+
+			for( int c = 0; c < newCount && c < cacheSize; ++c )
+			{
+				int vertex = newCache[c];
+				int first = adjacency.Offsets[vertex];
+				for( int a = first; a < first + remaining[vertex]; ++a )
+				{
+					int t = adjacency.Triangles[a];
+					if( triangleScores[t] > bestScore )
+					{
+						bestScore = triangleScores[t];
+						bestTriangle = t;
+					}
+				}
+			}
+
+			cacheCount = newCount < cacheSize ? newCount : cacheSize;
+			for( int c = 0; c < cacheCount; ++c )
+				cache[c] = newCache[c];
+		}
+	}
+
+	void OptimizeOverdrawOrder( const unsigned int* indices, int indexCount, const unsigned char* vertices, int vertexCount,
+		int vertexStride, int positionOffset, int cacheSize, float threshold, unsigned int* destination )
+	{
+		int triangleCount = indexCount / 3;
+		if( triangleCount == 0 )
+			return;
+
+		// hard boundaries are triangles that miss on every vertex; the cache is effectively cold there already
+		std::vector<int> clusters;
+		FifoCache cache( vertexCount, cacheSize );
+		for( int t = 0; t < triangleCount; ++t )
+		{
+			int misses = cache.Access( indices[t * 3] ) + cache.Access( indices[t * 3 + 1] ) + cache.Access( indices[t * 3 + 2] );
+			if( misses == 3 )
+				clusters.push_back( t );
+		}
+
+		if( clusters.empty() || clusters[0] != 0 )
+			clusters.insert( clusters.begin(), 0 );
+
+		float limit = threshold * CountTransformedVertices( indices, indexCount, vertexCount, cacheSize ) / triangleCount;
+
+		// soft boundaries split hard clusters wherever restarting with a cold cache stays within the threshold
+		std::vector<int> starts;
+		for( size_t c = 0; c < clusters.size(); ++c )
+		{
+			int end = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+			int start = clusters[c];
+			int misses = 0;
+
+			cache.Reset();
+			starts.push_back( start );
+			for( int t = start; t < end; ++t )
+			{
+				misses += cache.Access( indices[t * 3] ) + cache.Access( indices[t * 3 + 1] ) + cache.Access( indices[t * 3 + 2] );
+
+				if( t + 1 < end && static_cast<float>( misses ) / ( t + 1 - start ) <= limit )
+				{
+					start = t + 1;
+					misses = 0;
+					cache.Reset();
+					starts.push_back( start );
+				}
+			}
+		}
+
+		// the mesh centroid, then each cluster's area weighted centroid and normal
+		float center[3] = { 0.0f, 0.0f, 0.0f };
+		float totalArea = 0.0f;
+		int clusterCount = static_cast<int>( starts.size() );
+		std::vector<float> clusterData( clusterCount * 7, 0.0f );
+
+		for( int c = 0; c < clusterCount; ++c )
+		{
+			int end = c + 1 < clusterCount ? starts[c + 1] : triangleCount;
+			float* data = &clusterData[c * 7];
+
+			for( int t = starts[c]; t < end; ++t )
+			{
+				const float* p0 = reinterpret_cast<const float*>( vertices + indices[t * 3] * static_cast<size_t>( vertexStride ) + positionOffset );
+				const float* p1 = reinterpret_cast<const float*>( vertices + indices[t * 3 + 1] * static_cast<size_t>( vertexStride ) + positionOffset );
+				const float* p2 = reinterpret_cast<const float*>( vertices + indices[t * 3 + 2] * static_cast<size_t>( vertexStride ) + positionOffset );
+
+				float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+				float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+				float normal[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+				float area = sqrtf( normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2] );
+
+				for( int k = 0; k < 3; ++k )
+				{
+					float centroid = ( p0[k] + p1[k] + p2[k] ) / 3.0f;
+					data[k] += centroid * area;
+					data[3 + k] += normal[k];
+					center[k] += centroid * area;
+				}
+
+				data[6] += area;
+				totalArea += area;
+			}
+		}
+
+		if( totalArea > 0.0f )
+		{
+			for( int k = 0; k < 3; ++k )
+				center[k] /= totalArea;
+		}
+
+		std::vector<std::pair<float, int> > order( clusterCount );
+		for( int c = 0; c < clusterCount; ++c )
+		{
+			float* data = &clusterData[c * 7];
+			float length = sqrtf( data[3] * data[3] + data[4] * data[4] + data[5] * data[5] );
+			float key = 0.0f;
+
+			if( data[6] > 0.0f && length > 0.0f )
+			{
+				for( int k = 0; k < 3; ++k )
+					key += ( data[k] / data[6] - center[k] ) * ( data[3 + k] / length );
+			}
+
+			// most outward facing first; they are the likeliest occluders
+			order[c] = std::make_pair( -key, c );
+		}
+
+		std::stable_sort( order.begin(), order.end() );
+
+		int output = 0;
+		for( int i = 0; i < clusterCount; ++i )
+		{
+			int c = order[i].second;
+			int end = c + 1 < clusterCount ? starts[c + 1] : triangleCount;
+
+			for( int t = starts[c] * 3; t < end * 3; ++t )
+				destination[output++] = indices[t];
+		}
+	}
+
+	int BuildVertexFetchRemap( const unsigned int* indices, int indexCount, int vertexCount, std::vector<unsigned int>& remap )
+	{
+		std::vector<bool> used( vertexCount, false );
+		remap.clear();
+		remap.reserve( vertexCount );
+
+		for( int i = 0; i < indexCount; ++i )
+		{
+			if( !used[indices[i]] )
+			{
+				used[indices[i]] = true;
+				remap.push_back( indices[i] );
+			}
+		}
+
+		int referenced = static_cast<int>( remap.size() );
+		for( int v = 0; v < vertexCount; ++v )
+		{
+			if( !used[v] )
+				remap.push_back( v );
+		}
+
+		return referenced;
+	}
+
+	int CountTransformedVertices( const unsigned int* indices, int indexCount, int vertexCount, int cacheSize )
+	{
+		FifoCache cache( vertexCount, cacheSize );
+		int misses = 0;
+
+		for( int i = 0; i < indexCount; ++i )
+			misses += cache.Access( indices[i] );
+
+		return misses;
+	}
+
+	int CountReferencedVertices( const unsigned int* indices, int indexCount, int vertexCount )
+	{
+		std::vector<bool> used( vertexCount, false );
+		int count = 0;
+
+		for( int i = 0; i < indexCount; ++i )
+		{
+			if( !used[indices[i]] )
+			{
+				used[indices[i]] = true;
+				++count;
+			}
+		}
+
+		return count;
+	}
+}
+
+#pragma managed(pop)
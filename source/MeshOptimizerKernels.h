@@ -0,0 +1,47 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+namespace SlimDX
+{
+	// Index buffers are processed as 32 bit indices; every index must be less than the vertex count.
+
+	// Reorders triangles for a post transform cache of the given size, after Forsyth's linear speed optimizer.
+	void OptimizeVertexCacheOrder( const unsigned int* indices, int indexCount, int vertexCount, int cacheSize, unsigned int* destination );
+
+	// Splits a cache optimized triangle list into clusters and sorts them so that outward facing clusters are drawn first.
+	// The threshold bounds how much worse the cache miss ratio of a cluster may get, relative to the whole list.
+	void OptimizeOverdrawOrder( const unsigned int* indices, int indexCount, const unsigned char* vertices, int vertexCount,
+		int vertexStride, int positionOffset, int cacheSize, float threshold, unsigned int* destination );
+
+	// Numbers vertices in order of first use; unreferenced vertices follow in their original order.
+	// Fills remap with the original index of each new vertex and returns the number of referenced vertices.
+	int BuildVertexFetchRemap( const unsigned int* indices, int indexCount, int vertexCount, std::vector<unsigned int>& remap );
+
+	// Simulates a FIFO post transform cache and returns the number of vertices transformed.
+	int CountTransformedVertices( const unsigned int* indices, int indexCount, int vertexCount, int cacheSize );
+
+	// Returns the number of distinct vertices referenced by the index list.
+	int CountReferencedVertices( const unsigned int* indices, int indexCount, int vertexCount );
+}
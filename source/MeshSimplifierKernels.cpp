@@ -0,0 +1,631 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <math.h>
+#include <algorithm>
+#include <queue>
+
+#include "MeshSimplifierKernels.h"
+
+// Like the mesh optimizer, the simplifier has no dependency on Direct3D or the CLR.
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+	namespace
+	{
+		enum VertexKind
+		{
+			VertexInterior,
+			VertexBorder,
+			VertexLocked
+		};
+
+		// Symmetric 4x4 error quadric, stored as its upper triangle.
+		struct Quadric
+		{
+			double A2, AB, AC, AD, B2, BC, BD, C2, CD, D2;
+
+			void Clear()
+			{
+				A2 = AB = AC = AD = B2 = BC = BD = C2 = CD = D2 = 0.0;
+			}
+
+			void AddPlane( double a, double b, double c, double d, double weight )
+			{
+				A2 += a * a * weight; AB += a * b * weight; AC += a * c * weight; AD += a * d * weight;
+				B2 += b * b * weight; BC += b * c * weight; BD += b * d * weight;
+				C2 += c * c * weight; CD += c * d * weight;
+				D2 += d * d * weight;
+			}
+
+			void Add( const Quadric& other )
+			{
+				A2 += other.A2; AB += other.AB; AC += other.AC; AD += other.AD;
+				B2 += other.B2; BC += other.BC; BD += other.BD;
+				C2 += other.C2; CD += other.CD;
+				D2 += other.D2;
+			}
+
+			double Evaluate( const float* p ) const
+			{
+				double x = p[0];
+				double y = p[1];
+				double z = p[2];
+
+				double result = A2 * x * x + 2.0 * AB * x * y + 2.0 * AC * x * z + 2.0 * AD * x
+					+ B2 * y * y + 2.0 * BC * y * z + 2.0 * BD * y
+					+ C2 * z * z + 2.0 * CD * z + D2;
+
+				return result > 0.0 ? result : 0.0;
+			}
+		};
+
+		struct Collapse
+		{
+			double Cost;
+			int From;
+			int To;
+			unsigned int FromStamp;
+			unsigned int ToStamp;
+
+			// orders the priority queue cheapest first
+			bool operator < ( const Collapse& other ) const
+			{
+				return Cost > other.Cost;
+			}
+		};
+
+		void Cross( const float* a, const float* b, const float* c, double* normal )
+		{
+			double e1[3] = { b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+			double e2[3] = { c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+			normal[0] = e1[1] * e2[2] - e1[2] * e2[1];
+			normal[1] = e1[2] * e2[0] - e1[0] * e2[2];
+			normal[2] = e1[0] * e2[1] - e1[1] * e2[0];
+		}
+
+		class Simplifier
+		{
+		private:
+			const SimplifierMesh& m_Mesh;
+
+			std::vector<unsigned int> m_Indices;
+			std::vector<bool> m_TriangleAlive;
+			std::vector<int> m_Uses;
+
+			// vertices sharing a position are wedges of one representative; collapses act on representatives
+			std::vector<int> m_Rep;
+			std::vector<std::vector<int> > m_Triangles;
+			std::vector<Quadric> m_Quadrics;
+			std::vector<double> m_Areas;
+			std::vector<float> m_Weights;
+			std::vector<unsigned char> m_Kind;
+			std::vector<bool> m_Alive;
+			std::vector<unsigned int> m_Stamps;
+
+			std::vector<unsigned int> m_Marks;
+			unsigned int m_MarkTime;
+			std::vector<std::pair<unsigned int, unsigned int> > m_Map;
+
+			std::priority_queue<Collapse> m_Heap;
+			int m_LiveTriangles;
+			int m_LiveVertices;
+			double m_MaximumCost;
+
+			const float* Position( unsigned int vertex ) const
+			{
+				return &m_Mesh.Positions[vertex * 3];
+			}
+
+			int CornerWithRep( int triangle, int rep ) const
+			{
+				for( int k = 0; k < 3; ++k )
+				{
+					if( m_Rep[m_Indices[triangle * 3 + k]] == rep )
+						return k;
+				}
+
+				return -1;
+			}
+
+			void Weld()
+			{
+				int vertexCount = m_Mesh.VertexCount;
+				std::vector<int> order( vertexCount );
+				for( int v = 0; v < vertexCount; ++v )
+					order[v] = v;
+
+				std::sort( order.begin(), order.end(), PositionLess( m_Mesh.Positions ) );
+
+				m_Rep.resize( vertexCount );
+				for( int i = 0; i < vertexCount; ++i )
+				{
+					const float* p = Position( order[i] );
+					const float* previous = i > 0 ? Position( order[i - 1] ) : NULL;
+					bool same = previous != NULL && p[0] == previous[0] && p[1] == previous[1] && p[2] == previous[2];
+					m_Rep[order[i]] = same ? m_Rep[order[i - 1]] : order[i];
+				}
+			}
+
+			struct PositionLess
+			{
+				const std::vector<float>& Positions;
+
+				PositionLess( const std::vector<float>& positions ) : Positions( positions ) { }
+
+				bool operator () ( int left, int right ) const
+				{
+					const float* a = &Positions[left * 3];
+					const float* b = &Positions[right * 3];
+					if( a[0] != b[0] ) return a[0] < b[0];
+					if( a[1] != b[1] ) return a[1] < b[1];
+					if( a[2] != b[2] ) return a[2] < b[2];
+					return left < right;
+				}
+			};
+
+			void Classify()
+			{
+				int triangleCount = static_cast<int>( m_Indices.size() / 3 );
+				std::vector<std::pair<unsigned long long, int> > edges;
+				edges.reserve( triangleCount * 3 );
+
+				for( int t = 0; t < triangleCount; ++t )
+				{
+					if( !m_TriangleAlive[t] )
+						continue;
+
+					for( int k = 0; k < 3; ++k )
+					{
+						unsigned long long a = m_Rep[m_Indices[t * 3 + k]];
+						unsigned long long b = m_Rep[m_Indices[t * 3 + ( k + 1 ) % 3]];
+						edges.push_back( std::make_pair( a < b ? ( a << 32 ) | b : ( b << 32 ) | a, t ) );
+					}
+				}
+
+				std::sort( edges.begin(), edges.end() );
+
+				std::vector<int> borderEdges( m_Mesh.VertexCount, 0 );
+				for( size_t i = 0; i < edges.size(); )
+				{
+					size_t end = i + 1;
+					while( end < edges.size() && edges[end].first == edges[i].first )
+						++end;
+
+					int a = static_cast<int>( edges[i].first >> 32 );
+					int b = static_cast<int>( edges[i].first & 0xFFFFFFFF );
+
+					if( end - i == 1 )
+					{
+						++borderEdges[a];
+						++borderEdges[b];
+						AddBorderPlane( a, b, edges[i].second );
+					}
+					else if( end - i > 2 )
+					{
+						m_Kind[a] = VertexLocked;
+						m_Kind[b] = VertexLocked;
+					}
+
+					i = end;
+				}
+
+				for( int v = 0; v < m_Mesh.VertexCount; ++v )
+				{
+					if( m_Rep[v] != v || m_Kind[v] == VertexLocked )
+						continue;
+
+					// a border vertex that is not on exactly one border loop can not be moved without tearing the outline
+					if( borderEdges[v] == 2 )
+						m_Kind[v] = VertexBorder;
+					else if( borderEdges[v] != 0 )
+						m_Kind[v] = VertexLocked;
+				}
+			}
+
+			void AddBorderPlane( int a, int b, int triangle )
+			{
+				const unsigned int* corners = &m_Indices[triangle * 3];
+				double normal[3];
+				Cross( Position( corners[0] ), Position( corners[1] ), Position( corners[2] ), normal );
+
+				const float* pa = Position( a );
+				const float* pb = Position( b );
+				double edge[3] = { pb[0] - pa[0], pb[1] - pa[1], pb[2] - pa[2] };
+				double plane[3] = { edge[1] * normal[2] - edge[2] * normal[1], edge[2] * normal[0] - edge[0] * normal[2], edge[0] * normal[1] - edge[1] * normal[0] };
+				double length = sqrt( plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2] );
+				if( length == 0.0 )
+					return;
+
+				plane[0] /= length;
+				plane[1] /= length;
+				plane[2] /= length;
+
+				double d = -( plane[0] * pa[0] + plane[1] * pa[1] + plane[2] * pa[2] );
+				double weight = m_Mesh.BoundaryWeight * ( edge[0] * edge[0] + edge[1] * edge[1] + edge[2] * edge[2] );
+				m_Quadrics[a].AddPlane( plane[0], plane[1], plane[2], d, weight );
+				m_Quadrics[b].AddPlane( plane[0], plane[1], plane[2], d, weight );
+			}
+
+			// Checks that collapsing one representative onto another keeps the mesh manifold and unfolded,
+			// filling the wedge map and returning the cost.
+			bool Evaluate( int from, int to, double& cost )
+			{
+				if( from == to || !m_Alive[from] || !m_Alive[to] || m_Kind[from] == VertexLocked )
+					return false;
+
+				const std::vector<int>& triangles = m_Triangles[from];
+				int shared = 0;
+				m_Map.clear();
+
+				for( size_t i = 0; i < triangles.size(); ++i )
+				{
+					int t = triangles[i];
+					if( !m_TriangleAlive[t] || CornerWithRep( t, to ) < 0 )
+						continue;
+
+					++shared;
+					unsigned int a = m_Indices[t * 3 + CornerWithRep( t, from )];
+					unsigned int b = m_Indices[t * 3 + CornerWithRep( t, to )];
+
+					bool mapped = false;
+					for( size_t m = 0; m < m_Map.size(); ++m )
+						mapped = mapped || m_Map[m].first == a;
+
+					if( !mapped )
+						m_Map.push_back( std::make_pair( a, b ) );
+				}
+
+				if( shared == 0 || shared > 2 || ( m_Kind[from] == VertexBorder && shared != 1 ) )
+					return false;
+
+				// link condition: the edge's end points may only share the neighbours of the triangles on the edge
+				if( ++m_MarkTime == 0 )
+				{
+					std::fill( m_Marks.begin(), m_Marks.end(), 0u );
+					m_MarkTime = 2;
+				}
+
+				unsigned int neighbourMark = m_MarkTime;
+				unsigned int commonMark = ++m_MarkTime;
+				for( size_t i = 0; i < triangles.size(); ++i )
+				{
+					int t = triangles[i];
+					if( !m_TriangleAlive[t] )
+						continue;
+
+					for( int k = 0; k < 3; ++k )
+						m_Marks[m_Rep[m_Indices[t * 3 + k]]] = neighbourMark;
+				}
+
+				int common = 0;
+				const std::vector<int>& targetTriangles = m_Triangles[to];
+				for( size_t i = 0; i < targetTriangles.size(); ++i )
+				{
+					int t = targetTriangles[i];
+					if( !m_TriangleAlive[t] )
+						continue;
+
+					for( int k = 0; k < 3; ++k )
+					{
+						int rep = m_Rep[m_Indices[t * 3 + k]];
+						if( rep != from && rep != to && m_Marks[rep] == neighbourMark )
+						{
+							m_Marks[rep] = commonMark;
+							++common;
+						}
+					}
+				}
+
+				if( common > shared )
+					return false;
+
+				const float* target = Position( to );
+				for( size_t i = 0; i < triangles.size(); ++i )
+				{
+					int t = triangles[i];
+					if( !m_TriangleAlive[t] || CornerWithRep( t, to ) >= 0 )
+						continue;
+
+					// every wedge must have a partner across the edge, or attributes would be torn apart
+					unsigned int a = m_Indices[t * 3 + CornerWithRep( t, from )];
+					bool mapped = false;
+					for( size_t m = 0; m < m_Map.size(); ++m )
+						mapped = mapped || m_Map[m].first == a;
+
+					if( !mapped )
+						return false;
+
+					const float* p[3];
+					for( int k = 0; k < 3; ++k )
+						p[k] = Position( m_Indices[t * 3 + k] );
+
+					double before[3];
+					Cross( p[0], p[1], p[2], before );
+					p[CornerWithRep( t, from )] = target;
+
+					double after[3];
+					Cross( p[0], p[1], p[2], after );
+
+					if( before[0] * after[0] + before[1] * after[1] + before[2] * after[2] <= 0.0 )
+						return false;
+				}
+
+				double area = m_Areas[from] > 0.0 ? m_Areas[from] : 1.0;
+				cost = m_Quadrics[from].Evaluate( target ) / area;
+
+				// position-only meshes have no attribute array to index
+				int attributeCount = m_Mesh.AttributeCount;
+				for( size_t m = 0; attributeCount > 0 && m < m_Map.size(); ++m )
+				{
+					const float* a = &m_Mesh.Attributes[m_Map[m].first * attributeCount];
+					const float* b = &m_Mesh.Attributes[m_Map[m].second * attributeCount];
+					for( int k = 0; k < attributeCount; ++k )
+						cost += ( a[k] - b[k] ) * ( a[k] - b[k] );
+				}
+
+				cost *= m_Weights[from];
+				return true;
+			}
+
+			void Push( int from, int to )
+			{
+				Collapse collapse;
+				if( !Evaluate( from, to, collapse.Cost ) )
+					return;
+
+				collapse.From = from;
+				collapse.To = to;
+				collapse.FromStamp = m_Stamps[from];
+				collapse.ToStamp = m_Stamps[to];
+				m_Heap.push( collapse );
+			}
+
+			void Release( unsigned int vertex )
+			{
+				if( --m_Uses[vertex] == 0 )
+					--m_LiveVertices;
+			}
+
+			void Apply( int from, int to, double cost )
+			{
+				std::vector<int>& triangles = m_Triangles[from];
+				std::vector<int>& targetTriangles = m_Triangles[to];
+
+				for( size_t i = 0; i < triangles.size(); ++i )
+				{
+					int t = triangles[i];
+					if( !m_TriangleAlive[t] )
+						continue;
+
+					if( CornerWithRep( t, to ) >= 0 )
+					{
+						m_TriangleAlive[t] = false;
+						--m_LiveTriangles;
+						for( int k = 0; k < 3; ++k )
+							Release( m_Indices[t * 3 + k] );
+						continue;
+					}
+
+					unsigned int& corner = m_Indices[t * 3 + CornerWithRep( t, from )];
+					for( size_t m = 0; m < m_Map.size(); ++m )
+					{
+						if( m_Map[m].first == corner )
+						{
+							Release( corner );
+							corner = m_Map[m].second;
+							if( m_Uses[corner]++ == 0 )
+								++m_LiveVertices;
+							break;
+						}
+					}
+
+					targetTriangles.push_back( t );
+				}
+
+				triangles.clear();
+				m_Alive[from] = false;
+				m_Quadrics[to].Add( m_Quadrics[from] );
+				m_Areas[to] += m_Areas[from];
+				m_Weights[to] = m_Weights[to] > m_Weights[from] ? m_Weights[to] : m_Weights[from];
+				++m_Stamps[to];
+				m_MaximumCost = cost > m_MaximumCost ? cost : m_MaximumCost;
+
+				size_t live = 0;
+				for( size_t i = 0; i < targetTriangles.size(); ++i )
+				{
+					if( m_TriangleAlive[targetTriangles[i]] )
+						targetTriangles[live++] = targetTriangles[i];
+				}
+				targetTriangles.resize( live );
+
+				// every collapse touching the merged vertex has a new cost
+				for( size_t i = 0; i < live; ++i )
+				{
+					int t = targetTriangles[i];
+					for( int k = 0; k < 3; ++k )
+					{
+						int rep = m_Rep[m_Indices[t * 3 + k]];
+						if( rep != to )
+						{
+							Push( to, rep );
+							Push( rep, to );
+						}
+					}
+				}
+			}
+
+		public:
+			Simplifier( const SimplifierMesh& mesh )
+				: m_Mesh( mesh ), m_Indices( mesh.Indices ), m_MarkTime( 0 ), m_MaximumCost( 0.0 )
+			{
+				int vertexCount = mesh.VertexCount;
+				int triangleCount = static_cast<int>( m_Indices.size() / 3 );
+
+				Weld();
+
+				m_Triangles.resize( vertexCount );
+				m_Quadrics.resize( vertexCount );
+				m_Areas.assign( vertexCount, 0.0 );
+				m_Weights.assign( vertexCount, 1.0f );
+				m_Kind.assign( vertexCount, VertexInterior );
+				m_Alive.assign( vertexCount, false );
+				m_Stamps.assign( vertexCount, 0 );
+				m_Marks.assign( vertexCount, 0 );
+				m_Uses.assign( vertexCount, 0 );
+				m_TriangleAlive.assign( triangleCount, false );
+				m_LiveTriangles = 0;
+				m_LiveVertices = 0;
+
+				for( int v = 0; v < vertexCount; ++v )
+					m_Quadrics[v].Clear();
+
+				// a representative is as hard to remove as the heaviest of its wedges
+				if( !mesh.VertexWeights.empty() )
+				{
+					for( int v = 0; v < vertexCount; ++v )
+						m_Weights[v] = mesh.VertexWeights[v];
+
+					for( int v = 0; v < vertexCount; ++v )
+					{
+						int rep = m_Rep[v];
+						m_Weights[rep] = mesh.VertexWeights[v] > m_Weights[rep] ? mesh.VertexWeights[v] : m_Weights[rep];
+					}
+				}
+
+				for( int t = 0; t < triangleCount; ++t )
+				{
+					const unsigned int* corners = &m_Indices[t * 3];
+					int a = m_Rep[corners[0]];
+					int b = m_Rep[corners[1]];
+					int c = m_Rep[corners[2]];
+
+					// triangles that collapse to a line or a point are dropped up front
+					if( a == b || b == c || a == c )
+						continue;
+
+					m_TriangleAlive[t] = true;
+					++m_LiveTriangles;
+					for( int k = 0; k < 3; ++k )
+					{
+						int rep = m_Rep[corners[k]];
+						m_Triangles[rep].push_back( t );
+						m_Alive[rep] = true;
+						if( m_Uses[corners[k]]++ == 0 )
+							++m_LiveVertices;
+					}
+
+					double normal[3];
+					Cross( Position( corners[0] ), Position( corners[1] ), Position( corners[2] ), normal );
+					double length = sqrt( normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2] );
+					if( length == 0.0 )
+						continue;
+
+					// planes are weighted by area, so the quadric divided by the area is a mean squared distance
+					double area = length * 0.5;
+					const float* p = Position( corners[0] );
+					double d = -( normal[0] * p[0] + normal[1] * p[1] + normal[2] * p[2] ) / length;
+					for( int k = 0; k < 3; ++k )
+					{
+						int rep = m_Rep[corners[k]];
+						m_Quadrics[rep].AddPlane( normal[0] / length, normal[1] / length, normal[2] / length, d, area * m_Mesh.PositionWeight );
+						m_Areas[rep] += area / 3.0;
+					}
+				}
+
+				Classify();
+
+				for( int v = 0; v < vertexCount; ++v )
+				{
+					if( !m_Alive[v] )
+						continue;
+
+					const std::vector<int>& triangles = m_Triangles[v];
+					for( size_t i = 0; i < triangles.size(); ++i )
+					{
+						for( int k = 0; k < 3; ++k )
+						{
+							int rep = m_Rep[m_Indices[triangles[i] * 3 + k]];
+							if( rep != v )
+								Push( v, rep );
+						}
+					}
+				}
+			}
+
+			void Run( int target, bool vertexTarget )
+			{
+				while( !m_Heap.empty() && ( vertexTarget ? m_LiveVertices : m_LiveTriangles ) > target )
+				{
+					Collapse collapse = m_Heap.top();
+					m_Heap.pop();
+
+					if( !m_Alive[collapse.From] || !m_Alive[collapse.To] ||
+						m_Stamps[collapse.From] != collapse.FromStamp || m_Stamps[collapse.To] != collapse.ToStamp )
+						continue;
+
+					// neighbouring collapses may have folded the area around this one since it was queued
+					double cost;
+					if( !Evaluate( collapse.From, collapse.To, cost ) )
+						continue;
+
+					Apply( collapse.From, collapse.To, cost );
+				}
+			}
+
+			void Emit( std::vector<unsigned int>& indices ) const
+			{
+				indices.clear();
+				indices.reserve( m_LiveTriangles * 3 );
+
+				for( size_t t = 0; t < m_TriangleAlive.size(); ++t )
+				{
+					if( m_TriangleAlive[t] )
+						indices.insert( indices.end(), m_Indices.begin() + t * 3, m_Indices.begin() + t * 3 + 3 );
+				}
+			}
+
+			float Error() const
+			{
+				return static_cast<float>( sqrt( m_MaximumCost ) );
+			}
+		};
+	}
+
+	void SimplifyMesh( const SimplifierMesh& mesh, const int* targets, int targetCount, bool vertexTargets,
+		std::vector<std::vector<unsigned int> >& levels, std::vector<float>& errors )
+	{
+		levels.resize( targetCount );
+		errors.resize( targetCount );
+
+		Simplifier simplifier( mesh );
+		for( int i = 0; i < targetCount; ++i )
+		{
+			simplifier.Run( targets[i], vertexTargets );
+			simplifier.Emit( levels[i] );
+			errors[i] = simplifier.Error();
+		}
+	}
+}
+
+#pragma managed(pop)
@@ -0,0 +1,47 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+namespace SlimDX
+{
+	// A triangle list prepared for simplification; every index must be less than the vertex count.
+	struct SimplifierMesh
+	{
+		int VertexCount;
+		std::vector<float> Positions;			// three per vertex
+		int AttributeCount;
+		std::vector<float> Attributes;			// AttributeCount per vertex, already scaled by the square root of their weights
+		std::vector<float> VertexWeights;		// one per vertex, or empty for uniform weights
+		std::vector<unsigned int> Indices;
+		float PositionWeight;
+		float BoundaryWeight;
+	};
+
+	// Simplifies a mesh by quadric error metric half edge collapses, so every level indexes the original vertices.
+	// Targets are face counts, or vertex counts when vertexTargets is set, in decreasing order; each level continues from
+	// the one before it and stops early when no valid collapse remains. Errors receive the square root of the largest
+	// collapse cost reached by each level, in the units of the positions.
+	void SimplifyMesh( const SimplifierMesh& mesh, const int* targets, int targetCount, bool vertexTargets,
+		std::vector<std::vector<unsigned int> >& levels, std::vector<float>& errors );
+}
@@ -124,4 +124,36 @@ namespace SlimDX
 		/// <returns>A string containing the leak report.</returns>
 		static System::String^ ReportLeaks();
 	};
+
+	// Listens to ObjectTable::ObjectRemoved on behalf of T without keeping it alive, so an undisposed listener can
+	// still be collected. The first notification after the listener is gone drops the subscription.
+	template<typename T>
+	ref class WeakObjectRemovedSubscription sealed
+	{
+	private:
+		System::WeakReference^ m_Listener;
+		System::EventHandler<ObjectTableEventArgs^>^ m_Handler;
+
+		void OnObjectRemoved( System::Object^ sender, ObjectTableEventArgs^ e )
+		{
+			T^ listener = safe_cast<T^>( m_Listener->Target );
+			if( listener == nullptr )
+				Unsubscribe();
+			else
+				listener->OnObjectRemoved( sender, e );
+		}
+
+	public:
+		WeakObjectRemovedSubscription( T^ listener )
+		{
+			m_Listener = gcnew System::WeakReference( listener );
+			m_Handler = gcnew System::EventHandler<ObjectTableEventArgs^>( this, &WeakObjectRemovedSubscription::OnObjectRemoved );
+			ObjectTable::ObjectRemoved += m_Handler;
+		}
+
+		void Unsubscribe()
+		{
+			ObjectTable::ObjectRemoved -= m_Handler;
+		}
+	};
 }
\ No newline at end of file
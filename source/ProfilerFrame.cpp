@@ -0,0 +1,126 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "ProfilerFrame.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Globalization;
+
+namespace SlimDX
+{
+	ProfilerFrame::ProfilerFrame( Int64 frameNumber, ProfilerNode^ root, bool hasGpuTimings, bool isDisjoint )
+	: m_FrameNumber( frameNumber ), m_Root( root ), m_HasGpuTimings( hasGpuTimings ), m_IsDisjoint( isDisjoint )
+	{
+	}
+
+	void ProfilerFrame::WriteJson( TextWriter^ writer )
+	{
+		if( writer == nullptr )
+			throw gcnew ArgumentNullException( "writer" );
+
+		writer->Write( String::Format( CultureInfo::InvariantCulture, "{{\"frame\":{0},\"hasGpuTimings\":{1},\"disjoint\":{2},\"root\":",
+			m_FrameNumber, m_HasGpuTimings ? "true" : "false", m_IsDisjoint ? "true" : "false" ) );
+		m_Root->WriteJson( writer );
+		writer->Write( '}' );
+	}
+
+	void ProfilerFrame::WriteCsv( TextWriter^ writer )
+	{
+		if( writer == nullptr )
+			throw gcnew ArgumentNullException( "writer" );
+
+		writer->WriteLine( "Path,Depth,CpuStart,CpuTime,GpuStart,GpuTime" );
+		m_Root->WriteCsv( writer );
+	}
+
+	void ProfilerFrame::WriteJsonString( TextWriter^ writer, String^ value )
+	{
+		writer->Write( '"' );
+
+		for each( wchar_t c in value )
+		{
+			switch( c )
+			{
+			case '"':
+				writer->Write( "\\\"" );
+				break;
+			case '\\':
+				writer->Write( "\\\\" );
+				break;
+			case '\n':
+				writer->Write( "\\n" );
+				break;
+			case '\r':
+				writer->Write( "\\r" );
+				break;
+			case '\t':
+				writer->Write( "\\t" );
+				break;
+			default:
+				if( c < 0x20 )
+					writer->Write( String::Format( CultureInfo::InvariantCulture, "\\u{0:x4}", static_cast<int>( c ) ) );
+				else
+					writer->Write( c );
+				break;
+			}
+		}
+
+		writer->Write( '"' );
+	}
+
+	void ProfilerFrame::WriteJsonNumber( TextWriter^ writer, double value )
+	{
+		// JSON has no representation for NaN, which marks missing GPU times.
+		if( Double::IsNaN( value ) || Double::IsInfinity( value ) )
+			writer->Write( "null" );
+		else
+			writer->Write( value.ToString( "R", CultureInfo::InvariantCulture ) );
+	}
+
+	void ProfilerFrame::WriteCsvString( TextWriter^ writer, String^ value )
+	{
+		if( value->IndexOfAny( gcnew array<wchar_t> { ',', '"', '\r', '\n' } ) < 0 )
+		{
+			writer->Write( value );
+			return;
+		}
+
+		writer->Write( '"' );
+		writer->Write( value->Replace( "\"", "\"\"" ) );
+		writer->Write( '"' );
+	}
+
+	String^ ProfilerFrame::FormatCsvNumber( double value )
+	{
+		if( Double::IsNaN( value ) || Double::IsInfinity( value ) )
+			return String::Empty;
+
+		return value.ToString( "R", CultureInfo::InvariantCulture );
+	}
+
+	String^ ProfilerFrame::ToString()
+	{
+		return String::Format( CultureInfo::CurrentCulture, "Frame {0}: CPU {1:0.000} ms, GPU {2:0.000} ms", m_FrameNumber, m_Root->CpuTime, m_Root->GpuTime );
+	}
+}
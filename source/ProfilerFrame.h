@@ -0,0 +1,120 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "ProfilerNode.h"
+
+namespace SlimDX
+{
+#ifdef XMLDOCS
+	ref class FrameProfiler;
+#endif
+
+	/// <summary>
+	/// The scope tree of a single frame recorded by a <see cref="FrameProfiler"/>.
+	/// </summary>
+	public ref class ProfilerFrame sealed
+	{
+	private:
+		System::Int64 m_FrameNumber;
+		ProfilerNode^ m_Root;
+		bool m_HasGpuTimings;
+		bool m_IsDisjoint;
+
+	internal:
+		ProfilerFrame( System::Int64 frameNumber, ProfilerNode^ root, bool hasGpuTimings, bool isDisjoint );
+
+		static void WriteJsonString( System::IO::TextWriter^ writer, System::String^ value );
+		static void WriteJsonNumber( System::IO::TextWriter^ writer, double value );
+		static void WriteCsvString( System::IO::TextWriter^ writer, System::String^ value );
+		static System::String^ FormatCsvNumber( double value );
+
+	public:
+		/// <summary>
+		/// Gets the number of the frame, counting from zero.
+		/// </summary>
+		property System::Int64 FrameNumber
+		{
+			System::Int64 get() { return m_FrameNumber; }
+		}
+
+		/// <summary>
+		/// Gets the node that covers the whole frame; every scope of the frame is nested within it.
+		/// </summary>
+		property ProfilerNode^ Root
+		{
+			ProfilerNode^ get() { return m_Root; }
+		}
+
+		/// <summary>
+		/// Gets whether the GPU times of the frame's nodes are valid. They are not when the profiler has no
+		/// <see cref="IGpuTimestampSource"/>, when the GPU results were not ready in time, or when the frame <see cref="IsDisjoint">is disjoint</see>.
+		/// </summary>
+		property bool HasGpuTimings
+		{
+			bool get() { return m_HasGpuTimings; }
+		}
+
+		/// <summary>
+		/// Gets whether the GPU timestamp counter was discontinuous during the frame, which makes its GPU times unreliable.
+		/// </summary>
+		property bool IsDisjoint
+		{
+			bool get() { return m_IsDisjoint; }
+		}
+
+		/// <summary>
+		/// Writes the frame and its scope tree as a JSON object.
+		/// </summary>
+		/// <param name="writer">The writer that receives the JSON text.</param>
+		void WriteJson( System::IO::TextWriter^ writer );
+
+		/// <summary>
+		/// Writes the frame's scopes as comma separated values, one line per scope, preceded by a header line.
+		/// </summary>
+		/// <param name="writer">The writer that receives the CSV text.</param>
+		void WriteCsv( System::IO::TextWriter^ writer );
+
+		/// <summary>
+		/// Converts the value of the object to its equivalent string representation.
+		/// </summary>
+		/// <returns>The string representation of the value of this instance.</returns>
+		virtual System::String^ ToString() override;
+	};
+
+	/// <summary>
+	/// Provides data for the <see cref="FrameProfiler::FrameResolved"/> event.
+	/// </summary>
+	public ref class ProfilerFrameEventArgs : System::EventArgs
+	{
+	public:
+		/// <summary>
+		/// The frame whose timings have been resolved.
+		/// </summary>
+		property ProfilerFrame^ Frame;
+
+		ProfilerFrameEventArgs( ProfilerFrame^ frame )
+		{
+			Frame = frame;
+		}
+	};
+}
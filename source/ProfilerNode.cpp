@@ -0,0 +1,93 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "ProfilerFrame.h"
+#include "ProfilerNode.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Globalization;
+using namespace System::Collections::Generic;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+	ProfilerNode::ProfilerNode( String^ name, ProfilerNode^ parent, double cpuStart, double cpuTime, double gpuStart, double gpuTime )
+	: m_Name( name ), m_CpuStart( cpuStart ), m_CpuTime( cpuTime ), m_GpuStart( gpuStart ), m_GpuTime( gpuTime )
+	{
+		m_Children = gcnew List<ProfilerNode^>();
+		m_ReadOnlyChildren = gcnew ReadOnlyCollection<ProfilerNode^>( m_Children );
+
+		if( parent == nullptr )
+		{
+			m_Path = name;
+		}
+		else
+		{
+			m_Path = String::Concat( parent->m_Path, "/", name );
+			m_Depth = parent->m_Depth + 1;
+			parent->m_Children->Add( this );
+		}
+	}
+
+	void ProfilerNode::WriteJson( TextWriter^ writer )
+	{
+		writer->Write( "{\"name\":" );
+		ProfilerFrame::WriteJsonString( writer, m_Name );
+		writer->Write( ",\"cpuStart\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_CpuStart );
+		writer->Write( ",\"cpuTime\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_CpuTime );
+		writer->Write( ",\"gpuStart\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_GpuStart );
+		writer->Write( ",\"gpuTime\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_GpuTime );
+		writer->Write( ",\"children\":[" );
+
+		for( int i = 0; i < m_Children->Count; ++i )
+		{
+			if( i > 0 )
+				writer->Write( ',' );
+			m_Children[i]->WriteJson( writer );
+		}
+
+		writer->Write( "]}" );
+	}
+
+	void ProfilerNode::WriteCsv( TextWriter^ writer )
+	{
+		ProfilerFrame::WriteCsvString( writer, m_Path );
+		writer->Write( String::Format( CultureInfo::InvariantCulture, ",{0},{1},{2},{3},{4}",
+			m_Depth, ProfilerFrame::FormatCsvNumber( m_CpuStart ), ProfilerFrame::FormatCsvNumber( m_CpuTime ),
+			ProfilerFrame::FormatCsvNumber( m_GpuStart ), ProfilerFrame::FormatCsvNumber( m_GpuTime ) ) );
+		writer->WriteLine();
+
+		for each( ProfilerNode^ child in m_Children )
+			child->WriteCsv( writer );
+	}
+
+	String^ ProfilerNode::ToString()
+	{
+		return String::Format( CultureInfo::CurrentCulture, "{0}: CPU {1:0.000} ms, GPU {2:0.000} ms", m_Path, m_CpuTime, m_GpuTime );
+	}
+}
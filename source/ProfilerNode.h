@@ -0,0 +1,123 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	/// <summary>
+	/// A single scope within a resolved <see cref="ProfilerFrame"/>.
+	/// </summary>
+	/// <remarks>
+	/// Times are in milliseconds and are measured from the start of the frame. GPU times are <see cref="System::Double::NaN"/>
+	/// when the frame has no usable GPU timings.
+	/// </remarks>
+	public ref class ProfilerNode sealed
+	{
+	private:
+		System::String^ m_Name;
+		System::String^ m_Path;
+		int m_Depth;
+		double m_CpuStart;
+		double m_CpuTime;
+		double m_GpuStart;
+		double m_GpuTime;
+		System::Collections::Generic::List<ProfilerNode^>^ m_Children;
+		System::Collections::ObjectModel::ReadOnlyCollection<ProfilerNode^>^ m_ReadOnlyChildren;
+
+	internal:
+		ProfilerNode( System::String^ name, ProfilerNode^ parent, double cpuStart, double cpuTime, double gpuStart, double gpuTime );
+
+		void WriteJson( System::IO::TextWriter^ writer );
+		void WriteCsv( System::IO::TextWriter^ writer );
+
+	public:
+		/// <summary>
+		/// Gets the name the scope was begun with.
+		/// </summary>
+		property System::String^ Name
+		{
+			System::String^ get() { return m_Name; }
+		}
+
+		/// <summary>
+		/// Gets the names of the scope and its parents, separated by slashes.
+		/// </summary>
+		property System::String^ Path
+		{
+			System::String^ get() { return m_Path; }
+		}
+
+		/// <summary>
+		/// Gets the nesting depth of the scope; the frame itself has a depth of zero.
+		/// </summary>
+		property int Depth
+		{
+			int get() { return m_Depth; }
+		}
+
+		/// <summary>
+		/// Gets the CPU time at which the scope began, in milliseconds.
+		/// </summary>
+		property double CpuStart
+		{
+			double get() { return m_CpuStart; }
+		}
+
+		/// <summary>
+		/// Gets the CPU time spent in the scope, in milliseconds.
+		/// </summary>
+		property double CpuTime
+		{
+			double get() { return m_CpuTime; }
+		}
+
+		/// <summary>
+		/// Gets the GPU time at which the scope began, in milliseconds.
+		/// </summary>
+		property double GpuStart
+		{
+			double get() { return m_GpuStart; }
+		}
+
+		/// <summary>
+		/// Gets the GPU time spent in the scope, in milliseconds.
+		/// </summary>
+		property double GpuTime
+		{
+			double get() { return m_GpuTime; }
+		}
+
+		/// <summary>
+		/// Gets the scopes nested directly within this scope, in the order they began.
+		/// </summary>
+		property System::Collections::ObjectModel::ReadOnlyCollection<ProfilerNode^>^ Children
+		{
+			System::Collections::ObjectModel::ReadOnlyCollection<ProfilerNode^>^ get() { return m_ReadOnlyChildren; }
+		}
+
+		/// <summary>
+		/// Converts the value of the object to its equivalent string representation.
+		/// </summary>
+		/// <returns>The string representation of the value of this instance.</returns>
+		virtual System::String^ ToString() override;
+	};
+}
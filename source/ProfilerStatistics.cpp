@@ -0,0 +1,116 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "ProfilerFrame.h"
+#include "ProfilerStatistics.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Globalization;
+
+namespace SlimDX
+{
+	ProfilerStatistics::ProfilerStatistics( String^ path, array<double>^ cpuTimes, array<double>^ gpuTimes, int count )
+	: m_Path( path ), m_SampleCount( count )
+	{
+		m_CpuMinimum = Double::MaxValue;
+		m_CpuMaximum = Double::MinValue;
+		m_GpuMinimum = Double::MaxValue;
+		m_GpuMaximum = Double::MinValue;
+
+		double cpuTotal = 0.0;
+		double gpuTotal = 0.0;
+
+		for( int i = 0; i < count; ++i )
+		{
+			double cpu = cpuTimes[i];
+			cpuTotal += cpu;
+			m_CpuMinimum = Math::Min( m_CpuMinimum, cpu );
+			m_CpuMaximum = Math::Max( m_CpuMaximum, cpu );
+
+			double gpu = gpuTimes[i];
+			if( Double::IsNaN( gpu ) )
+				continue;
+
+			++m_GpuSampleCount;
+			gpuTotal += gpu;
+			m_GpuMinimum = Math::Min( m_GpuMinimum, gpu );
+			m_GpuMaximum = Math::Max( m_GpuMaximum, gpu );
+		}
+
+		if( count > 0 )
+		{
+			m_CpuAverage = cpuTotal / count;
+		}
+		else
+		{
+			m_CpuAverage = Double::NaN;
+			m_CpuMinimum = Double::NaN;
+			m_CpuMaximum = Double::NaN;
+		}
+
+		if( m_GpuSampleCount > 0 )
+		{
+			m_GpuAverage = gpuTotal / m_GpuSampleCount;
+		}
+		else
+		{
+			m_GpuAverage = Double::NaN;
+			m_GpuMinimum = Double::NaN;
+			m_GpuMaximum = Double::NaN;
+		}
+	}
+
+	void ProfilerStatistics::WriteJson( TextWriter^ writer )
+	{
+		writer->Write( "{\"path\":" );
+		ProfilerFrame::WriteJsonString( writer, m_Path );
+		writer->Write( String::Format( CultureInfo::InvariantCulture, ",\"samples\":{0},\"cpuAverage\":", m_SampleCount ) );
+		ProfilerFrame::WriteJsonNumber( writer, m_CpuAverage );
+		writer->Write( ",\"cpuMinimum\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_CpuMinimum );
+		writer->Write( ",\"cpuMaximum\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_CpuMaximum );
+		writer->Write( String::Format( CultureInfo::InvariantCulture, ",\"gpuSamples\":{0},\"gpuAverage\":", m_GpuSampleCount ) );
+		ProfilerFrame::WriteJsonNumber( writer, m_GpuAverage );
+		writer->Write( ",\"gpuMinimum\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_GpuMinimum );
+		writer->Write( ",\"gpuMaximum\":" );
+		ProfilerFrame::WriteJsonNumber( writer, m_GpuMaximum );
+		writer->Write( '}' );
+	}
+
+	void ProfilerStatistics::WriteCsv( TextWriter^ writer )
+	{
+		ProfilerFrame::WriteCsvString( writer, m_Path );
+		writer->Write( String::Format( CultureInfo::InvariantCulture, ",{0},{1},{2},{3},{4},{5},{6},{7}", m_SampleCount,
+			ProfilerFrame::FormatCsvNumber( m_CpuAverage ), ProfilerFrame::FormatCsvNumber( m_CpuMinimum ), ProfilerFrame::FormatCsvNumber( m_CpuMaximum ),
+			m_GpuSampleCount, ProfilerFrame::FormatCsvNumber( m_GpuAverage ), ProfilerFrame::FormatCsvNumber( m_GpuMinimum ), ProfilerFrame::FormatCsvNumber( m_GpuMaximum ) ) );
+		writer->WriteLine();
+	}
+
+	String^ ProfilerStatistics::ToString()
+	{
+		return String::Format( CultureInfo::CurrentCulture, "{0}: CPU {1:0.000} ms, GPU {2:0.000} ms over {3} frames", m_Path, m_CpuAverage, m_GpuAverage, m_SampleCount );
+	}
+}
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	/// <summary>
+	/// Rolling timing statistics for one scope path of a <see cref="FrameProfiler"/>.
+	/// </summary>
+	/// <remarks>
+	/// Times are in milliseconds and cover the most recent <see cref="FrameProfiler::HistoryLength"/> frames in which the scope
+	/// appeared. GPU values are <see cref="System::Double::NaN"/> when none of those frames had usable GPU timings.
+	/// </remarks>
+	public ref class ProfilerStatistics sealed
+	{
+	private:
+		System::String^ m_Path;
+		int m_SampleCount;
+		double m_CpuAverage;
+		double m_CpuMinimum;
+		double m_CpuMaximum;
+		int m_GpuSampleCount;
+		double m_GpuAverage;
+		double m_GpuMinimum;
+		double m_GpuMaximum;
+
+	internal:
+		ProfilerStatistics( System::String^ path, array<double>^ cpuTimes, array<double>^ gpuTimes, int count );
+
+		void WriteJson( System::IO::TextWriter^ writer );
+		void WriteCsv( System::IO::TextWriter^ writer );
+
+	public:
+		/// <summary>
+		/// Gets the path of the scope, as reported by <see cref="ProfilerNode::Path"/>.
+		/// </summary>
+		property System::String^ Path
+		{
+			System::String^ get() { return m_Path; }
+		}
+
+		/// <summary>
+		/// Gets the number of frames the CPU statistics were gathered from.
+		/// </summary>
+		property int SampleCount
+		{
+			int get() { return m_SampleCount; }
+		}
+
+		/// <summary>
+		/// Gets the average CPU time of the scope, in milliseconds.
+		/// </summary>
+		property double CpuAverage
+		{
+			double get() { return m_CpuAverage; }
+		}
+
+		/// <summary>
+		/// Gets the smallest CPU time of the scope, in milliseconds.
+		/// </summary>
+		property double CpuMinimum
+		{
+			double get() { return m_CpuMinimum; }
+		}
+
+		/// <summary>
+		/// Gets the largest CPU time of the scope, in milliseconds.
+		/// </summary>
+		property double CpuMaximum
+		{
+			double get() { return m_CpuMaximum; }
+		}
+
+		/// <summary>
+		/// Gets the number of frames the GPU statistics were gathered from.
+		/// </summary>
+		property int GpuSampleCount
+		{
+			int get() { return m_GpuSampleCount; }
+		}
+
+		/// <summary>
+		/// Gets the average GPU time of the scope, in milliseconds.
+		/// </summary>
+		property double GpuAverage
+		{
+			double get() { return m_GpuAverage; }
+		}
+
+		/// <summary>
+		/// Gets the smallest GPU time of the scope, in milliseconds.
+		/// </summary>
+		property double GpuMinimum
+		{
+			double get() { return m_GpuMinimum; }
+		}
+
+		/// <summary>
+		/// Gets the largest GPU time of the scope, in milliseconds.
+		/// </summary>
+		property double GpuMaximum
+		{
+			double get() { return m_GpuMaximum; }
+		}
+
+		/// <summary>
+		/// Converts the value of the object to its equivalent string representation.
+		/// </summary>
+		/// <returns>The string representation of the value of this instance.</returns>
+		virtual System::String^ ToString() override;
+	};
+}
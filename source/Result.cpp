@@ -24,6 +24,7 @@
 #include <windows.h>
 #include <dxerr.h>
 
+#include "CallInstrumentation.h"
 #include "Configuration.h"
 #include "Result.h"
 #include "SlimDXException.h"
@@ -122,9 +123,15 @@ namespace SlimDX
 	generic< typename T >
 	Result Result::Record( int hr, bool failed, Object^ dataKey, Object^ dataValue )
 	{
-		m_LastCode = hr;
 		if(!failed)
+		{
+			// Successes never touch thread-static storage unless asked to; callers that need
+			// the code use the returned value, and Result.Last only reports failures. Failure
+			// codes the caller expects (such as lost input) are still stored, just not thrown.
+			if( hr < 0 || Configuration::AlwaysRecordLastResult )
+				m_Last = Result( hr );
 			return Result( hr );
+		}
 
 		m_Last = Result( hr );
 		if( dataKey != nullptr )
@@ -163,13 +170,19 @@ namespace SlimDX
 	{
 		return Record<T>( hr, hr < 0, dataKey, dataValue );
 	}
+
+	generic< typename T >
+	Result Result::Record( int hr, Object^ dataKey, Object^ dataValue, const char* function, int line )
+	{
+		// only reached through RECORD_RESULT once it has seen that instrumentation is enabled
+		CallInstrumentation::End( hr, function, line );
+
+		return Record<T>( hr, hr < 0, dataKey, dataValue );
+	}
 	
 	Result Result::Last::get()
 	{
-		if( SUCCEEDED(m_LastCode) )
-			return Result( m_LastCode );
-		else
-			return m_Last;
+		return m_Last;
 	}
 	
 	bool Result::operator == ( Result left, Result right )
@@ -21,6 +21,18 @@
 */
 #pragma once
 
+#include "CallInstrumentation.h"
+
+// Records the HRESULT produced by x. While call instrumentation is enabled the call is also attributed to the
+// enclosing function; otherwise the only added cost is the flag test.
+#define RECORD_RESULT(T, x) ( SlimDX::CallInstrumentation::Enabled ? \
+	( SlimDX::CallInstrumentation::Begin( #x ), SlimDX::Result::Record<T>( (x), (nullptr), (nullptr), __FUNCTION__, __LINE__ ) ) : \
+	SlimDX::Result::Record<T>( (x), (nullptr), (nullptr) ) )
+
+// Wraps an API call whose result is stored in a local variable and recorded later, so that the call is timed
+// by call instrumentation rather than the code between it and the recording macro.
+#define TIME_CALL(x) ( SlimDX::CallInstrumentation::Enabled ? SlimDX::CallInstrumentation::Begin() : (void) 0, (x) )
+
 namespace SlimDX
 {
 	public ref class ResultInfo
@@ -42,9 +54,6 @@ namespace SlimDX
 	
 		[System::ThreadStatic]
 		static Result m_Last;
-	
-		[System::ThreadStatic]
-		static int m_LastCode;
 
 		generic<typename T>
 		[System::Diagnostics::DebuggerNonUserCode]
@@ -68,6 +77,10 @@ namespace SlimDX
 		[System::Diagnostics::DebuggerNonUserCode]
 		static Result Record( int hr, bool failed, Object^ dataKey, Object^ dataValue );
 
+		generic<typename T>
+		[System::Diagnostics::DebuggerNonUserCode]
+		static Result Record( int hr, Object^ dataKey, Object^ dataValue, const char* function, int line );
+
 	public:
 		/// <summary>
 		/// Gets the actual HRESULT result code.
@@ -120,6 +133,8 @@ namespace SlimDX
 		/// <summary>
 		/// Gets the last recorded result of a method or operation.
 		/// </summary>
+		/// <remarks>Only failures are recorded unless <see cref="Configuration::AlwaysRecordLastResult"/> is set, so a
+		/// successful call leaves this value unchanged; use the <see cref="Result"/> returned by the call to observe success codes.</remarks>
 		static property Result Last
 		{
 			Result get();
@@ -25,7 +25,7 @@
 #include "InternalHelpers.h"
 #include "Result.h"
 
-#define RECORD_SDX(x) Result::Record<SlimDXException^>( (x), (nullptr), (nullptr) )
+#define RECORD_SDX(x) RECORD_RESULT( SlimDXException^, x )
 
 namespace SlimDX
 {
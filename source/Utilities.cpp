@@ -222,6 +222,11 @@ namespace SlimDX
 		case DXGI_FORMAT_X24_TYPELESS_G8_UINT:
 		case DXGI_FORMAT_B8G8R8A8_UNORM:
 		case DXGI_FORMAT_B8G8R8X8_UNORM:
+		case DXGI_FORMAT_R10G10B10_XR_BIAS_A2_UNORM:
+		case DXGI_FORMAT_B8G8R8A8_TYPELESS:
+		case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+		case DXGI_FORMAT_B8G8R8X8_TYPELESS:
+		case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
 			return 32;
 
 		case DXGI_FORMAT_R8G8_TYPELESS:
@@ -455,6 +460,23 @@ namespace SlimDX
 			return String::Empty;
 	}
 
+	// Returns the existing string when it already holds the same characters, avoiding an allocation
+	// for values such as locale names that rarely change between callbacks.
+	String^ Utilities::ReuseString( String^ existing, const wchar_t *value )
+	{
+		if( value == NULL )
+			return String::Empty;
+
+		if( existing != nullptr )
+		{
+			pin_ptr<const wchar_t> pinnedExisting = PtrToStringChars( existing );
+			if( wcscmp( pinnedExisting, value ) == 0 )
+				return existing;
+		}
+
+		return gcnew String( value );
+	}
+
 	void Utilities::FreeNativeString( LPCSTR string )
 	{
 		if( string == NULL )
@@ -62,6 +62,7 @@ namespace SlimDX
 
 		static System::String^ BlobToString( ID3D10Blob *blob );
 		static System::String^ BufferToString( ID3DXBuffer *buffer );
+		static System::String^ ReuseString( System::String^ existing, const wchar_t *value );
 
 		static array<System::Byte>^ ReadStream( System::IO::Stream^ stream, DataStream^* dataStream );
 		static array<System::Byte>^ ReadStream( System::IO::Stream^ stream, int% readLength, DataStream^* dataStream );
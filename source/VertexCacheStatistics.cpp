@@ -0,0 +1,75 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "VertexCacheStatistics.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+	VertexCacheStatistics::VertexCacheStatistics( int triangleCount, int vertexCount, int verticesTransformed, int cacheSize )
+	{
+		m_TriangleCount = triangleCount;
+		m_VertexCount = vertexCount;
+		m_VerticesTransformed = verticesTransformed;
+		m_CacheSize = cacheSize;
+	}
+
+	bool VertexCacheStatistics::operator == ( VertexCacheStatistics left, VertexCacheStatistics right )
+	{
+		return VertexCacheStatistics::Equals( left, right );
+	}
+
+	bool VertexCacheStatistics::operator != ( VertexCacheStatistics left, VertexCacheStatistics right )
+	{
+		return !VertexCacheStatistics::Equals( left, right );
+	}
+
+	int VertexCacheStatistics::GetHashCode()
+	{
+		return m_TriangleCount.GetHashCode() + m_VertexCount.GetHashCode() + m_VerticesTransformed.GetHashCode()
+			 + m_CacheSize.GetHashCode();
+	}
+
+	bool VertexCacheStatistics::Equals( Object^ value )
+	{
+		if( value == nullptr )
+			return false;
+
+		if( value->GetType() != GetType() )
+			return false;
+
+		return Equals( safe_cast<VertexCacheStatistics>( value ) );
+	}
+
+	bool VertexCacheStatistics::Equals( VertexCacheStatistics value )
+	{
+		return ( m_TriangleCount == value.m_TriangleCount && m_VertexCount == value.m_VertexCount
+			 && m_VerticesTransformed == value.m_VerticesTransformed && m_CacheSize == value.m_CacheSize );
+	}
+
+	bool VertexCacheStatistics::Equals( VertexCacheStatistics% value1, VertexCacheStatistics% value2 )
+	{
+		return ( value1.m_TriangleCount == value2.m_TriangleCount && value1.m_VertexCount == value2.m_VertexCount
+			 && value1.m_VerticesTransformed == value2.m_VerticesTransformed && value1.m_CacheSize == value2.m_CacheSize );
+	}
+}
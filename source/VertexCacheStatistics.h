@@ -0,0 +1,100 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	/// <summary>
+	/// Describes how well an index buffer uses the post transform vertex cache, as measured by <see cref="MeshOptimizer"/>.
+	/// </summary>
+	/// <unmanaged>None</unmanaged>
+	public value class VertexCacheStatistics : System::IEquatable<VertexCacheStatistics>
+	{
+	private:
+		int m_TriangleCount;
+		int m_VertexCount;
+		int m_VerticesTransformed;
+		int m_CacheSize;
+
+	internal:
+		VertexCacheStatistics( int triangleCount, int vertexCount, int verticesTransformed, int cacheSize );
+
+	public:
+		/// <summary>
+		/// Gets the number of triangles analyzed.
+		/// </summary>
+		property int TriangleCount
+		{
+			int get() { return m_TriangleCount; }
+		}
+
+		/// <summary>
+		/// Gets the number of distinct vertices referenced by the triangles.
+		/// </summary>
+		property int VertexCount
+		{
+			int get() { return m_VertexCount; }
+		}
+
+		/// <summary>
+		/// Gets the number of times a vertex had to be transformed because it was not in the cache.
+		/// </summary>
+		property int VerticesTransformed
+		{
+			int get() { return m_VerticesTransformed; }
+		}
+
+		/// <summary>
+		/// Gets the number of entries in the simulated first-in first-out cache.
+		/// </summary>
+		property int CacheSize
+		{
+			int get() { return m_CacheSize; }
+		}
+
+		/// <summary>
+		/// Gets the average cache miss ratio (ACMR): vertices transformed per triangle. Lower is better; 0.5 is the
+		/// practical optimum for large regular meshes and 3 is the worst case.
+		/// </summary>
+		property float AverageCacheMissRatio
+		{
+			float get() { return m_TriangleCount > 0 ? static_cast<float>( m_VerticesTransformed ) / m_TriangleCount : 0.0f; }
+		}
+
+		/// <summary>
+		/// Gets the average transform to vertex ratio (ATVR): vertices transformed per distinct vertex. 1 is optimal,
+		/// and unlike the ACMR it does not depend on the topology of the mesh.
+		/// </summary>
+		property float AverageTransformToVertexRatio
+		{
+			float get() { return m_VertexCount > 0 ? static_cast<float>( m_VerticesTransformed ) / m_VertexCount : 0.0f; }
+		}
+
+		static bool operator == ( VertexCacheStatistics left, VertexCacheStatistics right );
+		static bool operator != ( VertexCacheStatistics left, VertexCacheStatistics right );
+
+		virtual int GetHashCode() override;
+		virtual bool Equals( System::Object^ obj ) override;
+		virtual bool Equals( VertexCacheStatistics other );
+		static bool Equals( VertexCacheStatistics% value1, VertexCacheStatistics% value2 );
+	};
+}
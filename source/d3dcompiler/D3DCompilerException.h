@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_D3DC(x) Result::Record<D3DCompilerException^>( (x), (nullptr), (nullptr) )
+#define RECORD_D3DC(x) RECORD_RESULT( D3DCompilerException^, x )
 
 namespace SlimDX
 {
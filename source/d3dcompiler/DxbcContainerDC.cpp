@@ -0,0 +1,341 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include <cstring>
+
+#include "DxbcContainerDC.h"
+
+namespace SlimDX
+{
+namespace D3DCompiler
+{
+	namespace
+	{
+		const size_t HeaderSize = 32;
+
+		// The container makes no alignment guarantees, so every read goes through memcpy.
+		bool ReadUInt32( const unsigned char* data, size_t size, size_t offset, unsigned int& value )
+		{
+			if( offset > size || size - offset < 4 )
+				return false;
+
+			memcpy( &value, data + offset, 4 );
+			return true;
+		}
+
+		bool ReadUInt16( const unsigned char* data, size_t size, size_t offset, unsigned int& value )
+		{
+			if( offset > size || size - offset < 2 )
+				return false;
+
+			unsigned short shortValue;
+			memcpy( &shortValue, data + offset, 2 );
+			value = shortValue;
+			return true;
+		}
+
+		// Strings are stored inline, so they are returned as pointers into the chunk once we know they are terminated.
+		bool ReadString( const unsigned char* data, size_t size, size_t offset, const char*& value )
+		{
+			if( offset >= size )
+				return false;
+
+			if( memchr( data + offset, 0, size - offset ) == NULL )
+				return false;
+
+			value = reinterpret_cast<const char*>( data + offset );
+			return true;
+		}
+
+		bool ReadType( const unsigned char* data, size_t size, size_t offset, DxbcType& type )
+		{
+			return ReadUInt16( data, size, offset, type.Class ) &&
+				ReadUInt16( data, size, offset + 2, type.Type ) &&
+				ReadUInt16( data, size, offset + 4, type.Rows ) &&
+				ReadUInt16( data, size, offset + 6, type.Columns ) &&
+				ReadUInt16( data, size, offset + 8, type.Elements ) &&
+				ReadUInt16( data, size, offset + 10, type.Members );
+		}
+	}
+
+	DxbcContainer::DxbcContainer()
+	: m_Data( NULL ), m_Size( 0 )
+	{
+	}
+
+	bool DxbcContainer::Parse( const void* data, size_t size )
+	{
+		m_Data = NULL;
+		m_Size = 0;
+		m_Chunks.clear();
+
+		const unsigned char* bytes = static_cast<const unsigned char*>( data );
+		if( bytes == NULL || size < HeaderSize )
+			return false;
+
+		unsigned int magic, version, totalSize, chunkCount;
+		if( !ReadUInt32( bytes, size, 0, magic ) || !ReadUInt32( bytes, size, 20, version ) ||
+			!ReadUInt32( bytes, size, 24, totalSize ) || !ReadUInt32( bytes, size, 28, chunkCount ) )
+			return false;
+
+		if( magic != MakeDxbcFourCC( 'D', 'X', 'B', 'C' ) || version != 1 || totalSize < HeaderSize || totalSize > size )
+			return false;
+
+		if( chunkCount > ( totalSize - HeaderSize ) / 4 )
+			return false;
+
+		m_Chunks.reserve( chunkCount );
+		for( unsigned int i = 0; i < chunkCount; ++i )
+		{
+			unsigned int offset;
+			DxbcChunk chunk;
+
+			if( !ReadUInt32( bytes, totalSize, HeaderSize + i * 4, offset ) ||
+				!ReadUInt32( bytes, totalSize, offset, chunk.FourCC ) || !ReadUInt32( bytes, totalSize, offset + 4, chunk.Size ) )
+				return false;
+
+			if( chunk.Size > totalSize - offset - 8 )
+				return false;
+
+			chunk.Data = bytes + offset + 8;
+			m_Chunks.push_back( chunk );
+		}
+
+		m_Data = bytes;
+		m_Size = totalSize;
+		return true;
+	}
+
+	const DxbcChunk* DxbcContainer::FindChunk( unsigned int fourCC ) const
+	{
+		for( size_t i = 0; i < m_Chunks.size(); ++i )
+		{
+			if( m_Chunks[i].FourCC == fourCC )
+				return &m_Chunks[i];
+		}
+
+		return NULL;
+	}
+
+	unsigned int DxbcContainer::ShaderVersion() const
+	{
+		const DxbcChunk* chunk = FindChunk( MakeDxbcFourCC( 'S', 'H', 'E', 'X' ) );
+		if( chunk == NULL )
+			chunk = FindChunk( MakeDxbcFourCC( 'S', 'H', 'D', 'R' ) );
+
+		unsigned int version = 0;
+		if( chunk != NULL )
+			ReadUInt32( chunk->Data, chunk->Size, 0, version );
+
+		return version;
+	}
+
+	bool DxbcContainer::ReadSignature( DxbcSignatureKind kind, std::vector<DxbcSignatureElement>& elements ) const
+	{
+		elements.clear();
+
+		// Each signature has up to three encodings: the original one, one with a stream index (SM5 geometry
+		// shader outputs) and one with both a stream index and a minimum precision (SM5.1).
+		const char* names[3][3] =
+		{
+			{ "ISGN", NULL, "ISG1" },
+			{ "OSGN", "OSG5", "OSG1" },
+			{ "PCSG", NULL, "PSG1" }
+		};
+
+		const DxbcChunk* chunk = NULL;
+		int encoding = 0;
+		for( ; encoding < 3 && chunk == NULL; ++encoding )
+		{
+			const char* name = names[kind][encoding];
+			if( name != NULL )
+				chunk = FindChunk( MakeDxbcFourCC( name[0], name[1], name[2], name[3] ) );
+		}
+
+		// a shader with no elements in a given signature may legitimately omit the chunk
+		if( chunk == NULL )
+			return true;
+
+		--encoding;
+		const size_t elementSize = encoding == 0 ? 24 : ( encoding == 1 ? 28 : 32 );
+		const unsigned char* data = chunk->Data;
+		const size_t size = chunk->Size;
+
+		unsigned int count, offset;
+		if( !ReadUInt32( data, size, 0, count ) || !ReadUInt32( data, size, 4, offset ) )
+			return false;
+
+		if( offset > size || count > ( size - offset ) / elementSize )
+			return false;
+
+		elements.resize( count );
+		for( unsigned int i = 0; i < count; ++i )
+		{
+			DxbcSignatureElement& element = elements[i];
+			size_t position = offset + i * elementSize;
+
+			element.Stream = 0;
+			element.MinPrecision = 0;
+			if( encoding > 0 )
+			{
+				if( !ReadUInt32( data, size, position, element.Stream ) )
+					return false;
+				position += 4;
+			}
+
+			unsigned int nameOffset, masks;
+			if( !ReadUInt32( data, size, position, nameOffset ) || !ReadUInt32( data, size, position + 4, element.SemanticIndex ) ||
+				!ReadUInt32( data, size, position + 8, element.SystemValueType ) || !ReadUInt32( data, size, position + 12, element.ComponentType ) ||
+				!ReadUInt32( data, size, position + 16, element.Register ) || !ReadUInt32( data, size, position + 20, masks ) )
+				return false;
+
+			element.Mask = static_cast<unsigned char>( masks & 0xff );
+			element.ReadWriteMask = static_cast<unsigned char>( ( masks >> 8 ) & 0xff );
+
+			if( encoding == 2 && !ReadUInt32( data, size, position + 24, element.MinPrecision ) )
+				return false;
+
+			if( !ReadString( data, size, nameOffset, element.SemanticName ) )
+				return false;
+		}
+
+		return true;
+	}
+
+	bool DxbcContainer::ReadResourceDefinitions( DxbcResourceDefinitions& definitions ) const
+	{
+		definitions.Creator = NULL;
+		definitions.Flags = 0;
+		definitions.TargetVersion = 0;
+		definitions.ConstantBuffers.clear();
+		definitions.Resources.clear();
+
+		const DxbcChunk* chunk = FindChunk( MakeDxbcFourCC( 'R', 'D', 'E', 'F' ) );
+		if( chunk == NULL )
+			return false;
+
+		const unsigned char* data = chunk->Data;
+		const size_t size = chunk->Size;
+
+		unsigned int bufferCount, bufferOffset, resourceCount, resourceOffset, creatorOffset;
+		if( !ReadUInt32( data, size, 0, bufferCount ) || !ReadUInt32( data, size, 4, bufferOffset ) ||
+			!ReadUInt32( data, size, 8, resourceCount ) || !ReadUInt32( data, size, 12, resourceOffset ) ||
+			!ReadUInt32( data, size, 16, definitions.TargetVersion ) || !ReadUInt32( data, size, 20, definitions.Flags ) ||
+			!ReadUInt32( data, size, 24, creatorOffset ) )
+			return false;
+
+		if( creatorOffset != 0 && !ReadString( data, size, creatorOffset, definitions.Creator ) )
+			return false;
+
+		// the target version is stored as minor, major and program type
+		const unsigned int minor = definitions.TargetVersion & 0xff;
+		const unsigned int major = ( definitions.TargetVersion >> 8 ) & 0xff;
+		const size_t variableSize = major >= 5 ? 40 : 24;
+		const size_t resourceSize = ( major > 5 || ( major == 5 && minor >= 1 ) ) ? 40 : 32;
+		const size_t bufferSize = 24;
+
+		if( resourceOffset > size || resourceCount > ( size - resourceOffset ) / resourceSize )
+			return false;
+		if( bufferOffset > size || bufferCount > ( size - bufferOffset ) / bufferSize )
+			return false;
+
+		definitions.Resources.resize( resourceCount );
+		for( unsigned int i = 0; i < resourceCount; ++i )
+		{
+			DxbcResourceBinding& resource = definitions.Resources[i];
+			const size_t position = resourceOffset + i * resourceSize;
+
+			unsigned int nameOffset;
+			if( !ReadUInt32( data, size, position, nameOffset ) || !ReadUInt32( data, size, position + 4, resource.Type ) ||
+				!ReadUInt32( data, size, position + 8, resource.ReturnType ) || !ReadUInt32( data, size, position + 12, resource.Dimension ) ||
+				!ReadUInt32( data, size, position + 16, resource.SampleCount ) || !ReadUInt32( data, size, position + 20, resource.BindPoint ) ||
+				!ReadUInt32( data, size, position + 24, resource.BindCount ) || !ReadUInt32( data, size, position + 28, resource.Flags ) )
+				return false;
+
+			resource.Space = 0;
+			if( resourceSize > 32 && !ReadUInt32( data, size, position + 32, resource.Space ) )
+				return false;
+
+			if( !ReadString( data, size, nameOffset, resource.Name ) )
+				return false;
+		}
+
+		definitions.ConstantBuffers.resize( bufferCount );
+		for( unsigned int i = 0; i < bufferCount; ++i )
+		{
+			DxbcConstantBuffer& buffer = definitions.ConstantBuffers[i];
+			const size_t position = bufferOffset + i * bufferSize;
+
+			unsigned int nameOffset, variableCount, variableOffset;
+			if( !ReadUInt32( data, size, position, nameOffset ) || !ReadUInt32( data, size, position + 4, variableCount ) ||
+				!ReadUInt32( data, size, position + 8, variableOffset ) || !ReadUInt32( data, size, position + 12, buffer.Size ) ||
+				!ReadUInt32( data, size, position + 16, buffer.Flags ) || !ReadUInt32( data, size, position + 20, buffer.Type ) )
+				return false;
+
+			if( !ReadString( data, size, nameOffset, buffer.Name ) )
+				return false;
+			if( variableOffset > size || variableCount > ( size - variableOffset ) / variableSize )
+				return false;
+
+			buffer.Variables.resize( variableCount );
+			for( unsigned int j = 0; j < variableCount; ++j )
+			{
+				DxbcVariable& variable = buffer.Variables[j];
+				const size_t variablePosition = variableOffset + j * variableSize;
+
+				unsigned int variableNameOffset, typeOffset, defaultOffset;
+				if( !ReadUInt32( data, size, variablePosition, variableNameOffset ) || !ReadUInt32( data, size, variablePosition + 4, variable.StartOffset ) ||
+					!ReadUInt32( data, size, variablePosition + 8, variable.Size ) || !ReadUInt32( data, size, variablePosition + 12, variable.Flags ) ||
+					!ReadUInt32( data, size, variablePosition + 16, typeOffset ) || !ReadUInt32( data, size, variablePosition + 20, defaultOffset ) )
+					return false;
+
+				if( !ReadString( data, size, variableNameOffset, variable.Name ) || !ReadType( data, size, typeOffset, variable.Type ) )
+					return false;
+
+				if( defaultOffset == 0 || defaultOffset > size || size - defaultOffset < variable.Size )
+					variable.DefaultValue = NULL;
+				else
+					variable.DefaultValue = data + defaultOffset;
+			}
+		}
+
+		return true;
+	}
+
+	bool DxbcContainer::ReadStatistics( DxbcStatistics& statistics ) const
+	{
+		statistics.Count = 0;
+
+		const DxbcChunk* chunk = FindChunk( MakeDxbcFourCC( 'S', 'T', 'A', 'T' ) );
+		if( chunk == NULL )
+			return false;
+
+		statistics.Count = chunk->Size / 4;
+		if( statistics.Count > DxbcStatistics::MaximumCount )
+			statistics.Count = DxbcStatistics::MaximumCount;
+
+		memcpy( statistics.Values, chunk->Data, statistics.Count * 4 );
+		return true;
+	}
+}
+}
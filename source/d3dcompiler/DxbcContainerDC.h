@@ -0,0 +1,202 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// The types in this file parse the DXBC container format used for compiled shader bytecode. They are plain
+// native code with no dependency on the D3DCompiler runtime or on Windows headers, so that bytecode can be
+// inspected on machines where D3DReflect is not available. All returned pointers refer directly into the
+// parsed buffer; nothing is copied, and the buffer must outlive the container.
+
+namespace SlimDX
+{
+	namespace D3DCompiler
+	{
+		inline unsigned int MakeDxbcFourCC( char a, char b, char c, char d )
+		{
+			return static_cast<unsigned char>( a ) | ( static_cast<unsigned char>( b ) << 8 ) |
+				( static_cast<unsigned char>( c ) << 16 ) | ( static_cast<unsigned int>( static_cast<unsigned char>( d ) ) << 24 );
+		}
+
+		enum DxbcSignatureKind
+		{
+			DxbcInputSignature,
+			DxbcOutputSignature,
+			DxbcPatchConstantSignature
+		};
+
+		struct DxbcChunk
+		{
+			unsigned int FourCC;
+			const unsigned char* Data;
+			unsigned int Size;
+		};
+
+		// Mirrors D3D11_SIGNATURE_PARAMETER_DESC.
+		struct DxbcSignatureElement
+		{
+			const char* SemanticName;
+			unsigned int SemanticIndex;
+			unsigned int Register;
+			unsigned int SystemValueType;
+			unsigned int ComponentType;
+			unsigned char Mask;
+			unsigned char ReadWriteMask;
+			unsigned int Stream;
+			unsigned int MinPrecision;
+		};
+
+		// Mirrors D3D11_SHADER_INPUT_BIND_DESC.
+		struct DxbcResourceBinding
+		{
+			const char* Name;
+			unsigned int Type;
+			unsigned int BindPoint;
+			unsigned int BindCount;
+			unsigned int Flags;
+			unsigned int ReturnType;
+			unsigned int Dimension;
+			unsigned int SampleCount;
+			unsigned int Space;
+		};
+
+		// Mirrors D3D11_SHADER_TYPE_DESC, without member information.
+		struct DxbcType
+		{
+			unsigned int Class;
+			unsigned int Type;
+			unsigned int Rows;
+			unsigned int Columns;
+			unsigned int Elements;
+			unsigned int Members;
+		};
+
+		// Mirrors D3D11_SHADER_VARIABLE_DESC.
+		struct DxbcVariable
+		{
+			const char* Name;
+			unsigned int StartOffset;
+			unsigned int Size;
+			unsigned int Flags;
+			const void* DefaultValue;
+			DxbcType Type;
+		};
+
+		// Mirrors D3D11_SHADER_BUFFER_DESC, along with the buffer's variables.
+		struct DxbcConstantBuffer
+		{
+			const char* Name;
+			unsigned int Type;
+			unsigned int Size;
+			unsigned int Flags;
+			std::vector<DxbcVariable> Variables;
+		};
+
+		struct DxbcResourceDefinitions
+		{
+			const char* Creator;
+			unsigned int Flags;
+			unsigned int TargetVersion;
+			std::vector<DxbcConstantBuffer> ConstantBuffers;
+			std::vector<DxbcResourceBinding> Resources;
+		};
+
+		// The raw values of the STAT chunk, along with the indices of the values whose meaning is known.
+		struct DxbcStatistics
+		{
+			enum Index
+			{
+				InstructionCount = 0,
+				TempRegisterCount = 1,
+				DefineCount = 2,
+				DeclarationCount = 3,
+				FloatInstructionCount = 4,
+				IntInstructionCount = 5,
+				UintInstructionCount = 6,
+				StaticFlowControlCount = 7,
+				DynamicFlowControlCount = 8,
+				MacroInstructionCount = 9,
+				TempArrayCount = 10,
+				ArrayInstructionCount = 11,
+				CutInstructionCount = 12,
+				EmitInstructionCount = 13,
+				TextureNormalInstructions = 14,
+				TextureLoadInstructions = 15,
+				TextureCompareInstructions = 16,
+				TextureBiasInstructions = 17,
+				TextureGradientInstructions = 18,
+				MoveInstructionCount = 19,
+				ConditionalMoveInstructionCount = 20,
+				ConversionInstructionCount = 21,
+				InputPrimitive = 23,
+				GeometryShaderOutputTopology = 24,
+				GeometryShaderMaxOutputVertexCount = 25,
+				GeometryShaderInstanceCount = 29,
+				ControlPoints = 30,
+				HullShaderOutputPrimitive = 31,
+				HullShaderPartitioning = 32,
+				TessellatorDomain = 33,
+				BarrierInstructions = 34,
+				InterlockedInstructions = 35,
+				TextureStoreInstructions = 36,
+
+				MaximumCount = 37
+			};
+
+			unsigned int Values[MaximumCount];
+			unsigned int Count;
+
+			unsigned int Get( Index index ) const { return static_cast<unsigned int>( index ) < Count ? Values[index] : 0; }
+		};
+
+		class DxbcContainer
+		{
+		private:
+			const unsigned char* m_Data;
+			size_t m_Size;
+			std::vector<DxbcChunk> m_Chunks;
+
+		public:
+			DxbcContainer();
+
+			// Validates the container header and chunk table. Returns false if the data is not a well formed container.
+			bool Parse( const void* data, size_t size );
+
+			const unsigned char* Data() const { return m_Data; }
+			size_t Size() const { return m_Size; }
+			const unsigned char* Checksum() const { return m_Data + 4; }
+
+			int ChunkCount() const { return static_cast<int>( m_Chunks.size() ); }
+			const DxbcChunk& GetChunk( int index ) const { return m_Chunks[index]; }
+			const DxbcChunk* FindChunk( unsigned int fourCC ) const;
+
+			// Returns the version token of the shader program (SHDR or SHEX chunk), or zero if there is none.
+			unsigned int ShaderVersion() const;
+
+			bool ReadSignature( DxbcSignatureKind kind, std::vector<DxbcSignatureElement>& elements ) const;
+			bool ReadResourceDefinitions( DxbcResourceDefinitions& definitions ) const;
+			bool ReadStatistics( DxbcStatistics& statistics ) const;
+		};
+	}
+}
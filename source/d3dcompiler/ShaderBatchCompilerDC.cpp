@@ -0,0 +1,321 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "ShaderBatchCompilerDC.h"
+
+using namespace System;
+using namespace System::Text;
+using namespace System::Threading;
+using namespace System::Diagnostics;
+using namespace System::Collections::Generic;
+using namespace System::Runtime::InteropServices;
+
+namespace SlimDX
+{
+namespace D3DCompiler
+{
+	// The preprocessed output of one unique source and macro set.
+	ref class PreprocessedSource
+	{
+	public:
+		String^ Text;
+		String^ Errors;
+		HRESULT Code;
+		TimeSpan Time;
+	};
+
+	// A unique compilation, shared by every job with identical preprocessed text, entry point, profile and flags.
+	ref class CompilationUnit
+	{
+	public:
+		array<Byte>^ Source;
+		array<Byte>^ EntryPoint;
+		array<Byte>^ Profile;
+		array<Byte>^ SourceName;
+		UINT CompileFlags;
+		UINT EffectCompileFlags;
+
+		ID3D10Blob *Blob;
+		String^ Errors;
+		HRESULT Code;
+		TimeSpan Time;
+		Exception^ Error;
+		bool Claimed;
+
+		void Compile()
+		{
+			ID3D10Blob *code = NULL;
+			ID3D10Blob *errors = NULL;
+
+			pin_ptr<Byte> pinnedSource = &Source[0];
+			pin_ptr<Byte> pinnedFunction = EntryPoint == nullptr ? nullptr : &EntryPoint[0];
+			pin_ptr<Byte> pinnedProfile = &Profile[0];
+			pin_ptr<Byte> pinnedName = SourceName == nullptr ? nullptr : &SourceName[0];
+
+			// macros and includes have already been resolved by the preprocessor
+			Stopwatch^ timer = Stopwatch::StartNew();
+			Code = D3DCompile( reinterpret_cast<LPCSTR>( pinnedSource ), Source->Length - 1, reinterpret_cast<LPCSTR>( pinnedName ), NULL, NULL,
+				reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ), CompileFlags, EffectCompileFlags, &code, &errors );
+			Time = timer->Elapsed;
+
+			Blob = code;
+			Errors = Utilities::BlobToString( errors );
+		}
+	};
+
+	// Pulls compilation units off a shared list until none remain.
+	ref class CompilationWorker
+	{
+		List<CompilationUnit^>^ m_Units;
+		int m_Next;
+
+	public:
+		CompilationWorker( List<CompilationUnit^>^ units )
+		: m_Units( units ), m_Next( -1 )
+		{
+		}
+
+		void Run()
+		{
+			for( int i = Interlocked::Increment( m_Next ); i < m_Units->Count; i = Interlocked::Increment( m_Next ) )
+			{
+				// an exception escaping a worker thread would end the process, so it is kept with the unit that threw it
+				CompilationUnit^ unit = m_Units[i];
+				try
+				{
+					unit->Compile();
+				}
+				catch( Exception^ e )
+				{
+					if( unit->Blob != NULL )
+					{
+						unit->Blob->Release();
+						unit->Blob = NULL;
+					}
+
+					unit->Code = E_FAIL;
+					unit->Errors = e->Message;
+					unit->Error = e;
+				}
+			}
+		}
+	};
+
+	static array<Byte>^ ToNullTerminatedBytes( String^ value )
+	{
+		if( value == nullptr )
+			return nullptr;
+
+		array<Byte>^ bytes = gcnew array<Byte>( value->Length + 1 );
+		Encoding::ASCII->GetBytes( value, 0, value->Length, bytes, 0 );
+		return bytes;
+	}
+
+	static PreprocessedSource^ PreprocessJob( ShaderCompilationJob^ job, Include^ include )
+	{
+		PreprocessedSource^ result = gcnew PreprocessedSource();
+
+		array<Byte>^ source = Encoding::ASCII->GetBytes( job->ShaderSource );
+		pin_ptr<Byte> pinnedSource = &source[0];
+		array<Byte>^ sourceNameBytes = ToNullTerminatedBytes( job->SourceName );
+		pin_ptr<Byte> pinnedName = sourceNameBytes == nullptr ? nullptr : &sourceNameBytes[0];
+
+		IncludeShim includeShim = IncludeShim( include );
+		ID3D10Include* includePtr = NULL;
+		if( include != nullptr )
+			includePtr = &includeShim;
+
+		ID3D10Blob *code = NULL;
+		ID3D10Blob *errors = NULL;
+
+		array<GCHandle>^ handles;
+		stack_array<D3D10_SHADER_MACRO> macros = ShaderMacro::Marshal( job->Defines, handles );
+
+		// the include handler runs user code, so the pinned macro strings must be freed even if it throws
+		try
+		{
+			D3D10_SHADER_MACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
+
+			Stopwatch^ timer = Stopwatch::StartNew();
+			result->Code = D3DPreprocess( reinterpret_cast<LPCSTR>( pinnedSource ), source->Length, reinterpret_cast<LPCSTR>( pinnedName ), macrosPtr, includePtr, &code, &errors );
+			result->Time = timer->Elapsed;
+		}
+		finally
+		{
+			ShaderMacro::Unmarshal( handles );
+		}
+
+		String^ text = Utilities::BlobToString( code );
+		result->Errors = Utilities::BlobToString( errors );
+		result->Text = FAILED( result->Code ) ? nullptr : text;
+		return result;
+	}
+
+	static String^ GetSourceKey( ShaderCompilationJob^ job )
+	{
+		StringBuilder^ key = gcnew StringBuilder();
+
+		if( job->Defines != nullptr )
+		{
+			for each( ShaderMacro macro in job->Defines )
+				key->Append( macro.Name )->Append( '=' )->Append( macro.Value )->Append( '\n' );
+		}
+
+		return key->Append( job->SourceName )->Append( '\0' )->Append( job->ShaderSource )->ToString();
+	}
+
+	static String^ GetCompilationKey( ShaderCompilationJob^ job, String^ preprocessedText )
+	{
+		return String::Format( System::Globalization::CultureInfo::InvariantCulture, "{0}\n{1}\n{2}\n{3}\n{4}\n{5}",
+			job->EntryPoint, job->Profile, static_cast<UINT>( job->ShaderFlags ), static_cast<UINT>( job->EffectFlags ), job->SourceName, preprocessedText );
+	}
+
+	ShaderBatchCompiler::ShaderBatchCompiler()
+	{
+	}
+
+	array<ShaderCompilationResult^>^ ShaderBatchCompiler::Compile( array<ShaderCompilationJob^>^ jobs )
+	{
+		return Compile( jobs, nullptr, 0 );
+	}
+
+	array<ShaderCompilationResult^>^ ShaderBatchCompiler::Compile( array<ShaderCompilationJob^>^ jobs, Include^ include )
+	{
+		return Compile( jobs, include, 0 );
+	}
+
+	array<ShaderCompilationResult^>^ ShaderBatchCompiler::Compile( array<ShaderCompilationJob^>^ jobs, Include^ include, int workerCount )
+	{
+		if( jobs == nullptr )
+			throw gcnew ArgumentNullException( "jobs" );
+
+		for each( ShaderCompilationJob^ job in jobs )
+		{
+			if( job == nullptr )
+				throw gcnew ArgumentException( "The batch contains a null job.", "jobs" );
+			if( String::IsNullOrEmpty( job->ShaderSource ) )
+				throw gcnew ArgumentException( "Empty shader source provided.", "jobs" );
+			if( String::IsNullOrEmpty( job->Profile ) )
+				throw gcnew ArgumentException( "A job in the batch has no profile.", "jobs" );
+		}
+
+		array<ShaderCompilationResult^>^ results = gcnew array<ShaderCompilationResult^>( jobs->Length );
+		array<CompilationUnit^>^ jobUnits = gcnew array<CompilationUnit^>( jobs->Length );
+		array<String^>^ preprocessErrors = gcnew array<String^>( jobs->Length );
+
+		Dictionary<String^, PreprocessedSource^>^ sources = gcnew Dictionary<String^, PreprocessedSource^>();
+		Dictionary<String^, CompilationUnit^>^ unitTable = gcnew Dictionary<String^, CompilationUnit^>();
+		List<CompilationUnit^>^ units = gcnew List<CompilationUnit^>();
+
+		// preprocessing runs serially on this thread, since user include handlers are not required to be thread safe
+		for( int i = 0; i < jobs->Length; ++i )
+		{
+			ShaderCompilationJob^ job = jobs[i];
+			results[i] = gcnew ShaderCompilationResult( job );
+
+			PreprocessedSource^ source;
+			String^ sourceKey = GetSourceKey( job );
+			if( !sources->TryGetValue( sourceKey, source ) )
+			{
+				source = PreprocessJob( job, include );
+				sources->Add( sourceKey, source );
+				results[i]->PreprocessTime = source->Time;
+			}
+
+			preprocessErrors[i] = source->Errors;
+			if( source->Text == nullptr )
+			{
+				results[i]->ResultCode = Result( source->Code );
+				results[i]->CompilationErrors = source->Errors;
+				continue;
+			}
+
+			CompilationUnit^ unit;
+			String^ unitKey = GetCompilationKey( job, source->Text );
+			if( !unitTable->TryGetValue( unitKey, unit ) )
+			{
+				unit = gcnew CompilationUnit();
+				unit->Source = ToNullTerminatedBytes( source->Text );
+				unit->EntryPoint = ToNullTerminatedBytes( job->EntryPoint );
+				unit->Profile = ToNullTerminatedBytes( job->Profile );
+				unit->SourceName = ToNullTerminatedBytes( job->SourceName );
+				unit->CompileFlags = static_cast<UINT>( job->ShaderFlags );
+				unit->EffectCompileFlags = static_cast<UINT>( job->EffectFlags );
+
+				unitTable->Add( unitKey, unit );
+				units->Add( unit );
+			}
+
+			jobUnits[i] = unit;
+		}
+
+		if( workerCount < 1 )
+			workerCount = Environment::ProcessorCount;
+		workerCount = Math::Min( workerCount, units->Count );
+
+		CompilationWorker^ worker = gcnew CompilationWorker( units );
+		array<Thread^>^ threads = gcnew array<Thread^>( Math::Max( workerCount - 1, 0 ) );
+		for( int i = 0; i < threads->Length; ++i )
+		{
+			threads[i] = gcnew Thread( gcnew ThreadStart( worker, &CompilationWorker::Run ) );
+			threads[i]->IsBackground = true;
+			threads[i]->Start();
+		}
+
+		worker->Run();
+
+		for each( Thread^ thread in threads )
+			thread->Join();
+
+		for( int i = 0; i < jobs->Length; ++i )
+		{
+			CompilationUnit^ unit = jobUnits[i];
+			if( unit == nullptr )
+				continue;
+
+			ShaderCompilationResult^ result = results[i];
+			result->ResultCode = Result( unit->Code );
+			result->CompileTime = unit->Time;
+			result->CompilationErrors = String::Concat( preprocessErrors[i], unit->Errors );
+			result->Error = unit->Error;
+
+			if( unit->Blob == NULL )
+				continue;
+
+			if( !unit->Claimed )
+			{
+				// the first job to reference a unit takes ownership of the compiler's blob
+				result->Bytecode = ShaderBytecode::FromPointer( unit->Blob );
+				unit->Claimed = true;
+			}
+			else
+			{
+				result->Bytecode = gcnew ShaderBytecode( static_cast<const BYTE*>( unit->Blob->GetBufferPointer() ), static_cast<UINT>( unit->Blob->GetBufferSize() ) );
+				result->IsDuplicate = true;
+			}
+		}
+
+		return results;
+	}
+}
+}
@@ -0,0 +1,73 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "IncludeDC.h"
+#include "ShaderCompilationJobDC.h"
+#include "ShaderCompilationResultDC.h"
+
+namespace SlimDX
+{
+	namespace D3DCompiler
+	{
+		/// <summary>
+		/// Compiles large sets of shader permutations in parallel.
+		/// </summary>
+		/// <remarks>
+		/// Each distinct combination of source and macros is preprocessed once on the calling thread, which is also where
+		/// any <see cref="Include"/> callbacks are invoked. Jobs whose preprocessed output, entry point, profile and flags
+		/// are identical are compiled only once, and the remaining unique compilations are distributed across a pool of
+		/// worker threads. Compilation failures do not throw; they are reported through the returned
+		/// <see cref="ShaderCompilationResult"/> objects instead.
+		/// </remarks>
+		public ref class ShaderBatchCompiler sealed
+		{
+		private:
+			ShaderBatchCompiler();
+
+		public:
+			/// <summary>
+			/// Compiles a batch of shader permutations using one worker thread per processor.
+			/// </summary>
+			/// <param name="jobs">The permutations to compile.</param>
+			/// <returns>The results of the compilation, in the same order as <paramref name="jobs"/>.</returns>
+			static array<ShaderCompilationResult^>^ Compile( array<ShaderCompilationJob^>^ jobs );
+
+			/// <summary>
+			/// Compiles a batch of shader permutations using one worker thread per processor.
+			/// </summary>
+			/// <param name="jobs">The permutations to compile.</param>
+			/// <param name="include">An interface for handling include files.</param>
+			/// <returns>The results of the compilation, in the same order as <paramref name="jobs"/>.</returns>
+			static array<ShaderCompilationResult^>^ Compile( array<ShaderCompilationJob^>^ jobs, Include^ include );
+
+			/// <summary>
+			/// Compiles a batch of shader permutations.
+			/// </summary>
+			/// <param name="jobs">The permutations to compile.</param>
+			/// <param name="include">An interface for handling include files.</param>
+			/// <param name="workerCount">The maximum number of threads used for compilation, including the calling thread. Values less than one select one thread per processor.</param>
+			/// <returns>The results of the compilation, in the same order as <paramref name="jobs"/>.</returns>
+			static array<ShaderCompilationResult^>^ Compile( array<ShaderCompilationJob^>^ jobs, Include^ include, int workerCount );
+		};
+	}
+};
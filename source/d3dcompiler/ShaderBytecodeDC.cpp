@@ -41,7 +41,7 @@ namespace D3DCompiler
 	{
 		ID3D10Blob *blob;
 
-		HRESULT hr = D3D10CreateBlob( length, &blob );
+		HRESULT hr = TIME_CALL( D3D10CreateBlob( length, &blob ) );
 		if( RECORD_D3DC( hr ).IsFailure )
 			throw gcnew D3DCompilerException( Result::Last );
 
@@ -55,7 +55,7 @@ namespace D3DCompiler
 			throw gcnew ArgumentNullException( "data" );
 
 		ID3D10Blob *blob;
-		HRESULT hr = D3D10CreateBlob( static_cast<SIZE_T>(data->Length), &blob );
+		HRESULT hr = TIME_CALL( D3D10CreateBlob( static_cast<SIZE_T>(data->Length), &blob ) );
 		if( RECORD_D3DC( hr ).IsFailure )
 			throw gcnew D3DCompilerException( Result::Last );
 
@@ -191,8 +191,8 @@ namespace D3DCompiler
 		stack_array<D3D10_SHADER_MACRO> macros = ShaderMacro::Marshal( defines, handles );
 		D3D10_SHADER_MACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 		
-		HRESULT hr = D3DCompile( reinterpret_cast<LPCSTR>( pinnedSource ), shaderSource->Length, reinterpret_cast<LPCSTR>( pinnedName ), macrosPtr, includePtr,
-			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<UINT>( shaderFlags ), static_cast<UINT>( effectFlags ), &code, &errors );
+		HRESULT hr = TIME_CALL( D3DCompile( reinterpret_cast<LPCSTR>( pinnedSource ), shaderSource->Length, reinterpret_cast<LPCSTR>( pinnedName ), macrosPtr, includePtr,
+			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<UINT>( shaderFlags ), static_cast<UINT>( effectFlags ), &code, &errors ) );
 
 		ShaderMacro::Unmarshal( handles );
 
@@ -305,7 +305,7 @@ namespace D3DCompiler
 		stack_array<D3D10_SHADER_MACRO> macros = ShaderMacro::Marshal( defines, handles );
 		D3D10_SHADER_MACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 		
-		HRESULT hr = D3DPreprocess( reinterpret_cast<LPCSTR>( pinnedSource ), shaderSource->Length, NULL, macrosPtr, includePtr, &code, &errors );
+		HRESULT hr = TIME_CALL( D3DPreprocess( reinterpret_cast<LPCSTR>( pinnedSource ), shaderSource->Length, NULL, macrosPtr, includePtr, &code, &errors ) );
 		ShaderMacro::Unmarshal( handles );
 
 		compilationErrors = Utilities::BlobToString( errors );
@@ -356,7 +356,7 @@ namespace D3DCompiler
 		array<unsigned char>^ bytes = comments == nullptr ? nullptr : Encoding::ASCII->GetBytes(comments);
 		pin_ptr<unsigned char> pinnedBytes = bytes == nullptr ? nullptr : &bytes[0];
 
-		HRESULT hr = D3DDisassemble(InternalPointer->GetBufferPointer(), InternalPointer->GetBufferSize(), static_cast<UINT>(flags), reinterpret_cast<LPCSTR>(pinnedBytes), &output);
+		HRESULT hr = TIME_CALL( D3DDisassemble(InternalPointer->GetBufferPointer(), InternalPointer->GetBufferSize(), static_cast<UINT>(flags), reinterpret_cast<LPCSTR>(pinnedBytes), &output) );
 		if (RECORD_D3DC(hr).IsFailure)
 			return nullptr;
 
@@ -367,7 +367,7 @@ namespace D3DCompiler
 	{
 		ID3D10Blob *output = NULL;
 
-		HRESULT hr = D3DStripShader(InternalPointer->GetBufferPointer(), InternalPointer->GetBufferSize(), static_cast<UINT>(flags), &output);
+		HRESULT hr = TIME_CALL( D3DStripShader(InternalPointer->GetBufferPointer(), InternalPointer->GetBufferSize(), static_cast<UINT>(flags), &output) );
 		if (RECORD_D3DC(hr).IsFailure)
 			return nullptr;
 
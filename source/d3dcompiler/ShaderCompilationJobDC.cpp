@@ -0,0 +1,55 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "ShaderCompilationJobDC.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace D3DCompiler
+{
+	ShaderCompilationJob::ShaderCompilationJob()
+	{
+	}
+
+	ShaderCompilationJob::ShaderCompilationJob( String^ shaderSource, String^ entryPoint, String^ profile, array<ShaderMacro>^ defines )
+	{
+		ShaderSource = shaderSource;
+		EntryPoint = entryPoint;
+		Profile = profile;
+		Defines = defines;
+	}
+
+	ShaderCompilationJob::ShaderCompilationJob( String^ shaderSource, String^ entryPoint, String^ profile, D3DCompiler::ShaderFlags shaderFlags, D3DCompiler::EffectFlags effectFlags, array<ShaderMacro>^ defines, String^ sourceName )
+	{
+		ShaderSource = shaderSource;
+		EntryPoint = entryPoint;
+		Profile = profile;
+		ShaderFlags = shaderFlags;
+		EffectFlags = effectFlags;
+		Defines = defines;
+		SourceName = sourceName;
+	}
+}
+}
@@ -0,0 +1,99 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "EnumsDC.h"
+#include "ShaderMacroDC.h"
+
+namespace SlimDX
+{
+	namespace D3DCompiler
+	{
+		/// <summary>
+		/// Describes a single shader permutation to be compiled by the <see cref="ShaderBatchCompiler"/>.
+		/// </summary>
+		public ref class ShaderCompilationJob
+		{
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderCompilationJob"/> class.
+			/// </summary>
+			ShaderCompilationJob();
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderCompilationJob"/> class.
+			/// </summary>
+			/// <param name="shaderSource">A string containing the source of the shader or effect to compile.</param>
+			/// <param name="entryPoint">The name of the shader entry-point function, or <c>null</c> for an effect file.</param>
+			/// <param name="profile">The shader target or set of shader features to compile against.</param>
+			/// <param name="defines">A set of macros to define during compilation.</param>
+			ShaderCompilationJob( System::String^ shaderSource, System::String^ entryPoint, System::String^ profile, array<ShaderMacro>^ defines );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderCompilationJob"/> class.
+			/// </summary>
+			/// <param name="shaderSource">A string containing the source of the shader or effect to compile.</param>
+			/// <param name="entryPoint">The name of the shader entry-point function, or <c>null</c> for an effect file.</param>
+			/// <param name="profile">The shader target or set of shader features to compile against.</param>
+			/// <param name="shaderFlags">Shader compilation options.</param>
+			/// <param name="effectFlags">Effect compilation options.</param>
+			/// <param name="defines">A set of macros to define during compilation.</param>
+			/// <param name="sourceName">The name of the source being compiled. This is only used for error reporting purposes.</param>
+			ShaderCompilationJob( System::String^ shaderSource, System::String^ entryPoint, System::String^ profile, ShaderFlags shaderFlags, EffectFlags effectFlags, array<ShaderMacro>^ defines, System::String^ sourceName );
+
+			/// <summary>
+			/// Gets or sets the source of the shader or effect to compile.
+			/// </summary>
+			property System::String^ ShaderSource;
+
+			/// <summary>
+			/// Gets or sets the name of the shader entry-point function, or <c>null</c> for an effect file.
+			/// </summary>
+			property System::String^ EntryPoint;
+
+			/// <summary>
+			/// Gets or sets the shader target or set of shader features to compile against.
+			/// </summary>
+			property System::String^ Profile;
+
+			/// <summary>
+			/// Gets or sets the shader compilation options.
+			/// </summary>
+			property ShaderFlags ShaderFlags;
+
+			/// <summary>
+			/// Gets or sets the effect compilation options.
+			/// </summary>
+			property EffectFlags EffectFlags;
+
+			/// <summary>
+			/// Gets or sets the set of macros to define during compilation.
+			/// </summary>
+			property array<ShaderMacro>^ Defines;
+
+			/// <summary>
+			/// Gets or sets the name of the source being compiled. This is only used for error reporting purposes.
+			/// </summary>
+			property System::String^ SourceName;
+		};
+	}
+};
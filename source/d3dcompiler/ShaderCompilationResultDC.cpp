@@ -0,0 +1,118 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "ShaderCompilationJobDC.h"
+#include "ShaderCompilationResultDC.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace D3DCompiler
+{
+	ShaderCompilationResult::ShaderCompilationResult( ShaderCompilationJob^ job )
+	: m_Job( job ), m_Result( S_OK ), m_Errors( String::Empty )
+	{
+	}
+
+	ShaderCompilationJob^ ShaderCompilationResult::Job::get()
+	{
+		return m_Job;
+	}
+
+	ShaderBytecode^ ShaderCompilationResult::Bytecode::get()
+	{
+		return m_Bytecode;
+	}
+
+	void ShaderCompilationResult::Bytecode::set( ShaderBytecode^ value )
+	{
+		m_Bytecode = value;
+	}
+
+	Result ShaderCompilationResult::ResultCode::get()
+	{
+		return m_Result;
+	}
+
+	void ShaderCompilationResult::ResultCode::set( Result value )
+	{
+		m_Result = value;
+	}
+
+	String^ ShaderCompilationResult::CompilationErrors::get()
+	{
+		return m_Errors;
+	}
+
+	void ShaderCompilationResult::CompilationErrors::set( String^ value )
+	{
+		m_Errors = value;
+	}
+
+	TimeSpan ShaderCompilationResult::PreprocessTime::get()
+	{
+		return m_PreprocessTime;
+	}
+
+	void ShaderCompilationResult::PreprocessTime::set( TimeSpan value )
+	{
+		m_PreprocessTime = value;
+	}
+
+	TimeSpan ShaderCompilationResult::CompileTime::get()
+	{
+		return m_CompileTime;
+	}
+
+	void ShaderCompilationResult::CompileTime::set( TimeSpan value )
+	{
+		m_CompileTime = value;
+	}
+
+	Exception^ ShaderCompilationResult::Error::get()
+	{
+		return m_Error;
+	}
+
+	void ShaderCompilationResult::Error::set( Exception^ value )
+	{
+		m_Error = value;
+	}
+
+	bool ShaderCompilationResult::IsDuplicate::get()
+	{
+		return m_IsDuplicate;
+	}
+
+	void ShaderCompilationResult::IsDuplicate::set( bool value )
+	{
+		m_IsDuplicate = value;
+	}
+
+	bool ShaderCompilationResult::IsSuccess::get()
+	{
+		return m_Bytecode != nullptr;
+	}
+}
+}
@@ -0,0 +1,140 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "ShaderBytecodeDC.h"
+#include "ShaderCompilationJobDC.h"
+
+namespace SlimDX
+{
+	namespace D3DCompiler
+	{
+		/// <summary>
+		/// Contains the outcome of a single <see cref="ShaderCompilationJob"/> compiled by the <see cref="ShaderBatchCompiler"/>.
+		/// </summary>
+		public ref class ShaderCompilationResult
+		{
+		internal:
+			ShaderCompilationResult( ShaderCompilationJob^ job );
+
+		public:
+			/// <summary>
+			/// Gets the job that produced this result.
+			/// </summary>
+			property ShaderCompilationJob^ Job
+			{
+				ShaderCompilationJob^ get();
+			}
+
+			/// <summary>
+			/// Gets the compiled shader bytecode, or <c>null</c> if preprocessing or compilation failed.
+			/// </summary>
+			property ShaderBytecode^ Bytecode
+			{
+				ShaderBytecode^ get();
+			internal:
+				void set( ShaderBytecode^ value );
+			}
+
+			/// <summary>
+			/// Gets the result code returned by the compiler.
+			/// </summary>
+			property Result ResultCode
+			{
+				Result get();
+			internal:
+				void set( Result value );
+			}
+
+			/// <summary>
+			/// Gets a string of preprocessing and compilation errors and warnings, or an empty string if there were none.
+			/// </summary>
+			property System::String^ CompilationErrors
+			{
+				System::String^ get();
+			internal:
+				void set( System::String^ value );
+			}
+
+			/// <summary>
+			/// Gets the time spent preprocessing the job's source. Jobs that share a source and macro set with an earlier
+			/// job in the batch reuse its preprocessed output and report a zero preprocessing time.
+			/// </summary>
+			property System::TimeSpan PreprocessTime
+			{
+				System::TimeSpan get();
+			internal:
+				void set( System::TimeSpan value );
+			}
+
+			/// <summary>
+			/// Gets the time spent compiling the job's preprocessed source.
+			/// </summary>
+			property System::TimeSpan CompileTime
+			{
+				System::TimeSpan get();
+			internal:
+				void set( System::TimeSpan value );
+			}
+
+			/// <summary>
+			/// Gets the exception thrown while compiling the job on a worker thread, or <c>null</c> if none was thrown.
+			/// The batch carries on with its other jobs, and the job's result code is set to E_FAIL.
+			/// </summary>
+			property System::Exception^ Error
+			{
+				System::Exception^ get();
+			internal:
+				void set( System::Exception^ value );
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether the job's preprocessed output was identical to that of another job in the
+			/// batch, in which case its bytecode was copied from that job instead of being compiled again.
+			/// </summary>
+			property bool IsDuplicate
+			{
+				bool get();
+			internal:
+				void set( bool value );
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether the job produced bytecode.
+			/// </summary>
+			property bool IsSuccess
+			{
+				bool get();
+			}
+
+		private:
+			ShaderCompilationJob^ m_Job;
+			ShaderBytecode^ m_Bytecode;
+			Result m_Result;
+			System::String^ m_Errors;
+			System::TimeSpan m_PreprocessTime;
+			System::TimeSpan m_CompileTime;
+			System::Exception^ m_Error;
+			bool m_IsDuplicate;
+		};
+	}
+};
@@ -0,0 +1,460 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "D3DCompilerException.h"
+#include "ShaderContainerDC.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Text;
+
+namespace SlimDX
+{
+namespace D3DCompiler
+{
+	static void FillParameter( const DxbcSignatureElement& element, D3D11_SIGNATURE_PARAMETER_DESC& desc )
+	{
+		memset( &desc, 0, sizeof( desc ) );
+		desc.SemanticName = element.SemanticName;
+		desc.SemanticIndex = element.SemanticIndex;
+		desc.Register = element.Register;
+		desc.SystemValueType = static_cast<D3D_NAME>( element.SystemValueType );
+		desc.ComponentType = static_cast<D3D_REGISTER_COMPONENT_TYPE>( element.ComponentType );
+		desc.Mask = element.Mask;
+		desc.ReadWriteMask = element.ReadWriteMask;
+		desc.Stream = element.Stream;
+	}
+
+	// A read-only stream over the container's memory. It holds the container so that the source cannot be collected
+	// while the stream is still reachable.
+	ref class ShaderContainerView sealed : DataStream
+	{
+	private:
+		ShaderContainer^ m_Container;
+
+	public:
+		ShaderContainerView( ShaderContainer^ container, const void* data, Int64 size )
+			: DataStream( data, size, true, false ), m_Container( container )
+		{
+		}
+	};
+
+	static unsigned int ToFourCC( String^ name )
+	{
+		if( name == nullptr || name->Length != 4 )
+			throw gcnew ArgumentException( "Chunk names must be exactly four characters long.", "name" );
+
+		return MakeDxbcFourCC( static_cast<char>( name[0] ), static_cast<char>( name[1] ), static_cast<char>( name[2] ), static_cast<char>( name[3] ) );
+	}
+
+	ShaderContainer::ShaderContainer( DataStream^ data )
+	{
+		if( data == nullptr )
+			throw gcnew ArgumentNullException( "data" );
+
+		Construct( data->RawPointer, data->Length );
+		m_Source = data;
+	}
+
+	ShaderContainer::ShaderContainer( ShaderBytecode^ bytecode )
+	{
+		if( bytecode == nullptr )
+			throw gcnew ArgumentNullException( "bytecode" );
+
+		Construct( bytecode->InternalPointer->GetBufferPointer(), bytecode->InternalPointer->GetBufferSize() );
+		m_Source = bytecode;
+	}
+
+	ShaderContainer::~ShaderContainer()
+	{
+		// the views read from the source, so they cannot stay usable once it is released
+		if( m_Views != nullptr )
+		{
+			for each( WeakReference^ reference in m_Views )
+			{
+				DataStream^ view = safe_cast<DataStream^>( reference->Target );
+				if( view != nullptr )
+					delete view;
+			}
+
+			m_Views = nullptr;
+		}
+
+		Destruct();
+	}
+
+	ShaderContainer::!ShaderContainer()
+	{
+		Destruct();
+	}
+
+	void ShaderContainer::Construct( const void* data, Int64 size )
+	{
+		std::auto_ptr<ShaderContainerData> parsed( new ShaderContainerData() );
+
+		if( !parsed->Container.Parse( data, static_cast<size_t>( size ) ) ||
+			!parsed->Container.ReadSignature( DxbcInputSignature, parsed->Signatures[DxbcInputSignature] ) ||
+			!parsed->Container.ReadSignature( DxbcOutputSignature, parsed->Signatures[DxbcOutputSignature] ) ||
+			!parsed->Container.ReadSignature( DxbcPatchConstantSignature, parsed->Signatures[DxbcPatchConstantSignature] ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			throw gcnew D3DCompilerException( Result::Last );
+		}
+
+		// the resource definitions and statistics can be stripped from the bytecode
+		parsed->HasDefinitions = parsed->Container.ReadResourceDefinitions( parsed->Definitions );
+		parsed->HasStatistics = parsed->Container.ReadStatistics( parsed->Statistics );
+
+		m_Data = parsed.release();
+	}
+
+	void ShaderContainer::Destruct()
+	{
+		delete m_Data;
+		m_Data = NULL;
+		m_Source = nullptr;
+	}
+
+	void ShaderContainer::CheckDisposed()
+	{
+		if( m_Data == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	DataStream^ ShaderContainer::CreateView( const void* data, Int64 size )
+	{
+		if( m_Views == nullptr )
+			m_Views = gcnew List<WeakReference^>();
+
+		// drop views that have already been collected so that repeated calls do not grow the list
+		for( int i = m_Views->Count - 1; i >= 0; --i )
+		{
+			if( !m_Views[i]->IsAlive )
+				m_Views->RemoveAt( i );
+		}
+
+		DataStream^ view = gcnew ShaderContainerView( this, data, size );
+		m_Views->Add( gcnew WeakReference( view ) );
+		return view;
+	}
+
+	int ShaderContainer::ChunkCount::get()
+	{
+		CheckDisposed();
+		return m_Data->Container.ChunkCount();
+	}
+
+	array<Byte>^ ShaderContainer::Checksum::get()
+	{
+		CheckDisposed();
+		array<Byte>^ result = gcnew array<Byte>( 16 );
+		pin_ptr<Byte> pinnedResult = &result[0];
+		memcpy( pinnedResult, m_Data->Container.Checksum(), 16 );
+
+		return result;
+	}
+
+	ShaderDescription^ ShaderContainer::Description::get()
+	{
+		CheckDisposed();
+		if( m_Description != nullptr )
+			return m_Description;
+
+		D3D11_SHADER_DESC desc;
+		memset( &desc, 0, sizeof( desc ) );
+
+		desc.Version = m_Data->Container.ShaderVersion();
+		desc.InputParameters = static_cast<UINT>( m_Data->Signatures[DxbcInputSignature].size() );
+		desc.OutputParameters = static_cast<UINT>( m_Data->Signatures[DxbcOutputSignature].size() );
+		desc.PatchConstantParameters = static_cast<UINT>( m_Data->Signatures[DxbcPatchConstantSignature].size() );
+
+		if( m_Data->HasDefinitions )
+		{
+			desc.Creator = m_Data->Definitions.Creator;
+			desc.Flags = m_Data->Definitions.Flags;
+			desc.ConstantBuffers = static_cast<UINT>( m_Data->Definitions.ConstantBuffers.size() );
+			desc.BoundResources = static_cast<UINT>( m_Data->Definitions.Resources.size() );
+		}
+
+		if( m_Data->HasStatistics )
+		{
+			const DxbcStatistics& stats = m_Data->Statistics;
+
+			desc.InstructionCount = stats.Get( DxbcStatistics::InstructionCount );
+			desc.TempRegisterCount = stats.Get( DxbcStatistics::TempRegisterCount );
+			desc.TempArrayCount = stats.Get( DxbcStatistics::TempArrayCount );
+			desc.DefCount = stats.Get( DxbcStatistics::DefineCount );
+			desc.DclCount = stats.Get( DxbcStatistics::DeclarationCount );
+			desc.TextureNormalInstructions = stats.Get( DxbcStatistics::TextureNormalInstructions );
+			desc.TextureLoadInstructions = stats.Get( DxbcStatistics::TextureLoadInstructions );
+			desc.TextureCompInstructions = stats.Get( DxbcStatistics::TextureCompareInstructions );
+			desc.TextureBiasInstructions = stats.Get( DxbcStatistics::TextureBiasInstructions );
+			desc.TextureGradientInstructions = stats.Get( DxbcStatistics::TextureGradientInstructions );
+			desc.FloatInstructionCount = stats.Get( DxbcStatistics::FloatInstructionCount );
+			desc.IntInstructionCount = stats.Get( DxbcStatistics::IntInstructionCount );
+			desc.UintInstructionCount = stats.Get( DxbcStatistics::UintInstructionCount );
+			desc.StaticFlowControlCount = stats.Get( DxbcStatistics::StaticFlowControlCount );
+			desc.DynamicFlowControlCount = stats.Get( DxbcStatistics::DynamicFlowControlCount );
+			desc.MacroInstructionCount = stats.Get( DxbcStatistics::MacroInstructionCount );
+			desc.ArrayInstructionCount = stats.Get( DxbcStatistics::ArrayInstructionCount );
+			desc.CutInstructionCount = stats.Get( DxbcStatistics::CutInstructionCount );
+			desc.EmitInstructionCount = stats.Get( DxbcStatistics::EmitInstructionCount );
+			desc.GSOutputTopology = static_cast<D3D_PRIMITIVE_TOPOLOGY>( stats.Get( DxbcStatistics::GeometryShaderOutputTopology ) );
+			desc.GSMaxOutputVertexCount = stats.Get( DxbcStatistics::GeometryShaderMaxOutputVertexCount );
+			desc.InputPrimitive = static_cast<D3D_PRIMITIVE>( stats.Get( DxbcStatistics::InputPrimitive ) );
+			desc.cGSInstanceCount = stats.Get( DxbcStatistics::GeometryShaderInstanceCount );
+			desc.cControlPoints = stats.Get( DxbcStatistics::ControlPoints );
+			desc.HSOutputPrimitive = static_cast<D3D_TESSELLATOR_OUTPUT_PRIMITIVE>( stats.Get( DxbcStatistics::HullShaderOutputPrimitive ) );
+			desc.HSPartitioning = static_cast<D3D_TESSELLATOR_PARTITIONING>( stats.Get( DxbcStatistics::HullShaderPartitioning ) );
+			desc.TessellatorDomain = static_cast<D3D_TESSELLATOR_DOMAIN>( stats.Get( DxbcStatistics::TessellatorDomain ) );
+			desc.cBarrierInstructions = stats.Get( DxbcStatistics::BarrierInstructions );
+			desc.cInterlockedInstructions = stats.Get( DxbcStatistics::InterlockedInstructions );
+			desc.cTextureStoreInstructions = stats.Get( DxbcStatistics::TextureStoreInstructions );
+		}
+
+		m_Description = gcnew ShaderDescription( desc );
+		return m_Description;
+	}
+
+	ShaderSignature^ ShaderContainer::InputSignature::get()
+	{
+		CheckDisposed();
+		const DxbcContainer& container = m_Data->Container;
+		return gcnew ShaderSignature( CreateView( container.Data(), static_cast<Int64>( container.Size() ) ) );
+	}
+
+	String^ ShaderContainer::GetChunkName( int index )
+	{
+		CheckDisposed();
+		if( index < 0 || index >= m_Data->Container.ChunkCount() )
+			throw gcnew ArgumentOutOfRangeException( "index" );
+
+		unsigned int fourCC = m_Data->Container.GetChunk( index ).FourCC;
+		array<Byte>^ bytes = gcnew array<Byte>( 4 );
+		for( int i = 0; i < 4; ++i )
+			bytes[i] = static_cast<Byte>( fourCC >> ( i * 8 ) );
+
+		return Encoding::ASCII->GetString( bytes );
+	}
+
+	DataStream^ ShaderContainer::GetChunk( int index )
+	{
+		CheckDisposed();
+		if( index < 0 || index >= m_Data->Container.ChunkCount() )
+			throw gcnew ArgumentOutOfRangeException( "index" );
+
+		const DxbcChunk& chunk = m_Data->Container.GetChunk( index );
+		if( chunk.Size == 0 )
+			return nullptr;
+
+		return CreateView( chunk.Data, chunk.Size );
+	}
+
+	DataStream^ ShaderContainer::GetChunk( String^ name )
+	{
+		CheckDisposed();
+		const DxbcChunk* chunk = m_Data->Container.FindChunk( ToFourCC( name ) );
+		if( chunk == NULL || chunk->Size == 0 )
+			return nullptr;
+
+		return CreateView( chunk->Data, chunk->Size );
+	}
+
+	ShaderParameterDescription ShaderContainer::GetInputParameterDescription( int index )
+	{
+		CheckDisposed();
+		const std::vector<DxbcSignatureElement>& elements = m_Data->Signatures[DxbcInputSignature];
+		if( index < 0 || index >= static_cast<int>( elements.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return ShaderParameterDescription();
+		}
+
+		D3D11_SIGNATURE_PARAMETER_DESC desc;
+		FillParameter( elements[index], desc );
+		return ShaderParameterDescription( desc );
+	}
+
+	ShaderParameterDescription ShaderContainer::GetOutputParameterDescription( int index )
+	{
+		CheckDisposed();
+		const std::vector<DxbcSignatureElement>& elements = m_Data->Signatures[DxbcOutputSignature];
+		if( index < 0 || index >= static_cast<int>( elements.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return ShaderParameterDescription();
+		}
+
+		D3D11_SIGNATURE_PARAMETER_DESC desc;
+		FillParameter( elements[index], desc );
+		return ShaderParameterDescription( desc );
+	}
+
+	ShaderParameterDescription ShaderContainer::GetPatchConstantParameterDescription( int index )
+	{
+		CheckDisposed();
+		const std::vector<DxbcSignatureElement>& elements = m_Data->Signatures[DxbcPatchConstantSignature];
+		if( index < 0 || index >= static_cast<int>( elements.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return ShaderParameterDescription();
+		}
+
+		D3D11_SIGNATURE_PARAMETER_DESC desc;
+		FillParameter( elements[index], desc );
+		return ShaderParameterDescription( desc );
+	}
+
+	InputBindingDescription ShaderContainer::GetResourceBindingDescription( int index )
+	{
+		CheckDisposed();
+		const std::vector<DxbcResourceBinding>& resources = m_Data->Definitions.Resources;
+		if( index < 0 || index >= static_cast<int>( resources.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return InputBindingDescription();
+		}
+
+		const DxbcResourceBinding& resource = resources[index];
+
+		D3D11_SHADER_INPUT_BIND_DESC desc;
+		memset( &desc, 0, sizeof( desc ) );
+		desc.Name = resource.Name;
+		desc.Type = static_cast<D3D_SHADER_INPUT_TYPE>( resource.Type );
+		desc.BindPoint = resource.BindPoint;
+		desc.BindCount = resource.BindCount;
+		desc.uFlags = resource.Flags;
+		desc.ReturnType = static_cast<D3D_RESOURCE_RETURN_TYPE>( resource.ReturnType );
+		desc.Dimension = static_cast<D3D_SRV_DIMENSION>( resource.Dimension );
+		desc.NumSamples = resource.SampleCount;
+
+		return InputBindingDescription( desc );
+	}
+
+	InputBindingDescription ShaderContainer::GetResourceBindingDescription( String^ name )
+	{
+		CheckDisposed();
+		if( name == nullptr )
+			throw gcnew ArgumentNullException( "name" );
+
+		const std::vector<DxbcResourceBinding>& resources = m_Data->Definitions.Resources;
+		for( size_t i = 0; i < resources.size(); ++i )
+		{
+			if( name->Equals( gcnew String( resources[i].Name ) ) )
+				return GetResourceBindingDescription( static_cast<int>( i ) );
+		}
+
+		RECORD_D3DC( E_INVALIDARG );
+		return InputBindingDescription();
+	}
+
+	ConstantBufferDescription ShaderContainer::GetConstantBufferDescription( int index )
+	{
+		CheckDisposed();
+		const std::vector<DxbcConstantBuffer>& buffers = m_Data->Definitions.ConstantBuffers;
+		if( index < 0 || index >= static_cast<int>( buffers.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return ConstantBufferDescription();
+		}
+
+		const DxbcConstantBuffer& buffer = buffers[index];
+
+		D3D11_SHADER_BUFFER_DESC desc;
+		memset( &desc, 0, sizeof( desc ) );
+		desc.Name = buffer.Name;
+		desc.Type = static_cast<D3D_CBUFFER_TYPE>( buffer.Type );
+		desc.Variables = static_cast<UINT>( buffer.Variables.size() );
+		desc.Size = buffer.Size;
+		desc.uFlags = buffer.Flags;
+
+		return ConstantBufferDescription( desc );
+	}
+
+	ConstantBufferDescription ShaderContainer::GetConstantBufferDescription( String^ name )
+	{
+		CheckDisposed();
+		if( name == nullptr )
+			throw gcnew ArgumentNullException( "name" );
+
+		const std::vector<DxbcConstantBuffer>& buffers = m_Data->Definitions.ConstantBuffers;
+		for( size_t i = 0; i < buffers.size(); ++i )
+		{
+			if( name->Equals( gcnew String( buffers[i].Name ) ) )
+				return GetConstantBufferDescription( static_cast<int>( i ) );
+		}
+
+		RECORD_D3DC( E_INVALIDARG );
+		return ConstantBufferDescription();
+	}
+
+	ShaderVariableDescription ShaderContainer::GetVariableDescription( int bufferIndex, int variableIndex )
+	{
+		CheckDisposed();
+		const std::vector<DxbcConstantBuffer>& buffers = m_Data->Definitions.ConstantBuffers;
+		if( bufferIndex < 0 || bufferIndex >= static_cast<int>( buffers.size() ) ||
+			variableIndex < 0 || variableIndex >= static_cast<int>( buffers[bufferIndex].Variables.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return ShaderVariableDescription();
+		}
+
+		const DxbcVariable& variable = buffers[bufferIndex].Variables[variableIndex];
+
+		D3D11_SHADER_VARIABLE_DESC desc;
+		memset( &desc, 0, sizeof( desc ) );
+		desc.Name = variable.Name;
+		desc.StartOffset = variable.StartOffset;
+		desc.Size = variable.Size;
+		desc.uFlags = variable.Flags;
+		desc.DefaultValue = const_cast<void*>( variable.DefaultValue );
+
+		return ShaderVariableDescription( desc );
+	}
+
+	ShaderTypeDescription ShaderContainer::GetVariableTypeDescription( int bufferIndex, int variableIndex )
+	{
+		CheckDisposed();
+		const std::vector<DxbcConstantBuffer>& buffers = m_Data->Definitions.ConstantBuffers;
+		if( bufferIndex < 0 || bufferIndex >= static_cast<int>( buffers.size() ) ||
+			variableIndex < 0 || variableIndex >= static_cast<int>( buffers[bufferIndex].Variables.size() ) )
+		{
+			RECORD_D3DC( E_INVALIDARG );
+			return ShaderTypeDescription();
+		}
+
+		const DxbcType& type = buffers[bufferIndex].Variables[variableIndex].Type;
+
+		D3D11_SHADER_TYPE_DESC desc;
+		memset( &desc, 0, sizeof( desc ) );
+		desc.Class = static_cast<D3D_SHADER_VARIABLE_CLASS>( type.Class );
+		desc.Type = static_cast<D3D_SHADER_VARIABLE_TYPE>( type.Type );
+		desc.Rows = type.Rows;
+		desc.Columns = type.Columns;
+		desc.Elements = type.Elements;
+		desc.Members = type.Members;
+
+		return ShaderTypeDescription( desc );
+	}
+}
+}
@@ -0,0 +1,215 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../DataStream.h"
+
+#include "DxbcContainerDC.h"
+#include "ShaderBytecodeDC.h"
+#include "ShaderSignatureDC.h"
+#include "ShaderDescriptionDC.h"
+#include "ShaderParameterDescriptionDC.h"
+#include "InputBindingDescriptionDC.h"
+#include "ConstantBufferDescriptionDC.h"
+#include "ShaderVariableDescriptionDC.h"
+#include "ShaderTypeDescriptionDC.h"
+
+namespace SlimDX
+{
+	namespace D3DCompiler
+	{
+		struct ShaderContainerData
+		{
+			DxbcContainer Container;
+			DxbcResourceDefinitions Definitions;
+			DxbcStatistics Statistics;
+			std::vector<DxbcSignatureElement> Signatures[3];
+			bool HasDefinitions;
+			bool HasStatistics;
+		};
+
+		/// <summary>
+		/// Provides reflection over compiled shader bytecode by parsing the DXBC container directly, without
+		/// calling into the D3DCompiler runtime.
+		/// </summary>
+		/// <remarks>
+		/// The container does not copy the bytecode, so the original memory must stay alive for as long as the container
+		/// is in use. The chunk streams and signatures it returns read that memory in place; they keep the container alive
+		/// while they are reachable, and disposing the container disposes them as well.
+		/// </remarks>
+		public ref class ShaderContainer
+		{
+		private:
+			ShaderContainerData* m_Data;
+			System::Object^ m_Source;
+			ShaderDescription^ m_Description;
+			System::Collections::Generic::List<System::WeakReference^>^ m_Views;
+
+			void Construct( const void* data, System::Int64 size );
+			void Destruct();
+			void CheckDisposed();
+			DataStream^ CreateView( const void* data, System::Int64 size );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderContainer"/> class.
+			/// </summary>
+			/// <param name="data">A <see cref="DataStream"/> containing the compiled bytecode.</param>
+			ShaderContainer( DataStream^ data );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderContainer"/> class.
+			/// </summary>
+			/// <param name="bytecode">The compiled bytecode.</param>
+			ShaderContainer( ShaderBytecode^ bytecode );
+
+			/// <summary>
+			/// Releases all resources used by the <see cref="ShaderContainer"/>.
+			/// </summary>
+			~ShaderContainer();
+
+			/// <summary>
+			/// Releases unmanaged resources and performs other cleanup operations before the <see cref="ShaderContainer"/> is reclaimed by garbage collection.
+			/// </summary>
+			!ShaderContainer();
+
+			/// <summary>
+			/// Gets the number of chunks in the container.
+			/// </summary>
+			property int ChunkCount
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the 128-bit checksum stored in the container header.
+			/// </summary>
+			property array<System::Byte>^ Checksum
+			{
+				array<System::Byte>^ get();
+			}
+
+			/// <summary>
+			/// Gets a description of the shader, assembled from the container's resource definition and statistics chunks.
+			/// </summary>
+			property ShaderDescription^ Description
+			{
+				ShaderDescription^ get();
+			}
+
+			/// <summary>
+			/// Gets a signature that can be used to create input layouts for the shader. The signature reads the whole
+			/// container in place, so no signature blob needs to be extracted.
+			/// </summary>
+			property ShaderSignature^ InputSignature
+			{
+				ShaderSignature^ get();
+			}
+
+			/// <summary>
+			/// Gets the four-character code of a chunk.
+			/// </summary>
+			/// <param name="index">The zero-based index of the chunk.</param>
+			/// <returns>The four-character code of the chunk.</returns>
+			System::String^ GetChunkName( int index );
+
+			/// <summary>
+			/// Gets a read-only view of the data of a chunk.
+			/// </summary>
+			/// <param name="index">The zero-based index of the chunk.</param>
+			/// <returns>A stream holding the chunk data, or <c>null</c> if the chunk is empty.</returns>
+			DataStream^ GetChunk( int index );
+
+			/// <summary>
+			/// Gets a read-only view of the data of a chunk.
+			/// </summary>
+			/// <param name="name">The four-character code of the chunk, such as "RDEF" or "ISGN".</param>
+			/// <returns>A stream holding the chunk data, or <c>null</c> if the container has no such chunk or the chunk is empty.</returns>
+			DataStream^ GetChunk( System::String^ name );
+
+			/// <summary>
+			/// Gets a description of a shader input parameter.
+			/// </summary>
+			/// <param name="index">The zero-based index of the parameter.</param>
+			/// <returns>The parameter description.</returns>
+			ShaderParameterDescription GetInputParameterDescription( int index );
+
+			/// <summary>
+			/// Gets a description of a shader output parameter.
+			/// </summary>
+			/// <param name="index">The zero-based index of the parameter.</param>
+			/// <returns>The parameter description.</returns>
+			ShaderParameterDescription GetOutputParameterDescription( int index );
+
+			/// <summary>
+			/// Gets a description of a patch constant parameter.
+			/// </summary>
+			/// <param name="index">The zero-based index of the parameter.</param>
+			/// <returns>The parameter description.</returns>
+			ShaderParameterDescription GetPatchConstantParameterDescription( int index );
+
+			/// <summary>
+			/// Gets a description of a resource bound to the shader.
+			/// </summary>
+			/// <param name="index">The zero-based index of the resource.</param>
+			/// <returns>The resource binding description.</returns>
+			InputBindingDescription GetResourceBindingDescription( int index );
+
+			/// <summary>
+			/// Gets a description of a resource bound to the shader.
+			/// </summary>
+			/// <param name="name">The name of the resource.</param>
+			/// <returns>The resource binding description.</returns>
+			InputBindingDescription GetResourceBindingDescription( System::String^ name );
+
+			/// <summary>
+			/// Gets a description of a constant buffer.
+			/// </summary>
+			/// <param name="index">The zero-based index of the constant buffer.</param>
+			/// <returns>The constant buffer description.</returns>
+			ConstantBufferDescription GetConstantBufferDescription( int index );
+
+			/// <summary>
+			/// Gets a description of a constant buffer.
+			/// </summary>
+			/// <param name="name">The name of the constant buffer.</param>
+			/// <returns>The constant buffer description.</returns>
+			ConstantBufferDescription GetConstantBufferDescription( System::String^ name );
+
+			/// <summary>
+			/// Gets a description of a variable within a constant buffer.
+			/// </summary>
+			/// <param name="bufferIndex">The zero-based index of the constant buffer.</param>
+			/// <param name="variableIndex">The zero-based index of the variable within the buffer.</param>
+			/// <returns>The variable description.</returns>
+			ShaderVariableDescription GetVariableDescription( int bufferIndex, int variableIndex );
+
+			/// <summary>
+			/// Gets a description of the type of a variable within a constant buffer.
+			/// </summary>
+			/// <param name="bufferIndex">The zero-based index of the constant buffer.</param>
+			/// <param name="variableIndex">The zero-based index of the variable within the buffer.</param>
+			/// <returns>The type description.</returns>
+			ShaderTypeDescription GetVariableTypeDescription( int bufferIndex, int variableIndex );
+		};
+	}
+};
@@ -35,7 +35,7 @@ namespace D3DCompiler
 	ShaderReflection::ShaderReflection( ShaderBytecode^ byteCode )
 	{
 		ID3D11ShaderReflection* result = 0;
-		HRESULT hr = D3DReflect( byteCode->InternalPointer->GetBufferPointer(), byteCode->InternalPointer->GetBufferSize(), IID_ID3D11ShaderReflection, reinterpret_cast<void**>( &result ) );
+		HRESULT hr = TIME_CALL( D3DReflect( byteCode->InternalPointer->GetBufferPointer(), byteCode->InternalPointer->GetBufferSize(), IID_ID3D11ShaderReflection, reinterpret_cast<void**>( &result ) ) );
 		if( RECORD_D3DC( hr ).IsFailure )
 			throw gcnew D3DCompilerException( Result::Last );
 
@@ -63,7 +63,7 @@ namespace D3DCompiler
 	{
 		D3D11_SIGNATURE_PARAMETER_DESC desc;
 
-		HRESULT hr = InternalPointer->GetInputParameterDesc( index, &desc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetInputParameterDesc( index, &desc ) );
 		RECORD_D3DC( hr );
 
 		return ShaderParameterDescription( desc );
@@ -73,7 +73,7 @@ namespace D3DCompiler
 	{
 		D3D11_SIGNATURE_PARAMETER_DESC desc;
 
-		HRESULT hr = InternalPointer->GetOutputParameterDesc( index, &desc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetOutputParameterDesc( index, &desc ) );
 		RECORD_D3DC( hr );
 
 		return ShaderParameterDescription( desc );
@@ -83,7 +83,7 @@ namespace D3DCompiler
 	{
 		D3D11_SIGNATURE_PARAMETER_DESC desc;
 
-		HRESULT hr = InternalPointer->GetPatchConstantParameterDesc( index, &desc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPatchConstantParameterDesc( index, &desc ) );
 		RECORD_D3DC( hr );
 
 		return ShaderParameterDescription( desc );
@@ -93,7 +93,7 @@ namespace D3DCompiler
 	{
 		D3D11_SHADER_INPUT_BIND_DESC desc;
 
-		HRESULT hr = InternalPointer->GetResourceBindingDesc( index, &desc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetResourceBindingDesc( index, &desc ) );
 		RECORD_D3DC( hr );
 
 		return InputBindingDescription( desc );
@@ -105,7 +105,7 @@ namespace D3DCompiler
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->GetResourceBindingDescByName( reinterpret_cast<LPCSTR>(pinnedName), &desc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetResourceBindingDescByName( reinterpret_cast<LPCSTR>(pinnedName), &desc ) );
 		RECORD_D3DC( hr );
 
 		return InputBindingDescription( desc );
@@ -64,7 +64,7 @@ namespace D3DCompiler
 	ShaderTypeDescription ShaderReflectionType::Description::get()
 	{
 		D3D11_SHADER_TYPE_DESC nativeDescription;
-		HRESULT hr = m_Pointer->GetDesc( &nativeDescription );
+		HRESULT hr = TIME_CALL( m_Pointer->GetDesc( &nativeDescription ) );
 		RECORD_D3DC( hr );
 
 		return ShaderTypeDescription( nativeDescription );
@@ -50,7 +50,7 @@ namespace D3DCompiler
 	ShaderVariableDescription ShaderReflectionVariable::Description::get()
 	{
 		D3D11_SHADER_VARIABLE_DESC nativeDescription;
-		HRESULT hr = m_Pointer->GetDesc( &nativeDescription );
+		HRESULT hr = TIME_CALL( m_Pointer->GetDesc( &nativeDescription ) );
 		RECORD_D3DC( hr );
 
 		return ShaderVariableDescription( nativeDescription );
@@ -47,7 +47,7 @@ namespace D3DCompiler
 	{
 		ID3D10Blob *blob;
 
-		HRESULT hr = D3DGetInputSignatureBlob( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), &blob );
+		HRESULT hr = TIME_CALL( D3DGetInputSignatureBlob( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), &blob ) );
 		if( RECORD_D3DC( hr ).IsFailure )
 			return nullptr;
 
@@ -60,7 +60,7 @@ namespace D3DCompiler
 	{
 		ID3D10Blob *blob;
 
-		HRESULT hr = D3DGetOutputSignatureBlob( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), &blob );
+		HRESULT hr = TIME_CALL( D3DGetOutputSignatureBlob( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), &blob ) );
 		if( RECORD_D3DC( hr ).IsFailure )
 			return nullptr;
 
@@ -73,7 +73,7 @@ namespace D3DCompiler
 	{
 		ID3D10Blob *blob;
 
-		HRESULT hr = D3DGetInputAndOutputSignatureBlob( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), &blob );
+		HRESULT hr = TIME_CALL( D3DGetInputAndOutputSignatureBlob( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), &blob ) );
 		if( RECORD_D3DC( hr ).IsFailure )
 			return nullptr;
 
@@ -44,7 +44,7 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), D2D1::BitmapProperties(), &bitmap );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), D2D1::BitmapProperties(), &bitmap ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
@@ -55,7 +55,7 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), BitmapProperties::ToUnmanaged( properties ), &bitmap );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), BitmapProperties::ToUnmanaged( properties ), &bitmap ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
@@ -66,8 +66,8 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), data->DataPointer.ToPointer(), pitch,
-			D2D1::BitmapProperties(), &bitmap );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), data->DataPointer.ToPointer(), pitch,
+			D2D1::BitmapProperties(), &bitmap ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -79,8 +79,8 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), data->DataPointer.ToPointer(), pitch,
-			BitmapProperties::ToUnmanaged( properties ), &bitmap );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmap( D2D1::SizeU( size.Width, size.Height ), data->DataPointer.ToPointer(), pitch,
+			BitmapProperties::ToUnmanaged( properties ), &bitmap ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -91,7 +91,7 @@ namespace Direct2D
 	Bitmap::Bitmap(RenderTarget^ renderTarget, SlimDX::DXGI::Surface^ surface)
 	{
 		ID2D1Bitmap *bitmap = 0;
-		HRESULT hr = renderTarget->InternalPointer->CreateSharedBitmap(IID_IDXGISurface, surface->InternalPointer, NULL, &bitmap);
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateSharedBitmap(IID_IDXGISurface, surface->InternalPointer, NULL, &bitmap) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -102,7 +102,7 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = 0;
 		D2D1_BITMAP_PROPERTIES bitmapProperties = BitmapProperties::ToUnmanaged(properties);
-		HRESULT hr = renderTarget->InternalPointer->CreateSharedBitmap(IID_IDXGISurface, surface->InternalPointer, &bitmapProperties, &bitmap);
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateSharedBitmap(IID_IDXGISurface, surface->InternalPointer, &bitmapProperties, &bitmap) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -111,13 +111,13 @@ namespace Direct2D
 
 	Result Bitmap::FromBitmap( Bitmap^ sourceBitmap )
 	{
-		HRESULT hr = InternalPointer->CopyFromBitmap( NULL, sourceBitmap->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromBitmap( NULL, sourceBitmap->InternalPointer, NULL ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Bitmap::FromBitmap( Bitmap^ sourceBitmap, Point destinationPoint )
 	{
-		HRESULT hr = InternalPointer->CopyFromBitmap( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), sourceBitmap->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromBitmap( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), sourceBitmap->InternalPointer, NULL ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -125,19 +125,19 @@ namespace Direct2D
 	{
 		D2D1_RECT_U rect = ConvertRectangle( sourceArea );
 
-		HRESULT hr = InternalPointer->CopyFromBitmap( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), sourceBitmap->InternalPointer, &rect );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromBitmap( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), sourceBitmap->InternalPointer, &rect ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Bitmap::FromRenderTarget( RenderTarget^ renderTarget )
 	{
-		HRESULT hr = InternalPointer->CopyFromRenderTarget( NULL, renderTarget->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromRenderTarget( NULL, renderTarget->InternalPointer, NULL ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Bitmap::FromRenderTarget( RenderTarget^ renderTarget, System::Drawing::Point destinationPoint )
 	{
-		HRESULT hr = InternalPointer->CopyFromRenderTarget( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), renderTarget->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromRenderTarget( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), renderTarget->InternalPointer, NULL ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -145,7 +145,7 @@ namespace Direct2D
 	{
 		D2D1_RECT_U rect = ConvertRectangle( sourceArea );
 
-		HRESULT hr = InternalPointer->CopyFromRenderTarget( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), renderTarget->InternalPointer, &rect );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromRenderTarget( reinterpret_cast<D2D1_POINT_2U*>( &destinationPoint ), renderTarget->InternalPointer, &rect ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -153,7 +153,7 @@ namespace Direct2D
 	{
 		pin_ptr<Byte> pinnedMemory = &memory[0];
 
-		HRESULT hr = InternalPointer->CopyFromMemory( NULL, pinnedMemory, pitch );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromMemory( NULL, pinnedMemory, pitch ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -162,13 +162,13 @@ namespace Direct2D
 		pin_ptr<Byte> pinnedMemory = &memory[0];
 		D2D1_RECT_U rect = ConvertRectangle( destinationArea );
 
-		HRESULT hr = InternalPointer->CopyFromMemory( &rect, pinnedMemory, pitch );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromMemory( &rect, pinnedMemory, pitch ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Bitmap::FromMemory( IntPtr pointer, int pitch )
 	{
-		HRESULT hr = InternalPointer->CopyFromMemory( NULL, pointer.ToPointer(), pitch );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromMemory( NULL, pointer.ToPointer(), pitch ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -176,7 +176,7 @@ namespace Direct2D
 	{
 		D2D1_RECT_U rect = ConvertRectangle( destinationArea );
 
-		HRESULT hr = InternalPointer->CopyFromMemory( &rect, pointer.ToPointer(), pitch );
+		HRESULT hr = TIME_CALL( InternalPointer->CopyFromMemory( &rect, pointer.ToPointer(), pitch ) );
 		return RECORD_D2D( hr );
 	}
 
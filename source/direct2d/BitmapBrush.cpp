@@ -41,7 +41,7 @@ namespace Direct2D
 	{
 		ID2D1BitmapBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmapBrush( bitmap->InternalPointer, &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmapBrush( bitmap->InternalPointer, &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -53,8 +53,8 @@ namespace Direct2D
 	{
 		ID2D1BitmapBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmapBrush( bitmap->InternalPointer, reinterpret_cast<D2D1_BITMAP_BRUSH_PROPERTIES*>( &bitmapBrushProperties ),
-			NULL, &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmapBrush( bitmap->InternalPointer, reinterpret_cast<D2D1_BITMAP_BRUSH_PROPERTIES*>( &bitmapBrushProperties ),
+			NULL, &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -66,8 +66,8 @@ namespace Direct2D
 	{
 		ID2D1BitmapBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateBitmapBrush( bitmap->InternalPointer, reinterpret_cast<D2D1_BITMAP_BRUSH_PROPERTIES*>( &bitmapBrushProperties ),
-			reinterpret_cast<D2D1_BRUSH_PROPERTIES*>( &brushProperties ), &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateBitmapBrush( bitmap->InternalPointer, reinterpret_cast<D2D1_BITMAP_BRUSH_PROPERTIES*>( &bitmapBrushProperties ),
+			reinterpret_cast<D2D1_BRUSH_PROPERTIES*>( &brushProperties ), &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -43,7 +43,7 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = NULL;
 
-		HRESULT hr = InternalPointer->GetBitmap( &bitmap );
+		HRESULT hr = TIME_CALL( InternalPointer->GetBitmap( &bitmap ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
 
@@ -43,7 +43,7 @@ namespace Direct2D
 	{
 		ID2D1DCRenderTarget *renderTarget = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateDCRenderTarget( reinterpret_cast<D2D1_RENDER_TARGET_PROPERTIES*>( &renderTargetProperties ), &renderTarget );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateDCRenderTarget( reinterpret_cast<D2D1_RENDER_TARGET_PROPERTIES*>( &renderTargetProperties ), &renderTarget ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -59,7 +59,7 @@ namespace Direct2D
 		rect.top = dimensions.Top;
 		rect.bottom = dimensions.Bottom;
 
-		HRESULT hr = InternalPointer->BindDC( static_cast<HDC>( deviceContext.ToPointer() ), &rect );
+		HRESULT hr = TIME_CALL( InternalPointer->BindDC( static_cast<HDC>( deviceContext.ToPointer() ), &rect ) );
 		return RECORD_D2D( hr );
 	}
 }
@@ -21,7 +21,7 @@
 */
 #pragma once
 
-#define RECORD_D2D(x) Result::Record<Direct2DException^>( (x), (nullptr), (nullptr) )
+#define RECORD_D2D(x) RECORD_RESULT( Direct2DException^, x )
 
 #include "../SlimDXException.h"
 
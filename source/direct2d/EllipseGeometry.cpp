@@ -41,7 +41,7 @@ namespace Direct2D
 	{
 		ID2D1EllipseGeometry *geometry = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateEllipseGeometry( reinterpret_cast<D2D1_ELLIPSE*>( &ellipse ), &geometry );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateEllipseGeometry( reinterpret_cast<D2D1_ELLIPSE*>( &ellipse ), &geometry ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
@@ -43,7 +43,7 @@ namespace Direct2D
 	{
 		ID2D1GdiInteropRenderTarget *rt = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->QueryInterface( IID_ID2D1GdiInteropRenderTarget, reinterpret_cast<void**>( &rt ) );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->QueryInterface( IID_ID2D1GdiInteropRenderTarget, reinterpret_cast<void**>( &rt ) ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -55,7 +55,7 @@ namespace Direct2D
 	{
 		HDC hdc;
 
-		HRESULT hr = InternalPointer->GetDC( static_cast<D2D1_DC_INITIALIZE_MODE>( mode ), &hdc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDC( static_cast<D2D1_DC_INITIALIZE_MODE>( mode ), &hdc ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			return IntPtr::Zero;
 
@@ -64,7 +64,7 @@ namespace Direct2D
 
 	Result GdiInteropRenderTarget::ReleaseDC()
 	{
-		HRESULT hr = InternalPointer->ReleaseDC( NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->ReleaseDC( NULL ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -76,7 +76,7 @@ namespace Direct2D
 		rect.top = updateRegion.Top;
 		rect.bottom = updateRegion.Bottom;
 
-		HRESULT hr = InternalPointer->ReleaseDC( &rect );
+		HRESULT hr = TIME_CALL( InternalPointer->ReleaseDC( &rect ) );
 		return RECORD_D2D( hr );
 	}
 }
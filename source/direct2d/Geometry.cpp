@@ -39,24 +39,24 @@ namespace Direct2D
 {
 	Result Geometry::Combine( Geometry^ geometry1, Geometry^ geometry2, CombineMode combineMode, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry1->InternalPointer->CombineWithGeometry( geometry2->InternalPointer, static_cast<D2D1_COMBINE_MODE>( combineMode ),
-			NULL, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry1->InternalPointer->CombineWithGeometry( geometry2->InternalPointer, static_cast<D2D1_COMBINE_MODE>( combineMode ),
+			NULL, geometrySink->InternalPointer ) );
 
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Combine( Geometry^ geometry1, Geometry^ geometry2, CombineMode combineMode, Matrix3x2 transform, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry1->InternalPointer->CombineWithGeometry( geometry2->InternalPointer, static_cast<D2D1_COMBINE_MODE>( combineMode ),
-			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry1->InternalPointer->CombineWithGeometry( geometry2->InternalPointer, static_cast<D2D1_COMBINE_MODE>( combineMode ),
+			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer ) );
 
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Combine( Geometry^ geometry1, Geometry^ geometry2, CombineMode combineMode, Matrix3x2 transform, float flatteningTolerance, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry1->InternalPointer->CombineWithGeometry( geometry2->InternalPointer, static_cast<D2D1_COMBINE_MODE>( combineMode ),
-			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry1->InternalPointer->CombineWithGeometry( geometry2->InternalPointer, static_cast<D2D1_COMBINE_MODE>( combineMode ),
+			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer ) );
 
 		return RECORD_D2D( hr );
 	}
@@ -65,7 +65,7 @@ namespace Direct2D
 	{
 		D2D1_GEOMETRY_RELATION result;
 
-		HRESULT hr = geometry1->InternalPointer->CompareWithGeometry( geometry2->InternalPointer, NULL, &result );
+		HRESULT hr = TIME_CALL( geometry1->InternalPointer->CompareWithGeometry( geometry2->InternalPointer, NULL, &result ) );
 		RECORD_D2D( hr );
 
 		return static_cast<GeometryRelation>( result );
@@ -75,7 +75,7 @@ namespace Direct2D
 	{
 		D2D1_GEOMETRY_RELATION result;
 
-		HRESULT hr = geometry1->InternalPointer->CompareWithGeometry( geometry2->InternalPointer, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &result );
+		HRESULT hr = TIME_CALL( geometry1->InternalPointer->CompareWithGeometry( geometry2->InternalPointer, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &result ) );
 		RECORD_D2D( hr );
 
 		return static_cast<GeometryRelation>( result );
@@ -85,7 +85,7 @@ namespace Direct2D
 	{
 		D2D1_GEOMETRY_RELATION result;
 
-		HRESULT hr = geometry1->InternalPointer->CompareWithGeometry( geometry2->InternalPointer, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &result );
+		HRESULT hr = TIME_CALL( geometry1->InternalPointer->CompareWithGeometry( geometry2->InternalPointer, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &result ) );
 		RECORD_D2D( hr );
 
 		return static_cast<GeometryRelation>( result );
@@ -95,7 +95,7 @@ namespace Direct2D
 	{
 		float area = 0.0f;
 
-		HRESULT hr = geometry->InternalPointer->ComputeArea( NULL, &area );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputeArea( NULL, &area ) );
 		RECORD_D2D( hr );
 
 		return area;
@@ -105,7 +105,7 @@ namespace Direct2D
 	{
 		float area = 0.0f;
 
-		HRESULT hr = geometry->InternalPointer->ComputeArea( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &area );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputeArea( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &area ) );
 		RECORD_D2D( hr );
 
 		return area;
@@ -115,7 +115,7 @@ namespace Direct2D
 	{
 		float area = 0.0f;
 
-		HRESULT hr = geometry->InternalPointer->ComputeArea( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &area );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputeArea( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &area ) );
 		RECORD_D2D( hr );
 
 		return area;
@@ -125,7 +125,7 @@ namespace Direct2D
 	{
 		float length = 0.0f;
 
-		HRESULT hr = geometry->InternalPointer->ComputeLength( NULL, &length );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputeLength( NULL, &length ) );
 		RECORD_D2D( hr );
 
 		return length;
@@ -135,7 +135,7 @@ namespace Direct2D
 	{
 		float length = 0.0f;
 
-		HRESULT hr = geometry->InternalPointer->ComputeLength( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &length );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputeLength( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &length ) );
 		RECORD_D2D( hr );
 
 		return length;
@@ -145,7 +145,7 @@ namespace Direct2D
 	{
 		float length = 0.0f;
 
-		HRESULT hr = geometry->InternalPointer->ComputeLength( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &length );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputeLength( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &length ) );
 		RECORD_D2D( hr );
 
 		return length;
@@ -155,7 +155,7 @@ namespace Direct2D
 	{
 		D2D1_POINT_2F point;
 
-		HRESULT hr = geometry->InternalPointer->ComputePointAtLength( length, NULL, &point, NULL );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputePointAtLength( length, NULL, &point, NULL ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::PointF( point.x, point.y );
@@ -165,7 +165,7 @@ namespace Direct2D
 	{
 		D2D1_POINT_2F point;
 
-		HRESULT hr = geometry->InternalPointer->ComputePointAtLength( length, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &point, NULL );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputePointAtLength( length, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &point, NULL ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::PointF( point.x, point.y );
@@ -175,7 +175,7 @@ namespace Direct2D
 	{
 		D2D1_POINT_2F point;
 
-		HRESULT hr = geometry->InternalPointer->ComputePointAtLength( length, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &point, NULL );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputePointAtLength( length, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &point, NULL ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::PointF( point.x, point.y );
@@ -186,7 +186,7 @@ namespace Direct2D
 		D2D1_POINT_2F point;
 		D2D1_POINT_2F tangent;
 
-		HRESULT hr = geometry->InternalPointer->ComputePointAtLength( length, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &point, &tangent );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->ComputePointAtLength( length, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &point, &tangent ) );
 		RECORD_D2D( hr );
 
 		unitTangentVector = Vector2( tangent.x, tangent.y );
@@ -213,7 +213,7 @@ namespace Direct2D
 		BOOL result;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->FillContainsPoint( p, NULL, &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->FillContainsPoint( p, NULL, &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -224,7 +224,7 @@ namespace Direct2D
 		BOOL result;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->FillContainsPoint( p, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->FillContainsPoint( p, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -235,7 +235,7 @@ namespace Direct2D
 		BOOL result;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->FillContainsPoint( p, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->FillContainsPoint( p, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -245,7 +245,7 @@ namespace Direct2D
 	{
 		D2D1_RECT_F bounds;
 
-		HRESULT hr = geometry->InternalPointer->GetBounds( NULL, &bounds );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->GetBounds( NULL, &bounds ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::RectangleF::FromLTRB( bounds.left, bounds.top, bounds.right, bounds.bottom );
@@ -255,7 +255,7 @@ namespace Direct2D
 	{
 		D2D1_RECT_F bounds;
 
-		HRESULT hr = geometry->InternalPointer->GetBounds( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &bounds );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->GetBounds( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &bounds ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::RectangleF::FromLTRB( bounds.left, bounds.top, bounds.right, bounds.bottom );
@@ -265,7 +265,7 @@ namespace Direct2D
 	{
 		D2D1_RECT_F bounds;
 
-		HRESULT hr = geometry->InternalPointer->GetWidenedBounds( strokeWidth, NULL, NULL, &bounds );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->GetWidenedBounds( strokeWidth, NULL, NULL, &bounds ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::RectangleF::FromLTRB( bounds.left, bounds.top, bounds.right, bounds.bottom );
@@ -276,7 +276,7 @@ namespace Direct2D
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 		D2D1_RECT_F bounds;
 
-		HRESULT hr = geometry->InternalPointer->GetWidenedBounds( strokeWidth, ss, NULL, &bounds );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->GetWidenedBounds( strokeWidth, ss, NULL, &bounds ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::RectangleF::FromLTRB( bounds.left, bounds.top, bounds.right, bounds.bottom );
@@ -287,7 +287,7 @@ namespace Direct2D
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 		D2D1_RECT_F bounds;
 
-		HRESULT hr = geometry->InternalPointer->GetWidenedBounds( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &bounds );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->GetWidenedBounds( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &bounds ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::RectangleF::FromLTRB( bounds.left, bounds.top, bounds.right, bounds.bottom );
@@ -298,7 +298,7 @@ namespace Direct2D
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 		D2D1_RECT_F bounds;
 
-		HRESULT hr = geometry->InternalPointer->GetWidenedBounds( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &bounds );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->GetWidenedBounds( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &bounds ) );
 		RECORD_D2D( hr );
 
 		return System::Drawing::RectangleF::FromLTRB( bounds.left, bounds.top, bounds.right, bounds.bottom );
@@ -306,19 +306,19 @@ namespace Direct2D
 
 	Result Geometry::Outline( Geometry^ geometry, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Outline( NULL, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Outline( NULL, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Outline( Geometry^ geometry, Matrix3x2 transform, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Outline( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Outline( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Outline( Geometry^ geometry, Matrix3x2 transform, float flatteningTolerance, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Outline( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Outline( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -347,7 +347,7 @@ namespace Direct2D
 		BOOL result;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, NULL, NULL, &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, NULL, NULL, &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -359,7 +359,7 @@ namespace Direct2D
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, ss, NULL, &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, ss, NULL, &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -371,7 +371,7 @@ namespace Direct2D
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -383,7 +383,7 @@ namespace Direct2D
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 		D2D1_POINT_2F p = D2D1::Point2F( point.X, point.Y );
 
-		HRESULT hr = geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &result );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->StrokeContainsPoint( p, strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, &result ) );
 		RECORD_D2D( hr );
 
 		return result > 0;
@@ -391,45 +391,45 @@ namespace Direct2D
 
 	Result Geometry::Simplify( Geometry^ geometry, SimplificationType type, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Simplify( static_cast<D2D1_GEOMETRY_SIMPLIFICATION_OPTION>( type ), NULL, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Simplify( static_cast<D2D1_GEOMETRY_SIMPLIFICATION_OPTION>( type ), NULL, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Simplify( Geometry^ geometry, SimplificationType type, Matrix3x2 transform, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Simplify( static_cast<D2D1_GEOMETRY_SIMPLIFICATION_OPTION>( type ),
-			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Simplify( static_cast<D2D1_GEOMETRY_SIMPLIFICATION_OPTION>( type ),
+			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Simplify( Geometry^ geometry, SimplificationType type, Matrix3x2 transform, float flatteningTolerance, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Simplify( static_cast<D2D1_GEOMETRY_SIMPLIFICATION_OPTION>( type ),
-			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Simplify( static_cast<D2D1_GEOMETRY_SIMPLIFICATION_OPTION>( type ),
+			reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Tessellate( Geometry^ geometry, TessellationSink^ tessellationSink )
 	{
-		HRESULT hr = geometry->InternalPointer->Tessellate( NULL, tessellationSink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Tessellate( NULL, tessellationSink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Tessellate( Geometry^ geometry, Matrix3x2 transform, TessellationSink^ tessellationSink )
 	{
-		HRESULT hr = geometry->InternalPointer->Tessellate( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), tessellationSink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Tessellate( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), tessellationSink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Tessellate( Geometry^ geometry, Matrix3x2 transform, float flatteningTolerance, TessellationSink^ tessellationSink )
 	{
-		HRESULT hr = geometry->InternalPointer->Tessellate( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, tessellationSink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Tessellate( reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, tessellationSink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
 	Result Geometry::Widen( Geometry^ geometry, float strokeWidth, SimplifiedGeometrySink^ geometrySink )
 	{
-		HRESULT hr = geometry->InternalPointer->Widen( strokeWidth, NULL, NULL, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Widen( strokeWidth, NULL, NULL, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -437,7 +437,7 @@ namespace Direct2D
 	{
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 
-		HRESULT hr = geometry->InternalPointer->Widen( strokeWidth, ss, NULL, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Widen( strokeWidth, ss, NULL, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -445,7 +445,7 @@ namespace Direct2D
 	{
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 
-		HRESULT hr = geometry->InternalPointer->Widen( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Widen( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -453,7 +453,7 @@ namespace Direct2D
 	{
 		ID2D1StrokeStyle *ss = strokeStyle == nullptr ? NULL : strokeStyle->InternalPointer;
 
-		HRESULT hr = geometry->InternalPointer->Widen( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( geometry->InternalPointer->Widen( strokeWidth, ss, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), flatteningTolerance, geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 }
@@ -46,7 +46,7 @@ namespace Direct2D
 		for( int i = 0; i < geometries->Length; i++ )
 			geos[i] = geometries[i]->InternalPointer;
 
-		HRESULT hr = factory->InternalPointer->CreateGeometryGroup( static_cast<D2D1_FILL_MODE>( fillMode ), &geos[0], geometries->Length, &group );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateGeometryGroup( static_cast<D2D1_FILL_MODE>( fillMode ), &geos[0], geometries->Length, &group ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
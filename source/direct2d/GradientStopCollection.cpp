@@ -41,7 +41,7 @@ namespace Direct2D
 		ID2D1GradientStopCollection *collection = NULL;
 		pin_ptr<GradientStop> pinnedStops = &stops[0];
 
-		HRESULT hr = renderTarget->InternalPointer->CreateGradientStopCollection( reinterpret_cast<D2D1_GRADIENT_STOP*>( pinnedStops ), stops->Length, &collection );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateGradientStopCollection( reinterpret_cast<D2D1_GRADIENT_STOP*>( pinnedStops ), stops->Length, &collection ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -54,8 +54,8 @@ namespace Direct2D
 		ID2D1GradientStopCollection *collection = NULL;
 		pin_ptr<GradientStop> pinnedStops = &stops[0];
 
-		HRESULT hr = renderTarget->InternalPointer->CreateGradientStopCollection( reinterpret_cast<D2D1_GRADIENT_STOP*>( pinnedStops ), stops->Length,
-			static_cast<D2D1_GAMMA>( gamma ), static_cast<D2D1_EXTEND_MODE>( extendMode ), &collection );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateGradientStopCollection( reinterpret_cast<D2D1_GRADIENT_STOP*>( pinnedStops ), stops->Length,
+			static_cast<D2D1_GAMMA>( gamma ), static_cast<D2D1_EXTEND_MODE>( extendMode ), &collection ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
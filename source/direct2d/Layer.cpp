@@ -40,7 +40,7 @@ namespace Direct2D
 	{
 		ID2D1Layer *layer = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateLayer( &layer );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateLayer( &layer ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -52,7 +52,7 @@ namespace Direct2D
 	{
 		ID2D1Layer *layer = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateLayer( reinterpret_cast<D2D1_SIZE_F*>( &size ), &layer );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateLayer( reinterpret_cast<D2D1_SIZE_F*>( &size ), &layer ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
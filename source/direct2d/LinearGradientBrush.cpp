@@ -41,8 +41,8 @@ namespace Direct2D
 	{
 		ID2D1LinearGradientBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateLinearGradientBrush( reinterpret_cast<D2D1_LINEAR_GRADIENT_BRUSH_PROPERTIES*>( &linearGradientBrushProperties ), 
-			NULL, gradientStops->InternalPointer, &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateLinearGradientBrush( reinterpret_cast<D2D1_LINEAR_GRADIENT_BRUSH_PROPERTIES*>( &linearGradientBrushProperties ), 
+			NULL, gradientStops->InternalPointer, &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -54,8 +54,8 @@ namespace Direct2D
 	{
 		ID2D1LinearGradientBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateLinearGradientBrush( reinterpret_cast<D2D1_LINEAR_GRADIENT_BRUSH_PROPERTIES*>( &linearGradientBrushProperties ), 
-			reinterpret_cast<D2D1_BRUSH_PROPERTIES*>( &properties ), gradientStops->InternalPointer, &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateLinearGradientBrush( reinterpret_cast<D2D1_LINEAR_GRADIENT_BRUSH_PROPERTIES*>( &linearGradientBrushProperties ), 
+			reinterpret_cast<D2D1_BRUSH_PROPERTIES*>( &properties ), gradientStops->InternalPointer, &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
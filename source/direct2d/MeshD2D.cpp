@@ -40,7 +40,7 @@ namespace Direct2D
 	{
 		ID2D1Mesh *mesh = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateMesh( &mesh );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateMesh( &mesh ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -52,7 +52,7 @@ namespace Direct2D
 	{
 		ID2D1TessellationSink *sink = NULL;
 
-		HRESULT hr = InternalPointer->Open( &sink );
+		HRESULT hr = TIME_CALL( InternalPointer->Open( &sink ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
 
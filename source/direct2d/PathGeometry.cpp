@@ -41,7 +41,7 @@ namespace Direct2D
 	{
 		ID2D1PathGeometry *geometry = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreatePathGeometry( &geometry );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreatePathGeometry( &geometry ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
@@ -68,7 +68,7 @@ namespace Direct2D
 	{
 		ID2D1GeometrySink *sink = NULL;
 
-		HRESULT hr = InternalPointer->Open( &sink );
+		HRESULT hr = TIME_CALL( InternalPointer->Open( &sink ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
 
@@ -77,7 +77,7 @@ namespace Direct2D
 
 	Result PathGeometry::Stream( GeometrySink^ geometrySink )
 	{
-		HRESULT hr = InternalPointer->Stream( geometrySink->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->Stream( geometrySink->InternalPointer ) );
 		return RECORD_D2D( hr );
 	}
 }
@@ -50,7 +50,7 @@ namespace Direct2D
 	{
 		ID2D1RenderTarget *target;
 
-		HRESULT hr = factory->InternalPointer->CreateDxgiSurfaceRenderTarget( surface->InternalPointer, reinterpret_cast<D2D1_RENDER_TARGET_PROPERTIES*>( &properties ), &target );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateDxgiSurfaceRenderTarget( surface->InternalPointer, reinterpret_cast<D2D1_RENDER_TARGET_PROPERTIES*>( &properties ), &target ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
 
@@ -72,7 +72,7 @@ namespace Direct2D
 		pin_ptr<Int64> pt1 = &tag1;
 		pin_ptr<Int64> pt2 = &tag2;
 
-		HRESULT hr = InternalPointer->EndDraw( reinterpret_cast<D2D1_TAG*>( pt1 ), reinterpret_cast<D2D1_TAG*>( pt2 ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EndDraw( reinterpret_cast<D2D1_TAG*>( pt1 ), reinterpret_cast<D2D1_TAG*>( pt2 ) ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -86,7 +86,7 @@ namespace Direct2D
 		pin_ptr<Int64> pt1 = &tag1;
 		pin_ptr<Int64> pt2 = &tag2;
 
-		HRESULT hr = InternalPointer->Flush( reinterpret_cast<D2D1_TAG*>( pt1 ), reinterpret_cast<D2D1_TAG*>( pt2 ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Flush( reinterpret_cast<D2D1_TAG*>( pt1 ), reinterpret_cast<D2D1_TAG*>( pt2 ) ) );
 		return RECORD_D2D( hr );
 	}
 
@@ -107,7 +107,7 @@ namespace Direct2D
 	{
 		ID2D1BitmapRenderTarget *result = NULL;
 
-		HRESULT hr = InternalPointer->CreateCompatibleRenderTarget( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateCompatibleRenderTarget( &result ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
@@ -119,7 +119,7 @@ namespace Direct2D
 	{
 		ID2D1BitmapRenderTarget *result = NULL;
 
-		HRESULT hr = InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), &result ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
@@ -131,7 +131,7 @@ namespace Direct2D
 	{
 		ID2D1BitmapRenderTarget *result = NULL;
 
-		HRESULT hr = InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), D2D1::SizeU( desiredPixelSize.Width, desiredPixelSize.Height ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), D2D1::SizeU( desiredPixelSize.Width, desiredPixelSize.Height ), &result ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
@@ -143,8 +143,8 @@ namespace Direct2D
 	{
 		ID2D1BitmapRenderTarget *result = NULL;
 
-		HRESULT hr = InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), D2D1::SizeU( desiredPixelSize.Width, desiredPixelSize.Height ),
-			D2D1::PixelFormat( static_cast<DXGI_FORMAT>( desiredPixelFormat.Format ), static_cast<D2D1_ALPHA_MODE>( desiredPixelFormat.AlphaMode ) ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), D2D1::SizeU( desiredPixelSize.Width, desiredPixelSize.Height ),
+			D2D1::PixelFormat( static_cast<DXGI_FORMAT>( desiredPixelFormat.Format ), static_cast<D2D1_ALPHA_MODE>( desiredPixelFormat.AlphaMode ) ), &result ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
@@ -156,9 +156,9 @@ namespace Direct2D
 	{
 		ID2D1BitmapRenderTarget *result = NULL;
 
-		HRESULT hr = InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), D2D1::SizeU( desiredPixelSize.Width, desiredPixelSize.Height ),
+		HRESULT hr = TIME_CALL( InternalPointer->CreateCompatibleRenderTarget( D2D1::SizeF( desiredSize.Width, desiredSize.Height ), D2D1::SizeU( desiredPixelSize.Width, desiredPixelSize.Height ),
 			D2D1::PixelFormat( static_cast<DXGI_FORMAT>( desiredPixelFormat.Format ), static_cast<D2D1_ALPHA_MODE>( desiredPixelFormat.AlphaMode ) ), 
-			static_cast<D2D1_COMPATIBLE_RENDER_TARGET_OPTIONS>( options ), &result );
+			static_cast<D2D1_COMPATIBLE_RENDER_TARGET_OPTIONS>( options ), &result ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
@@ -497,7 +497,7 @@ namespace Direct2D
 	{
 		ID2D1Bitmap *bitmap = NULL;
 
-		HRESULT hr = InternalPointer->CreateSharedBitmap( Utilities::ConvertManagedGuid( guid ), data->PositionPointer, NULL, &bitmap );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateSharedBitmap( Utilities::ConvertManagedGuid( guid ), data->PositionPointer, NULL, &bitmap ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			return nullptr;
 
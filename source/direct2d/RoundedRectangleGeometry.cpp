@@ -41,7 +41,7 @@ namespace Direct2D
 	{
 		ID2D1RoundedRectangleGeometry *geometry = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateRoundedRectangleGeometry( reinterpret_cast<D2D1_ROUNDED_RECT*>( &rectangle ), &geometry );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateRoundedRectangleGeometry( reinterpret_cast<D2D1_ROUNDED_RECT*>( &rectangle ), &geometry ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
@@ -41,7 +41,7 @@ namespace Direct2D
 	{
 		ID2D1SolidColorBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateSolidColorBrush( reinterpret_cast<D2D1_COLOR_F*>( &color ),NULL, &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateSolidColorBrush( reinterpret_cast<D2D1_COLOR_F*>( &color ),NULL, &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -53,8 +53,8 @@ namespace Direct2D
 	{
 		ID2D1SolidColorBrush *brush = NULL;
 
-		HRESULT hr = renderTarget->InternalPointer->CreateSolidColorBrush( reinterpret_cast<D2D1_COLOR_F*>( &color ),
-			reinterpret_cast<D2D1_BRUSH_PROPERTIES*>( &properties ), &brush );
+		HRESULT hr = TIME_CALL( renderTarget->InternalPointer->CreateSolidColorBrush( reinterpret_cast<D2D1_COLOR_F*>( &color ),
+			reinterpret_cast<D2D1_BRUSH_PROPERTIES*>( &properties ), &brush ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
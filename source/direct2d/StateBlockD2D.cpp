@@ -42,7 +42,7 @@ namespace Direct2D
 	{
 		ID2D1DrawingStateBlock *stateBlock = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateDrawingStateBlock( &stateBlock );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateDrawingStateBlock( &stateBlock ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -54,7 +54,7 @@ namespace Direct2D
 	{
 		ID2D1DrawingStateBlock *stateBlock = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateDrawingStateBlock( reinterpret_cast<D2D1_DRAWING_STATE_DESCRIPTION*>( &description ), NULL, &stateBlock );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateDrawingStateBlock( reinterpret_cast<D2D1_DRAWING_STATE_DESCRIPTION*>( &description ), NULL, &stateBlock ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -66,8 +66,8 @@ namespace Direct2D
 	{
 		ID2D1DrawingStateBlock *stateBlock = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateDrawingStateBlock( reinterpret_cast<D2D1_DRAWING_STATE_DESCRIPTION*>( &description ),
-			textRenderingParameters->InternalPointer, &stateBlock );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateDrawingStateBlock( reinterpret_cast<D2D1_DRAWING_STATE_DESCRIPTION*>( &description ),
+			textRenderingParameters->InternalPointer, &stateBlock ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
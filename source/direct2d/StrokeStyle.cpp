@@ -40,7 +40,7 @@ namespace Direct2D
 	{
 		ID2D1StrokeStyle *strokeStyle = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateStrokeStyle( D2D1::StrokeStyleProperties(), NULL, 0, &strokeStyle );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateStrokeStyle( D2D1::StrokeStyleProperties(), NULL, 0, &strokeStyle ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -52,8 +52,8 @@ namespace Direct2D
 	{
 		ID2D1StrokeStyle *strokeStyle = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateStrokeStyle( reinterpret_cast<D2D1_STROKE_STYLE_PROPERTIES*>( &properties ), 
-			NULL, 0, &strokeStyle );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateStrokeStyle( reinterpret_cast<D2D1_STROKE_STYLE_PROPERTIES*>( &properties ), 
+			NULL, 0, &strokeStyle ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -66,8 +66,8 @@ namespace Direct2D
 		ID2D1StrokeStyle *strokeStyle = NULL;
 		pin_ptr<float> pinnedDashes = &dashes[0];
 
-		HRESULT hr = factory->InternalPointer->CreateStrokeStyle( reinterpret_cast<D2D1_STROKE_STYLE_PROPERTIES*>( &properties ), 
-			pinnedDashes, dashes->Length, &strokeStyle );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateStrokeStyle( reinterpret_cast<D2D1_STROKE_STYLE_PROPERTIES*>( &properties ), 
+			pinnedDashes, dashes->Length, &strokeStyle ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -41,7 +41,7 @@ namespace Direct2D
 	{
 		ID2D1TransformedGeometry *g = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateTransformedGeometry( geometry->InternalPointer, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &g );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateTransformedGeometry( geometry->InternalPointer, reinterpret_cast<D2D1_MATRIX_3X2_F*>( &transform ), &g ) );
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
 
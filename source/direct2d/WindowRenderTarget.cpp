@@ -54,8 +54,8 @@ namespace Direct2D
 	{
 		ID2D1HwndRenderTarget *renderTarget = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateHwndRenderTarget( reinterpret_cast<D2D1_RENDER_TARGET_PROPERTIES*>( &renderTargetProperties ),
-			reinterpret_cast<D2D1_HWND_RENDER_TARGET_PROPERTIES*>( &windowRenderTargetProperties ), &renderTarget );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateHwndRenderTarget( reinterpret_cast<D2D1_RENDER_TARGET_PROPERTIES*>( &renderTargetProperties ),
+			reinterpret_cast<D2D1_HWND_RENDER_TARGET_PROPERTIES*>( &windowRenderTargetProperties ), &renderTarget ) );
 
 		if( RECORD_D2D( hr ).IsFailure )
 			throw gcnew Direct2DException( Result::Last );
@@ -82,7 +82,7 @@ namespace Direct3D10
 	Device^ Device::FromPointer( ID3D10Device* pointer, ComObject^ owner, ComObjectFlags flags )
 	{
 		void* pointer1;
-		HRESULT hr = pointer->QueryInterface(IID_ID3D10Device1, &pointer1);
+		HRESULT hr = TIME_CALL( pointer->QueryInterface(IID_ID3D10Device1, &pointer1) );
 		if(SUCCEEDED(hr))
 		{
 			pointer->Release();
@@ -96,7 +96,7 @@ namespace Direct3D10
 	{
 		ID3D10Device* origPointer = static_cast<ID3D10Device*>( pointer.ToPointer() );
 		void* pointer1;
-		HRESULT hr = origPointer->QueryInterface(IID_ID3D10Device1, &pointer1);
+		HRESULT hr = TIME_CALL( origPointer->QueryInterface(IID_ID3D10Device1, &pointer1) );
 		if(SUCCEEDED(hr))
 		{
 			origPointer->Release();
@@ -109,8 +109,7 @@ namespace Direct3D10
 	Device::Device( DeviceCreationFlags flags )
 	{
 		ID3D10Device* device = 0;
-		RECORD_D3D10( D3D10CreateDevice( 0, D3D10_DRIVER_TYPE_HARDWARE, 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &device ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( D3D10CreateDevice( 0, D3D10_DRIVER_TYPE_HARDWARE, 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &device ) ).IsFailure )
 			throw gcnew Direct3D10Exception( Result::Last );
 		
 		Construct( device );
@@ -120,8 +119,7 @@ namespace Direct3D10
 	Device::Device( DriverType driverType, DeviceCreationFlags flags )
 	{
 		ID3D10Device* device = 0;
-		RECORD_D3D10( D3D10CreateDevice( 0, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &device ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( D3D10CreateDevice( 0, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &device ) ).IsFailure )
 			throw gcnew Direct3D10Exception( Result::Last );
 		
 		Construct( device );
@@ -132,8 +130,7 @@ namespace Direct3D10
 	{
 		IDXGIAdapter* nativeAdapter = adapter == nullptr ? 0 : adapter->InternalPointer;
 		ID3D10Device* device = 0;
-		RECORD_D3D10( D3D10CreateDevice( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &device ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( D3D10CreateDevice( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &device ) ).IsFailure )
 			throw gcnew Direct3D10Exception( Result::Last );
 		
 		Construct( device );
@@ -147,7 +144,7 @@ namespace Direct3D10
 			return nullptr;
 
 		IDXGIAdapter *adapter = 0;
-		HRESULT hr = device->GetAdapter(&adapter);
+		HRESULT hr = TIME_CALL( device->GetAdapter(&adapter) );
 		if (FAILED(hr))
 			device->Release();
 
@@ -157,13 +154,13 @@ namespace Direct3D10
 		SlimDX::DXGI::Factory^ result = nullptr;
 
 		IDXGIFactory1 *factory1;
-		hr = adapter->GetParent(IID_IDXGIFactory1, reinterpret_cast<void**>(&factory1));
+		hr = TIME_CALL( adapter->GetParent(IID_IDXGIFactory1, reinterpret_cast<void**>(&factory1)) );
 		if (SUCCEEDED(hr))
 			result = SlimDX::DXGI::Factory1::FromPointer(factory1, this);
 		else
 		{
 			IDXGIFactory *factory;
-			hr = adapter->GetParent(IID_IDXGIFactory, reinterpret_cast<void**>(&factory));
+			hr = TIME_CALL( adapter->GetParent(IID_IDXGIFactory, reinterpret_cast<void**>(&factory)) );
 			if (SUCCEEDED(hr))
 				result = SlimDX::DXGI::Factory::FromPointer(factory, this);
 		}
@@ -294,7 +291,7 @@ namespace Direct3D10
 		GUID guid = Utilities::GetNativeGuidForType( T::typeid );
 		ID3D10Resource* resultPointer;
 
-		HRESULT hr = InternalPointer->OpenSharedResource( handle.ToPointer(), guid, (void**)&resultPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->OpenSharedResource( handle.ToPointer(), guid, (void**)&resultPointer ) );
 		if( RECORD_D3D10( hr ).IsFailure )
 			return T();
 
@@ -416,7 +413,8 @@ namespace Direct3D10
 		IDXGISwapChain* resultSwapChain = 0;
 		DXGI_SWAP_CHAIN_DESC nativeDescription = swapChainDescription.CreateNativeVersion();
 		
-		if( RECORD_D3D10( D3D10CreateDeviceAndSwapChain( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &nativeDescription, &resultSwapChain, &resultDevice ) ).IsSuccess )
+		Result result = RECORD_D3D10( D3D10CreateDeviceAndSwapChain( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), D3D10_SDK_VERSION, &nativeDescription, &resultSwapChain, &resultDevice ) );
+		if( result.IsSuccess )
 		{
 			device = FromPointer( resultDevice );
 			swapChain = DXGI::SwapChain::FromPointer( resultSwapChain );
@@ -426,7 +424,7 @@ namespace Direct3D10
 			swapChain = nullptr;
 		}
 		
-		return Result::Last;
+		return result;
 	}
 }
 }
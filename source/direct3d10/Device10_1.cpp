@@ -58,9 +58,8 @@ namespace Direct3D10_1
 	Device1::Device1( DeviceCreationFlags flags, SlimDX::Direct3D10_1::FeatureLevel hardwareLevel )
 	{
 		ID3D10Device1* device = 0;
-		RECORD_D3D10( D3D10CreateDevice1( 0, D3D10_DRIVER_TYPE_HARDWARE, 0, static_cast<UINT>( flags ),
-			static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION, &device ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( D3D10CreateDevice1( 0, D3D10_DRIVER_TYPE_HARDWARE, 0, static_cast<UINT>( flags ),
+			static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION, &device ) ).IsFailure )
 			throw gcnew Direct3D10Exception( Result::Last );
 		
 		Construct( device );
@@ -70,9 +69,8 @@ namespace Direct3D10_1
 	Device1::Device1( SlimDX::Direct3D10::DriverType driverType, DeviceCreationFlags flags, SlimDX::Direct3D10_1::FeatureLevel hardwareLevel )
 	{
 		ID3D10Device1* device = 0;
-		RECORD_D3D10( D3D10CreateDevice1( 0, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ),
-			static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION, &device ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( D3D10CreateDevice1( 0, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ),
+			static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION, &device ) ).IsFailure )
 			throw gcnew Direct3D10Exception( Result::Last );
 		
 		Construct( device );
@@ -83,9 +81,8 @@ namespace Direct3D10_1
 	{
 		IDXGIAdapter* nativeAdapter = adapter == nullptr ? 0 : adapter->InternalPointer;
 		ID3D10Device1* device = 0;
-		RECORD_D3D10( D3D10CreateDevice1( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0,
-			static_cast<UINT>( flags ), static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION, &device ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( D3D10CreateDevice1( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ), 0,
+			static_cast<UINT>( flags ), static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION, &device ) ).IsFailure )
 			throw gcnew Direct3D10Exception( Result::Last );
 		
 		Construct( device );
@@ -104,9 +101,10 @@ namespace Direct3D10_1
 		IDXGISwapChain* resultSwapChain = 0;
 		DXGI_SWAP_CHAIN_DESC nativeDescription = swapChainDescription.CreateNativeVersion();
 		
-		if( RECORD_D3D10( D3D10CreateDeviceAndSwapChain1( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ),
+		Result result = RECORD_D3D10( D3D10CreateDeviceAndSwapChain1( nativeAdapter, static_cast<D3D10_DRIVER_TYPE>( driverType ),
 			0, static_cast<UINT>( flags ), static_cast<D3D10_FEATURE_LEVEL1>( hardwareLevel ), D3D10_1_SDK_VERSION,
-			&nativeDescription, &resultSwapChain, &resultDevice ) ).IsSuccess )
+			&nativeDescription, &resultSwapChain, &resultDevice ) );
+		if( result.IsSuccess )
 		{
 			device = FromPointer( resultDevice );
 			swapChain = DXGI::SwapChain::FromPointer( resultSwapChain );
@@ -117,7 +115,7 @@ namespace Direct3D10_1
 			swapChain = nullptr;
 		}
 		
-		return Result::Last;
+		return result;
 	}
 }
 }
\ No newline at end of file
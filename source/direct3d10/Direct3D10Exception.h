@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_D3D10(x) Result::Record<Direct3D10Exception^>( (x), (nullptr), (nullptr) )
+#define RECORD_D3D10(x) RECORD_RESULT( Direct3D10Exception^, x )
 
 namespace SlimDX
 {
@@ -63,9 +63,9 @@ namespace Direct3D10
 		ID3D10EffectPool* effectPool;
 		ID3D10Blob* errorBlob;
 
-		HRESULT hr = D3DX10CreateEffectPoolFromFile( pinnedFileName, NULL, NULL, reinterpret_cast<LPCSTR>( pinnedProfile ),
+		HRESULT hr = TIME_CALL( D3DX10CreateEffectPoolFromFile( pinnedFileName, NULL, NULL, reinterpret_cast<LPCSTR>( pinnedProfile ),
 			static_cast<UINT>(shaderFlags), static_cast<UINT>(effectFlags ), device->InternalPointer,
-			NULL, &effectPool, &errorBlob, NULL );
+			NULL, &effectPool, &errorBlob, NULL ) );
 
 		if( errorBlob != 0 )
 		{
@@ -118,9 +118,9 @@ namespace Direct3D10
 		array<unsigned char>^ profileBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( profile );
 		pin_ptr<unsigned char> pinnedProfile = &profileBytes[0];
 
-		HRESULT hr = D3DX10CreateEffectPoolFromMemory( data, size, "<no file name>", NULL, NULL,
+		HRESULT hr = TIME_CALL( D3DX10CreateEffectPoolFromMemory( data, size, "<no file name>", NULL, NULL,
 			reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<UINT>(shaderFlags), static_cast< UINT>(effectFlags ), device->InternalPointer,
-			NULL, &effectPool, &errorBlob, NULL );
+			NULL, &effectPool, &errorBlob, NULL ) );
 
 		if( errorBlob != 0 )
 		{
@@ -65,14 +65,14 @@ namespace Direct3D10
 		Utilities::CheckArrayBounds(views, offset, count);
 
 		stack_array<ID3D10ShaderResourceView*> nativeViews = stackalloc(ID3D10ShaderResourceView*, count);
-		HRESULT hr = m_Pointer->GetResourceArray(&nativeViews[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetResourceArray(&nativeViews[0], 0, count) );
 		if (RECORD_D3D10(hr).IsFailure)
 			return Result::Last;
 
 		for (int i = 0; i < count; i++)
 			views[i + offset] = ShaderResourceView::FromPointer(nativeViews[i]);
 
-		return Result::Last;
+		return Result(hr);
 	}
 	
 	Result EffectResourceVariable::SetResource( ShaderResourceView^ view )
@@ -96,7 +96,7 @@ namespace Direct3D10
 		for (int i = 0; i < count; i++)
 			nativeViews[i] = views[i + offset] != nullptr ? views[i + offset]->InternalPointer : 0;
 
-		HRESULT hr = m_Pointer->SetResourceArray(&nativeViews[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->SetResourceArray(&nativeViews[0], 0, count) );
 		return RECORD_D3D10(hr);
 	}
 }
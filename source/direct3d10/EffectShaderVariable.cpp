@@ -80,28 +80,31 @@ namespace Direct3D10
 	Result EffectShaderVariable::GetInputParameterDescription( int shaderIndex, int parameterIndex, ShaderParameterDescription% result )
 	{
 		D3D10_SIGNATURE_PARAMETER_DESC description;
-		if( RECORD_D3D10( m_Pointer->GetInputSignatureElementDesc( shaderIndex, parameterIndex, &description ) ).IsSuccess )
+		Result status = RECORD_D3D10( m_Pointer->GetInputSignatureElementDesc( shaderIndex, parameterIndex, &description ) );
+		if( status.IsSuccess )
 			result = ShaderParameterDescription( description );
 			
-		return Result::Last;
+		return status;
 	}
 	
 	Result EffectShaderVariable::GetOutputParameterDescription( int shaderIndex, int parameterIndex, ShaderParameterDescription% result )
 	{
 		D3D10_SIGNATURE_PARAMETER_DESC description;
-		if( RECORD_D3D10( m_Pointer->GetOutputSignatureElementDesc( shaderIndex, parameterIndex, &description ) ).IsSuccess )
+		Result status = RECORD_D3D10( m_Pointer->GetOutputSignatureElementDesc( shaderIndex, parameterIndex, &description ) );
+		if( status.IsSuccess )
 			result = ShaderParameterDescription( description );
 		
-		return Result::Last;
+		return status;
 	}
 	
 	Result EffectShaderVariable::GetShaderDescription( int shaderIndex, ShaderDescription% result )
 	{
 		D3D10_EFFECT_SHADER_DESC description;
-		if( RECORD_D3D10( m_Pointer->GetShaderDesc( shaderIndex, &description ) ).IsSuccess )
+		Result status = RECORD_D3D10( m_Pointer->GetShaderDesc( shaderIndex, &description ) );
+		if( status.IsSuccess )
 			result = ShaderDescription( description );
 	
-		return Result::Last;
+		return status;
 	}
 }
 }
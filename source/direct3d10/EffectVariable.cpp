@@ -195,7 +195,7 @@ namespace Direct3D10
 
 	Result EffectVariable::SetRawValue(DataStream^ data, int count)
 	{
-		HRESULT hr = m_Pointer->SetRawValue(data->PositionPointer, 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->SetRawValue(data->PositionPointer, 0, count) );
 		return RECORD_D3D10(hr);
 	}
 
@@ -203,7 +203,7 @@ namespace Direct3D10
 	{
 		stack_array<char> data = stackalloc(char, count);
 
-		HRESULT hr = m_Pointer->GetRawValue(&data[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetRawValue(&data[0], 0, count) );
 		if (RECORD_D3D10(hr).IsFailure)
 			return nullptr;
 
@@ -60,6 +60,11 @@ namespace Direct3D10
 		Init( device, shaderBytecode->InternalPointer->GetBufferPointer(), static_cast<int>( shaderBytecode->InternalPointer->GetBufferSize() ), elements );
 	}
 
+	InputLayout::InputLayout( SlimDX::Direct3D10::Device^ device, const void* shader, int length, array<InputElement>^ elements )
+	{
+		Init( device, shader, length, elements );
+	}
+
 	void InputLayout::Init( SlimDX::Direct3D10::Device^ device, const void* shader, int length, array<InputElement>^ elements )
 	{
 		if( device == nullptr )
@@ -72,7 +77,7 @@ namespace Direct3D10
 			nativeElements[i] = elements[i].CreateNativeVersion();
 			
 		ID3D10InputLayout* layout = 0;
-		HRESULT hr = device->InternalPointer->CreateInputLayout( nativeElements, elements->Length, shader, length, &layout );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateInputLayout( nativeElements, elements->Length, shader, length, &layout ) );
 
 		for( int i = 0; i < elements->Length; i++ )
 			Utilities::FreeNativeString( nativeElements[i].SemanticName );
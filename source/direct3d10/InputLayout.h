@@ -43,6 +43,9 @@ namespace SlimDX
 
 		private:
 			void Init( SlimDX::Direct3D10::Device^ device, const void *shader, int length, array<InputElement>^ elements );
+
+		internal:
+			InputLayout( SlimDX::Direct3D10::Device^ device, const void *shader, int length, array<InputElement>^ elements );
 		
 		public:
 			[System::Obsolete("Use the constructor overload taking a ShaderSignature as the second argument instead.")]
@@ -0,0 +1,148 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../ObjectTable.h"
+#include "../d3dcompiler/ShaderSignatureDC.h"
+#include "../d3dcompiler/ShaderBytecodeDC.h"
+
+#include "InputElement.h"
+#include "InputLayout.h"
+
+namespace SlimDX
+{
+	namespace Direct3D10
+	{
+		ref class Device;
+
+		/// <summary>
+		/// Shares <see cref="InputLayout"/> objects between meshes and shaders that use the same vertex format.
+		/// </summary>
+		/// <remarks>
+		/// Layouts are keyed by their input elements together with the input signature of the shader they are
+		/// validated against, so shaders with identical input signatures share layouts. Each call to <c>Acquire</c>
+		/// must be balanced with a call to <see cref="Release"/>; the layout is disposed when its last reference is
+		/// released. Layouts disposed directly are removed from the cache as they leave the <see cref="ObjectTable"/>.
+		///
+		/// The cache does not keep itself alive through its <see cref="ObjectTable"/> subscription, but a cache that is
+		/// collected without being disposed leaves its layouts in the table, where they are reported as leaks. Dispose
+		/// the cache once it is no longer needed.
+		/// </remarks>
+		public ref class InputLayoutCache sealed
+		{
+		private:
+			ref class Entry
+			{
+			public:
+				InputLayout^ Layout;
+				array<InputElement>^ Elements;
+				array<System::Byte>^ Signature;
+				int HashCode;
+				int References;
+			};
+
+			SlimDX::Direct3D10::Device^ m_Device;
+			System::Collections::Generic::Dictionary<int, System::Collections::Generic::List<Entry^>^>^ m_Entries;
+			System::Collections::Generic::Dictionary<System::IntPtr, Entry^>^ m_Layouts;
+			WeakObjectRemovedSubscription<InputLayoutCache>^ m_Subscription;
+			System::Object^ m_SyncObject;
+			int m_Hits;
+			int m_Misses;
+
+			InputLayout^ Acquire( const void* shader, int length, array<InputElement>^ elements );
+			Entry^ Find( int hashCode, const unsigned char* signature, int length, array<InputElement>^ elements );
+			void Remove( Entry^ entry );
+
+		internal:
+			void OnObjectRemoved( System::Object^ sender, ObjectTableEventArgs^ e );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="InputLayoutCache"/> class.
+			/// </summary>
+			/// <param name="device">The device used to create layouts.</param>
+			InputLayoutCache( SlimDX::Direct3D10::Device^ device );
+
+			/// <summary>
+			/// Disposes every layout held by the cache.
+			/// </summary>
+			~InputLayoutCache();
+
+			/// <summary>
+			/// Stops listening for layouts leaving the <see cref="ObjectTable"/>. Layouts still held are not disposed.
+			/// </summary>
+			!InputLayoutCache();
+
+			/// <summary>
+			/// Gets a shared layout for the specified input elements, creating it if necessary.
+			/// </summary>
+			/// <param name="shaderSignature">The shader signature used to validate the input elements.</param>
+			/// <param name="elements">An array of input elements describing the layout of the input data.</param>
+			/// <returns>The shared layout.</returns>
+			InputLayout^ Acquire( D3DCompiler::ShaderSignature^ shaderSignature, array<InputElement>^ elements );
+
+			/// <summary>
+			/// Gets a shared layout for the specified input elements, creating it if necessary.
+			/// </summary>
+			/// <param name="shaderBytecode">The compiled shader used to validate the input elements.</param>
+			/// <param name="elements">An array of input elements describing the layout of the input data.</param>
+			/// <returns>The shared layout.</returns>
+			InputLayout^ Acquire( D3DCompiler::ShaderBytecode^ shaderBytecode, array<InputElement>^ elements );
+
+			/// <summary>
+			/// Releases a reference to a layout returned by <c>Acquire</c>, disposing it when no references remain.
+			/// </summary>
+			/// <param name="layout">The layout to release.</param>
+			/// <returns><c>true</c> if the layout was held by the cache; otherwise, <c>false</c>.</returns>
+			bool Release( InputLayout^ layout );
+
+			/// <summary>
+			/// Disposes every layout held by the cache, regardless of outstanding references.
+			/// </summary>
+			void Clear();
+
+			/// <summary>
+			/// Gets the number of distinct layouts held by the cache.
+			/// </summary>
+			property int Count
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of requests that were satisfied by an existing layout.
+			/// </summary>
+			property int HitCount
+			{
+				int get() { return m_Hits; }
+			}
+
+			/// <summary>
+			/// Gets the number of requests that required a new layout to be created.
+			/// </summary>
+			property int MissCount
+			{
+				int get() { return m_Misses; }
+			}
+		};
+	}
+};
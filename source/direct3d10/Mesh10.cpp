@@ -24,6 +24,7 @@
 #include <vcclr.h>
 
 #include "../stack_array.h"
+#include "../MeshOptimizer.h"
 
 #include "Direct3D10Exception.h"
 
@@ -127,6 +128,34 @@ namespace Direct3D10
 		return RECORD_D3D10( InternalPointer->DrawSubsetInstanced( id, count, startLocation ) );
 	}
 	
+	VertexCacheStatistics Mesh::AnalyzeVertexCache( int cacheSize )
+	{
+		MeshBuffer^ buffer = GetIndexBuffer();
+		if( buffer == nullptr )
+			return VertexCacheStatistics();
+
+		try
+		{
+			DataStream^ indices = buffer->Map();
+			if( indices == nullptr )
+				return VertexCacheStatistics();
+
+			try
+			{
+				bool use32BitIndices = ( Flags & MeshFlags::Has32BitIndices ) == MeshFlags::Has32BitIndices;
+				return MeshOptimizer::AnalyzeVertexCache( indices, FaceCount * 3, use32BitIndices, VertexCount, cacheSize );
+			}
+			finally
+			{
+				buffer->Unmap();
+			}
+		}
+		finally
+		{
+			delete buffer;
+		}
+	}
+
 	MeshBuffer^ Mesh::GetIndexBuffer()
 	{
 		ID3DX10MeshBuffer* buffer = 0;
@@ -236,8 +265,7 @@ namespace Direct3D10
 	
 	Result Mesh::Optimize( MeshOptimizeFlags flags )
 	{
-		RECORD_D3D10( InternalPointer->Optimize( static_cast<UINT>( flags ), 0, 0 ) );
-		return Result::Last;
+		return RECORD_D3D10( InternalPointer->Optimize( static_cast<UINT>( flags ), 0, 0 ) );
 	}
 	
 	Result Mesh::Optimize( MeshOptimizeFlags flags, [Out] array<int>^% faceRemap, [Out] array<int>^% vertexRemap )
@@ -245,7 +273,8 @@ namespace Direct3D10
 		stack_array<UINT> nativeFaceRemap = stackalloc( UINT, FaceCount );
 		ID3D10Blob* nativeVertexRemap = 0;
 		
-		if( RECORD_D3D10( InternalPointer->Optimize( static_cast<UINT>( flags ), &nativeFaceRemap[0], &nativeVertexRemap ) ).IsFailure )
+		Result result = RECORD_D3D10( InternalPointer->Optimize( static_cast<UINT>( flags ), &nativeFaceRemap[0], &nativeVertexRemap ) );
+		if( result.IsFailure )
 		{
 			faceRemap = nullptr;
 			vertexRemap = nullptr;
@@ -265,7 +294,7 @@ namespace Direct3D10
 			nativeVertexRemap->Release();
 		}
 		
-		return Result::Last;
+		return result;
 	}
 }
 }
@@ -22,6 +22,7 @@
 #pragma once
 
 #include "../ComObject.h"
+#include "../VertexCacheStatistics.h"
 
 #include "Enums.h"
 
@@ -98,6 +99,13 @@ namespace SlimDX
 			/// <returns>A result code.</returns>
 			Result Optimize( MeshOptimizeFlags flags, [Out] array<int>^% faceRemap, [Out] array<int>^% vertexRemap );
 			
+			/// <summary>
+			/// Measures how the mesh's index data performs with a post transform vertex cache, without using D3DX.
+			/// </summary>
+			/// <param name="cacheSize">The number of entries in the simulated first-in first-out cache.</param>
+			/// <returns>The measured cache statistics.</returns>
+			VertexCacheStatistics AnalyzeVertexCache( int cacheSize );
+
 			Result DrawSubset( int id );
 			Result DrawSubsetInstanced( int id, int count, int startLocation );
 			
@@ -49,7 +49,7 @@ namespace Direct3D10
 	{
 		IDXGISurface* unknown = 0;
 		GUID guid = Utilities::GetNativeGuidForType( SlimDX::DXGI::Surface::typeid );
-		HRESULT hr = InternalPointer->QueryInterface(guid, reinterpret_cast<void**>(&unknown));
+		HRESULT hr = TIME_CALL( InternalPointer->QueryInterface(guid, reinterpret_cast<void**>(&unknown)) );
 		if(RECORD_D3D10(hr).IsFailure)
 			return nullptr;
 
@@ -62,8 +62,7 @@ namespace Direct3D10
 	{
 		IUnknown* unknown = 0;
 		GUID guid = Utilities::GetNativeGuidForType( T::typeid );
-		RECORD_D3D10( swapChain->InternalPointer->GetBuffer( index, guid, reinterpret_cast<void**>( &unknown ) ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D10( swapChain->InternalPointer->GetBuffer( index, guid, reinterpret_cast<void**>( &unknown ) ) ).IsFailure )
 			return T();
 
 		BindingFlags flags = BindingFlags::Static | BindingFlags::InvokeMethod | BindingFlags::NonPublic;
@@ -88,7 +87,7 @@ namespace Direct3D10
 
 		void* result = 0;
 		IUnknown* unknown = static_cast<IUnknown*>( pointer.ToPointer() );
-		HRESULT hr = unknown->QueryInterface(IID_ID3D10Resource, &result);
+		HRESULT hr = TIME_CALL( unknown->QueryInterface(IID_ID3D10Resource, &result) );
 		if( FAILED( hr ) )
 			throw gcnew InvalidCastException( "Failed to QueryInterface on user-supplied pointer." );
 
@@ -173,13 +172,13 @@ namespace Direct3D10
 
 	Result Resource::LoadTextureFromTexture(Resource^ source, Resource^ destination, TextureLoadInformation loadInformation)
 	{
-		HRESULT hr = D3DX10LoadTextureFromTexture(source->InternalPointer, reinterpret_cast<D3DX10_TEXTURE_LOAD_INFO*>(&loadInformation), destination->InternalPointer);
+		HRESULT hr = TIME_CALL( D3DX10LoadTextureFromTexture(source->InternalPointer, reinterpret_cast<D3DX10_TEXTURE_LOAD_INFO*>(&loadInformation), destination->InternalPointer) );
 		return RECORD_D3D10(hr);
 	}
 
 	Result Resource::FilterTexture(Resource^ texture, int sourceLevel, FilterFlags mipFilter)
 	{
-		HRESULT hr = D3DX10FilterTexture(texture->InternalPointer, sourceLevel, static_cast<UINT>(mipFilter));
+		HRESULT hr = TIME_CALL( D3DX10FilterTexture(texture->InternalPointer, sourceLevel, static_cast<UINT>(mipFilter)) );
 		return RECORD_D3D10(hr);
 	}
 
@@ -205,7 +204,7 @@ namespace Direct3D10
 	{	
 		ID3D10Resource* resource = 0;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
-		HRESULT hr = D3DX10CreateTextureFromFile( device->InternalPointer, pinnedName, info, 0, &resource, 0 );
+		HRESULT hr = TIME_CALL( D3DX10CreateTextureFromFile( device->InternalPointer, pinnedName, info, 0, &resource, 0 ) );
 		RECORD_D3D10( hr );
 		
 		return resource;
@@ -216,7 +215,7 @@ namespace Direct3D10
 		pin_ptr<unsigned char> pinnedMemory = &memory[0];
 		
 		ID3D10Resource* resource = 0;
-		HRESULT hr = D3DX10CreateTextureFromMemory( device->InternalPointer, pinnedMemory, memory->Length, info, 0, &resource, 0 ); 
+		HRESULT hr = TIME_CALL( D3DX10CreateTextureFromMemory( device->InternalPointer, pinnedMemory, memory->Length, info, 0, &resource, 0 ) ); 
 		RECORD_D3D10( hr );
 		
 		return resource;
@@ -231,8 +230,8 @@ namespace Direct3D10
 		{
 			ID3D10Resource* resource = NULL;
 			SIZE_T size = static_cast<SIZE_T>( ds->RemainingLength );
-			HRESULT hr = D3DX10CreateTextureFromMemory( device->InternalPointer, ds->SeekToEnd(), size,
-				info, NULL, &resource, NULL );
+			HRESULT hr = TIME_CALL( D3DX10CreateTextureFromMemory( device->InternalPointer, ds->SeekToEnd(), size,
+				info, NULL, &resource, NULL ) );
 			RECORD_D3D10( hr );
 
 			return resource;
@@ -138,7 +138,7 @@ namespace Direct3D10
 	{
 		ID3D10ShaderResourceView* resource = 0;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
-		HRESULT hr = D3DX10CreateShaderResourceViewFromFile( device->InternalPointer, pinnedName, loadInformation, 0, &resource, 0 );
+		HRESULT hr = TIME_CALL( D3DX10CreateShaderResourceViewFromFile( device->InternalPointer, pinnedName, loadInformation, 0, &resource, 0 ) );
 		RECORD_D3D10( hr );
 		
 		return resource;
@@ -149,7 +149,7 @@ namespace Direct3D10
 		ID3D10ShaderResourceView* resource = 0;
 		pin_ptr<unsigned char> pinnedMemory = &memory[0];
 
-		HRESULT hr = D3DX10CreateShaderResourceViewFromMemory( device->InternalPointer, pinnedMemory, memory->Length, loadInformation, 0, &resource, 0 );
+		HRESULT hr = TIME_CALL( D3DX10CreateShaderResourceViewFromMemory( device->InternalPointer, pinnedMemory, memory->Length, loadInformation, 0, &resource, 0 ) );
 		RECORD_D3D10( hr );
 		
 		return resource;
@@ -165,7 +165,7 @@ namespace Direct3D10
 			ID3D10ShaderResourceView* resource = NULL;
 			SIZE_T size = static_cast<SIZE_T>( ds->RemainingLength );
 
-			HRESULT hr = D3DX10CreateShaderResourceViewFromMemory( device->InternalPointer, ds->SeekToEnd(), size, info, NULL, &resource, NULL );
+			HRESULT hr = TIME_CALL( D3DX10CreateShaderResourceViewFromMemory( device->InternalPointer, ds->SeekToEnd(), size, info, NULL, &resource, NULL ) );
 			RECORD_D3D10( hr );
 
 			return resource;
@@ -0,0 +1,241 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+#include <d3d10.h>
+#include <d3dx10.h>
+#include <algorithm>
+
+#include "../DataStream.h"
+
+#include "Direct3D10Exception.h"
+
+#include "Sprite10.h"
+#include "SpriteBatch.h"
+
+using namespace System;
+using namespace System::IO;
+
+namespace SlimDX
+{
+namespace Direct3D10
+{
+	static bool CompareTexture( const D3DX10_SPRITE& left, const D3DX10_SPRITE& right )
+	{
+		return left.pTexture < right.pTexture;
+	}
+
+	// The instance buffer holds raw texture pointers, so each one keeps a reference until it has been drawn or cleared.
+	static void AddRefTextures( const D3DX10_SPRITE* instances, int count )
+	{
+		for( int i = 0; i < count; ++i )
+		{
+			if( instances[i].pTexture != NULL )
+				instances[i].pTexture->AddRef();
+		}
+	}
+
+	static void ReleaseTextures( D3DX10_SPRITE* instances, int count )
+	{
+		for( int i = 0; i < count; ++i )
+		{
+			if( instances[i].pTexture != NULL )
+			{
+				instances[i].pTexture->Release();
+				instances[i].pTexture = NULL;
+			}
+		}
+	}
+
+	SpriteBatch::SpriteBatch( Sprite^ sprite )
+	{
+		if( sprite == nullptr )
+			throw gcnew ArgumentNullException( "sprite" );
+
+		m_Sprite = sprite;
+		m_MaximumBatchSize = DefaultMaximumBatchSize;
+	}
+
+	SpriteBatch::SpriteBatch( Sprite^ sprite, int capacity )
+	{
+		if( sprite == nullptr )
+			throw gcnew ArgumentNullException( "sprite" );
+		if( capacity < 0 )
+			throw gcnew ArgumentOutOfRangeException( "capacity" );
+
+		m_Sprite = sprite;
+		m_MaximumBatchSize = DefaultMaximumBatchSize;
+
+		if( capacity > 0 )
+		{
+			m_Instances = new D3DX10_SPRITE[capacity];
+			m_Capacity = capacity;
+		}
+	}
+
+	SpriteBatch::~SpriteBatch()
+	{
+		Destruct();
+	}
+
+	SpriteBatch::!SpriteBatch()
+	{
+		Destruct();
+	}
+
+	void SpriteBatch::Destruct()
+	{
+		ReleaseTextures( m_Instances, m_Count );
+		delete[] m_Instances;
+		m_Instances = 0;
+		m_Count = 0;
+		m_Capacity = 0;
+	}
+
+	D3DX10_SPRITE* SpriteBatch::Reserve( int count )
+	{
+		int required = m_Count + count;
+		if( required > m_Capacity )
+		{
+			int capacity = m_Capacity < 64 ? 64 : m_Capacity;
+			while( capacity < required )
+				capacity *= 2;
+
+			D3DX10_SPRITE* instances = new D3DX10_SPRITE[capacity];
+			if( m_Count > 0 )
+				memcpy( instances, m_Instances, m_Count * sizeof(D3DX10_SPRITE) );
+
+			delete[] m_Instances;
+			m_Instances = instances;
+			m_Capacity = capacity;
+		}
+
+		D3DX10_SPRITE* result = m_Instances + m_Count;
+		m_Count = required;
+		return result;
+	}
+
+	void SpriteBatch::Add( SpriteData sprite )
+	{
+		D3DX10_SPRITE* instance = Reserve( 1 );
+		sprite.ToNativeObject( *instance );
+		AddRefTextures( instance, 1 );
+	}
+
+	void SpriteBatch::Add( array<SpriteData>^ sprites )
+	{
+		Add( sprites, 0, 0 );
+	}
+
+	void SpriteBatch::Add( array<SpriteData>^ sprites, int startIndex, int count )
+	{
+		if( sprites == nullptr )
+			throw gcnew ArgumentNullException( "sprites" );
+
+		Utilities::CheckArrayBounds( sprites, startIndex, count );
+
+		D3DX10_SPRITE* instances = Reserve( count );
+		for( int i = 0; i < count; ++i )
+			sprites[startIndex + i].ToNativeObject( instances[i] );
+
+		AddRefTextures( instances, count );
+	}
+
+	void SpriteBatch::Add( DataStream^ instances, int count )
+	{
+		if( instances == nullptr )
+			throw gcnew ArgumentNullException( "instances" );
+		if( count < 0 )
+			throw gcnew ArgumentOutOfRangeException( "count" );
+
+		Int64 size = static_cast<Int64>( count ) * sizeof(D3DX10_SPRITE);
+		if( size > instances->RemainingLength )
+			throw gcnew EndOfStreamException();
+
+		D3DX10_SPRITE* destination = Reserve( count );
+		memcpy( destination, instances->PositionPointer, static_cast<size_t>( size ) );
+		AddRefTextures( destination, count );
+		instances->Position += size;
+	}
+
+	Result SpriteBatch::Flush()
+	{
+		int count = m_Count;
+		m_Count = 0;
+
+		m_LastSpriteCount = count;
+		m_LastBatchCount = 0;
+		m_LastDrawCallCount = 0;
+
+		if( m_SortByTexture )
+			std::stable_sort( m_Instances, m_Instances + count, CompareTexture );
+
+		ID3DX10Sprite* sprite = m_Sprite->InternalPointer;
+		HRESULT hr = S_OK;
+
+		int start = 0;
+		while( start < count )
+		{
+			ID3D10ShaderResourceView* texture = m_Instances[start].pTexture;
+
+			int end = start + 1;
+			while( end < count && m_Instances[end].pTexture == texture )
+				++end;
+
+			++m_LastBatchCount;
+
+			for( ; start < end && SUCCEEDED( hr ); start += m_MaximumBatchSize )
+			{
+				int length = end - start < m_MaximumBatchSize ? end - start : m_MaximumBatchSize;
+				hr = TIME_CALL( sprite->DrawSpritesImmediate( m_Instances + start, length, sizeof(D3DX10_SPRITE), 0 ) );
+				++m_LastDrawCallCount;
+			}
+
+			if( FAILED( hr ) )
+				break;
+
+			start = end;
+		}
+
+		// sprites left undrawn by a failure are dropped along with the rest
+		ReleaseTextures( m_Instances, count );
+
+		m_TotalSpriteCount += count;
+		m_TotalDrawCallCount += m_LastDrawCallCount;
+
+		return RECORD_D3D10( hr );
+	}
+
+	void SpriteBatch::Clear()
+	{
+		ReleaseTextures( m_Instances, m_Count );
+		m_Count = 0;
+	}
+
+	void SpriteBatch::MaximumBatchSize::set( int value )
+	{
+		if( value <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "value" );
+
+		m_MaximumBatchSize = value;
+	}
+}
+}
@@ -0,0 +1,211 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "SpriteData.h"
+
+namespace SlimDX
+{
+	ref class DataStream;
+
+	namespace Direct3D10
+	{
+		ref class Sprite;
+
+		/// <summary>
+		/// Collects sprites into a persistent native instance buffer and draws them grouped by texture.
+		/// </summary>
+		/// <remarks>
+		/// Sprites are converted to their native representation as they are added, and the instance buffer
+		/// is kept across calls to <see cref="Flush"/>, so steady-state drawing does not allocate. Flush must be
+		/// called between <see cref="Sprite"/>.Begin and <see cref="Sprite"/>.End.
+		///
+		/// The batch holds a reference to the texture of every sprite it contains until the sprite is drawn or cleared,
+		/// so textures can be disposed as soon as their sprites have been added.
+		/// </remarks>
+		public ref class SpriteBatch sealed
+		{
+		private:
+			Sprite^ m_Sprite;
+			D3DX10_SPRITE* m_Instances;
+			int m_Count;
+			int m_Capacity;
+			bool m_SortByTexture;
+			int m_MaximumBatchSize;
+
+			int m_LastSpriteCount;
+			int m_LastBatchCount;
+			int m_LastDrawCallCount;
+			System::Int64 m_TotalSpriteCount;
+			System::Int64 m_TotalDrawCallCount;
+
+			D3DX10_SPRITE* Reserve( int count );
+			void Destruct();
+
+		public:
+			/// <summary>
+			/// The default value of <see cref="MaximumBatchSize"/>, which matches the largest buffer a <see cref="Sprite"/> can be created with.
+			/// </summary>
+			literal int DefaultMaximumBatchSize = 4096;
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="SpriteBatch"/> class.
+			/// </summary>
+			/// <param name="sprite">The sprite object used to draw the batch.</param>
+			SpriteBatch( Sprite^ sprite );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="SpriteBatch"/> class.
+			/// </summary>
+			/// <param name="sprite">The sprite object used to draw the batch.</param>
+			/// <param name="capacity">The number of sprites the instance buffer initially holds.</param>
+			SpriteBatch( Sprite^ sprite, int capacity );
+
+			/// <summary>
+			/// Releases the native instance buffer.
+			/// </summary>
+			~SpriteBatch();
+
+			/// <summary>
+			/// Releases the native instance buffer.
+			/// </summary>
+			!SpriteBatch();
+
+			/// <summary>
+			/// Adds a sprite to the batch.
+			/// </summary>
+			/// <param name="sprite">The sprite to add.</param>
+			void Add( SpriteData sprite );
+
+			/// <summary>
+			/// Adds an array of sprites to the batch.
+			/// </summary>
+			/// <param name="sprites">The sprites to add.</param>
+			void Add( array<SpriteData>^ sprites );
+
+			/// <summary>
+			/// Adds a range of an array of sprites to the batch.
+			/// </summary>
+			/// <param name="sprites">The sprites to add.</param>
+			/// <param name="startIndex">The index of the first sprite to add.</param>
+			/// <param name="count">The number of sprites to add.</param>
+			void Add( array<SpriteData>^ sprites, int startIndex, int count );
+
+			/// <summary>
+			/// Adds sprites stored in their native D3DX10_SPRITE layout, starting at the current position of a stream.
+			/// </summary>
+			/// <param name="instances">The stream containing the native sprite instances.</param>
+			/// <param name="count">The number of sprites to add.</param>
+			void Add( DataStream^ instances, int count );
+
+			/// <summary>
+			/// Draws every sprite in the batch and empties it, keeping the instance buffer for reuse.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Flush();
+
+			/// <summary>
+			/// Removes every sprite from the batch without drawing them.
+			/// </summary>
+			void Clear();
+
+			/// <summary>
+			/// Gets or sets a value indicating whether sprites are sorted by texture before drawing. The default is <c>false</c>.
+			/// </summary>
+			/// <remarks>
+			/// Sorting changes the order in which overlapping sprites with different textures are drawn, so only enable it
+			/// when the sprites do not overlap or are depth tested. The sort is stable, so sprites sharing a texture keep their
+			/// relative order. When sorting is disabled, only adjacent sprites with the same texture are drawn together.
+			/// </remarks>
+			property bool SortByTexture
+			{
+				bool get() { return m_SortByTexture; }
+				void set( bool value ) { m_SortByTexture = value; }
+			}
+
+			/// <summary>
+			/// Gets or sets the largest number of sprites submitted in a single draw call.
+			/// </summary>
+			property int MaximumBatchSize
+			{
+				int get() { return m_MaximumBatchSize; }
+				void set( int value );
+			}
+
+			/// <summary>
+			/// Gets the number of sprites waiting to be drawn.
+			/// </summary>
+			property int Count
+			{
+				int get() { return m_Count; }
+			}
+
+			/// <summary>
+			/// Gets the number of sprites the instance buffer can hold without growing.
+			/// </summary>
+			property int Capacity
+			{
+				int get() { return m_Capacity; }
+			}
+
+			/// <summary>
+			/// Gets the number of sprites drawn by the last call to <see cref="Flush"/>.
+			/// </summary>
+			property int LastSpriteCount
+			{
+				int get() { return m_LastSpriteCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of distinct texture batches drawn by the last call to <see cref="Flush"/>.
+			/// </summary>
+			property int LastBatchCount
+			{
+				int get() { return m_LastBatchCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of draw calls issued by the last call to <see cref="Flush"/>.
+			/// </summary>
+			property int LastDrawCallCount
+			{
+				int get() { return m_LastDrawCallCount; }
+			}
+
+			/// <summary>
+			/// Gets the total number of sprites drawn by the batch.
+			/// </summary>
+			property System::Int64 TotalSpriteCount
+			{
+				System::Int64 get() { return m_TotalSpriteCount; }
+			}
+
+			/// <summary>
+			/// Gets the total number of draw calls issued by the batch.
+			/// </summary>
+			property System::Int64 TotalDrawCallCount
+			{
+				System::Int64 get() { return m_TotalDrawCallCount; }
+			}
+		};
+	}
+}
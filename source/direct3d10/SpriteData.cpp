@@ -0,0 +1,58 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+#include <d3d10.h>
+#include <d3dx10.h>
+
+#include "ShaderResourceView.h"
+#include "SpriteData.h"
+
+namespace SlimDX
+{
+namespace Direct3D10
+{
+	SpriteData::SpriteData( ShaderResourceView^ texture, Vector2 coordinates, Vector2 dimensions )
+	{
+		Transform = Matrix::Identity;
+		TextureCoordinates = coordinates;
+		TextureDimensions = dimensions;
+		Color = Color4( 1.0f, 1.0f, 1.0f, 1.0f );
+		Texture = texture;
+		TextureIndex = 0;
+	}
+
+	void SpriteData::ToNativeObject( D3DX10_SPRITE& object )
+	{
+		Matrix transform = Transform;
+		Vector2 coordinates = TextureCoordinates;
+		Vector2 dimensions = TextureDimensions;
+		Color4 color = Color;
+
+		object.matWorld = *reinterpret_cast<D3DXMATRIX*>( &transform );
+		object.TexCoord = *reinterpret_cast<D3DXVECTOR2*>( &coordinates );
+		object.TexSize = *reinterpret_cast<D3DXVECTOR2*>( &dimensions );
+		object.ColorModulate = *reinterpret_cast<D3DXCOLOR*>( &color );
+		object.pTexture = Texture == nullptr ? 0 : static_cast<ID3D10ShaderResourceView*>( Texture->InternalPointer );
+		object.TextureIndex = TextureIndex;
+	}
+}
+}
@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../math/Color4.h"
+#include "../math/Matrix.h"
+#include "../math/Vector2.h"
+
+namespace SlimDX
+{
+	namespace Direct3D10
+	{
+		ref class ShaderResourceView;
+#ifdef XMLDOCS
+		ref class SpriteBatch;
+#endif
+
+		/// <summary>
+		/// Describes instance data for a single sprite drawn by a <see cref="SpriteBatch"/>.
+		/// </summary>
+		/// <remarks>
+		/// Unlike <see cref="SpriteInstance"/>, this is a value type, so arrays of sprites can be
+		/// built and reused without allocating an object per sprite.
+		/// </remarks>
+		/// <unmanaged>D3DX10_SPRITE</unmanaged>
+		public value class SpriteData
+		{
+		internal:
+			void ToNativeObject( D3DX10_SPRITE& object );
+
+		public:
+			/// <summary>
+			/// Gets or sets the world transform of the sprite.
+			/// </summary>
+			property Matrix Transform;
+
+			/// <summary>
+			/// Gets or sets the texture coordinates of the top-left corner of the sprite.
+			/// </summary>
+			property Vector2 TextureCoordinates;
+
+			/// <summary>
+			/// Gets or sets the size of the sprite in texture coordinates.
+			/// </summary>
+			property Vector2 TextureDimensions;
+
+			/// <summary>
+			/// Gets or sets the color that modulates the sprite's texture.
+			/// </summary>
+			property Color4 Color;
+
+			/// <summary>
+			/// Gets or sets the texture drawn on the sprite.
+			/// </summary>
+			property ShaderResourceView^ Texture;
+
+			/// <summary>
+			/// Gets or sets the index of the texture when <see cref="Texture"/> is a texture array.
+			/// </summary>
+			property int TextureIndex;
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="SpriteData"/> structure with an identity transform and a white color.
+			/// </summary>
+			/// <param name="texture">The texture drawn on the sprite.</param>
+			/// <param name="coordinates">The texture coordinates of the top-left corner of the sprite.</param>
+			/// <param name="dimensions">The size of the sprite in texture coordinates.</param>
+			SpriteData( ShaderResourceView^ texture, Vector2 coordinates, Vector2 dimensions );
+		};
+	}
+}
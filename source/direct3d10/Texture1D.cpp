@@ -206,14 +206,14 @@ namespace Direct3D10
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DX10SaveTextureToFile( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), pinnedName );
+		HRESULT hr = TIME_CALL( D3DX10SaveTextureToFile( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), pinnedName ) );
 		return RECORD_D3D10( hr );
 	}
 
 	Result Texture1D::ToStream( Texture1D^ texture, ImageFileFormat format, Stream^ stream )
 	{
 		ID3D10Blob* blob = 0;
-		HRESULT hr = D3DX10SaveTextureToMemory( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), &blob, 0 );
+		HRESULT hr = TIME_CALL( D3DX10SaveTextureToMemory( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), &blob, 0 ) );
 		if( RECORD_D3D10( hr ).IsFailure )
 			return Result::Last;
 		
@@ -223,7 +223,7 @@ namespace Direct3D10
 			stream->WriteByte( bytes[byteIndex] );
 		
 		blob->Release();
-		return Result::Last;
+		return Result( hr );
 	}
 }
 }
@@ -217,14 +217,14 @@ namespace Direct3D10
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DX10SaveTextureToFile( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), pinnedName );
+		HRESULT hr = TIME_CALL( D3DX10SaveTextureToFile( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), pinnedName ) );
 		return RECORD_D3D10( hr );
 	}
 
 	Result Texture2D::ToStream( Texture2D^ texture, ImageFileFormat format, Stream^ stream )
 	{
 		ID3D10Blob* blob = 0;
-		HRESULT hr = D3DX10SaveTextureToMemory( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), &blob, 0 );
+		HRESULT hr = TIME_CALL( D3DX10SaveTextureToMemory( texture->InternalPointer, static_cast<D3DX10_IMAGE_FILE_FORMAT>( format ), &blob, 0 ) );
 		if( RECORD_D3D10( hr ).IsFailure )
 			return Result::Last;
 		
@@ -234,12 +234,12 @@ namespace Direct3D10
 			stream->WriteByte( bytes[byteIndex] );
 		
 		blob->Release();
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Texture2D::ComputeNormalMap(Texture2D^ source, Texture2D^ destination, NormalMapFlags flags, Channel channel, float amplitude)
 	{
-		HRESULT hr = D3DX10ComputeNormalMap(source->InternalPointer, static_cast<UINT>(flags), static_cast<UINT>(channel), amplitude, destination->InternalPointer);
+		HRESULT hr = TIME_CALL( D3DX10ComputeNormalMap(source->InternalPointer, static_cast<UINT>(flags), static_cast<UINT>(channel), amplitude, destination->InternalPointer) );
 		return RECORD_D3D10(hr);
 	}
 }
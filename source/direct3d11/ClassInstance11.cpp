@@ -42,7 +42,7 @@ namespace Direct3D11
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( typeName );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = linkage->InternalPointer->CreateClassInstance( reinterpret_cast<LPCSTR>( pinnedName ), constantBufferOffset, constantVectorOffset, textureOffset, samplerOffset, &instance );
+		HRESULT hr = TIME_CALL( linkage->InternalPointer->CreateClassInstance( reinterpret_cast<LPCSTR>( pinnedName ), constantBufferOffset, constantVectorOffset, textureOffset, samplerOffset, &instance ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -36,7 +36,7 @@ namespace Direct3D11
 	ClassLinkage::ClassLinkage( Direct3D11::Device^ device )
 	{
 		ID3D11ClassLinkage* result = 0;
-		HRESULT hr = device->InternalPointer->CreateClassLinkage( &result );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateClassLinkage( &result ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -50,7 +50,7 @@ namespace Direct3D11
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->GetClassInstance( reinterpret_cast<LPCSTR>( pinnedName ), index, &pointer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetClassInstance( reinterpret_cast<LPCSTR>( pinnedName ), index, &pointer ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return nullptr;
 
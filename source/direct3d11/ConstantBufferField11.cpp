@@ -0,0 +1,130 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "ConstantBufferField11.h"
+
+using namespace System;
+using namespace SlimDX::D3DCompiler;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	ConstantBufferField::ConstantBufferField( String^ name, int offset, int size, ShaderVariableClass variableClass, ShaderVariableType type,
+		int rows, int columns, int elements, int elementStride )
+	{
+		m_Name = name;
+		m_Offset = offset;
+		m_Size = size;
+		m_Class = variableClass;
+		m_Type = type;
+		m_Rows = rows;
+		m_Columns = columns;
+		m_Elements = elements;
+		m_ElementStride = elementStride;
+	}
+
+	String^ ConstantBufferField::Name::get()
+	{
+		return m_Name;
+	}
+
+	int ConstantBufferField::Offset::get()
+	{
+		return m_Offset;
+	}
+
+	int ConstantBufferField::Size::get()
+	{
+		return m_Size;
+	}
+
+	ShaderVariableClass ConstantBufferField::Class::get()
+	{
+		return m_Class;
+	}
+
+	ShaderVariableType ConstantBufferField::Type::get()
+	{
+		return m_Type;
+	}
+
+	int ConstantBufferField::Rows::get()
+	{
+		return m_Rows;
+	}
+
+	int ConstantBufferField::Columns::get()
+	{
+		return m_Columns;
+	}
+
+	int ConstantBufferField::Elements::get()
+	{
+		return m_Elements;
+	}
+
+	int ConstantBufferField::ElementStride::get()
+	{
+		return m_ElementStride;
+	}
+
+	bool ConstantBufferField::operator == ( ConstantBufferField left, ConstantBufferField right )
+	{
+		return ConstantBufferField::Equals( left, right );
+	}
+
+	bool ConstantBufferField::operator != ( ConstantBufferField left, ConstantBufferField right )
+	{
+		return !ConstantBufferField::Equals( left, right );
+	}
+
+	int ConstantBufferField::GetHashCode()
+	{
+		return m_Name->GetHashCode() + m_Offset.GetHashCode() + m_Size.GetHashCode() + m_Class.GetHashCode() + m_Type.GetHashCode()
+			+ m_Rows.GetHashCode() + m_Columns.GetHashCode() + m_Elements.GetHashCode() + m_ElementStride.GetHashCode();
+	}
+
+	bool ConstantBufferField::Equals( Object^ value )
+	{
+		if( value == nullptr )
+			return false;
+
+		if( value->GetType() != GetType() )
+			return false;
+
+		return Equals( safe_cast<ConstantBufferField>( value ) );
+	}
+
+	bool ConstantBufferField::Equals( ConstantBufferField value )
+	{
+		return ( m_Name == value.m_Name && m_Offset == value.m_Offset && m_Size == value.m_Size && m_Class == value.m_Class && m_Type == value.m_Type &&
+			m_Rows == value.m_Rows && m_Columns == value.m_Columns && m_Elements == value.m_Elements && m_ElementStride == value.m_ElementStride );
+	}
+
+	bool ConstantBufferField::Equals( ConstantBufferField% value1, ConstantBufferField% value2 )
+	{
+		return value1.Equals( value2 );
+	}
+}
+}
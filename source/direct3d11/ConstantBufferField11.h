@@ -0,0 +1,170 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../d3dcompiler/EnumsDC.h"
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		/// <summary>
+		/// Describes where a single constant buffer variable or structure member lives in the buffer.
+		/// </summary>
+		/// <unmanaged>None</unmanaged>
+		public value class ConstantBufferField : System::IEquatable<ConstantBufferField>
+		{
+		private:
+			System::String^ m_Name;
+			int m_Offset;
+			int m_Size;
+			D3DCompiler::ShaderVariableClass m_Class;
+			D3DCompiler::ShaderVariableType m_Type;
+			int m_Rows;
+			int m_Columns;
+			int m_Elements;
+			int m_ElementStride;
+
+		internal:
+			ConstantBufferField( System::String^ name, int offset, int size, D3DCompiler::ShaderVariableClass variableClass, D3DCompiler::ShaderVariableType type,
+				int rows, int columns, int elements, int elementStride );
+
+		public:
+			/// <summary>
+			/// Gets the name of the field. Structure members are named with their full path, as in <c>lights[1].color</c>.
+			/// </summary>
+			property System::String^ Name
+			{
+				System::String^ get();
+			}
+
+			/// <summary>
+			/// Gets the offset of the field from the start of the buffer, in bytes.
+			/// </summary>
+			property int Offset
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of bytes spanned by the field, including padding between array elements.
+			/// </summary>
+			property int Size
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the class of the field.
+			/// </summary>
+			property D3DCompiler::ShaderVariableClass Class
+			{
+				D3DCompiler::ShaderVariableClass get();
+			}
+
+			/// <summary>
+			/// Gets the component type of the field.
+			/// </summary>
+			property D3DCompiler::ShaderVariableType Type
+			{
+				D3DCompiler::ShaderVariableType get();
+			}
+
+			/// <summary>
+			/// Gets the number of rows of the field.
+			/// </summary>
+			property int Rows
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of columns of the field.
+			/// </summary>
+			property int Columns
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of array elements in the field, or 0 if the field is not an array.
+			/// </summary>
+			property int Elements
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the distance between consecutive array elements, in bytes.
+			/// </summary>
+			property int ElementStride
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Tests for equality between two objects.
+			/// </summary>
+			/// <param name="left">The first value to compare.</param>
+			/// <param name="right">The second value to compare.</param>
+			/// <returns><c>true</c> if <paramref name="left"/> has the same value as <paramref name="right"/>; otherwise, <c>false</c>.</returns>
+			static bool operator == ( ConstantBufferField left, ConstantBufferField right );
+
+			/// <summary>
+			/// Tests for inequality between two objects.
+			/// </summary>
+			/// <param name="left">The first value to compare.</param>
+			/// <param name="right">The second value to compare.</param>
+			/// <returns><c>true</c> if <paramref name="left"/> has a different value than <paramref name="right"/>; otherwise, <c>false</c>.</returns>
+			static bool operator != ( ConstantBufferField left, ConstantBufferField right );
+
+			/// <summary>
+			/// Returns the hash code for this instance.
+			/// </summary>
+			/// <returns>A 32-bit signed integer hash code.</returns>
+			virtual int GetHashCode() override;
+
+			/// <summary>
+			/// Returns a value that indicates whether the current instance is equal to a specified object. 
+			/// </summary>
+			/// <param name="obj">Object to make the comparison with.</param>
+			/// <returns><c>true</c> if the current instance is equal to the specified object; <c>false</c> otherwise.</returns>
+			virtual bool Equals( System::Object^ obj ) override;
+
+			/// <summary>
+			/// Returns a value that indicates whether the current instance is equal to the specified object. 
+			/// </summary>
+			/// <param name="other">Object to make the comparison with.</param>
+			/// <returns><c>true</c> if the current instance is equal to the specified object; <c>false</c> otherwise.</returns>
+			virtual bool Equals( ConstantBufferField other );
+
+			/// <summary>
+			/// Determines whether the specified object instances are considered equal. 
+			/// </summary>
+			/// <param name="value1">The first value to compare.</param>
+			/// <param name="value2">The second value to compare.</param>
+			/// <returns><c>true</c> if <paramref name="value1"/> is the same instance as <paramref name="value2"/> or 
+			/// if both are <c>null</c> references or if <c>value1.Equals(value2)</c> returns <c>true</c>; otherwise, <c>false</c>.</returns>
+			static bool Equals( ConstantBufferField% value1, ConstantBufferField% value2 );
+		};
+	}
+}
@@ -0,0 +1,170 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "../d3dcompiler/ConstantBufferDC.h"
+#include "../d3dcompiler/ConstantBufferDescriptionDC.h"
+#include "../d3dcompiler/ShaderReflectionTypeDC.h"
+#include "../d3dcompiler/ShaderReflectionVariableDC.h"
+#include "../d3dcompiler/ShaderTypeDescriptionDC.h"
+#include "../d3dcompiler/ShaderVariableDescriptionDC.h"
+
+#include "ConstantBufferLayout11.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Runtime::InteropServices;
+using namespace SlimDX::D3DCompiler;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	ConstantBufferLayout::ConstantBufferLayout( D3DCompiler::ConstantBuffer^ constantBuffer )
+	{
+		if( constantBuffer == nullptr )
+			throw gcnew ArgumentNullException( "constantBuffer" );
+
+		ConstantBufferDescription description = constantBuffer->Description;
+		m_Name = description.Name;
+		m_SizeInBytes = description.Size;
+		m_Fields = gcnew List<ConstantBufferField>();
+		m_Indices = gcnew Dictionary<String^, int>();
+		m_DefaultData = gcnew array<Byte>( m_SizeInBytes );
+
+		for( int i = 0; i < description.Variables; ++i )
+		{
+			ShaderReflectionVariable^ variable = constantBuffer->GetVariable( i );
+			ShaderVariableDescription variableDescription = variable->Description;
+
+			AddFields( variableDescription.Name, variableDescription.StartOffset, variable->GetVariableType() );
+
+			// the compiler only records defaults for variables with initializers
+			if( variableDescription.DefaultValue != IntPtr::Zero && variableDescription.StartOffset + variableDescription.Size <= m_SizeInBytes )
+				Marshal::Copy( variableDescription.DefaultValue, m_DefaultData, variableDescription.StartOffset, variableDescription.Size );
+		}
+	}
+
+	int ConstantBufferLayout::GetElementSize( ShaderReflectionType^ type )
+	{
+		ShaderTypeDescription description = type->Description;
+
+		switch( description.Class )
+		{
+		case ShaderVariableClass::Scalar:
+		case ShaderVariableClass::Vector:
+			return description.Columns * 4;
+
+		case ShaderVariableClass::MatrixRows:
+			return ( description.Rows - 1 ) * 16 + description.Columns * 4;
+
+		case ShaderVariableClass::MatrixColumns:
+			return ( description.Columns - 1 ) * 16 + description.Rows * 4;
+
+		case ShaderVariableClass::Struct:
+		{
+			int size = 0;
+			for( int i = 0; i < description.Members; ++i )
+			{
+				ShaderReflectionType^ memberType = type->GetMemberType( i );
+				ShaderTypeDescription memberDescription = memberType->Description;
+
+				int memberSize = GetElementSize( memberType );
+				if( memberDescription.Elements > 0 )
+					memberSize += ( memberDescription.Elements - 1 ) * ( ( memberSize + 15 ) & ~15 );
+
+				size = Math::Max( size, memberDescription.Offset + memberSize );
+			}
+
+			return size;
+		}
+
+		default:
+			return 0;
+		}
+	}
+
+	void ConstantBufferLayout::AddFields( String^ name, int offset, ShaderReflectionType^ type )
+	{
+		ShaderTypeDescription description = type->Description;
+		int elementSize = GetElementSize( type );
+		int stride = ( elementSize + 15 ) & ~15;
+
+		if( description.Class == ShaderVariableClass::Struct )
+		{
+			int count = Math::Max( description.Elements, 1 );
+			for( int element = 0; element < count; ++element )
+			{
+				String^ prefix = description.Elements > 0 ? String::Format( "{0}[{1}]", name, element ) : name;
+				for( int i = 0; i < description.Members; ++i )
+				{
+					ShaderReflectionType^ memberType = type->GetMemberType( i );
+					AddFields( prefix + "." + type->GetMemberTypeName( i ), offset + element * stride + memberType->Description.Offset, memberType );
+				}
+			}
+
+			return;
+		}
+
+		// objects and interfaces have no storage in the buffer
+		if( elementSize == 0 )
+			return;
+
+		int size = description.Elements > 0 ? ( description.Elements - 1 ) * stride + elementSize : elementSize;
+		if( offset < 0 || offset + size > m_SizeInBytes )
+			throw gcnew InvalidOperationException( String::Format( "The reflected field '{0}' lies outside the constant buffer.", name ) );
+
+		m_Indices->Add( name, m_Fields->Count );
+		m_Fields->Add( ConstantBufferField( name, offset, size, description.Class, description.Type, description.Rows, description.Columns,
+			description.Elements, stride ) );
+	}
+
+	int ConstantBufferLayout::IndexOf( String^ name )
+	{
+		if( name == nullptr )
+			throw gcnew ArgumentNullException( "name" );
+
+		int index;
+		if( m_Indices->TryGetValue( name, index ) )
+			return index;
+
+		return -1;
+	}
+
+	ConstantBufferField ConstantBufferLayout::GetField( int index )
+	{
+		if( index < 0 || index >= m_Fields->Count )
+			throw gcnew ArgumentOutOfRangeException( "index" );
+
+		return m_Fields[index];
+	}
+
+	ConstantBufferField ConstantBufferLayout::GetField( String^ name )
+	{
+		int index = IndexOf( name );
+		if( index < 0 )
+			throw gcnew ArgumentException( String::Format( "The constant buffer has no field named '{0}'.", name ), "name" );
+
+		return m_Fields[index];
+	}
+}
+}
@@ -0,0 +1,117 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "ConstantBufferField11.h"
+
+namespace SlimDX
+{
+	namespace D3DCompiler
+	{
+		ref class ConstantBuffer;
+		ref class ShaderReflectionType;
+	}
+
+	namespace Direct3D11
+	{
+		/// <summary>
+		/// A table of field offsets for a constant buffer, built from shader reflection data.
+		/// </summary>
+		/// <remarks>
+		/// Every variable in the buffer becomes a field. Structures are flattened into one field per member, named with the
+		/// full path to the member (<c>material.diffuse</c>, <c>lights[2].position</c>), so arrays of structures get one set
+		/// of fields per element. Offsets follow the HLSL packing rules recorded by the compiler, including the 16 byte
+		/// alignment of array elements and structures.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class ConstantBufferLayout sealed
+		{
+		private:
+			System::String^ m_Name;
+			int m_SizeInBytes;
+			System::Collections::Generic::List<ConstantBufferField>^ m_Fields;
+			System::Collections::Generic::Dictionary<System::String^, int>^ m_Indices;
+			array<System::Byte>^ m_DefaultData;
+
+			void AddFields( System::String^ name, int offset, D3DCompiler::ShaderReflectionType^ type );
+			static int GetElementSize( D3DCompiler::ShaderReflectionType^ type );
+
+		internal:
+			property array<System::Byte>^ DefaultData
+			{
+				array<System::Byte>^ get() { return m_DefaultData; }
+			}
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ConstantBufferLayout"/> class.
+			/// </summary>
+			/// <param name="constantBuffer">The reflected constant buffer to build the layout from.</param>
+			ConstantBufferLayout( D3DCompiler::ConstantBuffer^ constantBuffer );
+
+			/// <summary>
+			/// Finds the index of a field.
+			/// </summary>
+			/// <param name="name">The name of the field.</param>
+			/// <returns>The index of the field, or -1 if the buffer has no field with the given name.</returns>
+			int IndexOf( System::String^ name );
+
+			/// <summary>
+			/// Gets the field at the given index.
+			/// </summary>
+			/// <param name="index">The index of the field.</param>
+			/// <returns>The field at the given index.</returns>
+			ConstantBufferField GetField( int index );
+
+			/// <summary>
+			/// Gets the field with the given name.
+			/// </summary>
+			/// <param name="name">The name of the field.</param>
+			/// <returns>The field with the given name.</returns>
+			ConstantBufferField GetField( System::String^ name );
+
+			/// <summary>
+			/// Gets the name of the constant buffer.
+			/// </summary>
+			property System::String^ Name
+			{
+				System::String^ get() { return m_Name; }
+			}
+
+			/// <summary>
+			/// Gets the size of the constant buffer, in bytes.
+			/// </summary>
+			property int SizeInBytes
+			{
+				int get() { return m_SizeInBytes; }
+			}
+
+			/// <summary>
+			/// Gets the number of fields in the layout.
+			/// </summary>
+			property int FieldCount
+			{
+				int get() { return m_Fields->Count; }
+			}
+		};
+	}
+}
@@ -0,0 +1,76 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <string.h>
+
+#include "ConstantPacking11.h"
+
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	bool CopyIfChanged( void* destination, const void* source, int size )
+	{
+		if( memcmp( destination, source, size ) == 0 )
+			return false;
+
+		memcpy( destination, source, size );
+		return true;
+	}
+
+	bool PackMatrix( unsigned char* destination, const float* matrix, bool columnMajor, int rows, int columns )
+	{
+		bool changed = false;
+
+		if( !columnMajor )
+		{
+			for( int r = 0; r < rows; ++r )
+				changed |= CopyIfChanged( destination + r * 16, matrix + r * 4, columns * 4 );
+		}
+		else
+		{
+			for( int c = 0; c < columns; ++c )
+			{
+				float column[4] = { matrix[c], matrix[4 + c], matrix[8 + c], matrix[12 + c] };
+				changed |= CopyIfChanged( destination + c * 16, column, rows * 4 );
+			}
+		}
+
+		return changed;
+	}
+
+	bool PackElements( unsigned char* destination, int stride, const float* data, int count, int elementFloats, int columns )
+	{
+		int size = ( elementFloats < columns ? elementFloats : columns ) * 4;
+		bool changed = false;
+
+		for( int i = 0; i < count; ++i )
+			changed |= CopyIfChanged( destination + i * stride, data + i * elementFloats, size );
+
+		return changed;
+	}
+}
+}
+
+#pragma managed(pop)
@@ -0,0 +1,39 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	// Copies size bytes and returns true if the destination held different bytes before.
+	bool CopyIfChanged( void* destination, const void* source, int size );
+
+	// Writes the upper left rows x columns part of a row-major 4x4 matrix into constant buffer registers, one register per row,
+	// or one register per column when the destination is column-major. Returns true if any byte changed.
+	bool PackMatrix( unsigned char* destination, const float* matrix, bool columnMajor, int rows, int columns );
+
+	// Writes count elements of elementFloats floats each, truncated to columns components and placed stride bytes apart.
+	// Returns true if any byte changed.
+	bool PackElements( unsigned char* destination, int stride, const float* data, int count, int elementFloats, int columns );
+}
+}
@@ -0,0 +1,486 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <d3d11.h>
+
+#include "../Utilities.h"
+
+#include "DdsFile11.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	// File structures from the DDS reference; the SDK only ships them with the samples.
+	struct DdsPixelFormat
+	{
+		UINT Size;
+		UINT Flags;
+		UINT FourCC;
+		UINT RGBBitCount;
+		UINT RBitMask;
+		UINT GBitMask;
+		UINT BBitMask;
+		UINT ABitMask;
+	};
+
+	struct DdsHeader
+	{
+		UINT Size;
+		UINT Flags;
+		UINT Height;
+		UINT Width;
+		UINT PitchOrLinearSize;
+		UINT Depth;
+		UINT MipMapCount;
+		UINT Reserved1[11];
+		DdsPixelFormat PixelFormat;
+		UINT Caps;
+		UINT Caps2;
+		UINT Caps3;
+		UINT Caps4;
+		UINT Reserved2;
+	};
+
+	struct DdsHeaderDX10
+	{
+		UINT Format;
+		UINT ResourceDimension;
+		UINT MiscFlag;
+		UINT ArraySize;
+		UINT MiscFlags2;
+	};
+
+	const UINT DdsMagic = 0x20534444;
+	const UINT DdsPixelFormatAlphaPixels = 0x1;
+	const UINT DdsPixelFormatAlpha = 0x2;
+	const UINT DdsPixelFormatFourCC = 0x4;
+	const UINT DdsPixelFormatRGB = 0x40;
+	const UINT DdsPixelFormatLuminance = 0x20000;
+	const UINT DdsPixelFormatBumpDuDv = 0x80000;
+	const UINT DdsHeaderDepth = 0x800000;
+	const UINT DdsCubeMap = 0x200;
+	const UINT DdsCubeMapAllFaces = 0xFC00;
+	const UINT DdsVolume = 0x200000;
+
+	static UINT MakeFourCC( char a, char b, char c, char d )
+	{
+		return static_cast<UINT>( a ) | ( static_cast<UINT>( b ) << 8 ) | ( static_cast<UINT>( c ) << 16 ) | ( static_cast<UINT>( d ) << 24 );
+	}
+
+	static bool HasMasks( const DdsPixelFormat& format, UINT r, UINT g, UINT b, UINT a )
+	{
+		return format.RBitMask == r && format.GBitMask == g && format.BBitMask == b && format.ABitMask == a;
+	}
+
+	static DXGI_FORMAT GetLegacyFormat( const DdsPixelFormat& format )
+	{
+		if( format.Flags & DdsPixelFormatFourCC )
+		{
+			UINT fourCC = format.FourCC;
+			if( fourCC == MakeFourCC( 'D', 'X', 'T', '1' ) )
+				return DXGI_FORMAT_BC1_UNORM;
+			if( fourCC == MakeFourCC( 'D', 'X', 'T', '2' ) || fourCC == MakeFourCC( 'D', 'X', 'T', '3' ) )
+				return DXGI_FORMAT_BC2_UNORM;
+			if( fourCC == MakeFourCC( 'D', 'X', 'T', '4' ) || fourCC == MakeFourCC( 'D', 'X', 'T', '5' ) )
+				return DXGI_FORMAT_BC3_UNORM;
+			if( fourCC == MakeFourCC( 'A', 'T', 'I', '1' ) || fourCC == MakeFourCC( 'B', 'C', '4', 'U' ) )
+				return DXGI_FORMAT_BC4_UNORM;
+			if( fourCC == MakeFourCC( 'B', 'C', '4', 'S' ) )
+				return DXGI_FORMAT_BC4_SNORM;
+			if( fourCC == MakeFourCC( 'A', 'T', 'I', '2' ) || fourCC == MakeFourCC( 'B', 'C', '5', 'U' ) )
+				return DXGI_FORMAT_BC5_UNORM;
+			if( fourCC == MakeFourCC( 'B', 'C', '5', 'S' ) )
+				return DXGI_FORMAT_BC5_SNORM;
+			if( fourCC == MakeFourCC( 'R', 'G', 'B', 'G' ) )
+				return DXGI_FORMAT_R8G8_B8G8_UNORM;
+			if( fourCC == MakeFourCC( 'G', 'R', 'G', 'B' ) )
+				return DXGI_FORMAT_G8R8_G8B8_UNORM;
+
+			// older writers store a D3DFORMAT value in place of a FourCC code
+			switch( fourCC )
+			{
+			case D3DFMT_A16B16G16R16:
+				return DXGI_FORMAT_R16G16B16A16_UNORM;
+			case D3DFMT_Q16W16V16U16:
+				return DXGI_FORMAT_R16G16B16A16_SNORM;
+			case D3DFMT_R16F:
+				return DXGI_FORMAT_R16_FLOAT;
+			case D3DFMT_G16R16F:
+				return DXGI_FORMAT_R16G16_FLOAT;
+			case D3DFMT_A16B16G16R16F:
+				return DXGI_FORMAT_R16G16B16A16_FLOAT;
+			case D3DFMT_R32F:
+				return DXGI_FORMAT_R32_FLOAT;
+			case D3DFMT_G32R32F:
+				return DXGI_FORMAT_R32G32_FLOAT;
+			case D3DFMT_A32B32G32R32F:
+				return DXGI_FORMAT_R32G32B32A32_FLOAT;
+			}
+
+			return DXGI_FORMAT_UNKNOWN;
+		}
+
+		if( format.Flags & DdsPixelFormatRGB )
+		{
+			switch( format.RGBBitCount )
+			{
+			case 32:
+				if( HasMasks( format, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000 ) )
+					return DXGI_FORMAT_R8G8B8A8_UNORM;
+				if( HasMasks( format, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000 ) )
+					return DXGI_FORMAT_B8G8R8A8_UNORM;
+				if( HasMasks( format, 0x00FF0000, 0x0000FF00, 0x000000FF, 0x00000000 ) )
+					return DXGI_FORMAT_B8G8R8X8_UNORM;
+				if( HasMasks( format, 0x000003FF, 0x000FFC00, 0x3FF00000, 0xC0000000 ) )
+					return DXGI_FORMAT_R10G10B10A2_UNORM;
+				if( HasMasks( format, 0x0000FFFF, 0xFFFF0000, 0x00000000, 0x00000000 ) )
+					return DXGI_FORMAT_R16G16_UNORM;
+				if( HasMasks( format, 0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000 ) )
+					return DXGI_FORMAT_R32_FLOAT;
+				break;
+
+			case 16:
+				if( HasMasks( format, 0x7C00, 0x03E0, 0x001F, 0x8000 ) )
+					return DXGI_FORMAT_B5G5R5A1_UNORM;
+				if( HasMasks( format, 0xF800, 0x07E0, 0x001F, 0x0000 ) )
+					return DXGI_FORMAT_B5G6R5_UNORM;
+				break;
+			}
+
+			return DXGI_FORMAT_UNKNOWN;
+		}
+
+		if( format.Flags & DdsPixelFormatLuminance )
+		{
+			if( format.RGBBitCount == 8 && HasMasks( format, 0xFF, 0, 0, 0 ) )
+				return DXGI_FORMAT_R8_UNORM;
+			if( format.RGBBitCount == 16 && HasMasks( format, 0xFFFF, 0, 0, 0 ) )
+				return DXGI_FORMAT_R16_UNORM;
+			if( format.RGBBitCount == 16 && HasMasks( format, 0xFF, 0, 0, 0xFF00 ) )
+				return DXGI_FORMAT_R8G8_UNORM;
+
+			return DXGI_FORMAT_UNKNOWN;
+		}
+
+		if( format.Flags & DdsPixelFormatAlpha )
+			return format.RGBBitCount == 8 ? DXGI_FORMAT_A8_UNORM : DXGI_FORMAT_UNKNOWN;
+
+		if( format.Flags & DdsPixelFormatBumpDuDv )
+		{
+			if( format.RGBBitCount == 16 && HasMasks( format, 0x00FF, 0xFF00, 0, 0 ) )
+				return DXGI_FORMAT_R8G8_SNORM;
+			if( format.RGBBitCount == 32 && HasMasks( format, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000 ) )
+				return DXGI_FORMAT_R8G8B8A8_SNORM;
+			if( format.RGBBitCount == 32 && HasMasks( format, 0x0000FFFF, 0xFFFF0000, 0, 0 ) )
+				return DXGI_FORMAT_R16G16_SNORM;
+		}
+
+		return DXGI_FORMAT_UNKNOWN;
+	}
+
+	static void GetSurfaceLayout( DXGI_FORMAT format, int width, int height, Int64& rowPitch, int& rows )
+	{
+		if( Utilities::IsCompressed( format ) )
+		{
+			int blockBytes = Utilities::SizeOfFormatElement( format ) / 8;
+			rowPitch = static_cast<Int64>( ( width + 3 ) / 4 ) * blockBytes;
+			rows = ( height + 3 ) / 4;
+			return;
+		}
+
+		rows = height;
+		switch( format )
+		{
+		case DXGI_FORMAT_R8G8_B8G8_UNORM:
+		case DXGI_FORMAT_G8R8_G8B8_UNORM:
+			rowPitch = static_cast<Int64>( ( width + 1 ) / 2 ) * 4;
+			break;
+
+		case DXGI_FORMAT_R1_UNORM:
+			rowPitch = ( width + 7 ) / 8;
+			break;
+
+		default:
+			rowPitch = ( static_cast<Int64>( width ) * Utilities::SizeOfFormatElement( format ) + 7 ) / 8;
+			break;
+		}
+	}
+
+	DdsFile::DdsFile( const unsigned char* data, int size, Int64 fileLength )
+	{
+		if( size < 4 + static_cast<int>( sizeof( DdsHeader ) ) || *reinterpret_cast<const UINT*>( data ) != DdsMagic )
+			throw gcnew InvalidDataException( "The data is not a DDS file." );
+
+		const DdsHeader& header = *reinterpret_cast<const DdsHeader*>( data + 4 );
+		if( header.Size != sizeof( DdsHeader ) || header.PixelFormat.Size != sizeof( DdsPixelFormat ) )
+			throw gcnew InvalidDataException( "The DDS header is corrupt." );
+
+		m_Width = static_cast<int>( header.Width );
+		m_Height = static_cast<int>( header.Height );
+		m_Depth = 1;
+		m_MipLevels = header.MipMapCount > 0 ? static_cast<int>( header.MipMapCount ) : 1;
+		m_ArraySize = 1;
+		m_DataOffset = 4 + sizeof( DdsHeader );
+
+		DXGI_FORMAT format;
+		if( ( header.PixelFormat.Flags & DdsPixelFormatFourCC ) && header.PixelFormat.FourCC == MakeFourCC( 'D', 'X', '1', '0' ) )
+		{
+			if( size < MaximumHeaderSize )
+				throw gcnew InvalidDataException( "The DDS header is truncated." );
+
+			const DdsHeaderDX10& extension = *reinterpret_cast<const DdsHeaderDX10*>( data + 4 + sizeof( DdsHeader ) );
+			m_DataOffset += sizeof( DdsHeaderDX10 );
+
+			// checked on the raw value so that neither the cast nor the cube map multiplication below can overflow
+			if( extension.ArraySize > D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION )
+				throw gcnew InvalidDataException( "The DDS file has more array slices than Direct3D 11 allows." );
+
+			format = static_cast<DXGI_FORMAT>( extension.Format );
+			m_ArraySize = static_cast<int>( extension.ArraySize );
+			m_IsCubeMap = ( extension.MiscFlag & D3D11_RESOURCE_MISC_TEXTURECUBE ) != 0;
+
+			switch( extension.ResourceDimension )
+			{
+			case D3D11_RESOURCE_DIMENSION_TEXTURE1D:
+				m_Dimension = ResourceDimension::Texture1D;
+				m_Height = 1;
+				break;
+
+			case D3D11_RESOURCE_DIMENSION_TEXTURE2D:
+				m_Dimension = ResourceDimension::Texture2D;
+				break;
+
+			case D3D11_RESOURCE_DIMENSION_TEXTURE3D:
+				m_Dimension = ResourceDimension::Texture3D;
+				m_Depth = static_cast<int>( header.Depth );
+				if( m_ArraySize != 1 )
+					throw gcnew InvalidDataException( "A volume texture cannot be an array." );
+				break;
+
+			default:
+				throw gcnew InvalidDataException( "The DDS file has an unsupported resource dimension." );
+			}
+
+			if( m_IsCubeMap )
+			{
+				if( m_Dimension != ResourceDimension::Texture2D )
+					throw gcnew InvalidDataException( "A cube map must be two-dimensional." );
+				m_ArraySize *= 6;
+			}
+		}
+		else
+		{
+			format = GetLegacyFormat( header.PixelFormat );
+
+			if( header.Caps2 & DdsCubeMap )
+			{
+				if( ( header.Caps2 & DdsCubeMapAllFaces ) != DdsCubeMapAllFaces )
+					throw gcnew InvalidDataException( "Cube maps with missing faces are not supported." );
+
+				m_Dimension = ResourceDimension::Texture2D;
+				m_IsCubeMap = true;
+				m_ArraySize = 6;
+			}
+			else if( ( header.Flags & DdsHeaderDepth ) && ( header.Caps2 & DdsVolume ) )
+			{
+				m_Dimension = ResourceDimension::Texture3D;
+				m_Depth = static_cast<int>( header.Depth );
+			}
+			else
+			{
+				m_Dimension = ResourceDimension::Texture2D;
+			}
+		}
+
+		if( format == DXGI_FORMAT_UNKNOWN )
+			throw gcnew InvalidDataException( "The DDS file has an unsupported pixel format." );
+		if( m_Width <= 0 || m_Height <= 0 || m_Depth <= 0 || m_ArraySize <= 0 )
+			throw gcnew InvalidDataException( "The DDS file has invalid dimensions." );
+
+		int largest = m_Width > m_Height ? m_Width : m_Height;
+		largest = largest > m_Depth ? largest : m_Depth;
+
+		int maximumLevels = 1;
+		while( largest > 1 )
+		{
+			largest >>= 1;
+			++maximumLevels;
+		}
+
+		if( m_MipLevels > maximumLevels )
+			throw gcnew InvalidDataException( "The DDS file has more mip levels than its dimensions allow." );
+
+		m_Format = static_cast<DXGI::Format>( format );
+		BuildSubresources( fileLength );
+	}
+
+	void DdsFile::BuildSubresources( Int64 fileLength )
+	{
+		DXGI_FORMAT format = static_cast<DXGI_FORMAT>( m_Format );
+
+		// the truncation check below is skipped for streams that cannot seek, so the header alone must not
+		// be able to request an arbitrarily large table
+		Int64 count = static_cast<Int64>( m_MipLevels ) * m_ArraySize;
+		if( m_MipLevels <= 0 || count > D3D11_REQ_MIP_LEVELS * D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION * 6 )
+			throw gcnew InvalidDataException( "The DDS file has too many subresources." );
+
+		m_Subresources = gcnew array<DdsSubresource>( static_cast<int>( count ) );
+
+		// file order matches subresource order: all levels of a slice, then the next slice
+		Int64 offset = m_DataOffset;
+		for( int slice = 0; slice < m_ArraySize; ++slice )
+		{
+			int width = m_Width;
+			int height = m_Height;
+			int depth = m_Depth;
+
+			for( int level = 0; level < m_MipLevels; ++level )
+			{
+				Int64 rowPitch;
+				int rows;
+				GetSurfaceLayout( format, width, height, rowPitch, rows );
+
+				Int64 slicePitch = rowPitch * rows;
+				Int64 length = slicePitch * depth;
+				if( length > Int32::MaxValue )
+					throw gcnew InvalidDataException( "A DDS subresource is too large." );
+
+				m_Subresources[GetSubresourceIndex( level, slice )] = DdsSubresource( offset, static_cast<int>( length ), level, slice,
+					width, height, depth, static_cast<int>( rowPitch ), static_cast<int>( slicePitch ) );
+				offset += length;
+
+				width = width > 1 ? width / 2 : 1;
+				height = height > 1 ? height / 2 : 1;
+				depth = depth > 1 ? depth / 2 : 1;
+			}
+		}
+
+		if( fileLength >= 0 && offset > fileLength )
+			throw gcnew InvalidDataException( "The DDS file is truncated." );
+
+		m_DataLength = offset - m_DataOffset;
+		m_ReadOnlySubresources = Array::AsReadOnly( m_Subresources );
+	}
+
+	DdsFile^ DdsFile::FromPointer( const unsigned char* data, Int64 length )
+	{
+		int size = length < MaximumHeaderSize ? static_cast<int>( length ) : MaximumHeaderSize;
+		return gcnew DdsFile( data, size, length );
+	}
+
+	DdsFile^ DdsFile::FromMemory( array<Byte>^ memory )
+	{
+		if( memory == nullptr )
+			throw gcnew ArgumentNullException( "memory" );
+		if( memory->Length == 0 )
+			throw gcnew InvalidDataException( "The data is not a DDS file." );
+
+		pin_ptr<Byte> pinnedMemory = &memory[0];
+		return FromPointer( pinnedMemory, memory->Length );
+	}
+
+	DdsFile^ DdsFile::FromFile( String^ fileName )
+	{
+		FileStream^ stream = File::OpenRead( fileName );
+
+		try
+		{
+			return FromStream( stream );
+		}
+		finally
+		{
+			delete stream;
+		}
+	}
+
+	DdsFile^ DdsFile::FromStream( Stream^ stream )
+	{
+		if( stream == nullptr )
+			throw gcnew ArgumentNullException( "stream" );
+
+		Int64 fileLength = stream->CanSeek ? stream->Length - stream->Position : -1;
+
+		// read the fixed header first; the DX10 extension only follows when the FourCC asks for it
+		array<Byte>^ header = gcnew array<Byte>( MaximumHeaderSize );
+		int size = 0;
+		int wanted = 4 + sizeof( DdsHeader );
+		while( size < wanted )
+		{
+			int read = stream->Read( header, size, wanted - size );
+			if( read == 0 )
+				break;
+
+			size += read;
+			if( size == 4 + static_cast<int>( sizeof( DdsHeader ) ) )
+			{
+				pin_ptr<Byte> pinnedHeader = &header[0];
+				const DdsPixelFormat* format = &reinterpret_cast<const DdsHeader*>( pinnedHeader + 4 )->PixelFormat;
+				if( ( format->Flags & DdsPixelFormatFourCC ) && format->FourCC == MakeFourCC( 'D', 'X', '1', '0' ) )
+					wanted = MaximumHeaderSize;
+			}
+		}
+
+		pin_ptr<Byte> pinnedHeader = &header[0];
+		return gcnew DdsFile( pinnedHeader, size, fileLength );
+	}
+
+	int DdsFile::GetSubresourceIndex( int mipLevel, int arraySlice )
+	{
+		if( mipLevel < 0 || mipLevel >= m_MipLevels )
+			throw gcnew ArgumentOutOfRangeException( "mipLevel" );
+		if( arraySlice < 0 || arraySlice >= m_ArraySize )
+			throw gcnew ArgumentOutOfRangeException( "arraySlice" );
+
+		return mipLevel + arraySlice * m_MipLevels;
+	}
+
+	DdsSubresource DdsFile::GetSubresource( int mipLevel, int arraySlice )
+	{
+		return m_Subresources[GetSubresourceIndex( mipLevel, arraySlice )];
+	}
+
+	Int64 DdsFile::GetMipLevelSize( int mipLevel )
+	{
+		return static_cast<Int64>( GetSubresource( mipLevel, 0 ).Length ) * m_ArraySize;
+	}
+
+	array<int>^ DdsFile::GetLoadOrder()
+	{
+		array<int>^ order = gcnew array<int>( m_Subresources->Length );
+
+		int index = 0;
+		for( int level = m_MipLevels - 1; level >= 0; --level )
+		{
+			for( int slice = 0; slice < m_ArraySize; ++slice )
+				order[index++] = level + slice * m_MipLevels;
+		}
+
+		return order;
+	}
+}
+}
@@ -0,0 +1,209 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../dxgi/Enums.h"
+
+#include "Enums11.h"
+#include "DdsSubresource11.h"
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		/// <summary>
+		/// Describes the contents of a DDS file, including DX10 extended headers, without loading its image data.
+		/// </summary>
+		/// <remarks>
+		/// Only the header is read. Each subresource is described by its byte range within the file, so callers can read
+		/// and upload individual mip levels in any order, for example the smallest levels first for progressive loading.
+		/// Offsets are relative to the start of the DDS data, which for <see cref="FromStream"/> is the position of the
+		/// stream when the method is called.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class DdsFile sealed
+		{
+		private:
+			DXGI::Format m_Format;
+			ResourceDimension m_Dimension;
+			int m_Width;
+			int m_Height;
+			int m_Depth;
+			int m_MipLevels;
+			int m_ArraySize;
+			bool m_IsCubeMap;
+			System::Int64 m_DataOffset;
+			System::Int64 m_DataLength;
+			array<DdsSubresource>^ m_Subresources;
+			System::Collections::ObjectModel::ReadOnlyCollection<DdsSubresource>^ m_ReadOnlySubresources;
+
+			DdsFile( const unsigned char* data, int size, System::Int64 fileLength );
+
+			void BuildSubresources( System::Int64 fileLength );
+
+		internal:
+			// The magic number, the header and the DX10 extension header.
+			literal int MaximumHeaderSize = 4 + 124 + 20;
+
+			static DdsFile^ FromPointer( const unsigned char* data, System::Int64 length );
+
+		public:
+			/// <summary>
+			/// Reads the header of a DDS file in memory.
+			/// </summary>
+			/// <param name="memory">The contents of the file.</param>
+			/// <returns>The description of the file.</returns>
+			static DdsFile^ FromMemory( array<System::Byte>^ memory );
+
+			/// <summary>
+			/// Reads the header of a DDS file on disk.
+			/// </summary>
+			/// <param name="fileName">The path of the file.</param>
+			/// <returns>The description of the file.</returns>
+			static DdsFile^ FromFile( System::String^ fileName );
+
+			/// <summary>
+			/// Reads the header of a DDS file from a stream, leaving the stream positioned after the header.
+			/// </summary>
+			/// <param name="stream">The stream, positioned at the start of the DDS data.</param>
+			/// <returns>The description of the file.</returns>
+			static DdsFile^ FromStream( System::IO::Stream^ stream );
+
+			/// <summary>
+			/// Gets the index of a subresource, as used by <see cref="Subresources"/> and by Direct3D.
+			/// </summary>
+			/// <param name="mipLevel">The mip level.</param>
+			/// <param name="arraySlice">The array slice; cube faces count as separate slices.</param>
+			/// <returns>The subresource index.</returns>
+			int GetSubresourceIndex( int mipLevel, int arraySlice );
+
+			/// <summary>
+			/// Gets the description of a subresource.
+			/// </summary>
+			/// <param name="mipLevel">The mip level.</param>
+			/// <param name="arraySlice">The array slice; cube faces count as separate slices.</param>
+			/// <returns>The location and layout of the subresource.</returns>
+			DdsSubresource GetSubresource( int mipLevel, int arraySlice );
+
+			/// <summary>
+			/// Gets the total size of one mip level across all array slices.
+			/// </summary>
+			/// <param name="mipLevel">The mip level.</param>
+			/// <returns>The size of the level, in bytes.</returns>
+			System::Int64 GetMipLevelSize( int mipLevel );
+
+			/// <summary>
+			/// Gets the subresource indices ordered from the smallest mip level to the largest.
+			/// </summary>
+			/// <returns>The subresource indices in progressive load order.</returns>
+			array<int>^ GetLoadOrder();
+
+			/// <summary>
+			/// Gets the format of the image data.
+			/// </summary>
+			property DXGI::Format Format
+			{
+				DXGI::Format get() { return m_Format; }
+			}
+
+			/// <summary>
+			/// Gets the kind of texture stored in the file.
+			/// </summary>
+			property ResourceDimension Dimension
+			{
+				ResourceDimension get() { return m_Dimension; }
+			}
+
+			/// <summary>
+			/// Gets the width of the top mip level, in pixels.
+			/// </summary>
+			property int Width
+			{
+				int get() { return m_Width; }
+			}
+
+			/// <summary>
+			/// Gets the height of the top mip level, in pixels.
+			/// </summary>
+			property int Height
+			{
+				int get() { return m_Height; }
+			}
+
+			/// <summary>
+			/// Gets the depth of the top mip level of a volume texture; 1 for other textures.
+			/// </summary>
+			property int Depth
+			{
+				int get() { return m_Depth; }
+			}
+
+			/// <summary>
+			/// Gets the number of mip levels.
+			/// </summary>
+			property int MipLevels
+			{
+				int get() { return m_MipLevels; }
+			}
+
+			/// <summary>
+			/// Gets the number of array slices, counting each cube face as a slice.
+			/// </summary>
+			property int ArraySize
+			{
+				int get() { return m_ArraySize; }
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether the file holds a cube map or cube map array.
+			/// </summary>
+			property bool IsCubeMap
+			{
+				bool get() { return m_IsCubeMap; }
+			}
+
+			/// <summary>
+			/// Gets the offset of the first subresource, in bytes.
+			/// </summary>
+			property System::Int64 DataOffset
+			{
+				System::Int64 get() { return m_DataOffset; }
+			}
+
+			/// <summary>
+			/// Gets the total size of all subresources, in bytes.
+			/// </summary>
+			property System::Int64 DataLength
+			{
+				System::Int64 get() { return m_DataLength; }
+			}
+
+			/// <summary>
+			/// Gets the subresources in Direct3D subresource order: every mip level of the first slice, then of the second, and so on.
+			/// </summary>
+			property System::Collections::ObjectModel::ReadOnlyCollection<DdsSubresource>^ Subresources
+			{
+				System::Collections::ObjectModel::ReadOnlyCollection<DdsSubresource>^ get() { return m_ReadOnlySubresources; }
+			}
+		};
+	}
+}
@@ -0,0 +1,126 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		/// <summary>
+		/// Describes where one subresource of a DDS file is stored and how its data is laid out.
+		/// </summary>
+		/// <unmanaged>None</unmanaged>
+		public value class DdsSubresource
+		{
+		private:
+			System::Int64 m_Offset;
+			int m_Length;
+			int m_MipLevel;
+			int m_ArraySlice;
+			int m_Width;
+			int m_Height;
+			int m_Depth;
+			int m_RowPitch;
+			int m_SlicePitch;
+
+		internal:
+			DdsSubresource( System::Int64 offset, int length, int mipLevel, int arraySlice, int width, int height, int depth, int rowPitch, int slicePitch )
+				: m_Offset( offset ), m_Length( length ), m_MipLevel( mipLevel ), m_ArraySlice( arraySlice ),
+				m_Width( width ), m_Height( height ), m_Depth( depth ), m_RowPitch( rowPitch ), m_SlicePitch( slicePitch )
+			{
+			}
+
+		public:
+			/// <summary>
+			/// Gets the offset of the subresource data, in bytes from the start of the file.
+			/// </summary>
+			property System::Int64 Offset
+			{
+				System::Int64 get() { return m_Offset; }
+			}
+
+			/// <summary>
+			/// Gets the size of the subresource data, in bytes.
+			/// </summary>
+			property int Length
+			{
+				int get() { return m_Length; }
+			}
+
+			/// <summary>
+			/// Gets the mip level of the subresource.
+			/// </summary>
+			property int MipLevel
+			{
+				int get() { return m_MipLevel; }
+			}
+
+			/// <summary>
+			/// Gets the array slice (or cube face) of the subresource.
+			/// </summary>
+			property int ArraySlice
+			{
+				int get() { return m_ArraySlice; }
+			}
+
+			/// <summary>
+			/// Gets the width of the subresource, in pixels.
+			/// </summary>
+			property int Width
+			{
+				int get() { return m_Width; }
+			}
+
+			/// <summary>
+			/// Gets the height of the subresource, in pixels.
+			/// </summary>
+			property int Height
+			{
+				int get() { return m_Height; }
+			}
+
+			/// <summary>
+			/// Gets the depth of the subresource, in pixels.
+			/// </summary>
+			property int Depth
+			{
+				int get() { return m_Depth; }
+			}
+
+			/// <summary>
+			/// Gets the number of bytes between rows of the subresource (rows of blocks for compressed formats).
+			/// </summary>
+			property int RowPitch
+			{
+				int get() { return m_RowPitch; }
+			}
+
+			/// <summary>
+			/// Gets the number of bytes between depth slices of the subresource.
+			/// </summary>
+			property int SlicePitch
+			{
+				int get() { return m_SlicePitch; }
+			}
+		};
+	}
+}
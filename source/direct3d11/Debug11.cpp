@@ -81,19 +81,19 @@ namespace Direct3D11
 
 	Result Debug::ValidateContext(DeviceContext^ context)
 	{
-		HRESULT hr = InternalPointer->ValidateContext(context->InternalPointer);
+		HRESULT hr = TIME_CALL( InternalPointer->ValidateContext(context->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
 	Result Debug::ValidateContextForDispatch(DeviceContext^ context)
 	{
-		HRESULT hr = InternalPointer->ValidateContextForDispatch(context->InternalPointer);
+		HRESULT hr = TIME_CALL( InternalPointer->ValidateContextForDispatch(context->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
 	Result Debug::ReportLiveDeviceObjects(ReportingLevel level)
 	{
-		HRESULT hr = InternalPointer->ReportLiveDeviceObjects(static_cast<D3D11_RLDO_FLAGS>(level));
+		HRESULT hr = TIME_CALL( InternalPointer->ReportLiveDeviceObjects(static_cast<D3D11_RLDO_FLAGS>(level)) );
 		return RECORD_D3D11(hr);
 	}
 }
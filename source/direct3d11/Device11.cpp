@@ -87,8 +87,8 @@ namespace Direct3D11
 		ID3D11Device* device = 0;
 		ID3D11DeviceContext* context = NULL;
 
-		HRESULT hr = D3D11CreateDevice( nativeAdapter, static_cast<D3D_DRIVER_TYPE>( driverType ), NULL, static_cast<UINT>( flags ), 
-			featureLevels, count, D3D11_SDK_VERSION, &device, NULL, &context );
+		HRESULT hr = TIME_CALL( D3D11CreateDevice( nativeAdapter, static_cast<D3D_DRIVER_TYPE>( driverType ), NULL, static_cast<UINT>( flags ), 
+			featureLevels, count, D3D11_SDK_VERSION, &device, NULL, &context ) );
 
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
@@ -105,7 +105,7 @@ namespace Direct3D11
 			return nullptr;
 
 		IDXGIAdapter *adapter = 0;
-		HRESULT hr = device->GetAdapter(&adapter);
+		HRESULT hr = TIME_CALL( device->GetAdapter(&adapter) );
 		if (FAILED(hr))
 			device->Release();
 
@@ -115,13 +115,13 @@ namespace Direct3D11
 		SlimDX::DXGI::Factory^ result = nullptr;
 
 		IDXGIFactory1 *factory1;
-		hr = adapter->GetParent(IID_IDXGIFactory1, reinterpret_cast<void**>(&factory1));
+		hr = TIME_CALL( adapter->GetParent(IID_IDXGIFactory1, reinterpret_cast<void**>(&factory1)) );
 		if (SUCCEEDED(hr))
 			result = SlimDX::DXGI::Factory1::FromPointer(factory1, this);
 		else
 		{
 			IDXGIFactory *factory;
-			hr = adapter->GetParent(IID_IDXGIFactory, reinterpret_cast<void**>(&factory));
+			hr = TIME_CALL( adapter->GetParent(IID_IDXGIFactory, reinterpret_cast<void**>(&factory)) );
 			if (SUCCEEDED(hr))
 				result = SlimDX::DXGI::Factory::FromPointer(factory, this);
 		}
@@ -163,7 +163,7 @@ namespace Direct3D11
 	{
 		ID3D11SwitchToRef *switcher;
 
-		HRESULT hr = InternalPointer->QueryInterface(IID_ID3D11SwitchToRef, reinterpret_cast<void**>(&switcher));
+		HRESULT hr = TIME_CALL( InternalPointer->QueryInterface(IID_ID3D11SwitchToRef, reinterpret_cast<void**>(&switcher)) );
 		if (FAILED(hr))
 			return false;
 
@@ -242,7 +242,7 @@ namespace Direct3D11
 		D3D11_FEATURE_DATA_FORMAT_SUPPORT2 support;
 		support.InFormat = static_cast<DXGI_FORMAT>( format );
 
-		HRESULT hr = InternalPointer->CheckFeatureSupport( D3D11_FEATURE_FORMAT_SUPPORT2, &support, sizeof( D3D11_FEATURE_DATA_FORMAT_SUPPORT2 ) );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckFeatureSupport( D3D11_FEATURE_FORMAT_SUPPORT2, &support, sizeof( D3D11_FEATURE_DATA_FORMAT_SUPPORT2 ) ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return ComputeShaderFormatSupport::None;
 
@@ -255,7 +255,7 @@ namespace Direct3D11
 		{
 			D3D11_FEATURE_DATA_DOUBLES support;
 
-			HRESULT hr = InternalPointer->CheckFeatureSupport( D3D11_FEATURE_DOUBLES, &support, sizeof( D3D11_FEATURE_DATA_DOUBLES ) );
+			HRESULT hr = TIME_CALL( InternalPointer->CheckFeatureSupport( D3D11_FEATURE_DOUBLES, &support, sizeof( D3D11_FEATURE_DATA_DOUBLES ) ) );
 			if( RECORD_D3D11( hr ).IsFailure )
 				return false;
 
@@ -265,7 +265,7 @@ namespace Direct3D11
 		{
 			D3D11_FEATURE_DATA_D3D10_X_HARDWARE_OPTIONS support;
 
-			HRESULT hr = InternalPointer->CheckFeatureSupport( D3D11_FEATURE_D3D10_X_HARDWARE_OPTIONS, &support, sizeof( D3D11_FEATURE_DATA_D3D10_X_HARDWARE_OPTIONS ) );
+			HRESULT hr = TIME_CALL( InternalPointer->CheckFeatureSupport( D3D11_FEATURE_D3D10_X_HARDWARE_OPTIONS, &support, sizeof( D3D11_FEATURE_DATA_D3D10_X_HARDWARE_OPTIONS ) ) );
 			if( RECORD_D3D11( hr ).IsFailure )
 				return false;
 
@@ -279,7 +279,7 @@ namespace Direct3D11
 	{
 		D3D11_FEATURE_DATA_THREADING support;
 
-		HRESULT hr = InternalPointer->CheckFeatureSupport( D3D11_FEATURE_THREADING, &support, sizeof( D3D11_FEATURE_DATA_THREADING ) );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckFeatureSupport( D3D11_FEATURE_THREADING, &support, sizeof( D3D11_FEATURE_DATA_THREADING ) ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 		{
 			supportsConcurrentResources = false;
@@ -291,7 +291,7 @@ namespace Direct3D11
 			supportsCommandLists = support.DriverCommandLists != 0;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 	
 	int Device::CheckMultisampleQualityLevels( DXGI::Format format, int sampleCount )
@@ -305,7 +305,7 @@ namespace Direct3D11
 	{
 		D3D_FEATURE_LEVEL outputLevel;
 
-		HRESULT hr = D3D11CreateDevice( NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, 0, NULL, 0, D3D11_SDK_VERSION, NULL, &outputLevel, NULL );
+		HRESULT hr = TIME_CALL( D3D11CreateDevice( NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, 0, NULL, 0, D3D11_SDK_VERSION, NULL, &outputLevel, NULL ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return static_cast<Direct3D11::FeatureLevel>(0);
 
@@ -316,7 +316,7 @@ namespace Direct3D11
 	{
 		D3D_FEATURE_LEVEL outputLevel;
 
-		HRESULT hr = D3D11CreateDevice( adapter->InternalPointer, D3D_DRIVER_TYPE_UNKNOWN, NULL, 0, NULL, 0, D3D11_SDK_VERSION, NULL, &outputLevel, NULL );
+		HRESULT hr = TIME_CALL( D3D11CreateDevice( adapter->InternalPointer, D3D_DRIVER_TYPE_UNKNOWN, NULL, 0, NULL, 0, D3D11_SDK_VERSION, NULL, &outputLevel, NULL ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return static_cast<Direct3D11::FeatureLevel>(0);
 
@@ -329,7 +329,7 @@ namespace Direct3D11
 		GUID guid = Utilities::GetNativeGuidForType( T::typeid );
 		ID3D11Resource* resultPointer;
 
-		HRESULT hr = InternalPointer->OpenSharedResource( handle.ToPointer(), guid, (void**)&resultPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->OpenSharedResource( handle.ToPointer(), guid, (void**)&resultPointer ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return T();
 
@@ -389,9 +389,9 @@ namespace Direct3D11
 			count = featureLevels->Length;
 		}
 		
-		HRESULT hr = D3D11CreateDeviceAndSwapChain( nativeAdapter, static_cast<D3D_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), 
+		HRESULT hr = TIME_CALL( D3D11CreateDeviceAndSwapChain( nativeAdapter, static_cast<D3D_DRIVER_TYPE>( driverType ), 0, static_cast<UINT>( flags ), 
 			nativeLevels, count, D3D11_SDK_VERSION, 
-			&nativeDescription, &resultSwapChain, &resultDevice, NULL, &context );
+			&nativeDescription, &resultSwapChain, &resultDevice, NULL, &context ) );
 
 		if( RECORD_D3D11( hr ).IsFailure )
 		{
@@ -405,7 +405,7 @@ namespace Direct3D11
 			context->Release();
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 }
 }
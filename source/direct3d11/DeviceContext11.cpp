@@ -102,7 +102,7 @@ namespace Direct3D11
 	{
 		ID3D11DeviceContext* context;
 
-		HRESULT hr = device->InternalPointer->CreateDeferredContext( 0, &context );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateDeferredContext( 0, &context ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -245,7 +245,7 @@ namespace Direct3D11
 	{
 		ID3D11CommandList* commands;
 
-		HRESULT hr = InternalPointer->FinishCommandList( restoreState, &commands );
+		HRESULT hr = TIME_CALL( InternalPointer->FinishCommandList( restoreState, &commands ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return nullptr;
 
@@ -343,7 +343,7 @@ namespace Direct3D11
 		int subresource = D3D11CalcSubresource(mipSlice, arraySlice, desc.MipLevels);
 
 		D3D11_MAPPED_SUBRESOURCE mapped;
-		HRESULT hr = InternalPointer->Map(resource->InternalPointer, subresource, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped);
+		HRESULT hr = TIME_CALL( InternalPointer->Map(resource->InternalPointer, subresource, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -357,7 +357,7 @@ namespace Direct3D11
 		int subresource = D3D11CalcSubresource(mipSlice, arraySlice, desc.MipLevels);
 
 		D3D11_MAPPED_SUBRESOURCE mapped;
-		HRESULT hr = InternalPointer->Map(resource->InternalPointer, subresource, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped);
+		HRESULT hr = TIME_CALL( InternalPointer->Map(resource->InternalPointer, subresource, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -375,7 +375,7 @@ namespace Direct3D11
 		int subresource = D3D11CalcSubresource(mipSlice, arraySlice, desc.MipLevels);
 
 		D3D11_MAPPED_SUBRESOURCE mapped;
-		HRESULT hr = InternalPointer->Map(resource->InternalPointer, subresource, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped);
+		HRESULT hr = TIME_CALL( InternalPointer->Map(resource->InternalPointer, subresource, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -385,7 +385,7 @@ namespace Direct3D11
 	DataBox^ DeviceContext::MapSubresource(Buffer^ resource, MapMode mode, MapFlags flags)
 	{
 		D3D11_MAPPED_SUBRESOURCE mapped;
-		HRESULT hr = InternalPointer->Map(resource->InternalPointer, 0, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped);
+		HRESULT hr = TIME_CALL( InternalPointer->Map(resource->InternalPointer, 0, static_cast<D3D11_MAP>(mode), static_cast<UINT>(flags), &mapped) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -0,0 +1,266 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "../DataStream.h"
+
+#include "Direct3D11Exception.h"
+
+#include "Buffer11.h"
+#include "Device11.h"
+#include "DeviceContext11.h"
+#include "DynamicBufferRing11.h"
+#include "Query11.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Collections::Generic;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	DynamicBufferRing::DynamicBufferRing( SlimDX::Direct3D11::Device^ device, int sizeInBytes, BindFlags bindFlags )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( sizeInBytes <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "sizeInBytes" );
+		if( ( bindFlags & ~( BindFlags::VertexBuffer | BindFlags::IndexBuffer ) ) != BindFlags::None || bindFlags == BindFlags::None )
+			throw gcnew ArgumentException( "A dynamic buffer ring can only be bound as a vertex or index buffer.", "bindFlags" );
+
+		m_Device = device;
+		m_Buffer = gcnew SlimDX::Direct3D11::Buffer( device, sizeInBytes, ResourceUsage::Dynamic, bindFlags, CpuAccessFlags::Write, ResourceOptionFlags::None, 0 );
+		m_Fences = gcnew Queue<Fence>();
+		m_FreeQueries = gcnew Stack<SlimDX::Direct3D11::Query^>();
+		m_Size = sizeInBytes;
+		m_NeedsDiscard = true;
+	}
+
+	DynamicBufferRing::~DynamicBufferRing()
+	{
+		for each( Fence fence in m_Fences )
+			delete fence.Event;
+		for each( SlimDX::Direct3D11::Query^ query in m_FreeQueries )
+			delete query;
+
+		m_Fences->Clear();
+		m_FreeQueries->Clear();
+
+		delete m_Buffer;
+		m_Buffer = nullptr;
+	}
+
+	generic<typename T> where T : value class
+	int DynamicBufferRing::Write( DeviceContext^ context, array<T>^ data )
+	{
+		if( data == nullptr )
+			throw gcnew ArgumentNullException( "data" );
+
+		return Write( context, data, 0, data->Length, sizeof(T) );
+	}
+
+	generic<typename T> where T : value class
+	int DynamicBufferRing::Write( DeviceContext^ context, array<T>^ data, int startIndex, int count, int alignment )
+	{
+		if( data == nullptr )
+			throw gcnew ArgumentNullException( "data" );
+
+		Utilities::CheckArrayBounds( data, startIndex, count );
+
+		pin_ptr<T> pinnedData = &data[startIndex];
+		return Write( context, pinnedData, count * static_cast<int>( sizeof(T) ), alignment );
+	}
+
+	int DynamicBufferRing::Write( DeviceContext^ context, DataStream^ data, int sizeInBytes, int alignment )
+	{
+		if( data == nullptr )
+			throw gcnew ArgumentNullException( "data" );
+		if( sizeInBytes > data->RemainingLength )
+			throw gcnew EndOfStreamException();
+
+		int offset = Write( context, data->PositionPointer, sizeInBytes, alignment );
+		if( offset >= 0 )
+			data->Position += sizeInBytes;
+
+		return offset;
+	}
+
+	int DynamicBufferRing::Write( DeviceContext^ context, const void* data, int sizeInBytes, int alignment )
+	{
+		if( context == nullptr )
+			throw gcnew ArgumentNullException( "context" );
+		if( sizeInBytes <= 0 || sizeInBytes > m_Size )
+			throw gcnew ArgumentOutOfRangeException( "sizeInBytes" );
+		if( alignment <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "alignment" );
+
+		D3D11_MAP mode = D3D11_MAP_WRITE_NO_OVERWRITE;
+		int offset = -1;
+
+		if( !m_NeedsDiscard )
+		{
+			offset = Allocate( sizeInBytes, alignment );
+			if( offset < 0 )
+			{
+				Retire( context );
+				offset = Allocate( sizeInBytes, alignment );
+			}
+
+			if( offset < 0 )
+				++m_DiscardCount;
+		}
+
+		if( offset < 0 )
+		{
+			// the driver renames the buffer on discard, so everything still in flight stays valid
+			Reset();
+			offset = Allocate( sizeInBytes, alignment );
+			mode = D3D11_MAP_WRITE_DISCARD;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+		HRESULT hr = TIME_CALL( context->InternalPointer->Map( m_Buffer->InternalPointer, 0, mode, 0, &mapped ) );
+		if( RECORD_D3D11( hr ).IsFailure )
+		{
+			if( mode == D3D11_MAP_WRITE_DISCARD )
+				m_NeedsDiscard = true;
+			return -1;
+		}
+
+		memcpy( static_cast<char*>( mapped.pData ) + offset, data, sizeInBytes );
+		context->InternalPointer->Unmap( m_Buffer->InternalPointer, 0 );
+
+		return offset;
+	}
+
+	int DynamicBufferRing::Allocate( int sizeInBytes, int alignment )
+	{
+		// [tail, head) holds data the GPU may still read; a full ring has head == tail with bytes in use
+		if( m_Head == m_Tail && m_Used > 0 )
+			return -1;
+
+		int aligned = ( ( m_Head + alignment - 1 ) / alignment ) * alignment;
+		int offset;
+		int consumed;
+
+		if( m_Head >= m_Tail )
+		{
+			if( aligned <= m_Size - sizeInBytes )
+			{
+				offset = aligned;
+				consumed = aligned + sizeInBytes - m_Head;
+			}
+			else if( sizeInBytes <= m_Tail )
+			{
+				// skip the remainder of the buffer and wrap around
+				offset = 0;
+				consumed = m_Size - m_Head + sizeInBytes;
+			}
+			else
+				return -1;
+		}
+		else
+		{
+			if( aligned > m_Tail - sizeInBytes )
+				return -1;
+
+			offset = aligned;
+			consumed = aligned + sizeInBytes - m_Head;
+		}
+
+		m_Head = offset + sizeInBytes;
+		m_Used += consumed;
+		m_FrameUsed += consumed;
+		m_FrameBytes += consumed;
+
+		if( m_Used > m_PeakUsedBytes )
+			m_PeakUsedBytes = m_Used;
+
+		return offset;
+	}
+
+	void DynamicBufferRing::Retire( DeviceContext^ context )
+	{
+		while( m_Fences->Count > 0 )
+		{
+			Fence fence = m_Fences->Peek();
+			if( !context->IsDataAvailable( fence.Event, AsynchronousFlags::DoNotFlush ) )
+				break;
+
+			m_Fences->Dequeue();
+			m_FreeQueries->Push( fence.Event );
+			m_Tail = fence.End;
+			m_Used -= fence.Bytes;
+		}
+
+		if( m_Used == 0 && m_Fences->Count == 0 )
+		{
+			m_Head = 0;
+			m_Tail = 0;
+		}
+	}
+
+	void DynamicBufferRing::Reset()
+	{
+		while( m_Fences->Count > 0 )
+			m_FreeQueries->Push( m_Fences->Dequeue().Event );
+
+		m_Head = 0;
+		m_Tail = 0;
+		m_Used = 0;
+		m_FrameUsed = 0;
+		m_NeedsDiscard = false;
+	}
+
+	void DynamicBufferRing::EndFrame( DeviceContext^ context )
+	{
+		if( context == nullptr )
+			throw gcnew ArgumentNullException( "context" );
+
+		if( m_FrameUsed > 0 )
+		{
+			SlimDX::Direct3D11::Query^ query;
+			if( m_FreeQueries->Count > 0 )
+				query = m_FreeQueries->Pop();
+			else
+				query = gcnew SlimDX::Direct3D11::Query( m_Device, QueryDescription( QueryType::Event, QueryFlags::None ) );
+
+			context->End( query );
+
+			Fence fence;
+			fence.Event = query;
+			fence.End = m_Head;
+			fence.Bytes = m_FrameUsed;
+			m_Fences->Enqueue( fence );
+		}
+
+		m_LastFrameBytes = m_FrameBytes;
+		if( m_FrameBytes > m_PeakFrameBytes )
+			m_PeakFrameBytes = m_FrameBytes;
+		m_FrameBytes = 0;
+		m_FrameUsed = 0;
+
+		Retire( context );
+	}
+}
+}
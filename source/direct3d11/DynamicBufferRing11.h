@@ -0,0 +1,198 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "Enums11.h"
+
+namespace SlimDX
+{
+	ref class DataStream;
+
+	namespace Direct3D11
+	{
+		ref class Buffer;
+		ref class Device;
+		ref class DeviceContext;
+		ref class Query;
+
+		/// <summary>
+		/// Sub-allocates per-draw vertex and index data from a single dynamic buffer.
+		/// </summary>
+		/// <remarks>
+		/// Each write maps the buffer with <see cref="MapMode">MapMode.WriteNoOverwrite</see> into space the GPU is known to be
+		/// finished with and returns the byte offset of the data, which can be passed to <c>SetVertexBuffers</c> or <c>SetIndexBuffer</c>.
+		/// Call <see cref="EndFrame"/> once per frame; it inserts an event query that tells the ring when the frame's space can be reused.
+		/// If the ring runs out of retired space it is mapped with <see cref="MapMode">MapMode.WriteDiscard</see> and starts over, so a
+		/// write never waits for the GPU.
+		///
+		/// Direct3D 11.0 cannot map constant buffers with <c>WriteNoOverwrite</c> or bind them at an offset, so the ring cannot be
+		/// created with <see cref="BindFlags">BindFlags.ConstantBuffer</see>.
+		/// </remarks>
+		public ref class DynamicBufferRing sealed
+		{
+		private:
+			value class Fence
+			{
+			public:
+				Query^ Event;
+				int End;
+				int Bytes;
+			};
+
+			SlimDX::Direct3D11::Device^ m_Device;
+			SlimDX::Direct3D11::Buffer^ m_Buffer;
+			System::Collections::Generic::Queue<Fence>^ m_Fences;
+			System::Collections::Generic::Stack<SlimDX::Direct3D11::Query^>^ m_FreeQueries;
+			int m_Size;
+			int m_Head;
+			int m_Tail;
+			int m_Used;
+			int m_FrameUsed;
+			int m_FrameBytes;
+			int m_LastFrameBytes;
+			int m_PeakFrameBytes;
+			int m_PeakUsedBytes;
+			int m_DiscardCount;
+			bool m_NeedsDiscard;
+
+			int Write( DeviceContext^ context, const void* data, int sizeInBytes, int alignment );
+			int Allocate( int sizeInBytes, int alignment );
+			void Retire( DeviceContext^ context );
+			void Reset();
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="DynamicBufferRing"/> class.
+			/// </summary>
+			/// <param name="device">The device used to create the buffer and its queries.</param>
+			/// <param name="sizeInBytes">The size of the underlying buffer, in bytes.</param>
+			/// <param name="bindFlags">How the buffer will be bound; any combination of <see cref="BindFlags">BindFlags.VertexBuffer</see> and <see cref="BindFlags">BindFlags.IndexBuffer</see>.</param>
+			DynamicBufferRing( SlimDX::Direct3D11::Device^ device, int sizeInBytes, BindFlags bindFlags );
+
+			/// <summary>
+			/// Releases the buffer and the queries owned by the ring.
+			/// </summary>
+			~DynamicBufferRing();
+
+			/// <summary>
+			/// Copies an array of elements into the ring, aligned to the element size.
+			/// </summary>
+			/// <param name="context">The context used to map the buffer.</param>
+			/// <param name="data">The elements to write.</param>
+			/// <returns>The byte offset of the data within <see cref="Buffer"/>, or -1 if the buffer could not be mapped.</returns>
+			generic<typename T> where T : value class
+			int Write( DeviceContext^ context, array<T>^ data );
+
+			/// <summary>
+			/// Copies a range of an array into the ring.
+			/// </summary>
+			/// <param name="context">The context used to map the buffer.</param>
+			/// <param name="data">The elements to write.</param>
+			/// <param name="startIndex">The index of the first element to write.</param>
+			/// <param name="count">The number of elements to write.</param>
+			/// <param name="alignment">The alignment of the returned offset, in bytes.</param>
+			/// <returns>The byte offset of the data within <see cref="Buffer"/>, or -1 if the buffer could not be mapped.</returns>
+			generic<typename T> where T : value class
+			int Write( DeviceContext^ context, array<T>^ data, int startIndex, int count, int alignment );
+
+			/// <summary>
+			/// Copies bytes from the current position of a stream into the ring and advances the stream.
+			/// </summary>
+			/// <param name="context">The context used to map the buffer.</param>
+			/// <param name="data">The stream to read from.</param>
+			/// <param name="sizeInBytes">The number of bytes to write.</param>
+			/// <param name="alignment">The alignment of the returned offset, in bytes.</param>
+			/// <returns>The byte offset of the data within <see cref="Buffer"/>, or -1 if the buffer could not be mapped.</returns>
+			int Write( DeviceContext^ context, DataStream^ data, int sizeInBytes, int alignment );
+
+			/// <summary>
+			/// Marks the end of the current frame's writes.
+			/// </summary>
+			/// <param name="context">The immediate context that will submit the frame's draws.</param>
+			void EndFrame( DeviceContext^ context );
+
+			/// <summary>
+			/// Gets the buffer that writes are placed in.
+			/// </summary>
+			property SlimDX::Direct3D11::Buffer^ Buffer
+			{
+				SlimDX::Direct3D11::Buffer^ get() { return m_Buffer; }
+			}
+
+			/// <summary>
+			/// Gets the size of the ring, in bytes.
+			/// </summary>
+			property int SizeInBytes
+			{
+				int get() { return m_Size; }
+			}
+
+			/// <summary>
+			/// Gets the number of bytes that are written but not yet known to be consumed by the GPU.
+			/// </summary>
+			property int UsedBytes
+			{
+				int get() { return m_Used; }
+			}
+
+			/// <summary>
+			/// Gets the number of bytes written since the last call to <see cref="EndFrame"/>, including alignment padding.
+			/// </summary>
+			property int CurrentFrameBytes
+			{
+				int get() { return m_FrameBytes; }
+			}
+
+			/// <summary>
+			/// Gets the number of bytes written during the most recently completed frame.
+			/// </summary>
+			property int LastFrameBytes
+			{
+				int get() { return m_LastFrameBytes; }
+			}
+
+			/// <summary>
+			/// Gets the largest number of bytes written during a single frame.
+			/// </summary>
+			property int PeakFrameBytes
+			{
+				int get() { return m_PeakFrameBytes; }
+			}
+
+			/// <summary>
+			/// Gets the largest number of bytes that have been in use at once.
+			/// </summary>
+			property int PeakUsedBytes
+			{
+				int get() { return m_PeakUsedBytes; }
+			}
+
+			/// <summary>
+			/// Gets the number of times the ring ran out of retired space and discarded the buffer.
+			/// </summary>
+			property int DiscardCount
+			{
+				int get() { return m_DiscardCount; }
+			}
+		};
+	}
+}
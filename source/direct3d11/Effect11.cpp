@@ -36,6 +36,7 @@
 #include "Effect11.h"
 
 using namespace System;
+using namespace System::Collections::Generic;
 using namespace System::IO;
 using namespace System::Globalization;
 using namespace System::Runtime::InteropServices;
@@ -48,7 +49,7 @@ namespace Direct3D11
 	{
 		ID3DX11Effect *effect;
 
-		HRESULT hr = D3DX11CreateEffectFromMemory( data->InternalPointer->GetBufferPointer(), data->InternalPointer->GetBufferSize(), 0, device->InternalPointer, &effect);
+		HRESULT hr = TIME_CALL( D3DX11CreateEffectFromMemory( data->InternalPointer->GetBufferPointer(), data->InternalPointer->GetBufferSize(), 0, device->InternalPointer, &effect) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -162,13 +163,23 @@ namespace Direct3D11
 	
 	EffectVariable^ Effect::GetVariableByName( System::String^ name )
 	{
+		// lookups by name usually happen every frame, so keep the wrappers instead of allocating new ones
+		EffectVariable^ result;
+		if( m_VariablesByName != nullptr && m_VariablesByName->TryGetValue( name, result ) )
+			return result;
+
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[ 0 ];
 		ID3DX11EffectVariable* variable = InternalPointer->GetVariableByName( reinterpret_cast<LPCSTR>( pinnedName ) );
 		if( variable == 0 )
 			return nullptr;
 		
-		return gcnew EffectVariable( variable );
+		if( m_VariablesByName == nullptr )
+			m_VariablesByName = gcnew Dictionary<String^, EffectVariable^>();
+
+		result = gcnew EffectVariable( variable );
+		m_VariablesByName->Add( name, result );
+		return result;
 	}
 	
 	EffectVariable^ Effect::GetVariableBySemantic( System::String^ name )
@@ -191,7 +202,7 @@ namespace Direct3D11
 	{
 		ID3DX11Effect *result;
 
-		HRESULT hr = InternalPointer->CloneEffect(forceNonSingle ? D3DX11_EFFECT_CLONE_FORCE_NONSINGLE : 0, &result);
+		HRESULT hr = TIME_CALL( InternalPointer->CloneEffect(forceNonSingle ? D3DX11_EFFECT_CLONE_FORCE_NONSINGLE : 0, &result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -200,6 +211,7 @@ namespace Direct3D11
 	
 	Result Effect::Optimize()
 	{
+		m_VariablesByName = nullptr;
 		return RECORD_D3D11( InternalPointer->Optimize() );
 	}
 }
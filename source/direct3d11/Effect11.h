@@ -49,6 +49,9 @@ namespace SlimDX
 		{
 			COMOBJECT(ID3DX11Effect, Effect);
 
+		private:
+			System::Collections::Generic::Dictionary<System::String^, EffectVariable^>^ m_VariablesByName;
+
 		public:
 			/// <summary>
 			/// Initializes a new instance of the <see cref="Effect"/> class.
@@ -49,7 +49,7 @@ namespace Direct3D11
 	{
 		ID3D11BlendState *result;
 
-		HRESULT hr = m_Pointer->GetBlendState(index, &result);
+		HRESULT hr = TIME_CALL( m_Pointer->GetBlendState(index, &result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -58,7 +58,7 @@ namespace Direct3D11
 
 	Result EffectBlendVariable::SetBlendState(int index, BlendState^ blendState)
 	{
-		HRESULT hr = m_Pointer->SetBlendState(index, blendState->InternalPointer);
+		HRESULT hr = TIME_CALL( m_Pointer->SetBlendState(index, blendState->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -66,7 +66,7 @@ namespace Direct3D11
 	{
 		D3D11_BLEND_DESC desc;
 
-		HRESULT hr = m_Pointer->GetBackingStore(index, &desc);
+		HRESULT hr = TIME_CALL( m_Pointer->GetBackingStore(index, &desc) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return BlendStateDescription();
 
@@ -75,7 +75,7 @@ namespace Direct3D11
 
 	Result EffectBlendVariable::UndoSetBlendState(int index)
 	{
-		HRESULT hr = m_Pointer->UndoSetBlendState(index);
+		HRESULT hr = TIME_CALL( m_Pointer->UndoSetBlendState(index) );
 		return RECORD_D3D11(hr);
 	}
 }
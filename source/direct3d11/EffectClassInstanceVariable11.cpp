@@ -50,7 +50,7 @@ namespace Direct3D11
 	{
 		ID3D11ClassInstance *result;
 
-		HRESULT hr = m_Pointer->GetClassInstance(&result);
+		HRESULT hr = TIME_CALL( m_Pointer->GetClassInstance(&result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
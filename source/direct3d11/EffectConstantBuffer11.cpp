@@ -81,13 +81,13 @@ namespace Direct3D11
 
 	Result EffectConstantBuffer::UndoSetConstantBuffer()
 	{
-		HRESULT hr = m_Pointer->UndoSetConstantBuffer();
+		HRESULT hr = TIME_CALL( m_Pointer->UndoSetConstantBuffer() );
 		return RECORD_D3D11(hr);
 	}
 
 	Result EffectConstantBuffer::UndoSetTextureBuffer()
 	{
-		HRESULT hr = m_Pointer->UndoSetTextureBuffer();
+		HRESULT hr = TIME_CALL( m_Pointer->UndoSetTextureBuffer() );
 		return RECORD_D3D11(hr);
 	}
 }
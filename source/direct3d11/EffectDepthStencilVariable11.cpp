@@ -49,7 +49,7 @@ namespace Direct3D11
 	{
 		ID3D11DepthStencilState *result;
 
-		HRESULT hr = m_Pointer->GetDepthStencilState(index, &result);
+		HRESULT hr = TIME_CALL( m_Pointer->GetDepthStencilState(index, &result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -58,7 +58,7 @@ namespace Direct3D11
 
 	Result EffectDepthStencilVariable::SetDepthStencilState(int index, DepthStencilState^ blendState)
 	{
-		HRESULT hr = m_Pointer->SetDepthStencilState(index, blendState->InternalPointer);
+		HRESULT hr = TIME_CALL( m_Pointer->SetDepthStencilState(index, blendState->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -66,7 +66,7 @@ namespace Direct3D11
 	{
 		D3D11_DEPTH_STENCIL_DESC desc;
 
-		HRESULT hr = m_Pointer->GetBackingStore(index, &desc);
+		HRESULT hr = TIME_CALL( m_Pointer->GetBackingStore(index, &desc) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return DepthStencilStateDescription();
 
@@ -75,7 +75,7 @@ namespace Direct3D11
 
 	Result EffectDepthStencilVariable::UndoSetDepthStencilState(int index)
 	{
-		HRESULT hr = m_Pointer->UndoSetDepthStencilState(index);
+		HRESULT hr = TIME_CALL( m_Pointer->UndoSetDepthStencilState(index) );
 		return RECORD_D3D11(hr);
 	}
 }
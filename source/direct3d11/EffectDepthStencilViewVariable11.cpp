@@ -66,14 +66,14 @@ namespace Direct3D11
 		Utilities::CheckArrayBounds(views, offset, count);
 
 		stack_array<ID3D11DepthStencilView*> nativeViews = stackalloc(ID3D11DepthStencilView*, count);
-		HRESULT hr = m_Pointer->GetDepthStencilArray(&nativeViews[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetDepthStencilArray(&nativeViews[0], 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return Result::Last;
 
 		for (int i = 0; i < count; i++)
 			views[i + offset] = DepthStencilView::FromPointer(nativeViews[i]);
 
-		return Result::Last;
+		return Result(hr);
 	}
 	
 	Result EffectDepthStencilViewVariable::SetView( DepthStencilView^ view )
@@ -97,7 +97,7 @@ namespace Direct3D11
 		for (int i = 0; i < count; i++)
 			nativeViews[i] = views[i + offset]->InternalPointer;
 
-		HRESULT hr = m_Pointer->SetDepthStencilArray(&nativeViews[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->SetDepthStencilArray(&nativeViews[0], 0, count) );
 		return RECORD_D3D11(hr);
 	}
 }
@@ -47,7 +47,7 @@ namespace Direct3D11
 	{
 		ID3DX11EffectClassInstanceVariable *result;
 
-		HRESULT hr = m_Pointer->GetClassInstance(&result);
+		HRESULT hr = TIME_CALL( m_Pointer->GetClassInstance(&result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -56,7 +56,7 @@ namespace Direct3D11
 
 	void EffectInterfaceVariable::ClassInstance::set(EffectClassInstanceVariable^ value)
 	{
-		HRESULT hr = m_Pointer->SetClassInstance(value->m_Pointer);
+		HRESULT hr = TIME_CALL( m_Pointer->SetClassInstance(value->m_Pointer) );
 		RECORD_D3D11(hr);
 	}
 }
@@ -56,13 +56,13 @@ namespace Direct3D11
 	{
 		Matrix matrix;
 
-		HRESULT hr = m_Pointer->GetMatrix(reinterpret_cast<float*>(&matrix));
+		HRESULT hr = TIME_CALL( m_Pointer->GetMatrix(reinterpret_cast<float*>(&matrix)) );
 		if (RECORD_D3D11(hr).IsFailure)
 			result = Matrix::Identity;
 		else
 			result = matrix;
 
-		return Result::Last;
+		return Result(hr);
 	}
 
 	Result EffectMatrixVariable::GetMatrixArray(array<Matrix>^ matrices)
@@ -75,7 +75,7 @@ namespace Direct3D11
 		Utilities::CheckArrayBounds(matrices, offset, count);
 		pin_ptr<Matrix> pinnedMatrices = &matrices[offset];
 
-		HRESULT hr = m_Pointer->GetMatrixArray(reinterpret_cast<float*>(pinnedMatrices), 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetMatrixArray(reinterpret_cast<float*>(pinnedMatrices), 0, count) );
 		return RECORD_D3D11(hr);
 	}
 	
@@ -91,13 +91,13 @@ namespace Direct3D11
 	{
 		Matrix matrix;
 
-		HRESULT hr = m_Pointer->GetMatrixTranspose(reinterpret_cast<float*>(&matrix));
+		HRESULT hr = TIME_CALL( m_Pointer->GetMatrixTranspose(reinterpret_cast<float*>(&matrix)) );
 		if (RECORD_D3D11(hr).IsFailure)
 			result = Matrix::Identity;
 		else
 			result = matrix;
 
-		return Result::Last;
+		return Result(hr);
 	}
 
 	Result EffectMatrixVariable::GetMatrixTransposeArray(array<Matrix>^ matrices)
@@ -110,7 +110,7 @@ namespace Direct3D11
 		Utilities::CheckArrayBounds(matrices, offset, count);
 		pin_ptr<Matrix> pinnedMatrices = &matrices[offset];
 
-		HRESULT hr = m_Pointer->GetMatrixTransposeArray(reinterpret_cast<float*>(pinnedMatrices), 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetMatrixTransposeArray(reinterpret_cast<float*>(pinnedMatrices), 0, count) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -0,0 +1,326 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Direct3D11Exception.h"
+
+#include "ConstantPacking11.h"
+#include "Effect11.h"
+#include "EffectParameterBlock11.h"
+#include "EffectParameterBlockKernels11.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+using namespace SlimDX::D3DCompiler;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	EffectParameterBlock::EffectParameterBlock( SlimDX::Direct3D11::Effect^ effect, ... array<String^>^ names )
+	{
+		if( effect == nullptr )
+			throw gcnew ArgumentNullException( "effect" );
+		if( names == nullptr )
+			throw gcnew ArgumentNullException( "names" );
+
+		m_Effect = effect;
+		m_Block = new NativeEffectParameterBlock();
+		m_Parameters = gcnew array<ConstantBufferField>( names->Length );
+
+		for( int i = 0; i < names->Length; ++i )
+		{
+			if( names[i] == nullptr )
+				throw gcnew ArgumentException( "The variable names cannot be null.", "names" );
+
+			ID3DX11EffectVariable* variable = Resolve( effect, names[i] );
+			if( variable == NULL )
+				throw gcnew ArgumentException( String::Format( "The effect has no variable named '{0}'.", names[i] ), "names" );
+
+			D3DX11_EFFECT_TYPE_DESC type;
+			UINT offset;
+			if( m_Block->AddParameter( variable, type, offset ) < 0 )
+				throw gcnew ArgumentException( String::Format( "The variable '{0}' is not stored in a constant buffer.", names[i] ), "names" );
+
+			int stride = type.Stride != 0 ? type.Stride : ( type.UnpackedSize + 15 ) & ~15;
+			m_Parameters[i] = ConstantBufferField( names[i], offset, type.UnpackedSize, static_cast<ShaderVariableClass>( type.Class ),
+				static_cast<ShaderVariableType>( type.Type ), type.Rows, type.Columns, type.Elements, stride );
+		}
+	}
+
+	EffectParameterBlock::~EffectParameterBlock()
+	{
+		this->!EffectParameterBlock();
+	}
+
+	EffectParameterBlock::!EffectParameterBlock()
+	{
+		delete m_Block;
+		m_Block = NULL;
+	}
+
+	void EffectParameterBlock::CheckDisposed()
+	{
+		if( m_Block == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	ID3DX11EffectVariable* EffectParameterBlock::Resolve( SlimDX::Direct3D11::Effect^ effect, String^ name )
+	{
+		ID3DX11EffectVariable* variable = NULL;
+		array<String^>^ parts = name->Split( '.' );
+
+		for( int i = 0; i < parts->Length; ++i )
+		{
+			String^ part = parts[i];
+			int element = -1;
+
+			int open = part->IndexOf( '[' );
+			if( open >= 0 )
+			{
+				if( !part->EndsWith( "]" ) || !Int32::TryParse( part->Substring( open + 1, part->Length - open - 2 ), element ) || element < 0 )
+					return NULL;
+
+				part = part->Substring( 0, open );
+			}
+
+			IntPtr nativeName = Marshal::StringToHGlobalAnsi( part );
+			try
+			{
+				LPCSTR text = reinterpret_cast<LPCSTR>( nativeName.ToPointer() );
+				variable = i == 0 ? effect->InternalPointer->GetVariableByName( text ) : variable->GetMemberByName( text );
+			}
+			finally
+			{
+				Marshal::FreeHGlobal( nativeName );
+			}
+
+			if( variable != NULL && element >= 0 )
+				variable = variable->GetElement( element );
+
+			// the effect hands back a placeholder rather than NULL for unknown names
+			if( variable == NULL || !variable->IsValid() )
+				return NULL;
+		}
+
+		return variable;
+	}
+
+	int EffectParameterBlock::IndexOf( String^ name )
+	{
+		if( name == nullptr )
+			throw gcnew ArgumentNullException( "name" );
+
+		for( int i = 0; i < m_Parameters->Length; ++i )
+		{
+			if( m_Parameters[i].Name == name )
+				return i;
+		}
+
+		return -1;
+	}
+
+	ConstantBufferField EffectParameterBlock::GetParameterDescription( int parameter )
+	{
+		if( parameter < 0 || parameter >= m_Parameters->Length )
+			throw gcnew ArgumentOutOfRangeException( "parameter" );
+
+		return m_Parameters[parameter];
+	}
+
+	ConstantBufferField EffectParameterBlock::CheckParameter( int parameter, bool matrix, bool floatType )
+	{
+		CheckDisposed();
+
+		ConstantBufferField description = GetParameterDescription( parameter );
+		ShaderVariableClass variableClass = description.Class;
+
+		if( matrix )
+		{
+			if( variableClass != ShaderVariableClass::MatrixRows && variableClass != ShaderVariableClass::MatrixColumns )
+				throw gcnew ArgumentException( String::Format( "The variable '{0}' is not a matrix.", description.Name ), "parameter" );
+		}
+		else if( variableClass != ShaderVariableClass::Scalar && variableClass != ShaderVariableClass::Vector )
+			throw gcnew ArgumentException( String::Format( "The variable '{0}' is not a scalar or vector.", description.Name ), "parameter" );
+
+		ShaderVariableType type = description.Type;
+		bool isFloat = type == ShaderVariableType::Float;
+		bool isInteger = type == ShaderVariableType::Int || type == ShaderVariableType::UInt || type == ShaderVariableType::Bool;
+		if( floatType ? !isFloat : !isInteger )
+			throw gcnew ArgumentException( String::Format( "The variable '{0}' has a different component type than the value being set.", description.Name ), "parameter" );
+
+		return description;
+	}
+
+	void EffectParameterBlock::WriteElements( int parameter, ConstantBufferField% description, const float* data, int count, int elementFloats )
+	{
+		if( PackElements( m_Block->GetData( parameter ), description.ElementStride, data, count, elementFloats, description.Columns ) )
+			m_Block->MarkDirty( parameter );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	void EffectParameterBlock::Set( int parameter, float value )
+	{
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		WriteElements( parameter, description, &value, 1, 1 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, int value )
+	{
+		CheckParameter( parameter, false, false );
+
+		if( CopyIfChanged( m_Block->GetData( parameter ), &value, sizeof(int) ) )
+			m_Block->MarkDirty( parameter );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	void EffectParameterBlock::Set( int parameter, bool value )
+	{
+		Set( parameter, value ? TRUE : FALSE );
+	}
+
+	void EffectParameterBlock::Set( int parameter, Vector2 value )
+	{
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		WriteElements( parameter, description, reinterpret_cast<float*>( &value ), 1, 2 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, Vector3 value )
+	{
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		WriteElements( parameter, description, reinterpret_cast<float*>( &value ), 1, 3 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, Vector4 value )
+	{
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		WriteElements( parameter, description, reinterpret_cast<float*>( &value ), 1, 4 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, Color4 value )
+	{
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		WriteElements( parameter, description, reinterpret_cast<float*>( &value ), 1, 4 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, Matrix value )
+	{
+		ConstantBufferField description = CheckParameter( parameter, true, true );
+
+		if( PackMatrix( m_Block->GetData( parameter ), reinterpret_cast<float*>( &value ), description.Class == ShaderVariableClass::MatrixColumns,
+			Math::Min( description.Rows, 4 ), Math::Min( description.Columns, 4 ) ) )
+			m_Block->MarkDirty( parameter );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	void EffectParameterBlock::Set( int parameter, array<float>^ values )
+	{
+		if( values == nullptr )
+			throw gcnew ArgumentNullException( "values" );
+
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		if( values->Length > Math::Max( description.Elements, 1 ) )
+			throw gcnew ArgumentOutOfRangeException( "values", "More values were supplied than the variable has elements." );
+		if( values->Length == 0 )
+			return;
+
+		pin_ptr<float> pinnedValues = &values[0];
+		WriteElements( parameter, description, pinnedValues, values->Length, 1 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, array<Vector4>^ values )
+	{
+		if( values == nullptr )
+			throw gcnew ArgumentNullException( "values" );
+
+		ConstantBufferField description = CheckParameter( parameter, false, true );
+		if( values->Length > Math::Max( description.Elements, 1 ) )
+			throw gcnew ArgumentOutOfRangeException( "values", "More values were supplied than the variable has elements." );
+		if( values->Length == 0 )
+			return;
+
+		pin_ptr<Vector4> pinnedValues = &values[0];
+		WriteElements( parameter, description, reinterpret_cast<float*>( pinnedValues ), values->Length, 4 );
+	}
+
+	void EffectParameterBlock::Set( int parameter, array<Matrix>^ values )
+	{
+		if( values == nullptr )
+			throw gcnew ArgumentNullException( "values" );
+
+		ConstantBufferField description = CheckParameter( parameter, true, true );
+		if( values->Length > Math::Max( description.Elements, 1 ) )
+			throw gcnew ArgumentOutOfRangeException( "values", "More values were supplied than the variable has elements." );
+		if( values->Length == 0 )
+			return;
+
+		bool columnMajor = description.Class == ShaderVariableClass::MatrixColumns;
+		int rows = Math::Min( description.Rows, 4 );
+		int columns = Math::Min( description.Columns, 4 );
+		unsigned char* data = m_Block->GetData( parameter );
+		bool changed = false;
+
+		pin_ptr<Matrix> pinnedValues = &values[0];
+		const float* matrices = reinterpret_cast<const float*>( pinnedValues );
+		for( int i = 0; i < values->Length; ++i )
+			changed |= PackMatrix( data + i * description.ElementStride, matrices + i * 16, columnMajor, rows, columns );
+
+		if( changed )
+			m_Block->MarkDirty( parameter );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	Result EffectParameterBlock::Apply()
+	{
+		CheckDisposed();
+
+		HRESULT hr = TIME_CALL( m_Block->Apply() );
+		return RECORD_D3D11( hr );
+	}
+
+	Result EffectParameterBlock::Invalidate()
+	{
+		CheckDisposed();
+
+		HRESULT hr = TIME_CALL( m_Block->Refresh() );
+		return RECORD_D3D11( hr );
+	}
+
+	void EffectParameterBlock::ResetStatistics()
+	{
+		CheckDisposed();
+
+		m_RedundantWriteCount = 0;
+		m_Block->ResetStatistics();
+	}
+
+	int EffectParameterBlock::RawValueCallCount::get()
+	{
+		CheckDisposed();
+		return m_Block->GetRawValueCallCount();
+	}
+}
+}
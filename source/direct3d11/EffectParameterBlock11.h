@@ -0,0 +1,231 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../math/Color4.h"
+#include "../math/Matrix.h"
+#include "../math/Vector2.h"
+#include "../math/Vector3.h"
+#include "../math/Vector4.h"
+
+#include "ConstantBufferField11.h"
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		class NativeEffectParameterBlock;
+
+		ref class Effect;
+
+		/// <summary>
+		/// A set of effect variables resolved once to their constant buffer locations, so they can be written as a batch.
+		/// </summary>
+		/// <remarks>
+		/// Each parameter keeps a copy of its variable, packed the way the constant buffer stores it. The setters only update
+		/// that copy, skipping writes that change nothing, and <see cref="Apply"/> hands the changed values to the effect with a
+		/// single SetRawValue call per constant buffer. This replaces one call into the effect runtime per variable. The effect
+		/// still uploads its constant buffers when a pass is applied.
+		///
+		/// A parameter's copy is read from the effect when the block is created, and writes are compared against that copy.
+		/// The copy only tracks what this block wrote, so when several blocks share a variable (one block per object, say), or
+		/// the variable is also set through its <see cref="EffectVariable"/> wrapper, a write can be skipped as redundant even
+		/// though the effect now holds another value, and partial writes may restore old component values. In that case call
+		/// <see cref="Invalidate"/> before writing to the block, which reads the effect's current values back into the copies.
+		/// Names may refer to structure members and array elements, as in <c>material.diffuse</c> or <c>lights[2].color</c>.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class EffectParameterBlock sealed
+		{
+		private:
+			SlimDX::Direct3D11::Effect^ m_Effect;
+			NativeEffectParameterBlock* m_Block;
+			array<ConstantBufferField>^ m_Parameters;
+			int m_RedundantWriteCount;
+
+			void CheckDisposed();
+			ConstantBufferField CheckParameter( int parameter, bool matrix, bool floatType );
+			void WriteElements( int parameter, ConstantBufferField% description, const float* data, int count, int elementFloats );
+			static ID3DX11EffectVariable* Resolve( SlimDX::Direct3D11::Effect^ effect, System::String^ name );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="EffectParameterBlock"/> class.
+			/// </summary>
+			/// <param name="effect">The effect that owns the variables.</param>
+			/// <param name="names">The names of the variables; the index of each name is the index of its parameter.</param>
+			EffectParameterBlock( SlimDX::Direct3D11::Effect^ effect, ... array<System::String^>^ names );
+
+			/// <summary>
+			/// Releases the parameter copies.
+			/// </summary>
+			~EffectParameterBlock();
+
+			/// <summary>
+			/// Releases the parameter copies.
+			/// </summary>
+			!EffectParameterBlock();
+
+			/// <summary>
+			/// Finds the index of a parameter.
+			/// </summary>
+			/// <param name="name">The name the parameter was created with.</param>
+			/// <returns>The index of the parameter, or -1 if the block has no parameter with the given name.</returns>
+			int IndexOf( System::String^ name );
+
+			/// <summary>
+			/// Gets the location and type of a parameter. The offset is relative to the start of its constant buffer.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <returns>The description of the parameter.</returns>
+			ConstantBufferField GetParameterDescription( int parameter );
+
+			/// <summary>
+			/// Sets a float scalar or the first component of a float vector.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, float value );
+
+			/// <summary>
+			/// Sets an int, uint or bool scalar, or the first component of such a vector.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, int value );
+
+			/// <summary>
+			/// Sets an int, uint or bool scalar, or the first component of such a vector.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, bool value );
+
+			/// <summary>
+			/// Sets up to two components of a float vector.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, Vector2 value );
+
+			/// <summary>
+			/// Sets up to three components of a float vector.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, Vector3 value );
+
+			/// <summary>
+			/// Sets up to four components of a float vector.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, Vector4 value );
+
+			/// <summary>
+			/// Sets a float vector to the red, green, blue and alpha components of a color.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, Color4 value );
+
+			/// <summary>
+			/// Sets a float matrix, transposing it if the variable is column-major.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int parameter, Matrix value );
+
+			/// <summary>
+			/// Sets the leading elements of a float scalar array.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="values">The values to set.</param>
+			void Set( int parameter, array<float>^ values );
+
+			/// <summary>
+			/// Sets the leading elements of a float vector array.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="values">The values to set.</param>
+			void Set( int parameter, array<Vector4>^ values );
+
+			/// <summary>
+			/// Sets the leading elements of a float matrix array.
+			/// </summary>
+			/// <param name="parameter">The index of the parameter.</param>
+			/// <param name="values">The values to set.</param>
+			void Set( int parameter, array<Matrix>^ values );
+
+			/// <summary>
+			/// Writes the changed parameters into the effect's constant buffers.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Apply();
+
+			/// <summary>
+			/// Reads the effect's current values into the copies of all parameters that have no unapplied writes, so later writes
+			/// are compared against what the effect holds. Call this when other blocks or variable wrappers may have changed the
+			/// variables since this block was last applied.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Invalidate();
+
+			/// <summary>
+			/// Resets the write and call counters to zero.
+			/// </summary>
+			void ResetStatistics();
+
+			/// <summary>
+			/// Gets the effect that owns the variables.
+			/// </summary>
+			property SlimDX::Direct3D11::Effect^ Effect
+			{
+				SlimDX::Direct3D11::Effect^ get() { return m_Effect; }
+			}
+
+			/// <summary>
+			/// Gets the number of parameters in the block.
+			/// </summary>
+			property int ParameterCount
+			{
+				int get() { return m_Parameters->Length; }
+			}
+
+			/// <summary>
+			/// Gets the number of writes that left a parameter unchanged.
+			/// </summary>
+			property int RedundantWriteCount
+			{
+				int get() { return m_RedundantWriteCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of GetRawValue and SetRawValue calls made by <see cref="Apply"/> and <see cref="Invalidate"/>.
+			/// </summary>
+			property int RawValueCallCount
+			{
+				int get();
+			}
+		};
+	}
+}
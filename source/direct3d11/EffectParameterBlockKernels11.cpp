@@ -0,0 +1,174 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3dx11effect.h>
+#include <string.h>
+
+#include "EffectParameterBlockKernels11.h"
+
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	NativeEffectParameterBlock::NativeEffectParameterBlock()
+	: m_RawValueCallCount( 0 )
+	{
+	}
+
+	int NativeEffectParameterBlock::AddParameter( ID3DX11EffectVariable* variable, D3DX11_EFFECT_TYPE_DESC& type, UINT& offset )
+	{
+		ID3DX11EffectConstantBuffer* buffer = variable->GetParentConstantBuffer();
+		if( buffer == NULL || !buffer->IsValid() )
+			return -1;
+
+		D3DX11_EFFECT_VARIABLE_DESC description;
+		if( FAILED( variable->GetDesc( &description ) ) || FAILED( variable->GetType()->GetDesc( &type ) ) || type.UnpackedSize == 0 )
+			return -1;
+
+		size_t index = 0;
+		while( index < m_Buffers.size() && m_Buffers[index].Pointer != buffer )
+			++index;
+
+		if( index == m_Buffers.size() )
+		{
+			ConstantBuffer entry;
+			entry.Pointer = buffer;
+			entry.DirtyBegin = 0;
+			entry.DirtyEnd = 0;
+			entry.DirtyCount = 0;
+			m_Buffers.push_back( entry );
+		}
+
+		ConstantBuffer& entry = m_Buffers[index];
+		UINT end = description.BufferOffset + type.UnpackedSize;
+		if( entry.Data.size() < end )
+			entry.Data.resize( end );
+
+		if( FAILED( variable->GetRawValue( &entry.Data[description.BufferOffset], 0, type.UnpackedSize ) ) )
+			return -1;
+
+		Parameter parameter;
+		parameter.Buffer = index;
+		parameter.Offset = description.BufferOffset;
+		parameter.Size = type.UnpackedSize;
+		parameter.Dirty = false;
+
+		entry.Parameters.push_back( static_cast<int>( m_Parameters.size() ) );
+		m_Parameters.push_back( parameter );
+
+		offset = description.BufferOffset;
+		return static_cast<int>( m_Parameters.size() ) - 1;
+	}
+
+	unsigned char* NativeEffectParameterBlock::GetData( int parameter )
+	{
+		const Parameter& entry = m_Parameters[parameter];
+		return &m_Buffers[entry.Buffer].Data[entry.Offset];
+	}
+
+	void NativeEffectParameterBlock::MarkDirty( int parameter )
+	{
+		Parameter& entry = m_Parameters[parameter];
+		if( entry.Dirty )
+			return;
+
+		ConstantBuffer& buffer = m_Buffers[entry.Buffer];
+		if( buffer.DirtyCount == 0 || entry.Offset < buffer.DirtyBegin )
+			buffer.DirtyBegin = entry.Offset;
+		if( buffer.DirtyCount == 0 || entry.Offset + entry.Size > buffer.DirtyEnd )
+			buffer.DirtyEnd = entry.Offset + entry.Size;
+
+		entry.Dirty = true;
+		++buffer.DirtyCount;
+	}
+
+	HRESULT NativeEffectParameterBlock::Apply()
+	{
+		for( size_t b = 0; b < m_Buffers.size(); ++b )
+		{
+			ConstantBuffer& buffer = m_Buffers[b];
+			if( buffer.DirtyCount == 0 )
+				continue;
+
+			UINT begin = buffer.DirtyBegin;
+			UINT count = buffer.DirtyEnd - begin;
+			HRESULT hr;
+
+			if( buffer.DirtyCount == 1 )
+			{
+				hr = buffer.Pointer->SetRawValue( &buffer.Data[begin], begin, count );
+				++m_RawValueCallCount;
+			}
+			else
+			{
+				// the span between dirty parameters may hold variables outside the block, so their current values are read back first
+				buffer.Scratch.resize( count );
+				hr = buffer.Pointer->GetRawValue( &buffer.Scratch[0], begin, count );
+				if( FAILED( hr ) )
+					return hr;
+
+				for( size_t i = 0; i < buffer.Parameters.size(); ++i )
+				{
+					const Parameter& parameter = m_Parameters[buffer.Parameters[i]];
+					if( parameter.Dirty )
+						memcpy( &buffer.Scratch[parameter.Offset - begin], &buffer.Data[parameter.Offset], parameter.Size );
+				}
+
+				hr = buffer.Pointer->SetRawValue( &buffer.Scratch[0], begin, count );
+				m_RawValueCallCount += 2;
+			}
+
+			if( FAILED( hr ) )
+				return hr;
+
+			for( size_t i = 0; i < buffer.Parameters.size(); ++i )
+				m_Parameters[buffer.Parameters[i]].Dirty = false;
+
+			buffer.DirtyCount = 0;
+		}
+
+		return S_OK;
+	}
+
+	HRESULT NativeEffectParameterBlock::Refresh()
+	{
+		for( size_t p = 0; p < m_Parameters.size(); ++p )
+		{
+			const Parameter& parameter = m_Parameters[p];
+			if( parameter.Dirty )
+				continue;
+
+			ConstantBuffer& buffer = m_Buffers[parameter.Buffer];
+			HRESULT hr = buffer.Pointer->GetRawValue( &buffer.Data[parameter.Offset], parameter.Offset, parameter.Size );
+			++m_RawValueCallCount;
+			if( FAILED( hr ) )
+				return hr;
+		}
+
+		return S_OK;
+	}
+}
+}
+
+#pragma managed(pop)
@@ -0,0 +1,77 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	// Shadow copies of effect variables grouped by the constant buffer that holds them. Values are written into the copies,
+	// and Apply hands every dirty range to the effect with one SetRawValue call per constant buffer.
+	class NativeEffectParameterBlock
+	{
+	public:
+		NativeEffectParameterBlock();
+
+		// Binds a variable and reads its current value. Returns the parameter index, or -1 if the variable is not stored
+		// in a constant buffer.
+		int AddParameter( ID3DX11EffectVariable* variable, D3DX11_EFFECT_TYPE_DESC& type, UINT& offset );
+
+		unsigned char* GetData( int parameter );
+		void MarkDirty( int parameter );
+
+		HRESULT Apply();
+
+		// Reads the effect's current value into every parameter that has no unapplied write.
+		HRESULT Refresh();
+
+		int GetRawValueCallCount() const { return m_RawValueCallCount; }
+		void ResetStatistics() { m_RawValueCallCount = 0; }
+
+	private:
+		struct Parameter
+		{
+			size_t Buffer;
+			UINT Offset;
+			UINT Size;
+			bool Dirty;
+		};
+
+		struct ConstantBuffer
+		{
+			ID3DX11EffectConstantBuffer* Pointer;
+			std::vector<unsigned char> Data;
+			std::vector<unsigned char> Scratch;
+			std::vector<int> Parameters;
+			UINT DirtyBegin;
+			UINT DirtyEnd;
+			int DirtyCount;
+		};
+
+		std::vector<Parameter> m_Parameters;
+		std::vector<ConstantBuffer> m_Buffers;
+		int m_RawValueCallCount;
+	};
+}
+}
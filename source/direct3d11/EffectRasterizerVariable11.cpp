@@ -49,7 +49,7 @@ namespace Direct3D11
 	{
 		ID3D11RasterizerState *result;
 
-		HRESULT hr = m_Pointer->GetRasterizerState(index, &result);
+		HRESULT hr = TIME_CALL( m_Pointer->GetRasterizerState(index, &result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -58,7 +58,7 @@ namespace Direct3D11
 
 	Result EffectRasterizerVariable::SetRasterizerState(int index, RasterizerState^ blendState)
 	{
-		HRESULT hr = m_Pointer->SetRasterizerState(index, blendState->InternalPointer);
+		HRESULT hr = TIME_CALL( m_Pointer->SetRasterizerState(index, blendState->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -66,7 +66,7 @@ namespace Direct3D11
 	{
 		D3D11_RASTERIZER_DESC desc;
 
-		HRESULT hr = m_Pointer->GetBackingStore(index, &desc);
+		HRESULT hr = TIME_CALL( m_Pointer->GetBackingStore(index, &desc) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return RasterizerStateDescription();
 
@@ -75,7 +75,7 @@ namespace Direct3D11
 
 	Result EffectRasterizerVariable::UndoSetRasterizerState(int index)
 	{
-		HRESULT hr = m_Pointer->UndoSetRasterizerState(index);
+		HRESULT hr = TIME_CALL( m_Pointer->UndoSetRasterizerState(index) );
 		return RECORD_D3D11(hr);
 	}
 }
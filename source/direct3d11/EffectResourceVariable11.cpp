@@ -66,14 +66,14 @@ namespace Direct3D11
 		Utilities::CheckArrayBounds(views, offset, count);
 
 		stack_array<ID3D11ShaderResourceView*> nativeViews = stackalloc(ID3D11ShaderResourceView*, count);
-		HRESULT hr = m_Pointer->GetResourceArray(&nativeViews[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetResourceArray(&nativeViews[0], 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return Result::Last;
 
 		for (int i = 0; i < count; i++)
 			views[i + offset] = ShaderResourceView::FromPointer(nativeViews[i]);
 
-		return Result::Last;
+		return Result(hr);
 	}
 	
 	Result EffectResourceVariable::SetResource( ShaderResourceView^ view )
@@ -97,7 +97,7 @@ namespace Direct3D11
 		for (int i = 0; i < count; i++)
 			nativeViews[i] = views[i + offset] != nullptr ? views[i + offset]->InternalPointer : 0;
 
-		HRESULT hr = m_Pointer->SetResourceArray(&nativeViews[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->SetResourceArray(&nativeViews[0], 0, count) );
 		return RECORD_D3D11(hr);
 	}
 }
@@ -49,7 +49,7 @@ namespace Direct3D11
 	{
 		ID3D11SamplerState *result;
 
-		HRESULT hr = m_Pointer->GetSampler(index, &result);
+		HRESULT hr = TIME_CALL( m_Pointer->GetSampler(index, &result) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -58,7 +58,7 @@ namespace Direct3D11
 
 	Result EffectSamplerVariable::SetSamplerState(int index, SamplerState^ blendState)
 	{
-		HRESULT hr = m_Pointer->SetSampler(index, blendState->InternalPointer);
+		HRESULT hr = TIME_CALL( m_Pointer->SetSampler(index, blendState->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -66,7 +66,7 @@ namespace Direct3D11
 	{
 		D3D11_SAMPLER_DESC desc;
 
-		HRESULT hr = m_Pointer->GetBackingStore(index, &desc);
+		HRESULT hr = TIME_CALL( m_Pointer->GetBackingStore(index, &desc) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return SamplerDescription();
 
@@ -75,7 +75,7 @@ namespace Direct3D11
 
 	Result EffectSamplerVariable::UndoSetSamplerState(int index)
 	{
-		HRESULT hr = m_Pointer->UndoSetSampler(index);
+		HRESULT hr = TIME_CALL( m_Pointer->UndoSetSampler(index) );
 		return RECORD_D3D11(hr);
 	}
 }
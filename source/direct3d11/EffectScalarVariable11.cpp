@@ -97,7 +97,7 @@ namespace Direct3D11
 
 		array<BOOL>^ values = gcnew array<BOOL>( count );
 		pin_ptr<BOOL> pinned_values = &values[0];
-		HRESULT hr = m_Pointer->GetIntArray( pinned_values, 0, static_cast<UINT>( count ) );
+		HRESULT hr = TIME_CALL( m_Pointer->GetIntArray( pinned_values, 0, static_cast<UINT>( count ) ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return nullptr;
 
@@ -119,7 +119,7 @@ namespace Direct3D11
 
 		array<int>^ values = gcnew array<int>( count );
 		pin_ptr<int> pinned_values = &values[0];
-		HRESULT hr = m_Pointer->GetIntArray( pinned_values, 0, static_cast<UINT>( count ) );
+		HRESULT hr = TIME_CALL( m_Pointer->GetIntArray( pinned_values, 0, static_cast<UINT>( count ) ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return nullptr;
 
@@ -140,7 +140,7 @@ namespace Direct3D11
 
 		array<float>^ values = gcnew array<float>( count );
 		pin_ptr<float> pinned_values = &values[0];
-		HRESULT hr = m_Pointer->GetFloatArray( pinned_values, 0, static_cast<UINT>( count ) );
+		HRESULT hr = TIME_CALL( m_Pointer->GetFloatArray( pinned_values, 0, static_cast<UINT>( count ) ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return nullptr;
 
@@ -65,14 +65,14 @@ namespace Direct3D11
 		Utilities::CheckArrayBounds(strings, offset, count);
 
 		stack_array<LPCSTR> native = stackalloc(LPCSTR, count);
-		HRESULT hr = m_Pointer->GetStringArray(&native[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetStringArray(&native[0], 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return Result::Last;
 
 		for (int i = 0; i < count; i++)
 			strings[i + offset] = gcnew String(native[i]);
 
-		return Result::Last;
+		return Result(hr);
 	}
 }
 }
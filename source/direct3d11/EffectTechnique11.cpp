@@ -104,7 +104,7 @@ namespace Direct3D11
 	{
 		D3DX11_STATE_BLOCK_MASK mask;
 
-		HRESULT hr = m_Pointer->ComputeStateBlockMask(&mask);
+		HRESULT hr = TIME_CALL( m_Pointer->ComputeStateBlockMask(&mask) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
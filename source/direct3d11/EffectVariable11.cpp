@@ -205,11 +205,15 @@ namespace Direct3D11
 	
 	EffectMatrixVariable^ EffectVariable::AsMatrix()
 	{
+		if( m_Matrix != nullptr )
+			return m_Matrix;
+
 		ID3DX11EffectMatrixVariable* variable = m_Pointer->AsMatrix();
 		if( variable == 0 || !variable->IsValid() )
 			return nullptr;
 
-		return gcnew EffectMatrixVariable( variable );
+		m_Matrix = gcnew EffectMatrixVariable( variable );
+		return m_Matrix;
 	}
 
 	EffectRasterizerVariable^ EffectVariable::AsRasterizer()
@@ -259,20 +263,28 @@ namespace Direct3D11
 	
 	EffectScalarVariable^ EffectVariable::AsScalar()
 	{
+		if( m_Scalar != nullptr )
+			return m_Scalar;
+
 		ID3DX11EffectScalarVariable* variable = m_Pointer->AsScalar();
 		if( variable == 0 || !variable->IsValid() )
 			return nullptr;
 
-		return gcnew EffectScalarVariable( variable );
+		m_Scalar = gcnew EffectScalarVariable( variable );
+		return m_Scalar;
 	}
 	
 	EffectVectorVariable^ EffectVariable::AsVector()
 	{
+		if( m_Vector != nullptr )
+			return m_Vector;
+
 		ID3DX11EffectVectorVariable* variable = m_Pointer->AsVector();
 		if( variable == 0 || !variable->IsValid() )
 			return nullptr;
 
-		return gcnew EffectVectorVariable( variable );
+		m_Vector = gcnew EffectVectorVariable( variable );
+		return m_Vector;
 	}
 
 	EffectStringVariable^ EffectVariable::AsString()
@@ -304,7 +316,7 @@ namespace Direct3D11
 
 	Result EffectVariable::SetRawValue(DataStream^ data, int count)
 	{
-		HRESULT hr = m_Pointer->SetRawValue(data->PositionPointer, 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->SetRawValue(data->PositionPointer, 0, count) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -312,7 +324,7 @@ namespace Direct3D11
 	{
 		stack_array<char> data = stackalloc(char, count);
 
-		HRESULT hr = m_Pointer->GetRawValue(&data[0], 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetRawValue(&data[0], 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -56,6 +56,9 @@ namespace SlimDX
 		{
 		private:
 			ID3DX11EffectVariable* m_Pointer;
+			EffectMatrixVariable^ m_Matrix;
+			EffectScalarVariable^ m_Scalar;
+			EffectVectorVariable^ m_Vector;
 			
 		internal:
 			EffectVariable( ID3DX11EffectVariable* pointer );
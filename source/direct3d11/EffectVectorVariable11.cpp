@@ -112,7 +112,7 @@ namespace Direct3D11
 	{
 		Vector4 result;
 
-		HRESULT hr = m_Pointer->GetFloatVector(reinterpret_cast<float*>(&result));
+		HRESULT hr = TIME_CALL( m_Pointer->GetFloatVector(reinterpret_cast<float*>(&result)) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return Vector4::Zero;
 
@@ -123,7 +123,7 @@ namespace Direct3D11
 	{
 		Color4 result;
 
-		HRESULT hr = m_Pointer->GetFloatVector(reinterpret_cast<float*>(&result));
+		HRESULT hr = TIME_CALL( m_Pointer->GetFloatVector(reinterpret_cast<float*>(&result)) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return Color4(0, 0, 0, 0);
 
@@ -135,7 +135,7 @@ namespace Direct3D11
 		array<Vector4>^ result = gcnew array<Vector4>(count);
 		pin_ptr<Vector4> pinnedResult = &result[0];
 
-		HRESULT hr = m_Pointer->GetFloatVectorArray(reinterpret_cast<float*>(pinnedResult), 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetFloatVectorArray(reinterpret_cast<float*>(pinnedResult), 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -147,7 +147,7 @@ namespace Direct3D11
 		array<Color4>^ result = gcnew array<Color4>(count);
 		pin_ptr<Color4> pinnedResult = &result[0];
 
-		HRESULT hr = m_Pointer->GetFloatVectorArray(reinterpret_cast<float*>(pinnedResult), 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetFloatVectorArray(reinterpret_cast<float*>(pinnedResult), 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -159,7 +159,7 @@ namespace Direct3D11
 		array<int>^ result = gcnew array<int>(count * 4);
 		pin_ptr<int> pinnedResult = &result[0];
 
-		HRESULT hr = m_Pointer->GetBoolVectorArray(reinterpret_cast<BOOL*>(pinnedResult), 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetBoolVectorArray(reinterpret_cast<BOOL*>(pinnedResult), 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -171,7 +171,7 @@ namespace Direct3D11
 		array<int>^ result = gcnew array<int>(count * 4);
 		pin_ptr<int> pinnedResult = &result[0];
 
-		HRESULT hr = m_Pointer->GetIntVectorArray(reinterpret_cast<BOOL*>(pinnedResult), 0, count);
+		HRESULT hr = TIME_CALL( m_Pointer->GetIntVectorArray(reinterpret_cast<BOOL*>(pinnedResult), 0, count) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -40,7 +40,7 @@ namespace Direct3D11
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 		D3DX11_FFT_DESC desc = description.ToUnmanaged();
 
-		HRESULT hr = D3DX11CreateFFT( context->InternalPointer, &desc, 0, &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT( context->InternalPointer, &desc, 0, &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -54,7 +54,7 @@ namespace Direct3D11
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 		D3DX11_FFT_DESC desc = description.ToUnmanaged();
 
-		HRESULT hr = D3DX11CreateFFT( context->InternalPointer, &desc, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT( context->InternalPointer, &desc, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -72,7 +72,7 @@ namespace Direct3D11
 		ID3DX11FFT *pointer = NULL;
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 
-		HRESULT hr = D3DX11CreateFFT1DComplex( context->InternalPointer, x, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT1DComplex( context->InternalPointer, x, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -92,7 +92,7 @@ namespace Direct3D11
 		ID3DX11FFT *pointer = NULL;
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 
-		HRESULT hr = D3DX11CreateFFT1DReal( context->InternalPointer, x, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT1DReal( context->InternalPointer, x, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -112,7 +112,7 @@ namespace Direct3D11
 		ID3DX11FFT *pointer = NULL;
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 
-		HRESULT hr = D3DX11CreateFFT2DComplex( context->InternalPointer, x, y, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT2DComplex( context->InternalPointer, x, y, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -132,7 +132,7 @@ namespace Direct3D11
 		ID3DX11FFT *pointer = NULL;
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 
-		HRESULT hr = D3DX11CreateFFT2DReal( context->InternalPointer, x, y, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT2DReal( context->InternalPointer, x, y, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -152,7 +152,7 @@ namespace Direct3D11
 		ID3DX11FFT *pointer = NULL;
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 
-		HRESULT hr = D3DX11CreateFFT3DComplex( context->InternalPointer, x, y, z, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT3DComplex( context->InternalPointer, x, y, z, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -172,7 +172,7 @@ namespace Direct3D11
 		ID3DX11FFT *pointer = NULL;
 		D3DX11_FFT_BUFFER_INFO bufferInfo;
 
-		HRESULT hr = D3DX11CreateFFT3DReal( context->InternalPointer, x, y, z, static_cast<UINT>( flags ), &bufferInfo, &pointer );
+		HRESULT hr = TIME_CALL( D3DX11CreateFFT3DReal( context->InternalPointer, x, y, z, static_cast<UINT>( flags ), &bufferInfo, &pointer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -189,7 +189,7 @@ namespace Direct3D11
 
 	void FastFourierTransform::ForwardScale::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetForwardScale( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetForwardScale( value ) );
 		RECORD_D3D11( hr );
 	}
 
@@ -200,7 +200,7 @@ namespace Direct3D11
 
 	void FastFourierTransform::InverseScale::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetInverseScale( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetInverseScale( value ) );
 		RECORD_D3D11( hr );
 	}
 
@@ -234,7 +234,7 @@ namespace Direct3D11
 			precomputeCount = precomputeBuffers->Length;
 		}
 
-		HRESULT hr = InternalPointer->AttachBuffersAndPrecompute(tempCount, tempPtr, precomputeCount, precomputePtr);
+		HRESULT hr = TIME_CALL( InternalPointer->AttachBuffersAndPrecompute(tempCount, tempPtr, precomputeCount, precomputePtr) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -246,7 +246,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* inputBuffer = input == nullptr ? NULL : input->InternalPointer;
 		ID3D11UnorderedAccessView* outputBuffer = output->InternalPointer;
 
-		HRESULT hr = InternalPointer->ForwardTransform( inputBuffer, &outputBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->ForwardTransform( inputBuffer, &outputBuffer ) );
 		return RECORD_D3D11( hr );
 	}
 
@@ -255,7 +255,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* inputBuffer = input == nullptr ? NULL : input->InternalPointer;
 		ID3D11UnorderedAccessView* outputBuffer = NULL;
 
-		HRESULT hr = InternalPointer->ForwardTransform( inputBuffer, &outputBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->ForwardTransform( inputBuffer, &outputBuffer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -270,7 +270,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* inputBuffer = input == nullptr ? NULL : input->InternalPointer;
 		ID3D11UnorderedAccessView* outputBuffer = output->InternalPointer;
 
-		HRESULT hr = InternalPointer->InverseTransform( inputBuffer, &outputBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->InverseTransform( inputBuffer, &outputBuffer ) );
 		return RECORD_D3D11( hr );
 	}
 
@@ -279,7 +279,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* inputBuffer = input == nullptr ? NULL : input->InternalPointer;
 		ID3D11UnorderedAccessView* outputBuffer = NULL;
 
-		HRESULT hr = InternalPointer->InverseTransform( inputBuffer, &outputBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->InverseTransform( inputBuffer, &outputBuffer ) );
 		if (RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
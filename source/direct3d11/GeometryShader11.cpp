@@ -38,7 +38,7 @@ namespace Direct3D11
 	{
 		ID3D11GeometryShader *shader;
 
-		HRESULT hr = device->InternalPointer->CreateGeometryShader( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), NULL, &shader );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateGeometryShader( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), NULL, &shader ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -50,7 +50,7 @@ namespace Direct3D11
 		ID3D11GeometryShader *shader;
 		ID3D11ClassLinkage *nativeLinkage = linkage == nullptr ? NULL : linkage->InternalPointer;
 
-		HRESULT hr = device->InternalPointer->CreateGeometryShader( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), nativeLinkage, &shader );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateGeometryShader( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), nativeLinkage, &shader ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -67,8 +67,8 @@ namespace Direct3D11
 
 		pin_ptr<int> pinnedStrides = &bufferedStrides[0];
 
-		HRESULT hr = device->InternalPointer->CreateGeometryShaderWithStreamOutput( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), 
-			&nativeElements[0], elements->Length, reinterpret_cast<UINT*>(pinnedStrides), bufferedStrides->Length, rasterizedStream, NULL, &shader );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateGeometryShaderWithStreamOutput( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), 
+			&nativeElements[0], elements->Length, reinterpret_cast<UINT*>(pinnedStrides), bufferedStrides->Length, rasterizedStream, NULL, &shader ) );
 
 		for( int i = 0; i < elements->Length; i++ )
 			Utilities::FreeNativeString( nativeElements[i].SemanticName );
@@ -90,8 +90,8 @@ namespace Direct3D11
 
 		pin_ptr<int> pinnedStrides = &bufferedStrides[0];
 
-		HRESULT hr = device->InternalPointer->CreateGeometryShaderWithStreamOutput( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), 
-			&nativeElements[0], elements->Length, reinterpret_cast<UINT*>(pinnedStrides), bufferedStrides->Length, rasterizedStream, nativeLinkage, &shader );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateGeometryShaderWithStreamOutput( shaderBytecode->InternalPointer->GetBufferPointer(), shaderBytecode->InternalPointer->GetBufferSize(), 
+			&nativeElements[0], elements->Length, reinterpret_cast<UINT*>(pinnedStrides), bufferedStrides->Length, rasterizedStream, nativeLinkage, &shader ) );
 
 		for( int i = 0; i < elements->Length; i++ )
 			Utilities::FreeNativeString( nativeElements[i].SemanticName );
@@ -157,7 +157,7 @@ namespace SlimDX
 		{
 			D3DX11_IMAGE_INFO info;
 			pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
-			HRESULT hr = D3DX11GetImageInfoFromFile( pinnedName, 0, &info, 0 );
+			HRESULT hr = TIME_CALL( D3DX11GetImageInfoFromFile( pinnedName, 0, &info, 0 ) );
 			if( RECORD_D3D11( hr ).IsFailure )
 				return Nullable<ImageInformation>();
 			
@@ -168,7 +168,7 @@ namespace SlimDX
 		{
 			D3DX11_IMAGE_INFO info;
 			pin_ptr<unsigned char> pinnedMemory = &memory[0];
-			HRESULT hr = D3DX11GetImageInfoFromMemory( pinnedMemory, memory->Length, 0, &info, 0 );
+			HRESULT hr = TIME_CALL( D3DX11GetImageInfoFromMemory( pinnedMemory, memory->Length, 0, &info, 0 ) );
 			if( RECORD_D3D11( hr ).IsFailure )
 				return Nullable<ImageInformation>();
 			
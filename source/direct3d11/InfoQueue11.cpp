@@ -50,7 +50,7 @@ namespace Direct3D11
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes(description);
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->AddApplicationMessage(static_cast<D3D11_MESSAGE_SEVERITY>(severity), reinterpret_cast<LPCSTR>(pinnedName));
+		HRESULT hr = TIME_CALL( InternalPointer->AddApplicationMessage(static_cast<D3D11_MESSAGE_SEVERITY>(severity), reinterpret_cast<LPCSTR>(pinnedName)) );
 		return RECORD_D3D11(hr);
 	}
 
@@ -59,8 +59,8 @@ namespace Direct3D11
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes(description);
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->AddMessage(static_cast<D3D11_MESSAGE_CATEGORY>(category), static_cast<D3D11_MESSAGE_SEVERITY>(severity), 
-			static_cast<D3D11_MESSAGE_ID>(messageId), reinterpret_cast<LPCSTR>(pinnedName));
+		HRESULT hr = TIME_CALL( InternalPointer->AddMessage(static_cast<D3D11_MESSAGE_CATEGORY>(category), static_cast<D3D11_MESSAGE_SEVERITY>(severity), 
+			static_cast<D3D11_MESSAGE_ID>(messageId), reinterpret_cast<LPCSTR>(pinnedName)) );
 
 		return RECORD_D3D11(hr);
 	}
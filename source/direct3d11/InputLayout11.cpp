@@ -57,6 +57,11 @@ namespace Direct3D11
 		Init( device, shaderBytecode->InternalPointer->GetBufferPointer(), static_cast<int>( shaderBytecode->InternalPointer->GetBufferSize() ), elements );
 	}
 
+	InputLayout::InputLayout( SlimDX::Direct3D11::Device^ device, const void* shader, int length, array<InputElement>^ elements )
+	{
+		Init( device, shader, length, elements );
+	}
+
 	void InputLayout::Init( SlimDX::Direct3D11::Device^ device, const void* shader, int length, array<InputElement>^ elements )
 	{
 		if( device == nullptr )
@@ -69,7 +74,7 @@ namespace Direct3D11
 			nativeElements[i] = elements[i].CreateNativeVersion();
 			
 		ID3D11InputLayout* layout = 0;
-		HRESULT hr = device->InternalPointer->CreateInputLayout( nativeElements, elements->Length, shader, length, &layout );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateInputLayout( nativeElements, elements->Length, shader, length, &layout ) );
 
 		for( int i = 0; i < elements->Length; i++ )
 			Utilities::FreeNativeString( nativeElements[i].SemanticName );
@@ -42,6 +42,9 @@ namespace SlimDX
 
 		private:
 			void Init( SlimDX::Direct3D11::Device^ device, const void *shader, int length, array<InputElement>^ elements );
+
+		internal:
+			InputLayout( SlimDX::Direct3D11::Device^ device, const void *shader, int length, array<InputElement>^ elements );
 		
 		public:
 			/// <summary>
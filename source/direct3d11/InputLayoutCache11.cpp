@@ -0,0 +1,306 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "../d3dcompiler/DxbcContainerDC.h"
+
+#include "Device11.h"
+#include "InputLayoutCache11.h"
+
+using namespace System;
+using namespace System::Threading;
+using namespace System::Collections::Generic;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	// Only the input signature matters for layout compatibility, so use just that chunk when the blob is a container.
+	static void GetSignatureChunk( const void* shader, int length, const unsigned char*& signature, int& signatureLength )
+	{
+		D3DCompiler::DxbcContainer container;
+		const D3DCompiler::DxbcChunk* chunk = NULL;
+
+		if( container.Parse( shader, length ) )
+		{
+			chunk = container.FindChunk( D3DCompiler::MakeDxbcFourCC( 'I', 'S', 'G', 'N' ) );
+			if( chunk == NULL )
+				chunk = container.FindChunk( D3DCompiler::MakeDxbcFourCC( 'I', 'S', 'G', '1' ) );
+		}
+
+		if( chunk != NULL )
+		{
+			signature = chunk->Data;
+			signatureLength = chunk->Size;
+		}
+		else
+		{
+			signature = static_cast<const unsigned char*>( shader );
+			signatureLength = length;
+		}
+	}
+
+	static int ComputeHashCode( const unsigned char* signature, int length, array<InputElement>^ elements )
+	{
+		// 32-bit FNV-1a
+		unsigned int hash = 2166136261U;
+		for( int i = 0; i < length; ++i )
+			hash = ( hash ^ signature[i] ) * 16777619U;
+
+		for( int i = 0; i < elements->Length; ++i )
+			hash = ( hash ^ static_cast<unsigned int>( elements[i].GetHashCode() ) ) * 16777619U;
+
+		return static_cast<int>( hash );
+	}
+
+	InputLayoutCache::InputLayoutCache( SlimDX::Direct3D11::Device^ device )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+
+		m_Device = device;
+		m_Entries = gcnew Dictionary<int, List<Entry^>^>();
+		m_Layouts = gcnew Dictionary<IntPtr, Entry^>();
+		m_SyncObject = gcnew Object();
+
+		m_Subscription = gcnew WeakObjectRemovedSubscription<InputLayoutCache>( this );
+	}
+
+	InputLayoutCache::~InputLayoutCache()
+	{
+		m_Subscription->Unsubscribe();
+		Clear();
+	}
+
+	InputLayoutCache::!InputLayoutCache()
+	{
+		// like any other undisposed COM object, the layouts are left to the table's leak report
+		m_Subscription->Unsubscribe();
+	}
+
+	InputLayout^ InputLayoutCache::Acquire( D3DCompiler::ShaderSignature^ shaderSignature, array<InputElement>^ elements )
+	{
+		if( shaderSignature == nullptr )
+			throw gcnew ArgumentNullException( "shaderSignature" );
+
+		return Acquire( shaderSignature->Data->RawPointer, static_cast<int>( shaderSignature->Data->Length ), elements );
+	}
+
+	InputLayout^ InputLayoutCache::Acquire( D3DCompiler::ShaderBytecode^ shaderBytecode, array<InputElement>^ elements )
+	{
+		if( shaderBytecode == nullptr )
+			throw gcnew ArgumentNullException( "shaderBytecode" );
+
+		return Acquire( shaderBytecode->InternalPointer->GetBufferPointer(), static_cast<int>( shaderBytecode->InternalPointer->GetBufferSize() ), elements );
+	}
+
+	InputLayout^ InputLayoutCache::Acquire( const void* shader, int length, array<InputElement>^ elements )
+	{
+		if( elements == nullptr )
+			throw gcnew ArgumentNullException( "elements" );
+
+		const unsigned char* signature;
+		int signatureLength;
+		GetSignatureChunk( shader, length, signature, signatureLength );
+		int hashCode = ComputeHashCode( signature, signatureLength, elements );
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			Entry^ entry = Find( hashCode, signature, signatureLength, elements );
+			if( entry != nullptr )
+			{
+				++entry->References;
+				++m_Hits;
+				return entry->Layout;
+			}
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		// Creation happens outside the lock: the object table raises ObjectRemoved while holding its own
+		// lock, so holding ours while calling into the table could deadlock against another thread.
+		InputLayout^ layout = gcnew InputLayout( m_Device, shader, length, elements );
+
+		Entry^ created = gcnew Entry();
+		created->Layout = layout;
+		created->Elements = safe_cast<array<InputElement>^>( elements->Clone() );
+		created->Signature = gcnew array<Byte>( signatureLength );
+		created->HashCode = hashCode;
+		created->References = 1;
+		if( signatureLength > 0 )
+		{
+			pin_ptr<Byte> pinnedSignature = &created->Signature[0];
+			memcpy( pinnedSignature, signature, signatureLength );
+		}
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			// another thread may have created the same layout in the meantime
+			Entry^ entry = Find( hashCode, signature, signatureLength, elements );
+			if( entry == nullptr )
+			{
+				List<Entry^>^ bucket;
+				if( !m_Entries->TryGetValue( hashCode, bucket ) )
+				{
+					bucket = gcnew List<Entry^>();
+					m_Entries->Add( hashCode, bucket );
+				}
+
+				bucket->Add( created );
+				m_Layouts->Add( layout->ComPointer, created );
+				++m_Misses;
+				return layout;
+			}
+
+			++entry->References;
+			++m_Hits;
+			created = entry;
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		delete layout;
+		return created->Layout;
+	}
+
+	InputLayoutCache::Entry^ InputLayoutCache::Find( int hashCode, const unsigned char* signature, int length, array<InputElement>^ elements )
+	{
+		List<Entry^>^ bucket;
+		if( !m_Entries->TryGetValue( hashCode, bucket ) )
+			return nullptr;
+
+		for each( Entry^ entry in bucket )
+		{
+			if( entry->Signature->Length != length || entry->Elements->Length != elements->Length )
+				continue;
+
+			bool equal = true;
+			for( int i = 0; i < elements->Length && equal; ++i )
+				equal = InputElement::Equals( entry->Elements[i], elements[i] );
+
+			if( equal && length > 0 )
+			{
+				pin_ptr<Byte> pinnedSignature = &entry->Signature[0];
+				equal = memcmp( pinnedSignature, signature, length ) == 0;
+			}
+
+			if( equal )
+				return entry;
+		}
+
+		return nullptr;
+	}
+
+	void InputLayoutCache::Remove( Entry^ entry )
+	{
+		List<Entry^>^ bucket;
+		if( m_Entries->TryGetValue( entry->HashCode, bucket ) )
+		{
+			bucket->Remove( entry );
+			if( bucket->Count == 0 )
+				m_Entries->Remove( entry->HashCode );
+		}
+
+		m_Layouts->Remove( entry->Layout->ComPointer );
+	}
+
+	bool InputLayoutCache::Release( InputLayout^ layout )
+	{
+		if( layout == nullptr )
+			throw gcnew ArgumentNullException( "layout" );
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			Entry^ entry;
+			if( !m_Layouts->TryGetValue( layout->ComPointer, entry ) )
+				return false;
+
+			if( --entry->References > 0 )
+				return true;
+
+			Remove( entry );
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		delete layout;
+		return true;
+	}
+
+	void InputLayoutCache::Clear()
+	{
+		List<InputLayout^>^ layouts = gcnew List<InputLayout^>();
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			for each( Entry^ entry in m_Layouts->Values )
+				layouts->Add( entry->Layout );
+
+			m_Entries->Clear();
+			m_Layouts->Clear();
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		for each( InputLayout^ layout in layouts )
+			delete layout;
+	}
+
+	void InputLayoutCache::OnObjectRemoved( Object^ sender, ObjectTableEventArgs^ e )
+	{
+		SLIMDX_UNREFERENCED_PARAMETER( sender );
+
+		InputLayout^ layout = dynamic_cast<InputLayout^>( e->ComObject );
+		if( layout == nullptr )
+			return;
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			Entry^ entry;
+			if( m_Layouts->TryGetValue( layout->ComPointer, entry ) && entry->Layout == layout )
+				Remove( entry );
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+	}
+
+	int InputLayoutCache::Count::get()
+	{
+		return m_Layouts->Count;
+	}
+}
+}
@@ -49,7 +49,7 @@ namespace Direct3D11
 	{
 		IDXGISurface* unknown = 0;
 		GUID guid = Utilities::GetNativeGuidForType( SlimDX::DXGI::Surface::typeid );
-		HRESULT hr = InternalPointer->QueryInterface(guid, reinterpret_cast<void**>(&unknown));
+		HRESULT hr = TIME_CALL( InternalPointer->QueryInterface(guid, reinterpret_cast<void**>(&unknown)) );
 		if(RECORD_D3D11(hr).IsFailure)
 			return nullptr;
 
@@ -62,8 +62,7 @@ namespace Direct3D11
 	{
 		IUnknown* unknown = 0;
 		GUID guid = Utilities::GetNativeGuidForType( T::typeid );
-		RECORD_D3D11( swapChain->InternalPointer->GetBuffer( index, guid, reinterpret_cast<void**>( &unknown ) ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_D3D11( swapChain->InternalPointer->GetBuffer( index, guid, reinterpret_cast<void**>( &unknown ) ) ).IsFailure )
 			return T();
 
 		BindingFlags flags = BindingFlags::Static | BindingFlags::InvokeMethod | BindingFlags::NonPublic;
@@ -121,7 +120,7 @@ namespace Direct3D11
 
 		void* result = 0;
 		IUnknown* unknown = static_cast<IUnknown*>( pointer.ToPointer() );
-		HRESULT hr = unknown->QueryInterface(IID_ID3D11Resource, &result);
+		HRESULT hr = TIME_CALL( unknown->QueryInterface(IID_ID3D11Resource, &result) );
 		if( FAILED( hr ) )
 			throw gcnew InvalidCastException( "Failed to QueryInterface on user-supplied pointer." );
 
@@ -191,13 +190,13 @@ namespace Direct3D11
 
 	Result Resource::LoadTextureFromTexture(DeviceContext^ context, Resource^ source, Resource^ destination, TextureLoadInformation loadInformation)
 	{
-		HRESULT hr = D3DX11LoadTextureFromTexture(context->InternalPointer, source->InternalPointer, reinterpret_cast<D3DX11_TEXTURE_LOAD_INFO*>(&loadInformation), destination->InternalPointer);
+		HRESULT hr = TIME_CALL( D3DX11LoadTextureFromTexture(context->InternalPointer, source->InternalPointer, reinterpret_cast<D3DX11_TEXTURE_LOAD_INFO*>(&loadInformation), destination->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 
 	Result Resource::FilterTexture(DeviceContext^ context, Resource^ texture, int sourceLevel, FilterFlags mipFilter)
 	{
-		HRESULT hr = D3DX11FilterTexture(context->InternalPointer, texture->InternalPointer, sourceLevel, static_cast<UINT>(mipFilter));
+		HRESULT hr = TIME_CALL( D3DX11FilterTexture(context->InternalPointer, texture->InternalPointer, sourceLevel, static_cast<UINT>(mipFilter)) );
 		return RECORD_D3D11(hr);
 	}
 	
@@ -205,7 +204,7 @@ namespace Direct3D11
 	{	
 		ID3D11Resource* resource = 0;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
-		HRESULT hr = D3DX11CreateTextureFromFile( device->InternalPointer, pinnedName, info, 0, &resource, 0 );
+		HRESULT hr = TIME_CALL( D3DX11CreateTextureFromFile( device->InternalPointer, pinnedName, info, 0, &resource, 0 ) );
 		RECORD_D3D11( hr );
 		
 		return resource;
@@ -216,7 +215,7 @@ namespace Direct3D11
 		pin_ptr<unsigned char> pinnedMemory = &memory[0];
 		
 		ID3D11Resource* resource = 0;
-		HRESULT hr = D3DX11CreateTextureFromMemory( device->InternalPointer, pinnedMemory, memory->Length, info, 0, &resource, 0 ); 
+		HRESULT hr = TIME_CALL( D3DX11CreateTextureFromMemory( device->InternalPointer, pinnedMemory, memory->Length, info, 0, &resource, 0 ) ); 
 		RECORD_D3D11( hr );
 		
 		return resource;
@@ -231,8 +230,8 @@ namespace Direct3D11
 		{
 			ID3D11Resource* resource = NULL;
 			SIZE_T size = static_cast<SIZE_T>( ds->RemainingLength );
-			HRESULT hr = D3DX11CreateTextureFromMemory( device->InternalPointer, ds->SeekToEnd(), size,
-				info, NULL, &resource, NULL );
+			HRESULT hr = TIME_CALL( D3DX11CreateTextureFromMemory( device->InternalPointer, ds->SeekToEnd(), size,
+				info, NULL, &resource, NULL ) );
 			RECORD_D3D11( hr );
 
 			return resource;
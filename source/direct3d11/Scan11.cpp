@@ -39,7 +39,7 @@ namespace Direct3D11
 			throw gcnew System::ArgumentNullException( "deviceContext" );
 
 		ID3DX11Scan* nativeScan;
-		HRESULT hr = D3DX11CreateScan( deviceContext->InternalPointer, maxElementScanSize, maxScanCount, &nativeScan );
+		HRESULT hr = TIME_CALL( D3DX11CreateScan( deviceContext->InternalPointer, maxElementScanSize, maxScanCount, &nativeScan ) );
 		if (RECORD_D3D11( hr ).IsFailure)
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -48,7 +48,7 @@ namespace Direct3D11
 
 	Result Scan::SetScanDirection( ScanDirection value )
 	{
-		HRESULT hr = InternalPointer->SetScanDirection( static_cast<D3DX11_SCAN_DIRECTION>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetScanDirection( static_cast<D3DX11_SCAN_DIRECTION>( value ) ) );
 		return RECORD_D3D11( hr );
 	}
 
@@ -57,7 +57,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* nativeSrc = src == nullptr ? NULL : src->InternalPointer;
 		ID3D11UnorderedAccessView* nativeDest = dest == nullptr ? NULL : dest->InternalPointer;
 
-		HRESULT hr = InternalPointer->Scan( static_cast<D3DX11_SCAN_DATA_TYPE>( elementType ), static_cast<D3DX11_SCAN_OPCODE>( operation ), numberOfElements, nativeSrc, nativeDest );
+		HRESULT hr = TIME_CALL( InternalPointer->Scan( static_cast<D3DX11_SCAN_DATA_TYPE>( elementType ), static_cast<D3DX11_SCAN_OPCODE>( operation ), numberOfElements, nativeSrc, nativeDest ) );
 		return RECORD_D3D11( hr );
 	}
 
@@ -66,7 +66,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* nativeSrc = src == nullptr ? NULL : src->InternalPointer;
 		ID3D11UnorderedAccessView* nativeDest = dest == nullptr ? NULL : dest->InternalPointer;
 
-		HRESULT hr = InternalPointer->Multiscan( static_cast<D3DX11_SCAN_DATA_TYPE>( elementType ), static_cast<D3DX11_SCAN_OPCODE>( operation ), numberOfElements, scanPitchInElements, scanCount, nativeSrc, nativeDest );
+		HRESULT hr = TIME_CALL( InternalPointer->Multiscan( static_cast<D3DX11_SCAN_DATA_TYPE>( elementType ), static_cast<D3DX11_SCAN_OPCODE>( operation ), numberOfElements, scanPitchInElements, scanCount, nativeSrc, nativeDest ) );
 		return RECORD_D3D11( hr );
 	}
 }
@@ -39,7 +39,7 @@ namespace Direct3D11
 			throw gcnew System::ArgumentNullException( "deviceContext" );
 
 		ID3DX11SegmentedScan* nativeScan;
-		HRESULT hr = D3DX11CreateSegmentedScan( deviceContext->InternalPointer, maxElementScanSize, &nativeScan );
+		HRESULT hr = TIME_CALL( D3DX11CreateSegmentedScan( deviceContext->InternalPointer, maxElementScanSize, &nativeScan ) );
 		if (RECORD_D3D11( hr ).IsFailure)
 			throw gcnew Direct3D11Exception( Result::Last );
 
@@ -48,7 +48,7 @@ namespace Direct3D11
 
 	Result SegmentedScan::SetScanDirection( ScanDirection value )
 	{
-		HRESULT hr = InternalPointer->SetScanDirection( static_cast<D3DX11_SCAN_DIRECTION>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetScanDirection( static_cast<D3DX11_SCAN_DIRECTION>( value ) ) );
 		return RECORD_D3D11( hr );
 	}
 
@@ -58,7 +58,7 @@ namespace Direct3D11
 		ID3D11UnorderedAccessView* nativeSrcElementFlags = srcElementFlags == nullptr ? NULL : srcElementFlags->InternalPointer;
 		ID3D11UnorderedAccessView* nativeDest = dest == nullptr ? NULL : dest->InternalPointer;
 
-		HRESULT hr = InternalPointer->SegScan( static_cast<D3DX11_SCAN_DATA_TYPE>( elementType ), static_cast<D3DX11_SCAN_OPCODE>( operation ), numberOfElements, nativeSrc, nativeSrcElementFlags, nativeDest );
+		HRESULT hr = TIME_CALL( InternalPointer->SegScan( static_cast<D3DX11_SCAN_DATA_TYPE>( elementType ), static_cast<D3DX11_SCAN_OPCODE>( operation ), numberOfElements, nativeSrc, nativeSrcElementFlags, nativeDest ) );
 		return RECORD_D3D11( hr );
 	}
 }
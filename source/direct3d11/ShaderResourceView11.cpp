@@ -137,7 +137,7 @@ namespace Direct3D11
 	{
 		ID3D11ShaderResourceView* resource = 0;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
-		HRESULT hr = D3DX11CreateShaderResourceViewFromFile( device->InternalPointer, pinnedName, loadInformation, 0, &resource, 0 );
+		HRESULT hr = TIME_CALL( D3DX11CreateShaderResourceViewFromFile( device->InternalPointer, pinnedName, loadInformation, 0, &resource, 0 ) );
 		RECORD_D3D11( hr );
 		
 		return resource;
@@ -148,7 +148,7 @@ namespace Direct3D11
 		ID3D11ShaderResourceView* resource = 0;
 		pin_ptr<unsigned char> pinnedMemory = &memory[0];
 
-		HRESULT hr = D3DX11CreateShaderResourceViewFromMemory( device->InternalPointer, pinnedMemory, memory->Length, loadInformation, 0, &resource, 0 );
+		HRESULT hr = TIME_CALL( D3DX11CreateShaderResourceViewFromMemory( device->InternalPointer, pinnedMemory, memory->Length, loadInformation, 0, &resource, 0 ) );
 		RECORD_D3D11( hr );
 		
 		return resource;
@@ -164,7 +164,7 @@ namespace Direct3D11
 			ID3D11ShaderResourceView* resource = NULL;
 			SIZE_T size = static_cast<SIZE_T>( ds->RemainingLength );
 
-			HRESULT hr = D3DX11CreateShaderResourceViewFromMemory( device->InternalPointer, ds->SeekToEnd(), size, info, NULL, &resource, NULL );
+			HRESULT hr = TIME_CALL( D3DX11CreateShaderResourceViewFromMemory( device->InternalPointer, ds->SeekToEnd(), size, info, NULL, &resource, NULL ) );
 			RECORD_D3D11( hr );
 
 			return resource;
@@ -0,0 +1,303 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "Direct3D11Exception.h"
+
+#include "Buffer11.h"
+#include "ConstantBufferLayout11.h"
+#include "ConstantPacking11.h"
+#include "Device11.h"
+#include "DeviceContext11.h"
+#include "ShadowConstantBuffer11.h"
+
+using namespace System;
+using namespace SlimDX::D3DCompiler;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	ShadowConstantBuffer::ShadowConstantBuffer( SlimDX::Direct3D11::Device^ device, ConstantBufferLayout^ layout )
+	{
+		Init( device, layout, ResourceUsage::Dynamic );
+	}
+
+	ShadowConstantBuffer::ShadowConstantBuffer( SlimDX::Direct3D11::Device^ device, ConstantBufferLayout^ layout, ResourceUsage usage )
+	{
+		Init( device, layout, usage );
+	}
+
+	void ShadowConstantBuffer::Init( SlimDX::Direct3D11::Device^ device, ConstantBufferLayout^ layout, ResourceUsage usage )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( layout == nullptr )
+			throw gcnew ArgumentNullException( "layout" );
+		if( usage != ResourceUsage::Dynamic && usage != ResourceUsage::Default )
+			throw gcnew ArgumentException( "A shadow constant buffer must use dynamic or default usage.", "usage" );
+		if( layout->SizeInBytes <= 0 )
+			throw gcnew ArgumentException( "The constant buffer layout is empty.", "layout" );
+
+		m_Layout = layout;
+		m_SizeInBytes = layout->SizeInBytes;
+		m_Dynamic = usage == ResourceUsage::Dynamic;
+		m_Buffer = gcnew SlimDX::Direct3D11::Buffer( device, m_SizeInBytes, usage, BindFlags::ConstantBuffer,
+			m_Dynamic ? CpuAccessFlags::Write : CpuAccessFlags::None, ResourceOptionFlags::None, 0 );
+
+		m_Data = new unsigned char[m_SizeInBytes];
+		pin_ptr<Byte> defaults = &layout->DefaultData[0];
+		memcpy( m_Data, defaults, m_SizeInBytes );
+
+		m_DirtyBegin = 0;
+		m_DirtyEnd = m_SizeInBytes;
+	}
+
+	ShadowConstantBuffer::~ShadowConstantBuffer()
+	{
+		delete m_Buffer;
+		m_Buffer = nullptr;
+
+		this->!ShadowConstantBuffer();
+	}
+
+	ShadowConstantBuffer::!ShadowConstantBuffer()
+	{
+		delete[] m_Data;
+		m_Data = NULL;
+	}
+
+	void ShadowConstantBuffer::CheckDisposed()
+	{
+		if( m_Data == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	ConstantBufferField ShadowConstantBuffer::GetField( int field, bool matrix, bool floatType )
+	{
+		CheckDisposed();
+
+		ConstantBufferField description = m_Layout->GetField( field );
+		ShaderVariableClass variableClass = description.Class;
+
+		if( matrix )
+		{
+			if( variableClass != ShaderVariableClass::MatrixRows && variableClass != ShaderVariableClass::MatrixColumns )
+				throw gcnew ArgumentException( String::Format( "The field '{0}' is not a matrix.", description.Name ), "field" );
+		}
+		else if( variableClass != ShaderVariableClass::Scalar && variableClass != ShaderVariableClass::Vector )
+			throw gcnew ArgumentException( String::Format( "The field '{0}' is not a scalar or vector.", description.Name ), "field" );
+
+		ShaderVariableType type = description.Type;
+		bool isFloat = type == ShaderVariableType::Float;
+		bool isInteger = type == ShaderVariableType::Int || type == ShaderVariableType::UInt || type == ShaderVariableType::Bool;
+		if( floatType ? !isFloat : !isInteger )
+			throw gcnew ArgumentException( String::Format( "The field '{0}' has a different component type than the value being set.", description.Name ), "field" );
+
+		return description;
+	}
+
+	void ShadowConstantBuffer::MarkDirty( int offset, int size )
+	{
+		if( offset < m_DirtyBegin )
+			m_DirtyBegin = offset;
+		if( offset + size > m_DirtyEnd )
+			m_DirtyEnd = offset + size;
+	}
+
+	void ShadowConstantBuffer::WriteElements( ConstantBufferField% field, const float* data, int count, int elementFloats )
+	{
+		if( PackElements( m_Data + field.Offset, field.ElementStride, data, count, elementFloats, field.Columns ) )
+			MarkDirty( field.Offset, field.Size );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	void ShadowConstantBuffer::Set( int field, float value )
+	{
+		ConstantBufferField description = GetField( field, false, true );
+		WriteElements( description, &value, 1, 1 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, int value )
+	{
+		ConstantBufferField description = GetField( field, false, false );
+		if( CopyIfChanged( m_Data + description.Offset, &value, sizeof(int) ) )
+			MarkDirty( description.Offset, sizeof(int) );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	void ShadowConstantBuffer::Set( int field, bool value )
+	{
+		Set( field, value ? TRUE : FALSE );
+	}
+
+	void ShadowConstantBuffer::Set( int field, Vector2 value )
+	{
+		ConstantBufferField description = GetField( field, false, true );
+		WriteElements( description, reinterpret_cast<float*>( &value ), 1, 2 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, Vector3 value )
+	{
+		ConstantBufferField description = GetField( field, false, true );
+		WriteElements( description, reinterpret_cast<float*>( &value ), 1, 3 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, Vector4 value )
+	{
+		ConstantBufferField description = GetField( field, false, true );
+		WriteElements( description, reinterpret_cast<float*>( &value ), 1, 4 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, Color4 value )
+	{
+		ConstantBufferField description = GetField( field, false, true );
+		WriteElements( description, reinterpret_cast<float*>( &value ), 1, 4 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, Matrix value )
+	{
+		ConstantBufferField description = GetField( field, true, true );
+		if( PackMatrix( m_Data + description.Offset, reinterpret_cast<float*>( &value ), description.Class == ShaderVariableClass::MatrixColumns,
+			Math::Min( description.Rows, 4 ), Math::Min( description.Columns, 4 ) ) )
+			MarkDirty( description.Offset, description.Size );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	void ShadowConstantBuffer::Set( int field, array<float>^ values )
+	{
+		if( values == nullptr )
+			throw gcnew ArgumentNullException( "values" );
+
+		ConstantBufferField description = GetField( field, false, true );
+		if( values->Length > Math::Max( description.Elements, 1 ) )
+			throw gcnew ArgumentOutOfRangeException( "values", "More values were supplied than the field has elements." );
+		if( values->Length == 0 )
+			return;
+
+		pin_ptr<float> pinnedValues = &values[0];
+		WriteElements( description, pinnedValues, values->Length, 1 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, array<Vector4>^ values )
+	{
+		if( values == nullptr )
+			throw gcnew ArgumentNullException( "values" );
+
+		ConstantBufferField description = GetField( field, false, true );
+		if( values->Length > Math::Max( description.Elements, 1 ) )
+			throw gcnew ArgumentOutOfRangeException( "values", "More values were supplied than the field has elements." );
+		if( values->Length == 0 )
+			return;
+
+		pin_ptr<Vector4> pinnedValues = &values[0];
+		WriteElements( description, reinterpret_cast<float*>( pinnedValues ), values->Length, 4 );
+	}
+
+	void ShadowConstantBuffer::Set( int field, array<Matrix>^ values )
+	{
+		if( values == nullptr )
+			throw gcnew ArgumentNullException( "values" );
+
+		ConstantBufferField description = GetField( field, true, true );
+		if( values->Length > Math::Max( description.Elements, 1 ) )
+			throw gcnew ArgumentOutOfRangeException( "values", "More values were supplied than the field has elements." );
+
+		if( values->Length == 0 )
+			return;
+
+		bool columnMajor = description.Class == ShaderVariableClass::MatrixColumns;
+		int rows = Math::Min( description.Rows, 4 );
+		int columns = Math::Min( description.Columns, 4 );
+		bool changed = false;
+
+		pin_ptr<Matrix> pinnedValues = &values[0];
+		const float* data = reinterpret_cast<const float*>( pinnedValues );
+		for( int i = 0; i < values->Length; ++i )
+			changed |= PackMatrix( m_Data + description.Offset + i * description.ElementStride, data + i * 16, columnMajor, rows, columns );
+
+		if( changed )
+			MarkDirty( description.Offset, description.Size );
+		else
+			++m_RedundantWriteCount;
+	}
+
+	Result ShadowConstantBuffer::Commit( DeviceContext^ context )
+	{
+		CheckDisposed();
+
+		if( context == nullptr )
+			throw gcnew ArgumentNullException( "context" );
+
+		if( m_DirtyBegin >= m_DirtyEnd )
+		{
+			++m_SkippedUploadCount;
+			return Result( S_OK );
+		}
+
+		ID3D11DeviceContext* nativeContext = context->InternalPointer;
+		ID3D11Buffer* buffer = m_Buffer->InternalPointer;
+
+		if( m_Dynamic )
+		{
+			// a discarded constant buffer comes back undefined, so the whole shadow copy is written
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			HRESULT hr = TIME_CALL( nativeContext->Map( buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped ) );
+			if( RECORD_D3D11( hr ).IsFailure )
+				return Result::Last;
+
+			memcpy( mapped.pData, m_Data, m_SizeInBytes );
+			nativeContext->Unmap( buffer, 0 );
+		}
+		else
+			nativeContext->UpdateSubresource( buffer, 0, NULL, m_Data, 0, 0 );
+
+		m_DirtyBegin = m_SizeInBytes;
+		m_DirtyEnd = 0;
+		++m_UploadCount;
+		m_UploadedBytes += m_SizeInBytes;
+
+		return Result( S_OK );
+	}
+
+	void ShadowConstantBuffer::Invalidate()
+	{
+		CheckDisposed();
+
+		m_DirtyBegin = 0;
+		m_DirtyEnd = m_SizeInBytes;
+	}
+
+	void ShadowConstantBuffer::ResetStatistics()
+	{
+		m_UploadCount = 0;
+		m_SkippedUploadCount = 0;
+		m_RedundantWriteCount = 0;
+		m_UploadedBytes = 0;
+	}
+}
+}
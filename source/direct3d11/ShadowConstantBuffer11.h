@@ -0,0 +1,270 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../math/Color4.h"
+#include "../math/Matrix.h"
+#include "../math/Vector2.h"
+#include "../math/Vector3.h"
+#include "../math/Vector4.h"
+
+#include "ConstantBufferField11.h"
+#include "Enums11.h"
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		ref class Buffer;
+		ref class ConstantBufferLayout;
+		ref class Device;
+		ref class DeviceContext;
+
+		/// <summary>
+		/// Keeps a CPU copy of a constant buffer laid out by a <see cref="ConstantBufferLayout"/> and uploads it only when it changes.
+		/// </summary>
+		/// <remarks>
+		/// Values are written by field index, obtained once from <see cref="ConstantBufferLayout.IndexOf"/>, and are packed into
+		/// the shadow copy using the offsets, array strides and matrix orientation recorded by the compiler, so column-major
+		/// matrices are transposed automatically. A write that leaves the bytes unchanged does not dirty the buffer.
+		///
+		/// <see cref="Commit"/> uploads the shadow copy only when something changed: dynamic buffers are mapped with
+		/// <see cref="MapMode">MapMode.WriteDiscard</see>, default buffers are updated with <c>UpdateSubresource</c>.
+		/// Direct3D 11.0 cannot update part of a constant buffer, so the whole buffer is uploaded.
+		/// The buffer starts out holding the default values of the reflected variables.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class ShadowConstantBuffer sealed
+		{
+		private:
+			SlimDX::Direct3D11::Buffer^ m_Buffer;
+			ConstantBufferLayout^ m_Layout;
+			unsigned char* m_Data;
+			int m_SizeInBytes;
+			int m_DirtyBegin;
+			int m_DirtyEnd;
+			bool m_Dynamic;
+			int m_UploadCount;
+			int m_SkippedUploadCount;
+			int m_RedundantWriteCount;
+			System::Int64 m_UploadedBytes;
+
+			void Init( SlimDX::Direct3D11::Device^ device, ConstantBufferLayout^ layout, ResourceUsage usage );
+			void CheckDisposed();
+			ConstantBufferField GetField( int field, bool matrix, bool floatType );
+			void MarkDirty( int offset, int size );
+			void WriteElements( ConstantBufferField% field, const float* data, int count, int elementFloats );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShadowConstantBuffer"/> class backed by a dynamic buffer.
+			/// </summary>
+			/// <param name="device">The device used to create the buffer.</param>
+			/// <param name="layout">The layout of the buffer.</param>
+			ShadowConstantBuffer( SlimDX::Direct3D11::Device^ device, ConstantBufferLayout^ layout );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShadowConstantBuffer"/> class.
+			/// </summary>
+			/// <param name="device">The device used to create the buffer.</param>
+			/// <param name="layout">The layout of the buffer.</param>
+			/// <param name="usage">Either <see cref="ResourceUsage">ResourceUsage.Dynamic</see> or <see cref="ResourceUsage">ResourceUsage.Default</see>.</param>
+			ShadowConstantBuffer( SlimDX::Direct3D11::Device^ device, ConstantBufferLayout^ layout, ResourceUsage usage );
+
+			/// <summary>
+			/// Releases the buffer and the shadow copy.
+			/// </summary>
+			~ShadowConstantBuffer();
+
+			/// <summary>
+			/// Releases the shadow copy.
+			/// </summary>
+			!ShadowConstantBuffer();
+
+			/// <summary>
+			/// Sets a float scalar or the first component of a float vector.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, float value );
+
+			/// <summary>
+			/// Sets an int, uint or bool scalar, or the first component of such a vector.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, int value );
+
+			/// <summary>
+			/// Sets an int, uint or bool scalar, or the first component of such a vector.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, bool value );
+
+			/// <summary>
+			/// Sets up to two components of a float vector.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, Vector2 value );
+
+			/// <summary>
+			/// Sets up to three components of a float vector.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, Vector3 value );
+
+			/// <summary>
+			/// Sets up to four components of a float vector.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, Vector4 value );
+
+			/// <summary>
+			/// Sets a float vector to the red, green, blue and alpha components of a color.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, Color4 value );
+
+			/// <summary>
+			/// Sets a float matrix, transposing it if the field is column-major. Fields with fewer than four rows or columns take the upper left part of the matrix.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="value">The value to set.</param>
+			void Set( int field, Matrix value );
+
+			/// <summary>
+			/// Sets the leading elements of a float scalar array.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="values">The values to set.</param>
+			void Set( int field, array<float>^ values );
+
+			/// <summary>
+			/// Sets the leading elements of a float vector array.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="values">The values to set.</param>
+			void Set( int field, array<Vector4>^ values );
+
+			/// <summary>
+			/// Sets the leading elements of a float matrix array.
+			/// </summary>
+			/// <param name="field">The index of the field in the layout.</param>
+			/// <param name="values">The values to set.</param>
+			void Set( int field, array<Matrix>^ values );
+
+			/// <summary>
+			/// Uploads the shadow copy to the buffer if it changed since the last upload.
+			/// </summary>
+			/// <param name="context">The context used to update the buffer.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Commit( DeviceContext^ context );
+
+			/// <summary>
+			/// Marks the whole buffer as dirty, so the next <see cref="Commit"/> uploads it.
+			/// </summary>
+			void Invalidate();
+
+			/// <summary>
+			/// Resets the upload and write counters to zero.
+			/// </summary>
+			void ResetStatistics();
+
+			/// <summary>
+			/// Gets the buffer that receives the uploads.
+			/// </summary>
+			property SlimDX::Direct3D11::Buffer^ Buffer
+			{
+				SlimDX::Direct3D11::Buffer^ get() { return m_Buffer; }
+			}
+
+			/// <summary>
+			/// Gets the layout of the buffer.
+			/// </summary>
+			property ConstantBufferLayout^ Layout
+			{
+				ConstantBufferLayout^ get() { return m_Layout; }
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether the shadow copy has changed since the last upload.
+			/// </summary>
+			property bool IsDirty
+			{
+				bool get() { return m_DirtyBegin < m_DirtyEnd; }
+			}
+
+			/// <summary>
+			/// Gets the offset of the first byte changed since the last upload.
+			/// </summary>
+			property int DirtyOffset
+			{
+				int get() { return IsDirty ? m_DirtyBegin : 0; }
+			}
+
+			/// <summary>
+			/// Gets the number of bytes between the first and last bytes changed since the last upload.
+			/// </summary>
+			property int DirtySize
+			{
+				int get() { return IsDirty ? m_DirtyEnd - m_DirtyBegin : 0; }
+			}
+
+			/// <summary>
+			/// Gets the number of times <see cref="Commit"/> uploaded the buffer.
+			/// </summary>
+			property int UploadCount
+			{
+				int get() { return m_UploadCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of times <see cref="Commit"/> found nothing to upload.
+			/// </summary>
+			property int SkippedUploadCount
+			{
+				int get() { return m_SkippedUploadCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of writes that left the shadow copy unchanged.
+			/// </summary>
+			property int RedundantWriteCount
+			{
+				int get() { return m_RedundantWriteCount; }
+			}
+
+			/// <summary>
+			/// Gets the total number of bytes uploaded.
+			/// </summary>
+			property System::Int64 UploadedBytes
+			{
+				System::Int64 get() { return m_UploadedBytes; }
+			}
+		};
+	}
+}
@@ -0,0 +1,259 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "Direct3D11Exception.h"
+
+#include "Device11.h"
+#include "StateCache11.h"
+
+using namespace System;
+using namespace System::Threading;
+using namespace System::Collections::Generic;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	static HRESULT CreateNative( ID3D11Device* device, BlendStateDescription description, ID3D11BlendState** state )
+	{
+		D3D11_BLEND_DESC nativeDescription = description.CreateNativeVersion();
+		return device->CreateBlendState( &nativeDescription, state );
+	}
+
+	static HRESULT CreateNative( ID3D11Device* device, DepthStencilStateDescription description, ID3D11DepthStencilState** state )
+	{
+		D3D11_DEPTH_STENCIL_DESC nativeDescription = description.CreateNativeVersion();
+		return device->CreateDepthStencilState( &nativeDescription, state );
+	}
+
+	static HRESULT CreateNative( ID3D11Device* device, RasterizerStateDescription description, ID3D11RasterizerState** state )
+	{
+		D3D11_RASTERIZER_DESC nativeDescription = description.CreateNativeVersion();
+		return device->CreateRasterizerState( &nativeDescription, state );
+	}
+
+	static HRESULT CreateNative( ID3D11Device* device, SamplerDescription description, ID3D11SamplerState** state )
+	{
+		D3D11_SAMPLER_DESC nativeDescription = description.CreateNativeVersion();
+		return device->CreateSamplerState( &nativeDescription, state );
+	}
+
+	template<typename TState, typename TNative, typename TDescription>
+	static TState^ GetState( Dictionary<TDescription, TState^>^ states, Dictionary<ComObject^, bool>^ owned, Object^ syncObject, SlimDX::Direct3D11::Device^ device, TDescription description, int% hits, int% misses )
+	{
+		TState^ state;
+
+		Monitor::Enter( syncObject );
+		try
+		{
+			if( states->TryGetValue( description, state ) )
+			{
+				++hits;
+				return state;
+			}
+		}
+		finally
+		{
+			Monitor::Exit( syncObject );
+		}
+
+		// The object table raises ObjectRemoved under its own lock, so no lock is held while creating.
+		// D3D returns the same native object for equal descriptions; if the table already had a wrapper
+		// for it, or no longer tracks the one we got back, the wrapper belongs to someone else.
+		TNative* native = 0;
+		if( RECORD_D3D11( CreateNative( device->InternalPointer, description, &native ) ).IsFailure )
+			return nullptr;
+
+		ComObject^ existing = ObjectTable::Find( IntPtr( native ) );
+		state = TState::FromPointer( native );
+		bool created = existing == nullptr && ObjectTable::Find( IntPtr( native ) ) == state;
+
+		Monitor::Enter( syncObject );
+		try
+		{
+			// round trip through the native description so the key doesn't share arrays with the caller
+			TDescription key = TDescription( description.CreateNativeVersion() );
+
+			TState^ existing;
+			if( !states->TryGetValue( key, existing ) )
+				states->Add( key, state );
+			if( created )
+				owned[state] = true;
+
+			++misses;
+		}
+		finally
+		{
+			Monitor::Exit( syncObject );
+		}
+
+		return state;
+	}
+
+	template<typename TState, typename TDescription>
+	static void RemoveState( Dictionary<TDescription, TState^>^ states, TState^ state )
+	{
+		List<TDescription>^ keys = gcnew List<TDescription>();
+		for each( KeyValuePair<TDescription, TState^> pair in states )
+		{
+			if( pair.Value == state )
+				keys->Add( pair.Key );
+		}
+
+		for each( TDescription key in keys )
+			states->Remove( key );
+	}
+
+	template<typename TState, typename TDescription>
+	static void AddDistinct( Dictionary<ComObject^, bool>^ states, Dictionary<TDescription, TState^>^ table )
+	{
+		for each( TState^ state in table->Values )
+			states[state] = true;
+	}
+
+	StateCache::StateCache( SlimDX::Direct3D11::Device^ device )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+
+		m_Device = device;
+		m_BlendStates = gcnew Dictionary<BlendStateDescription, BlendState^>();
+		m_DepthStencilStates = gcnew Dictionary<DepthStencilStateDescription, DepthStencilState^>();
+		m_RasterizerStates = gcnew Dictionary<RasterizerStateDescription, RasterizerState^>();
+		m_SamplerStates = gcnew Dictionary<SamplerDescription, SamplerState^>();
+		m_Owned = gcnew Dictionary<ComObject^, bool>();
+		m_SyncObject = gcnew Object();
+
+		m_Subscription = gcnew WeakObjectRemovedSubscription<StateCache>( this );
+	}
+
+	StateCache::~StateCache()
+	{
+		m_Subscription->Unsubscribe();
+		Clear();
+	}
+
+	StateCache::!StateCache()
+	{
+		// like any other undisposed COM object, the states are left to the table's leak report
+		m_Subscription->Unsubscribe();
+	}
+
+	BlendState^ StateCache::GetBlendState( BlendStateDescription description )
+	{
+		return GetState<BlendState, ID3D11BlendState>( m_BlendStates, m_Owned, m_SyncObject, m_Device, description, m_Hits, m_Misses );
+	}
+
+	DepthStencilState^ StateCache::GetDepthStencilState( DepthStencilStateDescription description )
+	{
+		return GetState<DepthStencilState, ID3D11DepthStencilState>( m_DepthStencilStates, m_Owned, m_SyncObject, m_Device, description, m_Hits, m_Misses );
+	}
+
+	RasterizerState^ StateCache::GetRasterizerState( RasterizerStateDescription description )
+	{
+		return GetState<RasterizerState, ID3D11RasterizerState>( m_RasterizerStates, m_Owned, m_SyncObject, m_Device, description, m_Hits, m_Misses );
+	}
+
+	SamplerState^ StateCache::GetSamplerState( SamplerDescription description )
+	{
+		return GetState<SamplerState, ID3D11SamplerState>( m_SamplerStates, m_Owned, m_SyncObject, m_Device, description, m_Hits, m_Misses );
+	}
+
+	Dictionary<ComObject^, bool>^ StateCache::CollectStates()
+	{
+		// equivalent descriptions can map to the same native object, so only count each state once
+		Dictionary<ComObject^, bool>^ states = gcnew Dictionary<ComObject^, bool>();
+		AddDistinct( states, m_BlendStates );
+		AddDistinct( states, m_DepthStencilStates );
+		AddDistinct( states, m_RasterizerStates );
+		AddDistinct( states, m_SamplerStates );
+		return states;
+	}
+
+	void StateCache::Clear()
+	{
+		List<ComObject^>^ states;
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			states = gcnew List<ComObject^>( m_Owned->Keys );
+
+			m_Owned->Clear();
+			m_BlendStates->Clear();
+			m_DepthStencilStates->Clear();
+			m_RasterizerStates->Clear();
+			m_SamplerStates->Clear();
+			m_Hits = 0;
+			m_Misses = 0;
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+
+		for each( ComObject^ state in states )
+		{
+			if( !state->Disposed )
+				delete state;
+		}
+	}
+
+	void StateCache::OnObjectRemoved( Object^ sender, ObjectTableEventArgs^ e )
+	{
+		SLIMDX_UNREFERENCED_PARAMETER( sender );
+
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			m_Owned->Remove( e->ComObject );
+
+			if( dynamic_cast<BlendState^>( e->ComObject ) != nullptr )
+				RemoveState( m_BlendStates, safe_cast<BlendState^>( e->ComObject ) );
+			else if( dynamic_cast<DepthStencilState^>( e->ComObject ) != nullptr )
+				RemoveState( m_DepthStencilStates, safe_cast<DepthStencilState^>( e->ComObject ) );
+			else if( dynamic_cast<RasterizerState^>( e->ComObject ) != nullptr )
+				RemoveState( m_RasterizerStates, safe_cast<RasterizerState^>( e->ComObject ) );
+			else if( dynamic_cast<SamplerState^>( e->ComObject ) != nullptr )
+				RemoveState( m_SamplerStates, safe_cast<SamplerState^>( e->ComObject ) );
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+	}
+
+	int StateCache::Count::get()
+	{
+		Monitor::Enter( m_SyncObject );
+		try
+		{
+			return CollectStates()->Count;
+		}
+		finally
+		{
+			Monitor::Exit( m_SyncObject );
+		}
+	}
+}
+}
@@ -0,0 +1,152 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../ObjectTable.h"
+
+#include "BlendState11.h"
+#include "BlendStateDescription11.h"
+#include "DepthStencilState11.h"
+#include "DepthStencilStateDescription11.h"
+#include "RasterizerState11.h"
+#include "RasterizerStateDescription11.h"
+#include "SamplerState11.h"
+#include "SamplerDescription11.h"
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		ref class Device;
+
+		/// <summary>
+		/// Shares immutable pipeline state objects between callers that request equivalent descriptions.
+		/// </summary>
+		/// <remarks>
+		/// Lookups are made against the managed description, so a state that is already cached is returned without
+		/// a call into the device. States disposed directly are removed from the cache as they leave the <see cref="ObjectTable"/>.
+		///
+		/// The device returns the same object for equal descriptions, and SlimDX shares one wrapper per object. The cache
+		/// therefore only disposes, on <see cref="Clear"/> or disposal, the wrappers its own requests created; a state that
+		/// already existed when the cache first asked for it stays with its creator. A wrapper the cache created is still
+		/// disposed even if other code later obtained the same wrapper through <c>FromDescription</c>, so code that mixes the
+		/// cache with direct creation of the same descriptions must not keep using those states after clearing the cache.
+		/// Callers should not dispose states returned by the cache themselves.
+		///
+		/// The cache does not keep itself alive through its <see cref="ObjectTable"/> subscription, but a cache that is
+		/// collected without being disposed leaves the states it created in the table, where they are reported as leaks.
+		/// </remarks>
+		public ref class StateCache sealed
+		{
+		private:
+			SlimDX::Direct3D11::Device^ m_Device;
+			System::Collections::Generic::Dictionary<BlendStateDescription, BlendState^>^ m_BlendStates;
+			System::Collections::Generic::Dictionary<DepthStencilStateDescription, DepthStencilState^>^ m_DepthStencilStates;
+			System::Collections::Generic::Dictionary<RasterizerStateDescription, RasterizerState^>^ m_RasterizerStates;
+			System::Collections::Generic::Dictionary<SamplerDescription, SamplerState^>^ m_SamplerStates;
+			System::Collections::Generic::Dictionary<ComObject^, bool>^ m_Owned;
+			WeakObjectRemovedSubscription<StateCache>^ m_Subscription;
+			System::Object^ m_SyncObject;
+			int m_Hits;
+			int m_Misses;
+
+			System::Collections::Generic::Dictionary<ComObject^, bool>^ CollectStates();
+
+		internal:
+			void OnObjectRemoved( System::Object^ sender, ObjectTableEventArgs^ e );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="StateCache"/> class.
+			/// </summary>
+			/// <param name="device">The device used to create state objects.</param>
+			StateCache( SlimDX::Direct3D11::Device^ device );
+
+			/// <summary>
+			/// Disposes every state object held by the cache.
+			/// </summary>
+			~StateCache();
+
+			/// <summary>
+			/// Stops listening for states leaving the <see cref="ObjectTable"/>. States still held are not disposed.
+			/// </summary>
+			!StateCache();
+
+			/// <summary>
+			/// Gets a blend state matching the specified description, creating it if necessary.
+			/// </summary>
+			/// <param name="description">The state description.</param>
+			/// <returns>The shared state object.</returns>
+			BlendState^ GetBlendState( BlendStateDescription description );
+
+			/// <summary>
+			/// Gets a depth-stencil state matching the specified description, creating it if necessary.
+			/// </summary>
+			/// <param name="description">The state description.</param>
+			/// <returns>The shared state object.</returns>
+			DepthStencilState^ GetDepthStencilState( DepthStencilStateDescription description );
+
+			/// <summary>
+			/// Gets a rasterizer state matching the specified description, creating it if necessary.
+			/// </summary>
+			/// <param name="description">The state description.</param>
+			/// <returns>The shared state object.</returns>
+			RasterizerState^ GetRasterizerState( RasterizerStateDescription description );
+
+			/// <summary>
+			/// Gets a sampler state matching the specified description, creating it if necessary.
+			/// </summary>
+			/// <param name="description">The state description.</param>
+			/// <returns>The shared state object.</returns>
+			SamplerState^ GetSamplerState( SamplerDescription description );
+
+			/// <summary>
+			/// Removes every state from the cache, disposes the states the cache created and resets the statistics.
+			/// </summary>
+			void Clear();
+
+			/// <summary>
+			/// Gets the number of distinct state objects held by the cache.
+			/// </summary>
+			property int Count
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of requests that were satisfied without a call into the device.
+			/// </summary>
+			property int HitCount
+			{
+				int get() { return m_Hits; }
+			}
+
+			/// <summary>
+			/// Gets the number of requests that required a state object to be created.
+			/// </summary>
+			property int MissCount
+			{
+				int get() { return m_Misses; }
+			}
+		};
+	}
+};
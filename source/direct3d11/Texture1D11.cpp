@@ -183,14 +183,14 @@ namespace Direct3D11
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DX11SaveTextureToFile( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), pinnedName );
+		HRESULT hr = TIME_CALL( D3DX11SaveTextureToFile( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), pinnedName ) );
 		return RECORD_D3D11( hr );
 	}
 
 	Result Texture1D::ToStream( DeviceContext^ context, Texture1D^ texture, ImageFileFormat format, Stream^ stream )
 	{
 		ID3D10Blob* blob = 0;
-		HRESULT hr = D3DX11SaveTextureToMemory( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), &blob, 0 );
+		HRESULT hr = TIME_CALL( D3DX11SaveTextureToMemory( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), &blob, 0 ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return Result::Last;
 		
@@ -200,7 +200,7 @@ namespace Direct3D11
 			stream->WriteByte( bytes[byteIndex] );
 		
 		blob->Release();
-		return Result::Last;
+		return Result( hr );
 	}
 }
 }
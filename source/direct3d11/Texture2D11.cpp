@@ -27,6 +27,8 @@
 #include "../DataRectangle.h"
 #include "../DataStream.h"
 
+#include "../dxgi/ImageProcessor.h"
+
 #include "Direct3D11Exception.h"
 
 #include "Device11.h"
@@ -185,18 +187,73 @@ namespace Direct3D11
 		return Texture2D::FromPointer( static_cast<ID3D11Texture2D*>( resource ) );
 	}
 
+	Texture2D^ Texture2D::FromUncompressedData( SlimDX::Direct3D11::Device^ device, DataBox^ data, int width, int height, DXGI::Format format, DXGI::BlockCompressionQuality quality, int mipLevels )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( !DXGI::BlockCompression::IsSupported( format ) )
+			throw gcnew ArgumentException( "The format must be a block compressed format.", "format" );
+
+		array<DataBox^>^ levels = mipLevels == 1 ? gcnew array<DataBox^> { data } :
+			DXGI::ImageProcessor::GenerateMipChain( data, width, height, DXGI::BlockCompression::GetUncompressedFormat( format ), DXGI::ImageFilter::Kaiser, mipLevels );
+		array<DataRectangle^>^ compressed = gcnew array<DataRectangle^>( levels->Length );
+
+		try
+		{
+			int levelWidth = width;
+			int levelHeight = height;
+			for( int level = 0; level < levels->Length; ++level )
+			{
+				DataBox^ box = DXGI::BlockCompression::Compress( levels[level], levelWidth, levelHeight, format, quality );
+				compressed[level] = gcnew DataRectangle( box->RowPitch, box->Data );
+
+				levelWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+				levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+			}
+
+			Texture2DDescription description;
+			description.Width = width;
+			description.Height = height;
+			description.MipLevels = levels->Length;
+			description.ArraySize = 1;
+			description.Format = format;
+			description.SampleDescription = DXGI::SampleDescription( 1, 0 );
+			description.Usage = ResourceUsage::Immutable;
+			description.BindFlags = BindFlags::ShaderResource;
+			description.CpuAccessFlags = CpuAccessFlags::None;
+			description.OptionFlags = ResourceOptionFlags::None;
+
+			return gcnew Texture2D( device, description, compressed );
+		}
+		finally
+		{
+			for each( DataRectangle^ rectangle in compressed )
+			{
+				if( rectangle != nullptr )
+					delete rectangle->Data;
+			}
+
+			// the caller's top level is left alone; generated levels are ours to release
+			if( levels[0] != data )
+			{
+				for each( DataBox^ level in levels )
+					delete level->Data;
+			}
+		}
+	}
+
 	Result Texture2D::ToFile( DeviceContext^ context, Texture2D^ texture, ImageFileFormat format, String^ fileName )
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DX11SaveTextureToFile( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), pinnedName );
+		HRESULT hr = TIME_CALL( D3DX11SaveTextureToFile( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), pinnedName ) );
 		return RECORD_D3D11( hr );
 	}
 
 	Result Texture2D::ToStream( DeviceContext^ context, Texture2D^ texture, ImageFileFormat format, Stream^ stream )
 	{
 		ID3D10Blob* blob = 0;
-		HRESULT hr = D3DX11SaveTextureToMemory( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), &blob, 0 );
+		HRESULT hr = TIME_CALL( D3DX11SaveTextureToMemory( context->InternalPointer, texture->InternalPointer, static_cast<D3DX11_IMAGE_FILE_FORMAT>( format ), &blob, 0 ) );
 		if( RECORD_D3D11( hr ).IsFailure )
 			return Result::Last;
 		
@@ -206,12 +263,12 @@ namespace Direct3D11
 			stream->WriteByte( bytes[byteIndex] );
 		
 		blob->Release();
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Texture2D::ComputeNormalMap(DeviceContext^ context, Texture2D^ source, Texture2D^ destination, NormalMapFlags flags, Channel channel, float amplitude)
 	{
-		HRESULT hr = D3DX11ComputeNormalMap(context->InternalPointer, source->InternalPointer, static_cast<UINT>(flags), static_cast<UINT>(channel), amplitude, destination->InternalPointer);
+		HRESULT hr = TIME_CALL( D3DX11ComputeNormalMap(context->InternalPointer, source->InternalPointer, static_cast<UINT>(flags), static_cast<UINT>(channel), amplitude, destination->InternalPointer) );
 		return RECORD_D3D11(hr);
 	}
 }
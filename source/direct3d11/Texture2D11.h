@@ -25,6 +25,8 @@
 #include "Resource11.h"
 #include "ImageLoadInformation11.h"
 
+#include "../dxgi/BlockCompression.h"
+
 namespace SlimDX
 {
 	ref class DataRectangle;
@@ -131,6 +133,23 @@ namespace SlimDX
 			/// <returns>The loaded texture object.</returns>
 			static Texture2D^ FromStream( SlimDX::Direct3D11::Device^ device, System::IO::Stream^ stream, int sizeInBytes, ImageLoadInformation loadInfo );
 
+			/// <summary>
+			/// Creates an immutable block compressed texture from uncompressed image data.
+			/// </summary>
+			/// <param name="device">The device with which to associate the texture.</param>
+			/// <param name="data">The top level image, laid out in the format returned by <see cref="SlimDX::DXGI::BlockCompression::GetUncompressedFormat"/>.</param>
+			/// <param name="width">The width of the image, in pixels.</param>
+			/// <param name="height">The height of the image, in pixels.</param>
+			/// <param name="format">The block compressed format of the texture.</param>
+			/// <param name="quality">The effort spent searching for the best encoding.</param>
+			/// <param name="mipLevels">The number of mip levels to create, or zero for a complete chain.</param>
+			/// <returns>The created texture, bound as a shader resource.</returns>
+			/// <remarks>
+			/// Lower mip levels are generated with a Kaiser filter before each level is compressed on the CPU.
+			/// The result can be written out as a DDS file with <see cref="ToFile"/>.
+			/// </remarks>
+			static Texture2D^ FromUncompressedData( SlimDX::Direct3D11::Device^ device, DataBox^ data, int width, int height, DXGI::Format format, DXGI::BlockCompressionQuality quality, int mipLevels );
+
 			/// <summary>
 			/// Saves a texture to file.
 			/// </summary>
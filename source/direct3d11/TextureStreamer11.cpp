@@ -0,0 +1,347 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <d3d11.h>
+
+#include "../dxgi/SampleDescription.h"
+
+#include "DdsFile11.h"
+#include "Device11.h"
+#include "DeviceContext11.h"
+#include "Texture2D11.h"
+#include "Texture2DDescription11.h"
+#include "TextureStreamer11.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Threading;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	// Levels smaller than this are uploaded together by the first LoadNext call.
+	const Int64 MipTailSize = 64 * 1024;
+
+	TextureStreamer::TextureStreamer( SlimDX::Direct3D11::Device^ device, String^ fileName )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( fileName == nullptr )
+			throw gcnew ArgumentNullException( "fileName" );
+
+		try
+		{
+			Int64 length;
+			if( TryMapFile( fileName, length ) )
+			{
+				m_File = DdsFile::FromPointer( m_View, length );
+			}
+			else
+			{
+				// fall back to reading when the file cannot be mapped, such as when it exceeds the address space
+				m_Stream = System::IO::File::OpenRead( fileName );
+				m_OwnsStream = true;
+				m_File = DdsFile::FromStream( m_Stream );
+			}
+
+			Initialize( device );
+		}
+		catch( Exception^ )
+		{
+			CloseSource();
+			throw;
+		}
+	}
+
+	TextureStreamer::TextureStreamer( SlimDX::Direct3D11::Device^ device, Stream^ stream )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( stream == nullptr )
+			throw gcnew ArgumentNullException( "stream" );
+		if( !stream->CanRead || !stream->CanSeek )
+			throw gcnew ArgumentException( "The stream must be readable and seekable.", "stream" );
+
+		m_Stream = stream;
+		m_StreamOrigin = stream->Position;
+		m_File = DdsFile::FromStream( stream );
+		Initialize( device );
+	}
+
+	TextureStreamer::~TextureStreamer()
+	{
+		CloseSource();
+	}
+
+	TextureStreamer::!TextureStreamer()
+	{
+		UnmapFile();
+	}
+
+	void TextureStreamer::Initialize( SlimDX::Direct3D11::Device^ device )
+	{
+		if( m_File->Dimension != ResourceDimension::Texture2D )
+			throw gcnew NotSupportedException( "Only two-dimensional textures and cube maps can be streamed." );
+
+		Texture2DDescription description;
+		description.Width = m_File->Width;
+		description.Height = m_File->Height;
+		description.MipLevels = m_File->MipLevels;
+		description.ArraySize = m_File->ArraySize;
+		description.Format = m_File->Format;
+		description.SampleDescription = DXGI::SampleDescription( 1, 0 );
+		description.Usage = ResourceUsage::Default;
+		description.BindFlags = BindFlags::ShaderResource;
+		description.CpuAccessFlags = CpuAccessFlags::None;
+		description.OptionFlags = m_File->IsCubeMap ? ResourceOptionFlags::TextureCube : ResourceOptionFlags::None;
+
+		m_Texture = gcnew Texture2D( device, description );
+		m_ResidentMipLevel = m_File->MipLevels;
+
+		if( m_Stream != nullptr )
+		{
+			m_ReadDone = gcnew ManualResetEvent( false );
+			m_ReadCallback = gcnew WaitCallback( this, &TextureStreamer::ReadCallback );
+
+			// start on the mip tail right away so the first upload does not wait for the disk
+			BeginRead( m_ResidentMipLevel - 1 );
+		}
+	}
+
+	bool TextureStreamer::TryMapFile( String^ fileName, Int64% length )
+	{
+		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
+		HANDLE file = CreateFileW( pinnedName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+		if( file == INVALID_HANDLE_VALUE )
+			return false;
+
+		m_FileHandle = file;
+
+		LARGE_INTEGER size;
+		if( !GetFileSizeEx( file, &size ) || size.QuadPart == 0 )
+		{
+			UnmapFile();
+			return false;
+		}
+
+		m_Mapping = CreateFileMappingW( file, NULL, PAGE_READONLY, 0, 0, NULL );
+		if( m_Mapping != NULL )
+			m_View = static_cast<const unsigned char*>( MapViewOfFile( m_Mapping, FILE_MAP_READ, 0, 0, 0 ) );
+
+		if( m_View == NULL )
+		{
+			UnmapFile();
+			return false;
+		}
+
+		length = size.QuadPart;
+		return true;
+	}
+
+	void TextureStreamer::UnmapFile()
+	{
+		if( m_View != NULL )
+			UnmapViewOfFile( m_View );
+		if( m_Mapping != NULL )
+			CloseHandle( m_Mapping );
+		if( m_FileHandle != NULL )
+			CloseHandle( m_FileHandle );
+
+		m_View = NULL;
+		m_Mapping = NULL;
+		m_FileHandle = NULL;
+	}
+
+	void TextureStreamer::CloseSource()
+	{
+		WaitForRead();
+
+		if( m_ReadDone != nullptr )
+			m_ReadDone->Close();
+		if( m_OwnsStream && m_Stream != nullptr )
+			delete m_Stream;
+
+		m_ReadDone = nullptr;
+		m_Stream = nullptr;
+		m_ReadBuffer = nullptr;
+		m_UploadBuffer = nullptr;
+		UnmapFile();
+	}
+
+	void TextureStreamer::ReadLevel( int mipLevel, array<Byte>^% buffer )
+	{
+		int size = static_cast<int>( m_File->GetMipLevelSize( mipLevel ) );
+		if( buffer == nullptr || buffer->Length < size )
+			buffer = gcnew array<Byte>( size );
+
+		int position = 0;
+		for( int slice = 0; slice < m_File->ArraySize; ++slice )
+		{
+			DdsSubresource subresource = m_File->GetSubresource( mipLevel, slice );
+			m_Stream->Position = m_StreamOrigin + subresource.Offset;
+
+			int end = position + subresource.Length;
+			while( position < end )
+			{
+				int read = m_Stream->Read( buffer, position, end - position );
+				if( read == 0 )
+					throw gcnew EndOfStreamException();
+
+				position += read;
+			}
+		}
+	}
+
+	void TextureStreamer::ReadCallback( Object^ )
+	{
+		try
+		{
+			ReadLevel( m_ReadLevel, m_ReadBuffer );
+		}
+		catch( Exception^ e )
+		{
+			m_ReadError = e;
+		}
+		finally
+		{
+			m_ReadDone->Set();
+		}
+	}
+
+	void TextureStreamer::BeginRead( int mipLevel )
+	{
+		m_ReadLevel = mipLevel;
+		m_ReadError = nullptr;
+		m_Reading = true;
+		m_ReadDone->Reset();
+
+		ThreadPool::QueueUserWorkItem( m_ReadCallback );
+	}
+
+	array<Byte>^ TextureStreamer::EndRead( int mipLevel )
+	{
+		bool prefetched = m_Reading && m_ReadLevel == mipLevel;
+		WaitForRead();
+
+		if( !prefetched )
+		{
+			ReadLevel( mipLevel, m_ReadBuffer );
+		}
+		else if( m_ReadError != nullptr )
+		{
+			Exception^ error = m_ReadError;
+			m_ReadError = nullptr;
+			throw gcnew IOException( "Could not read the texture data.", error );
+		}
+
+		// the filled buffer becomes the upload buffer and the next read goes into the other one
+		array<Byte>^ result = m_ReadBuffer;
+		m_ReadBuffer = m_UploadBuffer;
+		m_UploadBuffer = result;
+		return result;
+	}
+
+	void TextureStreamer::WaitForRead()
+	{
+		if( m_Reading )
+		{
+			m_ReadDone->WaitOne();
+			m_Reading = false;
+		}
+	}
+
+	void TextureStreamer::UploadLevel( DeviceContext^ context, int mipLevel )
+	{
+		array<Byte>^ buffer = nullptr;
+		if( m_View == NULL )
+		{
+			buffer = EndRead( mipLevel );
+
+			// overlap reading the next level with uploading this one
+			if( mipLevel > 0 )
+				BeginRead( mipLevel - 1 );
+		}
+
+		// mapped files are addressed by file offset; read buffers hold the level's slices back to back
+		const unsigned char* source = m_View;
+		pin_ptr<Byte> pinnedBuffer = nullptr;
+		if( buffer != nullptr )
+		{
+			pinnedBuffer = &buffer[0];
+			source = pinnedBuffer;
+		}
+
+		Int64 position = 0;
+		for( int slice = 0; slice < m_File->ArraySize; ++slice )
+		{
+			DdsSubresource subresource = m_File->GetSubresource( mipLevel, slice );
+			const unsigned char* data = source + ( m_View != NULL ? subresource.Offset : position );
+			position += subresource.Length;
+
+			UINT index = D3D11CalcSubresource( mipLevel, slice, m_File->MipLevels );
+			context->InternalPointer->UpdateSubresource( m_Texture->InternalPointer, index, NULL, data, subresource.RowPitch, subresource.SlicePitch );
+		}
+
+		m_ResidentMipLevel = mipLevel;
+	}
+
+	bool TextureStreamer::LoadNext( DeviceContext^ context )
+	{
+		return LoadNext( context, m_ResidentMipLevel == m_File->MipLevels ? MipTailSize : 0 );
+	}
+
+	bool TextureStreamer::LoadNext( DeviceContext^ context, Int64 budgetInBytes )
+	{
+		if( context == nullptr )
+			throw gcnew ArgumentNullException( "context" );
+		if( IsComplete )
+			return false;
+		if( m_View == NULL && m_Stream == nullptr )
+			throw gcnew ObjectDisposedException( "TextureStreamer" );
+
+		Int64 uploaded = 0;
+		while( !IsComplete )
+		{
+			Int64 size = m_File->GetMipLevelSize( m_ResidentMipLevel - 1 );
+			if( uploaded > 0 && uploaded + size > budgetInBytes )
+				break;
+
+			UploadLevel( context, m_ResidentMipLevel - 1 );
+			uploaded += size;
+		}
+
+		context->SetMinimumLod( m_Texture, static_cast<float>( m_ResidentMipLevel ) );
+
+		if( IsComplete )
+			CloseSource();
+
+		return !IsComplete;
+	}
+
+	void TextureStreamer::LoadAll( DeviceContext^ context )
+	{
+		LoadNext( context, Int64::MaxValue );
+	}
+}
+}
@@ -0,0 +1,161 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	namespace Direct3D11
+	{
+		ref class DdsFile;
+		ref class Device;
+		ref class DeviceContext;
+		ref class Texture2D;
+
+		/// <summary>
+		/// Loads a DDS texture progressively, starting with its smallest mip levels.
+		/// </summary>
+		/// <remarks>
+		/// The texture is created empty with its full mip chain. Each call to <see cref="LoadNext(DeviceContext^)"/> uploads one
+		/// more mip level with <c>UpdateSubresource</c> and raises the resource's minimum LOD so that sampling never reads a level
+		/// that has not arrived yet. The first call uploads the whole mip tail at once, so a low resolution version of the texture
+		/// is usable after reading only a few kilobytes.
+		///
+		/// Files are memory-mapped where possible. Streams are read on a thread pool thread one level ahead of the upload.
+		/// A stream passed to the streamer must remain open until loading is complete or the streamer is disposed.
+		/// The streamer does not own <see cref="Texture"/>; dispose it separately.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class TextureStreamer sealed
+		{
+		private:
+			DdsFile^ m_File;
+			Texture2D^ m_Texture;
+			int m_ResidentMipLevel;
+
+			HANDLE m_FileHandle;
+			HANDLE m_Mapping;
+			const unsigned char* m_View;
+
+			System::IO::Stream^ m_Stream;
+			bool m_OwnsStream;
+			System::Int64 m_StreamOrigin;
+			System::Threading::ManualResetEvent^ m_ReadDone;
+			System::Threading::WaitCallback^ m_ReadCallback;
+			array<System::Byte>^ m_ReadBuffer;
+			array<System::Byte>^ m_UploadBuffer;
+			System::Exception^ m_ReadError;
+			int m_ReadLevel;
+			bool m_Reading;
+
+			void Initialize( SlimDX::Direct3D11::Device^ device );
+			bool TryMapFile( System::String^ fileName, System::Int64% length );
+			void UnmapFile();
+			void CloseSource();
+
+			void ReadLevel( int mipLevel, array<System::Byte>^% buffer );
+			void ReadCallback( System::Object^ state );
+			void BeginRead( int mipLevel );
+			array<System::Byte>^ EndRead( int mipLevel );
+			void WaitForRead();
+
+			void UploadLevel( DeviceContext^ context, int mipLevel );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="TextureStreamer"/> class from a file on disk.
+			/// </summary>
+			/// <param name="device">The device used to create the texture.</param>
+			/// <param name="fileName">The path of the DDS file.</param>
+			TextureStreamer( SlimDX::Direct3D11::Device^ device, System::String^ fileName );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="TextureStreamer"/> class from a stream.
+			/// </summary>
+			/// <param name="device">The device used to create the texture.</param>
+			/// <param name="stream">A readable, seekable stream positioned at the start of the DDS data.</param>
+			TextureStreamer( SlimDX::Direct3D11::Device^ device, System::IO::Stream^ stream );
+
+			/// <summary>
+			/// Releases the file mapping and waits for any pending read.
+			/// </summary>
+			~TextureStreamer();
+
+			/// <summary>
+			/// Releases the file mapping.
+			/// </summary>
+			!TextureStreamer();
+
+			/// <summary>
+			/// Uploads the next mip level, or the whole mip tail on the first call.
+			/// </summary>
+			/// <param name="context">The context used to upload the data.</param>
+			/// <returns><c>true</c> if more levels remain to be loaded; otherwise, <c>false</c>.</returns>
+			bool LoadNext( DeviceContext^ context );
+
+			/// <summary>
+			/// Uploads mip levels until the given number of bytes has been uploaded. At least one level is always uploaded.
+			/// </summary>
+			/// <param name="context">The context used to upload the data.</param>
+			/// <param name="budgetInBytes">The maximum number of bytes to upload, unless a single level is larger.</param>
+			/// <returns><c>true</c> if more levels remain to be loaded; otherwise, <c>false</c>.</returns>
+			bool LoadNext( DeviceContext^ context, System::Int64 budgetInBytes );
+
+			/// <summary>
+			/// Uploads every remaining mip level.
+			/// </summary>
+			/// <param name="context">The context used to upload the data.</param>
+			void LoadAll( DeviceContext^ context );
+
+			/// <summary>
+			/// Gets the description of the file being loaded.
+			/// </summary>
+			property DdsFile^ File
+			{
+				DdsFile^ get() { return m_File; }
+			}
+
+			/// <summary>
+			/// Gets the texture being filled.
+			/// </summary>
+			property Texture2D^ Texture
+			{
+				Texture2D^ get() { return m_Texture; }
+			}
+
+			/// <summary>
+			/// Gets the most detailed mip level that has been uploaded; equal to the number of mip levels before the first upload.
+			/// </summary>
+			property int ResidentMipLevel
+			{
+				int get() { return m_ResidentMipLevel; }
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether every mip level has been uploaded.
+			/// </summary>
+			property bool IsComplete
+			{
+				bool get() { return m_ResidentMipLevel == 0; }
+			}
+		};
+	}
+}
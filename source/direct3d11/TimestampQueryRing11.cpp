@@ -0,0 +1,137 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Direct3D11Exception.h"
+
+#include "Device11.h"
+#include "DeviceContext11.h"
+#include "Query11.h"
+#include "TimestampQueryRing11.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace SlimDX
+{
+namespace Direct3D11
+{
+	TimestampQueryRing::TimestampQueryRing( DeviceContext^ context, int frameLatency )
+	{
+		if( context == nullptr )
+			throw gcnew ArgumentNullException( "context" );
+		if( frameLatency <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "frameLatency", "The frame latency must be greater than zero." );
+
+		m_Device = context->Device;
+		m_Context = context;
+		m_Disjoint = gcnew array<Query^>( frameLatency );
+		m_Timestamps = gcnew array<List<Query^>^>( frameLatency );
+		m_Frames = gcnew array<Int64>( frameLatency );
+
+		for( int i = 0; i < frameLatency; ++i )
+		{
+			m_Disjoint[i] = gcnew Query( m_Device, QueryDescription( QueryType::TimestampDisjoint, QueryFlags::None ) );
+			m_Timestamps[i] = gcnew List<Query^>();
+			m_Frames[i] = -1;
+		}
+	}
+
+	TimestampQueryRing::~TimestampQueryRing()
+	{
+		for( int i = 0; i < m_Disjoint->Length; ++i )
+		{
+			delete m_Disjoint[i];
+			m_Disjoint[i] = nullptr;
+
+			for each( Query^ query in m_Timestamps[i] )
+				delete query;
+			m_Timestamps[i]->Clear();
+		}
+	}
+
+	int TimestampQueryRing::GetSlot( Int64 frame )
+	{
+		if( frame < 0 )
+			throw gcnew ArgumentOutOfRangeException( "frame" );
+
+		return static_cast<int>( frame % m_Frames->Length );
+	}
+
+	void TimestampQueryRing::BeginFrame( Int64 frame )
+	{
+		int slot = GetSlot( frame );
+
+		m_Frames[slot] = frame;
+		m_Context->Begin( m_Disjoint[slot] );
+	}
+
+	void TimestampQueryRing::WriteTimestamp( Int64 frame, int slot )
+	{
+		List<Query^>^ queries = m_Timestamps[GetSlot( frame )];
+		if( slot < 0 || slot > queries->Count )
+			throw gcnew ArgumentOutOfRangeException( "slot" );
+
+		if( slot == queries->Count )
+			queries->Add( gcnew Query( m_Device, QueryDescription( QueryType::Timestamp, QueryFlags::None ) ) );
+
+		m_Context->End( queries[slot] );
+	}
+
+	void TimestampQueryRing::EndFrame( Int64 frame )
+	{
+		m_Context->End( m_Disjoint[GetSlot( frame )] );
+	}
+
+	bool TimestampQueryRing::TryGetTimestamps( Int64 frame, array<Int64>^ timestamps, int count, Int64% frequency, bool% isDisjoint )
+	{
+		if( timestamps == nullptr )
+			throw gcnew ArgumentNullException( "timestamps" );
+		if( count < 0 || count > timestamps->Length )
+			throw gcnew ArgumentOutOfRangeException( "count" );
+
+		int slot = GetSlot( frame );
+		List<Query^>^ queries = m_Timestamps[slot];
+		if( m_Frames[slot] != frame || count > queries->Count )
+			return false;
+
+		// GetData is called directly with S_FALSE meaning "not ready", which the Result based wrappers cannot express without a DataStream.
+		ID3D11DeviceContext* context = m_Context->InternalPointer;
+		D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+		if( context->GetData( m_Disjoint[slot]->InternalPointer, &disjoint, sizeof( disjoint ), D3D11_ASYNC_GETDATA_DONOTFLUSH ) != S_OK )
+			return false;
+
+		for( int i = 0; i < count; ++i )
+		{
+			UINT64 timestamp;
+			if( context->GetData( queries[i]->InternalPointer, &timestamp, sizeof( timestamp ), D3D11_ASYNC_GETDATA_DONOTFLUSH ) != S_OK )
+				return false;
+
+			timestamps[i] = static_cast<Int64>( timestamp );
+		}
+
+		frequency = static_cast<Int64>( disjoint.Frequency );
+		isDisjoint = disjoint.Disjoint != FALSE;
+		return true;
+	}
+}
+}
@@ -42,7 +42,7 @@ namespace Direct3D9
 		D3DADAPTER_IDENTIFIER9 ident = {0};
 		DWORD flags = checkWhql ? D3DENUM_WHQL_LEVEL : 0;
 
-		HRESULT hr = direct3D->GetAdapterIdentifier( adapter, flags, &ident );
+		HRESULT hr = TIME_CALL( direct3D->GetAdapterIdentifier( adapter, flags, &ident ) );
 		RECORD_D3D9( hr );
 		
 		this->adapter = adapter;
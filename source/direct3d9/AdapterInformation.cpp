@@ -52,7 +52,7 @@ namespace Direct3D9
 	DisplayMode AdapterInformation::CurrentDisplayMode::get()
 	{
 		DisplayMode displayMode;
-        HRESULT hr = m_direct3D->GetAdapterDisplayMode( m_Adapter, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) );
+        HRESULT hr = TIME_CALL( m_direct3D->GetAdapterDisplayMode( m_Adapter, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) ) );
 		RECORD_D3D9( hr );
         return displayMode;
 	}
@@ -60,7 +60,7 @@ namespace Direct3D9
     Capabilities^ AdapterInformation::GetCaps( DeviceType type )
     {
 		D3DCAPS9 caps;
-		HRESULT hr = m_direct3D->GetDeviceCaps( m_Adapter, static_cast<D3DDEVTYPE>( type ), &caps );
+		HRESULT hr = TIME_CALL( m_direct3D->GetDeviceCaps( m_Adapter, static_cast<D3DDEVTYPE>( type ), &caps ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -54,7 +54,7 @@ namespace Direct3D9
 	{
 		D3DDISPLAYMODEEX d3ddm = {0};
 		d3ddm.Size = sizeof(D3DDISPLAYMODEEX);
-        HRESULT hr = m_direct3D->GetAdapterDisplayModeEx( m_Adapter, &d3ddm, NULL );
+        HRESULT hr = TIME_CALL( m_direct3D->GetAdapterDisplayModeEx( m_Adapter, &d3ddm, NULL ) );
 		RECORD_D3D9( hr );
 
 		return DisplayModeEx::FromUnmanaged(d3ddm);
@@ -63,7 +63,7 @@ namespace Direct3D9
     Capabilities^ AdapterInformationEx::GetCaps( DeviceType type )
     {
 		D3DCAPS9 caps;
-		HRESULT hr = m_direct3D->GetDeviceCaps( m_Adapter, static_cast<D3DDEVTYPE>( type ), &caps );
+		HRESULT hr = TIME_CALL( m_direct3D->GetDeviceCaps( m_Adapter, static_cast<D3DDEVTYPE>( type ), &caps ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -48,7 +48,7 @@ namespace Direct3D9
 	{
 		ID3DXAnimationController *pointer;
 
-		HRESULT hr = D3DXCreateAnimationController( maxAnimationOutputs, maxAnimationSets, maxTracks, maxEvents, &pointer );		
+		HRESULT hr = TIME_CALL( D3DXCreateAnimationController( maxAnimationOutputs, maxAnimationSets, maxTracks, maxEvents, &pointer ) );		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -73,7 +73,7 @@ namespace Direct3D9
 		if(handler != nullptr)
 			callback = reinterpret_cast< LPD3DXANIMATIONCALLBACKHANDLER >( Marshal::GetFunctionPointerForDelegate( handler ).ToPointer() );
 
-		HRESULT hr = InternalPointer->AdvanceTime( time, callback );
+		HRESULT hr = TIME_CALL( InternalPointer->AdvanceTime( time, callback ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -81,7 +81,7 @@ namespace Direct3D9
 	{
 		LPD3DXANIMATIONCONTROLLER pointer;
 
-		HRESULT hr = InternalPointer->CloneAnimationController( maxAnimationOutputs, maxAnimationSets, maxTracks, maxEvents, &pointer );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneAnimationController( maxAnimationOutputs, maxAnimationSets, maxTracks, maxEvents, &pointer ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -108,7 +108,7 @@ namespace Direct3D9
 	{
 		LPD3DXANIMATIONSET set;
 
-		HRESULT hr = InternalPointer->GetAnimationSet( index, &set );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAnimationSet( index, &set ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return T();
@@ -123,7 +123,7 @@ namespace Direct3D9
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->GetAnimationSetByName( reinterpret_cast<LPCSTR>( pinnedName ), &set );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAnimationSetByName( reinterpret_cast<LPCSTR>( pinnedName ), &set ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return T();
@@ -140,7 +140,7 @@ namespace Direct3D9
 	{
 		EventDescription result;
 
-		HRESULT hr = InternalPointer->GetEventDesc( handle, reinterpret_cast<LPD3DXEVENT_DESC>( &result ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEventDesc( handle, reinterpret_cast<LPD3DXEVENT_DESC>( &result ) ) );
 		RECORD_D3D9( hr );
 
 		return result;
@@ -150,7 +150,7 @@ namespace Direct3D9
 	{
 		LPD3DXANIMATIONSET set;
 
-		HRESULT hr = InternalPointer->GetTrackAnimationSet( track, &set );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTrackAnimationSet( track, &set ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -162,7 +162,7 @@ namespace Direct3D9
 	{
 		TrackDescription result;
 
-		HRESULT hr = InternalPointer->GetTrackDesc( track, reinterpret_cast<LPD3DXTRACK_DESC>( &result ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTrackDesc( track, reinterpret_cast<LPD3DXTRACK_DESC>( &result ) ) );
 		RECORD_D3D9( hr );
 
 		return result;
@@ -205,7 +205,7 @@ namespace Direct3D9
 
 	Result AnimationController::RegisterAnimationOutput( Frame^ frame )
 	{
-		HRESULT hr = InternalPointer->RegisterAnimationOutput( frame->Pointer->Name, &frame->Pointer->TransformationMatrix, NULL, NULL, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterAnimationOutput( frame->Pointer->Name, &frame->Pointer->TransformationMatrix, NULL, NULL, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -237,97 +237,97 @@ namespace Direct3D9
 		if( (output->Flags & AnimationOutputFlags::Rotation) == AnimationOutputFlags::Rotation )
 			rotation = reinterpret_cast<D3DXQUATERNION*>(ptr);
 
-		HRESULT hr = InternalPointer->RegisterAnimationOutput( reinterpret_cast<LPCSTR>( pinnedName ), matrix, scale, rotation, translation );
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterAnimationOutput( reinterpret_cast<LPCSTR>( pinnedName ), matrix, scale, rotation, translation ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::RegisterAnimationSet( AnimationSet^ set )
 	{
-		HRESULT hr = InternalPointer->RegisterAnimationSet( set->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterAnimationSet( set->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::ResetTime()
 	{
-		HRESULT hr = InternalPointer->ResetTime();
+		HRESULT hr = TIME_CALL( InternalPointer->ResetTime() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::SetTrackAnimationSet( int track, AnimationSet^ set )
 	{
-		HRESULT hr = InternalPointer->SetTrackAnimationSet( track, set->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackAnimationSet( track, set->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::SetTrackDescription( int track, TrackDescription description )
 	{
-		HRESULT hr = InternalPointer->SetTrackDesc( track, reinterpret_cast<LPD3DXTRACK_DESC>( &description ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackDesc( track, reinterpret_cast<LPD3DXTRACK_DESC>( &description ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::EnableTrack( int track )
 	{
-		HRESULT hr = InternalPointer->SetTrackEnable( track, true );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackEnable( track, true ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::DisableTrack( int track )
 	{
-		HRESULT hr = InternalPointer->SetTrackEnable( track, false );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackEnable( track, false ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::SetTrackPosition( int track, double position )
 	{
-		HRESULT hr = InternalPointer->SetTrackPosition( track, position );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackPosition( track, position ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::SetTrackPriority( int track, TrackPriority priority )
 	{
-		HRESULT hr = InternalPointer->SetTrackPriority( track, static_cast<D3DXPRIORITY_TYPE>( priority ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackPriority( track, static_cast<D3DXPRIORITY_TYPE>( priority ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::SetTrackSpeed( int track, float speed )
 	{
-		HRESULT hr = InternalPointer->SetTrackSpeed( track, speed );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackSpeed( track, speed ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::SetTrackWeight( int track, float weight )
 	{
-		HRESULT hr = InternalPointer->SetTrackWeight( track, weight );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTrackWeight( track, weight ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::UnkeyAllPriorityBlends()
 	{
-		HRESULT hr = InternalPointer->UnkeyAllPriorityBlends();
+		HRESULT hr = TIME_CALL( InternalPointer->UnkeyAllPriorityBlends() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::UnkeyAllTrackEvents( int track )
 	{
-		HRESULT hr = InternalPointer->UnkeyAllTrackEvents( track );
+		HRESULT hr = TIME_CALL( InternalPointer->UnkeyAllTrackEvents( track ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::UnkeyEvent( int handle )
 	{
-		HRESULT hr = InternalPointer->UnkeyEvent( handle );
+		HRESULT hr = TIME_CALL( InternalPointer->UnkeyEvent( handle ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result AnimationController::UnregisterAnimationSet( AnimationSet^ set )
 	{
-		HRESULT hr = InternalPointer->UnregisterAnimationSet( set->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->UnregisterAnimationSet( set->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	bool AnimationController::ValidateEvent( int handle )
 	{
-		HRESULT hr = InternalPointer->ValidateEvent( handle );
+		HRESULT hr = TIME_CALL( InternalPointer->ValidateEvent( handle ) );
 
 		return (hr == S_OK);
 	}
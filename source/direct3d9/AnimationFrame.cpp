@@ -140,7 +140,7 @@ namespace Direct3D9
 		Vector3 objectCenter;
 		float radius;
 
-		HRESULT hr = D3DXFrameCalculateBoundingSphere( root->Pointer, reinterpret_cast<D3DXVECTOR3*>( &objectCenter ), &radius );
+		HRESULT hr = TIME_CALL( D3DXFrameCalculateBoundingSphere( root->Pointer, reinterpret_cast<D3DXVECTOR3*>( &objectCenter ), &radius ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return BoundingSphere( Vector3( 0, 0, 0 ), 0.0f );
@@ -151,7 +151,7 @@ namespace Direct3D9
 	Result Frame::DestroyHierarchy( Frame^ root, IAllocateHierarchy^ allocator )
 	{
 		IAllocateHierarchyShim shim( allocator );					
-		HRESULT hr = D3DXFrameDestroy( root->Pointer, &shim );
+		HRESULT hr = TIME_CALL( D3DXFrameDestroy( root->Pointer, &shim ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -252,8 +252,8 @@ namespace Direct3D9
 		if( userDataLoader != nullptr )
 			userDataLoaderShimPtr = &userDataLoaderShim;
 
-		HRESULT hr = D3DXLoadMeshHierarchyFromXInMemory( memory, size, static_cast<DWORD>( options ), device->InternalPointer,
-			&allocatorShim, userDataLoaderShimPtr, &result, &animationResult);
+		HRESULT hr = TIME_CALL( D3DXLoadMeshHierarchyFromXInMemory( memory, size, static_cast<DWORD>( options ), device->InternalPointer,
+			&allocatorShim, userDataLoaderShimPtr, &result, &animationResult) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -284,8 +284,8 @@ namespace Direct3D9
 		if( userDataLoader != nullptr )
 			userDataLoaderShimPtr = &userDataLoaderShim;
 
-		HRESULT hr = D3DXLoadMeshHierarchyFromX( reinterpret_cast<LPCWSTR>( pinnedName ), static_cast<DWORD>( options ), device->InternalPointer,
-			&allocatorShim, userDataLoaderShimPtr, &result, &animationResult);
+		HRESULT hr = TIME_CALL( D3DXLoadMeshHierarchyFromX( reinterpret_cast<LPCWSTR>( pinnedName ), static_cast<DWORD>( options ), device->InternalPointer,
+			&allocatorShim, userDataLoaderShimPtr, &result, &animationResult) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -334,8 +334,8 @@ namespace Direct3D9
 		if(animationController != nullptr)
 			animation = animationController->InternalPointer;
 
-		HRESULT hr = D3DXSaveMeshHierarchyToFile( reinterpret_cast<LPCWSTR>( pinnedName ), static_cast<DWORD>( format ),
-			root->Pointer, animation, &shim );
+		HRESULT hr = TIME_CALL( D3DXSaveMeshHierarchyToFile( reinterpret_cast<LPCWSTR>( pinnedName ), static_cast<DWORD>( format ),
+			root->Pointer, animation, &shim ) );
 		
 		return RECORD_D3D9( hr );
 	}
@@ -348,8 +348,8 @@ namespace Direct3D9
 		if(animationController != nullptr)
 			animation = animationController->InternalPointer;
 
-		HRESULT hr = D3DXSaveMeshHierarchyToFile( reinterpret_cast<LPCWSTR>( pinnedName ), static_cast<DWORD>( format ),
-			root->Pointer, animation, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveMeshHierarchyToFile( reinterpret_cast<LPCWSTR>( pinnedName ), static_cast<DWORD>( format ),
+			root->Pointer, animation, NULL ) );
 		
 		return RECORD_D3D9( hr );
 	}
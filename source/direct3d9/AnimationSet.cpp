@@ -51,7 +51,7 @@ namespace Direct3D9
 		pin_ptr<const unsigned char> pinnedName = &nameBytes[0];
 		unsigned int result;
 
-		HRESULT hr = InternalPointer->GetAnimationIndexByName( reinterpret_cast<LPCSTR>( pinnedName ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAnimationIndexByName( reinterpret_cast<LPCSTR>( pinnedName ), &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return 0;
@@ -62,7 +62,7 @@ namespace Direct3D9
 	String^ AnimationSet::GetAnimationName( int index )
 	{
 		LPCSTR result;
-		HRESULT hr = InternalPointer->GetAnimationNameByIndex( index, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAnimationNameByIndex( index, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -75,7 +75,7 @@ namespace Direct3D9
 		pin_ptr<double> pinPosition = &callbackPosition;
 		LPVOID data;
 
-		HRESULT hr = InternalPointer->GetCallback( position, static_cast<DWORD>( flags ), pinPosition, &data );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCallback( position, static_cast<DWORD>( flags ), pinPosition, &data ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return IntPtr::Zero;
@@ -89,8 +89,8 @@ namespace Direct3D9
 		Vector3 translation;
 		Quaternion rotation;
 
-		HRESULT hr = InternalPointer->GetSRT( periodicPosition, animation, reinterpret_cast<D3DXVECTOR3*>( &scale ), 
-			reinterpret_cast<D3DXQUATERNION*>( &rotation ), reinterpret_cast<D3DXVECTOR3*>( &translation ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSRT( periodicPosition, animation, reinterpret_cast<D3DXVECTOR3*>( &scale ), 
+			reinterpret_cast<D3DXQUATERNION*>( &rotation ), reinterpret_cast<D3DXVECTOR3*>( &translation ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -127,7 +127,7 @@ namespace Direct3D9
 	{
 		D3DXPARAMETER_DESC description;
 
-		HRESULT hr = InternalPointer->GetParameterDesc( parameter->InternalHandle, &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetParameterDesc( parameter->InternalHandle, &description ) );
 		GC::KeepAlive( parameter );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return ParameterDescription();
@@ -173,7 +173,7 @@ namespace Direct3D9
 	{
 		D3DXFUNCTION_DESC description;
 
-		HRESULT hr = InternalPointer->GetFunctionDesc( handle->InternalHandle, &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFunctionDesc( handle->InternalHandle, &description ) );
 		GC::KeepAlive(handle);
 		if( RECORD_D3D9( hr ).IsFailure )
 			return FunctionDescription();
@@ -210,7 +210,7 @@ namespace Direct3D9
 	{
 		D3DXTECHNIQUE_DESC description;
 
-		HRESULT hr = InternalPointer->GetTechniqueDesc( handle->InternalHandle, &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTechniqueDesc( handle->InternalHandle, &description ) );
 		GC::KeepAlive(handle);
 		if( RECORD_D3D9( hr ).IsFailure )
 			return TechniqueDescription();
@@ -253,7 +253,7 @@ namespace Direct3D9
 		D3DXPASS_DESC description;
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
 
-		HRESULT hr = InternalPointer->GetPassDesc( nativeHandle, &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPassDesc( nativeHandle, &description ) );
 		GC::KeepAlive(handle);
 		if( RECORD_D3D9( hr ).IsFailure )
 			return PassDescription();
@@ -272,7 +272,7 @@ namespace Direct3D9
 		IDirect3DPixelShader9 *pixelShader;
 
 		D3DXHANDLE nativeHandle = parameter != nullptr ? parameter->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->GetPixelShader( nativeHandle, &pixelShader );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPixelShader( nativeHandle, &pixelShader ) );
 		GC::KeepAlive(parameter);
 
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -286,7 +286,7 @@ namespace Direct3D9
 		IDirect3DVertexShader9 *vertexShader;
 
 		D3DXHANDLE nativeHandle = parameter != nullptr ? parameter->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->GetVertexShader( nativeHandle, &vertexShader );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexShader( nativeHandle, &vertexShader ) );
 		GC::KeepAlive( parameter );
 
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -299,7 +299,7 @@ namespace Direct3D9
 	{
 		D3DXEFFECT_DESC description;
 
-		HRESULT hr = InternalPointer->GetDesc( &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( &description ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return EffectDescription();
 
@@ -319,7 +319,7 @@ namespace Direct3D9
 			texture = value->InternalPointer;
 
 		D3DXHANDLE handle = parameter != nullptr ? parameter->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetTexture( handle, texture );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTexture( handle, texture ) );
 		GC::KeepAlive( parameter );
 		return RECORD_D3D9( hr );
 	}
@@ -330,7 +330,7 @@ namespace Direct3D9
 		pin_ptr<unsigned char> pinnedValue = &valueBytes[0];
 
 		D3DXHANDLE handle = parameter != nullptr ? parameter->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetString( handle, reinterpret_cast<LPCSTR>( pinnedValue ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetString( handle, reinterpret_cast<LPCSTR>( pinnedValue ) ) );
 		GC::KeepAlive( parameter );
 		return RECORD_D3D9( hr );
 	}
@@ -339,7 +339,7 @@ namespace Direct3D9
 	{
 		IDirect3DBaseTexture9* texture = NULL;
 		D3DXHANDLE handle = parameter != nullptr ? parameter->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->GetTexture( handle, &texture );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTexture( handle, &texture ) );
 		GC::KeepAlive( parameter );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -353,7 +353,7 @@ namespace Direct3D9
 		D3DXHANDLE handle = parameter != nullptr ? parameter->InternalHandle : NULL;
 		LPCSTR data = 0;
 
-		HRESULT hr = InternalPointer->GetString( handle, &data );
+		HRESULT hr = TIME_CALL( InternalPointer->GetString( handle, &data ) );
 		GC::KeepAlive( parameter );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -371,27 +371,27 @@ namespace Direct3D9
 		if( T::typeid == bool::typeid )
 		{
 			BOOL newValue = Convert::ToInt32( value, CultureInfo::InvariantCulture );
-			hr = InternalPointer->SetBool( handle, newValue );
+			hr = TIME_CALL( InternalPointer->SetBool( handle, newValue ) );
 		}
 		else if( T::typeid == float::typeid )
 		{
-			hr = InternalPointer->SetFloat( handle, static_cast<FLOAT>( value ) );
+			hr = TIME_CALL( InternalPointer->SetFloat( handle, static_cast<FLOAT>( value ) ) );
 		}
 		else if( T::typeid == int::typeid )
 		{
-			hr = InternalPointer->SetInt( handle, static_cast<INT>( value ) );
+			hr = TIME_CALL( InternalPointer->SetInt( handle, static_cast<INT>( value ) ) );
 		}
 		else if( T::typeid == Matrix::typeid )
 		{
-			hr = InternalPointer->SetMatrix( handle, reinterpret_cast<D3DXMATRIX*>( &value ) );
+			hr = TIME_CALL( InternalPointer->SetMatrix( handle, reinterpret_cast<D3DXMATRIX*>( &value ) ) );
 		}
 		else if( T::typeid == Vector4::typeid )
 		{
-			hr = InternalPointer->SetVector( handle, reinterpret_cast<D3DXVECTOR4*>( &value ) );
+			hr = TIME_CALL( InternalPointer->SetVector( handle, reinterpret_cast<D3DXVECTOR4*>( &value ) ) );
 		}
 		else
 		{
-			hr = InternalPointer->SetValue( handle, &value, static_cast<DWORD>( sizeof(T) ) );
+			hr = TIME_CALL( InternalPointer->SetValue( handle, &value, static_cast<DWORD>( sizeof(T) ) ) );
 		}
 
 		GC::KeepAlive( parameter );
@@ -409,12 +409,12 @@ namespace Direct3D9
 		{
 			//bool is not the same as BOOL, so convert over appropriately
 			BOOL boolValue = 0;
-			hr = InternalPointer->GetValue( handle, &boolValue, sizeof(BOOL) );
+			hr = TIME_CALL( InternalPointer->GetValue( handle, &boolValue, sizeof(BOOL) ) );
 			result = (T)(boolValue == TRUE);
 		}
 		else
 		{
-			hr = InternalPointer->GetValue( handle, &result, static_cast<DWORD>( sizeof(T) ) );
+			hr = TIME_CALL( InternalPointer->GetValue( handle, &result, static_cast<DWORD>( sizeof(T) ) ) );
 		}
 		GC::KeepAlive( parameter );
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -434,32 +434,32 @@ namespace Direct3D9
 			array<BOOL>^ newValues = Array::ConvertAll<bool, int>( safe_cast<array<bool>>( values ), gcnew Converter<bool, int>( Convert::ToInt32 ) );
 			pin_ptr<BOOL> pinnedValues = &newValues[0];
 
-			hr = InternalPointer->SetBoolArray( handle, pinnedValues, values->Length );
+			hr = TIME_CALL( InternalPointer->SetBoolArray( handle, pinnedValues, values->Length ) );
 		}
 		else if( T::typeid == float::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetFloatArray( handle, reinterpret_cast<FLOAT*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetFloatArray( handle, reinterpret_cast<FLOAT*>( pinnedData ), values->Length ) );
 		}
 		else if( T::typeid == int::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetIntArray( handle, reinterpret_cast<INT*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetIntArray( handle, reinterpret_cast<INT*>( pinnedData ), values->Length ) );
 		}
 		else if( T::typeid == Matrix::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetMatrixArray( handle, reinterpret_cast<D3DXMATRIX*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetMatrixArray( handle, reinterpret_cast<D3DXMATRIX*>( pinnedData ), values->Length ) );
 		}
 		else if( T::typeid == Vector4::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetVectorArray( handle, reinterpret_cast<D3DXVECTOR4*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetVectorArray( handle, reinterpret_cast<D3DXVECTOR4*>( pinnedData ), values->Length ) );
 		}
 		else
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetValue( handle, pinnedData, static_cast<DWORD>( sizeof(T) ) * values->Length );
+			hr = TIME_CALL( InternalPointer->SetValue( handle, pinnedData, static_cast<DWORD>( sizeof(T) ) * values->Length ) );
 		}
 
 		GC::KeepAlive( parameter );
@@ -473,7 +473,7 @@ namespace Direct3D9
 		array<T>^ results = gcnew array<T>( count );
 		pin_ptr<T> pinnedData = &results[0];
 
-		HRESULT hr = InternalPointer->GetValue( handle, pinnedData, static_cast<DWORD>( sizeof(T) ) * count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetValue( handle, pinnedData, static_cast<DWORD>( sizeof(T) ) * count ) );
 		GC::KeepAlive( parameter );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
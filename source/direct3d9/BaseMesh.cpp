@@ -27,6 +27,7 @@
 #include "../ComObject.h"
 #include "../Utilities.h"
 #include "../DataStream.h"
+#include "../MeshOptimizer.h"
 
 #include "Direct3D9Exception.h"
 
@@ -52,8 +53,8 @@ namespace Direct3D9
 		ID3DXMesh* mesh;
 		pin_ptr<VertexElement> pinned_elements = &elements[0];
 
-		HRESULT hr = InternalPointer->CloneMesh( static_cast<DWORD>( flags ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinned_elements ),
-			device->InternalPointer, &mesh );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMesh( static_cast<DWORD>( flags ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinned_elements ),
+			device->InternalPointer, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -65,8 +66,8 @@ namespace Direct3D9
 	{
 		ID3DXMesh* mesh;
 
-		HRESULT hr = InternalPointer->CloneMeshFVF( static_cast<DWORD>( flags ), static_cast<DWORD>( fvf ), 
-			device->InternalPointer, &mesh );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMeshFVF( static_cast<DWORD>( flags ), static_cast<DWORD>( fvf ), 
+			device->InternalPointer, &mesh ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -76,14 +77,14 @@ namespace Direct3D9
 
 	Result BaseMesh::DrawSubset( int subset )
 	{
-		HRESULT hr = InternalPointer->DrawSubset( subset );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawSubset( subset ) );
 		return RECORD_D3D9( hr );
 	}
 
 	SlimDX::Direct3D9::Device^ BaseMesh::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -94,7 +95,7 @@ namespace Direct3D9
 	IndexBuffer^ BaseMesh::IndexBuffer::get()
 	{
 		IDirect3DIndexBuffer9* ib;
-		HRESULT hr = InternalPointer->GetIndexBuffer( &ib );
+		HRESULT hr = TIME_CALL( InternalPointer->GetIndexBuffer( &ib ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -105,7 +106,7 @@ namespace Direct3D9
 	VertexBuffer^ BaseMesh::VertexBuffer::get()
 	{
 		IDirect3DVertexBuffer9* vb;
-		HRESULT hr = InternalPointer->GetVertexBuffer( &vb );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexBuffer( &vb ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -116,7 +117,7 @@ namespace Direct3D9
 	array<VertexElement>^ BaseMesh::GetDeclaration()
 	{
 		D3DVERTEXELEMENT9 elementBuffer[MAX_FVF_DECL_SIZE];
-		HRESULT hr = InternalPointer->GetDeclaration( elementBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeclaration( elementBuffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -135,14 +136,14 @@ namespace Direct3D9
 	array<AttributeRange>^ BaseMesh::GetAttributeTable()
 	{
 		DWORD count = 0;
-		HRESULT hr = InternalPointer->GetAttributeTable( NULL, &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAttributeTable( NULL, &count ) );
 
 		if( RECORD_D3D9( hr ).IsFailure || count == 0 )
 			return nullptr;
 
 		array<AttributeRange>^ attribTable = gcnew array<AttributeRange>( count );
 		pin_ptr<AttributeRange> pinnedTable = &attribTable[0];
-		hr = InternalPointer->GetAttributeTable( reinterpret_cast<D3DXATTRIBUTERANGE*>( pinnedTable ), &count );
+		hr = TIME_CALL( InternalPointer->GetAttributeTable( reinterpret_cast<D3DXATTRIBUTERANGE*>( pinnedTable ), &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -153,7 +154,7 @@ namespace Direct3D9
 	DataStream^ BaseMesh::LockIndexBuffer( LockFlags flags )
 	{
 		void* data;
-		HRESULT hr = InternalPointer->LockIndexBuffer( static_cast<DWORD>( flags ), &data );
+		HRESULT hr = TIME_CALL( InternalPointer->LockIndexBuffer( static_cast<DWORD>( flags ), &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -169,14 +170,14 @@ namespace Direct3D9
 
 	Result BaseMesh::UnlockIndexBuffer()
 	{
-		HRESULT hr = InternalPointer->UnlockIndexBuffer();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockIndexBuffer() );
 		return RECORD_D3D9( hr );
 	}
 
 	DataStream^ BaseMesh::LockVertexBuffer( LockFlags flags )
 	{
 		void* data;
-		HRESULT hr = InternalPointer->LockVertexBuffer( static_cast<DWORD>( flags ), &data );
+		HRESULT hr = TIME_CALL( InternalPointer->LockVertexBuffer( static_cast<DWORD>( flags ), &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -190,7 +191,7 @@ namespace Direct3D9
 
 	Result BaseMesh::UnlockVertexBuffer()
 	{
-		HRESULT hr = InternalPointer->UnlockVertexBuffer();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockVertexBuffer() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -200,7 +201,7 @@ namespace Direct3D9
 		array<int>^ adjacency = gcnew array<int>( 3 * FaceCount );
 		pin_ptr<int> pinnedAdj = &adjacency[0];
 
-		HRESULT hr = InternalPointer->GenerateAdjacency( epsilon, reinterpret_cast<DWORD*>( pinnedAdj ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GenerateAdjacency( epsilon, reinterpret_cast<DWORD*>( pinnedAdj ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -214,8 +215,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedAdj = &adjacency[0];
 		pin_ptr<int> pinnedPoints = &points[0];
 
-		HRESULT hr = InternalPointer->ConvertAdjacencyToPointReps( reinterpret_cast<const DWORD*>( pinnedAdj ),
-			reinterpret_cast<DWORD*>( pinnedPoints ) );
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertAdjacencyToPointReps( reinterpret_cast<const DWORD*>( pinnedAdj ),
+			reinterpret_cast<DWORD*>( pinnedPoints ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -229,8 +230,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedAdj = &adjacency[0];
 		pin_ptr<int> pinnedPoints = &points[0];
 
-		HRESULT hr = InternalPointer->ConvertPointRepsToAdjacency( reinterpret_cast<const DWORD*>( pinnedPoints ),
-			reinterpret_cast<DWORD*>( pinnedAdj ) );
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertPointRepsToAdjacency( reinterpret_cast<const DWORD*>( pinnedPoints ),
+			reinterpret_cast<DWORD*>( pinnedAdj ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -242,7 +243,7 @@ namespace Direct3D9
 	{
 		pin_ptr<VertexElement> pinnedElements = &elements[0];
 
-		HRESULT hr = InternalPointer->UpdateSemantics( reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedElements ) );
+		HRESULT hr = TIME_CALL( InternalPointer->UpdateSemantics( reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedElements ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -251,8 +252,8 @@ namespace Direct3D9
 		IDirect3DIndexBuffer9 *result;
 		DWORD count;
 
-		HRESULT hr = D3DXConvertMeshSubsetToSingleStrip( InternalPointer, attributeId, static_cast<DWORD>( options ),
-			&result, &count );
+		HRESULT hr = TIME_CALL( D3DXConvertMeshSubsetToSingleStrip( InternalPointer, attributeId, static_cast<DWORD>( options ),
+			&result, &count ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -272,8 +273,8 @@ namespace Direct3D9
 		DWORD numIndices;
 		DWORD numStrips;
 
-		HRESULT hr = D3DXConvertMeshSubsetToStrips( InternalPointer, attributeId, static_cast<DWORD>( options ),
-			&result, &numIndices, &buffer, &numStrips );
+		HRESULT hr = TIME_CALL( D3DXConvertMeshSubsetToStrips( InternalPointer, attributeId, static_cast<DWORD>( options ),
+			&result, &numIndices, &buffer, &numStrips ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -295,8 +296,8 @@ namespace Direct3D9
 		DWORD count;
 		DWORD face;
 
-		HRESULT hr = D3DXIntersect( InternalPointer, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
-			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, &face, NULL, NULL, &dist, &allHits, &count );
+		HRESULT hr = TIME_CALL( D3DXIntersect( InternalPointer, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
+			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, &face, NULL, NULL, &dist, &allHits, &count ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -325,8 +326,8 @@ namespace Direct3D9
 		BOOL result;
 		FLOAT dist;
 
-		HRESULT hr = D3DXIntersect( InternalPointer, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
-			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, &dist, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXIntersect( InternalPointer, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
+			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, &dist, NULL, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -345,8 +346,8 @@ namespace Direct3D9
 	{
 		BOOL result;
 
-		HRESULT hr = D3DXIntersect( InternalPointer, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
-			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, NULL, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXIntersect( InternalPointer, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
+			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, NULL, NULL, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure || !result )
 			return false;
@@ -362,8 +363,8 @@ namespace Direct3D9
 		DWORD count;
 		DWORD face;
 
-		HRESULT hr = D3DXIntersectSubset( InternalPointer, attributeId, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
-			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, &face, NULL, NULL, &dist, &allHits, &count );
+		HRESULT hr = TIME_CALL( D3DXIntersectSubset( InternalPointer, attributeId, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
+			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, &face, NULL, NULL, &dist, &allHits, &count ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -388,8 +389,8 @@ namespace Direct3D9
 		BOOL result;
 		FLOAT dist;
 
-		HRESULT hr = D3DXIntersectSubset( InternalPointer, attributeId, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
-			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, &dist, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXIntersectSubset( InternalPointer, attributeId, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
+			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, &dist, NULL, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -408,8 +409,8 @@ namespace Direct3D9
 	{
 		BOOL result;
 
-		HRESULT hr = D3DXIntersectSubset( InternalPointer, attributeId, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
-			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, NULL, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXIntersectSubset( InternalPointer, attributeId, reinterpret_cast<const D3DXVECTOR3*>( &ray.Position ),
+			reinterpret_cast<const D3DXVECTOR3*>( &ray.Direction ), &result, NULL, NULL, NULL, NULL, NULL, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure || !result )
 			return false;
@@ -417,6 +418,23 @@ namespace Direct3D9
 		return true;
 	}
 
+	VertexCacheStatistics BaseMesh::AnalyzeVertexCache( int cacheSize )
+	{
+		DataStream^ indices = LockIndexBuffer( LockFlags::ReadOnly );
+		if( indices == nullptr )
+			return VertexCacheStatistics();
+
+		try
+		{
+			bool use32BitIndices = ( CreationOptions & MeshFlags::Use32Bit ) == MeshFlags::Use32Bit;
+			return MeshOptimizer::AnalyzeVertexCache( indices, FaceCount * 3, use32BitIndices, VertexCount, cacheSize );
+		}
+		finally
+		{
+			UnlockIndexBuffer();
+		}
+	}
+
 	int BaseMesh::FaceCount::get()
 	{
 		return InternalPointer->GetNumFaces();
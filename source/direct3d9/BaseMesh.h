@@ -21,6 +21,8 @@
 */
 #pragma once
 
+#include "../VertexCacheStatistics.h"
+
 #include "AttributeRange.h"
 #include "IntersectInformation.h"
 
@@ -75,6 +77,8 @@ namespace SlimDX
 			bool IntersectsSubset( Ray ray, int attributeId, [Out] float% distance );
 			bool IntersectsSubset( Ray ray, int attributeId );
 
+			VertexCacheStatistics AnalyzeVertexCache( int cacheSize );
+
 			property int FaceCount { int get(); }
 			property int VertexCount { int get(); }
 			property VertexFormat VertexFormat { SlimDX::Direct3D9::VertexFormat get(); }
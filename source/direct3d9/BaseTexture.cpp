@@ -67,8 +67,8 @@ namespace Direct3D9
 		ID3DXBuffer *buffer = NULL;
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 		
-		HRESULT hr = D3DXSaveTextureToFileInMemory( &buffer, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			texture->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ) );
+		HRESULT hr = TIME_CALL( D3DXSaveTextureToFileInMemory( &buffer, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			texture->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ) ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -80,8 +80,8 @@ namespace Direct3D9
 	{
 		ID3DXBuffer *buffer = NULL;
 		
-		HRESULT hr = D3DXSaveTextureToFileInMemory( &buffer, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			texture->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveTextureToFileInMemory( &buffer, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			texture->InternalPointer, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -94,8 +94,8 @@ namespace Direct3D9
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars(fileName);
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 		
-		HRESULT hr = D3DXSaveTextureToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			texture->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ) );
+		HRESULT hr = TIME_CALL( D3DXSaveTextureToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			texture->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -103,8 +103,8 @@ namespace Direct3D9
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars(fileName);
 		
-		HRESULT hr = D3DXSaveTextureToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			texture->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveTextureToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			texture->InternalPointer, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -112,14 +112,14 @@ namespace Direct3D9
 	{
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 
-		HRESULT hr = D3DXFilterTexture( InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ),
-			sourceLevel, static_cast<DWORD>( filter ) );
+		HRESULT hr = TIME_CALL( D3DXFilterTexture( InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ),
+			sourceLevel, static_cast<DWORD>( filter ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result BaseTexture::FilterTexture( int sourceLevel, Filter filter )
 	{
-		HRESULT hr = D3DXFilterTexture( InternalPointer, NULL, sourceLevel, static_cast<DWORD>( filter ) );
+		HRESULT hr = TIME_CALL( D3DXFilterTexture( InternalPointer, NULL, sourceLevel, static_cast<DWORD>( filter ) ) );
 		return RECORD_D3D9( hr );
 	}
 }
@@ -0,0 +1,433 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+#include <vector>
+
+#include "../Utilities.h"
+
+#include "Direct3D9Exception.h"
+
+#include "CommandBuffer.h"
+#include "CommandBufferKernels.h"
+#include "Device.h"
+#include "IndexBuffer.h"
+#include "PixelShader9.h"
+#include "Surface.h"
+#include "Texture.h"
+#include "VertexBuffer.h"
+#include "VertexDeclaration.h"
+#include "VertexShader9.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	CommandBuffer::CommandBuffer()
+	{
+		m_Buffer = new NativeCommandBuffer();
+	}
+
+	CommandBuffer::~CommandBuffer()
+	{
+		this->!CommandBuffer();
+	}
+
+	CommandBuffer::!CommandBuffer()
+	{
+		delete m_Buffer;
+		m_Buffer = NULL;
+	}
+
+	void CommandBuffer::CheckDisposed()
+	{
+		if( m_Buffer == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	void CommandBuffer::Reset()
+	{
+		CheckDisposed();
+		m_Buffer->Reset();
+		m_SkippedCommandCount = 0;
+	}
+
+	int CommandBuffer::CommandCount::get()
+	{
+		CheckDisposed();
+		return m_Buffer->GetCommandCount();
+	}
+
+	int CommandBuffer::SizeInBytes::get()
+	{
+		CheckDisposed();
+		return static_cast<int>( m_Buffer->GetSizeInBytes() );
+	}
+
+	Result CommandBuffer::Execute( Device^ device )
+	{
+		return Execute( device, gcnew array<CommandBuffer^> { this } );
+	}
+
+	Result CommandBuffer::Execute( Device^ device, array<CommandBuffer^>^ buffers )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( buffers == nullptr )
+			throw gcnew ArgumentNullException( "buffers" );
+
+		std::vector<const NativeCommandBuffer*> nativeBuffers( buffers->Length );
+		std::vector<int> skippedCounts( buffers->Length );
+		for( int i = 0; i < buffers->Length; ++i )
+		{
+			if( buffers[i] == nullptr )
+				throw gcnew ArgumentException( "The command buffers cannot be null.", "buffers" );
+
+			buffers[i]->CheckDisposed();
+			nativeBuffers[i] = buffers[i]->m_Buffer;
+		}
+
+		if( buffers->Length == 0 )
+			return Result( S_OK );
+
+		HRESULT hr = TIME_CALL( ExecuteCommandBuffers( device->InternalPointer, &nativeBuffers[0], buffers->Length, &skippedCounts[0] ) );
+
+		for( int i = 0; i < buffers->Length; ++i )
+			buffers[i]->m_SkippedCommandCount = skippedCounts[i];
+
+		return RECORD_D3D9( hr );
+	}
+
+	void CommandBuffer::SetRenderState( RenderState state, int value )
+	{
+		CheckDisposed();
+		m_Buffer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), value );
+	}
+
+	void CommandBuffer::SetRenderState( RenderState state, bool value )
+	{
+		SetRenderState( state, value ? TRUE : FALSE );
+	}
+
+	void CommandBuffer::SetRenderState( RenderState state, float value )
+	{
+		SetRenderState( state, *reinterpret_cast<int*>( &value ) );
+	}
+
+	generic<typename T>
+	void CommandBuffer::SetRenderState( RenderState state, T value )
+	{
+		SetRenderState( state, static_cast<int>( value ) );
+	}
+
+	void CommandBuffer::SetSamplerState( int sampler, SamplerState type, int value )
+	{
+		CheckDisposed();
+		m_Buffer->SetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), value );
+	}
+
+	void CommandBuffer::SetSamplerState( int sampler, SamplerState type, float value )
+	{
+		SetSamplerState( sampler, type, *reinterpret_cast<int*>( &value ) );
+	}
+
+	void CommandBuffer::SetSamplerState( int sampler, SamplerState type, TextureAddress textureAddress )
+	{
+		SetSamplerState( sampler, type, static_cast<int>( textureAddress ) );
+	}
+
+	void CommandBuffer::SetSamplerState( int sampler, SamplerState type, TextureFilter textureFilter )
+	{
+		SetSamplerState( sampler, type, static_cast<int>( textureFilter ) );
+	}
+
+	void CommandBuffer::SetTextureStageState( int stage, TextureStage type, int value )
+	{
+		CheckDisposed();
+		m_Buffer->SetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), value );
+	}
+
+	void CommandBuffer::SetTextureStageState( int stage, TextureStage type, float value )
+	{
+		SetTextureStageState( stage, type, *reinterpret_cast<int*>( &value ) );
+	}
+
+	void CommandBuffer::SetTextureStageState( int stage, TextureStage type, TextureOperation textureOperation )
+	{
+		SetTextureStageState( stage, type, static_cast<int>( textureOperation ) );
+	}
+
+	void CommandBuffer::SetTextureStageState( int stage, TextureStage type, TextureArgument textureArgument )
+	{
+		SetTextureStageState( stage, type, static_cast<int>( textureArgument ) );
+	}
+
+	void CommandBuffer::SetTexture( int sampler, BaseTexture^ texture )
+	{
+		CheckDisposed();
+		m_Buffer->SetTexture( sampler, texture != nullptr ? texture->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::SetStreamSource( int stream, VertexBuffer^ streamData, int offsetInBytes, int stride )
+	{
+		CheckDisposed();
+		m_Buffer->SetStreamSource( stream, streamData != nullptr ? streamData->InternalPointer : NULL, offsetInBytes, stride );
+	}
+
+	void CommandBuffer::SetStreamSourceFrequency( int stream, int frequency, StreamSource source )
+	{
+		CheckDisposed();
+
+		UINT value = source == StreamSource::IndexedData ? D3DSTREAMSOURCE_INDEXEDDATA : D3DSTREAMSOURCE_INSTANCEDATA;
+		m_Buffer->SetStreamSourceFreq( stream, value | frequency );
+	}
+
+	void CommandBuffer::SetIndices( IndexBuffer^ indices )
+	{
+		CheckDisposed();
+		m_Buffer->SetIndices( indices != nullptr ? indices->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::SetVertexDeclaration( VertexDeclaration^ declaration )
+	{
+		CheckDisposed();
+		m_Buffer->SetVertexDeclaration( declaration != nullptr ? declaration->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::SetVertexFormat( VertexFormat format )
+	{
+		CheckDisposed();
+		m_Buffer->SetFVF( static_cast<DWORD>( format ) );
+	}
+
+	void CommandBuffer::SetVertexShader( VertexShader^ shader )
+	{
+		CheckDisposed();
+		m_Buffer->SetVertexShader( shader != nullptr ? shader->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::SetPixelShader( PixelShader^ shader )
+	{
+		CheckDisposed();
+		m_Buffer->SetPixelShader( shader != nullptr ? shader->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::SetVertexShaderConstant( int startRegister, array<float>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		int elements = count * 4;
+		Utilities::CheckArrayBounds( data, offset, elements );
+		if( elements < 4 )
+			return;
+
+		pin_ptr<float> pinnedData = &data[offset];
+		m_Buffer->SetVertexShaderConstantF( startRegister, pinnedData, elements / 4 );
+	}
+
+	void CommandBuffer::SetVertexShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Vector4> pinnedData = &data[offset];
+		m_Buffer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData ), count );
+	}
+
+	void CommandBuffer::SetVertexShaderConstant( int startRegister, Matrix data )
+	{
+		CheckDisposed();
+		m_Buffer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( &data ), 4 );
+	}
+
+	void CommandBuffer::SetVertexShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Matrix> pinnedData = &data[offset];
+		m_Buffer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData ), count * 4 );
+	}
+
+	void CommandBuffer::SetVertexShaderConstant( int startRegister, array<int>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		int elements = count * 4;
+		Utilities::CheckArrayBounds( data, offset, elements );
+		if( elements < 4 )
+			return;
+
+		pin_ptr<int> pinnedData = &data[offset];
+		m_Buffer->SetVertexShaderConstantI( startRegister, pinnedData, elements / 4 );
+	}
+
+	void CommandBuffer::SetVertexShaderConstant( int startRegister, array<bool>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		if( count == 0 )
+			return;
+
+		std::vector<BOOL> values( count );
+		for( int i = 0; i < count; ++i )
+			values[i] = data[offset + i] ? TRUE : FALSE;
+
+		m_Buffer->SetVertexShaderConstantB( startRegister, &values[0], count );
+	}
+
+	void CommandBuffer::SetPixelShaderConstant( int startRegister, array<float>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		int elements = count * 4;
+		Utilities::CheckArrayBounds( data, offset, elements );
+		if( elements < 4 )
+			return;
+
+		pin_ptr<float> pinnedData = &data[offset];
+		m_Buffer->SetPixelShaderConstantF( startRegister, pinnedData, elements / 4 );
+	}
+
+	void CommandBuffer::SetPixelShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Vector4> pinnedData = &data[offset];
+		m_Buffer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData ), count );
+	}
+
+	void CommandBuffer::SetPixelShaderConstant( int startRegister, Matrix data )
+	{
+		CheckDisposed();
+		m_Buffer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( &data ), 4 );
+	}
+
+	void CommandBuffer::SetPixelShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Matrix> pinnedData = &data[offset];
+		m_Buffer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData ), count * 4 );
+	}
+
+	void CommandBuffer::SetPixelShaderConstant( int startRegister, array<int>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		int elements = count * 4;
+		Utilities::CheckArrayBounds( data, offset, elements );
+		if( elements < 4 )
+			return;
+
+		pin_ptr<int> pinnedData = &data[offset];
+		m_Buffer->SetPixelShaderConstantI( startRegister, pinnedData, elements / 4 );
+	}
+
+	void CommandBuffer::SetPixelShaderConstant( int startRegister, array<bool>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		if( count == 0 )
+			return;
+
+		std::vector<BOOL> values( count );
+		for( int i = 0; i < count; ++i )
+			values[i] = data[offset + i] ? TRUE : FALSE;
+
+		m_Buffer->SetPixelShaderConstantB( startRegister, &values[0], count );
+	}
+
+	void CommandBuffer::SetViewport( Viewport viewport )
+	{
+		CheckDisposed();
+		m_Buffer->SetViewport( *reinterpret_cast<const D3DVIEWPORT9*>( &viewport ) );
+	}
+
+	void CommandBuffer::SetScissorRect( Drawing::Rectangle rectangle )
+	{
+		CheckDisposed();
+
+		RECT rect = { rectangle.Left, rectangle.Top, rectangle.Right, rectangle.Bottom };
+		m_Buffer->SetScissorRect( rect );
+	}
+
+	void CommandBuffer::SetTransform( TransformState state, Matrix value )
+	{
+		CheckDisposed();
+		m_Buffer->SetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), *reinterpret_cast<const D3DMATRIX*>( &value ) );
+	}
+
+	void CommandBuffer::SetRenderTarget( int targetIndex, Surface^ target )
+	{
+		CheckDisposed();
+		m_Buffer->SetRenderTarget( targetIndex, target != nullptr ? target->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::SetDepthStencilSurface( Surface^ target )
+	{
+		CheckDisposed();
+		m_Buffer->SetDepthStencilSurface( target != nullptr ? target->InternalPointer : NULL );
+	}
+
+	void CommandBuffer::Clear( ClearFlags clearFlags, Color4 color, float zdepth, int stencil )
+	{
+		Clear( clearFlags, color.ToArgb(), zdepth, stencil );
+	}
+
+	void CommandBuffer::Clear( ClearFlags clearFlags, int color, float zdepth, int stencil )
+	{
+		CheckDisposed();
+		m_Buffer->Clear( static_cast<DWORD>( clearFlags ), static_cast<D3DCOLOR>( color ), zdepth, stencil );
+	}
+
+	void CommandBuffer::DrawPrimitives( PrimitiveType primitiveType, int startIndex, int primitiveCount )
+	{
+		CheckDisposed();
+		m_Buffer->DrawPrimitive( static_cast<D3DPRIMITIVETYPE>( primitiveType ), startIndex, primitiveCount );
+	}
+
+	void CommandBuffer::DrawIndexedPrimitives( PrimitiveType primitiveType, int baseVertexIndex, int minimumVertexIndex, int vertexCount, int startIndex, int primitiveCount )
+	{
+		CheckDisposed();
+		m_Buffer->DrawIndexedPrimitive( static_cast<D3DPRIMITIVETYPE>( primitiveType ), baseVertexIndex, minimumVertexIndex, vertexCount, startIndex, primitiveCount );
+	}
+}
+}
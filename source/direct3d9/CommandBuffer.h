@@ -0,0 +1,447 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../math/Color4.h"
+#include "../math/Matrix.h"
+#include "../math/Vector4.h"
+
+#include "Enums.h"
+#include "Viewport9.h"
+
+namespace SlimDX
+{
+	namespace Direct3D9
+	{
+		class NativeCommandBuffer;
+
+		ref class BaseTexture;
+		ref class Device;
+		ref class IndexBuffer;
+		ref class PixelShader;
+		ref class Surface;
+		ref class VertexBuffer;
+		ref class VertexDeclaration;
+		ref class VertexShader;
+
+		/// <summary>
+		/// Records a sequence of <see cref="Device"/> state and draw calls that can be replayed later on the rendering thread.
+		/// </summary>
+		/// <remarks>
+		/// Recording only appends to a native command stream and never calls the device, so buffers can be filled on worker
+		/// threads; a single buffer must not be recorded by more than one thread at a time. Resources and shaders are kept alive
+		/// until the buffer is <see cref="Reset">reset</see>. During <see cref="Execute(Device^)"/>, state calls that would set a
+		/// value already set earlier in the same execution are skipped. Shader constants, transforms, render targets, clears and
+		/// draws are always replayed.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class CommandBuffer sealed
+		{
+		private:
+			NativeCommandBuffer* m_Buffer;
+			int m_SkippedCommandCount;
+
+			void CheckDisposed();
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="CommandBuffer"/> class.
+			/// </summary>
+			CommandBuffer();
+
+			/// <summary>
+			/// Releases the command stream and the objects it refers to.
+			/// </summary>
+			~CommandBuffer();
+
+			/// <summary>
+			/// Releases the command stream and the objects it refers to.
+			/// </summary>
+			!CommandBuffer();
+
+			/// <summary>
+			/// Removes all recorded commands and releases the objects they refer to.
+			/// </summary>
+			void Reset();
+
+			/// <summary>
+			/// Replays the recorded commands on a device.
+			/// </summary>
+			/// <param name="device">The device to replay the commands on.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Execute( Device^ device );
+
+			/// <summary>
+			/// Replays several command buffers in order on a device, eliminating redundant state across all of them.
+			/// </summary>
+			/// <param name="device">The device to replay the commands on.</param>
+			/// <param name="buffers">The command buffers to replay.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			static Result Execute( Device^ device, array<CommandBuffer^>^ buffers );
+
+			/// <summary>
+			/// Records a render state change.
+			/// </summary>
+			/// <param name="state">The render state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetRenderState( RenderState state, int value );
+
+			/// <summary>
+			/// Records a render state change.
+			/// </summary>
+			/// <param name="state">The render state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetRenderState( RenderState state, bool value );
+
+			/// <summary>
+			/// Records a render state change.
+			/// </summary>
+			/// <param name="state">The render state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetRenderState( RenderState state, float value );
+
+			/// <summary>
+			/// Records a render state change.
+			/// </summary>
+			/// <typeparam name="T">The type of the render state value.</typeparam>
+			/// <param name="state">The render state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			generic<typename T> where T : System::Enum
+				void SetRenderState( RenderState state, T value );
+
+			/// <summary>
+			/// Records a sampler state change.
+			/// </summary>
+			/// <param name="sampler">The sampler stage index.</param>
+			/// <param name="type">The sampler state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetSamplerState( int sampler, SamplerState type, int value );
+
+			/// <summary>
+			/// Records a sampler state change.
+			/// </summary>
+			/// <param name="sampler">The sampler stage index.</param>
+			/// <param name="type">The sampler state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetSamplerState( int sampler, SamplerState type, float value );
+
+			/// <summary>
+			/// Records a sampler state change.
+			/// </summary>
+			/// <param name="sampler">The sampler stage index.</param>
+			/// <param name="type">The sampler state that is being modified.</param>
+			/// <param name="textureAddress">The new texture addressing mode.</param>
+			void SetSamplerState( int sampler, SamplerState type, TextureAddress textureAddress );
+
+			/// <summary>
+			/// Records a sampler state change.
+			/// </summary>
+			/// <param name="sampler">The sampler stage index.</param>
+			/// <param name="type">The sampler state that is being modified.</param>
+			/// <param name="textureFilter">The new texture filter.</param>
+			void SetSamplerState( int sampler, SamplerState type, TextureFilter textureFilter );
+
+			/// <summary>
+			/// Records a texture stage state change.
+			/// </summary>
+			/// <param name="stage">The texture stage index.</param>
+			/// <param name="type">The texture stage state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetTextureStageState( int stage, TextureStage type, int value );
+
+			/// <summary>
+			/// Records a texture stage state change.
+			/// </summary>
+			/// <param name="stage">The texture stage index.</param>
+			/// <param name="type">The texture stage state that is being modified.</param>
+			/// <param name="value">The new value for the state.</param>
+			void SetTextureStageState( int stage, TextureStage type, float value );
+
+			/// <summary>
+			/// Records a texture stage state change.
+			/// </summary>
+			/// <param name="stage">The texture stage index.</param>
+			/// <param name="type">The texture stage state that is being modified.</param>
+			/// <param name="textureOperation">The new texture operation.</param>
+			void SetTextureStageState( int stage, TextureStage type, TextureOperation textureOperation );
+
+			/// <summary>
+			/// Records a texture stage state change.
+			/// </summary>
+			/// <param name="stage">The texture stage index.</param>
+			/// <param name="type">The texture stage state that is being modified.</param>
+			/// <param name="textureArgument">The new texture argument.</param>
+			void SetTextureStageState( int stage, TextureStage type, TextureArgument textureArgument );
+
+			/// <summary>
+			/// Records a texture binding.
+			/// </summary>
+			/// <param name="sampler">The sampler stage index.</param>
+			/// <param name="texture">The texture to bind, or <c>null</c> to unbind the stage.</param>
+			void SetTexture( int sampler, BaseTexture^ texture );
+
+			/// <summary>
+			/// Records a vertex buffer binding.
+			/// </summary>
+			/// <param name="stream">The index of the data stream.</param>
+			/// <param name="streamData">The vertex buffer to bind, or <c>null</c> to unbind the stream.</param>
+			/// <param name="offsetInBytes">The offset from the beginning of the buffer to the first vertex, in bytes.</param>
+			/// <param name="stride">The stride of each vertex, in bytes.</param>
+			void SetStreamSource( int stream, VertexBuffer^ streamData, int offsetInBytes, int stride );
+
+			/// <summary>
+			/// Records a stream source frequency change.
+			/// </summary>
+			/// <param name="stream">The index of the data stream.</param>
+			/// <param name="frequency">The new frequency divider.</param>
+			/// <param name="source">The type of data in the stream.</param>
+			void SetStreamSourceFrequency( int stream, int frequency, StreamSource source );
+
+			/// <summary>
+			/// Records an index buffer binding.
+			/// </summary>
+			/// <param name="indices">The index buffer to bind, or <c>null</c> to unbind it.</param>
+			void SetIndices( IndexBuffer^ indices );
+
+			/// <summary>
+			/// Records a vertex declaration change.
+			/// </summary>
+			/// <param name="declaration">The vertex declaration to use.</param>
+			void SetVertexDeclaration( VertexDeclaration^ declaration );
+
+			/// <summary>
+			/// Records a flexible vertex format change.
+			/// </summary>
+			/// <param name="format">The vertex format to use.</param>
+			void SetVertexFormat( VertexFormat format );
+
+			/// <summary>
+			/// Records a vertex shader change.
+			/// </summary>
+			/// <param name="shader">The vertex shader to use, or <c>null</c> for the fixed function pipeline.</param>
+			void SetVertexShader( VertexShader^ shader );
+
+			/// <summary>
+			/// Records a pixel shader change.
+			/// </summary>
+			/// <param name="shader">The pixel shader to use, or <c>null</c> for the fixed function pipeline.</param>
+			void SetPixelShader( PixelShader^ shader );
+
+			/// <summary>
+			/// Records a vertex shader floating point constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of four component registers to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<float>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a vertex shader floating point constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first vector to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a vertex shader floating point constant update that sets four registers.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The matrix to set.</param>
+			void SetVertexShaderConstant( int startRegister, Matrix data );
+
+			/// <summary>
+			/// Records a vertex shader floating point constant update that sets four registers per matrix. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The matrices to set.</param>
+			/// <param name="offset">The index of the first matrix to use.</param>
+			/// <param name="count">The number of matrices to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a vertex shader integer constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of four component registers to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<int>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a vertex shader boolean constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<bool>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a pixel shader floating point constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of four component registers to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<float>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a pixel shader floating point constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first vector to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a pixel shader floating point constant update that sets four registers.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The matrix to set.</param>
+			void SetPixelShaderConstant( int startRegister, Matrix data );
+
+			/// <summary>
+			/// Records a pixel shader floating point constant update that sets four registers per matrix. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The matrices to set.</param>
+			/// <param name="offset">The index of the first matrix to use.</param>
+			/// <param name="count">The number of matrices to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a pixel shader integer constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of four component registers to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<int>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a pixel shader boolean constant update. The data is copied.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The constant data.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<bool>^ data, int offset, int count );
+
+			/// <summary>
+			/// Records a viewport change.
+			/// </summary>
+			/// <param name="viewport">The new viewport.</param>
+			void SetViewport( Viewport viewport );
+
+			/// <summary>
+			/// Records a scissor rectangle change.
+			/// </summary>
+			/// <param name="rectangle">The new scissor rectangle.</param>
+			void SetScissorRect( System::Drawing::Rectangle rectangle );
+
+			/// <summary>
+			/// Records a fixed function transform change.
+			/// </summary>
+			/// <param name="state">The transform that is being modified.</param>
+			/// <param name="value">The new transform matrix.</param>
+			void SetTransform( TransformState state, Matrix value );
+
+			/// <summary>
+			/// Records a render target change. Replaying it resets the viewport and scissor rectangle to cover the target.
+			/// </summary>
+			/// <param name="targetIndex">The index of the render target.</param>
+			/// <param name="target">The surface to render to, or <c>null</c> to unbind the target.</param>
+			void SetRenderTarget( int targetIndex, Surface^ target );
+
+			/// <summary>
+			/// Records a depth stencil surface change.
+			/// </summary>
+			/// <param name="target">The depth stencil surface, or <c>null</c> to unbind it.</param>
+			void SetDepthStencilSurface( Surface^ target );
+
+			/// <summary>
+			/// Records a clear of the whole viewport.
+			/// </summary>
+			/// <param name="clearFlags">Flags that specify which surfaces will be cleared.</param>
+			/// <param name="color">The color that will be used to fill the cleared render target.</param>
+			/// <param name="zdepth">The value that will be used to fill the cleared depth buffer.</param>
+			/// <param name="stencil">The value that will be used to fill the cleared stencil buffer.</param>
+			void Clear( ClearFlags clearFlags, Color4 color, float zdepth, int stencil );
+
+			/// <summary>
+			/// Records a clear of the whole viewport.
+			/// </summary>
+			/// <param name="clearFlags">Flags that specify which surfaces will be cleared.</param>
+			/// <param name="color">The color that will be used to fill the cleared render target, as a packed ARGB value.</param>
+			/// <param name="zdepth">The value that will be used to fill the cleared depth buffer.</param>
+			/// <param name="stencil">The value that will be used to fill the cleared stencil buffer.</param>
+			void Clear( ClearFlags clearFlags, int color, float zdepth, int stencil );
+
+			/// <summary>
+			/// Records a non-indexed draw from the current vertex streams.
+			/// </summary>
+			/// <param name="primitiveType">The type of primitive to render.</param>
+			/// <param name="startIndex">The index of the first vertex to load.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			void DrawPrimitives( PrimitiveType primitiveType, int startIndex, int primitiveCount );
+
+			/// <summary>
+			/// Records an indexed draw from the current vertex streams and index buffer.
+			/// </summary>
+			/// <param name="primitiveType">The type of primitive to render.</param>
+			/// <param name="baseVertexIndex">The offset added to each index before it reads a vertex.</param>
+			/// <param name="minimumVertexIndex">The minimum vertex index used by the draw, relative to <paramref name="baseVertexIndex"/>.</param>
+			/// <param name="vertexCount">The number of vertices used by the draw.</param>
+			/// <param name="startIndex">The index of the first index to read.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			void DrawIndexedPrimitives( PrimitiveType primitiveType, int baseVertexIndex, int minimumVertexIndex, int vertexCount, int startIndex, int primitiveCount );
+
+			/// <summary>
+			/// Gets the number of recorded commands.
+			/// </summary>
+			property int CommandCount
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the size of the recorded command stream, in bytes.
+			/// </summary>
+			property int SizeInBytes
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of this buffer's commands that were skipped as redundant during its most recent execution.
+			/// </summary>
+			property int SkippedCommandCount
+			{
+				int get() { return m_SkippedCommandCount; }
+			}
+		};
+	}
+}
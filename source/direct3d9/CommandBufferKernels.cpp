@@ -0,0 +1,594 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+#include <string.h>
+
+#include "CommandBufferKernels.h"
+
+// Recording and replay never touch managed objects, so the whole command stream stays native.
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	namespace
+	{
+		enum CommandOp
+		{
+			OpRenderState,
+			OpSamplerState,
+			OpTextureStageState,
+			OpTexture,
+			OpStreamSource,
+			OpStreamSourceFreq,
+			OpIndices,
+			OpVertexDeclaration,
+			OpFVF,
+			OpVertexShader,
+			OpPixelShader,
+			OpVertexShaderConstantF,
+			OpVertexShaderConstantI,
+			OpVertexShaderConstantB,
+			OpPixelShaderConstantF,
+			OpPixelShaderConstantI,
+			OpPixelShaderConstantB,
+			OpViewport,
+			OpScissorRect,
+			OpTransform,
+			OpRenderTarget,
+			OpDepthStencilSurface,
+			OpClear,
+			OpDrawPrimitive,
+			OpDrawIndexedPrimitive
+		};
+
+		const size_t PointerSize = sizeof( void* ) / sizeof( DWORD );
+
+		const DWORD RenderStateCount = 256;
+		const int SamplerCount = 21;				// 16 pixel samplers, the displacement map sampler and 4 vertex samplers
+		const DWORD SamplerStateCount = 14;
+		const DWORD TextureStageCount = 8;
+		const DWORD TextureStageStateCount = 33;
+		const DWORD StreamCount = 16;
+
+		template<typename T>
+		T ReadPointer( const DWORD* arguments )
+		{
+			T pointer;
+			memcpy( &pointer, arguments, sizeof( pointer ) );
+			return pointer;
+		}
+
+		// Maps D3DDMAPSAMPLER and D3DVERTEXTEXTURESAMPLER0-3 after the pixel samplers; -1 for indices without a slot.
+		int GetSamplerSlot( DWORD sampler )
+		{
+			if( sampler < 16 )
+				return static_cast<int>( sampler );
+			if( sampler >= D3DDMAPSAMPLER && sampler <= D3DVERTEXTEXTURESAMPLER3 )
+				return static_cast<int>( sampler - D3DDMAPSAMPLER ) + 16;
+			return -1;
+		}
+
+		template<typename T>
+		struct ShadowValue
+		{
+			T Value;
+			bool Known;
+
+			ShadowValue() : Known( false ) { }
+
+			// Returns false when the value is already current, otherwise records it.
+			bool Update( const T& value )
+			{
+				if( Known && memcmp( &Value, &value, sizeof( T ) ) == 0 )
+					return false;
+
+				Value = value;
+				Known = true;
+				return true;
+			}
+		};
+
+		struct StreamBinding
+		{
+			void* Buffer;
+			UINT Offset;
+			UINT Stride;
+		};
+
+		struct ReplayState
+		{
+			ShadowValue<DWORD> RenderStates[RenderStateCount];
+			ShadowValue<DWORD> SamplerStates[SamplerCount][SamplerStateCount];
+			ShadowValue<DWORD> TextureStageStates[TextureStageCount][TextureStageStateCount];
+			ShadowValue<void*> Textures[SamplerCount];
+			ShadowValue<StreamBinding> Streams[StreamCount];
+			ShadowValue<UINT> StreamFrequencies[StreamCount];
+			ShadowValue<void*> Indices;
+			ShadowValue<void*> VertexDeclaration;
+			ShadowValue<DWORD> FVF;
+			ShadowValue<void*> VertexShader;
+			ShadowValue<void*> PixelShader;
+			ShadowValue<D3DVIEWPORT9> Viewport;
+			ShadowValue<RECT> ScissorRect;
+		};
+
+		HRESULT Execute( IDirect3DDevice9* device, const std::vector<DWORD>& data, ReplayState& state, int& skipped )
+		{
+			if( data.empty() )
+				return S_OK;
+
+			const DWORD* position = &data[0];
+			const DWORD* end = position + data.size();
+
+			while( position < end )
+			{
+				DWORD header = *position++;
+				const DWORD* arguments = position;
+				position += header >> 8;
+
+				HRESULT hr = S_OK;
+				bool redundant = false;
+
+				switch( header & 0xFF )
+				{
+				case OpRenderState:
+					if( arguments[0] < RenderStateCount && !state.RenderStates[arguments[0]].Update( arguments[1] ) )
+						redundant = true;
+					else
+						hr = device->SetRenderState( static_cast<D3DRENDERSTATETYPE>( arguments[0] ), arguments[1] );
+					break;
+
+				case OpSamplerState:
+				{
+					int slot = GetSamplerSlot( arguments[0] );
+					if( slot >= 0 && arguments[1] < SamplerStateCount && !state.SamplerStates[slot][arguments[1]].Update( arguments[2] ) )
+						redundant = true;
+					else
+						hr = device->SetSamplerState( arguments[0], static_cast<D3DSAMPLERSTATETYPE>( arguments[1] ), arguments[2] );
+					break;
+				}
+
+				case OpTextureStageState:
+					if( arguments[0] < TextureStageCount && arguments[1] < TextureStageStateCount && !state.TextureStageStates[arguments[0]][arguments[1]].Update( arguments[2] ) )
+						redundant = true;
+					else
+						hr = device->SetTextureStageState( arguments[0], static_cast<D3DTEXTURESTAGESTATETYPE>( arguments[1] ), arguments[2] );
+					break;
+
+				case OpTexture:
+				{
+					IDirect3DBaseTexture9* texture = ReadPointer<IDirect3DBaseTexture9*>( arguments + 1 );
+					int slot = GetSamplerSlot( arguments[0] );
+					if( slot >= 0 && !state.Textures[slot].Update( texture ) )
+						redundant = true;
+					else
+						hr = device->SetTexture( arguments[0], texture );
+					break;
+				}
+
+				case OpStreamSource:
+				{
+					StreamBinding binding;
+					binding.Buffer = ReadPointer<void*>( arguments + 3 );
+					binding.Offset = arguments[1];
+					binding.Stride = arguments[2];
+
+					if( arguments[0] < StreamCount && !state.Streams[arguments[0]].Update( binding ) )
+						redundant = true;
+					else
+						hr = device->SetStreamSource( arguments[0], static_cast<IDirect3DVertexBuffer9*>( binding.Buffer ), binding.Offset, binding.Stride );
+					break;
+				}
+
+				case OpStreamSourceFreq:
+					if( arguments[0] < StreamCount && !state.StreamFrequencies[arguments[0]].Update( arguments[1] ) )
+						redundant = true;
+					else
+						hr = device->SetStreamSourceFreq( arguments[0], arguments[1] );
+					break;
+
+				case OpIndices:
+				{
+					IDirect3DIndexBuffer9* indices = ReadPointer<IDirect3DIndexBuffer9*>( arguments );
+					if( !state.Indices.Update( indices ) )
+						redundant = true;
+					else
+						hr = device->SetIndices( indices );
+					break;
+				}
+
+				case OpVertexDeclaration:
+				{
+					IDirect3DVertexDeclaration9* declaration = ReadPointer<IDirect3DVertexDeclaration9*>( arguments );
+					if( !state.VertexDeclaration.Update( declaration ) )
+					{
+						redundant = true;
+					}
+					else
+					{
+						// Setting a declaration replaces the FVF.
+						state.FVF.Known = false;
+						hr = device->SetVertexDeclaration( declaration );
+					}
+					break;
+				}
+
+				case OpFVF:
+					if( !state.FVF.Update( arguments[0] ) )
+					{
+						redundant = true;
+					}
+					else
+					{
+						// Setting an FVF replaces the declaration.
+						state.VertexDeclaration.Known = false;
+						hr = device->SetFVF( arguments[0] );
+					}
+					break;
+
+				case OpVertexShader:
+				{
+					IDirect3DVertexShader9* shader = ReadPointer<IDirect3DVertexShader9*>( arguments );
+					if( !state.VertexShader.Update( shader ) )
+						redundant = true;
+					else
+						hr = device->SetVertexShader( shader );
+					break;
+				}
+
+				case OpPixelShader:
+				{
+					IDirect3DPixelShader9* shader = ReadPointer<IDirect3DPixelShader9*>( arguments );
+					if( !state.PixelShader.Update( shader ) )
+						redundant = true;
+					else
+						hr = device->SetPixelShader( shader );
+					break;
+				}
+
+				case OpVertexShaderConstantF:
+					hr = device->SetVertexShaderConstantF( arguments[0], reinterpret_cast<const float*>( arguments + 2 ), arguments[1] );
+					break;
+
+				case OpVertexShaderConstantI:
+					hr = device->SetVertexShaderConstantI( arguments[0], reinterpret_cast<const int*>( arguments + 2 ), arguments[1] );
+					break;
+
+				case OpVertexShaderConstantB:
+					hr = device->SetVertexShaderConstantB( arguments[0], reinterpret_cast<const BOOL*>( arguments + 2 ), arguments[1] );
+					break;
+
+				case OpPixelShaderConstantF:
+					hr = device->SetPixelShaderConstantF( arguments[0], reinterpret_cast<const float*>( arguments + 2 ), arguments[1] );
+					break;
+
+				case OpPixelShaderConstantI:
+					hr = device->SetPixelShaderConstantI( arguments[0], reinterpret_cast<const int*>( arguments + 2 ), arguments[1] );
+					break;
+
+				case OpPixelShaderConstantB:
+					hr = device->SetPixelShaderConstantB( arguments[0], reinterpret_cast<const BOOL*>( arguments + 2 ), arguments[1] );
+					break;
+
+				case OpViewport:
+				{
+					D3DVIEWPORT9 viewport;
+					memcpy( &viewport, arguments, sizeof( viewport ) );
+					if( !state.Viewport.Update( viewport ) )
+						redundant = true;
+					else
+						hr = device->SetViewport( &viewport );
+					break;
+				}
+
+				case OpScissorRect:
+				{
+					RECT rect;
+					memcpy( &rect, arguments, sizeof( rect ) );
+					if( !state.ScissorRect.Update( rect ) )
+						redundant = true;
+					else
+						hr = device->SetScissorRect( &rect );
+					break;
+				}
+
+				case OpTransform:
+					hr = device->SetTransform( static_cast<D3DTRANSFORMSTATETYPE>( arguments[0] ), reinterpret_cast<const D3DMATRIX*>( arguments + 1 ) );
+					break;
+
+				case OpRenderTarget:
+					// Setting a render target resets the viewport and scissor rectangle to cover it.
+					state.Viewport.Known = false;
+					state.ScissorRect.Known = false;
+					hr = device->SetRenderTarget( arguments[0], ReadPointer<IDirect3DSurface9*>( arguments + 1 ) );
+					break;
+
+				case OpDepthStencilSurface:
+					hr = device->SetDepthStencilSurface( ReadPointer<IDirect3DSurface9*>( arguments ) );
+					break;
+
+				case OpClear:
+				{
+					float z;
+					memcpy( &z, arguments + 2, sizeof( z ) );
+					hr = device->Clear( 0, NULL, arguments[0], arguments[1], z, arguments[3] );
+					break;
+				}
+
+				case OpDrawPrimitive:
+					hr = device->DrawPrimitive( static_cast<D3DPRIMITIVETYPE>( arguments[0] ), arguments[1], arguments[2] );
+					break;
+
+				case OpDrawIndexedPrimitive:
+					hr = device->DrawIndexedPrimitive( static_cast<D3DPRIMITIVETYPE>( arguments[0] ), static_cast<INT>( arguments[1] ),
+						arguments[2], arguments[3], arguments[4], arguments[5] );
+					break;
+				}
+
+				if( redundant )
+					++skipped;
+				else if( FAILED( hr ) )
+					return hr;
+			}
+
+			return S_OK;
+		}
+	}
+
+	NativeCommandBuffer::NativeCommandBuffer()
+	: m_CommandCount( 0 )
+	{
+	}
+
+	NativeCommandBuffer::~NativeCommandBuffer()
+	{
+		Reset();
+	}
+
+	void NativeCommandBuffer::Reset()
+	{
+		for( size_t i = 0; i < m_References.size(); ++i )
+			m_References[i]->Release();
+
+		m_References.clear();
+		m_Data.clear();
+		m_CommandCount = 0;
+	}
+
+	DWORD* NativeCommandBuffer::Append( DWORD op, size_t argumentCount )
+	{
+		size_t at = m_Data.size();
+		m_Data.resize( at + 1 + argumentCount );
+		m_Data[at] = op | static_cast<DWORD>( argumentCount << 8 );
+
+		++m_CommandCount;
+		return &m_Data[at + 1];
+	}
+
+	void NativeCommandBuffer::AppendPointer( DWORD*& arguments, IUnknown* object )
+	{
+		if( object != NULL )
+		{
+			object->AddRef();
+			m_References.push_back( object );
+		}
+
+		memcpy( arguments, &object, sizeof( object ) );
+		arguments += PointerSize;
+	}
+
+	void NativeCommandBuffer::AppendConstants( DWORD op, UINT startRegister, const void* data, UINT count, size_t dwordsPerRegister )
+	{
+		DWORD* arguments = Append( op, 2 + count * dwordsPerRegister );
+		arguments[0] = startRegister;
+		arguments[1] = count;
+		memcpy( arguments + 2, data, count * dwordsPerRegister * sizeof( DWORD ) );
+	}
+
+	void NativeCommandBuffer::SetRenderState( D3DRENDERSTATETYPE state, DWORD value )
+	{
+		DWORD* arguments = Append( OpRenderState, 2 );
+		arguments[0] = state;
+		arguments[1] = value;
+	}
+
+	void NativeCommandBuffer::SetSamplerState( DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value )
+	{
+		DWORD* arguments = Append( OpSamplerState, 3 );
+		arguments[0] = sampler;
+		arguments[1] = type;
+		arguments[2] = value;
+	}
+
+	void NativeCommandBuffer::SetTextureStageState( DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD value )
+	{
+		DWORD* arguments = Append( OpTextureStageState, 3 );
+		arguments[0] = stage;
+		arguments[1] = type;
+		arguments[2] = value;
+	}
+
+	void NativeCommandBuffer::SetTexture( DWORD sampler, IDirect3DBaseTexture9* texture )
+	{
+		DWORD* arguments = Append( OpTexture, 1 + PointerSize );
+		arguments[0] = sampler;
+		++arguments;
+		AppendPointer( arguments, texture );
+	}
+
+	void NativeCommandBuffer::SetStreamSource( UINT stream, IDirect3DVertexBuffer9* buffer, UINT offsetInBytes, UINT stride )
+	{
+		DWORD* arguments = Append( OpStreamSource, 3 + PointerSize );
+		arguments[0] = stream;
+		arguments[1] = offsetInBytes;
+		arguments[2] = stride;
+		arguments += 3;
+		AppendPointer( arguments, buffer );
+	}
+
+	void NativeCommandBuffer::SetStreamSourceFreq( UINT stream, UINT setting )
+	{
+		DWORD* arguments = Append( OpStreamSourceFreq, 2 );
+		arguments[0] = stream;
+		arguments[1] = setting;
+	}
+
+	void NativeCommandBuffer::SetIndices( IDirect3DIndexBuffer9* indices )
+	{
+		DWORD* arguments = Append( OpIndices, PointerSize );
+		AppendPointer( arguments, indices );
+	}
+
+	void NativeCommandBuffer::SetVertexDeclaration( IDirect3DVertexDeclaration9* declaration )
+	{
+		DWORD* arguments = Append( OpVertexDeclaration, PointerSize );
+		AppendPointer( arguments, declaration );
+	}
+
+	void NativeCommandBuffer::SetFVF( DWORD fvf )
+	{
+		DWORD* arguments = Append( OpFVF, 1 );
+		arguments[0] = fvf;
+	}
+
+	void NativeCommandBuffer::SetVertexShader( IDirect3DVertexShader9* shader )
+	{
+		DWORD* arguments = Append( OpVertexShader, PointerSize );
+		AppendPointer( arguments, shader );
+	}
+
+	void NativeCommandBuffer::SetPixelShader( IDirect3DPixelShader9* shader )
+	{
+		DWORD* arguments = Append( OpPixelShader, PointerSize );
+		AppendPointer( arguments, shader );
+	}
+
+	void NativeCommandBuffer::SetVertexShaderConstantF( UINT startRegister, const float* data, UINT count )
+	{
+		AppendConstants( OpVertexShaderConstantF, startRegister, data, count, 4 );
+	}
+
+	void NativeCommandBuffer::SetVertexShaderConstantI( UINT startRegister, const int* data, UINT count )
+	{
+		AppendConstants( OpVertexShaderConstantI, startRegister, data, count, 4 );
+	}
+
+	void NativeCommandBuffer::SetVertexShaderConstantB( UINT startRegister, const BOOL* data, UINT count )
+	{
+		AppendConstants( OpVertexShaderConstantB, startRegister, data, count, 1 );
+	}
+
+	void NativeCommandBuffer::SetPixelShaderConstantF( UINT startRegister, const float* data, UINT count )
+	{
+		AppendConstants( OpPixelShaderConstantF, startRegister, data, count, 4 );
+	}
+
+	void NativeCommandBuffer::SetPixelShaderConstantI( UINT startRegister, const int* data, UINT count )
+	{
+		AppendConstants( OpPixelShaderConstantI, startRegister, data, count, 4 );
+	}
+
+	void NativeCommandBuffer::SetPixelShaderConstantB( UINT startRegister, const BOOL* data, UINT count )
+	{
+		AppendConstants( OpPixelShaderConstantB, startRegister, data, count, 1 );
+	}
+
+	void NativeCommandBuffer::SetViewport( const D3DVIEWPORT9& viewport )
+	{
+		DWORD* arguments = Append( OpViewport, sizeof( viewport ) / sizeof( DWORD ) );
+		memcpy( arguments, &viewport, sizeof( viewport ) );
+	}
+
+	void NativeCommandBuffer::SetScissorRect( const RECT& rect )
+	{
+		DWORD* arguments = Append( OpScissorRect, sizeof( rect ) / sizeof( DWORD ) );
+		memcpy( arguments, &rect, sizeof( rect ) );
+	}
+
+	void NativeCommandBuffer::SetTransform( D3DTRANSFORMSTATETYPE state, const D3DMATRIX& matrix )
+	{
+		DWORD* arguments = Append( OpTransform, 1 + sizeof( matrix ) / sizeof( DWORD ) );
+		arguments[0] = state;
+		memcpy( arguments + 1, &matrix, sizeof( matrix ) );
+	}
+
+	void NativeCommandBuffer::SetRenderTarget( DWORD index, IDirect3DSurface9* surface )
+	{
+		DWORD* arguments = Append( OpRenderTarget, 1 + PointerSize );
+		arguments[0] = index;
+		++arguments;
+		AppendPointer( arguments, surface );
+	}
+
+	void NativeCommandBuffer::SetDepthStencilSurface( IDirect3DSurface9* surface )
+	{
+		DWORD* arguments = Append( OpDepthStencilSurface, PointerSize );
+		AppendPointer( arguments, surface );
+	}
+
+	void NativeCommandBuffer::Clear( DWORD flags, D3DCOLOR color, float z, DWORD stencil )
+	{
+		DWORD* arguments = Append( OpClear, 4 );
+		arguments[0] = flags;
+		arguments[1] = color;
+		memcpy( arguments + 2, &z, sizeof( z ) );
+		arguments[3] = stencil;
+	}
+
+	void NativeCommandBuffer::DrawPrimitive( D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount )
+	{
+		DWORD* arguments = Append( OpDrawPrimitive, 3 );
+		arguments[0] = type;
+		arguments[1] = startVertex;
+		arguments[2] = primitiveCount;
+	}
+
+	void NativeCommandBuffer::DrawIndexedPrimitive( D3DPRIMITIVETYPE type, INT baseVertexIndex, UINT minimumVertexIndex, UINT vertexCount, UINT startIndex, UINT primitiveCount )
+	{
+		DWORD* arguments = Append( OpDrawIndexedPrimitive, 6 );
+		arguments[0] = type;
+		arguments[1] = static_cast<DWORD>( baseVertexIndex );
+		arguments[2] = minimumVertexIndex;
+		arguments[3] = vertexCount;
+		arguments[4] = startIndex;
+		arguments[5] = primitiveCount;
+	}
+
+	HRESULT ExecuteCommandBuffers( IDirect3DDevice9* device, const NativeCommandBuffer* const* buffers, int bufferCount, int* skippedCounts )
+	{
+		// The shadow state is several kilobytes, so it lives on the heap rather than the stack.
+		ReplayState* state = new ReplayState();
+		HRESULT hr = S_OK;
+
+		for( int i = 0; i < bufferCount && SUCCEEDED( hr ); ++i )
+			hr = Execute( device, buffers[i]->GetData(), *state, skippedCounts[i] );
+
+		delete state;
+		return hr;
+	}
+}
+}
+
+#pragma managed(pop)
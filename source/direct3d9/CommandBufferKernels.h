@@ -0,0 +1,89 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	// A compact stream of recorded IDirect3DDevice9 calls. Every object a command refers to is AddRef'd when the
+	// command is recorded and released by Reset, so a buffer can be filled on any thread and replayed later.
+	class NativeCommandBuffer
+	{
+	public:
+		NativeCommandBuffer();
+		~NativeCommandBuffer();
+
+		void Reset();
+
+		void SetRenderState( D3DRENDERSTATETYPE state, DWORD value );
+		void SetSamplerState( DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value );
+		void SetTextureStageState( DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD value );
+		void SetTexture( DWORD sampler, IDirect3DBaseTexture9* texture );
+		void SetStreamSource( UINT stream, IDirect3DVertexBuffer9* buffer, UINT offsetInBytes, UINT stride );
+		void SetStreamSourceFreq( UINT stream, UINT setting );
+		void SetIndices( IDirect3DIndexBuffer9* indices );
+		void SetVertexDeclaration( IDirect3DVertexDeclaration9* declaration );
+		void SetFVF( DWORD fvf );
+		void SetVertexShader( IDirect3DVertexShader9* shader );
+		void SetPixelShader( IDirect3DPixelShader9* shader );
+		void SetVertexShaderConstantF( UINT startRegister, const float* data, UINT count );
+		void SetVertexShaderConstantI( UINT startRegister, const int* data, UINT count );
+		void SetVertexShaderConstantB( UINT startRegister, const BOOL* data, UINT count );
+		void SetPixelShaderConstantF( UINT startRegister, const float* data, UINT count );
+		void SetPixelShaderConstantI( UINT startRegister, const int* data, UINT count );
+		void SetPixelShaderConstantB( UINT startRegister, const BOOL* data, UINT count );
+		void SetViewport( const D3DVIEWPORT9& viewport );
+		void SetScissorRect( const RECT& rect );
+		void SetTransform( D3DTRANSFORMSTATETYPE state, const D3DMATRIX& matrix );
+		void SetRenderTarget( DWORD index, IDirect3DSurface9* surface );
+		void SetDepthStencilSurface( IDirect3DSurface9* surface );
+		void Clear( DWORD flags, D3DCOLOR color, float z, DWORD stencil );
+		void DrawPrimitive( D3DPRIMITIVETYPE type, UINT startVertex, UINT primitiveCount );
+		void DrawIndexedPrimitive( D3DPRIMITIVETYPE type, INT baseVertexIndex, UINT minimumVertexIndex, UINT vertexCount, UINT startIndex, UINT primitiveCount );
+
+		int GetCommandCount() const { return m_CommandCount; }
+		size_t GetSizeInBytes() const { return m_Data.size() * sizeof( DWORD ); }
+
+		const std::vector<DWORD>& GetData() const { return m_Data; }
+
+	private:
+		NativeCommandBuffer( const NativeCommandBuffer& );
+		NativeCommandBuffer& operator = ( const NativeCommandBuffer& );
+
+		DWORD* Append( DWORD op, size_t argumentCount );
+		void AppendPointer( DWORD*& arguments, IUnknown* object );
+		void AppendConstants( DWORD op, UINT startRegister, const void* data, UINT count, size_t dwordsPerRegister );
+
+		std::vector<DWORD> m_Data;
+		std::vector<IUnknown*> m_References;
+		int m_CommandCount;
+	};
+
+	// Replays buffers in order on the device, skipping state commands that would set a value already known to be current.
+	// Nothing is assumed about the device state on entry. The number of skipped commands is added to each buffer's entry
+	// in skippedCounts; replay stops at the first failing call and returns its HRESULT.
+	HRESULT ExecuteCommandBuffers( IDirect3DDevice9* device, const NativeCommandBuffer* const* buffers, int bufferCount, int* skippedCounts );
+}
+}
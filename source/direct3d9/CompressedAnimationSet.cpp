@@ -61,9 +61,9 @@ namespace Direct3D9
 			keys[i].pCallbackData = callbackKeys[i].Data.ToPointer();
 		}
 
-		HRESULT hr = D3DXCreateCompressedAnimationSet( reinterpret_cast<LPCSTR>( pinnedName ), ticksPerSecond,
+		HRESULT hr = TIME_CALL( D3DXCreateCompressedAnimationSet( reinterpret_cast<LPCSTR>( pinnedName ), ticksPerSecond,
 			static_cast<D3DXPLAYBACK_TYPE>( playbackType ), compressedData->GetD3DBuffer(), count,
-			&keys[0], &pointer );
+			&keys[0], &pointer ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -76,7 +76,7 @@ namespace Direct3D9
 		int count = CallbackKeyCount;
 		stack_array<D3DXKEY_CALLBACK> keys = stackalloc( D3DXKEY_CALLBACK, count );
 
-		HRESULT hr = InternalPointer->GetCallbackKeys( &keys[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCallbackKeys( &keys[0] ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -92,7 +92,7 @@ namespace Direct3D9
 	{
 		LPD3DXBUFFER buffer;
 
-		HRESULT hr = InternalPointer->GetCompressedData( &buffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCompressedData( &buffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -87,7 +87,7 @@ namespace Direct3D9
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
 		unsigned int count = 1;
 
-		HRESULT hr = InternalPointer->GetConstantDesc( nativeHandle, &nativeDesc, &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConstantDesc( nativeHandle, &nativeDesc, &count ) );
 		GC::KeepAlive( handle );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return ConstantDescription();
@@ -101,13 +101,13 @@ namespace Direct3D9
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
 		unsigned int count = 0;
 
-		HRESULT hr = InternalPointer->GetConstantDesc( nativeHandle, NULL, &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConstantDesc( nativeHandle, NULL, &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
 		stack_array<D3DXCONSTANT_DESC> nativeDescArray = stackalloc( D3DXCONSTANT_DESC, count );
-		hr = InternalPointer->GetConstantDesc( nativeHandle, &nativeDescArray[0], &count );
+		hr = TIME_CALL( InternalPointer->GetConstantDesc( nativeHandle, &nativeDescArray[0], &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -137,7 +137,7 @@ namespace Direct3D9
 
 	Result ConstantTable::SetDefaults( Device^ device )
 	{
-		HRESULT hr = InternalPointer->SetDefaults( device->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDefaults( device->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -150,27 +150,27 @@ namespace Direct3D9
 		if( T::typeid == bool::typeid )
 		{
 			BOOL newValue = Convert::ToInt32( value, CultureInfo::InvariantCulture );
-			hr = InternalPointer->SetBool( device->InternalPointer, handle, newValue );
+			hr = TIME_CALL( InternalPointer->SetBool( device->InternalPointer, handle, newValue ) );
 		}
 		else if( T::typeid == float::typeid )
 		{
-			hr = InternalPointer->SetFloat( device->InternalPointer, handle, static_cast<FLOAT>( value ) );
+			hr = TIME_CALL( InternalPointer->SetFloat( device->InternalPointer, handle, static_cast<FLOAT>( value ) ) );
 		}
 		else if( T::typeid == int::typeid )
 		{
-			hr = InternalPointer->SetInt( device->InternalPointer, handle, static_cast<INT>( value ) );
+			hr = TIME_CALL( InternalPointer->SetInt( device->InternalPointer, handle, static_cast<INT>( value ) ) );
 		}
 		else if( T::typeid == Matrix::typeid )
 		{
-			hr = InternalPointer->SetMatrix( device->InternalPointer, handle, reinterpret_cast<D3DXMATRIX*>( &value ) );
+			hr = TIME_CALL( InternalPointer->SetMatrix( device->InternalPointer, handle, reinterpret_cast<D3DXMATRIX*>( &value ) ) );
 		}
 		else if( T::typeid == Vector4::typeid )
 		{
-			hr = InternalPointer->SetVector( device->InternalPointer, handle, reinterpret_cast<D3DXVECTOR4*>( &value ) );
+			hr = TIME_CALL( InternalPointer->SetVector( device->InternalPointer, handle, reinterpret_cast<D3DXVECTOR4*>( &value ) ) );
 		}
 		else
 		{
-			hr = InternalPointer->SetValue( device->InternalPointer, handle, &value, static_cast<DWORD>( sizeof(T) ) );
+			hr = TIME_CALL( InternalPointer->SetValue( device->InternalPointer, handle, &value, static_cast<DWORD>( sizeof(T) ) ) );
 		}
 
 		GC::KeepAlive( parameter );
@@ -188,32 +188,32 @@ namespace Direct3D9
 			array<BOOL>^ newValues = Array::ConvertAll<bool, int>( safe_cast<array<bool>>( values ), gcnew Converter<bool, int>( Convert::ToInt32 ) );
 			pin_ptr<BOOL> pinnedValues = &newValues[0];
 
-			hr = InternalPointer->SetBoolArray( device->InternalPointer, handle, pinnedValues, values->Length );
+			hr = TIME_CALL( InternalPointer->SetBoolArray( device->InternalPointer, handle, pinnedValues, values->Length ) );
 		}
 		else if( T::typeid == float::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetFloatArray( device->InternalPointer, handle, reinterpret_cast<FLOAT*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetFloatArray( device->InternalPointer, handle, reinterpret_cast<FLOAT*>( pinnedData ), values->Length ) );
 		}
 		else if( T::typeid == int::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetIntArray( device->InternalPointer, handle, reinterpret_cast<INT*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetIntArray( device->InternalPointer, handle, reinterpret_cast<INT*>( pinnedData ), values->Length ) );
 		}
 		else if( T::typeid == Matrix::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetMatrixArray( device->InternalPointer, handle, reinterpret_cast<D3DXMATRIX*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetMatrixArray( device->InternalPointer, handle, reinterpret_cast<D3DXMATRIX*>( pinnedData ), values->Length ) );
 		}
 		else if( T::typeid == Vector4::typeid )
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetVectorArray( device->InternalPointer, handle, reinterpret_cast<D3DXVECTOR4*>( pinnedData ), values->Length );
+			hr = TIME_CALL( InternalPointer->SetVectorArray( device->InternalPointer, handle, reinterpret_cast<D3DXVECTOR4*>( pinnedData ), values->Length ) );
 		}
 		else
 		{
 			pin_ptr<T> pinnedData = &values[0];
-			hr = InternalPointer->SetValue( device->InternalPointer, handle, pinnedData, static_cast<DWORD>( sizeof(T) ) * values->Length );
+			hr = TIME_CALL( InternalPointer->SetValue( device->InternalPointer, handle, pinnedData, static_cast<DWORD>( sizeof(T) ) * values->Length ) );
 		}
 
 		GC::KeepAlive( parameter );
@@ -225,7 +225,7 @@ namespace Direct3D9
 		D3DXCONSTANTTABLE_DESC nativeDesc;
 		ConstantTableDescription description;
 
-		HRESULT hr = InternalPointer->GetDesc( &nativeDesc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( &nativeDesc ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return ConstantTableDescription();
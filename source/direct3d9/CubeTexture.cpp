@@ -48,8 +48,8 @@ namespace Direct3D9
 	CubeTexture::CubeTexture( SlimDX::Direct3D9::Device^ device, int edgeLength, int numLevels, Usage usage, Format format, Pool pool )
 	{
 		IDirect3DCubeTexture9* texture = NULL;
-		HRESULT hr = device->InternalPointer->CreateCubeTexture( edgeLength, numLevels, static_cast<DWORD>( usage ),
-			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateCubeTexture( edgeLength, numLevels, static_cast<DWORD>( usage ),
+			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, NULL ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -63,8 +63,8 @@ namespace Direct3D9
 	{
 		IDirect3DCubeTexture9* texture = NULL;
 		HANDLE sharedHandleNative = NULL;
-		HRESULT hr = device->InternalPointer->CreateCubeTexture( edgeLength, numLevels, static_cast<DWORD>( usage ),
-			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateCubeTexture( edgeLength, numLevels, static_cast<DWORD>( usage ),
+			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -83,9 +83,9 @@ namespace Direct3D9
 		HRESULT hr;									// Error code.
 
 		// Get texture requirements.
-		hr = D3DXCheckCubeTextureRequirements(device->InternalPointer, reinterpret_cast<UINT*>( &size ), 
+		hr = TIME_CALL( D3DXCheckCubeTextureRequirements(device->InternalPointer, reinterpret_cast<UINT*>( &size ), 
 			reinterpret_cast<UINT*>( &numMipLevels ), static_cast<DWORD>( usage ),
-			reinterpret_cast<D3DFORMAT*>( &d3dFormat ), static_cast<D3DPOOL>( pool ) );
+			reinterpret_cast<D3DFORMAT*>( &d3dFormat ), static_cast<D3DPOOL>( pool ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return CubeTextureRequirements();
@@ -104,10 +104,10 @@ namespace Direct3D9
 	{
 		IDirect3DCubeTexture9* texture = NULL;
 
-		HRESULT hr = D3DXCreateCubeTextureFromFileInMemoryEx( device->InternalPointer, memory, sizeBytes, size, numLevels,
+		HRESULT hr = TIME_CALL( D3DXCreateCubeTextureFromFileInMemoryEx( device->InternalPointer, memory, sizeBytes, size, numLevels,
 			static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ),
 			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ), 
-			reinterpret_cast<PALETTEENTRY*>( palette ), &texture );
+			reinterpret_cast<PALETTEENTRY*>( palette ), &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 		{
@@ -260,9 +260,9 @@ namespace Direct3D9
 		palette = gcnew array<PaletteEntry>( 256 );
 		pin_ptr<PaletteEntry> pinnedPalette = &palette[0];
 
-		HRESULT hr = D3DXCreateCubeTextureFromFileEx( device->InternalPointer, pinnedName, size, 
+		HRESULT hr = TIME_CALL( D3DXCreateCubeTextureFromFileEx( device->InternalPointer, pinnedName, size, 
 			numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ), 
-			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), reinterpret_cast<PALETTEENTRY*>( pinnedPalette ), &texture );
+			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), reinterpret_cast<PALETTEENTRY*>( pinnedPalette ), &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 		{
@@ -284,9 +284,9 @@ namespace Direct3D9
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 		pin_ptr<ImageInformation> pinnedImageInfo = &imageInformation;
 
-		HRESULT hr = D3DXCreateCubeTextureFromFileEx( device->InternalPointer, pinnedName, size, 
+		HRESULT hr = TIME_CALL( D3DXCreateCubeTextureFromFileEx( device->InternalPointer, pinnedName, size, 
 			numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ), 
-			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), NULL, &texture );
+			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -303,9 +303,9 @@ namespace Direct3D9
 		IDirect3DCubeTexture9* texture = NULL;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXCreateCubeTextureFromFileEx( device->InternalPointer, pinnedName, size, 
+		HRESULT hr = TIME_CALL( D3DXCreateCubeTextureFromFileEx( device->InternalPointer, pinnedName, size, 
 			numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ), 
-			colorKey, NULL, NULL, &texture );
+			colorKey, NULL, NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -331,13 +331,13 @@ namespace Direct3D9
 	{
 		D3DLOCKED_RECT lockedRect;
 		RECT nativeRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
-		HRESULT hr = InternalPointer->LockRect( static_cast<D3DCUBEMAP_FACES>( face ), level, &lockedRect, &nativeRect, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockRect( static_cast<D3DCUBEMAP_FACES>( face ), level, &lockedRect, &nativeRect, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 		
 		D3DSURFACE_DESC desc;
-		hr = InternalPointer->GetLevelDesc(level, &desc);
+		hr = TIME_CALL( InternalPointer->GetLevelDesc(level, &desc) );
 		if (RECORD_D3D9(hr).IsFailure)
 			return nullptr;
 
@@ -353,13 +353,13 @@ namespace Direct3D9
 	DataRectangle^ CubeTexture::LockRectangle( CubeMapFace face, int level, LockFlags flags )
 	{
 		D3DLOCKED_RECT lockedRect;
-		HRESULT hr = InternalPointer->LockRect( static_cast<D3DCUBEMAP_FACES>( face ), level, &lockedRect, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockRect( static_cast<D3DCUBEMAP_FACES>( face ), level, &lockedRect, NULL, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 		
 		D3DSURFACE_DESC desc;
-		hr = InternalPointer->GetLevelDesc(level, &desc);
+		hr = TIME_CALL( InternalPointer->GetLevelDesc(level, &desc) );
 		if (RECORD_D3D9(hr).IsFailure)
 			return nullptr;
 
@@ -374,27 +374,27 @@ namespace Direct3D9
 
 	Result CubeTexture::UnlockRectangle( CubeMapFace face, int level )
 	{
-		HRESULT hr = InternalPointer->UnlockRect( static_cast<D3DCUBEMAP_FACES>( face ), level );
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockRect( static_cast<D3DCUBEMAP_FACES>( face ), level ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result CubeTexture::AddDirtyRectangle( CubeMapFace face )
 	{
-		HRESULT hr = InternalPointer->AddDirtyRect( static_cast<D3DCUBEMAP_FACES>( face ), NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDirtyRect( static_cast<D3DCUBEMAP_FACES>( face ), NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result CubeTexture::AddDirtyRectangle( CubeMapFace face, System::Drawing::Rectangle rect )
 	{
 		RECT nativeRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
-		HRESULT hr = InternalPointer->AddDirtyRect( static_cast<D3DCUBEMAP_FACES>( face ), &nativeRect );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDirtyRect( static_cast<D3DCUBEMAP_FACES>( face ), &nativeRect ) );
 		return RECORD_D3D9( hr );
 	}
 
 	SurfaceDescription CubeTexture::GetLevelDescription( int level )
 	{
 		SurfaceDescription description;
-		HRESULT hr = InternalPointer->GetLevelDesc( level, reinterpret_cast<D3DSURFACE_DESC*>( &description ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetLevelDesc( level, reinterpret_cast<D3DSURFACE_DESC*>( &description ) ) );
 		RECORD_D3D9( hr );
 		return description;
 	}
@@ -402,7 +402,7 @@ namespace Direct3D9
 	Surface^ CubeTexture::GetCubeMapSurface( CubeMapFace face, int level )
 	{
 		IDirect3DSurface9* surface;
-		HRESULT hr = InternalPointer->GetCubeMapSurface( static_cast<D3DCUBEMAP_FACES>( face ), level, &surface );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCubeMapSurface( static_cast<D3DCUBEMAP_FACES>( face ), level, &surface ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -414,14 +414,14 @@ namespace Direct3D9
 		HRESULT hr;		// Error code.
 
 		// Call the function.
-		hr = D3DXFillCubeTexture(InternalPointer, NativeD3DXFill3D, Marshal::GetFunctionPointerForDelegate(callback).ToPointer());
+		hr = TIME_CALL( D3DXFillCubeTexture(InternalPointer, NativeD3DXFill3D, Marshal::GetFunctionPointerForDelegate(callback).ToPointer()) );
 
 		return RECORD_D3D9(hr);
 	}
 
 	Result CubeTexture::Fill( TextureShader^ shader )
 	{
-		HRESULT hr = D3DXFillCubeTextureTX( InternalPointer, shader->InternalPointer );
+		HRESULT hr = TIME_CALL( D3DXFillCubeTextureTX( InternalPointer, shader->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 }
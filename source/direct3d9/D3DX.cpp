@@ -56,7 +56,7 @@ namespace Direct3D9
 	{
 		D3DVERTEXELEMENT9 elementBuffer[MAX_FVF_DECL_SIZE];
 
-		HRESULT hr = D3DXDeclaratorFromFVF( static_cast<DWORD>( fvf ), elementBuffer );
+		HRESULT hr = TIME_CALL( D3DXDeclaratorFromFVF( static_cast<DWORD>( fvf ), elementBuffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -77,7 +77,7 @@ namespace Direct3D9
 		DWORD result;
 		pin_ptr<VertexElement> pinnedDecl = &declarator[0];
 
-		HRESULT hr = D3DXFVFFromDeclarator( reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ), &result );
+		HRESULT hr = TIME_CALL( D3DXFVFFromDeclarator( reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ), &result ) );
 		RECORD_D3D9( hr );
 
 		return static_cast<VertexFormat>( result );
@@ -88,7 +88,7 @@ namespace Direct3D9
 		D3DVERTEXELEMENT9 elementBuffer[MAX_FVF_DECL_SIZE];
 		pin_ptr<VertexElement> pinnedDecl = &declaration[0];
 
-		HRESULT hr = D3DXGenerateOutputDecl( elementBuffer, reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ) );
+		HRESULT hr = TIME_CALL( D3DXGenerateOutputDecl( elementBuffer, reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -116,7 +116,7 @@ namespace Direct3D9
 		DWORD tris;
 		DWORD verts;
 
-		HRESULT hr = D3DXRectPatchSize( &segmentCount, &tris, &verts );
+		HRESULT hr = TIME_CALL( D3DXRectPatchSize( &segmentCount, &tris, &verts ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -129,7 +129,7 @@ namespace Direct3D9
 			vertexCount = verts;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result D3DX::GetTrianglePatchSize( float segmentCount, [Out] int% triangleCount, [Out] int% vertexCount )
@@ -137,7 +137,7 @@ namespace Direct3D9
 		DWORD tris;
 		DWORD verts;
 
-		HRESULT hr = D3DXTriPatchSize( &segmentCount, &tris, &verts );
+		HRESULT hr = TIME_CALL( D3DXTriPatchSize( &segmentCount, &tris, &verts ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -150,7 +150,7 @@ namespace Direct3D9
 			vertexCount = verts;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Format D3DX::MakeFourCC( Byte c1, Byte c2, Byte c3, Byte c4 )
@@ -171,8 +171,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedResults = &results[0];
 		pin_ptr<int> pinnedIndices = &indices[0];
 
-		HRESULT hr = D3DXOptimizeFaces( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
-			TRUE, reinterpret_cast<DWORD*>( pinnedResults ) );
+		HRESULT hr = TIME_CALL( D3DXOptimizeFaces( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
+			TRUE, reinterpret_cast<DWORD*>( pinnedResults ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -187,8 +187,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedResults = &results[0];
 		pin_ptr<Int16> pinnedIndices = &indices[0];
 
-		HRESULT hr = D3DXOptimizeFaces( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
-			FALSE, reinterpret_cast<DWORD*>( pinnedResults ) );
+		HRESULT hr = TIME_CALL( D3DXOptimizeFaces( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
+			FALSE, reinterpret_cast<DWORD*>( pinnedResults ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -203,8 +203,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedResults = &results[0];
 		pin_ptr<int> pinnedIndices = &indices[0];
 
-		HRESULT hr = D3DXOptimizeVertices( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
-			TRUE, reinterpret_cast<DWORD*>( pinnedResults ) );
+		HRESULT hr = TIME_CALL( D3DXOptimizeVertices( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
+			TRUE, reinterpret_cast<DWORD*>( pinnedResults ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -219,8 +219,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedResults = &results[0];
 		pin_ptr<Int16> pinnedIndices = &indices[0];
 
-		HRESULT hr = D3DXOptimizeVertices( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
-			FALSE, reinterpret_cast<DWORD*>( pinnedResults ) );
+		HRESULT hr = TIME_CALL( D3DXOptimizeVertices( reinterpret_cast<LPCVOID>( pinnedIndices ), faceCount, vertexCount,
+			FALSE, reinterpret_cast<DWORD*>( pinnedResults ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -64,12 +64,12 @@ namespace Direct3D9
 		for( int p = 0; p < presentParameters->Length; ++p )
 			d3dpp[p] = presentParameters[p]->ToUnmanaged();
 
-		HRESULT hr = direct3D->InternalPointer->CreateDevice( adapter,
+		HRESULT hr = TIME_CALL( direct3D->InternalPointer->CreateDevice( adapter,
 			static_cast<D3DDEVTYPE>( deviceType ),
 			static_cast<HWND>( controlHandle.ToPointer() ), 
 			static_cast<DWORD>( createFlags ),
 			reinterpret_cast<D3DPRESENT_PARAMETERS*>( &d3dpp[0] ),
-			&device );
+			&device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -87,14 +87,14 @@ namespace Direct3D9
 
 	void Device::VertexFormat::set( SlimDX::Direct3D9::VertexFormat value )
 	{
-		HRESULT hr = InternalPointer->SetFVF( static_cast<DWORD>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFVF( static_cast<DWORD>( value ) ) );
 		RECORD_D3D9( hr );
 	}
 
 	SlimDX::Direct3D9::VertexFormat Device::VertexFormat::get()
 	{
 		DWORD fvf = 0;
-		HRESULT hr = InternalPointer->GetFVF( &fvf );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFVF( &fvf ) );
 		RECORD_D3D9( hr );
 
 		return static_cast<SlimDX::Direct3D9::VertexFormat>( fvf );
@@ -104,9 +104,9 @@ namespace Direct3D9
 	{
 		HRESULT hr;
 		if( value != nullptr )
-			hr = InternalPointer->SetVertexDeclaration( value->InternalPointer );
+			hr = TIME_CALL( InternalPointer->SetVertexDeclaration( value->InternalPointer ) );
 		else
-			hr = InternalPointer->SetVertexDeclaration( NULL );
+			hr = TIME_CALL( InternalPointer->SetVertexDeclaration( NULL ) );
 
 		RECORD_D3D9( hr );
 	}
@@ -114,7 +114,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::VertexDeclaration^ Device::VertexDeclaration::get()
 	{
 		IDirect3DVertexDeclaration9* decl;
-		HRESULT hr = InternalPointer->GetVertexDeclaration( &decl );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexDeclaration( &decl ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -124,7 +124,7 @@ namespace Direct3D9
 
 	Result Device::DrawPrimitives( PrimitiveType primitiveType, int startIndex, int primitiveCount )
 	{
-		HRESULT hr = InternalPointer->DrawPrimitive( static_cast<D3DPRIMITIVETYPE>( primitiveType ), startIndex, primitiveCount );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawPrimitive( static_cast<D3DPRIMITIVETYPE>( primitiveType ), startIndex, primitiveCount ) );
 		return RECORD_D3D9( hr );
 	}
 	
@@ -143,8 +143,8 @@ namespace Direct3D9
 	{
 		pin_ptr<T> pinned_data = &data[startIndex];
 
-		HRESULT hr = InternalPointer->DrawPrimitiveUP( static_cast<D3DPRIMITIVETYPE>( primitiveType ), primitiveCount,
-			pinned_data, static_cast<DWORD>( sizeof(T) ) );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawPrimitiveUP( static_cast<D3DPRIMITIVETYPE>( primitiveType ), primitiveCount,
+			pinned_data, static_cast<DWORD>( sizeof(T) ) ) );
 		return RECORD_D3D9( hr );
 	}
 #pragma warning(default:4717)
@@ -152,8 +152,8 @@ namespace Direct3D9
 	Result Device::DrawIndexedPrimitives( PrimitiveType primitiveType, int baseVertexIndex, int minVertexIndex, 
 		int numVertices, int startIndex, int primCount )
 	{
-		HRESULT hr = InternalPointer->DrawIndexedPrimitive( static_cast<D3DPRIMITIVETYPE>( primitiveType ), baseVertexIndex,
-			minVertexIndex, numVertices, startIndex, primCount );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawIndexedPrimitive( static_cast<D3DPRIMITIVETYPE>( primitiveType ), baseVertexIndex,
+			minVertexIndex, numVertices, startIndex, primCount ) );
 		return RECORD_D3D9( hr );
 	}
 	
@@ -181,8 +181,8 @@ namespace Direct3D9
 		pin_ptr<S> pinnedIndices = &indexData[startIndex];
 		pin_ptr<T> pinnedVertices = &vertexData[startVertex];
 
-		HRESULT hr = InternalPointer->DrawIndexedPrimitiveUP( static_cast<D3DPRIMITIVETYPE>( primitiveType ), minVertexIndex, numVertices,
-			primitiveCount, pinnedIndices, static_cast<D3DFORMAT>( indexDataFormat ), pinnedVertices, vertexStride );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawIndexedPrimitiveUP( static_cast<D3DPRIMITIVETYPE>( primitiveType ), minVertexIndex, numVertices,
+			primitiveCount, pinnedIndices, static_cast<D3DFORMAT>( indexDataFormat ), pinnedVertices, vertexStride ) );
 		return RECORD_D3D9( hr );
 	}
 #pragma warning(default:4717)
@@ -211,7 +211,7 @@ namespace Direct3D9
 			rects[i] = rect;
 		}
 
-		HRESULT hr = InternalPointer->Clear( rectangles->Length, &rects[0], static_cast<DWORD>( clearFlags ), static_cast<D3DCOLOR>( color ), zdepth, stencil );
+		HRESULT hr = TIME_CALL( InternalPointer->Clear( rectangles->Length, &rects[0], static_cast<DWORD>( clearFlags ), static_cast<D3DCOLOR>( color ), zdepth, stencil ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -222,25 +222,25 @@ namespace Direct3D9
 
 	Result Device::Clear( ClearFlags clearFlags, int color, float zdepth, int stencil )
 	{
-		HRESULT hr = InternalPointer->Clear( 0, 0, static_cast<DWORD>( clearFlags ), static_cast<D3DCOLOR>( color ), zdepth, stencil );
+		HRESULT hr = TIME_CALL( InternalPointer->Clear( 0, 0, static_cast<DWORD>( clearFlags ), static_cast<D3DCOLOR>( color ), zdepth, stencil ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::BeginScene()
 	{
-		HRESULT hr = InternalPointer->BeginScene();
+		HRESULT hr = TIME_CALL( InternalPointer->BeginScene() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::EndScene()
 	{
-		HRESULT hr = InternalPointer->EndScene();
+		HRESULT hr = TIME_CALL( InternalPointer->EndScene() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::Present()
 	{
-		HRESULT hr = InternalPointer->Present( 0, 0, 0, 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( 0, 0, 0, 0 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -248,18 +248,16 @@ namespace Direct3D9
 	{
 		IDirect3DSwapChain9* swapChain;
 
-		HRESULT hr = InternalPointer->GetSwapChain( 0, &swapChain );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSwapChain( 0, &swapChain ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return Result::Last;
 
-		hr = swapChain->Present( 0, 0, 0, 0, static_cast<DWORD>( flags ) );
+		hr = TIME_CALL( swapChain->Present( 0, 0, 0, 0, static_cast<DWORD>( flags ) ) );
 		RECORD_D3D9( hr );
 
-		hr = swapChain->Release();
-		RECORD_D3D9( hr );
-
-		return Result::Last;
+		swapChain->Release();
+		return Result( hr );
 	}
 
 	Result Device::Present( System::Drawing::Rectangle sourceRectangle, System::Drawing::Rectangle destinationRectangle )
@@ -275,7 +273,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 
-		HRESULT hr = InternalPointer->Present( sourcePtr, destPtr, NULL, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( sourcePtr, destPtr, NULL, NULL ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -293,7 +291,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 
-		HRESULT hr = InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), NULL ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -317,7 +315,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), &nativeRegion );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), &nativeRegion ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -325,7 +323,7 @@ namespace Direct3D9
 	RasterStatus Device::GetRasterStatus( int swapChain )
 	{
 		D3DRASTER_STATUS status;
-		HRESULT hr = InternalPointer->GetRasterStatus( swapChain, &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRasterStatus( swapChain, &status ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return SlimDX::Direct3D9::RasterStatus();
@@ -338,21 +336,21 @@ namespace Direct3D9
 
 	Result Device::SetRenderState( RenderState state, int value )
 	{
-		HRESULT hr = InternalPointer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), value ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetRenderState( RenderState state, bool value )
 	{
 		BOOL boolValue = value ? TRUE : FALSE;
-		HRESULT hr = InternalPointer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), boolValue );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), boolValue ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetRenderState( RenderState state, float value )
 	{
 		DWORD* dwValue = reinterpret_cast<DWORD*>( &value );
-		HRESULT hr = InternalPointer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), *dwValue );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), *dwValue ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -364,7 +362,7 @@ namespace Direct3D9
 
 	Result Device::SetTextureStageState( int stage, TextureStage type, int value )
 	{
-		HRESULT hr = InternalPointer->SetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), value ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -391,14 +389,14 @@ namespace Direct3D9
 
 	Result Device::SetSamplerState( int sampler, SamplerState type, int value )
 	{
-		HRESULT hr = InternalPointer->SetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), value ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetSamplerState( int sampler, SamplerState type, float value )
 	{
 		DWORD* dwValue = reinterpret_cast<DWORD*>( &value );
-		HRESULT hr = InternalPointer->SetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), *dwValue );
+		HRESULT hr = TIME_CALL( InternalPointer->SetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), *dwValue ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -414,20 +412,20 @@ namespace Direct3D9
 
 	Result Device::SetTransform( TransformState state, Matrix* value )
 	{
-		HRESULT hr = InternalPointer->SetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<const D3DMATRIX*>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<const D3DMATRIX*>( value ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetTransform( TransformState state, Matrix value )
 	{
-		HRESULT hr = InternalPointer->SetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<const D3DMATRIX*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<const D3DMATRIX*>( &value ) ) );
 		return RECORD_D3D9( hr );
 	}
 	
 	Matrix Device::GetTransform( TransformState state )
 	{
 		Matrix result;
-		HRESULT hr = InternalPointer->GetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<D3DMATRIX*>( &result ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<D3DMATRIX*>( &result ) ) );
 		RECORD_D3D9( hr );
 		return result;
 	}
@@ -449,14 +447,14 @@ namespace Direct3D9
 
 	Result Device::MultiplyTransform( TransformState state, Matrix value )
 	{
-		HRESULT hr = InternalPointer->MultiplyTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<const D3DMATRIX*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->MultiplyTransform( static_cast<D3DTRANSFORMSTATETYPE>( state ), reinterpret_cast<const D3DMATRIX*>( &value ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetStreamSource( int stream, VertexBuffer^ streamData, int offsetInBytes, int stride )
 	{
 		IDirect3DVertexBuffer9* vbPointer = streamData != nullptr ? streamData->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->SetStreamSource( stream, vbPointer, offsetInBytes, stride );
+		HRESULT hr = TIME_CALL( InternalPointer->SetStreamSource( stream, vbPointer, offsetInBytes, stride ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -468,13 +466,13 @@ namespace Direct3D9
 		else
 			value = D3DSTREAMSOURCE_INSTANCEDATA;
 
-		HRESULT hr = InternalPointer->SetStreamSourceFreq( stream, value | frequency );
+		HRESULT hr = TIME_CALL( InternalPointer->SetStreamSourceFreq( stream, value | frequency ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::ResetStreamSourceFrequency( int stream )
 	{
-		HRESULT hr = InternalPointer->SetStreamSourceFreq( stream, 1 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetStreamSourceFreq( stream, 1 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -482,7 +480,7 @@ namespace Direct3D9
 	{
 		SlimDX::Direct3D9::Material material;
 
-		HRESULT hr = InternalPointer->GetMaterial( reinterpret_cast<D3DMATERIAL9*>( &material ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMaterial( reinterpret_cast<D3DMATERIAL9*>( &material ) ) );
 		RECORD_D3D9( hr );
 
 		return material;
@@ -490,13 +488,13 @@ namespace Direct3D9
 
 	void Device::Material::set( SlimDX::Direct3D9::Material material )
 	{
-		HRESULT hr = InternalPointer->SetMaterial( reinterpret_cast<const D3DMATERIAL9*>( &material ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMaterial( reinterpret_cast<const D3DMATERIAL9*>( &material ) ) );
 		RECORD_D3D9( hr );
 	}
 
 	Result Device::TestCooperativeLevel()
 	{
-		HRESULT hr = InternalPointer->TestCooperativeLevel();
+		HRESULT hr = TIME_CALL( InternalPointer->TestCooperativeLevel() );
 		return Result( hr );
 	}
 
@@ -506,7 +504,7 @@ namespace Direct3D9
 		for( int p = 0; p < presentParameters->Length; ++p )
 			d3dpp[p] = presentParameters[p]->ToUnmanaged();
 
-		HRESULT hr = InternalPointer->Reset( &d3dpp[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->Reset( &d3dpp[0] ) );
 		RECORD_D3D9( hr );
 
 		for( int p = 0; p < presentParameters->Length; ++p )
@@ -517,20 +515,20 @@ namespace Direct3D9
 			presentParameters[p]->BackBufferHeight = d3dpp[p].BackBufferHeight;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Device::SetTexture( int sampler, BaseTexture^ texture )
 	{
 		IDirect3DBaseTexture9* texturePointer = texture != nullptr ? texture->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->SetTexture( sampler, texturePointer );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTexture( sampler, texturePointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	BaseTexture^ Device::GetTexture( int stage )
 	{
 		IDirect3DBaseTexture9 *texture;
-		HRESULT hr = InternalPointer->GetTexture( stage, &texture );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTexture( stage, &texture ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -540,28 +538,28 @@ namespace Direct3D9
 	Result Device::SetRenderTarget( int rtIndex, Surface^ target )
 	{
 		IDirect3DSurface9* surfacePointer = target != nullptr ? target->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->SetRenderTarget( rtIndex, surfacePointer );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRenderTarget( rtIndex, surfacePointer ) );
 		return RECORD_D3D9( hr );
 	}
 	
 	void Device::PixelShader::set( SlimDX::Direct3D9::PixelShader^ shader )
 	{
 		IDirect3DPixelShader9 *ptr = shader != nullptr ? shader->InternalPointer : NULL; 
-		HRESULT hr = InternalPointer->SetPixelShader( ptr );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShader( ptr ) );
 		RECORD_D3D9( hr );
 	}
 	
 	void Device::VertexShader::set( SlimDX::Direct3D9::VertexShader^ shader )
 	{
 		IDirect3DVertexShader9 *ptr = shader != nullptr ? shader->InternalPointer : NULL; 
-		HRESULT hr = InternalPointer->SetVertexShader( ptr );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShader( ptr ) );
 		RECORD_D3D9( hr );
 	}
 	
 	void Device::DepthStencilSurface::set( Surface^ target )
 	{	
 		IDirect3DSurface9* surface = target != nullptr ? target->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->SetDepthStencilSurface( surface );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDepthStencilSurface( surface ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -569,7 +567,7 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* buffer;
 
-		HRESULT hr = InternalPointer->GetBackBuffer( swapChain, backBuffer, D3DBACKBUFFER_TYPE_MONO, &buffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetBackBuffer( swapChain, backBuffer, D3DBACKBUFFER_TYPE_MONO, &buffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -579,7 +577,7 @@ namespace Direct3D9
 
 	bool Device::IsQuerySupported( QueryType type )
 	{
-		HRESULT hr = InternalPointer->CreateQuery( static_cast<D3DQUERYTYPE>( type ), NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateQuery( static_cast<D3DQUERYTYPE>( type ), NULL ) );
 		if( hr == D3DERR_NOTAVAILABLE )
 			return false;
 		
@@ -592,7 +590,7 @@ namespace Direct3D9
 	Capabilities^ Device::Capabilities::get()
 	{
 		D3DCAPS9 caps;
-		HRESULT hr = InternalPointer->GetDeviceCaps( &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceCaps( &caps ) );
 		RECORD_D3D9( hr );
 
 		return gcnew SlimDX::Direct3D9::Capabilities( caps );
@@ -607,7 +605,7 @@ namespace Direct3D9
 	{
 		DWORD passCount = 0;
 
-		HRESULT hr = InternalPointer->ValidateDevice( &passCount );
+		HRESULT hr = TIME_CALL( InternalPointer->ValidateDevice( &passCount ) );
 		RECORD_D3D9( hr );
 
 		return passCount;
@@ -633,7 +631,7 @@ namespace Direct3D9
 
 	void Device::SoftwareVertexProcessing::set( bool value )
 	{
-		HRESULT hr = InternalPointer->SetSoftwareVertexProcessing( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetSoftwareVertexProcessing( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -641,7 +639,7 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface;
 
-		HRESULT hr = InternalPointer->GetDepthStencilSurface( &surface );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDepthStencilSurface( &surface ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -652,7 +650,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::Viewport Device::Viewport::get()
 	{
 		SlimDX::Direct3D9::Viewport viewport;
-		HRESULT hr = InternalPointer->GetViewport( reinterpret_cast<D3DVIEWPORT9*>( &viewport ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetViewport( reinterpret_cast<D3DVIEWPORT9*>( &viewport ) ) );
 		RECORD_D3D9( hr );
 
 		return viewport;
@@ -660,14 +658,14 @@ namespace Direct3D9
 
 	void Device::Viewport::set( SlimDX::Direct3D9::Viewport value )
 	{
-		HRESULT hr = InternalPointer->SetViewport( reinterpret_cast<const D3DVIEWPORT9*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetViewport( reinterpret_cast<const D3DVIEWPORT9*>( &value ) ) );
 		RECORD_D3D9( hr );
 	}
 
 	void Device::ScissorRect::set(Drawing::Rectangle rect)
 	{
 		RECT scissorRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
-		HRESULT hr = InternalPointer->SetScissorRect(&scissorRect);
+		HRESULT hr = TIME_CALL( InternalPointer->SetScissorRect(&scissorRect) );
 		RECORD_D3D9(hr);
 	}
 
@@ -675,7 +673,7 @@ namespace Direct3D9
 	{
 		RECT scissorRect;		// Scissor rectangle.
 
-		HRESULT hr = InternalPointer->GetScissorRect(&scissorRect);
+		HRESULT hr = TIME_CALL( InternalPointer->GetScissorRect(&scissorRect) );
 		RECORD_D3D9(hr);
 
 		return Utilities::ConvertRect(scissorRect);
@@ -685,7 +683,7 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface;
 
-		HRESULT hr = InternalPointer->GetRenderTarget( index, &surface );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRenderTarget( index, &surface ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -697,7 +695,7 @@ namespace Direct3D9
 	T Device::GetRenderState( RenderState state )
 	{
 		DWORD value = 0;
-		HRESULT hr = InternalPointer->GetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), &value );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), &value ) );
 		RECORD_D3D9( hr );
 
 		return Utilities::FromIntToT<T>( value );
@@ -706,7 +704,7 @@ namespace Direct3D9
 	int Device::GetRenderState( RenderState state )
 	{
 		DWORD value = 0;
-		HRESULT hr = InternalPointer->GetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), &value );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRenderState( static_cast<D3DRENDERSTATETYPE>( state ), &value ) );
 		RECORD_D3D9( hr );
 
 		return value;
@@ -716,7 +714,7 @@ namespace Direct3D9
 	T Device::GetSamplerState( int sampler, SamplerState type )
 	{
 		DWORD value = 0;
-		HRESULT hr = InternalPointer->GetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), &value );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), &value ) );
 		RECORD_D3D9( hr );
 
 		return Utilities::FromIntToT<T>( value );
@@ -725,7 +723,7 @@ namespace Direct3D9
 	int Device::GetSamplerState( int sampler, SamplerState type )
 	{
 		DWORD value = 0;
-		HRESULT hr = InternalPointer->GetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), &value );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSamplerState( sampler, static_cast<D3DSAMPLERSTATETYPE>( type ), &value ) );
 		RECORD_D3D9( hr );
 
 		return value;
@@ -735,7 +733,7 @@ namespace Direct3D9
 	T Device::GetTextureStageState( int stage, TextureStage type )
 	{
 		DWORD value = 0;
-		HRESULT hr = InternalPointer->GetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), &value );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), &value ) );
 		RECORD_D3D9( hr );
 
 		return Utilities::FromIntToT<T>( value );
@@ -744,7 +742,7 @@ namespace Direct3D9
 	int Device::GetTextureStageState( int stage, TextureStage type )
 	{
 		DWORD value = 0;
-		HRESULT hr = InternalPointer->GetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), &value );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTextureStageState( stage, static_cast<D3DTEXTURESTAGESTATETYPE>( type ), &value ) );
 		RECORD_D3D9( hr );
 
 		return value;
@@ -755,7 +753,7 @@ namespace Direct3D9
 		array<PaletteEntry>^ result = gcnew array<PaletteEntry>( 256 );
 		pin_ptr<PaletteEntry> pinnedResult = &result[0];
 
-		HRESULT hr = InternalPointer->GetPaletteEntries( paletteNumber, reinterpret_cast<PALETTEENTRY*>( pinnedResult ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPaletteEntries( paletteNumber, reinterpret_cast<PALETTEENTRY*>( pinnedResult ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -770,7 +768,7 @@ namespace Direct3D9
 
 		pin_ptr<PaletteEntry> pinnedEntries = entries == nullptr ? nullptr : &entries[0];
 
-		HRESULT hr = InternalPointer->SetPaletteEntries( paletteNumber, reinterpret_cast<PALETTEENTRY*>( pinnedEntries ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPaletteEntries( paletteNumber, reinterpret_cast<PALETTEENTRY*>( pinnedEntries ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -799,7 +797,7 @@ namespace Direct3D9
 		IDirect3DVertexBuffer9* localVb;
 		UINT localOffset, localStride;
 
-		HRESULT hr = InternalPointer->GetStreamSource( stream, &localVb, &localOffset, &localStride );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStreamSource( stream, &localVb, &localOffset, &localStride ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -813,7 +811,7 @@ namespace Direct3D9
 		offsetBytes = localOffset;
 		stride = localStride;
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Device::GetStreamSourceFrequency( int stream, [Out] int% frequency, [Out] StreamSource% source )
@@ -824,7 +822,7 @@ namespace Direct3D9
 		frequency = 0;
 		source = StreamSource::IndexedData;
 
-		HRESULT hr = InternalPointer->GetStreamSourceFreq( stream, &localFreq );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStreamSourceFreq( stream, &localFreq ) );
 		RECORD_D3D9( hr );
 
 		//default setting was indexed data, so just check if it's actually instance data
@@ -838,14 +836,14 @@ namespace Direct3D9
 		localFreq &= mask;
 		frequency = localFreq;
 		
-		return Result::Last;
+		return Result( hr );
 	}
 
 	SwapChain^ Device::GetSwapChain( int swapChainIndex )
 	{
 		IDirect3DSwapChain9* swapChain;
 
-		HRESULT hr = InternalPointer->GetSwapChain( swapChainIndex, &swapChain );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSwapChain( swapChainIndex, &swapChain ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -857,7 +855,7 @@ namespace Direct3D9
 	{
 		IDirect3DIndexBuffer9* indices;
 
-		HRESULT hr = InternalPointer->GetIndices( &indices );
+		HRESULT hr = TIME_CALL( InternalPointer->GetIndices( &indices ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -869,9 +867,9 @@ namespace Direct3D9
 	{
 		HRESULT hr;
 		if( indices != nullptr )
-			hr = InternalPointer->SetIndices( indices->InternalPointer );
+			hr = TIME_CALL( InternalPointer->SetIndices( indices->InternalPointer ) );
 		else
-			hr = InternalPointer->SetIndices( NULL );
+			hr = TIME_CALL( InternalPointer->SetIndices( NULL ) );
 
 		RECORD_D3D9( hr );
 	}
@@ -882,7 +880,7 @@ namespace Direct3D9
 		IDirect3DVertexBuffer9* vb = destinationBuffer->InternalPointer;
 		IDirect3DVertexDeclaration9* decl = vertexDeclaration != nullptr ? vertexDeclaration->InternalPointer : NULL;
 
-		HRESULT hr = InternalPointer->ProcessVertices( sourceStartIndex, destinationIndex, vertexCount, vb, decl, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->ProcessVertices( sourceStartIndex, destinationIndex, vertexCount, vb, decl, static_cast<DWORD>( flags ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -890,7 +888,7 @@ namespace Direct3D9
 	{
 		stack_array<BOOL> booleans = stackalloc( BOOL, count );
 
-		HRESULT hr = InternalPointer->GetVertexShaderConstantB( startRegister, &booleans[0], count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexShaderConstantB( startRegister, &booleans[0], count ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -905,7 +903,7 @@ namespace Direct3D9
 	{
 		stack_array<FLOAT> floats = stackalloc( FLOAT, count );
 
-		HRESULT hr = InternalPointer->GetVertexShaderConstantF( startRegister, &floats[0], count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexShaderConstantF( startRegister, &floats[0], count ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -920,7 +918,7 @@ namespace Direct3D9
 	{
 		stack_array<INT> integers = stackalloc( INT, count );
 
-		HRESULT hr = InternalPointer->GetVertexShaderConstantI( startRegister, &integers[0], count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexShaderConstantI( startRegister, &integers[0], count ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -935,7 +933,7 @@ namespace Direct3D9
 	{
 		stack_array<BOOL> booleans = stackalloc( BOOL, count );
 
-		HRESULT hr = InternalPointer->GetPixelShaderConstantB( startRegister, &booleans[0], count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPixelShaderConstantB( startRegister, &booleans[0], count ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -950,7 +948,7 @@ namespace Direct3D9
 	{
 		stack_array<FLOAT> floats = stackalloc( FLOAT, count );
 
-		HRESULT hr = InternalPointer->GetPixelShaderConstantF( startRegister, &floats[0], count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPixelShaderConstantF( startRegister, &floats[0], count ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -965,7 +963,7 @@ namespace Direct3D9
 	{
 		stack_array<INT> integers = stackalloc( INT, count );
 
-		HRESULT hr = InternalPointer->GetPixelShaderConstantI( startRegister, &integers[0], count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPixelShaderConstantI( startRegister, &integers[0], count ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -984,7 +982,7 @@ namespace Direct3D9
 		pin_ptr<BOOL> pinnedData = &boolData[0];
 
 		Utilities::CheckArrayBounds( data, offset, count );
-		HRESULT hr = InternalPointer->SetVertexShaderConstantB( startRegister, pinnedData + offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantB( startRegister, pinnedData + offset, count ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -993,7 +991,7 @@ namespace Direct3D9
 		pin_ptr<float> pinnedData = &data[0];
 
 		Utilities::CheckArrayBounds( data, offset, count * 4 );
-		HRESULT hr = InternalPointer->SetVertexShaderConstantF( startRegister, pinnedData + offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantF( startRegister, pinnedData + offset, count ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1003,7 +1001,7 @@ namespace Direct3D9
 		float* pinnedDataPointer = reinterpret_cast<float*>( pinnedData + offset );
 
 		Utilities::CheckArrayBounds( data, offset, count );
-		HRESULT hr = InternalPointer->SetVertexShaderConstantF( startRegister, pinnedDataPointer, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantF( startRegister, pinnedDataPointer, count ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1012,19 +1010,19 @@ namespace Direct3D9
 		pin_ptr<int> pinnedData = &data[0];
 
 		Utilities::CheckArrayBounds( data, offset, count * 4 );
-		HRESULT hr = InternalPointer->SetVertexShaderConstantI( startRegister, pinnedData + offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantI( startRegister, pinnedData + offset, count ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetVertexShaderConstant( int startRegister, Matrix data )
 	{
-		HRESULT hr = InternalPointer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( &data ), 4 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( &data ), 4 ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetVertexShaderConstant( int startRegister, Matrix* data, int count )
 	{
-		HRESULT hr = InternalPointer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( data ), count * 4 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( data ), count * 4 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1033,7 +1031,7 @@ namespace Direct3D9
 		pin_ptr<Matrix> pinnedData = &data[0];
 
 		Utilities::CheckBounds( 0, data->Length, offset, count );
-		HRESULT hr = InternalPointer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData + offset ), count * 4 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVertexShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData + offset ), count * 4 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1043,7 +1041,7 @@ namespace Direct3D9
 		pin_ptr<BOOL> pinnedData = &boolData[0];
 
 		Utilities::CheckArrayBounds( data, offset, count );
-		HRESULT hr = InternalPointer->SetPixelShaderConstantB( startRegister, pinnedData + offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantB( startRegister, pinnedData + offset, count ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1052,7 +1050,7 @@ namespace Direct3D9
 		pin_ptr<float> pinnedData = &data[0];
 
 		Utilities::CheckArrayBounds( data, offset, count * 4 );
-		HRESULT hr = InternalPointer->SetPixelShaderConstantF( startRegister, pinnedData + offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantF( startRegister, pinnedData + offset, count ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1062,7 +1060,7 @@ namespace Direct3D9
 		float* pinnedDataPointer = reinterpret_cast<float*>( pinnedData + offset );
 
 		Utilities::CheckArrayBounds( data, offset, count );
-		HRESULT hr = InternalPointer->SetPixelShaderConstantF( startRegister, pinnedDataPointer, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantF( startRegister, pinnedDataPointer, count ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1071,19 +1069,19 @@ namespace Direct3D9
 		pin_ptr<int> pinnedData = &data[0];
 
 		Utilities::CheckArrayBounds( data, offset, count * 4 );
-		HRESULT hr = InternalPointer->SetPixelShaderConstantI( startRegister, pinnedData + offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantI( startRegister, pinnedData + offset, count ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetPixelShaderConstant( int startRegister, Matrix data )
 	{
-		HRESULT hr = InternalPointer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( &data ), 4 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( &data ), 4 ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetPixelShaderConstant( int startRegister, Matrix* data, int count )
 	{
-		HRESULT hr = InternalPointer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( data ), count * 4 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( data ), count * 4 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1092,7 +1090,7 @@ namespace Direct3D9
 		pin_ptr<Matrix> pinnedData = &data[0];
 
 		Utilities::CheckBounds( 0, data->Length, offset, count );
-		HRESULT hr = InternalPointer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData + offset ), count * 4 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPixelShaderConstantF( startRegister, reinterpret_cast<float*>( pinnedData + offset ), count * 4 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1102,15 +1100,15 @@ namespace Direct3D9
 		RECT nativeSourceRect = { sourceRect.Left, sourceRect.Top, sourceRect.Right, sourceRect.Bottom };
 		RECT nativeDestRect = { destRect.Left, destRect.Top, destRect.Right, destRect.Bottom };
 
-		HRESULT hr = InternalPointer->StretchRect( source->InternalPointer, &nativeSourceRect, destination->InternalPointer,
-			&nativeDestRect, static_cast<D3DTEXTUREFILTERTYPE>( filter ) );
+		HRESULT hr = TIME_CALL( InternalPointer->StretchRect( source->InternalPointer, &nativeSourceRect, destination->InternalPointer,
+			&nativeDestRect, static_cast<D3DTEXTUREFILTERTYPE>( filter ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::StretchRectangle( Surface^ source, Surface^ destination, TextureFilter filter )
 	{
-		HRESULT hr = InternalPointer->StretchRect( source->InternalPointer, NULL, destination->InternalPointer,
-			NULL, static_cast<D3DTEXTUREFILTERTYPE>( filter ) );
+		HRESULT hr = TIME_CALL( InternalPointer->StretchRect( source->InternalPointer, NULL, destination->InternalPointer,
+			NULL, static_cast<D3DTEXTUREFILTERTYPE>( filter ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1120,20 +1118,20 @@ namespace Direct3D9
 		RECT nativeSourceRect = { sourceRect.Left, sourceRect.Top, sourceRect.Right, sourceRect.Bottom };
 		POINT nativeDestPoint = { destinationPoint.X, destinationPoint.Y };
 
-		HRESULT hr = InternalPointer->UpdateSurface( source->InternalPointer, &nativeSourceRect,
-			destination->InternalPointer, &nativeDestPoint );
+		HRESULT hr = TIME_CALL( InternalPointer->UpdateSurface( source->InternalPointer, &nativeSourceRect,
+			destination->InternalPointer, &nativeDestPoint ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::UpdateSurface( Surface^ source, Surface^ destination )
 	{
-		HRESULT hr = InternalPointer->UpdateSurface( source->InternalPointer, NULL, destination->InternalPointer, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->UpdateSurface( source->InternalPointer, NULL, destination->InternalPointer, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::UpdateTexture( BaseTexture^ sourceTexture, BaseTexture^ destinationTexture )
 	{
-		HRESULT hr = InternalPointer->UpdateTexture( sourceTexture->InternalPointer, destinationTexture->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->UpdateTexture( sourceTexture->InternalPointer, destinationTexture->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1141,26 +1139,26 @@ namespace Direct3D9
 	{
 		RECT nativeDestRect = { destRect.Left, destRect.Top, destRect.Right, destRect.Bottom };
 
-		HRESULT hr = InternalPointer->ColorFill( destSurface->InternalPointer, &nativeDestRect, static_cast<D3DCOLOR>( color.ToArgb() ) );
+		HRESULT hr = TIME_CALL( InternalPointer->ColorFill( destSurface->InternalPointer, &nativeDestRect, static_cast<D3DCOLOR>( color.ToArgb() ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::ColorFill( Surface^ destSurface, Color4 color )
 	{
-		HRESULT hr = InternalPointer->ColorFill( destSurface->InternalPointer, NULL, static_cast<D3DCOLOR>( color.ToArgb() ) );
+		HRESULT hr = TIME_CALL( InternalPointer->ColorFill( destSurface->InternalPointer, NULL, static_cast<D3DCOLOR>( color.ToArgb() ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::BeginStateBlock()
 	{
-		HRESULT hr = InternalPointer->BeginStateBlock();
+		HRESULT hr = TIME_CALL( InternalPointer->BeginStateBlock() );
 		return RECORD_D3D9( hr );
 	}
 
 	StateBlock^ Device::EndStateBlock()
 	{
 		IDirect3DStateBlock9* stateBlock;
-		HRESULT hr = InternalPointer->EndStateBlock( &stateBlock );
+		HRESULT hr = TIME_CALL( InternalPointer->EndStateBlock( &stateBlock ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -1173,7 +1171,7 @@ namespace Direct3D9
 		SlimDX::Direct3D9::CreationParameters parameters;
 		D3DDEVICE_CREATION_PARAMETERS dcp;
 
-		HRESULT hr = InternalPointer->GetCreationParameters( &dcp );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCreationParameters( &dcp ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return SlimDX::Direct3D9::CreationParameters();
 
@@ -1189,7 +1187,7 @@ namespace Direct3D9
 	{
 		D3DCLIPSTATUS9 status;
 
-		HRESULT hr = InternalPointer->GetClipStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetClipStatus( &status ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return SlimDX::Direct3D9::ClipStatus();
 
@@ -1202,7 +1200,7 @@ namespace Direct3D9
 
 	void Device::ClipStatus::set( SlimDX::Direct3D9::ClipStatus value )
 	{
-		HRESULT hr = InternalPointer->SetClipStatus( reinterpret_cast<const D3DCLIPSTATUS9*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetClipStatus( reinterpret_cast<const D3DCLIPSTATUS9*>( &value ) ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -1218,7 +1216,7 @@ namespace Direct3D9
 
 	void Device::NPatchMode::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetNPatchMode( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetNPatchMode( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -1226,7 +1224,7 @@ namespace Direct3D9
 	{
 		pin_ptr<float> pinnedSegments = &numSegments[0];
 
-		HRESULT hr = InternalPointer->DrawTriPatch( handle, pinnedSegments, reinterpret_cast<D3DTRIPATCH_INFO*>( &info ) );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawTriPatch( handle, pinnedSegments, reinterpret_cast<D3DTRIPATCH_INFO*>( &info ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1234,7 +1232,7 @@ namespace Direct3D9
 	{
 		pin_ptr<float> pinnedSegments = &numSegments[0];
 
-		HRESULT hr = InternalPointer->DrawTriPatch( handle, pinnedSegments, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawTriPatch( handle, pinnedSegments, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1242,7 +1240,7 @@ namespace Direct3D9
 	{
 		pin_ptr<float> pinnedSegments = &numSegments[0];
 
-		HRESULT hr = InternalPointer->DrawRectPatch( handle, pinnedSegments, reinterpret_cast<D3DRECTPATCH_INFO*>( &info ) );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawRectPatch( handle, pinnedSegments, reinterpret_cast<D3DRECTPATCH_INFO*>( &info ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1250,13 +1248,13 @@ namespace Direct3D9
 	{
 		pin_ptr<float> pinnedSegments = &numSegments[0];
 
-		HRESULT hr = InternalPointer->DrawRectPatch( handle, pinnedSegments, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawRectPatch( handle, pinnedSegments, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::DeletePatch( int handle )
 	{
-		HRESULT hr = InternalPointer->DeletePatch( handle );
+		HRESULT hr = TIME_CALL( InternalPointer->DeletePatch( handle ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1264,7 +1262,7 @@ namespace Direct3D9
 	{
 		DisplayMode displayMode;
 
-		HRESULT hr = InternalPointer->GetDisplayMode( swapChain, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplayMode( swapChain, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) ) );
 		RECORD_D3D9( hr );
 		
 		return displayMode;
@@ -1272,26 +1270,26 @@ namespace Direct3D9
 
 	Result Device::EvictManagedResources()
 	{
-		HRESULT hr = InternalPointer->EvictManagedResources();
+		HRESULT hr = TIME_CALL( InternalPointer->EvictManagedResources() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::SetDialogBoxMode( bool enableDialogs )
 	{
-		HRESULT hr = InternalPointer->SetDialogBoxMode( enableDialogs );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDialogBoxMode( enableDialogs ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Device::EnableLight( int lightIndex, bool enable )
 	{
-		HRESULT hr = InternalPointer->LightEnable( lightIndex, enable );
+		HRESULT hr = TIME_CALL( InternalPointer->LightEnable( lightIndex, enable ) );
 		return RECORD_D3D9( hr );
 	}
 
 	bool Device::IsLightEnabled( int lightIndex )
 	{
 		BOOL enabled = FALSE;
-		HRESULT hr = InternalPointer->GetLightEnable( lightIndex, &enabled );
+		HRESULT hr = TIME_CALL( InternalPointer->GetLightEnable( lightIndex, &enabled ) );
 		RECORD_D3D9( hr );
 
 		return enabled > 0;
@@ -1299,14 +1297,14 @@ namespace Direct3D9
 
 	Result Device::SetLight( int lightIndex, Light lightData )
 	{
-		HRESULT hr = InternalPointer->SetLight( lightIndex, reinterpret_cast<const D3DLIGHT9*>( &lightData ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetLight( lightIndex, reinterpret_cast<const D3DLIGHT9*>( &lightData ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Light Device::GetLight( int lightIndex )
 	{
 		Light light;
-		HRESULT hr = InternalPointer->GetLight( lightIndex, reinterpret_cast<D3DLIGHT9*>( &light ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetLight( lightIndex, reinterpret_cast<D3DLIGHT9*>( &light ) ) );
 		RECORD_D3D9( hr );
 		
 		return light;
@@ -1459,7 +1457,7 @@ namespace Direct3D9
 
 		cursorSurface->UnlockRect();
 
-		hr = InternalPointer->SetCursorProperties( iconInfo.xHotspot, iconInfo.yHotspot, cursorSurface );
+		hr = TIME_CALL( InternalPointer->SetCursorProperties( iconInfo.xHotspot, iconInfo.yHotspot, cursorSurface ) );
 
 		if( iconInfo.hbmMask != NULL )
 			DeleteObject( iconInfo.hbmMask );
@@ -1485,20 +1483,20 @@ namespace Direct3D9
 	Result Device::SetCursorProperties( int hotspotX, int hotspotY, Surface^ cursorBitmap )
 	{
 		IDirect3DSurface9* surface = cursorBitmap != nullptr ? cursorBitmap->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->SetCursorProperties( hotspotX, hotspotY, surface );
+		HRESULT hr = TIME_CALL( InternalPointer->SetCursorProperties( hotspotX, hotspotY, surface ) );
 		return RECORD_D3D9( hr );
 	}
 
 	void Device::CurrentTexturePalette::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetCurrentTexturePalette( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetCurrentTexturePalette( value ) );
 		RECORD_D3D9( hr );
 	}
 
 	int Device::CurrentTexturePalette::get()
 	{
 		unsigned int palette = 0;
-		HRESULT hr = InternalPointer->GetCurrentTexturePalette( &palette );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentTexturePalette( &palette ) );
 		RECORD_D3D9( hr );
 
 		return static_cast<int>( palette );
@@ -1507,7 +1505,7 @@ namespace Direct3D9
 	VertexShader^ Device::VertexShader::get()
 	{
 		IDirect3DVertexShader9* vs;
-		HRESULT hr = InternalPointer->GetVertexShader( &vs );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexShader( &vs ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -1518,7 +1516,7 @@ namespace Direct3D9
 	PixelShader^ Device::PixelShader::get()
 	{
 		IDirect3DPixelShader9* ps;
-		HRESULT hr = InternalPointer->GetPixelShader( &ps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPixelShader( &ps ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -1572,14 +1570,14 @@ namespace Direct3D9
 
 	Result Device::SetClipPlane( int index, Plane clipPlane )
 	{
-		HRESULT hr = InternalPointer->SetClipPlane( index, reinterpret_cast<const float*>( &clipPlane ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetClipPlane( index, reinterpret_cast<const float*>( &clipPlane ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Plane Device::GetClipPlane( int index )
 	{
 		Plane plane;
-		HRESULT hr = InternalPointer->GetClipPlane( index, reinterpret_cast<float*>( &plane ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetClipPlane( index, reinterpret_cast<float*>( &plane ) ) );
 		RECORD_D3D9( hr );
 
 		return plane;
@@ -1588,7 +1586,7 @@ namespace Direct3D9
 	Result Device::GetFrontBufferData( int swapChain, Surface^ destinationSurface )
 	{
 		IDirect3DSurface9* surface = destinationSurface != nullptr ? destinationSurface->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->GetFrontBufferData( swapChain, surface );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFrontBufferData( swapChain, surface ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1596,7 +1594,7 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* target = renderTarget != nullptr	? renderTarget->InternalPointer : NULL;
 		IDirect3DSurface9* destination = destinationSurface != nullptr ? destinationSurface->InternalPointer : NULL;
-		HRESULT hr = InternalPointer->GetRenderTargetData( target, destination );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRenderTargetData( target, destination ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -1604,7 +1602,7 @@ namespace Direct3D9
 	{
 		IDirect3D9 *pointer;
 
-		HRESULT hr = InternalPointer->GetDirect3D( &pointer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDirect3D( &pointer ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
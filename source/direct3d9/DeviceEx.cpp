@@ -68,11 +68,11 @@ namespace Direct3D9
 		for( int i = 0; i < presentParameters->Length; ++i )
 			d3dpp[i] = presentParameters[i]->ToUnmanaged();
 
-		HRESULT hr = direct3D->InternalPointer->CreateDeviceEx( adapter,
+		HRESULT hr = TIME_CALL( direct3D->InternalPointer->CreateDeviceEx( adapter,
 			static_cast<D3DDEVTYPE>( deviceType ),
 			static_cast<HWND>( controlHandle.ToPointer() ), 
 			static_cast<DWORD>( createFlags ),
-			&d3dpp[0], fullscreenDisplayMode, &device );
+			&d3dpp[0], fullscreenDisplayMode, &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -121,7 +121,7 @@ namespace Direct3D9
 	int DeviceEx::GpuThreadPriority::get()
 	{
 		int priority;
-		HRESULT hr = InternalPointer->GetGPUThreadPriority( &priority );
+		HRESULT hr = TIME_CALL( InternalPointer->GetGPUThreadPriority( &priority ) );
 		RECORD_D3D9( hr );
 
 		return priority;
@@ -129,14 +129,14 @@ namespace Direct3D9
 
 	void DeviceEx::GpuThreadPriority::set( int priority )
 	{
-		HRESULT hr = InternalPointer->SetGPUThreadPriority( priority );
+		HRESULT hr = TIME_CALL( InternalPointer->SetGPUThreadPriority( priority ) );
 		RECORD_D3D9( hr );
 	}
 
 	int DeviceEx::MaximumFrameLatency::get()
 	{
 		int maxLatency;
-		HRESULT hr = InternalPointer->GetMaximumFrameLatency( reinterpret_cast<UINT*>( &maxLatency ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMaximumFrameLatency( reinterpret_cast<UINT*>( &maxLatency ) ) );
 		RECORD_D3D9( hr );
 
 		return maxLatency;
@@ -144,20 +144,20 @@ namespace Direct3D9
 
 	void DeviceEx::MaximumFrameLatency::set( int maxLatency )
 	{
-		HRESULT hr = InternalPointer->SetMaximumFrameLatency( maxLatency );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMaximumFrameLatency( maxLatency ) );
 		RECORD_D3D9( hr );
 	}
 
 	DeviceState DeviceEx::CheckDeviceState( System::IntPtr windowHandle )
 	{
-		HRESULT hr = InternalPointer->CheckDeviceState( static_cast<HWND>( windowHandle.ToPointer() ) );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckDeviceState( static_cast<HWND>( windowHandle.ToPointer() ) ) );
 		return static_cast<DeviceState>( hr );
 	}
 
 	ResourceResidency DeviceEx::CheckResourceResidency( Resource^ resource )
 	{
 		IDirect3DResource9* resourcePointer = resource->InternalPointer;
-		HRESULT hr = InternalPointer->CheckResourceResidency( &resourcePointer, 1 );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckResourceResidency( &resourcePointer, 1 ) );
 		return static_cast<ResourceResidency>( hr );
 	}
 
@@ -167,7 +167,7 @@ namespace Direct3D9
 		for( int i = 0; i < resources->Length; i++ )
 			resourceArray[i] = resources[i]->InternalPointer;
 
-		HRESULT hr = InternalPointer->CheckResourceResidency( &resourceArray[0], resources->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckResourceResidency( &resourceArray[0], resources->Length ) );
 		return static_cast<ResourceResidency>( hr );
 	}
 
@@ -175,7 +175,7 @@ namespace Direct3D9
 	{
 		D3DDISPLAYMODEEX nativeMode = {0};
 		nativeMode.Size = sizeof(D3DDISPLAYMODEEX);
-		HRESULT hr = InternalPointer->GetDisplayModeEx( swapChain, &nativeMode, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplayModeEx( swapChain, &nativeMode, NULL ) );
 		RECORD_D3D9( hr );
 
 		DisplayModeEx mode = DisplayModeEx::FromUnmanaged( nativeMode );
@@ -188,7 +188,7 @@ namespace Direct3D9
 		nativeMode.Size = sizeof(D3DDISPLAYMODEEX);
 		D3DDISPLAYROTATION nativeRotation = D3DDISPLAYROTATION_IDENTITY;
 
-		HRESULT hr = InternalPointer->GetDisplayModeEx( swapChain, &nativeMode, &nativeRotation );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplayModeEx( swapChain, &nativeMode, &nativeRotation ) );
 		RECORD_D3D9( hr );
 
 		rotation = static_cast<DisplayRotation>( nativeRotation );
@@ -198,10 +198,10 @@ namespace Direct3D9
 
 	Result DeviceEx::PresentEx( SlimDX::Direct3D9::Present flags )
 	{
-		HRESULT hr = InternalPointer->PresentEx( 0, 0, 0, 0, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->PresentEx( 0, 0, 0, 0, static_cast<DWORD>( flags ) ) );
 		RECORD_D3D9( hr );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result DeviceEx::PresentEx( SlimDX::Direct3D9::Present flags, System::Drawing::Rectangle sourceRectangle, System::Drawing::Rectangle destinationRectangle )
@@ -217,7 +217,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->PresentEx( sourcePtr, destPtr, NULL, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->PresentEx( sourcePtr, destPtr, NULL, NULL, static_cast<DWORD>( flags ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -235,7 +235,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->PresentEx( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->PresentEx( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), NULL, static_cast<DWORD>( flags ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -259,7 +259,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->PresentEx( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), &nativeRegion, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->PresentEx( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), &nativeRegion, static_cast<DWORD>( flags ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -270,7 +270,7 @@ namespace Direct3D9
 		for( int p = 0; p < presentParameters->Length; ++p )
 			d3dpp[p] = presentParameters[p]->ToUnmanaged();
 
-		HRESULT hr = InternalPointer->ResetEx( &d3dpp[0], NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->ResetEx( &d3dpp[0], NULL ) );
 		RECORD_D3D9( hr );
 
 		for( int p = 0; p < presentParameters->Length; ++p )
@@ -281,14 +281,14 @@ namespace Direct3D9
 			presentParameters[p]->BackBufferHeight = d3dpp[p].BackBufferHeight;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result DeviceEx::ResetEx( PresentParameters^ presentParameters, DisplayModeEx fullscreenDisplayMode )
 	{
 		D3DPRESENT_PARAMETERS d3dpp = presentParameters->ToUnmanaged();
 		D3DDISPLAYMODEEX nativeDisplayMode = fullscreenDisplayMode.ToUnmanaged();
-		HRESULT hr = InternalPointer->ResetEx( &d3dpp, &nativeDisplayMode );
+		HRESULT hr = TIME_CALL( InternalPointer->ResetEx( &d3dpp, &nativeDisplayMode ) );
 		RECORD_D3D9( hr );
 
 		presentParameters->BackBufferCount = d3dpp.BackBufferCount;
@@ -296,7 +296,7 @@ namespace Direct3D9
 		presentParameters->BackBufferWidth = d3dpp.BackBufferWidth;
 		presentParameters->BackBufferHeight = d3dpp.BackBufferHeight;
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result DeviceEx::ResetEx( DisplayModeEx fullscreenDisplayMode, ... array<PresentParameters^>^ presentParameters )
@@ -306,7 +306,7 @@ namespace Direct3D9
 			d3dpp[p] = presentParameters[p]->ToUnmanaged();
 
 		D3DDISPLAYMODEEX nativeDisplayMode = fullscreenDisplayMode.ToUnmanaged();
-		HRESULT hr = InternalPointer->ResetEx( &d3dpp[0], &nativeDisplayMode );
+		HRESULT hr = TIME_CALL( InternalPointer->ResetEx( &d3dpp[0], &nativeDisplayMode ) );
 		RECORD_D3D9( hr );
 
 		for( int p = 0; p < presentParameters->Length; ++p )
@@ -317,7 +317,7 @@ namespace Direct3D9
 			presentParameters[p]->BackBufferHeight = d3dpp[p].BackBufferHeight;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	void DeviceEx::WaitForVBlank( int swapChain )
@@ -331,14 +331,14 @@ namespace Direct3D9
 		pin_ptr<float> pinnedRows = rowWeights == nullptr ? nullptr : &rowWeights[0];
 		pin_ptr<float> pinnedColumns = columnWeights == nullptr ? nullptr : &columnWeights[0];
 
-		HRESULT hr = InternalPointer->SetConvolutionMonoKernel(width, height, pinnedRows, pinnedColumns);
+		HRESULT hr = TIME_CALL( InternalPointer->SetConvolutionMonoKernel(width, height, pinnedRows, pinnedColumns) );
 		return RECORD_D3D9(hr);
 	}
 
 	Result DeviceEx::ComposeRects(Surface^ source, Surface^ destination, int rectangleCount, VertexBuffer^ sourceRectangleDescriptors, VertexBuffer^ destinationRectangleDescriptors, ComposeRectOperation operation, int xOffset, int yOffset)
 	{
-		HRESULT hr = InternalPointer->ComposeRects(source->InternalPointer, destination->InternalPointer, sourceRectangleDescriptors->InternalPointer,
-			rectangleCount, destinationRectangleDescriptors->InternalPointer, static_cast<D3DCOMPOSERECTSOP>(operation), xOffset, yOffset);
+		HRESULT hr = TIME_CALL( InternalPointer->ComposeRects(source->InternalPointer, destination->InternalPointer, sourceRectangleDescriptors->InternalPointer,
+			rectangleCount, destinationRectangleDescriptors->InternalPointer, static_cast<D3DCOMPOSERECTSOP>(operation), xOffset, yOffset) );
 
 		return RECORD_D3D9(hr);
 	}
@@ -88,8 +88,8 @@ namespace Direct3D9
 	{
 		HRESULT hr;		// Error code.
 
-		hr = InternalPointer->CheckDeviceFormatConversion(adapter, static_cast<D3DDEVTYPE>( deviceType ), 
-			static_cast<D3DFORMAT>( sourceFormat ), static_cast<D3DFORMAT>( targetFormat) );
+		hr = TIME_CALL( InternalPointer->CheckDeviceFormatConversion(adapter, static_cast<D3DDEVTYPE>( deviceType ), 
+			static_cast<D3DFORMAT>( sourceFormat ), static_cast<D3DFORMAT>( targetFormat) ) );
 
 		result = Result( hr );
 
@@ -105,8 +105,8 @@ namespace Direct3D9
 	bool Direct3D::CheckDeviceFormat( int adapter, DeviceType deviceType, Format adapterFormat,
 		Usage usage, ResourceType resourceType, Format checkFormat, [Out] Result% result )
 	{
-		HRESULT hr = InternalPointer->CheckDeviceFormat( adapter, static_cast<D3DDEVTYPE>( deviceType ), static_cast<D3DFORMAT>( adapterFormat ),
-			static_cast<DWORD>( usage ), static_cast<D3DRESOURCETYPE>( resourceType ), static_cast<D3DFORMAT>( checkFormat ) );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckDeviceFormat( adapter, static_cast<D3DDEVTYPE>( deviceType ), static_cast<D3DFORMAT>( adapterFormat ),
+			static_cast<DWORD>( usage ), static_cast<D3DRESOURCETYPE>( resourceType ), static_cast<D3DFORMAT>( checkFormat ) ) );
 		
 		result = Result( hr );
 		
@@ -123,8 +123,8 @@ namespace Direct3D9
 	bool Direct3D::CheckDeviceType( int adapter, DeviceType deviceType, Format adapterFormat, 
 		Format backBufferFormat, bool windowed, [Out] Result% result )
 	{
-		HRESULT hr = InternalPointer->CheckDeviceType( adapter, static_cast<D3DDEVTYPE>( deviceType ), 
-			static_cast<D3DFORMAT>( adapterFormat ), static_cast<D3DFORMAT>( backBufferFormat ), windowed );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckDeviceType( adapter, static_cast<D3DDEVTYPE>( deviceType ), 
+			static_cast<D3DFORMAT>( adapterFormat ), static_cast<D3DFORMAT>( backBufferFormat ), windowed ) );
 		
 		result = Result( hr );
 		
@@ -141,8 +141,8 @@ namespace Direct3D9
 	bool Direct3D::CheckDepthStencilMatch( int adapter, DeviceType deviceType, Format adapterFormat, 
 		Format renderTargetFormat, Format depthStencilFormat, [Out] Result% result )
 	{
-		HRESULT hr = InternalPointer->CheckDepthStencilMatch( adapter, static_cast<D3DDEVTYPE>( deviceType ),
-			static_cast<D3DFORMAT>( adapterFormat ), static_cast<D3DFORMAT>( renderTargetFormat ), static_cast<D3DFORMAT>( depthStencilFormat ) );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckDepthStencilMatch( adapter, static_cast<D3DDEVTYPE>( deviceType ),
+			static_cast<D3DFORMAT>( adapterFormat ), static_cast<D3DFORMAT>( renderTargetFormat ), static_cast<D3DFORMAT>( depthStencilFormat ) ) );
 		
 		result = Result( hr );
 		
@@ -161,8 +161,8 @@ namespace Direct3D9
 		bool windowed, MultisampleType multiSampleType, [Out] int% qualityLevels, [Out] Result% result )
 	{
 		DWORD levels;
-		HRESULT hr = InternalPointer->CheckDeviceMultiSampleType( adapter, static_cast<D3DDEVTYPE>( deviceType ), static_cast<D3DFORMAT>( surfaceFormat ),
-			windowed, static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ),  static_cast<DWORD*>( &levels ) );
+		HRESULT hr = TIME_CALL( InternalPointer->CheckDeviceMultiSampleType( adapter, static_cast<D3DDEVTYPE>( deviceType ), static_cast<D3DFORMAT>( surfaceFormat ),
+			windowed, static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ),  static_cast<DWORD*>( &levels ) ) );
 
 		qualityLevels = levels;
 		result = Result( hr );
@@ -190,7 +190,7 @@ namespace Direct3D9
     DisplayMode Direct3D::GetAdapterDisplayMode( int adapter )
     {
 		DisplayMode displayMode;
-        HRESULT hr = InternalPointer->GetAdapterDisplayMode( adapter, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) );
+        HRESULT hr = TIME_CALL( InternalPointer->GetAdapterDisplayMode( adapter, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) ) );
 		RECORD_D3D9( hr );
 
         return displayMode;
@@ -209,8 +209,8 @@ namespace Direct3D9
     DisplayMode Direct3D::EnumerateAdapterModes( int adapter, Format format, int modeIndex )
     {
 		DisplayMode displayMode;
-        HRESULT hr = InternalPointer->EnumAdapterModes( adapter, static_cast<D3DFORMAT>( format ),
-			modeIndex, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) );
+        HRESULT hr = TIME_CALL( InternalPointer->EnumAdapterModes( adapter, static_cast<D3DFORMAT>( format ),
+			modeIndex, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) ) );
         RECORD_D3D9( hr );
         return displayMode;
     }
@@ -223,7 +223,7 @@ namespace Direct3D9
 	Capabilities^ Direct3D::GetDeviceCaps( int adapter, DeviceType deviceType )
 	{
 		D3DCAPS9 caps = {D3DDEVTYPE_HAL, 0};
-		HRESULT hr = InternalPointer->GetDeviceCaps( adapter, static_cast<D3DDEVTYPE>( deviceType ), &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceCaps( adapter, static_cast<D3DDEVTYPE>( deviceType ), &caps ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -237,7 +237,7 @@ namespace Direct3D9
 
 	Result Direct3D::RegisterSoftwareDevice( IntPtr entryPoint )
 	{
-		HRESULT hr = InternalPointer->RegisterSoftwareDevice( entryPoint.ToPointer() );
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterSoftwareDevice( entryPoint.ToPointer() ) );
 		return RECORD_D3D9( hr );
 	}
 }
@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_D3D9(x) Result::Record<Direct3D9Exception^>( (x), (nullptr), (nullptr) )
+#define RECORD_D3D9(x) RECORD_RESULT( Direct3D9Exception^, x )
 
 namespace SlimDX
 {
@@ -49,7 +49,7 @@ namespace Direct3D9
 
         try
         {
-		    hr = Direct3DCreate9Ex( D3D_SDK_VERSION, &direct3D );
+		    hr = TIME_CALL( Direct3DCreate9Ex( D3D_SDK_VERSION, &direct3D ) );
         }
         catch( System::Runtime::InteropServices::SEHException^ ex )
         {
@@ -104,7 +104,7 @@ namespace Direct3D9
 	{
 		D3DDISPLAYMODEEX nativeMode = {0};
 		nativeMode.Size = sizeof(D3DDISPLAYMODEEX);
-		HRESULT hr = InternalPointer->GetAdapterDisplayModeEx( adapter, &nativeMode, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAdapterDisplayModeEx( adapter, &nativeMode, NULL ) );
 		RECORD_D3D9( hr );
 
 		DisplayModeEx mode = DisplayModeEx::FromUnmanaged( nativeMode );
@@ -116,7 +116,7 @@ namespace Direct3D9
 		D3DDISPLAYMODEEX nativeMode = {0};
 		nativeMode.Size = sizeof(D3DDISPLAYMODEEX);
 		D3DDISPLAYROTATION nativeRotation = D3DDISPLAYROTATION_IDENTITY;
-		HRESULT hr = InternalPointer->GetAdapterDisplayModeEx( adapter, &nativeMode, &nativeRotation );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAdapterDisplayModeEx( adapter, &nativeMode, &nativeRotation ) );
 		RECORD_D3D9( hr );
 
 		DisplayModeEx mode = DisplayModeEx::FromUnmanaged( nativeMode );
@@ -147,7 +147,7 @@ namespace Direct3D9
 		D3DDISPLAYMODEFILTER nativeFilter;
 		filter.ToUnmanaged( nativeFilter );
 
-		HRESULT hr = InternalPointer->EnumAdapterModesEx( adapter, &nativeFilter, modeIndex, &nativeMode );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumAdapterModesEx( adapter, &nativeFilter, modeIndex, &nativeMode ) );
 		RECORD_D3D9( hr );
 
 		DisplayModeEx mode = mode.FromUnmanaged( nativeMode );
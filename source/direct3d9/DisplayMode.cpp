@@ -85,7 +85,7 @@ namespace Direct3D9
 		for( int i = 0; i < count; ++i )
 		{
 			DisplayMode displayMode;
-			HRESULT hr = direct3D->EnumAdapterModes( adapter, static_cast<D3DFORMAT>( format ), i, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) );
+			HRESULT hr = TIME_CALL( direct3D->EnumAdapterModes( adapter, static_cast<D3DFORMAT>( format ), i, reinterpret_cast<D3DDISPLAYMODE*>( &displayMode ) ) );
 			if( RECORD_D3D9( hr ).IsFailure )
 				continue;
 
@@ -116,7 +116,7 @@ namespace Direct3D9
 		{
 			D3DDISPLAYMODEEX nativeDisplayMode = {0};
 			nativeDisplayMode.Size = sizeof(D3DDISPLAYMODEEX);
-			HRESULT hr = direct3D->EnumAdapterModesEx( adapter, &nativeFilter, i, &nativeDisplayMode );
+			HRESULT hr = TIME_CALL( direct3D->EnumAdapterModesEx( adapter, &nativeFilter, i, &nativeDisplayMode ) );
 			if( RECORD_D3D9( hr ).IsFailure )
 				continue;
 
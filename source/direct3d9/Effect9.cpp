@@ -86,8 +86,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( preprocessorDefines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectEx( device->InternalPointer, memory, size, macrosPtr, includePtr,
-			skipString, static_cast<DWORD>( flags ), effectPool, &effect, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectEx( device->InternalPointer, memory, size, macrosPtr, includePtr,
+			skipString, static_cast<DWORD>( flags ), effectPool, &effect, &errorBuffer ) );
 		
 		Macro::Unmarshal( handles );
 
@@ -284,8 +284,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( preprocessorDefines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, macrosPtr, includePtr,
-			skipString, static_cast<DWORD>( flags ), effectPool, &effect, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, macrosPtr, includePtr,
+			skipString, static_cast<DWORD>( flags ), effectPool, &effect, &errorBuffer ) );
 		
 		Macro::Unmarshal( handles );
 		compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -323,8 +323,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( preprocessorDefines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, macrosPtr, includePtr,
-			skipString, static_cast<DWORD>( flags ), effectPool, &effect, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, macrosPtr, includePtr,
+			skipString, static_cast<DWORD>( flags ), effectPool, &effect, &errorBuffer ) );
 		
 		Macro::Unmarshal( handles );
 		String^ compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -361,8 +361,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( preprocessorDefines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, macrosPtr, includePtr,
-			skipString, static_cast<DWORD>( flags ), NULL, &effect, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, macrosPtr, includePtr,
+			skipString, static_cast<DWORD>( flags ), NULL, &effect, &errorBuffer ) );
 		
 		Macro::Unmarshal( handles );
 		String^ compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -380,8 +380,8 @@ namespace Direct3D9
 		ID3DXBuffer* errorBuffer;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, NULL, NULL,
-			NULL, static_cast<DWORD>( flags ), NULL, &effect, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectFromFileEx( device->InternalPointer, pinnedName, NULL, NULL,
+			NULL, static_cast<DWORD>( flags ), NULL, &effect, &errorBuffer ) );
 		
 		String^ compilationErrors = Utilities::BufferToString( errorBuffer );
 
@@ -396,7 +396,7 @@ namespace Direct3D9
 	{
 		ID3DXEffect *result;
 
-		HRESULT hr = InternalPointer->CloneEffect( device->InternalPointer, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneEffect( device->InternalPointer, &result ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -407,7 +407,7 @@ namespace Direct3D9
 	{
 		unsigned int passCount;
 
-		HRESULT hr = InternalPointer->Begin( &passCount, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Begin( &passCount, static_cast<DWORD>( flags ) ) );
 		RECORD_D3D9( hr );
 
 		return passCount;
@@ -417,7 +417,7 @@ namespace Direct3D9
 	{
 		unsigned int passCount;
 
-		HRESULT hr = InternalPointer->Begin( &passCount, 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->Begin( &passCount, 0 ) );
 		RECORD_D3D9( hr );
 
 		return passCount;
@@ -425,25 +425,25 @@ namespace Direct3D9
 
 	Result Effect::End()
 	{
-		HRESULT hr = InternalPointer->End();
+		HRESULT hr = TIME_CALL( InternalPointer->End() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Effect::BeginPass( int pass )
 	{
-		HRESULT hr = InternalPointer->BeginPass( pass );
+		HRESULT hr = TIME_CALL( InternalPointer->BeginPass( pass ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Effect::EndPass()
 	{
-		HRESULT hr = InternalPointer->EndPass();
+		HRESULT hr = TIME_CALL( InternalPointer->EndPass() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Effect::BeginParameterBlock()
 	{
-		HRESULT hr = InternalPointer->BeginParameterBlock();
+		HRESULT hr = TIME_CALL( InternalPointer->BeginParameterBlock() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -458,7 +458,7 @@ namespace Direct3D9
 	Result Effect::ApplyParameterBlock( EffectHandle^ parameterBlock )
 	{
 		D3DXHANDLE handle = parameterBlock != nullptr ? parameterBlock->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->ApplyParameterBlock( handle );
+		HRESULT hr = TIME_CALL( InternalPointer->ApplyParameterBlock( handle ) );
 		GC::KeepAlive( parameterBlock );
 		return RECORD_D3D9( hr );
 	}
@@ -466,7 +466,7 @@ namespace Direct3D9
 	Result Effect::DeleteParameterBlock( EffectHandle^ parameterBlock )
 	{
 		D3DXHANDLE handle = parameterBlock != nullptr ? parameterBlock->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->DeleteParameterBlock( handle );
+		HRESULT hr = TIME_CALL( InternalPointer->DeleteParameterBlock( handle ) );
 		GC::KeepAlive( parameterBlock );
 		return RECORD_D3D9( hr );
 	}
@@ -482,7 +482,7 @@ namespace Direct3D9
 
 	Result Effect::CommitChanges()
 	{
-		HRESULT hr = InternalPointer->CommitChanges();
+		HRESULT hr = TIME_CALL( InternalPointer->CommitChanges() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -491,7 +491,7 @@ namespace Direct3D9
 		D3DXHANDLE handle;
 		D3DXHANDLE parentHandle = technique != nullptr ? technique->InternalHandle : NULL;
 
-		HRESULT hr = InternalPointer->FindNextValidTechnique( parentHandle, &handle );
+		HRESULT hr = TIME_CALL( InternalPointer->FindNextValidTechnique( parentHandle, &handle ) );
 		GC::KeepAlive( technique );
 		if( RECORD_D3D9( hr ).IsFailure || handle == NULL )
 			return nullptr;
@@ -518,20 +518,20 @@ namespace Direct3D9
 	void Effect::Technique::set( EffectHandle^ value )
 	{
 		D3DXHANDLE handle = value != nullptr ? value->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetTechnique( handle );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTechnique( handle ) );
 		GC::KeepAlive( value );
 		RECORD_D3D9( hr );
 	}
 
 	Result Effect::OnLostDevice()
 	{
-		HRESULT hr = InternalPointer->OnLostDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnLostDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Effect::OnResetDevice()
 	{
-		HRESULT hr = InternalPointer->OnResetDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnResetDevice() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -543,7 +543,7 @@ namespace Direct3D9
 	Result Effect::SetRawValue( EffectHandle^ handle, DataStream^ data, int offset, int count )
 	{
 		D3DXHANDLE value = handle != nullptr ? handle->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetRawValue( value, data->PositionPointer, offset, count );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRawValue( value, data->PositionPointer, offset, count ) );
 		GC::KeepAlive( handle );
 		return RECORD_D3D9( hr );
 	}
@@ -561,7 +561,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE value = handle != nullptr ? handle->InternalHandle : NULL;
 		pin_ptr<float> pinnedData = &data[startIndex];
-		HRESULT hr = InternalPointer->SetRawValue( value, pinnedData, 0, count * sizeof(float) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRawValue( value, pinnedData, 0, count * sizeof(float) ) );
 		GC::KeepAlive( handle );
 		return RECORD_D3D9( hr );
 	}
@@ -570,7 +570,7 @@ namespace Direct3D9
 	{
 		ID3DXBuffer *result = NULL;
 
-		HRESULT hr = D3DXDisassembleEffect( InternalPointer, enableColorCode, &result );
+		HRESULT hr = TIME_CALL( D3DXDisassembleEffect( InternalPointer, enableColorCode, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -590,7 +590,7 @@ namespace Direct3D9
 		else
 			shim = new IEffectStateManagerShim(manager, this);
 
-		HRESULT hr = InternalPointer->SetStateManager( shim );
+		HRESULT hr = TIME_CALL( InternalPointer->SetStateManager( shim ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -606,7 +606,7 @@ namespace Direct3D9
 	{
 		IDirect3DDevice9* device;
 
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -618,7 +618,7 @@ namespace Direct3D9
 	{
 		ID3DXEffectPool *pool;
 
-		HRESULT hr = InternalPointer->GetPool( &pool );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPool( &pool ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -57,8 +57,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectCompiler( reinterpret_cast<LPCSTR>( pinnedData ), data->Length, macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompiler( reinterpret_cast<LPCSTR>( pinnedData ), data->Length, macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -87,8 +87,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectCompiler( reinterpret_cast<LPCSTR>( pinnedData ), data->Length, macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompiler( reinterpret_cast<LPCSTR>( pinnedData ), data->Length, macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		String^ compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -108,8 +108,8 @@ namespace Direct3D9
 		array<Byte>^ dataBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( data );
 		pin_ptr<Byte> pinnedData = &dataBytes[0];
 
-		HRESULT hr = D3DXCreateEffectCompiler( reinterpret_cast<LPCSTR>( pinnedData ), data->Length, NULL, NULL,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompiler( reinterpret_cast<LPCSTR>( pinnedData ), data->Length, NULL, NULL,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		String^ compilationErrors = Utilities::BufferToString( errorBuffer );
 		
@@ -134,8 +134,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectCompiler( memory, size, macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompiler( memory, size, macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 
@@ -253,8 +253,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectCompilerFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompilerFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		errors = Utilities::BufferToString( errorBuffer );
@@ -282,8 +282,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCreateEffectCompilerFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompilerFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		String^ errors = Utilities::BufferToString( errorBuffer );
@@ -302,8 +302,8 @@ namespace Direct3D9
 
 		pin_ptr<const wchar_t> pinnedFile = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXCreateEffectCompilerFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), NULL, NULL,
-			static_cast<DWORD>( flags ), &compiler, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXCreateEffectCompilerFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), NULL, NULL,
+			static_cast<DWORD>( flags ), &compiler, &errorBuffer ) );
 
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		
@@ -325,7 +325,7 @@ namespace Direct3D9
 		ID3DXBuffer* shader;
 		ID3DXConstantTable* table;
 
-		HRESULT hr = InternalPointer->CompileShader( handle, reinterpret_cast<LPCSTR>( pinnedTarget ), static_cast<DWORD>( flags ), &shader, &errorBuffer, &table );
+		HRESULT hr = TIME_CALL( InternalPointer->CompileShader( handle, reinterpret_cast<LPCSTR>( pinnedTarget ), static_cast<DWORD>( flags ), &shader, &errorBuffer, &table ) );
 		GC::KeepAlive( functionHandle );
 
 		compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -348,7 +348,7 @@ namespace Direct3D9
 		ID3DXBuffer* errorBuffer;
 		ID3DXBuffer* shader;
 
-		HRESULT hr = InternalPointer->CompileShader( handle, reinterpret_cast<LPCSTR>( pinnedTarget ), static_cast<DWORD>( flags ), &shader, &errorBuffer, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->CompileShader( handle, reinterpret_cast<LPCSTR>( pinnedTarget ), static_cast<DWORD>( flags ), &shader, &errorBuffer, NULL ) );
 		GC::KeepAlive( functionHandle );
 
 		if( errorBuffer != NULL )
@@ -374,7 +374,7 @@ namespace Direct3D9
 		ID3DXBuffer* effect;
 		ID3DXBuffer* errorBuffer;
 
-		HRESULT hr = InternalPointer->CompileEffect( static_cast<DWORD>( flags ), &effect, &errorBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->CompileEffect( static_cast<DWORD>( flags ), &effect, &errorBuffer ) );
 
 		if( errorBuffer != NULL )
 			compilationErrors = Utilities::BufferToString( errorBuffer );
@@ -397,7 +397,7 @@ namespace Direct3D9
 	Result EffectCompiler::SetLiteral( EffectHandle^ handle, bool literal )
 	{
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetLiteral( nativeHandle, literal );
+		HRESULT hr = TIME_CALL( InternalPointer->SetLiteral( nativeHandle, literal ) );
 		GC::KeepAlive( handle );
 		return RECORD_D3D9( hr );
 	}
@@ -406,7 +406,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
 		BOOL literal = false;
-		HRESULT hr = InternalPointer->GetLiteral( nativeHandle, &literal );
+		HRESULT hr = TIME_CALL( InternalPointer->GetLiteral( nativeHandle, &literal ) );
 		GC::KeepAlive( handle );
 		RECORD_D3D9( hr );
 		
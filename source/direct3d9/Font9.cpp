@@ -63,8 +63,8 @@ namespace Direct3D9
 		ID3DXFont* font;
 		pin_ptr<const wchar_t> pinned_name = PtrToStringChars( faceName );
 
-		HRESULT hr = D3DXCreateFont( device->InternalPointer, height, width, static_cast<UINT>( weight ), mipLevels, italic, static_cast<DWORD>( charSet ),
-			static_cast<DWORD>( outputPrecision ), static_cast<DWORD>( quality ), static_cast<DWORD>( pitchAndFamily ), reinterpret_cast<LPCWSTR>( pinned_name ), &font );
+		HRESULT hr = TIME_CALL( D3DXCreateFont( device->InternalPointer, height, width, static_cast<UINT>( weight ), mipLevels, italic, static_cast<DWORD>( charSet ),
+			static_cast<DWORD>( outputPrecision ), static_cast<DWORD>( quality ), static_cast<DWORD>( pitchAndFamily ), reinterpret_cast<LPCWSTR>( pinned_name ), &font ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -122,32 +122,32 @@ namespace Direct3D9
 
 	Result Font::PreloadCharacters( int first, int last )
 	{
-		HRESULT hr = InternalPointer->PreloadCharacters( first, last );
+		HRESULT hr = TIME_CALL( InternalPointer->PreloadCharacters( first, last ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Font::PreloadGlyphs( int first, int last )
 	{
-		HRESULT hr = InternalPointer->PreloadGlyphs( first, last );
+		HRESULT hr = TIME_CALL( InternalPointer->PreloadGlyphs( first, last ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Font::PreloadText( String^ text )
 	{
 		pin_ptr<const wchar_t> pinned_text = PtrToStringChars( text );
-		HRESULT hr = InternalPointer->PreloadTextW( reinterpret_cast<LPCWSTR>( pinned_text ), text->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->PreloadTextW( reinterpret_cast<LPCWSTR>( pinned_text ), text->Length ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Font::OnLostDevice()
 	{
-		HRESULT hr = InternalPointer->OnLostDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnLostDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Font::OnResetDevice()
 	{
-		HRESULT hr = InternalPointer->OnResetDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnResetDevice() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -155,7 +155,7 @@ namespace Direct3D9
 	{
 		D3DXFONT_DESC description;
 		
-		HRESULT hr = InternalPointer->GetDesc( &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( &description ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return FontDescription();
 
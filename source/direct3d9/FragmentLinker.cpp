@@ -49,7 +49,7 @@ namespace Direct3D9
 		IDirect3DDevice9* devicePointer = device->InternalPointer;
 		ID3DXFragmentLinker* linker;
 
-		HRESULT hr = D3DXCreateFragmentLinker( devicePointer, cacheSize, &linker );
+		HRESULT hr = TIME_CALL( D3DXCreateFragmentLinker( devicePointer, cacheSize, &linker ) );
 		RECORD_D3D9( hr );
 		if( FAILED( hr ) )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -75,8 +75,8 @@ namespace Direct3D9
 
 #pragma warning(push)
 #pragma warning(disable:4996)
-		HRESULT hr = D3DXGatherFragments( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &fragmentBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXGatherFragments( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &fragmentBuffer, &errorBuffer ) );
 #pragma warning(pop)
 
 		//clean up after marshaling macros
@@ -118,8 +118,8 @@ namespace Direct3D9
 
 #pragma warning(push)
 #pragma warning(disable:4996)
-		HRESULT hr = D3DXGatherFragmentsFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &fragmentBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXGatherFragmentsFromFile( reinterpret_cast<LPCTSTR>( pinnedFile ), macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &fragmentBuffer, &errorBuffer ) );
 #pragma warning(pop)
 
 		//clean up after marshaling macros
@@ -136,13 +136,13 @@ namespace Direct3D9
 	Result FragmentLinker::AddFragments( array<int>^ fragments )
 	{
 		pin_ptr<int> pinnedFragments = &fragments[0];
-		HRESULT hr = InternalPointer->AddFragments( reinterpret_cast<const DWORD*>( pinnedFragments ) );
+		HRESULT hr = TIME_CALL( InternalPointer->AddFragments( reinterpret_cast<const DWORD*>( pinnedFragments ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result FragmentLinker::AddFragments( DataStream^ fragments )
 	{
-		HRESULT hr = InternalPointer->AddFragments( reinterpret_cast<const DWORD*>( fragments->PositionPointer ) );
+		HRESULT hr = TIME_CALL( InternalPointer->AddFragments( reinterpret_cast<const DWORD*>( fragments->PositionPointer ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -151,7 +151,7 @@ namespace Direct3D9
 		D3DXHANDLE handle = name != nullptr ? name->InternalHandle : NULL;
 		ID3DXBuffer* fragment;
 
-		HRESULT hr = InternalPointer->GetFragment( handle, &fragment );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFragment( handle, &fragment ) );
 		GC::KeepAlive( name );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -164,7 +164,7 @@ namespace Direct3D9
 	{
 		ID3DXBuffer* fragments;
 
-		HRESULT hr = InternalPointer->GetAllFragments( &fragments );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllFragments( &fragments ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -186,7 +186,7 @@ namespace Direct3D9
 		D3DXHANDLE handle = name != nullptr ? name->InternalHandle : NULL;
 		D3DXFRAGMENT_DESC description;
 
-		HRESULT hr = InternalPointer->GetFragmentDesc( handle, &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFragmentDesc( handle, &description ) );
 		GC::KeepAlive( name );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return FragmentDescription();
@@ -236,13 +236,13 @@ namespace Direct3D9
 		for( int i = 0; i < fragmentHandles->Length; ++i )
 			handles[i] = fragmentHandles[i] != nullptr ? fragmentHandles[i]->InternalHandle : NULL;
 
-		HRESULT hr = InternalPointer->LinkShader( reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<DWORD>( flags ), &handles[0], fragmentHandles->Length, &bytecode, &errorBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->LinkShader( reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<DWORD>( flags ), &handles[0], fragmentHandles->Length, &bytecode, &errorBuffer ) );
 		GC::KeepAlive( fragmentHandles );
 		RECORD_D3D9( hr );
 		
 		//marshal errors if necessary
 		errors = Utilities::BufferToString( errorBuffer );
-		if( Result::Last.IsFailure )
+		if( FAILED( hr ) )
 			return nullptr;
 
 		return ShaderBytecode::FromPointer( bytecode );
@@ -259,13 +259,13 @@ namespace Direct3D9
 		for( int i = 0; i < fragmentHandles->Length; ++i )
 			handles[i] = fragmentHandles[i] != nullptr ? fragmentHandles[i]->InternalHandle : NULL;
 
-		HRESULT hr = InternalPointer->LinkVertexShader( reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<DWORD>( flags ), &handles[0], fragmentHandles->Length, &shader, &errorBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->LinkVertexShader( reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<DWORD>( flags ), &handles[0], fragmentHandles->Length, &shader, &errorBuffer ) );
 		GC::KeepAlive( fragmentHandles );
 		RECORD_D3D9( hr );
 		
 		//marshal errors if necessary
 		errors = Utilities::BufferToString( errorBuffer );
-		if( Result::Last.IsFailure )
+		if( FAILED( hr ) )
 			return nullptr;
 
 		return VertexShader::FromPointer( shader );
@@ -282,13 +282,13 @@ namespace Direct3D9
 		for( int i = 0; i < fragmentHandles->Length; ++i )
 			handles[i] = fragmentHandles[i] != nullptr ? fragmentHandles[i]->InternalHandle : NULL;
 
-		HRESULT hr = InternalPointer->LinkPixelShader( reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<DWORD>( flags ), &handles[0], fragmentHandles->Length, &shader, &errorBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->LinkPixelShader( reinterpret_cast<LPCSTR>( pinnedProfile ), static_cast<DWORD>( flags ), &handles[0], fragmentHandles->Length, &shader, &errorBuffer ) );
 		GC::KeepAlive( fragmentHandles );
 		RECORD_D3D9( hr );
 		
 		//marshal errors if necessary
 		errors = Utilities::BufferToString( errorBuffer );
-		if( Result::Last.IsFailure )
+		if( FAILED( hr ) )
 			return nullptr;
 
 		return PixelShader::FromPointer( shader );
@@ -117,7 +117,7 @@ namespace Direct3D9
 		ImageInformation info;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXGetImageInfoFromFile( pinnedName, reinterpret_cast<D3DXIMAGE_INFO*>( &info ) );
+		HRESULT hr = TIME_CALL( D3DXGetImageInfoFromFile( pinnedName, reinterpret_cast<D3DXIMAGE_INFO*>( &info ) ) );
 		RECORD_D3D9( hr );
 
 		return info;
@@ -127,7 +127,7 @@ namespace Direct3D9
 	{
 		ImageInformation info;
 
-		HRESULT hr = D3DXGetImageInfoFromFileInMemory( data, size, reinterpret_cast<D3DXIMAGE_INFO*>( &info ) );
+		HRESULT hr = TIME_CALL( D3DXGetImageInfoFromFileInMemory( data, size, reinterpret_cast<D3DXIMAGE_INFO*>( &info ) ) );
 		RECORD_D3D9( hr );
 
 		return info;
@@ -39,7 +39,7 @@ namespace Direct3D9
 		IDirect3DIndexBuffer9* ib;
 		D3DFORMAT format = sixteenBit ? D3DFMT_INDEX16 : D3DFMT_INDEX32;
 
-		HRESULT hr = device->InternalPointer->CreateIndexBuffer( sizeInBytes, static_cast<DWORD>( usage ), format, static_cast<D3DPOOL>( pool ), &ib, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateIndexBuffer( sizeInBytes, static_cast<DWORD>( usage ), format, static_cast<D3DPOOL>( pool ), &ib, NULL ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -55,7 +55,7 @@ namespace Direct3D9
 		D3DFORMAT format = sixteenBit ? D3DFMT_INDEX16 : D3DFMT_INDEX32;
 		HANDLE sharedHandleNative = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateIndexBuffer( sizeInBytes, static_cast<DWORD>( usage ), format, static_cast<D3DPOOL>( pool ), &ib, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateIndexBuffer( sizeInBytes, static_cast<DWORD>( usage ), format, static_cast<D3DPOOL>( pool ), &ib, &sharedHandleNative ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -69,7 +69,7 @@ namespace Direct3D9
 	DataStream^ IndexBuffer::Lock( int offset, int size, LockFlags flags )
 	{
 		void* lockedPtr;
-		HRESULT hr = InternalPointer->Lock( offset, size, &lockedPtr, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Lock( offset, size, &lockedPtr, static_cast<DWORD>( flags ) ) );
 		RECORD_D3D9( hr );
 		
 		int lockedSize = size == 0 ? Description.SizeInBytes : size;
@@ -87,7 +87,7 @@ namespace Direct3D9
 	IndexBufferDescription IndexBuffer::Description::get()
 	{
 		IndexBufferDescription desc;
-		HRESULT hr = InternalPointer->GetDesc( reinterpret_cast<D3DINDEXBUFFER_DESC*>( &desc ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( reinterpret_cast<D3DINDEXBUFFER_DESC*>( &desc ) ) );
 		RECORD_D3D9( hr );
 
 		return desc;
@@ -61,8 +61,8 @@ namespace Direct3D9
 			keys[i].pCallbackData = callbackKeys[i].Data.ToPointer();
 		}
 
-		HRESULT hr = D3DXCreateKeyframedAnimationSet( reinterpret_cast<LPCSTR>( pinnedName ), ticksPerSecond, static_cast<D3DXPLAYBACK_TYPE>( playbackType ),
-			animationCount, count, &keys[0], &pointer );
+		HRESULT hr = TIME_CALL( D3DXCreateKeyframedAnimationSet( reinterpret_cast<LPCSTR>( pinnedName ), ticksPerSecond, static_cast<D3DXPLAYBACK_TYPE>( playbackType ),
+			animationCount, count, &keys[0], &pointer ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -74,7 +74,7 @@ namespace Direct3D9
 	{
 		LPD3DXBUFFER data;
 
-		HRESULT hr = InternalPointer->Compress( D3DXCOMPRESS_DEFAULT, lossiness, NULL, &data);
+		HRESULT hr = TIME_CALL( InternalPointer->Compress( D3DXCOMPRESS_DEFAULT, lossiness, NULL, &data) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -86,7 +86,7 @@ namespace Direct3D9
 	{
 		LPD3DXBUFFER data;
 
-		HRESULT hr = InternalPointer->Compress( D3DXCOMPRESS_DEFAULT, lossiness, frame->Pointer, &data);
+		HRESULT hr = TIME_CALL( InternalPointer->Compress( D3DXCOMPRESS_DEFAULT, lossiness, frame->Pointer, &data) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -98,7 +98,7 @@ namespace Direct3D9
 	{
 		D3DXKEY_CALLBACK key;
 
-		HRESULT hr = InternalPointer->GetCallbackKey( animation, &key );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCallbackKey( animation, &key ) );
 		RECORD_D3D9( hr );
 
 		return CallbackKey( key );
@@ -109,7 +109,7 @@ namespace Direct3D9
 		int count = CallbackKeyCount;
 		stack_array<D3DXKEY_CALLBACK> keys = stackalloc( D3DXKEY_CALLBACK, count );
 
-		HRESULT hr = InternalPointer->GetCallbackKeys( &keys[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCallbackKeys( &keys[0] ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -129,7 +129,7 @@ namespace Direct3D9
 		key.Time = callbackKey.Time;
 		key.pCallbackData = callbackKey.Data.ToPointer();
 
-		HRESULT hr = InternalPointer->SetCallbackKey( animation, &key );
+		HRESULT hr = TIME_CALL( InternalPointer->SetCallbackKey( animation, &key ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -137,7 +137,7 @@ namespace Direct3D9
 	{
 		D3DXKEY_QUATERNION qkey;
 
-		HRESULT hr = InternalPointer->GetRotationKey( animation, key, &qkey );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRotationKey( animation, key, &qkey ) );
 		RECORD_D3D9( hr );
 
 		return RotationKey( qkey );
@@ -148,7 +148,7 @@ namespace Direct3D9
 		int count = GetRotationKeyCount( animation );
 		stack_array<D3DXKEY_QUATERNION> keys = stackalloc( D3DXKEY_QUATERNION, count );
 
-		HRESULT hr = InternalPointer->GetRotationKeys( animation, &keys[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRotationKeys( animation, &keys[0] ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -168,13 +168,13 @@ namespace Direct3D9
 		qkey.Time = callbackKey.Time;
 		qkey.Value = D3DXQUATERNION( callbackKey.Value.X, callbackKey.Value.Y, callbackKey.Value.Z, callbackKey.Value.W );
 
-		HRESULT hr = InternalPointer->SetRotationKey( animation, key, &qkey );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRotationKey( animation, key, &qkey ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result KeyframedAnimationSet::UnregisterRotationKey( int animation, int key )
 	{
-		HRESULT hr = InternalPointer->UnregisterRotationKey( animation, key );
+		HRESULT hr = TIME_CALL( InternalPointer->UnregisterRotationKey( animation, key ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -187,7 +187,7 @@ namespace Direct3D9
 	{
 		D3DXKEY_VECTOR3 qkey;
 
-		HRESULT hr = InternalPointer->GetScaleKey( animation, key, &qkey );
+		HRESULT hr = TIME_CALL( InternalPointer->GetScaleKey( animation, key, &qkey ) );
 		RECORD_D3D9( hr );
 
 		return ScaleKey( qkey );
@@ -198,7 +198,7 @@ namespace Direct3D9
 		int count = GetScaleKeyCount( animation );
 		stack_array<D3DXKEY_VECTOR3> keys = stackalloc( D3DXKEY_VECTOR3, count );
 
-		HRESULT hr = InternalPointer->GetScaleKeys( animation, &keys[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetScaleKeys( animation, &keys[0] ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -216,13 +216,13 @@ namespace Direct3D9
 		qkey.Time = callbackKey.Time;
 		qkey.Value = D3DXVECTOR3( callbackKey.Value.X, callbackKey.Value.Y, callbackKey.Value.Z );
 
-		HRESULT hr = InternalPointer->SetScaleKey( animation, key, &qkey );
+		HRESULT hr = TIME_CALL( InternalPointer->SetScaleKey( animation, key, &qkey ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result KeyframedAnimationSet::UnregisterScaleKey( int animation, int key )
 	{
-		HRESULT hr = InternalPointer->UnregisterScaleKey( animation, key );
+		HRESULT hr = TIME_CALL( InternalPointer->UnregisterScaleKey( animation, key ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -235,7 +235,7 @@ namespace Direct3D9
 	{
 		D3DXKEY_VECTOR3 qkey;
 
-		HRESULT hr = InternalPointer->GetTranslationKey( animation, key, &qkey );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTranslationKey( animation, key, &qkey ) );
 		RECORD_D3D9( hr );
 
 		return TranslationKey( qkey );
@@ -246,7 +246,7 @@ namespace Direct3D9
 		int count = GetTranslationKeyCount( animation );
 		stack_array<D3DXKEY_VECTOR3> keys = stackalloc( D3DXKEY_VECTOR3, count );
 
-		HRESULT hr = InternalPointer->GetTranslationKeys( animation, &keys[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTranslationKeys( animation, &keys[0] ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -266,13 +266,13 @@ namespace Direct3D9
 		qkey.Time = callbackKey.Time;
 		qkey.Value = D3DXVECTOR3( callbackKey.Value.X, callbackKey.Value.Y, callbackKey.Value.Z );
 
-		HRESULT hr = InternalPointer->SetTranslationKey( animation, key, &qkey );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTranslationKey( animation, key, &qkey ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result KeyframedAnimationSet::UnregisterTranslationKey( int animation, int key )
 	{
-		HRESULT hr = InternalPointer->UnregisterTranslationKey( animation, key );
+		HRESULT hr = TIME_CALL( InternalPointer->UnregisterTranslationKey( animation, key ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -293,7 +293,7 @@ namespace Direct3D9
 		pin_ptr<RotationKey> rotations = &rotationKeys[0];
 		pin_ptr<TranslationKey> translations = &translationKeys[0];
 
-		HRESULT hr = InternalPointer->RegisterAnimationSRTKeys(
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterAnimationSRTKeys(
 			reinterpret_cast<LPCSTR>(pinnedName),
 			scaleKeys->Length,
 			rotationKeys->Length,
@@ -302,7 +302,7 @@ namespace Direct3D9
 			reinterpret_cast<D3DXKEY_QUATERNION*>(rotations),
 			reinterpret_cast<D3DXKEY_VECTOR3*>(translations),
 			&result
-		);
+		) );
 
 		if(RECORD_D3D9(hr).IsFailure)
 			return 0;
@@ -312,7 +312,7 @@ namespace Direct3D9
 
 	Result KeyframedAnimationSet::UnregisterAnimation( int animation )
 	{
-		HRESULT hr = InternalPointer->UnregisterAnimation( animation );
+		HRESULT hr = TIME_CALL( InternalPointer->UnregisterAnimation( animation ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -47,7 +47,7 @@ namespace Direct3D9
 	{
 		ID3DXLine* line;
 
-		HRESULT hr = D3DXCreateLine( device->InternalPointer, &line );
+		HRESULT hr = TIME_CALL( D3DXCreateLine( device->InternalPointer, &line ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -56,13 +56,13 @@ namespace Direct3D9
 
 	Result Line::Begin()
 	{
-		HRESULT hr = InternalPointer->Begin();
+		HRESULT hr = TIME_CALL( InternalPointer->Begin() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Line::End()
 	{
-		HRESULT hr = InternalPointer->End();
+		HRESULT hr = TIME_CALL( InternalPointer->End() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -70,7 +70,7 @@ namespace Direct3D9
 	{
 		pin_ptr<Vector2> pinnedVerts = &vertexList[0];
 
-		HRESULT hr = InternalPointer->Draw( reinterpret_cast<D3DXVECTOR2*>( pinnedVerts ), vertexList->Length, color.ToArgb() );
+		HRESULT hr = TIME_CALL( InternalPointer->Draw( reinterpret_cast<D3DXVECTOR2*>( pinnedVerts ), vertexList->Length, color.ToArgb() ) );
 		return RECORD_D3D9( hr );
 	}
 	
@@ -78,26 +78,26 @@ namespace Direct3D9
 	{
 		pin_ptr<Vector3> pinnedVerts = &vertexList[0];
 
-		HRESULT hr = InternalPointer->DrawTransform( reinterpret_cast<D3DXVECTOR3*>( pinnedVerts ), vertexList->Length, reinterpret_cast<const D3DXMATRIX*>( &transform ), color.ToArgb() );
+		HRESULT hr = TIME_CALL( InternalPointer->DrawTransform( reinterpret_cast<D3DXVECTOR3*>( pinnedVerts ), vertexList->Length, reinterpret_cast<const D3DXMATRIX*>( &transform ), color.ToArgb() ) );
 		return RECORD_D3D9( hr );
 	}
 	
 	Result Line::OnLostDevice()
 	{
-		HRESULT hr = InternalPointer->OnLostDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnLostDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Line::OnResetDevice()
 	{
-		HRESULT hr = InternalPointer->OnResetDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnResetDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	SlimDX::Direct3D9::Device^ Line::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -111,7 +111,7 @@ namespace Direct3D9
 
 	void Line::Antialias::set( bool value )
 	{
-		HRESULT hr = InternalPointer->SetAntialias( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetAntialias( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -122,7 +122,7 @@ namespace Direct3D9
 
 	void Line::GLLines::set( bool value )
 	{
-		HRESULT hr = InternalPointer->SetGLLines( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetGLLines( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -133,7 +133,7 @@ namespace Direct3D9
 
 	void Line::Pattern::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetPattern( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPattern( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -144,7 +144,7 @@ namespace Direct3D9
 
 	void Line::PatternScale::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetPatternScale( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPatternScale( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -155,7 +155,7 @@ namespace Direct3D9
 
 	void Line::Width::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetWidth( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetWidth( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -41,7 +41,7 @@ namespace Direct3D9
 	MatrixStack::MatrixStack()
 	{
 		ID3DXMatrixStack* matrixStack;
-		HRESULT hr = D3DXCreateMatrixStack( 0, &matrixStack );
+		HRESULT hr = TIME_CALL( D3DXCreateMatrixStack( 0, &matrixStack ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( "Failed to create MatrixStack." );
 
@@ -50,85 +50,85 @@ namespace Direct3D9
 
 	Result MatrixStack::Push()
 	{
-		HRESULT hr = InternalPointer->Push();
+		HRESULT hr = TIME_CALL( InternalPointer->Push() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::Pop()
 	{
-		HRESULT hr = InternalPointer->Pop();
+		HRESULT hr = TIME_CALL( InternalPointer->Pop() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::LoadIdentity()
 	{
-		HRESULT hr = InternalPointer->LoadIdentity();
+		HRESULT hr = TIME_CALL( InternalPointer->LoadIdentity() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::LoadMatrix( Matrix matrix )
 	{
-		HRESULT hr = InternalPointer->LoadMatrix( reinterpret_cast<D3DXMATRIX*>( &matrix ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LoadMatrix( reinterpret_cast<D3DXMATRIX*>( &matrix ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::MultiplyMatrix( Matrix matrix )
 	{
-		HRESULT hr = InternalPointer->MultMatrix( reinterpret_cast<D3DXMATRIX*>( &matrix ) );
+		HRESULT hr = TIME_CALL( InternalPointer->MultMatrix( reinterpret_cast<D3DXMATRIX*>( &matrix ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::MultiplyMatrixLocal( Matrix matrix )
 	{
-		HRESULT hr = InternalPointer->MultMatrixLocal( reinterpret_cast<D3DXMATRIX*>( &matrix ) );
+		HRESULT hr = TIME_CALL( InternalPointer->MultMatrixLocal( reinterpret_cast<D3DXMATRIX*>( &matrix ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::RotateAxis( Vector3 axis, float angle )
 	{
-		HRESULT hr = InternalPointer->RotateAxis( reinterpret_cast<D3DXVECTOR3*>( &axis ), angle );
+		HRESULT hr = TIME_CALL( InternalPointer->RotateAxis( reinterpret_cast<D3DXVECTOR3*>( &axis ), angle ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::RotateAxisLocal( Vector3 axis, float angle )
 	{
-		HRESULT hr = InternalPointer->RotateAxisLocal( reinterpret_cast<D3DXVECTOR3*>( &axis ), angle );
+		HRESULT hr = TIME_CALL( InternalPointer->RotateAxisLocal( reinterpret_cast<D3DXVECTOR3*>( &axis ), angle ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::RotateYawPitchRoll( float yaw, float pitch, float roll )
 	{
-		HRESULT hr = InternalPointer->RotateYawPitchRoll( yaw, pitch, roll );
+		HRESULT hr = TIME_CALL( InternalPointer->RotateYawPitchRoll( yaw, pitch, roll ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::RotateYawPitchRollLocal( float yaw, float pitch, float roll )
 	{
-		HRESULT hr = InternalPointer->RotateYawPitchRollLocal( yaw, pitch, roll );
+		HRESULT hr = TIME_CALL( InternalPointer->RotateYawPitchRollLocal( yaw, pitch, roll ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::Scale( float x, float y, float z )
 	{
-		HRESULT hr = InternalPointer->Scale( x, y, z );
+		HRESULT hr = TIME_CALL( InternalPointer->Scale( x, y, z ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::ScaleLocal( float x, float y, float z )
 	{
-		HRESULT hr = InternalPointer->ScaleLocal( x, y, z );
+		HRESULT hr = TIME_CALL( InternalPointer->ScaleLocal( x, y, z ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::Translate( float x, float y, float z )
 	{
-		HRESULT hr = InternalPointer->Translate( x, y, z );
+		HRESULT hr = TIME_CALL( InternalPointer->Translate( x, y, z ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result MatrixStack::TranslateLocal( float x, float y, float z )
 	{
-		HRESULT hr = InternalPointer->TranslateLocal( x, y, z );
+		HRESULT hr = TIME_CALL( InternalPointer->TranslateLocal( x, y, z ) );
 		return RECORD_D3D9( hr );
 	}
 
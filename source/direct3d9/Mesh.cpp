@@ -52,8 +52,8 @@ namespace Direct3D9
 		ID3DXMesh* mesh = NULL;
 		pin_ptr<VertexElement> pinnedDecl = &vertexDeclaration[0];
 
-		HRESULT hr = D3DXCreateMesh( numFaces, numVertices, static_cast<DWORD>( options ),
-			reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl ), device->InternalPointer, &mesh );
+		HRESULT hr = TIME_CALL( D3DXCreateMesh( numFaces, numVertices, static_cast<DWORD>( options ),
+			reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl ), device->InternalPointer, &mesh ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -65,8 +65,8 @@ namespace Direct3D9
 	{
 		ID3DXMesh* mesh = NULL;
 
-		HRESULT hr = D3DXCreateMeshFVF( numFaces, numVertices, static_cast<DWORD>( options ), 
-			static_cast<DWORD>( fvf ), device->InternalPointer, &mesh );
+		HRESULT hr = TIME_CALL( D3DXCreateMeshFVF( numFaces, numVertices, static_cast<DWORD>( options ), 
+			static_cast<DWORD>( fvf ), device->InternalPointer, &mesh ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -82,8 +82,8 @@ namespace Direct3D9
 		ID3DXBuffer* instanceBuffer = NULL;
 		DWORD materialCount = 0;
 		
-		HRESULT hr = D3DXLoadMeshFromXInMemory( memory, size, static_cast<DWORD>( flags ), device->InternalPointer,
-			&adjacencyBuffer, &materialBuffer, &instanceBuffer, &materialCount, &mesh );
+		HRESULT hr = TIME_CALL( D3DXLoadMeshFromXInMemory( memory, size, static_cast<DWORD>( flags ), device->InternalPointer,
+			&adjacencyBuffer, &materialBuffer, &instanceBuffer, &materialCount, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -129,8 +129,8 @@ namespace Direct3D9
 		DWORD materialCount = 0;
 		pin_ptr<const wchar_t> pinnedFileName = PtrToStringChars( fileName );
 		
-		HRESULT hr = D3DXLoadMeshFromX( pinnedFileName, static_cast<DWORD>( flags ), device->InternalPointer,
-			&adjacencyBuffer, &materialBuffer, &instanceBuffer, &materialCount, &mesh );
+		HRESULT hr = TIME_CALL( D3DXLoadMeshFromX( pinnedFileName, static_cast<DWORD>( flags ), device->InternalPointer,
+			&adjacencyBuffer, &materialBuffer, &instanceBuffer, &materialCount, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -156,8 +156,8 @@ namespace Direct3D9
 		ID3DXBuffer* instanceBuffer = NULL;
 		DWORD materialCount = 0;
 		
-		HRESULT hr = D3DXLoadSkinMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), device->InternalPointer,
-			&adjacencyBuffer, &materialBuffer, &instanceBuffer, &materialCount, &skin, &mesh );
+		HRESULT hr = TIME_CALL( D3DXLoadSkinMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), device->InternalPointer,
+			&adjacencyBuffer, &materialBuffer, &instanceBuffer, &materialCount, &skin, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -178,7 +178,7 @@ namespace Direct3D9
 
 	Result Mesh::ComputeTangentFrame( TangentOptions options )
 	{
-		HRESULT hr = D3DXComputeTangentFrame( InternalPointer, static_cast<DWORD>( options ) );
+		HRESULT hr = TIME_CALL( D3DXComputeTangentFrame( InternalPointer, static_cast<DWORD>( options ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -187,7 +187,7 @@ namespace Direct3D9
 		ID3DXMesh *result = NULL;
 		ID3DXBuffer *adj = NULL;
 
-		HRESULT hr = D3DXCreateBox( device->InternalPointer, width, height, depth, &result, &adj );
+		HRESULT hr = TIME_CALL( D3DXCreateBox( device->InternalPointer, width, height, depth, &result, &adj ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -203,7 +203,7 @@ namespace Direct3D9
 		ID3DXMesh *result = NULL;
 		ID3DXBuffer *adj = NULL;
 
-		HRESULT hr = D3DXCreateCylinder( device->InternalPointer, radius1, radius2, length, slices, stacks, &result, &adj );
+		HRESULT hr = TIME_CALL( D3DXCreateCylinder( device->InternalPointer, radius1, radius2, length, slices, stacks, &result, &adj ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -219,7 +219,7 @@ namespace Direct3D9
 		ID3DXMesh *result = NULL;
 		ID3DXBuffer *adj = NULL;
 
-		HRESULT hr = D3DXCreateSphere( device->InternalPointer, radius, slices, stacks, &result, &adj );
+		HRESULT hr = TIME_CALL( D3DXCreateSphere( device->InternalPointer, radius, slices, stacks, &result, &adj ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -235,7 +235,7 @@ namespace Direct3D9
 		ID3DXMesh *result = NULL;
 		ID3DXBuffer *adj = NULL;
 
-		HRESULT hr = D3DXCreateTeapot( device->InternalPointer, &result, &adj );
+		HRESULT hr = TIME_CALL( D3DXCreateTeapot( device->InternalPointer, &result, &adj ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -251,7 +251,7 @@ namespace Direct3D9
 		ID3DXMesh *result = NULL;
 		ID3DXBuffer *adj = NULL;
 
-		HRESULT hr = D3DXCreateTorus( device->InternalPointer, innerRadius, outerRadius, sides, rings, &result, &adj );
+		HRESULT hr = TIME_CALL( D3DXCreateTorus( device->InternalPointer, innerRadius, outerRadius, sides, rings, &result, &adj ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -281,8 +281,8 @@ namespace Direct3D9
 		newFont = static_cast<HFONT>( font->ToHfont().ToPointer() );
 		oldFont = static_cast<HFONT>( SelectObject( hdc, newFont ) );		
 
-		HRESULT hr = D3DXCreateText( device->InternalPointer, hdc, reinterpret_cast<LPCWSTR>( pinnedText ),
-			deviation, extrusion, &result, &adj, reinterpret_cast<LPGLYPHMETRICSFLOAT>( pinnedMetrics ) );
+		HRESULT hr = TIME_CALL( D3DXCreateText( device->InternalPointer, hdc, reinterpret_cast<LPCWSTR>( pinnedText ),
+			deviation, extrusion, &result, &adj, reinterpret_cast<LPGLYPHMETRICSFLOAT>( pinnedMetrics ) ) );
 
 		SelectObject( hdc, oldFont );
 		DeleteObject( newFont );
@@ -316,8 +316,8 @@ namespace Direct3D9
 		newFont = static_cast<HFONT>( font->ToHfont().ToPointer() );
 		oldFont = static_cast<HFONT>( SelectObject( hdc, newFont ) );		
 
-		HRESULT hr = D3DXCreateText( device->InternalPointer, hdc, reinterpret_cast<LPCWSTR>( pinnedText ),
-			deviation, extrusion, &result, &adj, NULL );
+		HRESULT hr = TIME_CALL( D3DXCreateText( device->InternalPointer, hdc, reinterpret_cast<LPCWSTR>( pinnedText ),
+			deviation, extrusion, &result, &adj, NULL ) );
 
 		SelectObject( hdc, oldFont );
 		DeleteObject( newFont );
@@ -337,7 +337,7 @@ namespace Direct3D9
 		DWORD *data = NULL;
 		int faceCount = InternalPointer->GetNumFaces();
 		
-		HRESULT hr = InternalPointer->LockAttributeBuffer( static_cast<DWORD>( flags ), &data );
+		HRESULT hr = TIME_CALL( InternalPointer->LockAttributeBuffer( static_cast<DWORD>( flags ), &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -348,7 +348,7 @@ namespace Direct3D9
 
 	Result Mesh::UnlockAttributeBuffer()
 	{
-		HRESULT hr = InternalPointer->UnlockAttributeBuffer();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockAttributeBuffer() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -356,7 +356,7 @@ namespace Direct3D9
 	{
 		pin_ptr<AttributeRange> pinnedTable = &table[0];
 
-		HRESULT hr = InternalPointer->SetAttributeTable( reinterpret_cast<const D3DXATTRIBUTERANGE*>( pinnedTable ), table->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetAttributeTable( reinterpret_cast<const D3DXATTRIBUTERANGE*>( pinnedTable ), table->Length ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -380,8 +380,8 @@ namespace Direct3D9
 			adjacencyOutPtr = &adjacencyOut[0];
 		}		
 
-		HRESULT hr = InternalPointer->OptimizeInplace( static_cast<DWORD>( flags ), adjacencyIn,
-			adjacencyOutPtr, reinterpret_cast<DWORD*>( pinnedFR ), &buffer );
+		HRESULT hr = TIME_CALL( InternalPointer->OptimizeInplace( static_cast<DWORD>( flags ), adjacencyIn,
+			adjacencyOutPtr, reinterpret_cast<DWORD*>( pinnedFR ), &buffer ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -398,7 +398,7 @@ namespace Direct3D9
 				SetAdjacency( NULL );
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Mesh::OptimizeInPlace( MeshOptimizeFlags flags )
@@ -416,8 +416,8 @@ namespace Direct3D9
 			adjacencyOutPtr = &adjacencyOut[0];
 		}
 
-		HRESULT hr = InternalPointer->OptimizeInplace( static_cast<DWORD>( flags ), adjacencyIn,
-			adjacencyOutPtr, NULL, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->OptimizeInplace( static_cast<DWORD>( flags ), adjacencyIn,
+			adjacencyOutPtr, NULL, NULL ) );
 		RECORD_D3D9( hr );
 
 		if( FAILED( hr ) )
@@ -430,7 +430,7 @@ namespace Direct3D9
 				SetAdjacency( NULL );
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Mesh^ Mesh::Optimize( MeshOptimizeFlags flags, [Out] array<int>^% faceRemap, [Out] array<int>^% vertexRemap )
@@ -454,8 +454,8 @@ namespace Direct3D9
 			adjacencyOutPtr = &adjacencyOut[0];
 		}		
 
-		HRESULT hr = InternalPointer->Optimize( static_cast<DWORD>( flags ), adjacencyIn,
-			adjacencyOutPtr, reinterpret_cast<DWORD*>( pinnedFR ), &buffer, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->Optimize( static_cast<DWORD>( flags ), adjacencyIn,
+			adjacencyOutPtr, reinterpret_cast<DWORD*>( pinnedFR ), &buffer, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -491,8 +491,8 @@ namespace Direct3D9
 			adjacencyOutPtr = &adjacencyOut[0];
 		}
 
-		HRESULT hr = InternalPointer->Optimize( static_cast<DWORD>( flags ), adjacencyIn,
-			adjacencyOutPtr, NULL, NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->Optimize( static_cast<DWORD>( flags ), adjacencyIn,
+			adjacencyOutPtr, NULL, NULL, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -523,8 +523,8 @@ namespace Direct3D9
 			adjacencyOutPtr = &adjacencyOut[0];
 		}
 
-		HRESULT hr = D3DXCleanMesh( static_cast<D3DXCLEANTYPE>( type ), InternalPointer, 
-			adjacencyIn, &result, adjacencyOutPtr, &errors );
+		HRESULT hr = TIME_CALL( D3DXCleanMesh( static_cast<D3DXCLEANTYPE>( type ), InternalPointer, 
+			adjacencyIn, &result, adjacencyOutPtr, &errors ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -559,8 +559,8 @@ namespace Direct3D9
 			adjacencyOutPtr = &adjacencyOut[0];
 		}
 
-		HRESULT hr = D3DXCleanMesh( static_cast<D3DXCLEANTYPE>( type ), InternalPointer, 
-			&adjacencyIn[0], &result, adjacencyOutPtr, NULL );
+		HRESULT hr = TIME_CALL( D3DXCleanMesh( static_cast<D3DXCLEANTYPE>( type ), InternalPointer, 
+			&adjacencyIn[0], &result, adjacencyOutPtr, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -623,7 +623,7 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXComputeNormals( InternalPointer, adjacencyIn );
+		HRESULT hr = TIME_CALL( D3DXComputeNormals( InternalPointer, adjacencyIn ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -639,7 +639,7 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXComputeTangent( InternalPointer, textureStage, tangentIndex, binormalIndex, wrap, adjacencyIn );
+		HRESULT hr = TIME_CALL( D3DXComputeTangent( InternalPointer, textureStage, tangentIndex, binormalIndex, wrap, adjacencyIn ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -661,10 +661,10 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXComputeTangentFrameEx( InternalPointer, textureInSemantic, textureInIndex,
+		HRESULT hr = TIME_CALL( D3DXComputeTangentFrameEx( InternalPointer, textureInSemantic, textureInIndex,
 			partialOutSemanticU, partialOutIndexU, partialOutSemanticV, partialOutIndexV, normalOutSemantic,
 			normalOutIndex, static_cast<DWORD>( options ), adjacencyIn,
-			partialEdgeThreshold, singularPointThreshold, normalEdgeThreshold, &result, &vertex );
+			partialEdgeThreshold, singularPointThreshold, normalEdgeThreshold, &result, &vertex ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -697,10 +697,10 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXComputeTangentFrameEx( InternalPointer, textureInSemantic, textureInIndex,
+		HRESULT hr = TIME_CALL( D3DXComputeTangentFrameEx( InternalPointer, textureInSemantic, textureInIndex,
 			partialOutSemanticU, partialOutIndexU, partialOutSemanticV, partialOutIndexV, normalOutSemantic,
 			normalOutIndex, static_cast<DWORD>( options ), adjacencyIn,
-			partialEdgeThreshold, singularPointThreshold, normalEdgeThreshold, &result, NULL );
+			partialEdgeThreshold, singularPointThreshold, normalEdgeThreshold, &result, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -745,8 +745,8 @@ namespace Direct3D9
 			decl = reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl );
 		}
 
-		HRESULT hr = D3DXConcatenateMeshes( &input[0], meshes->Length, static_cast<DWORD>( options ), geoXForms,
-			textureXForms, decl, device->InternalPointer, &result );
+		HRESULT hr = TIME_CALL( D3DXConcatenateMeshes( &input[0], meshes->Length, static_cast<DWORD>( options ), geoXForms,
+			textureXForms, decl, device->InternalPointer, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -780,8 +780,8 @@ namespace Direct3D9
 			textureXForms = reinterpret_cast<D3DXMATRIX*>( pinnedTexture );
 		}
 
-		HRESULT hr = D3DXConcatenateMeshes( &input[0], meshes->Length, static_cast<DWORD>( options ), geoXForms,
-			textureXForms, NULL, device->InternalPointer, &result );
+		HRESULT hr = TIME_CALL( D3DXConcatenateMeshes( &input[0], meshes->Length, static_cast<DWORD>( options ), geoXForms,
+			textureXForms, NULL, device->InternalPointer, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -797,8 +797,8 @@ namespace Direct3D9
 		for( int i = 0; i < meshes->Length; i++ )
 			input[i] = meshes[i]->InternalPointer;
 
-		HRESULT hr = D3DXConcatenateMeshes( &input[0], meshes->Length, static_cast<DWORD>( options ), NULL,
-			NULL, NULL, device->InternalPointer, &result );
+		HRESULT hr = TIME_CALL( D3DXConcatenateMeshes( &input[0], meshes->Length, static_cast<DWORD>( options ), NULL,
+			NULL, NULL, device->InternalPointer, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -853,8 +853,8 @@ namespace Direct3D9
 		else
 			f |= D3DXF_FILESAVE_TOFILE;
 
-		HRESULT hr = D3DXSaveMeshToX( reinterpret_cast<LPCWSTR>( pinnedName ), mesh->InternalPointer, 
-			adjacencyIn, materialPtr, effectPtr, length, f );
+		HRESULT hr = TIME_CALL( D3DXSaveMeshToX( reinterpret_cast<LPCWSTR>( pinnedName ), mesh->InternalPointer, 
+			adjacencyIn, materialPtr, effectPtr, length, f ) );
 
 		if( materials != nullptr )
 		{
@@ -899,9 +899,9 @@ namespace Direct3D9
 		pin_ptr<float> pinnedVW = &vertexWeights[0];
 		pin_ptr<AttributeWeights> pinnedAW = &attributeWeights[0];
 
-		HRESULT hr = D3DXSimplifyMesh( mesh->InternalPointer, adjacencyIn,
+		HRESULT hr = TIME_CALL( D3DXSimplifyMesh( mesh->InternalPointer, adjacencyIn,
 			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedAW ), reinterpret_cast<const FLOAT*>( pinnedVW ),
-			minimumValue, static_cast<DWORD>( options ), &result );
+			minimumValue, static_cast<DWORD>( options ), &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -926,9 +926,9 @@ namespace Direct3D9
 
 		pin_ptr<AttributeWeights> pinnedAW = &attributeWeights[0];
 
-		HRESULT hr = D3DXSimplifyMesh( mesh->InternalPointer, adjacencyIn,
+		HRESULT hr = TIME_CALL( D3DXSimplifyMesh( mesh->InternalPointer, adjacencyIn,
 			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedAW ), NULL,
-			minimumValue, static_cast<DWORD>( options ), &result );
+			minimumValue, static_cast<DWORD>( options ), &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -950,8 +950,8 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXSimplifyMesh( mesh->InternalPointer, adjacencyIn,
-			NULL, NULL, minimumValue, static_cast<DWORD>( options ), &result );
+		HRESULT hr = TIME_CALL( D3DXSimplifyMesh( mesh->InternalPointer, adjacencyIn,
+			NULL, NULL, minimumValue, static_cast<DWORD>( options ), &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -974,8 +974,8 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXTessellateNPatches( mesh->InternalPointer, adjacencyIn, segmentCount,
-			quadraticInterpolation, &result, &adjacencyOut );
+		HRESULT hr = TIME_CALL( D3DXTessellateNPatches( mesh->InternalPointer, adjacencyIn, segmentCount,
+			quadraticInterpolation, &result, &adjacencyOut ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -992,9 +992,9 @@ namespace Direct3D9
 		pin_ptr<float> pinnedSegments = &segmentCounts[0];
 		pin_ptr<VertexElement> pinnedDeclaration = &vertexDeclaration[0];
 
-		HRESULT hr = D3DXTessellateRectPatch( vertexBuffer->InternalPointer, reinterpret_cast<const FLOAT*>( pinnedSegments ),
+		HRESULT hr = TIME_CALL( D3DXTessellateRectPatch( vertexBuffer->InternalPointer, reinterpret_cast<const FLOAT*>( pinnedSegments ),
 			reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDeclaration ), reinterpret_cast<const D3DRECTPATCH_INFO*>( &rectanglePatchInfo ),
-			InternalPointer );
+			InternalPointer ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -1005,9 +1005,9 @@ namespace Direct3D9
 		pin_ptr<float> pinnedSegments = &segmentCounts[0];
 		pin_ptr<VertexElement> pinnedDeclaration = &vertexDeclaration[0];
 
-		HRESULT hr = D3DXTessellateTriPatch( vertexBuffer->InternalPointer, reinterpret_cast<const FLOAT*>( pinnedSegments ),
+		HRESULT hr = TIME_CALL( D3DXTessellateTriPatch( vertexBuffer->InternalPointer, reinterpret_cast<const FLOAT*>( pinnedSegments ),
 			reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDeclaration ), reinterpret_cast<const D3DTRIPATCH_INFO*>( &trianglePatchInfo ),
-			InternalPointer );
+			InternalPointer ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -1032,9 +1032,9 @@ namespace Direct3D9
 			adjOut = &adjacencyOut[0];
 		}
 
-		HRESULT hr = D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), 
+		HRESULT hr = TIME_CALL( D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), 
 			reinterpret_cast<const D3DXWELDEPSILONS*>( &epsilons ), adjIn, adjOut, 
-			reinterpret_cast<DWORD*>( pinnedFR ), &buffer );
+			reinterpret_cast<DWORD*>( pinnedFR ), &buffer ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -1048,7 +1048,7 @@ namespace Direct3D9
 		if( adjOut != NULL )
 			SetAdjacency( &adjacencyOut[0] );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Mesh::WeldVertices( WeldFlags flags, [Out] array<int>^% faceRemap, [Out] array<int>^% vertexRemap )
@@ -1071,8 +1071,8 @@ namespace Direct3D9
 			adjOut = &adjacencyOut[0];
 		}
 
-		HRESULT hr = D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), NULL, adjIn, adjOut, 
-			reinterpret_cast<DWORD*>( pinnedFR ), &buffer );
+		HRESULT hr = TIME_CALL( D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), NULL, adjIn, adjOut, 
+			reinterpret_cast<DWORD*>( pinnedFR ), &buffer ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -1086,7 +1086,7 @@ namespace Direct3D9
 		if( adjOut != NULL )
 			SetAdjacency( &adjacencyOut[0] );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Mesh::WeldVertices( WeldFlags flags, WeldEpsilons epsilons )
@@ -1105,8 +1105,8 @@ namespace Direct3D9
 			adjOut = &adjacencyOut[0];
 		}
 
-		HRESULT hr = D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), 
-			reinterpret_cast<const D3DXWELDEPSILONS*>( &epsilons ), adjIn, adjOut, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), 
+			reinterpret_cast<const D3DXWELDEPSILONS*>( &epsilons ), adjIn, adjOut, NULL, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return Result::Last;
@@ -1114,7 +1114,7 @@ namespace Direct3D9
 		if( adjOut != NULL )
 			SetAdjacency( &adjacencyOut[0] );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result Mesh::WeldVertices( WeldFlags flags )
@@ -1133,7 +1133,7 @@ namespace Direct3D9
 			adjOut = &adjacencyOut[0];
 		}
 
-		HRESULT hr = D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), NULL, adjIn, adjOut, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXWeldVertices( InternalPointer, static_cast<DWORD>( flags ), NULL, adjIn, adjOut, NULL, NULL ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return Result::Last;
@@ -1141,7 +1141,7 @@ namespace Direct3D9
 		if( adjOut != NULL )
 			SetAdjacency( &adjacencyOut[0] );
 
-		return Result::Last;
+		return Result( hr );
 	}
 }
 }
@@ -0,0 +1,504 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+#include <d3dx9.h>
+#include <math.h>
+#include <string.h>
+
+#include "../MeshSimplifierKernels.h"
+
+#include "MeshSimplifier.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	static int GetDeclarationTypeSize( DeclarationType type )
+	{
+		switch( type )
+		{
+		case DeclarationType::Float1:
+		case DeclarationType::Color:
+		case DeclarationType::Ubyte4:
+		case DeclarationType::Short2:
+		case DeclarationType::UByte4N:
+		case DeclarationType::Short2N:
+		case DeclarationType::UShort2N:
+		case DeclarationType::UDec3:
+		case DeclarationType::Dec3N:
+		case DeclarationType::HalfTwo:
+			return 4;
+
+		case DeclarationType::Float2:
+		case DeclarationType::Short4:
+		case DeclarationType::Short4N:
+		case DeclarationType::UShort4N:
+		case DeclarationType::HalfFour:
+			return 8;
+
+		case DeclarationType::Float3:
+			return 12;
+
+		case DeclarationType::Float4:
+			return 16;
+
+		default:
+			return 0;
+		}
+	}
+
+	// Types without a meaningful distance between values, such as packed integers, are left out of the error metric.
+	static int GetComponentCount( DeclarationType type )
+	{
+		switch( type )
+		{
+		case DeclarationType::Float1:
+			return 1;
+
+		case DeclarationType::Float2:
+		case DeclarationType::Short2N:
+		case DeclarationType::UShort2N:
+		case DeclarationType::HalfTwo:
+			return 2;
+
+		case DeclarationType::Float3:
+			return 3;
+
+		case DeclarationType::Float4:
+		case DeclarationType::Color:
+		case DeclarationType::UByte4N:
+		case DeclarationType::Short4N:
+		case DeclarationType::UShort4N:
+		case DeclarationType::HalfFour:
+			return 4;
+
+		default:
+			return 0;
+		}
+	}
+
+	static void ReadComponent( const unsigned char* data, DeclarationType type, float* result )
+	{
+		switch( type )
+		{
+		case DeclarationType::Float1:
+		case DeclarationType::Float2:
+		case DeclarationType::Float3:
+		case DeclarationType::Float4:
+			memcpy( result, data, GetComponentCount( type ) * sizeof( float ) );
+			break;
+
+		case DeclarationType::Color:
+			result[0] = data[2] / 255.0f;
+			result[1] = data[1] / 255.0f;
+			result[2] = data[0] / 255.0f;
+			result[3] = data[3] / 255.0f;
+			break;
+
+		case DeclarationType::UByte4N:
+			for( int i = 0; i < 4; ++i )
+				result[i] = data[i] / 255.0f;
+			break;
+
+		case DeclarationType::Short2N:
+		case DeclarationType::Short4N:
+			for( int i = 0; i < GetComponentCount( type ); ++i )
+				result[i] = reinterpret_cast<const short*>( data )[i] / 32767.0f;
+			break;
+
+		case DeclarationType::UShort2N:
+		case DeclarationType::UShort4N:
+			for( int i = 0; i < GetComponentCount( type ); ++i )
+				result[i] = reinterpret_cast<const unsigned short*>( data )[i] / 65535.0f;
+			break;
+
+		case DeclarationType::HalfTwo:
+		case DeclarationType::HalfFour:
+			D3DXFloat16To32Array( result, reinterpret_cast<const D3DXFLOAT16*>( data ), GetComponentCount( type ) );
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	static float GetComponentWeight( VertexElement element, AttributeWeights% weights )
+	{
+		switch( element.Usage )
+		{
+		case DeclarationUsage::Normal:
+			return element.UsageIndex == 0 ? weights.Normal : 0.0f;
+
+		case DeclarationUsage::Color:
+			return element.UsageIndex == 0 ? weights.Diffuse : ( element.UsageIndex == 1 ? weights.Specular : 0.0f );
+
+		case DeclarationUsage::Tangent:
+			return element.UsageIndex == 0 ? weights.Tangent : 0.0f;
+
+		case DeclarationUsage::Binormal:
+			return element.UsageIndex == 0 ? weights.Binormal : 0.0f;
+
+		case DeclarationUsage::TextureCoordinate:
+			switch( element.UsageIndex )
+			{
+			case 0: return weights.TextureCoordinate1;
+			case 1: return weights.TextureCoordinate2;
+			case 2: return weights.TextureCoordinate3;
+			case 3: return weights.TextureCoordinate4;
+			case 4: return weights.TextureCoordinate5;
+			case 5: return weights.TextureCoordinate6;
+			case 6: return weights.TextureCoordinate7;
+			case 7: return weights.TextureCoordinate8;
+			default: return 0.0f;
+			}
+
+		default:
+			return 0.0f;
+		}
+	}
+
+	static array<array<int>^>^ ToManaged( const std::vector<std::vector<unsigned int> >& levels )
+	{
+		array<array<int>^>^ result = gcnew array<array<int>^>( static_cast<int>( levels.size() ) );
+		for( int i = 0; i < result->Length; ++i )
+		{
+			result[i] = gcnew array<int>( static_cast<int>( levels[i].size() ) );
+			if( result[i]->Length > 0 )
+			{
+				pin_ptr<int> pinned = &result[i][0];
+				memcpy( pinned, &levels[i][0], levels[i].size() * sizeof( unsigned int ) );
+			}
+		}
+
+		return result;
+	}
+
+	static void CheckOptions( MeshSimplification options )
+	{
+		if( options != MeshSimplification::Vertex && options != MeshSimplification::Face )
+			throw gcnew ArgumentOutOfRangeException( "options" );
+	}
+
+	ref class MeshSimplifierWorker
+	{
+	private:
+		ManualResetEvent^ m_Done;
+		Exception^ m_Error;
+		int m_Next;
+		int m_Pending;
+
+		array<MeshSimplifier^>^ m_Simplifiers;
+		array<float>^ m_Ratios;
+		MeshSimplification m_Options;
+		array<array<array<int>^>^>^ m_Results;
+
+		void Execute( Object^ )
+		{
+			try
+			{
+				for( int i = Interlocked::Increment( m_Next ); i < m_Simplifiers->Length; i = Interlocked::Increment( m_Next ) )
+				{
+					MeshSimplifier^ simplifier = m_Simplifiers[i];
+					int count = m_Options == MeshSimplification::Vertex ? simplifier->VertexCount : simplifier->FaceCount;
+
+					array<int>^ targets = gcnew array<int>( m_Ratios->Length );
+					for( int level = 0; level < targets->Length; ++level )
+						targets[level] = static_cast<int>( count * m_Ratios[level] );
+
+					m_Results[i] = simplifier->GenerateLodChain( targets, m_Options );
+				}
+			}
+			catch( Exception^ e )
+			{
+				// an exception escaping a pool thread would end the process, so the first one is rethrown by Run instead
+				Interlocked::CompareExchange<Exception^>( m_Error, e, nullptr );
+				Interlocked::Exchange( m_Next, m_Simplifiers->Length );
+			}
+			finally
+			{
+				if( Interlocked::Decrement( m_Pending ) == 0 && m_Done != nullptr )
+					m_Done->Set();
+			}
+		}
+
+	public:
+		MeshSimplifierWorker( array<MeshSimplifier^>^ simplifiers, array<float>^ ratios, MeshSimplification options )
+		{
+			m_Simplifiers = simplifiers;
+			m_Ratios = ratios;
+			m_Options = options;
+			m_Results = gcnew array<array<array<int>^>^>( simplifiers->Length );
+		}
+
+		array<array<array<int>^>^>^ Run( int maximumThreads )
+		{
+			int threads = maximumThreads < m_Simplifiers->Length ? maximumThreads : m_Simplifiers->Length;
+			m_Next = -1;
+			m_Pending = threads;
+			m_Done = nullptr;
+			m_Error = nullptr;
+
+			if( threads > 1 )
+			{
+				m_Done = gcnew ManualResetEvent( false );
+
+				WaitCallback^ callback = gcnew WaitCallback( this, &MeshSimplifierWorker::Execute );
+				for( int i = 1; i < threads; ++i )
+					ThreadPool::QueueUserWorkItem( callback );
+			}
+
+			try
+			{
+				// the calling thread takes meshes as well instead of idling
+				if( threads > 0 )
+					Execute( nullptr );
+			}
+			finally
+			{
+				// the workers read native data owned by the simplifiers, so they must finish before we return or throw
+				if( m_Done != nullptr )
+				{
+					m_Done->WaitOne();
+					m_Done->Close();
+				}
+			}
+
+			if( m_Error != nullptr )
+				throw m_Error;
+
+			return m_Results;
+		}
+	};
+
+	static MeshSimplifier::MeshSimplifier()
+	{
+		m_MaximumDegreeOfParallelism = Environment::ProcessorCount;
+	}
+
+	MeshSimplifier::MeshSimplifier( DataStream^ vertices, int vertexCount, array<VertexElement>^ elements, DataStream^ indices, int faceCount, bool use32BitIndices )
+	{
+		// the defaults used by D3DXSimplifyMesh when no weights are given
+		AttributeWeights weights;
+		weights.Position = 1.0f;
+		weights.Boundary = 1.0f;
+		weights.Normal = 1.0f;
+
+		Construct( vertices, vertexCount, elements, indices, faceCount, use32BitIndices, weights, nullptr );
+	}
+
+	MeshSimplifier::MeshSimplifier( DataStream^ vertices, int vertexCount, array<VertexElement>^ elements, DataStream^ indices, int faceCount, bool use32BitIndices,
+		AttributeWeights attributeWeights, array<float>^ vertexWeights )
+	{
+		Construct( vertices, vertexCount, elements, indices, faceCount, use32BitIndices, attributeWeights, vertexWeights );
+	}
+
+	void MeshSimplifier::Construct( DataStream^ vertices, int vertexCount, array<VertexElement>^ elements, DataStream^ indices, int faceCount,
+		bool use32BitIndices, AttributeWeights attributeWeights, array<float>^ vertexWeights )
+	{
+		if( vertices == nullptr )
+			throw gcnew ArgumentNullException( "vertices" );
+		if( elements == nullptr )
+			throw gcnew ArgumentNullException( "elements" );
+		if( indices == nullptr )
+			throw gcnew ArgumentNullException( "indices" );
+		if( vertexCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexCount", "The vertex count must not be negative." );
+		if( faceCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "faceCount", "The face count must not be negative." );
+		if( vertexWeights != nullptr && vertexWeights->Length != vertexCount )
+			throw gcnew ArgumentException( "There must be one vertex weight per vertex.", "vertexWeights" );
+
+		int stride = 0;
+		int positionOffset = -1;
+		for( int i = 0; i < elements->Length; ++i )
+		{
+			if( elements[i].Stream != 0 )
+				continue;
+
+			int end = elements[i].Offset + GetDeclarationTypeSize( elements[i].Type );
+			stride = end > stride ? end : stride;
+
+			if( elements[i].Usage == DeclarationUsage::Position && elements[i].UsageIndex == 0 &&
+				( elements[i].Type == DeclarationType::Float3 || elements[i].Type == DeclarationType::Float4 ) )
+				positionOffset = elements[i].Offset;
+		}
+
+		if( positionOffset < 0 )
+			throw gcnew ArgumentException( "The declaration must contain a three or four component floating point position in stream zero.", "elements" );
+		if( vertices->RemainingLength < static_cast<Int64>( vertexCount ) * stride )
+			throw gcnew ArgumentException( "The data stream is too small for the vertex count.", "vertices" );
+		if( indices->RemainingLength < static_cast<Int64>( faceCount ) * 3 * ( use32BitIndices ? 4 : 2 ) )
+			throw gcnew ArgumentException( "The data stream is too small for the face count.", "indices" );
+
+		const unsigned char* indexData = reinterpret_cast<const unsigned char*>( indices->PositionPointer );
+		for( int i = 0; i < faceCount * 3; ++i )
+		{
+			unsigned int index = use32BitIndices ? reinterpret_cast<const unsigned int*>( indexData )[i] : reinterpret_cast<const unsigned short*>( indexData )[i];
+			if( index >= static_cast<unsigned int>( vertexCount ) )
+				throw gcnew ArgumentException( "The index data refers to vertices beyond the vertex count.", "indices" );
+		}
+
+		SimplifierMesh* mesh = new SimplifierMesh();
+		mesh->VertexCount = vertexCount;
+		mesh->PositionWeight = attributeWeights.Position;
+		mesh->BoundaryWeight = attributeWeights.Boundary;
+		mesh->Positions.resize( vertexCount * 3 );
+		mesh->AttributeCount = 0;
+
+		const unsigned char* vertexData = reinterpret_cast<const unsigned char*>( vertices->PositionPointer );
+		for( int v = 0; v < vertexCount; ++v )
+			memcpy( &mesh->Positions[v * 3], vertexData + v * stride + positionOffset, 3 * sizeof( float ) );
+
+		for( int i = 0; i < elements->Length; ++i )
+		{
+			if( elements[i].Stream == 0 && GetComponentWeight( elements[i], attributeWeights ) > 0.0f )
+				mesh->AttributeCount += GetComponentCount( elements[i].Type );
+		}
+
+		// weighted components are stored scaled by the square root of their weight, so plain squared distances apply the weight
+		mesh->Attributes.resize( static_cast<size_t>( vertexCount ) * mesh->AttributeCount );
+		for( int v = 0; v < vertexCount && mesh->AttributeCount > 0; ++v )
+		{
+			float* attributes = &mesh->Attributes[static_cast<size_t>( v ) * mesh->AttributeCount];
+			for( int i = 0; i < elements->Length; ++i )
+			{
+				float weight = GetComponentWeight( elements[i], attributeWeights );
+				int count = GetComponentCount( elements[i].Type );
+				if( elements[i].Stream != 0 || weight <= 0.0f || count == 0 )
+					continue;
+
+				float component[4];
+				ReadComponent( vertexData + v * stride + elements[i].Offset, elements[i].Type, component );
+
+				float scale = sqrtf( weight );
+				for( int k = 0; k < count; ++k )
+					*attributes++ = component[k] * scale;
+			}
+		}
+
+		if( vertexWeights != nullptr && vertexCount > 0 )
+		{
+			mesh->VertexWeights.resize( vertexCount );
+			pin_ptr<float> pinnedWeights = &vertexWeights[0];
+			memcpy( &mesh->VertexWeights[0], pinnedWeights, vertexCount * sizeof( float ) );
+		}
+
+		mesh->Indices.resize( faceCount * 3 );
+		for( int i = 0; i < faceCount * 3; ++i )
+			mesh->Indices[i] = use32BitIndices ? reinterpret_cast<const unsigned int*>( indexData )[i] : reinterpret_cast<const unsigned short*>( indexData )[i];
+
+		m_Mesh = mesh;
+		m_FaceCount = faceCount;
+		m_VertexCount = vertexCount;
+	}
+
+	MeshSimplifier::~MeshSimplifier()
+	{
+		this->!MeshSimplifier();
+	}
+
+	MeshSimplifier::!MeshSimplifier()
+	{
+		delete m_Mesh;
+		m_Mesh = NULL;
+	}
+
+	void MeshSimplifier::CheckDisposed()
+	{
+		if( m_Mesh == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	void MeshSimplifier::MaximumDegreeOfParallelism::set( int value )
+	{
+		if( value <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "value", "The degree of parallelism must be greater than zero." );
+
+		m_MaximumDegreeOfParallelism = value;
+	}
+
+	array<array<int>^>^ MeshSimplifier::GenerateLodChain( array<int>^ minimumValues, MeshSimplification options )
+	{
+		array<float>^ errors;
+		return GenerateLodChain( minimumValues, options, errors );
+	}
+
+	array<array<int>^>^ MeshSimplifier::GenerateLodChain( array<int>^ minimumValues, MeshSimplification options, [Out] array<float>^% errors )
+	{
+		CheckDisposed();
+		CheckOptions( options );
+		if( minimumValues == nullptr )
+			throw gcnew ArgumentNullException( "minimumValues" );
+
+		std::vector<int> targets( minimumValues->Length );
+		for( int i = 0; i < minimumValues->Length; ++i )
+		{
+			if( minimumValues[i] < 0 || ( i > 0 && minimumValues[i] > minimumValues[i - 1] ) )
+				throw gcnew ArgumentException( "The minimum values must not be negative, and must not increase from one level to the next.", "minimumValues" );
+
+			targets[i] = minimumValues[i];
+		}
+
+		std::vector<std::vector<unsigned int> > levels;
+		std::vector<float> nativeErrors;
+		SimplifyMesh( *m_Mesh, targets.empty() ? NULL : &targets[0], static_cast<int>( targets.size() ),
+			options == MeshSimplification::Vertex, levels, nativeErrors );
+
+		errors = gcnew array<float>( static_cast<int>( nativeErrors.size() ) );
+		for( int i = 0; i < errors->Length; ++i )
+			errors[i] = nativeErrors[i];
+
+		return ToManaged( levels );
+	}
+
+	array<array<array<int>^>^>^ MeshSimplifier::GenerateLodChains( array<MeshSimplifier^>^ simplifiers, array<float>^ ratios, MeshSimplification options )
+	{
+		if( simplifiers == nullptr )
+			throw gcnew ArgumentNullException( "simplifiers" );
+		if( ratios == nullptr )
+			throw gcnew ArgumentNullException( "ratios" );
+		CheckOptions( options );
+
+		for( int i = 0; i < ratios->Length; ++i )
+		{
+			if( !( ratios[i] >= 0.0f && ratios[i] <= 1.0f ) || ( i > 0 && ratios[i] > ratios[i - 1] ) )
+				throw gcnew ArgumentException( "The ratios must lie between zero and one, and must not increase from one level to the next.", "ratios" );
+		}
+
+		// checked up front so that a bad entry fails before any mesh is simplified
+		for( int i = 0; i < simplifiers->Length; ++i )
+		{
+			if( simplifiers[i] == nullptr )
+				throw gcnew ArgumentException( "The array must not contain null references.", "simplifiers" );
+
+			simplifiers[i]->CheckDisposed();
+		}
+
+		MeshSimplifierWorker^ worker = gcnew MeshSimplifierWorker( simplifiers, ratios, options );
+		return worker->Run( m_MaximumDegreeOfParallelism );
+	}
+}
+}
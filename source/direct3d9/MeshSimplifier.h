@@ -0,0 +1,157 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../DataStream.h"
+
+#include "AttributeWeights.h"
+#include "VertexElement.h"
+
+using System::Runtime::InteropServices::OutAttribute;
+
+namespace SlimDX
+{
+	struct SimplifierMesh;
+
+	namespace Direct3D9
+	{
+		/// <summary>
+		/// Simplifies raw vertex and index data into a chain of levels of detail using a quadric error metric, without requiring a device.
+		/// </summary>
+		/// <remarks>
+		/// The data is copied when the simplifier is created, so the source streams may be released afterwards.
+		/// Simplification only removes triangles and moves them onto existing vertices, so every level indexes the
+		/// original vertex buffer and only the index data differs between levels. Vertices that share a position but
+		/// differ in other components, such as along texture seams, are kept together.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class MeshSimplifier sealed
+		{
+		private:
+			SimplifierMesh* m_Mesh;
+			int m_FaceCount;
+			int m_VertexCount;
+
+			static int m_MaximumDegreeOfParallelism;
+
+			static MeshSimplifier();
+			void Construct( DataStream^ vertices, int vertexCount, array<VertexElement>^ elements, DataStream^ indices, int faceCount,
+				bool use32BitIndices, AttributeWeights attributeWeights, array<float>^ vertexWeights );
+			void CheckDisposed();
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="MeshSimplifier"/> class with the default D3DX attribute weights.
+			/// </summary>
+			/// <param name="vertices">The vertex data, laid out as described by the elements in stream zero.</param>
+			/// <param name="vertexCount">The number of vertices.</param>
+			/// <param name="elements">The vertex declaration; it must contain a three or four component floating point position.</param>
+			/// <param name="indices">The index data of a triangle list.</param>
+			/// <param name="faceCount">The number of triangles.</param>
+			/// <param name="use32BitIndices"><c>true</c> if the indices are 32 bits wide; <c>false</c> if they are 16 bits wide.</param>
+			MeshSimplifier( DataStream^ vertices, int vertexCount, array<VertexElement>^ elements, DataStream^ indices, int faceCount, bool use32BitIndices );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="MeshSimplifier"/> class.
+			/// </summary>
+			/// <param name="vertices">The vertex data, laid out as described by the elements in stream zero.</param>
+			/// <param name="vertexCount">The number of vertices.</param>
+			/// <param name="elements">The vertex declaration; it must contain a three or four component floating point position.</param>
+			/// <param name="indices">The index data of a triangle list.</param>
+			/// <param name="faceCount">The number of triangles.</param>
+			/// <param name="use32BitIndices"><c>true</c> if the indices are 32 bits wide; <c>false</c> if they are 16 bits wide.</param>
+			/// <param name="attributeWeights">The weight of each vertex component in the error metric; components with a weight of zero are ignored.</param>
+			/// <param name="vertexWeights">
+			/// One weight per vertex, or <c>null</c>. The higher the weight, the less likely the vertex is to be removed.
+			/// </param>
+			MeshSimplifier( DataStream^ vertices, int vertexCount, array<VertexElement>^ elements, DataStream^ indices, int faceCount, bool use32BitIndices,
+				AttributeWeights attributeWeights, array<float>^ vertexWeights );
+
+			/// <summary>
+			/// Releases the copied mesh data.
+			/// </summary>
+			~MeshSimplifier();
+
+			/// <summary>
+			/// Releases the copied mesh data.
+			/// </summary>
+			!MeshSimplifier();
+
+			/// <summary>
+			/// Gets the number of triangles in the source mesh.
+			/// </summary>
+			property int FaceCount
+			{
+				int get() { return m_FaceCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of vertices in the source mesh.
+			/// </summary>
+			property int VertexCount
+			{
+				int get() { return m_VertexCount; }
+			}
+
+			/// <summary>
+			/// Generates a chain of levels of detail in a single pass.
+			/// </summary>
+			/// <param name="minimumValues">The face or vertex count to reduce each level to, in decreasing order.</param>
+			/// <param name="options">Whether the minimum values are vertex or face counts.</param>
+			/// <returns>
+			/// The 32 bit triangle list indices of each level. A level may hold more than its minimum value when
+			/// no further simplification is possible without folding or tearing the mesh.
+			/// </returns>
+			array<array<int>^>^ GenerateLodChain( array<int>^ minimumValues, MeshSimplification options );
+
+			/// <summary>
+			/// Generates a chain of levels of detail in a single pass.
+			/// </summary>
+			/// <param name="minimumValues">The face or vertex count to reduce each level to, in decreasing order.</param>
+			/// <param name="options">Whether the minimum values are vertex or face counts.</param>
+			/// <param name="errors">When the method completes, contains the approximate geometric error of each level, in the units of the positions.</param>
+			/// <returns>
+			/// The 32 bit triangle list indices of each level. A level may hold more than its minimum value when
+			/// no further simplification is possible without folding or tearing the mesh.
+			/// </returns>
+			array<array<int>^>^ GenerateLodChain( array<int>^ minimumValues, MeshSimplification options, [Out] array<float>^% errors );
+
+			/// <summary>
+			/// Generates chains of levels of detail for several meshes, processing the meshes in parallel.
+			/// </summary>
+			/// <param name="simplifiers">The meshes to simplify.</param>
+			/// <param name="ratios">The fraction of each mesh's faces or vertices to keep at each level, in decreasing order.</param>
+			/// <param name="options">Whether the ratios apply to vertex or face counts.</param>
+			/// <returns>For each mesh, the 32 bit triangle list indices of each level.</returns>
+			static array<array<array<int>^>^>^ GenerateLodChains( array<MeshSimplifier^>^ simplifiers, array<float>^ ratios, MeshSimplification options );
+
+			/// <summary>
+			/// Gets or sets the maximum number of meshes simplified at once by <see cref="GenerateLodChains"/>. The default is the number of processors.
+			/// </summary>
+			static property int MaximumDegreeOfParallelism
+			{
+				int get() { return m_MaximumDegreeOfParallelism; }
+				void set( int value );
+			}
+		};
+	}
+}
@@ -47,8 +47,8 @@ namespace Direct3D9
 		ID3DXPatchMesh *result;
 		pin_ptr<VertexElement> pinnedElements = &vertexDeclaration[0];
 
-		HRESULT hr = D3DXCreatePatchMesh( reinterpret_cast<D3DXPATCHINFO*>( &info ), patchCount, vertexCount, 0, 
-			reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedElements ), device->InternalPointer, &result );
+		HRESULT hr = TIME_CALL( D3DXCreatePatchMesh( reinterpret_cast<D3DXPATCHINFO*>( &info ), patchCount, vertexCount, 0, 
+			reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedElements ), device->InternalPointer, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -60,7 +60,7 @@ namespace Direct3D9
 	{
 		ID3DXPatchMesh *result;
 
-		HRESULT hr = D3DXCreateNPatchMesh( mesh->InternalPointer, &result );
+		HRESULT hr = TIME_CALL( D3DXCreateNPatchMesh( mesh->InternalPointer, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -76,8 +76,8 @@ namespace Direct3D9
 		ID3DXBuffer* instanceBuffer;
 		DWORD materialCount;
 		
-		HRESULT hr = D3DXLoadPatchMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), device->InternalPointer,
-			&materialBuffer, &instanceBuffer, &materialCount, &mesh );
+		HRESULT hr = TIME_CALL( D3DXLoadPatchMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), device->InternalPointer,
+			&materialBuffer, &instanceBuffer, &materialCount, &mesh ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -103,8 +103,8 @@ namespace Direct3D9
 		ID3DXBuffer* materialBuffer;
 		DWORD materialCount;
 		
-		HRESULT hr = D3DXLoadPatchMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), device->InternalPointer,
-			&materialBuffer, NULL, &materialCount, &mesh );
+		HRESULT hr = TIME_CALL( D3DXLoadPatchMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), device->InternalPointer,
+			&materialBuffer, NULL, &materialCount, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -122,8 +122,8 @@ namespace Direct3D9
 	{
 		ID3DXPatchMesh* mesh;
 
-		HRESULT hr = D3DXLoadPatchMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), 
-			device->InternalPointer, NULL, NULL, NULL, &mesh );
+		HRESULT hr = TIME_CALL( D3DXLoadPatchMeshFromXof( xfile->InternalPointer, static_cast<DWORD>( flags ), 
+			device->InternalPointer, NULL, NULL, NULL, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -136,7 +136,7 @@ namespace Direct3D9
 		ID3DXPatchMesh *result;
 		pin_ptr<VertexElement> pinnedElements = &vertexDeclaration[0];
 
-		HRESULT hr = InternalPointer->CloneMesh( static_cast<DWORD>( flags ), reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedElements ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMesh( static_cast<DWORD>( flags ), reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedElements ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -146,7 +146,7 @@ namespace Direct3D9
 
 	Result PatchMesh::GenerateAdjacency( float tolerance )
 	{
-		HRESULT hr = InternalPointer->GenerateAdjacency( tolerance );
+		HRESULT hr = TIME_CALL( InternalPointer->GenerateAdjacency( tolerance ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -154,7 +154,7 @@ namespace Direct3D9
 	{
 		D3DVERTEXELEMENT9 elementBuffer[MAX_FVF_DECL_SIZE];
 
-		HRESULT hr = InternalPointer->GetDeclaration( elementBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeclaration( elementBuffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -174,7 +174,7 @@ namespace Direct3D9
 	{
 		IDirect3DDevice9* device;
 
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -186,7 +186,7 @@ namespace Direct3D9
 	{
 		IDirect3DIndexBuffer9* ib;
 
-		HRESULT hr = InternalPointer->GetIndexBuffer( &ib );
+		HRESULT hr = TIME_CALL( InternalPointer->GetIndexBuffer( &ib ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -198,7 +198,7 @@ namespace Direct3D9
 	{
 		IDirect3DVertexBuffer9* vb;
 
-		HRESULT hr = InternalPointer->GetVertexBuffer( &vb );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexBuffer( &vb ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -210,7 +210,7 @@ namespace Direct3D9
 	{
 		SlimDX::Direct3D9::PatchInfo result;
 
-		HRESULT hr = InternalPointer->GetPatchInfo( reinterpret_cast<D3DXPATCHINFO*>( &result ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPatchInfo( reinterpret_cast<D3DXPATCHINFO*>( &result ) ) );
 		RECORD_D3D9( hr );
 
 		return result;
@@ -218,7 +218,7 @@ namespace Direct3D9
 
 	Result PatchMesh::Optimize()
 	{
-		HRESULT hr = InternalPointer->Optimize( 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->Optimize( 0 ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -232,7 +232,7 @@ namespace Direct3D9
 		D3DTEXTUREADDRESS wrap;
 		DWORD lodBias;
 
-		HRESULT hr = InternalPointer->GetDisplaceParam( &texture, &minFilter, &magFilter, &mipFilter, &wrap, &lodBias );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplaceParam( &texture, &minFilter, &magFilter, &mipFilter, &wrap, &lodBias ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return result;
@@ -249,9 +249,9 @@ namespace Direct3D9
 
 	void PatchMesh::DisplacementParameters::set( SlimDX::Direct3D9::DisplacementParameters parameters )
 	{
-		HRESULT hr = InternalPointer->SetDisplaceParam( reinterpret_cast<IDirect3DTexture9*>( parameters.Texture->InternalPointer ), 
+		HRESULT hr = TIME_CALL( InternalPointer->SetDisplaceParam( reinterpret_cast<IDirect3DTexture9*>( parameters.Texture->InternalPointer ), 
 			static_cast<D3DTEXTUREFILTERTYPE>( parameters.MinFilter ), static_cast<D3DTEXTUREFILTERTYPE>( parameters.MagFilter ),
-			static_cast<D3DTEXTUREFILTERTYPE>( parameters.MipFilter ), static_cast<D3DTEXTUREADDRESS>( parameters.Wrap ), parameters.LevelOfDetailBias );
+			static_cast<D3DTEXTUREFILTERTYPE>( parameters.MipFilter ), static_cast<D3DTEXTUREADDRESS>( parameters.Wrap ), parameters.LevelOfDetailBias ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -260,7 +260,7 @@ namespace Direct3D9
 		DWORD *data;
 		int faceCount = InternalPointer->GetNumPatches();
 		
-		HRESULT hr = InternalPointer->LockAttributeBuffer( static_cast<DWORD>( flags ), &data );
+		HRESULT hr = TIME_CALL( InternalPointer->LockAttributeBuffer( static_cast<DWORD>( flags ), &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -271,7 +271,7 @@ namespace Direct3D9
 
 	Result PatchMesh::UnlockAttributeBuffer()
 	{
-		HRESULT hr = InternalPointer->UnlockAttributeBuffer();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockAttributeBuffer() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -280,14 +280,14 @@ namespace Direct3D9
 		void *data;
 		IDirect3DIndexBuffer9 *indexBuffer;
 		
-		HRESULT hr = InternalPointer->GetIndexBuffer( &indexBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetIndexBuffer( &indexBuffer ) );
 		RECORD_D3D9( hr );
 		D3DINDEXBUFFER_DESC description;
-		hr = indexBuffer->GetDesc( &description );
+		hr = TIME_CALL( indexBuffer->GetDesc( &description ) );
 		indexBuffer->Release();
 		RECORD_D3D9( hr );
 		
-		hr = InternalPointer->LockIndexBuffer( static_cast<DWORD>( flags ), &data );
+		hr = TIME_CALL( InternalPointer->LockIndexBuffer( static_cast<DWORD>( flags ), &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -298,7 +298,7 @@ namespace Direct3D9
 
 	Result PatchMesh::UnlockIndexBuffer()
 	{
-		HRESULT hr = InternalPointer->UnlockIndexBuffer();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockIndexBuffer() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -307,14 +307,14 @@ namespace Direct3D9
 		void *data;
 		IDirect3DVertexBuffer9* vertexBuffer;
 
-		HRESULT hr = InternalPointer->GetVertexBuffer( &vertexBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexBuffer( &vertexBuffer ) );
 		RECORD_D3D9( hr );
 		D3DVERTEXBUFFER_DESC description;
-		hr = vertexBuffer->GetDesc( &description );
+		hr = TIME_CALL( vertexBuffer->GetDesc( &description ) );
 		vertexBuffer->Release();
 		RECORD_D3D9( hr );
 		
-		hr = InternalPointer->LockVertexBuffer( static_cast<DWORD>( flags ), &data );
+		hr = TIME_CALL( InternalPointer->LockVertexBuffer( static_cast<DWORD>( flags ), &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -325,7 +325,7 @@ namespace Direct3D9
 
 	Result PatchMesh::UnlockVertexBuffer()
 	{
-		HRESULT hr = InternalPointer->UnlockVertexBuffer();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockVertexBuffer() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -334,21 +334,21 @@ namespace Direct3D9
 		pin_ptr<int> pinnedTriCount = &triangleCount;
 		pin_ptr<int> pinnedVertexCount = &vertexCount;
 
-		HRESULT hr = InternalPointer->GetTessSize( tessellationLevel, adaptive, reinterpret_cast<DWORD*>( pinnedTriCount ), 
-			reinterpret_cast<DWORD*>( pinnedVertexCount ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTessSize( tessellationLevel, adaptive, reinterpret_cast<DWORD*>( pinnedTriCount ), 
+			reinterpret_cast<DWORD*>( pinnedVertexCount ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result PatchMesh::Tessellate( float tessellationLevel, Mesh^ mesh )
 	{
-		HRESULT hr = InternalPointer->Tessellate( tessellationLevel, reinterpret_cast<ID3DXMesh*>( mesh->InternalPointer ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Tessellate( tessellationLevel, reinterpret_cast<ID3DXMesh*>( mesh->InternalPointer ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result PatchMesh::Tessellate( Vector4 translation, int minimumLevel, int maximumLevel, Mesh^ mesh )
 	{
-		HRESULT hr = InternalPointer->TessellateAdaptive( reinterpret_cast<D3DXVECTOR4*>( &translation ), maximumLevel, minimumLevel, 
-			reinterpret_cast<ID3DXMesh*>( mesh->InternalPointer ) );
+		HRESULT hr = TIME_CALL( InternalPointer->TessellateAdaptive( reinterpret_cast<D3DXVECTOR4*>( &translation ), maximumLevel, minimumLevel, 
+			reinterpret_cast<ID3DXMesh*>( mesh->InternalPointer ) ) );
 		return RECORD_D3D9( hr );
 	}
 
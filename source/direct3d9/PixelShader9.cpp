@@ -44,7 +44,7 @@ namespace Direct3D9
 	{
 		IDirect3DPixelShader9 *result;
 
-		HRESULT hr = device->InternalPointer->CreatePixelShader( reinterpret_cast<const DWORD*>( function->Data->PositionPointer ), &result );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreatePixelShader( reinterpret_cast<const DWORD*>( function->Data->PositionPointer ), &result ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -57,7 +57,7 @@ namespace Direct3D9
 	{
 		IDirect3DDevice9* device;
 
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -71,16 +71,16 @@ namespace Direct3D9
 			return m_function;
 
 		UINT size;
-		HRESULT hr = InternalPointer->GetFunction( NULL, &size );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFunction( NULL, &size ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
 		ID3DXBuffer *functionMemory;
-		hr = D3DXCreateBuffer( size, &functionMemory );
+		hr = TIME_CALL( D3DXCreateBuffer( size, &functionMemory ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
-		hr = InternalPointer->GetFunction( functionMemory->GetBufferPointer(), &size );
+		hr = TIME_CALL( InternalPointer->GetFunction( functionMemory->GetBufferPointer(), &size ) );
 		if( FAILED( hr ) )
 			functionMemory->Release();
 
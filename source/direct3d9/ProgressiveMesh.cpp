@@ -234,9 +234,9 @@ namespace Direct3D9
 		pin_ptr<float> pinnedVW = &vertexWeights[0];
 		pin_ptr<AttributeWeights> pinnedAW = &attributeWeights[0];
 
-		HRESULT hr = D3DXGeneratePMesh( mesh->InternalPointer, adjacencyIn,
+		HRESULT hr = TIME_CALL( D3DXGeneratePMesh( mesh->InternalPointer, adjacencyIn,
 			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedAW ), reinterpret_cast<const FLOAT*>( pinnedVW ),
-			minimumValue, static_cast<DWORD>( options ), &result );
+			minimumValue, static_cast<DWORD>( options ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -261,9 +261,9 @@ namespace Direct3D9
 
 		pin_ptr<AttributeWeights> pinnedAW = &attributeWeights[0];
 
-		HRESULT hr = D3DXGeneratePMesh( mesh->InternalPointer, adjacencyIn,
+		HRESULT hr = TIME_CALL( D3DXGeneratePMesh( mesh->InternalPointer, adjacencyIn,
 			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedAW ), NULL,
-			minimumValue, static_cast<DWORD>( options ), &result );
+			minimumValue, static_cast<DWORD>( options ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -285,8 +285,8 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXGeneratePMesh( mesh->InternalPointer, adjacencyIn,
-			NULL, NULL, minimumValue, static_cast<DWORD>( options ), &result );
+		HRESULT hr = TIME_CALL( D3DXGeneratePMesh( mesh->InternalPointer, adjacencyIn,
+			NULL, NULL, minimumValue, static_cast<DWORD>( options ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -304,8 +304,8 @@ namespace Direct3D9
 		StreamShim^ shim = gcnew StreamShim( stream );
 		pin_ptr<StreamShim^> nativeStream = &shim;
 
-		HRESULT hr = D3DXCreatePMeshFromStream( reinterpret_cast<IStream*>( nativeStream ), static_cast<DWORD>( flags ),
-			device->InternalPointer, &om, &oe, &numMaterials, &result );
+		HRESULT hr = TIME_CALL( D3DXCreatePMeshFromStream( reinterpret_cast<IStream*>( nativeStream ), static_cast<DWORD>( flags ),
+			device->InternalPointer, &om, &oe, &numMaterials, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -323,8 +323,8 @@ namespace Direct3D9
 		ID3DXPMesh* mesh = NULL;
 		pin_ptr<VertexElement> pinned_elements = &vertexDeclaration[0];
 
-		HRESULT hr = InternalPointer->ClonePMesh( static_cast<DWORD>( flags ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinned_elements ),
-			device->InternalPointer, &mesh );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMesh( static_cast<DWORD>( flags ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinned_elements ),
+			device->InternalPointer, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -336,8 +336,8 @@ namespace Direct3D9
 	{
 		ID3DXPMesh* mesh = NULL;
 
-		HRESULT hr = InternalPointer->ClonePMeshFVF( static_cast<DWORD>( flags ), static_cast<DWORD>( format ), 
-			device->InternalPointer, &mesh );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMeshFVF( static_cast<DWORD>( flags ), static_cast<DWORD>( format ), 
+			device->InternalPointer, &mesh ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -349,7 +349,7 @@ namespace Direct3D9
 	{
 		pin_ptr<int> pinned = &vertexHistory[0];
 
-		HRESULT hr = InternalPointer->GenerateVertexHistory( reinterpret_cast<DWORD*>( pinned ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GenerateVertexHistory( reinterpret_cast<DWORD*>( pinned ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -358,7 +358,7 @@ namespace Direct3D9
 		array<int>^ adjacency = gcnew array<int>( 3 * MaximumFaceCount );
 		pin_ptr<int> pinnedAdj = &adjacency[0];
 
-		HRESULT hr = InternalPointer->GetAdjacency( reinterpret_cast<DWORD*>( pinnedAdj ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAdjacency( reinterpret_cast<DWORD*>( pinnedAdj ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -373,7 +373,7 @@ namespace Direct3D9
 		array<int>^ adjacencyOut = gcnew array<int>( FaceCount * 3 );
 		pin_ptr<int> pinnedAdj = &adjacencyOut[0];
 
-		HRESULT hr = InternalPointer->Optimize( static_cast<DWORD>( flags ), reinterpret_cast<DWORD*>( pinnedAdj ), NULL, NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->Optimize( static_cast<DWORD>( flags ), reinterpret_cast<DWORD*>( pinnedAdj ), NULL, NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -394,8 +394,8 @@ namespace Direct3D9
 		array<int>^ adjacencyOut = gcnew array<int>( FaceCount * 3 );
 		pin_ptr<int> pinnedAdj = &adjacencyOut[0];
 
-		HRESULT hr = InternalPointer->Optimize( static_cast<DWORD>( flags ), reinterpret_cast<DWORD*>( pinnedAdj ), 
-			reinterpret_cast<DWORD*>( pinnedFR ), &buffer, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->Optimize( static_cast<DWORD>( flags ), reinterpret_cast<DWORD*>( pinnedAdj ), 
+			reinterpret_cast<DWORD*>( pinnedFR ), &buffer, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -413,7 +413,7 @@ namespace Direct3D9
 
 	Result ProgressiveMesh::OptimizeBaseLevelOfDetail( MeshOptimizeFlags flags )
 	{
-		HRESULT hr = InternalPointer->OptimizeBaseLOD( static_cast<DWORD>( flags ), NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->OptimizeBaseLOD( static_cast<DWORD>( flags ), NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -421,7 +421,7 @@ namespace Direct3D9
 	{
 		faceRemap = gcnew array<int>( FaceCount );
 		pin_ptr<int> pinnedFR = &faceRemap[0];
-		HRESULT hr = InternalPointer->OptimizeBaseLOD( static_cast<DWORD>( flags ), reinterpret_cast<DWORD*>( pinnedFR ) );
+		HRESULT hr = TIME_CALL( InternalPointer->OptimizeBaseLOD( static_cast<DWORD>( flags ), reinterpret_cast<DWORD*>( pinnedFR ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -450,7 +450,7 @@ namespace Direct3D9
 				nativeEffects[i] = EffectInstance::ToUnmanaged( effects[i] );
 		}
 
-		HRESULT hr = mesh->InternalPointer->Save( reinterpret_cast<IStream*>( nativeStream ), &nativeMaterials[0], &nativeEffects[0], materials->Length );
+		HRESULT hr = TIME_CALL( mesh->InternalPointer->Save( reinterpret_cast<IStream*>( nativeStream ), &nativeMaterials[0], &nativeEffects[0], materials->Length ) );
 		
 		for( int i = 0; i < materials->Length; i++ )
 			Utilities::FreeNativeString( nativeMaterials[i].pTextureFilename );
@@ -468,19 +468,19 @@ namespace Direct3D9
 
 	Result ProgressiveMesh::SetFaceCount( int faceCount )
 	{
-		HRESULT hr = InternalPointer->SetNumFaces( faceCount );
+		HRESULT hr = TIME_CALL( InternalPointer->SetNumFaces( faceCount ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result ProgressiveMesh::SetVertexCount( int vertexCount )
 	{
-		HRESULT hr = InternalPointer->SetNumVertices( vertexCount );
+		HRESULT hr = TIME_CALL( InternalPointer->SetNumVertices( vertexCount ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result ProgressiveMesh::TrimFaces( int newFaceMinimum, int newFaceMaximum )
 	{
-		HRESULT hr = InternalPointer->TrimByFaces( newFaceMinimum, newFaceMaximum, NULL, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->TrimByFaces( newFaceMinimum, newFaceMaximum, NULL, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -491,14 +491,14 @@ namespace Direct3D9
 		pin_ptr<int> pinnedFR = &faceRemap[0];
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->TrimByFaces( newFaceMinimum, newFaceMaximum, reinterpret_cast<DWORD*>( pinnedFR ), 
-			reinterpret_cast<DWORD*>( pinnedVR ) );
+		HRESULT hr = TIME_CALL( InternalPointer->TrimByFaces( newFaceMinimum, newFaceMaximum, reinterpret_cast<DWORD*>( pinnedFR ), 
+			reinterpret_cast<DWORD*>( pinnedVR ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result ProgressiveMesh::TrimVertices( int newVertexMinimum, int newVertexMaximum )
 	{
-		HRESULT hr = InternalPointer->TrimByVertices( newVertexMinimum, newVertexMaximum, NULL, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->TrimByVertices( newVertexMinimum, newVertexMaximum, NULL, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -509,8 +509,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedFR = &faceRemap[0];
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->TrimByVertices( newVertexMinimum, newVertexMaximum, reinterpret_cast<DWORD*>( pinnedFR ), 
-			reinterpret_cast<DWORD*>( pinnedVR ) );
+		HRESULT hr = TIME_CALL( InternalPointer->TrimByVertices( newVertexMinimum, newVertexMaximum, reinterpret_cast<DWORD*>( pinnedFR ), 
+			reinterpret_cast<DWORD*>( pinnedVR ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -48,7 +48,7 @@ namespace Direct3D9
 	Query::Query( SlimDX::Direct3D9::Device^ device, QueryType type )
 	{
 		IDirect3DQuery9* query;
-		HRESULT hr = device->InternalPointer->CreateQuery( static_cast<D3DQUERYTYPE>( type ), &query );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateQuery( static_cast<D3DQUERYTYPE>( type ), &query ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( "Failed to create Query." );
@@ -69,7 +69,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::Device^ Query::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -79,13 +79,13 @@ namespace Direct3D9
 
 	Result Query::Issue( SlimDX::Direct3D9::Issue flags )
 	{
-		HRESULT hr = InternalPointer->Issue( static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Issue( static_cast<DWORD>( flags ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	bool Query::CheckStatus( bool flush )
 	{
-		HRESULT hr = InternalPointer->GetData( NULL, 0, flush ? D3DGETDATA_FLUSH : 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->GetData( NULL, 0, flush ? D3DGETDATA_FLUSH : 0 ) );
 		
 		switch( hr )
 		{
@@ -184,7 +184,7 @@ namespace Direct3D9
 		{
 			//need to marshal BOOL (int) to bool
 			BOOL value = FALSE;
-			hr = InternalPointer->GetData( &value, sizeof(BOOL), flags );
+			hr = TIME_CALL( InternalPointer->GetData( &value, sizeof(BOOL), flags ) );
 			RECORD_D3D9( hr );
 			//we know that T is a bool, but the runtime does not
 			return (T) (value > 0);
@@ -192,7 +192,7 @@ namespace Direct3D9
 		else
 		{
 			T data;
-			hr = InternalPointer->GetData( &data, static_cast<DWORD>( sizeof(T) ), flags );
+			hr = TIME_CALL( InternalPointer->GetData( &data, static_cast<DWORD>( sizeof(T) ), flags ) );
 			RECORD_D3D9( hr );
 			return data;
 		}
@@ -39,8 +39,8 @@ namespace Direct3D9
 	{
 		ID3DXRenderToEnvMap *result;
 
-		HRESULT hr = D3DXCreateRenderToEnvMap( device->InternalPointer, size, mipLevels, static_cast<D3DFORMAT>( format ),
-			true, static_cast<D3DFORMAT>( depthStencilFormat ), &result );
+		HRESULT hr = TIME_CALL( D3DXCreateRenderToEnvMap( device->InternalPointer, size, mipLevels, static_cast<D3DFORMAT>( format ),
+			true, static_cast<D3DFORMAT>( depthStencilFormat ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -52,8 +52,8 @@ namespace Direct3D9
 	{
 		ID3DXRenderToEnvMap *result;
 
-		HRESULT hr = D3DXCreateRenderToEnvMap( device->InternalPointer, size, mipLevels, static_cast<D3DFORMAT>( format ),
-			false, D3DFMT_UNKNOWN, &result );
+		HRESULT hr = TIME_CALL( D3DXCreateRenderToEnvMap( device->InternalPointer, size, mipLevels, static_cast<D3DFORMAT>( format ),
+			false, D3DFMT_UNKNOWN, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -63,37 +63,37 @@ namespace Direct3D9
 
 	Result RenderToEnvironmentMap::BeginCube( CubeTexture^ texture )
 	{
-		HRESULT hr = InternalPointer->BeginCube( texture->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->BeginCube( texture->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToEnvironmentMap::BeginHemisphere( Texture^ positiveZTexture, Texture^ negativeZTexture )
 	{
-		HRESULT hr = InternalPointer->BeginHemisphere( positiveZTexture->InternalPointer, negativeZTexture->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->BeginHemisphere( positiveZTexture->InternalPointer, negativeZTexture->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToEnvironmentMap::BeginParabolic( Texture^ positiveZTexture, Texture^ negativeZTexture )
 	{
-		HRESULT hr = InternalPointer->BeginParabolic( positiveZTexture->InternalPointer, negativeZTexture->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->BeginParabolic( positiveZTexture->InternalPointer, negativeZTexture->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToEnvironmentMap::BeginSphere( Texture^ texture )
 	{
-		HRESULT hr = InternalPointer->BeginSphere( texture->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->BeginSphere( texture->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToEnvironmentMap::End( Filter mipFilter )
 	{
-		HRESULT hr = InternalPointer->End( static_cast<DWORD>( mipFilter ) );
+		HRESULT hr = TIME_CALL( InternalPointer->End( static_cast<DWORD>( mipFilter ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToEnvironmentMap::Face( CubeMapFace face, Filter mipFilter )
 	{
-		HRESULT hr = InternalPointer->Face( static_cast<D3DCUBEMAP_FACES>( face ), static_cast<DWORD>( mipFilter ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Face( static_cast<D3DCUBEMAP_FACES>( face ), static_cast<DWORD>( mipFilter ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -101,7 +101,7 @@ namespace Direct3D9
 	{
 		IDirect3DDevice9* device;
 
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -111,13 +111,13 @@ namespace Direct3D9
 
 	Result RenderToEnvironmentMap::OnLostDevice()
 	{
-		HRESULT hr = InternalPointer->OnLostDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnLostDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToEnvironmentMap::OnResetDevice()
 	{
-		HRESULT hr = InternalPointer->OnResetDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnResetDevice() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -125,7 +125,7 @@ namespace Direct3D9
 	{
 		D3DXRTE_DESC description = {0};
 
-		HRESULT hr = InternalPointer->GetDesc( &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( &description ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return RenderToEnvironmentMapDescription();
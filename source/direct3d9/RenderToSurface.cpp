@@ -38,7 +38,7 @@ namespace Direct3D9
 	RenderToSurface::RenderToSurface( SlimDX::Direct3D9::Device^ device, int width, int height, Format format )
 	{
 		ID3DXRenderToSurface* rtsPointer;
-		HRESULT hr = D3DXCreateRenderToSurface( device->InternalPointer, width, height, static_cast<D3DFORMAT>( format ), FALSE, D3DFMT_UNKNOWN, &rtsPointer );
+		HRESULT hr = TIME_CALL( D3DXCreateRenderToSurface( device->InternalPointer, width, height, static_cast<D3DFORMAT>( format ), FALSE, D3DFMT_UNKNOWN, &rtsPointer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -49,8 +49,8 @@ namespace Direct3D9
 	RenderToSurface::RenderToSurface( SlimDX::Direct3D9::Device^ device, int width, int height, Format format, Format depthStencilFormat )
 	{
 		ID3DXRenderToSurface* rtsPointer;
-		HRESULT hr = D3DXCreateRenderToSurface( device->InternalPointer, width, height,
-			static_cast<D3DFORMAT>( format ), TRUE, static_cast<D3DFORMAT>( depthStencilFormat ), &rtsPointer );
+		HRESULT hr = TIME_CALL( D3DXCreateRenderToSurface( device->InternalPointer, width, height,
+			static_cast<D3DFORMAT>( format ), TRUE, static_cast<D3DFORMAT>( depthStencilFormat ), &rtsPointer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -61,20 +61,20 @@ namespace Direct3D9
 	Result RenderToSurface::BeginScene( Surface^ renderSurface, Viewport viewport )
 	{
 		IDirect3DSurface9* surface = renderSurface->InternalPointer;
-		HRESULT hr = InternalPointer->BeginScene( surface, reinterpret_cast<D3DVIEWPORT9*>( &viewport ) );
+		HRESULT hr = TIME_CALL( InternalPointer->BeginScene( surface, reinterpret_cast<D3DVIEWPORT9*>( &viewport ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToSurface::EndScene( Filter mipFilter )
 	{
-		HRESULT hr = InternalPointer->EndScene( static_cast<DWORD>( mipFilter ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EndScene( static_cast<DWORD>( mipFilter ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	SlimDX::Direct3D9::Device^ RenderToSurface::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -84,20 +84,20 @@ namespace Direct3D9
 
 	Result RenderToSurface::OnLostDevice()
 	{
-		HRESULT hr = InternalPointer->OnLostDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnLostDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result RenderToSurface::OnResetDevice()
 	{
-		HRESULT hr = InternalPointer->OnResetDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnResetDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	RenderToSurfaceDescription RenderToSurface::Description::get()
 	{
 		D3DXRTS_DESC description = {0};
-		HRESULT hr = InternalPointer->GetDesc( &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( &description ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return RenderToSurfaceDescription();
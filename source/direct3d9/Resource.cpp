@@ -58,7 +58,7 @@ namespace Direct3D9
 
 		void* result = 0;
 		IUnknown* unknown = static_cast<IUnknown*>( pointer.ToPointer() );
-		HRESULT hr = unknown->QueryInterface(IID_IDirect3DResource9, &result);
+		HRESULT hr = TIME_CALL( unknown->QueryInterface(IID_IDirect3DResource9, &result) );
 		if( FAILED( hr ) )
 			throw gcnew InvalidCastException( "Failed to QueryInterface on user-supplied pointer." );
 
@@ -93,7 +93,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::Device^ Resource::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -136,7 +136,7 @@ namespace Direct3D9
 	generic<typename T> where T : value class
 	Result Resource::SetPrivateData(Guid guid, T data)
 	{
-		HRESULT hr = InternalPointer->SetPrivateData(Utilities::ConvertManagedGuid(guid), &data, sizeof(T), 0);
+		HRESULT hr = TIME_CALL( InternalPointer->SetPrivateData(Utilities::ConvertManagedGuid(guid), &data, sizeof(T), 0) );
 		return RECORD_D3D9(hr);
 	}
 
@@ -146,7 +146,7 @@ namespace Direct3D9
 		T result;
 		DWORD size = sizeof(T);
 
-		HRESULT hr = InternalPointer->GetPrivateData(Utilities::ConvertManagedGuid(guid), &result, &size);
+		HRESULT hr = TIME_CALL( InternalPointer->GetPrivateData(Utilities::ConvertManagedGuid(guid), &result, &size) );
 		RECORD_D3D9(hr);
 
 		return result;
@@ -48,7 +48,7 @@ namespace Direct3D9
 		if( data == nullptr )
 			throw gcnew ArgumentNullException( "data" );
 
-		HRESULT hr = D3DXCreateBuffer( data->Length, &buffer );
+		HRESULT hr = TIME_CALL( D3DXCreateBuffer( data->Length, &buffer ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -75,8 +75,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXAssembleShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXAssembleShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		errors = Utilities::BufferToString( errorBuffer );
@@ -104,8 +104,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXAssembleShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXAssembleShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 
@@ -123,8 +123,8 @@ namespace Direct3D9
 		ID3DXBuffer* errorBuffer;
 		pin_ptr<Byte> pinnedData = &sourceData[0];
 
-		HRESULT hr = D3DXAssembleShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, NULL, NULL,
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXAssembleShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, NULL, NULL,
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer ) );
 
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		Exception^ e = CompilationException::Check<Direct3D9Exception^>(hr, errors);
@@ -170,8 +170,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXAssembleShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXAssembleShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 
@@ -199,8 +199,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXAssembleShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXAssembleShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 
@@ -218,8 +218,8 @@ namespace Direct3D9
 		ID3DXBuffer* errorBuffer;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXAssembleShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), NULL, NULL,
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXAssembleShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), NULL, NULL,
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer ) );
 
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		Exception^ e = CompilationException::Check<Direct3D9Exception^>(hr, errors);
@@ -250,9 +250,9 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCompileShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+		HRESULT hr = TIME_CALL( D3DXCompileShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
 			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ),
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL );
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL ) );
 
 		Macro::Unmarshal( handles );
 		
@@ -285,9 +285,9 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCompileShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+		HRESULT hr = TIME_CALL( D3DXCompileShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
 			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ),
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL );
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL ) );
 
 		Macro::Unmarshal( handles );
 		
@@ -310,9 +310,9 @@ namespace Direct3D9
 		array<Byte>^ profileBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( profile );
 		pin_ptr<Byte> pinnedProfile = &profileBytes[0];
 
-		HRESULT hr = D3DXCompileShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, NULL, NULL,
+		HRESULT hr = TIME_CALL( D3DXCompileShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, NULL, NULL,
 			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ),
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL );
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL ) );
 		
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		Exception^ e = CompilationException::Check<Direct3D9Exception^>(hr, errors);
@@ -363,9 +363,9 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCompileShaderFromFile( pinnedFileName, macrosPtr, includePtr,
+		HRESULT hr = TIME_CALL( D3DXCompileShaderFromFile( pinnedFileName, macrosPtr, includePtr,
 			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ),
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL );
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL ) );
 
 		Macro::Unmarshal( handles );
 
@@ -398,9 +398,9 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXCompileShaderFromFile( pinnedFileName, macrosPtr, includePtr,
+		HRESULT hr = TIME_CALL( D3DXCompileShaderFromFile( pinnedFileName, macrosPtr, includePtr,
 			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ),
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL );
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL ) );
 
 		Macro::Unmarshal( handles );
 		
@@ -423,9 +423,9 @@ namespace Direct3D9
 		array<Byte>^ profileBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( profile );
 		pin_ptr<Byte> pinnedProfile = &profileBytes[0];
 
-		HRESULT hr = D3DXCompileShaderFromFile( pinnedFileName, NULL, NULL,
+		HRESULT hr = TIME_CALL( D3DXCompileShaderFromFile( pinnedFileName, NULL, NULL,
 			reinterpret_cast<LPCSTR>( pinnedFunction ), reinterpret_cast<LPCSTR>( pinnedProfile ),
-			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL );
+			static_cast<DWORD>( flags ), &shaderBuffer, &errorBuffer, NULL ) );
 		
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		Exception^ e = CompilationException::Check<Direct3D9Exception^>(hr, errors);
@@ -451,8 +451,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXPreprocessShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
-			&shaderText, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXPreprocessShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+			&shaderText, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		
@@ -479,8 +479,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXPreprocessShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
-			&shaderText, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXPreprocessShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, macrosPtr, includePtr,
+			&shaderText, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 
@@ -498,8 +498,8 @@ namespace Direct3D9
 		ID3DXBuffer* errorBuffer;
 		pin_ptr<Byte> pinnedData = &sourceData[0];
 
-		HRESULT hr = D3DXPreprocessShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, NULL, NULL,
-			&shaderText, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXPreprocessShader( reinterpret_cast<LPCSTR>( pinnedData ), sourceData->Length, NULL, NULL,
+			&shaderText, &errorBuffer ) );
 
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		Exception^ e = CompilationException::Check<Direct3D9Exception^>(hr, errors);
@@ -545,8 +545,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXPreprocessShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
-			&shaderText, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXPreprocessShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
+			&shaderText, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 		
@@ -574,8 +574,8 @@ namespace Direct3D9
 		stack_array<D3DXMACRO> macros = Macro::Marshal( defines, handles );
 		D3DXMACRO* macrosPtr = macros.size() > 0 ? &macros[0] : NULL;
 
-		HRESULT hr = D3DXPreprocessShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
-			&shaderText, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXPreprocessShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), macrosPtr, includePtr,
+			&shaderText, &errorBuffer ) );
 
 		Macro::Unmarshal( handles );
 
@@ -593,8 +593,8 @@ namespace Direct3D9
 		ID3DXBuffer* errorBuffer;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXPreprocessShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), NULL, NULL,
-			&shaderText, &errorBuffer );
+		HRESULT hr = TIME_CALL( D3DXPreprocessShaderFromFile( reinterpret_cast<LPCWSTR>( pinnedName ), NULL, NULL,
+			&shaderText, &errorBuffer ) );
 
 		String^ errors = Utilities::BufferToString( errorBuffer );
 		Exception^ e = CompilationException::Check<Direct3D9Exception^>(hr, errors);
@@ -626,8 +626,8 @@ namespace Direct3D9
 		array<unsigned char>^ commentBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( comments );
 		pin_ptr<unsigned char> pinnedComments = &commentBytes[0];
 
-		HRESULT hr = D3DXDisassembleShader( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ),
-			enableColorCode, reinterpret_cast<LPCSTR>( pinnedComments ), &result );
+		HRESULT hr = TIME_CALL( D3DXDisassembleShader( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ),
+			enableColorCode, reinterpret_cast<LPCSTR>( pinnedComments ), &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -639,8 +639,8 @@ namespace Direct3D9
 	{
 		ID3DXBuffer *result;
 
-		HRESULT hr = D3DXDisassembleShader( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ),
-			enableColorCode, NULL, &result );
+		HRESULT hr = TIME_CALL( D3DXDisassembleShader( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ),
+			enableColorCode, NULL, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -658,8 +658,8 @@ namespace Direct3D9
 		LPCVOID data;
 		UINT size;
 
-		HRESULT hr = D3DXFindShaderComment( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ),
-			static_cast<DWORD>( fourCC ), &data, &size );
+		HRESULT hr = TIME_CALL( D3DXFindShaderComment( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ),
+			static_cast<DWORD>( fourCC ), &data, &size ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -678,7 +678,7 @@ namespace Direct3D9
 			return m_constantTable;
 
 		ID3DXConstantTable* constantTable;
-		HRESULT hr = D3DXGetShaderConstantTable( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ), &constantTable );
+		HRESULT hr = TIME_CALL( D3DXGetShaderConstantTable( reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() ), &constantTable ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -693,7 +693,7 @@ namespace Direct3D9
 		UINT count = 0;
 		const DWORD* function = reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() );
 
-		HRESULT hr = D3DXGetShaderInputSemantics( function, NULL, &count );
+		HRESULT hr = TIME_CALL( D3DXGetShaderInputSemantics( function, NULL, &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure || count == 0 )
 			return nullptr;
@@ -701,7 +701,7 @@ namespace Direct3D9
 		array<ShaderSemantic>^ inputs = gcnew array<ShaderSemantic>( count );
 		pin_ptr<ShaderSemantic> pinnedInputs = &inputs[0];
 
-		hr = D3DXGetShaderInputSemantics( function, reinterpret_cast<D3DXSEMANTIC*>( pinnedInputs ), &count );
+		hr = TIME_CALL( D3DXGetShaderInputSemantics( function, reinterpret_cast<D3DXSEMANTIC*>( pinnedInputs ), &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -714,7 +714,7 @@ namespace Direct3D9
 		UINT count = 0;
 		const DWORD* function = reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() );
 
-		HRESULT hr = D3DXGetShaderOutputSemantics( function, NULL, &count );
+		HRESULT hr = TIME_CALL( D3DXGetShaderOutputSemantics( function, NULL, &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure || count == 0 )
 			return nullptr;
@@ -722,7 +722,7 @@ namespace Direct3D9
 		array<ShaderSemantic>^ outputs = gcnew array<ShaderSemantic>( count );
 		pin_ptr<ShaderSemantic> pinnedOutputs = &outputs[0];
 
-		hr = D3DXGetShaderOutputSemantics( function, reinterpret_cast<D3DXSEMANTIC*>( pinnedOutputs ), &count );
+		hr = TIME_CALL( D3DXGetShaderOutputSemantics( function, reinterpret_cast<D3DXSEMANTIC*>( pinnedOutputs ), &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -735,14 +735,14 @@ namespace Direct3D9
 		UINT count = 0;
 		const DWORD* function = reinterpret_cast<const DWORD*>( InternalPointer->GetBufferPointer() );
 
-		HRESULT hr = D3DXGetShaderSamplers( function, NULL, &count );
+		HRESULT hr = TIME_CALL( D3DXGetShaderSamplers( function, NULL, &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure || count == 0 )
 			return nullptr;
 		
 		stack_array<LPCSTR> samplers = stackalloc( LPCSTR, count );
 
-		hr = D3DXGetShaderSamplers( function, &samplers[0], &count );
+		hr = TIME_CALL( D3DXGetShaderSamplers( function, &samplers[0], &count ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
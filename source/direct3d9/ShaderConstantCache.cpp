@@ -0,0 +1,293 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+
+#include "../Utilities.h"
+
+#include "Direct3D9Exception.h"
+
+#include "Device.h"
+#include "ShaderConstantCache.h"
+#include "ShaderConstantCacheKernels.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	ShaderConstantCache::ShaderConstantCache( SlimDX::Direct3D9::Device^ device )
+	{
+		Init( device, 256, 224 );
+	}
+
+	ShaderConstantCache::ShaderConstantCache( SlimDX::Direct3D9::Device^ device, int vertexRegisterCount, int pixelRegisterCount )
+	{
+		Init( device, vertexRegisterCount, pixelRegisterCount );
+	}
+
+	void ShaderConstantCache::Init( SlimDX::Direct3D9::Device^ device, int vertexRegisterCount, int pixelRegisterCount )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( vertexRegisterCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexRegisterCount" );
+		if( pixelRegisterCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "pixelRegisterCount" );
+
+		m_Device = device;
+		m_MergeGap = 2;
+		m_VertexRegisters = new NativeConstantRegisterFile( vertexRegisterCount );
+		m_PixelRegisters = new NativeConstantRegisterFile( pixelRegisterCount );
+	}
+
+	ShaderConstantCache::~ShaderConstantCache()
+	{
+		this->!ShaderConstantCache();
+	}
+
+	ShaderConstantCache::!ShaderConstantCache()
+	{
+		delete m_VertexRegisters;
+		delete m_PixelRegisters;
+		m_VertexRegisters = NULL;
+		m_PixelRegisters = NULL;
+	}
+
+	void ShaderConstantCache::CheckDisposed()
+	{
+		if( m_VertexRegisters == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	void ShaderConstantCache::CheckRange( NativeConstantRegisterFile* registers, int startRegister, int count )
+	{
+		if( startRegister < 0 || startRegister > registers->GetRegisterCount() - count )
+			throw gcnew ArgumentOutOfRangeException( "startRegister", "The registers being set are outside the range shadowed by the cache." );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, Vector4 value )
+	{
+		CheckDisposed();
+		CheckRange( m_VertexRegisters, startRegister, 1 );
+		m_VertexRegisters->Set( startRegister, reinterpret_cast<float*>( &value ), 1 );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, Color4 value )
+	{
+		CheckDisposed();
+		CheckRange( m_VertexRegisters, startRegister, 1 );
+		m_VertexRegisters->Set( startRegister, reinterpret_cast<float*>( &value ), 1 );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, Matrix value )
+	{
+		SetVertexShaderConstant( startRegister, value, false );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, Matrix value, bool transpose )
+	{
+		CheckDisposed();
+		CheckRange( m_VertexRegisters, startRegister, 4 );
+
+		if( transpose )
+			m_VertexRegisters->SetTransposed( startRegister, reinterpret_cast<float*>( &value ), 1 );
+		else
+			m_VertexRegisters->Set( startRegister, reinterpret_cast<float*>( &value ), 4 );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		CheckRange( m_VertexRegisters, startRegister, count );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Vector4> pinnedData = &data[offset];
+		m_VertexRegisters->Set( startRegister, reinterpret_cast<float*>( pinnedData ), count );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, array<float>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		int elements = count * 4;
+		Utilities::CheckArrayBounds( data, offset, elements );
+		CheckRange( m_VertexRegisters, startRegister, elements / 4 );
+		if( elements < 4 )
+			return;
+
+		pin_ptr<float> pinnedData = &data[offset];
+		m_VertexRegisters->Set( startRegister, pinnedData, elements / 4 );
+	}
+
+	void ShaderConstantCache::SetVertexShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count, bool transpose )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		CheckRange( m_VertexRegisters, startRegister, count * 4 );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Matrix> pinnedData = &data[offset];
+		if( transpose )
+			m_VertexRegisters->SetTransposed( startRegister, reinterpret_cast<float*>( pinnedData ), count );
+		else
+			m_VertexRegisters->Set( startRegister, reinterpret_cast<float*>( pinnedData ), count * 4 );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, Vector4 value )
+	{
+		CheckDisposed();
+		CheckRange( m_PixelRegisters, startRegister, 1 );
+		m_PixelRegisters->Set( startRegister, reinterpret_cast<float*>( &value ), 1 );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, Color4 value )
+	{
+		CheckDisposed();
+		CheckRange( m_PixelRegisters, startRegister, 1 );
+		m_PixelRegisters->Set( startRegister, reinterpret_cast<float*>( &value ), 1 );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, Matrix value )
+	{
+		SetPixelShaderConstant( startRegister, value, false );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, Matrix value, bool transpose )
+	{
+		CheckDisposed();
+		CheckRange( m_PixelRegisters, startRegister, 4 );
+
+		if( transpose )
+			m_PixelRegisters->SetTransposed( startRegister, reinterpret_cast<float*>( &value ), 1 );
+		else
+			m_PixelRegisters->Set( startRegister, reinterpret_cast<float*>( &value ), 4 );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		CheckRange( m_PixelRegisters, startRegister, count );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Vector4> pinnedData = &data[offset];
+		m_PixelRegisters->Set( startRegister, reinterpret_cast<float*>( pinnedData ), count );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, array<float>^ data, int offset, int count )
+	{
+		CheckDisposed();
+
+		int elements = count * 4;
+		Utilities::CheckArrayBounds( data, offset, elements );
+		CheckRange( m_PixelRegisters, startRegister, elements / 4 );
+		if( elements < 4 )
+			return;
+
+		pin_ptr<float> pinnedData = &data[offset];
+		m_PixelRegisters->Set( startRegister, pinnedData, elements / 4 );
+	}
+
+	void ShaderConstantCache::SetPixelShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count, bool transpose )
+	{
+		CheckDisposed();
+
+		Utilities::CheckArrayBounds( data, offset, count );
+		CheckRange( m_PixelRegisters, startRegister, count * 4 );
+		if( count == 0 )
+			return;
+
+		pin_ptr<Matrix> pinnedData = &data[offset];
+		if( transpose )
+			m_PixelRegisters->SetTransposed( startRegister, reinterpret_cast<float*>( pinnedData ), count );
+		else
+			m_PixelRegisters->Set( startRegister, reinterpret_cast<float*>( pinnedData ), count * 4 );
+	}
+
+	Result ShaderConstantCache::Commit()
+	{
+		CheckDisposed();
+
+		IDirect3DDevice9* device = m_Device->InternalPointer;
+		HRESULT hr = TIME_CALL( m_VertexRegisters->Commit( device, false, m_MergeGap ) );
+		if( SUCCEEDED( hr ) )
+			hr = TIME_CALL( m_PixelRegisters->Commit( device, true, m_MergeGap ) );
+
+		return RECORD_D3D9( hr );
+	}
+
+	void ShaderConstantCache::Invalidate()
+	{
+		CheckDisposed();
+		m_VertexRegisters->Invalidate();
+		m_PixelRegisters->Invalidate();
+	}
+
+	void ShaderConstantCache::ResetStatistics()
+	{
+		CheckDisposed();
+		m_VertexRegisters->ResetStatistics();
+		m_PixelRegisters->ResetStatistics();
+	}
+
+	void ShaderConstantCache::MergeGap::set( int value )
+	{
+		if( value < 0 )
+			throw gcnew ArgumentOutOfRangeException( "value" );
+
+		m_MergeGap = value;
+	}
+
+	bool ShaderConstantCache::IsDirty::get()
+	{
+		CheckDisposed();
+		return m_VertexRegisters->IsDirty() || m_PixelRegisters->IsDirty();
+	}
+
+	int ShaderConstantCache::RegistersWritten::get()
+	{
+		CheckDisposed();
+		return m_VertexRegisters->GetRegistersWritten() + m_PixelRegisters->GetRegistersWritten();
+	}
+
+	int ShaderConstantCache::RegistersUploaded::get()
+	{
+		CheckDisposed();
+		return m_VertexRegisters->GetRegistersUploaded() + m_PixelRegisters->GetRegistersUploaded();
+	}
+
+	int ShaderConstantCache::UploadCount::get()
+	{
+		CheckDisposed();
+		return m_VertexRegisters->GetUploadCount() + m_PixelRegisters->GetUploadCount();
+	}
+}
+}
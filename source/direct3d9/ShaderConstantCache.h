@@ -0,0 +1,258 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../math/Color4.h"
+#include "../math/Matrix.h"
+#include "../math/Vector4.h"
+
+namespace SlimDX
+{
+	namespace Direct3D9
+	{
+		class NativeConstantRegisterFile;
+
+		ref class Device;
+
+		/// <summary>
+		/// Keeps a shadow copy of the vertex and pixel shader float constant registers and uploads only the registers that changed.
+		/// </summary>
+		/// <remarks>
+		/// The setters only update the shadow copy; a register is marked dirty when its value differs from what was last written.
+		/// <see cref="Commit"/>, which should be called before each draw, uploads the dirty registers of each stage in as few contiguous
+		/// calls as possible, bridging gaps of up to <see cref="MergeGap"/> registers that the device already holds.
+		///
+		/// The cache assumes it is the only writer of the registers it has uploaded. Call <see cref="Invalidate"/> after the device is reset
+		/// or after constants are set on the <see cref="Device"/> directly.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class ShaderConstantCache sealed
+		{
+		private:
+			SlimDX::Direct3D9::Device^ m_Device;
+			NativeConstantRegisterFile* m_VertexRegisters;
+			NativeConstantRegisterFile* m_PixelRegisters;
+			int m_MergeGap;
+
+			void Init( SlimDX::Direct3D9::Device^ device, int vertexRegisterCount, int pixelRegisterCount );
+			void CheckDisposed();
+			static void CheckRange( NativeConstantRegisterFile* registers, int startRegister, int count );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderConstantCache"/> class with 256 vertex and 224 pixel shader registers.
+			/// </summary>
+			/// <param name="device">The device to upload constants to.</param>
+			ShaderConstantCache( SlimDX::Direct3D9::Device^ device );
+
+			/// <summary>
+			/// Initializes a new instance of the <see cref="ShaderConstantCache"/> class.
+			/// </summary>
+			/// <param name="device">The device to upload constants to.</param>
+			/// <param name="vertexRegisterCount">The number of vertex shader float registers to shadow.</param>
+			/// <param name="pixelRegisterCount">The number of pixel shader float registers to shadow.</param>
+			ShaderConstantCache( SlimDX::Direct3D9::Device^ device, int vertexRegisterCount, int pixelRegisterCount );
+
+			/// <summary>
+			/// Releases the shadow register files.
+			/// </summary>
+			~ShaderConstantCache();
+
+			/// <summary>
+			/// Releases the shadow register files.
+			/// </summary>
+			!ShaderConstantCache();
+
+			/// <summary>
+			/// Sets a vertex shader constant register.
+			/// </summary>
+			/// <param name="startRegister">The register to set.</param>
+			/// <param name="value">The value to set.</param>
+			void SetVertexShaderConstant( int startRegister, Vector4 value );
+
+			/// <summary>
+			/// Sets a vertex shader constant register to the red, green, blue and alpha components of a color.
+			/// </summary>
+			/// <param name="startRegister">The register to set.</param>
+			/// <param name="value">The value to set.</param>
+			void SetVertexShaderConstant( int startRegister, Color4 value );
+
+			/// <summary>
+			/// Sets four vertex shader constant registers to the rows of a matrix.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="value">The value to set.</param>
+			void SetVertexShaderConstant( int startRegister, Matrix value );
+
+			/// <summary>
+			/// Sets four vertex shader constant registers to the rows or columns of a matrix.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="value">The value to set.</param>
+			/// <param name="transpose"><c>true</c> to store the matrix transposed, as expected by column-major shader matrices.</param>
+			void SetVertexShaderConstant( int startRegister, Matrix value, bool transpose );
+
+			/// <summary>
+			/// Sets a range of vertex shader constant registers.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The values to set.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count );
+
+			/// <summary>
+			/// Sets a range of vertex shader constant registers.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The values to set, four per register.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetVertexShaderConstant( int startRegister, array<float>^ data, int offset, int count );
+
+			/// <summary>
+			/// Sets a range of vertex shader constant registers to an array of matrices, four registers per matrix.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The values to set.</param>
+			/// <param name="offset">The index of the first matrix to use.</param>
+			/// <param name="count">The number of matrices to set.</param>
+			/// <param name="transpose"><c>true</c> to store the matrices transposed, as expected by column-major shader matrices.</param>
+			void SetVertexShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count, bool transpose );
+
+			/// <summary>
+			/// Sets a pixel shader constant register.
+			/// </summary>
+			/// <param name="startRegister">The register to set.</param>
+			/// <param name="value">The value to set.</param>
+			void SetPixelShaderConstant( int startRegister, Vector4 value );
+
+			/// <summary>
+			/// Sets a pixel shader constant register to the red, green, blue and alpha components of a color.
+			/// </summary>
+			/// <param name="startRegister">The register to set.</param>
+			/// <param name="value">The value to set.</param>
+			void SetPixelShaderConstant( int startRegister, Color4 value );
+
+			/// <summary>
+			/// Sets four pixel shader constant registers to the rows of a matrix.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="value">The value to set.</param>
+			void SetPixelShaderConstant( int startRegister, Matrix value );
+
+			/// <summary>
+			/// Sets four pixel shader constant registers to the rows or columns of a matrix.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="value">The value to set.</param>
+			/// <param name="transpose"><c>true</c> to store the matrix transposed, as expected by column-major shader matrices.</param>
+			void SetPixelShaderConstant( int startRegister, Matrix value, bool transpose );
+
+			/// <summary>
+			/// Sets a range of pixel shader constant registers.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The values to set.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<Vector4>^ data, int offset, int count );
+
+			/// <summary>
+			/// Sets a range of pixel shader constant registers.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The values to set, four per register.</param>
+			/// <param name="offset">The index of the first element of <paramref name="data"/> to use.</param>
+			/// <param name="count">The number of registers to set.</param>
+			void SetPixelShaderConstant( int startRegister, array<float>^ data, int offset, int count );
+
+			/// <summary>
+			/// Sets a range of pixel shader constant registers to an array of matrices, four registers per matrix.
+			/// </summary>
+			/// <param name="startRegister">The first register to set.</param>
+			/// <param name="data">The values to set.</param>
+			/// <param name="offset">The index of the first matrix to use.</param>
+			/// <param name="count">The number of matrices to set.</param>
+			/// <param name="transpose"><c>true</c> to store the matrices transposed, as expected by column-major shader matrices.</param>
+			void SetPixelShaderConstant( int startRegister, array<Matrix>^ data, int offset, int count, bool transpose );
+
+			/// <summary>
+			/// Uploads the dirty registers of both shader stages to the device.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Commit();
+
+			/// <summary>
+			/// Marks the device's copy of every register as unknown, so each register is uploaded again the next time it is set.
+			/// </summary>
+			void Invalidate();
+
+			/// <summary>
+			/// Resets the register and upload counters to zero.
+			/// </summary>
+			void ResetStatistics();
+
+			/// <summary>
+			/// Gets or sets the number of up to date registers that may be uploaded again to join two dirty ranges into one call.
+			/// The default is 2.
+			/// </summary>
+			property int MergeGap
+			{
+				int get() { return m_MergeGap; }
+				void set( int value );
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether any register is waiting to be uploaded.
+			/// </summary>
+			property bool IsDirty
+			{
+				bool get();
+			}
+
+			/// <summary>
+			/// Gets the number of registers passed to the setters.
+			/// </summary>
+			property int RegistersWritten
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of registers uploaded to the device, including registers uploaded to bridge gaps.
+			/// </summary>
+			property int RegistersUploaded
+			{
+				int get();
+			}
+
+			/// <summary>
+			/// Gets the number of SetVertexShaderConstantF and SetPixelShaderConstantF calls made by <see cref="Commit"/>.
+			/// </summary>
+			property int UploadCount
+			{
+				int get();
+			}
+		};
+	}
+}
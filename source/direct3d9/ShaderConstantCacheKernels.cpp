@@ -0,0 +1,150 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+#include <string.h>
+
+#include "ShaderConstantCacheKernels.h"
+
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	namespace
+	{
+		const unsigned char RegisterDirty = 1;
+		const unsigned char RegisterValid = 2;
+	}
+
+	NativeConstantRegisterFile::NativeConstantRegisterFile( int registerCount )
+	: m_Registers( registerCount * 4 ), m_Flags( registerCount ), m_DirtyBegin( registerCount ), m_DirtyEnd( 0 ),
+	  m_RegistersWritten( 0 ), m_RegistersUploaded( 0 ), m_UploadCount( 0 )
+	{
+	}
+
+	void NativeConstantRegisterFile::Write( int index, const float* value )
+	{
+		float* shadow = &m_Registers[index * 4];
+		unsigned char& flags = m_Flags[index];
+
+		if( ( flags & ( RegisterDirty | RegisterValid ) ) != 0 && memcmp( shadow, value, 4 * sizeof(float) ) == 0 )
+			return;
+
+		memcpy( shadow, value, 4 * sizeof(float) );
+		flags |= RegisterDirty;
+
+		if( index < m_DirtyBegin )
+			m_DirtyBegin = index;
+		if( index + 1 > m_DirtyEnd )
+			m_DirtyEnd = index + 1;
+	}
+
+	void NativeConstantRegisterFile::Set( int startRegister, const float* data, int count )
+	{
+		for( int i = 0; i < count; ++i )
+			Write( startRegister + i, data + i * 4 );
+
+		m_RegistersWritten += count;
+	}
+
+	void NativeConstantRegisterFile::SetTransposed( int startRegister, const float* matrices, int matrixCount )
+	{
+		for( int m = 0; m < matrixCount; ++m )
+		{
+			const float* matrix = matrices + m * 16;
+			for( int column = 0; column < 4; ++column )
+			{
+				float value[4] = { matrix[column], matrix[4 + column], matrix[8 + column], matrix[12 + column] };
+				Write( startRegister + m * 4 + column, value );
+			}
+		}
+
+		m_RegistersWritten += matrixCount * 4;
+	}
+
+	void NativeConstantRegisterFile::Invalidate()
+	{
+		for( size_t i = 0; i < m_Flags.size(); ++i )
+			m_Flags[i] &= ~RegisterValid;
+	}
+
+	void NativeConstantRegisterFile::ResetStatistics()
+	{
+		m_RegistersWritten = 0;
+		m_RegistersUploaded = 0;
+		m_UploadCount = 0;
+	}
+
+	HRESULT NativeConstantRegisterFile::Commit( IDirect3DDevice9* device, bool pixelShader, int mergeGap )
+	{
+		int index = m_DirtyBegin;
+		int end = m_DirtyEnd;
+
+		while( index < end )
+		{
+			if( ( m_Flags[index] & RegisterDirty ) == 0 )
+			{
+				++index;
+				continue;
+			}
+
+			// extend the run over later dirty registers, bridging short gaps whose device contents already match the shadow copy
+			int runEnd = index + 1;
+			int next = runEnd;
+			while( next < end && next - runEnd <= mergeGap )
+			{
+				unsigned char flags = m_Flags[next];
+				if( flags & RegisterDirty )
+					runEnd = ++next;
+				else if( flags & RegisterValid )
+					++next;
+				else
+					break;
+			}
+
+			int count = runEnd - index;
+			HRESULT hr = pixelShader ? device->SetPixelShaderConstantF( index, &m_Registers[index * 4], count )
+				: device->SetVertexShaderConstantF( index, &m_Registers[index * 4], count );
+			if( FAILED( hr ) )
+			{
+				m_DirtyBegin = index;
+				return hr;
+			}
+
+			for( int i = index; i < runEnd; ++i )
+				m_Flags[i] = RegisterValid;
+
+			m_RegistersUploaded += count;
+			++m_UploadCount;
+			index = runEnd;
+		}
+
+		m_DirtyBegin = static_cast<int>( m_Flags.size() );
+		m_DirtyEnd = 0;
+		return D3D_OK;
+	}
+}
+}
+
+#pragma managed(pop)
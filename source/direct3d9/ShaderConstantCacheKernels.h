@@ -0,0 +1,65 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	// A shadow copy of one shader stage's float constant registers. Writes only mark registers dirty when their value changes,
+	// and Commit uploads the dirty registers in as few contiguous SetXxxShaderConstantF calls as possible.
+	class NativeConstantRegisterFile
+	{
+	public:
+		explicit NativeConstantRegisterFile( int registerCount );
+
+		int GetRegisterCount() const { return static_cast<int>( m_Flags.size() ); }
+		int GetRegistersWritten() const { return m_RegistersWritten; }
+		int GetRegistersUploaded() const { return m_RegistersUploaded; }
+		int GetUploadCount() const { return m_UploadCount; }
+		bool IsDirty() const { return m_DirtyBegin < m_DirtyEnd; }
+
+		void Set( int startRegister, const float* data, int count );
+		void SetTransposed( int startRegister, const float* matrices, int matrixCount );
+
+		// Forgets what the device holds, so every register is uploaded again the next time it is written.
+		void Invalidate();
+		void ResetStatistics();
+
+		// Dirty runs separated by at most mergeGap registers that are already up to date on the device are uploaded as one call.
+		HRESULT Commit( IDirect3DDevice9* device, bool pixelShader, int mergeGap );
+
+	private:
+		void Write( int index, const float* value );
+
+		std::vector<float> m_Registers;
+		std::vector<unsigned char> m_Flags;
+		int m_DirtyBegin;
+		int m_DirtyEnd;
+		int m_RegistersWritten;
+		int m_RegistersUploaded;
+		int m_UploadCount;
+	};
+}
+}
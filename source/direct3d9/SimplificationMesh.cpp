@@ -63,8 +63,8 @@ namespace Direct3D9
 		pin_ptr<AttributeWeights> pinnedVAW = &vertexAttributeWeights[0];
 		pin_ptr<float> pinnedVW = &vertexWeights[0];
 
-		HRESULT hr = D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn,
-			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedVAW ), reinterpret_cast<const FLOAT *>( pinnedVW ), &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn,
+			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedVAW ), reinterpret_cast<const FLOAT *>( pinnedVW ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -88,8 +88,8 @@ namespace Direct3D9
 
 		pin_ptr<AttributeWeights> pinnedVAW = &vertexAttributeWeights[0];
 
-		HRESULT hr = D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn,
-			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedVAW ), NULL, &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn,
+			reinterpret_cast<const D3DXATTRIBUTEWEIGHTS*>( pinnedVAW ), NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -113,8 +113,8 @@ namespace Direct3D9
 
 		pin_ptr<float> pinnedVW = &vertexWeights[0];
 
-		HRESULT hr = D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn,
-			NULL, reinterpret_cast<const FLOAT *>( pinnedVW ), &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn,
+			NULL, reinterpret_cast<const FLOAT *>( pinnedVW ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -136,7 +136,7 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdj );
 		}
 
-		HRESULT hr = D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn, NULL, NULL, &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSPMesh( mesh->InternalPointer, adjacencyIn, NULL, NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -154,8 +154,8 @@ namespace Direct3D9
 		vertexRemap = gcnew array<int>( VertexCount );
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->CloneMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), reinterpret_cast<DWORD*>( pinnedVR ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), reinterpret_cast<DWORD*>( pinnedVR ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -177,8 +177,8 @@ namespace Direct3D9
 		array<int>^ adjacencyOut = gcnew array<int>( FaceCount * 3 );
 		pin_ptr<int> pinnedAdj = &adjacencyOut[0];
 
-		HRESULT hr = InternalPointer->CloneMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -198,8 +198,8 @@ namespace Direct3D9
 		vertexRemap = gcnew array<int>( VertexCount );
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->CloneMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), reinterpret_cast<DWORD*>( pinnedVR ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), reinterpret_cast<DWORD*>( pinnedVR ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -220,8 +220,8 @@ namespace Direct3D9
 		array<int>^ adjacencyOut = gcnew array<int>( FaceCount * 3 );
 		pin_ptr<int> pinnedAdj = &adjacencyOut[0];
 
-		HRESULT hr = InternalPointer->CloneMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CloneMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedAdj ), NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -242,8 +242,8 @@ namespace Direct3D9
 		pin_ptr<float> pinnedEBF = &errorsByFace[0];
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->ClonePMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), reinterpret_cast<FLOAT*>( pinnedEBF ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), reinterpret_cast<FLOAT*>( pinnedEBF ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -263,8 +263,8 @@ namespace Direct3D9
 		vertexRemap = gcnew array<int>( VertexCount );
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->ClonePMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -281,8 +281,8 @@ namespace Direct3D9
 
 		pin_ptr<VertexElement> pinnedDecl = &vertexDeclaration[0];
 
-		HRESULT hr = InternalPointer->ClonePMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
-			device->InternalPointer, NULL, NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMesh( static_cast<DWORD>( options ), reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
+			device->InternalPointer, NULL, NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -300,8 +300,8 @@ namespace Direct3D9
 		pin_ptr<float> pinnedEBF = &errorsByFace[0];
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->ClonePMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), reinterpret_cast<FLOAT*>( pinnedEBF ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), reinterpret_cast<FLOAT*>( pinnedEBF ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -320,8 +320,8 @@ namespace Direct3D9
 		vertexRemap = gcnew array<int>( VertexCount );
 		pin_ptr<int> pinnedVR = &vertexRemap[0];
 
-		HRESULT hr = InternalPointer->ClonePMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
-			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
+			device->InternalPointer, reinterpret_cast<DWORD*>( pinnedVR ), NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -336,8 +336,8 @@ namespace Direct3D9
 	{
 		ID3DXPMesh *result;
 
-		HRESULT hr = InternalPointer->ClonePMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
-			device->InternalPointer, NULL, NULL, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ClonePMeshFVF( static_cast<DWORD>( options ), static_cast<DWORD>( fvf ),
+			device->InternalPointer, NULL, NULL, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -348,7 +348,7 @@ namespace Direct3D9
 	array<VertexElement>^ SimplificationMesh::GetDeclaration()
 	{
 		D3DVERTEXELEMENT9 elementBuffer[MAX_FVF_DECL_SIZE];
-		HRESULT hr = InternalPointer->GetDeclaration( elementBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeclaration( elementBuffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -365,7 +365,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::Device^ SimplificationMesh::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -378,7 +378,7 @@ namespace Direct3D9
 		array<AttributeWeights>^ results = gcnew array<AttributeWeights>( MaximumVertexCount );
 		pin_ptr<AttributeWeights> pinnedResults = &results[0];
 
-		HRESULT hr = InternalPointer->GetVertexAttributeWeights( reinterpret_cast<D3DXATTRIBUTEWEIGHTS*>( pinnedResults ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexAttributeWeights( reinterpret_cast<D3DXATTRIBUTEWEIGHTS*>( pinnedResults ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -391,7 +391,7 @@ namespace Direct3D9
 		array<float>^ results = gcnew array<float>( MaximumVertexCount );
 		pin_ptr<float> pinnedResults = &results[0];
 
-		HRESULT hr = InternalPointer->GetVertexWeights( reinterpret_cast<FLOAT*>( pinnedResults ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVertexWeights( reinterpret_cast<FLOAT*>( pinnedResults ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -401,13 +401,13 @@ namespace Direct3D9
 
 	Result SimplificationMesh::ReduceFaces( int faces )
 	{
-		HRESULT hr = InternalPointer->ReduceFaces( faces );
+		HRESULT hr = TIME_CALL( InternalPointer->ReduceFaces( faces ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result SimplificationMesh::ReduceVertices( int vertices )
 	{
-		HRESULT hr = InternalPointer->ReduceVertices( vertices );
+		HRESULT hr = TIME_CALL( InternalPointer->ReduceVertices( vertices ) );
 		return RECORD_D3D9( hr );
 	}
 
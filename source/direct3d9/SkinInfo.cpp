@@ -47,8 +47,8 @@ namespace Direct3D9
 
 		pin_ptr<VertexElement> pinnedDecl = &vertexDeclaration[0];
 
-		HRESULT hr = D3DXCreateSkinInfo( vertexCount, reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
-			boneCount, &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSkinInfo( vertexCount, reinterpret_cast<const D3DVERTEXELEMENT9*>( pinnedDecl ),
+			boneCount, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -65,7 +65,7 @@ namespace Direct3D9
 		for( int i = 0; i < length; i++ )
 			bones[i] = boneCombinationTable[i]->ToUnmanaged();
 
-		HRESULT hr = D3DXCreateSkinInfoFromBlendedMesh( mesh->InternalPointer, boneCount, &bones[0], &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSkinInfoFromBlendedMesh( mesh->InternalPointer, boneCount, &bones[0], &result ) );
 
 		for( int i = 0; i < length; i++ )
 			delete[] bones[i].BoneId;
@@ -80,8 +80,8 @@ namespace Direct3D9
 	{
 		ID3DXSkinInfo *result;
 
-		HRESULT hr = D3DXCreateSkinInfoFVF( vertexCount, static_cast<DWORD>( fvf ),
-			boneCount, &result );
+		HRESULT hr = TIME_CALL( D3DXCreateSkinInfoFVF( vertexCount, static_cast<DWORD>( fvf ),
+			boneCount, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -93,7 +93,7 @@ namespace Direct3D9
 	{
 		ID3DXSkinInfo *result;
 
-		HRESULT hr = InternalPointer->Clone( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->Clone( &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -126,8 +126,8 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdjIn );
 		}
 
-		HRESULT hr = InternalPointer->ConvertToBlendedMesh( mesh->InternalPointer, 0, adjacencyIn,
-			reinterpret_cast<DWORD*>( pinnedAdjOut ), reinterpret_cast<DWORD*>( pinnedFR ), &vr, &mvi, &bcc, &bct, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertToBlendedMesh( mesh->InternalPointer, 0, adjacencyIn,
+			reinterpret_cast<DWORD*>( pinnedAdjOut ), reinterpret_cast<DWORD*>( pinnedFR ), &vr, &mvi, &bcc, &bct, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -180,8 +180,8 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdjIn );
 		}
 
-		HRESULT hr = InternalPointer->ConvertToBlendedMesh( mesh->InternalPointer, 0, adjacencyIn,
-			reinterpret_cast<DWORD*>( pinnedAdjOut ), NULL, NULL, &mvi, &bcc, &bct, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertToBlendedMesh( mesh->InternalPointer, 0, adjacencyIn,
+			reinterpret_cast<DWORD*>( pinnedAdjOut ), NULL, NULL, &mvi, &bcc, &bct, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -237,8 +237,8 @@ namespace Direct3D9
 
 		pin_ptr<int> pinnedFR = &faceRemap[0];
 
-		HRESULT hr = InternalPointer->ConvertToIndexedBlendedMesh( mesh->InternalPointer, 0, paletteSize, adjacencyIn,
-			reinterpret_cast<DWORD*>( pinnedAdjOut ), reinterpret_cast<DWORD*>( pinnedFR ), &vr, &mvi, &bcc, &bct, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertToIndexedBlendedMesh( mesh->InternalPointer, 0, paletteSize, adjacencyIn,
+			reinterpret_cast<DWORD*>( pinnedAdjOut ), reinterpret_cast<DWORD*>( pinnedFR ), &vr, &mvi, &bcc, &bct, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -291,8 +291,8 @@ namespace Direct3D9
 			adjacencyIn = reinterpret_cast<DWORD*>( pinnedAdjIn );
 		}
 
-		HRESULT hr = InternalPointer->ConvertToIndexedBlendedMesh( mesh->InternalPointer, 0, paletteSize, adjacencyIn,
-			reinterpret_cast<DWORD*>( pinnedAdjOut ), NULL, NULL, &mvi, &bcc, &bct, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertToIndexedBlendedMesh( mesh->InternalPointer, 0, paletteSize, adjacencyIn,
+			reinterpret_cast<DWORD*>( pinnedAdjOut ), NULL, NULL, &mvi, &bcc, &bct, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -326,7 +326,7 @@ namespace Direct3D9
 	{
 		DWORD influence;
 
-		HRESULT hr = InternalPointer->FindBoneVertexInfluenceIndex( bone, vertex, &influence );
+		HRESULT hr = TIME_CALL( InternalPointer->FindBoneVertexInfluenceIndex( bone, vertex, &influence ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return 0;
@@ -343,8 +343,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedVerts = &vertices[0];
 		pin_ptr<float> pinnedWeights = &weights[0];
 
-		HRESULT hr = InternalPointer->GetBoneInfluence( bone, reinterpret_cast<DWORD*>( pinnedVerts ),
-			reinterpret_cast<float*>( pinnedWeights ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetBoneInfluence( bone, reinterpret_cast<DWORD*>( pinnedVerts ),
+			reinterpret_cast<float*>( pinnedWeights ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -352,7 +352,7 @@ namespace Direct3D9
 			weights = nullptr;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result SkinInfo::SetBoneInfluence( int bone, array<int>^ vertices, array<float>^ weights )
@@ -360,8 +360,8 @@ namespace Direct3D9
 		pin_ptr<int> pinnedVerts = &vertices[0];
 		pin_ptr<float> pinnedWeights = &weights[0];
 
-		HRESULT hr = InternalPointer->SetBoneInfluence( bone, vertices->Length, reinterpret_cast<const DWORD*>( pinnedVerts ),
-			reinterpret_cast<const float*>( pinnedWeights ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetBoneInfluence( bone, vertices->Length, reinterpret_cast<const DWORD*>( pinnedVerts ),
+			reinterpret_cast<const float*>( pinnedWeights ) ) );
 		
 		return RECORD_D3D9( hr );
 	}
@@ -376,7 +376,7 @@ namespace Direct3D9
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->SetBoneName( bone, reinterpret_cast<LPCSTR>( pinnedName ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetBoneName( bone, reinterpret_cast<LPCSTR>( pinnedName ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -385,7 +385,7 @@ namespace Direct3D9
 		float w;
 		DWORD v;
 
-		HRESULT hr = InternalPointer->GetBoneVertexInfluence( bone, influence, &w, &v );
+		HRESULT hr = TIME_CALL( InternalPointer->GetBoneVertexInfluence( bone, influence, &w, &v ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 		{
@@ -398,12 +398,12 @@ namespace Direct3D9
 			vertex = v;
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result SkinInfo::SetBoneVertexInfluence( int bone, int influence, float weight )
 	{
-		HRESULT hr = InternalPointer->SetBoneVertexInfluence( bone, influence, weight );
+		HRESULT hr = TIME_CALL( InternalPointer->SetBoneVertexInfluence( bone, influence, weight ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -414,14 +414,14 @@ namespace Direct3D9
 
 	Result SkinInfo::SetBoneOffsetMatrix( int bone, Matrix matrix )
 	{
-		HRESULT hr = InternalPointer->SetBoneOffsetMatrix( bone, reinterpret_cast<D3DXMATRIX*>( &matrix ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetBoneOffsetMatrix( bone, reinterpret_cast<D3DXMATRIX*>( &matrix ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	array<VertexElement>^ SkinInfo::GetDeclaration()
 	{
 		D3DVERTEXELEMENT9 elementBuffer[MAX_FVF_DECL_SIZE];
-		HRESULT hr = InternalPointer->GetDeclaration( elementBuffer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeclaration( elementBuffer ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -441,7 +441,7 @@ namespace Direct3D9
 	{
 		pin_ptr<VertexElement> pinnedDecl = &declaration[0];
 
-		HRESULT hr = InternalPointer->SetDeclaration( reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDeclaration( reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -449,7 +449,7 @@ namespace Direct3D9
 	{
 		DWORD ret;
 
-		HRESULT hr = InternalPointer->GetMaxFaceInfluences( indexBuffer->InternalPointer, faceCount, &ret );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMaxFaceInfluences( indexBuffer->InternalPointer, faceCount, &ret ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return 0;
@@ -461,7 +461,7 @@ namespace Direct3D9
 	{
 		pin_ptr<int> pinnedData = &remapData[0];
 
-		HRESULT hr = InternalPointer->Remap( remapData->Length, reinterpret_cast<DWORD*>( pinnedData ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Remap( remapData->Length, reinterpret_cast<DWORD*>( pinnedData ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -470,8 +470,8 @@ namespace Direct3D9
 		pin_ptr<Matrix> pinnedTransforms = &boneTransforms[0];
 		pin_ptr<Matrix> pinnedInvTransforms = &boneInvTransposeTransforms[0];
 
-		HRESULT hr = InternalPointer->UpdateSkinnedMesh( reinterpret_cast<const D3DXMATRIX*>( pinnedTransforms ),
-			reinterpret_cast<const D3DXMATRIX*>( pinnedInvTransforms ), source->PositionPointer, destination->PositionPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->UpdateSkinnedMesh( reinterpret_cast<const D3DXMATRIX*>( pinnedTransforms ),
+			reinterpret_cast<const D3DXMATRIX*>( pinnedInvTransforms ), source->PositionPointer, destination->PositionPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -484,7 +484,7 @@ namespace Direct3D9
 	{
 		DWORD result;
 
-		HRESULT hr = InternalPointer->GetMaxVertexInfluences( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMaxVertexInfluences( &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return 0;
@@ -504,7 +504,7 @@ namespace Direct3D9
 
 	void SkinInfo::MinimumBoneInfluence::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetMinBoneInfluence( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMinBoneInfluence( value ) );
 		RECORD_D3D9( hr );
 	}
 
@@ -515,7 +515,7 @@ namespace Direct3D9
 
 	void SkinInfo::VertexFormat::set( SlimDX::Direct3D9::VertexFormat value )
 	{
-		HRESULT hr = InternalPointer->SetFVF( static_cast<DWORD>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFVF( static_cast<DWORD>( value ) ) );
 		RECORD_D3D9( hr );
 	}
 }
@@ -46,7 +46,7 @@ namespace Direct3D9
 	{
 		ID3DXSprite* sprite;
 		
-		HRESULT hr = D3DXCreateSprite( device->InternalPointer, &sprite );
+		HRESULT hr = TIME_CALL( D3DXCreateSprite( device->InternalPointer, &sprite ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -56,31 +56,31 @@ namespace Direct3D9
 
 	Result Sprite::Begin( SpriteFlags flags )
 	{
-		HRESULT hr = InternalPointer->Begin( static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Begin( static_cast<DWORD>( flags ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Sprite::End()
 	{
-		HRESULT hr = InternalPointer->End();
+		HRESULT hr = TIME_CALL( InternalPointer->End() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Sprite::Flush()
 	{
-		HRESULT hr = InternalPointer->Flush();
+		HRESULT hr = TIME_CALL( InternalPointer->Flush() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Sprite::OnLostDevice()
 	{
-		HRESULT hr = InternalPointer->OnLostDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnLostDevice() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Sprite::OnResetDevice()
 	{
-		HRESULT hr = InternalPointer->OnResetDevice();
+		HRESULT hr = TIME_CALL( InternalPointer->OnResetDevice() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -88,7 +88,7 @@ namespace Direct3D9
 	{
 		IDirect3DDevice9* device;
 
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -100,7 +100,7 @@ namespace Direct3D9
 	{
 		Matrix result;
 
-		HRESULT hr = InternalPointer->GetTransform( reinterpret_cast<D3DXMATRIX*>( &result ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetTransform( reinterpret_cast<D3DXMATRIX*>( &result ) ) );
 		RECORD_D3D9( hr );
 
 		return result;
@@ -108,19 +108,19 @@ namespace Direct3D9
 
 	void Sprite::Transform::set( Matrix value )
 	{
-		HRESULT hr = InternalPointer->SetTransform( reinterpret_cast<const D3DXMATRIX*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetTransform( reinterpret_cast<const D3DXMATRIX*>( &value ) ) );
 		RECORD_D3D9( hr );
 	}
 
 	Result Sprite::SetWorldViewLH( Matrix world, Matrix view )
 	{
-		HRESULT hr = InternalPointer->SetWorldViewLH( reinterpret_cast<const D3DXMATRIX*>( &world ), reinterpret_cast<const D3DXMATRIX*>( &view ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetWorldViewLH( reinterpret_cast<const D3DXMATRIX*>( &world ), reinterpret_cast<const D3DXMATRIX*>( &view ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Sprite::SetWorldViewRH( Matrix world, Matrix view )
 	{
-		HRESULT hr = InternalPointer->SetWorldViewRH( reinterpret_cast<const D3DXMATRIX*>( &world ), reinterpret_cast<const D3DXMATRIX*>( &view ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetWorldViewRH( reinterpret_cast<const D3DXMATRIX*>( &world ), reinterpret_cast<const D3DXMATRIX*>( &view ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -151,7 +151,7 @@ namespace Direct3D9
 			positionPtr = reinterpret_cast<const D3DXVECTOR3*>( &positionValue );
 		}
 		
-		HRESULT hr = InternalPointer->Draw( texture->InternalPointer, rectPtr, centerPtr, positionPtr, color.ToArgb() );
+		HRESULT hr = TIME_CALL( InternalPointer->Draw( texture->InternalPointer, rectPtr, centerPtr, positionPtr, color.ToArgb() ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -166,7 +166,7 @@ namespace Direct3D9
 			rectPtr = &rect;
 		}
 
-		HRESULT hr = InternalPointer->Draw( texture->InternalPointer, rectPtr, NULL, NULL, color.ToArgb() );
+		HRESULT hr = TIME_CALL( InternalPointer->Draw( texture->InternalPointer, rectPtr, NULL, NULL, color.ToArgb() ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -188,13 +188,13 @@ namespace Direct3D9
 			positionPtr = reinterpret_cast<const D3DXVECTOR3*>( &positionValue );
 		}
 
-		HRESULT hr = InternalPointer->Draw( texture->InternalPointer, NULL, centerPtr, positionPtr, color.ToArgb() );
+		HRESULT hr = TIME_CALL( InternalPointer->Draw( texture->InternalPointer, NULL, centerPtr, positionPtr, color.ToArgb() ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Sprite::Draw( Texture^ texture, Color4 color )
 	{
-		HRESULT hr = InternalPointer->Draw( texture->InternalPointer, NULL, NULL, NULL, color.ToArgb() );
+		HRESULT hr = TIME_CALL( InternalPointer->Draw( texture->InternalPointer, NULL, NULL, NULL, color.ToArgb() ) );
 		return RECORD_D3D9( hr );
 	}
 }
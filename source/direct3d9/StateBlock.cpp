@@ -39,7 +39,7 @@ namespace Direct3D9
 	{
 		IDirect3DStateBlock9* stateBlock;
 
-		HRESULT hr = device->InternalPointer->CreateStateBlock( static_cast<D3DSTATEBLOCKTYPE>( type ), &stateBlock );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateStateBlock( static_cast<D3DSTATEBLOCKTYPE>( type ), &stateBlock ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -49,20 +49,20 @@ namespace Direct3D9
 	
 	Result StateBlock::Apply()
 	{
-		HRESULT hr = InternalPointer->Apply();
+		HRESULT hr = TIME_CALL( InternalPointer->Apply() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result StateBlock::Capture()
 	{
-		HRESULT hr = InternalPointer->Capture();
+		HRESULT hr = TIME_CALL( InternalPointer->Capture() );
 		return RECORD_D3D9( hr );
 	}
 
 	SlimDX::Direct3D9::Device^ StateBlock::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
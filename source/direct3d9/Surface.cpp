@@ -61,8 +61,8 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateRenderTarget( width, height, static_cast<D3DFORMAT>( format ),
-			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, lockable, &surface, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateRenderTarget( width, height, static_cast<D3DFORMAT>( format ),
+			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, lockable, &surface, NULL ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -76,8 +76,8 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateOffscreenPlainSurface( width, height,
-			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &surface, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateOffscreenPlainSurface( width, height,
+			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &surface, NULL ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -94,8 +94,8 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateDepthStencilSurface( width, height, static_cast<D3DFORMAT>( format ),
-			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, discard, &surface, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateDepthStencilSurface( width, height, static_cast<D3DFORMAT>( format ),
+			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, discard, &surface, NULL ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -111,8 +111,8 @@ namespace Direct3D9
 		IDirect3DSurface9* surface = NULL;
 		HANDLE sharedHandleNative = sharedHandle.ToPointer();
 
-		HRESULT hr = device->InternalPointer->CreateRenderTarget( width, height, static_cast<D3DFORMAT>( format ),
-			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, lockable, &surface, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateRenderTarget( width, height, static_cast<D3DFORMAT>( format ),
+			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, lockable, &surface, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -129,8 +129,8 @@ namespace Direct3D9
 		IDirect3DSurface9* surface = NULL;
 		HANDLE sharedHandleNative = sharedHandle.ToPointer();
 
-		HRESULT hr = device->InternalPointer->CreateOffscreenPlainSurface( width, height,
-			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &surface, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateOffscreenPlainSurface( width, height,
+			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &surface, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -149,8 +149,8 @@ namespace Direct3D9
 		IDirect3DSurface9* surface = NULL;
 		HANDLE sharedHandleNative = sharedHandle.ToPointer();
 
-		HRESULT hr = device->InternalPointer->CreateDepthStencilSurface( width, height, static_cast<D3DFORMAT>( format ),
-			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, discard, &surface, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateDepthStencilSurface( width, height, static_cast<D3DFORMAT>( format ),
+			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, discard, &surface, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -166,9 +166,9 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateRenderTargetEx( width, height, static_cast<D3DFORMAT>( format ),
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateRenderTargetEx( width, height, static_cast<D3DFORMAT>( format ),
 			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality,
-			lockable, &surface, NULL, static_cast<DWORD>( usage ) );
+			lockable, &surface, NULL, static_cast<DWORD>( usage ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -184,9 +184,9 @@ namespace Direct3D9
 		IDirect3DSurface9* surface = NULL;
 		HANDLE localHandle = sharedHandle.ToPointer();
 
-		HRESULT hr = device->InternalPointer->CreateRenderTargetEx( width, height, static_cast<D3DFORMAT>( format ),
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateRenderTargetEx( width, height, static_cast<D3DFORMAT>( format ),
 			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, lockable,
-			&surface, &localHandle, static_cast<DWORD>( usage ) );
+			&surface, &localHandle, static_cast<DWORD>( usage ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -202,9 +202,9 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateOffscreenPlainSurfaceEx( width, height,
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateOffscreenPlainSurfaceEx( width, height,
 			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &surface,
-			NULL, static_cast<DWORD>( usage ) );
+			NULL, static_cast<DWORD>( usage ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -222,9 +222,9 @@ namespace Direct3D9
 		IDirect3DSurface9* surface = NULL;
 		HANDLE localHandle = sharedHandle.ToPointer();
 
-		HRESULT hr = device->InternalPointer->CreateOffscreenPlainSurfaceEx( width, height,
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateOffscreenPlainSurfaceEx( width, height,
 			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &surface,
-			&localHandle, static_cast<DWORD>( usage ) );
+			&localHandle, static_cast<DWORD>( usage ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -242,9 +242,9 @@ namespace Direct3D9
 	{
 		IDirect3DSurface9* surface = NULL;
 
-		HRESULT hr = device->InternalPointer->CreateDepthStencilSurfaceEx( width, height, static_cast<D3DFORMAT>( format ),
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateDepthStencilSurfaceEx( width, height, static_cast<D3DFORMAT>( format ),
 			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, discard,
-			&surface, NULL, static_cast<DWORD>( usage ) );
+			&surface, NULL, static_cast<DWORD>( usage ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -260,9 +260,9 @@ namespace Direct3D9
 		IDirect3DSurface9* surface = NULL;
 		HANDLE localHandle = sharedHandle.ToPointer();
 
-		HRESULT hr = device->InternalPointer->CreateDepthStencilSurfaceEx( width, height, static_cast<D3DFORMAT>( format ),
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateDepthStencilSurfaceEx( width, height, static_cast<D3DFORMAT>( format ),
 			static_cast<D3DMULTISAMPLE_TYPE>( multiSampleType ), multiSampleQuality, discard,
-			&surface, &localHandle, static_cast<DWORD>( usage ) );
+			&surface, &localHandle, static_cast<DWORD>( usage ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -280,11 +280,11 @@ namespace Direct3D9
 		pin_ptr<PaletteEntry> pinnedSourcePalette = sourcePalette == nullptr ? nullptr : &sourcePalette[0];
 		pin_ptr<PaletteEntry> pinnedDestPalette = destinationPalette == nullptr ? nullptr : &destinationPalette[0];
 
-		HRESULT hr = D3DXLoadSurfaceFromMemory( surface->InternalPointer,
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromMemory( surface->InternalPointer,
 			reinterpret_cast<const PALETTEENTRY*>( pinnedDestPalette ),
 			destinationRectangle, memory, static_cast<D3DFORMAT>( sourceFormat ),
 			sourcePitch, reinterpret_cast<const PALETTEENTRY*>( pinnedSourcePalette ),
-			sourceRectangle, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) );
+			sourceRectangle, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -418,9 +418,9 @@ namespace Direct3D9
 	{
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 
-		HRESULT hr = D3DXLoadSurfaceFromFileInMemory( surface->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromFileInMemory( surface->InternalPointer, 
 			reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), destinationRectangle, memory, size, sourceRectangle, 
-			static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ) );
+			static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ) ) );
 		
 		return RECORD_D3D9( hr );
 	}
@@ -558,9 +558,9 @@ namespace Direct3D9
 		RECT source = marshal_as<RECT>( sourceRectangle );
 		RECT dest = marshal_as<RECT>( destinationRectangle );
 
-		HRESULT hr = D3DXLoadSurfaceFromFile( surface->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromFile( surface->InternalPointer, 
 			reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), &dest, pinnedName,
-			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) );
+			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -574,8 +574,8 @@ namespace Direct3D9
 		RECT source = marshal_as<RECT>( sourceRectangle );
 		RECT dest = marshal_as<RECT>( destinationRectangle );
 
-		HRESULT hr = D3DXLoadSurfaceFromFile( surface->InternalPointer, NULL, &dest, pinnedName,
-			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) );
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromFile( surface->InternalPointer, NULL, &dest, pinnedName,
+			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -587,8 +587,8 @@ namespace Direct3D9
 		RECT source = marshal_as<RECT>( sourceRectangle );
 		RECT dest = marshal_as<RECT>( destinationRectangle );
 
-		HRESULT hr = D3DXLoadSurfaceFromFile( surface->InternalPointer, NULL, &dest, pinnedName,
-			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), NULL );
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromFile( surface->InternalPointer, NULL, &dest, pinnedName,
+			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -596,8 +596,8 @@ namespace Direct3D9
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXLoadSurfaceFromFile( surface->InternalPointer, NULL, NULL, pinnedName,
-			NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), NULL );
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromFile( surface->InternalPointer, NULL, NULL, pinnedName,
+			NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -611,10 +611,10 @@ namespace Direct3D9
 		RECT source = marshal_as<RECT>( sourceRectangle );
 		RECT dest = marshal_as<RECT>( destinationRectangle );
 
-		HRESULT hr = D3DXLoadSurfaceFromSurface( destinationSurface->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromSurface( destinationSurface->InternalPointer, 
 			reinterpret_cast<const PALETTEENTRY*>( pinnedDest ), &dest,
 			sourceSurface->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedSource ), 
-			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) );
+			&source, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -624,16 +624,16 @@ namespace Direct3D9
 		RECT source = marshal_as<RECT>( sourceRectangle );
 		RECT dest = marshal_as<RECT>( destinationRectangle );
 
-		HRESULT hr = D3DXLoadSurfaceFromSurface( destinationSurface->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromSurface( destinationSurface->InternalPointer, 
 			NULL, &dest, sourceSurface->InternalPointer, NULL, &source, static_cast<DWORD>( filter ), 
-			static_cast<D3DCOLOR>( colorKey ) );
+			static_cast<D3DCOLOR>( colorKey ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Surface::FromSurface( Surface^ destinationSurface, Surface^ sourceSurface, Filter filter, int colorKey )
 	{
-		HRESULT hr = D3DXLoadSurfaceFromSurface( destinationSurface->InternalPointer, NULL, NULL, 
-			sourceSurface->InternalPointer, NULL, NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) );
+		HRESULT hr = TIME_CALL( D3DXLoadSurfaceFromSurface( destinationSurface->InternalPointer, NULL, NULL, 
+			sourceSurface->InternalPointer, NULL, NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -645,8 +645,8 @@ namespace Direct3D9
 
 		RECT rect = marshal_as<RECT>( rectangle );
 
-		HRESULT hr = D3DXSaveSurfaceToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
-			surface->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), &rect );
+		HRESULT hr = TIME_CALL( D3DXSaveSurfaceToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
+			surface->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), &rect ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -659,8 +659,8 @@ namespace Direct3D9
 		ID3DXBuffer *result = NULL;
 		RECT rect = marshal_as<RECT>( rectangle );
 
-		HRESULT hr = D3DXSaveSurfaceToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
-			surface->InternalPointer, NULL, &rect );
+		HRESULT hr = TIME_CALL( D3DXSaveSurfaceToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
+			surface->InternalPointer, NULL, &rect ) );
 	
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -672,8 +672,8 @@ namespace Direct3D9
 	{
 		ID3DXBuffer *result = NULL;
 
-		HRESULT hr = D3DXSaveSurfaceToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
-			surface->InternalPointer, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveSurfaceToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
+			surface->InternalPointer, NULL, NULL ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -689,8 +689,8 @@ namespace Direct3D9
 
 		RECT rect = marshal_as<RECT>( rectangle );
 		
-		HRESULT hr = D3DXSaveSurfaceToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			surface->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), &rect );
+		HRESULT hr = TIME_CALL( D3DXSaveSurfaceToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			surface->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), &rect ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -700,8 +700,8 @@ namespace Direct3D9
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars(fileName);
 		RECT rect = marshal_as<RECT>( rectangle );
 		
-		HRESULT hr = D3DXSaveSurfaceToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			surface->InternalPointer, NULL, &rect );
+		HRESULT hr = TIME_CALL( D3DXSaveSurfaceToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			surface->InternalPointer, NULL, &rect ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -709,8 +709,8 @@ namespace Direct3D9
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars(fileName);
 		
-		HRESULT hr = D3DXSaveSurfaceToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			surface->InternalPointer, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveSurfaceToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			surface->InternalPointer, NULL, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -718,7 +718,7 @@ namespace Direct3D9
 	{
 		SurfaceDescription description;
 
-		HRESULT hr = InternalPointer->GetDesc( reinterpret_cast<D3DSURFACE_DESC*>( &description ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( reinterpret_cast<D3DSURFACE_DESC*>( &description ) ) );
 		RECORD_D3D9( hr );
 
 		return description;
@@ -728,7 +728,7 @@ namespace Direct3D9
 	{
 		D3DLOCKED_RECT lockedRect;
 		
-		HRESULT hr = InternalPointer->LockRect( &lockedRect, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockRect( &lockedRect, NULL, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -744,7 +744,7 @@ namespace Direct3D9
 		D3DLOCKED_RECT lockedRect;
 		RECT nativeRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
 
-		HRESULT hr = InternalPointer->LockRect( &lockedRect, &nativeRect, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockRect( &lockedRect, &nativeRect, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -758,7 +758,7 @@ namespace Direct3D9
 
 	Result Surface::UnlockRectangle()
 	{
-		HRESULT hr = InternalPointer->UnlockRect();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockRect() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -766,7 +766,7 @@ namespace Direct3D9
 	{
 		HDC hdc;
 		
-		HRESULT hr = InternalPointer->GetDC( &hdc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDC( &hdc ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return IntPtr::Zero;
@@ -777,7 +777,7 @@ namespace Direct3D9
 
 	Result Surface::ReleaseDC( IntPtr hdc )
 	{
-		HRESULT hr = InternalPointer->ReleaseDC( static_cast<HDC>( hdc.ToPointer() ) );
+		HRESULT hr = TIME_CALL( InternalPointer->ReleaseDC( static_cast<HDC>( hdc.ToPointer() ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -787,7 +787,7 @@ namespace Direct3D9
 		GUID guid = Utilities::GetNativeGuidForType( TContainer::typeid );
 		void *resultPointer;
 
-		HRESULT hr = InternalPointer->GetContainer( guid, &resultPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetContainer( guid, &resultPointer ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return TContainer();
 
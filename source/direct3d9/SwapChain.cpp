@@ -57,7 +57,7 @@ namespace Direct3D9
 		d3dpp = presentParameters->ToUnmanaged();
 
 		IDirect3DSwapChain9* swapChain;
-		HRESULT hr = device->InternalPointer->CreateAdditionalSwapChain( &d3dpp, &swapChain );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateAdditionalSwapChain( &d3dpp, &swapChain ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( "Failed to create swap chain." );
@@ -68,7 +68,7 @@ namespace Direct3D9
 	Surface^ SwapChain::GetBackBuffer( int index )
 	{
 		IDirect3DSurface9* surface;
-		HRESULT hr = InternalPointer->GetBackBuffer( index, D3DBACKBUFFER_TYPE_MONO, &surface );
+		HRESULT hr = TIME_CALL( InternalPointer->GetBackBuffer( index, D3DBACKBUFFER_TYPE_MONO, &surface ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -81,14 +81,14 @@ namespace Direct3D9
 		if( destinationSurface == nullptr )
 			throw gcnew ArgumentNullException( "destinationSurface" );
 
-		HRESULT hr = InternalPointer->GetFrontBufferData( destinationSurface->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFrontBufferData( destinationSurface->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	SlimDX::Direct3D9::Device^ SwapChain::Device::get()
 	{
 		IDirect3DDevice9* device;
-		HRESULT hr = InternalPointer->GetDevice( &device );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDevice( &device ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -99,7 +99,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::DisplayMode SwapChain::DisplayMode::get()
 	{
 		SlimDX::Direct3D9::DisplayMode mode;
-		HRESULT hr = InternalPointer->GetDisplayMode( reinterpret_cast<D3DDISPLAYMODE*>( &mode ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplayMode( reinterpret_cast<D3DDISPLAYMODE*>( &mode ) ) );
 		RECORD_D3D9( hr );
 
 		return mode;
@@ -108,7 +108,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::RasterStatus SwapChain::RasterStatus::get()
 	{
 		D3DRASTER_STATUS status;
-		HRESULT hr = InternalPointer->GetRasterStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRasterStatus( &status ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return SlimDX::Direct3D9::RasterStatus();
@@ -122,7 +122,7 @@ namespace Direct3D9
 	SlimDX::Direct3D9::PresentParameters^ SwapChain::PresentParameters::get()
 	{
 		D3DPRESENT_PARAMETERS d3dpp;
-		HRESULT hr = InternalPointer->GetPresentParameters( &d3dpp );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPresentParameters( &d3dpp ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -131,7 +131,7 @@ namespace Direct3D9
 
 	Result SwapChain::Present( SlimDX::Direct3D9::Present flags )
 	{
-		HRESULT hr = InternalPointer->Present( 0, 0, 0, 0, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( 0, 0, 0, 0, static_cast<DWORD>( flags ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -148,7 +148,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->Present( sourcePtr, destPtr, NULL, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( sourcePtr, destPtr, NULL, NULL, static_cast<DWORD>( flags ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -166,7 +166,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), NULL, static_cast<DWORD>( flags ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -190,7 +190,7 @@ namespace Direct3D9
 		if( destinationRectangle != Rectangle::Empty )
 			destPtr = &nativeDestRect;
 	
-		HRESULT hr = InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), &nativeRegion, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Present( sourcePtr, destPtr, static_cast<HWND>( windowOverride.ToPointer() ), &nativeRegion, static_cast<DWORD>( flags ) ) );
 
 		return RECORD_D3D9( hr );
 	}
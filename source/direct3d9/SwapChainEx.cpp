@@ -47,7 +47,7 @@ namespace Direct3D9
 	{
 		D3DDISPLAYMODEEX nativeMode = {0};
 		nativeMode.Size = sizeof(D3DDISPLAYMODEEX);
-		HRESULT hr = InternalPointer->GetDisplayModeEx( &nativeMode, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplayModeEx( &nativeMode, NULL ) );
 		RECORD_D3D9( hr );
 
 		DisplayModeEx mode = DisplayModeEx::FromUnmanaged( nativeMode );
@@ -60,7 +60,7 @@ namespace Direct3D9
 		nativeMode.Size = sizeof(D3DDISPLAYMODEEX);
 		D3DDISPLAYROTATION nativeRotation = D3DDISPLAYROTATION_IDENTITY;
 
-		HRESULT hr = InternalPointer->GetDisplayModeEx( &nativeMode, &nativeRotation );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDisplayModeEx( &nativeMode, &nativeRotation ) );
 		RECORD_D3D9( hr );
 
 		rotation = static_cast<DisplayRotation>( nativeRotation );
@@ -46,8 +46,8 @@ namespace Direct3D9
 	Texture::Texture( SlimDX::Direct3D9::Device^ device, int width, int height, int numLevels, Usage usage, Format format, Pool pool )
 	{
 		IDirect3DTexture9* texture = NULL;
-		HRESULT hr = device->InternalPointer->CreateTexture( width, height, numLevels, static_cast<DWORD>( usage ), 
-			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateTexture( width, height, numLevels, static_cast<DWORD>( usage ), 
+			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, NULL ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -61,8 +61,8 @@ namespace Direct3D9
 	{
 		IDirect3DTexture9* texture = NULL;
 		HANDLE sharedHandleNative = sharedHandle.ToPointer();
-		HRESULT hr = device->InternalPointer->CreateTexture( width, height, numLevels, static_cast<DWORD>( usage ), 
-			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateTexture( width, height, numLevels, static_cast<DWORD>( usage ), 
+			static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -81,9 +81,9 @@ namespace Direct3D9
 		HRESULT hr;									// Error code.
 
 		// Get texture requirements.
-		hr = D3DXCheckTextureRequirements(device->InternalPointer, reinterpret_cast<UINT*>( &width ), 
+		hr = TIME_CALL( D3DXCheckTextureRequirements(device->InternalPointer, reinterpret_cast<UINT*>( &width ), 
 			reinterpret_cast<UINT*>( &height ), reinterpret_cast<UINT*>( &numMipLevels ), static_cast<DWORD>( usage ),
-			&d3dFormat, static_cast<D3DPOOL>( pool ) );
+			&d3dFormat, static_cast<D3DPOOL>( pool ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return TextureRequirements();
@@ -103,11 +103,11 @@ namespace Direct3D9
 	{
 		IDirect3DTexture9* texture = NULL;
 
-		HRESULT hr = D3DXCreateTextureFromFileInMemoryEx( device->InternalPointer, memory, size, width,
+		HRESULT hr = TIME_CALL( D3DXCreateTextureFromFileInMemoryEx( device->InternalPointer, memory, size, width,
 			height, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ),
 			static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ),
 			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ), 
-			reinterpret_cast<PALETTEENTRY*>( palette ), &texture );
+			reinterpret_cast<PALETTEENTRY*>( palette ), &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 		{
@@ -144,10 +144,10 @@ namespace Direct3D9
 		imageInformation = ImageInformation();
 		pin_ptr<ImageInformation> pinnedImageInfo = &imageInformation;
 
-		HRESULT hr = D3DXCreateTextureFromFileInMemoryEx( device->InternalPointer, pinnedMemory, memory->Length, width,
+		HRESULT hr = TIME_CALL( D3DXCreateTextureFromFileInMemoryEx( device->InternalPointer, pinnedMemory, memory->Length, width,
 			height, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ),
 			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), 
-			NULL, &texture );
+			NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -164,9 +164,9 @@ namespace Direct3D9
 		IDirect3DTexture9* texture = NULL;
 		pin_ptr<unsigned char> pinnedMemory = &memory[0];
 
-		HRESULT hr = D3DXCreateTextureFromFileInMemoryEx( device->InternalPointer, pinnedMemory, memory->Length, width,
+		HRESULT hr = TIME_CALL( D3DXCreateTextureFromFileInMemoryEx( device->InternalPointer, pinnedMemory, memory->Length, width,
 			height, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ),
-			static_cast<D3DCOLOR>( colorKey ), 0, 0, &texture );
+			static_cast<D3DCOLOR>( colorKey ), 0, 0, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -282,9 +282,9 @@ namespace Direct3D9
 		palette = gcnew array<PaletteEntry>( 256 );
 		pin_ptr<PaletteEntry> pinnedPalette = &palette[0];
 
-		HRESULT hr = D3DXCreateTextureFromFileEx( device->InternalPointer, pinnedName, width, height, 
+		HRESULT hr = TIME_CALL( D3DXCreateTextureFromFileEx( device->InternalPointer, pinnedName, width, height, 
 			numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ), 
-			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), reinterpret_cast<PALETTEENTRY*>( pinnedPalette ), &texture );
+			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), reinterpret_cast<PALETTEENTRY*>( pinnedPalette ), &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 		{
@@ -306,9 +306,9 @@ namespace Direct3D9
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 		pin_ptr<ImageInformation> pinnedImageInfo = &imageInformation;
 
-		HRESULT hr = D3DXCreateTextureFromFileEx( device->InternalPointer, pinnedName, width, height, 
+		HRESULT hr = TIME_CALL( D3DXCreateTextureFromFileEx( device->InternalPointer, pinnedName, width, height, 
 			numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ), 
-			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), NULL, &texture );
+			colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -325,9 +325,9 @@ namespace Direct3D9
 		IDirect3DTexture9* texture = NULL;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXCreateTextureFromFileEx( device->InternalPointer, pinnedName, width, height, 
+		HRESULT hr = TIME_CALL( D3DXCreateTextureFromFileEx( device->InternalPointer, pinnedName, width, height, 
 			numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ), 
-			colorKey, NULL, NULL, &texture );
+			colorKey, NULL, NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -353,8 +353,8 @@ namespace Direct3D9
 	{
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 
-		HRESULT hr = D3DXComputeNormalMap( texture->InternalPointer, sourceTexture->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ),
-			static_cast<DWORD>( flags ), static_cast<DWORD>( channel ), amplitude );
+		HRESULT hr = TIME_CALL( D3DXComputeNormalMap( texture->InternalPointer, sourceTexture->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ),
+			static_cast<DWORD>( flags ), static_cast<DWORD>( channel ), amplitude ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -409,14 +409,14 @@ namespace Direct3D9
 
 	Result Texture::Fill(Fill2DCallback^ callback)
 	{
-		HRESULT hr = D3DXFillTexture(InternalPointer, NativeD3DXFill2D, Marshal::GetFunctionPointerForDelegate(callback).ToPointer());
+		HRESULT hr = TIME_CALL( D3DXFillTexture(InternalPointer, NativeD3DXFill2D, Marshal::GetFunctionPointerForDelegate(callback).ToPointer()) );
 
 		return RECORD_D3D9(hr);
 	}
 
 	Result Texture::Fill( TextureShader^ shader )
 	{
-		HRESULT hr = D3DXFillTextureTX( InternalPointer, shader->InternalPointer );
+		HRESULT hr = TIME_CALL( D3DXFillTextureTX( InternalPointer, shader->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -425,13 +425,13 @@ namespace Direct3D9
 		D3DLOCKED_RECT lockedRect;
 		RECT nativeRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
 
-		HRESULT hr = InternalPointer->LockRect( level, &lockedRect, &nativeRect, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockRect( level, &lockedRect, &nativeRect, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 		
 		D3DSURFACE_DESC desc;
-		hr = InternalPointer->GetLevelDesc(level, &desc);
+		hr = TIME_CALL( InternalPointer->GetLevelDesc(level, &desc) );
 		if (RECORD_D3D9(hr).IsFailure)
 			return nullptr;
 
@@ -448,13 +448,13 @@ namespace Direct3D9
 	{
 		D3DLOCKED_RECT lockedRect;
 
-		HRESULT hr = InternalPointer->LockRect( level, &lockedRect, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockRect( level, &lockedRect, NULL, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 		
 		D3DSURFACE_DESC desc;
-		hr = InternalPointer->GetLevelDesc(level, &desc);
+		hr = TIME_CALL( InternalPointer->GetLevelDesc(level, &desc) );
 		if (RECORD_D3D9(hr).IsFailure)
 			return nullptr;
 
@@ -469,27 +469,27 @@ namespace Direct3D9
 
 	Result Texture::UnlockRectangle( int level )
 	{
-		HRESULT hr = InternalPointer->UnlockRect( level );
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockRect( level ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Texture::AddDirtyRectangle()
 	{
-		HRESULT hr = InternalPointer->AddDirtyRect( NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDirtyRect( NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Texture::AddDirtyRectangle( System::Drawing::Rectangle rect )
 	{
 		RECT nativeRect = { rect.Left, rect.Top, rect.Right, rect.Bottom };
-		HRESULT hr = InternalPointer->AddDirtyRect( &nativeRect );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDirtyRect( &nativeRect ) );
 		return RECORD_D3D9( hr );
 	}
 
 	SurfaceDescription Texture::GetLevelDescription( int level )
 	{
 		SurfaceDescription description;
-		HRESULT hr = InternalPointer->GetLevelDesc( level, reinterpret_cast<D3DSURFACE_DESC*>( &description ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetLevelDesc( level, reinterpret_cast<D3DSURFACE_DESC*>( &description ) ) );
 		RECORD_D3D9( hr );
 		return description;
 	}
@@ -497,7 +497,7 @@ namespace Direct3D9
 	Surface^ Texture::GetSurfaceLevel( int level )
 	{
 		IDirect3DSurface9* surface;
-		HRESULT hr = InternalPointer->GetSurfaceLevel( level, &surface );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSurfaceLevel( level, &surface ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -46,7 +46,7 @@ namespace Direct3D9
 	{
 		ID3DXTextureShader *result;
 
-		HRESULT hr = D3DXCreateTextureShader( reinterpret_cast<const DWORD*>( stream->PositionPointer ), &result );
+		HRESULT hr = TIME_CALL( D3DXCreateTextureShader( reinterpret_cast<const DWORD*>( stream->PositionPointer ), &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -98,7 +98,7 @@ namespace Direct3D9
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
 		unsigned int count = 1;
 
-		HRESULT hr = InternalPointer->GetConstantDesc( nativeHandle, &nativeDesc, &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConstantDesc( nativeHandle, &nativeDesc, &count ) );
 		GC::KeepAlive( handle );
 		
 		if( RECORD_D3D9(hr).IsFailure )
@@ -113,13 +113,13 @@ namespace Direct3D9
 		D3DXHANDLE nativeHandle = handle != nullptr ? handle->InternalHandle : NULL;
 		unsigned int count = 0;
 
-		HRESULT hr = InternalPointer->GetConstantDesc( nativeHandle, NULL, &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConstantDesc( nativeHandle, NULL, &count ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 
 		stack_array<D3DXCONSTANT_DESC> nativeDescArray = stackalloc( D3DXCONSTANT_DESC, count );
-		hr = InternalPointer->GetConstantDesc( nativeHandle, &nativeDescArray[0], &count );
+		hr = TIME_CALL( InternalPointer->GetConstantDesc( nativeHandle, &nativeDescArray[0], &count ) );
 		GC::KeepAlive( handle );
 		
 		if( RECORD_D3D9(hr).IsFailure )
@@ -137,7 +137,7 @@ namespace Direct3D9
 	DataStream^ TextureShader::ConstantBuffer::get()
 	{
 		ID3DXBuffer *result = NULL;
-		HRESULT hr = InternalPointer->GetConstantBuffer( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConstantBuffer( &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -148,7 +148,7 @@ namespace Direct3D9
 	DataStream^ TextureShader::FunctionStream::get()
 	{
 		ID3DXBuffer *result = NULL;
-		HRESULT hr = InternalPointer->GetFunction( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFunction( &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -158,14 +158,14 @@ namespace Direct3D9
 
 	Result TextureShader::SetDefaults()
 	{
-		HRESULT hr = InternalPointer->SetDefaults();
+		HRESULT hr = TIME_CALL( InternalPointer->SetDefaults() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result TextureShader::SetValue( EffectHandle^ constant, bool value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetBool( handle, value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetBool( handle, value ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -179,7 +179,7 @@ namespace Direct3D9
 
 		D3DXHANDLE handle = parameter != nullptr ? parameter->InternalHandle : NULL;
 		pin_ptr<BOOL> pinnedValue = &expandedArray[0];
-		HRESULT hr = InternalPointer->SetBoolArray( handle, pinnedValue, values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetBoolArray( handle, pinnedValue, values->Length ) );
 		GC::KeepAlive( parameter );
 		return RECORD_D3D9( hr );
 	}
@@ -187,7 +187,7 @@ namespace Direct3D9
 	Result TextureShader::SetValue( EffectHandle^ constant, int value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetInt( handle, value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetInt( handle, value ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -196,7 +196,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
 		pin_ptr<int> pinned_value = &values[0];
-		HRESULT hr = InternalPointer->SetIntArray( handle, pinned_value, values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetIntArray( handle, pinned_value, values->Length ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -204,7 +204,7 @@ namespace Direct3D9
 	Result TextureShader::SetValue( EffectHandle^ constant, float value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetFloat( handle, value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFloat( handle, value ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -213,7 +213,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
 		pin_ptr<float> pinned_values = &values[0];
-		HRESULT hr = InternalPointer->SetFloatArray( handle, pinned_values, values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFloatArray( handle, pinned_values, values->Length ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -221,7 +221,7 @@ namespace Direct3D9
 	Result TextureShader::SetValue( EffectHandle^ constant, Vector4 value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetVector( handle, reinterpret_cast<const D3DXVECTOR4*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVector( handle, reinterpret_cast<const D3DXVECTOR4*>( &value ) ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -230,7 +230,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
 		pin_ptr<Vector4> pinned_value = &values[0];
-		HRESULT hr = InternalPointer->SetVectorArray( handle, reinterpret_cast<const D3DXVECTOR4*>( pinned_value ), values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVectorArray( handle, reinterpret_cast<const D3DXVECTOR4*>( pinned_value ), values->Length ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -238,7 +238,7 @@ namespace Direct3D9
 	Result TextureShader::SetValue( EffectHandle^ constant, Color4 value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetVector( handle, reinterpret_cast<const D3DXVECTOR4*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVector( handle, reinterpret_cast<const D3DXVECTOR4*>( &value ) ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -247,7 +247,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
 		pin_ptr<Color4> pinned_value = &values[0];
-		HRESULT hr = InternalPointer->SetVectorArray( handle, reinterpret_cast<const D3DXVECTOR4*>( pinned_value ), values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVectorArray( handle, reinterpret_cast<const D3DXVECTOR4*>( pinned_value ), values->Length ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -255,7 +255,7 @@ namespace Direct3D9
 	Result TextureShader::SetValue( EffectHandle^ constant, Matrix value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetMatrix( handle, reinterpret_cast<const D3DXMATRIX*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMatrix( handle, reinterpret_cast<const D3DXMATRIX*>( &value ) ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -264,7 +264,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
 		pin_ptr<Matrix> pinned_value = &values[0];
-		HRESULT hr = InternalPointer->SetMatrixArray( handle, reinterpret_cast<const D3DXMATRIX*>( pinned_value ), values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMatrixArray( handle, reinterpret_cast<const D3DXMATRIX*>( pinned_value ), values->Length ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -272,7 +272,7 @@ namespace Direct3D9
 	Result TextureShader::SetValueTranspose( EffectHandle^ constant, Matrix value )
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
-		HRESULT hr = InternalPointer->SetMatrixTranspose( handle, reinterpret_cast<const D3DXMATRIX*>( &value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMatrixTranspose( handle, reinterpret_cast<const D3DXMATRIX*>( &value ) ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -281,7 +281,7 @@ namespace Direct3D9
 	{
 		D3DXHANDLE handle = constant != nullptr ? constant->InternalHandle : NULL;
 		pin_ptr<Matrix> pinned_value = &values[0];
-		HRESULT hr = InternalPointer->SetMatrixTransposeArray( handle, reinterpret_cast<const D3DXMATRIX*>( pinned_value ), values->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMatrixTransposeArray( handle, reinterpret_cast<const D3DXMATRIX*>( pinned_value ), values->Length ) );
 		GC::KeepAlive( constant );
 		return RECORD_D3D9( hr );
 	}
@@ -291,7 +291,7 @@ namespace Direct3D9
 		D3DXCONSTANTTABLE_DESC nativeDesc;
 		ConstantTableDescription description;
 
-		HRESULT hr = InternalPointer->GetDesc( &nativeDesc );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( &nativeDesc ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return description;
@@ -105,17 +105,17 @@ namespace Direct3D9
 		{
 			GCHandle handle = GCHandle::Alloc(callback);
 
-			hr = D3DXUVAtlasCreate( mesh->InternalPointer, maxChartCount, maxStretch, width, height, gutter, textureIndex,
+			hr = TIME_CALL( D3DXUVAtlasCreate( mesh->InternalPointer, maxChartCount, maxStretch, width, height, gutter, textureIndex,
 				inputAdjacencyPtr, falseEdgesPtr, imtPtr, NativeAtlasCallback, callbackFrequency, GCHandle::ToIntPtr(handle).ToPointer(), 
-				static_cast<DWORD>( quality ), &meshOut, &facePartitioning, &vertexRemap, &maxStretchOut, &numChartsOut );
+				static_cast<DWORD>( quality ), &meshOut, &facePartitioning, &vertexRemap, &maxStretchOut, &numChartsOut ) );
 
 			handle.Free();
 		}
 		else
 		{
-			hr = D3DXUVAtlasCreate( mesh->InternalPointer, maxChartCount, maxStretch, width, height, gutter, textureIndex,
+			hr = TIME_CALL( D3DXUVAtlasCreate( mesh->InternalPointer, maxChartCount, maxStretch, width, height, gutter, textureIndex,
 				inputAdjacencyPtr, falseEdgesPtr, imtPtr, NULL, callbackFrequency, NULL, static_cast<DWORD>( quality ), &meshOut, 
-				&facePartitioning, &vertexRemap, &maxStretchOut, &numChartsOut );
+				&facePartitioning, &vertexRemap, &maxStretchOut, &numChartsOut ) );
 		}
 
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -176,17 +176,17 @@ namespace Direct3D9
 		{
 			GCHandle handle = GCHandle::Alloc(callback);
 
-			hr = D3DXUVAtlasPartition( mesh->InternalPointer, maxChartCount, maxStretch, textureIndex,
+			hr = TIME_CALL( D3DXUVAtlasPartition( mesh->InternalPointer, maxChartCount, maxStretch, textureIndex,
 				inputAdjacencyPtr, falseEdgesPtr, imtPtr, NativeAtlasCallback, callbackFrequency, GCHandle::ToIntPtr(handle).ToPointer(), 
-				static_cast<DWORD>( quality ), &meshOut, &facePartitioning, &vertexRemap, &partitionResult, &maxStretchOut, &numChartsOut );
+				static_cast<DWORD>( quality ), &meshOut, &facePartitioning, &vertexRemap, &partitionResult, &maxStretchOut, &numChartsOut ) );
 
 			handle.Free();
 		}
 		else
 		{
-			hr = D3DXUVAtlasPartition( mesh->InternalPointer, maxChartCount, maxStretch, textureIndex,
+			hr = TIME_CALL( D3DXUVAtlasPartition( mesh->InternalPointer, maxChartCount, maxStretch, textureIndex,
 				inputAdjacencyPtr, falseEdgesPtr, imtPtr, NULL, callbackFrequency, NULL, static_cast<DWORD>( quality ), &meshOut, 
-				&facePartitioning, &vertexRemap, &partitionResult, &maxStretchOut, &numChartsOut );
+				&facePartitioning, &vertexRemap, &partitionResult, &maxStretchOut, &numChartsOut ) );
 		}
 
 		if( RECORD_D3D9( hr ).IsFailure )
@@ -216,17 +216,17 @@ namespace Direct3D9
 		{
 			GCHandle handle = GCHandle::Alloc(callback);
 
-			hr = D3DXUVAtlasPack( mesh->InternalPointer, width, height, gutter, textureIndex,
+			hr = TIME_CALL( D3DXUVAtlasPack( mesh->InternalPointer, width, height, gutter, textureIndex,
 				reinterpret_cast<DWORD*>( pinnedAdj ), NativeAtlasCallback, callbackFrequency, GCHandle::ToIntPtr(handle).ToPointer(), 
-				static_cast<DWORD>( quality ), facePartitioning->GetD3DBuffer() );
+				static_cast<DWORD>( quality ), facePartitioning->GetD3DBuffer() ) );
 
 			handle.Free();
 		}
 		else
 		{
-			hr = D3DXUVAtlasPack( mesh->InternalPointer, width, height, gutter, textureIndex,
+			hr = TIME_CALL( D3DXUVAtlasPack( mesh->InternalPointer, width, height, gutter, textureIndex,
 				reinterpret_cast<DWORD*>( pinnedAdj ), NULL, callbackFrequency, NULL, 
-				static_cast<DWORD>( quality ), facePartitioning->GetD3DBuffer() );
+				static_cast<DWORD>( quality ), facePartitioning->GetD3DBuffer() ) );
 		}
 
 		return RECORD_D3D9( hr );
@@ -0,0 +1,425 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+
+#include "../Utilities.h"
+
+#include "Direct3D9Exception.h"
+
+#include "Device.h"
+#include "UserPrimitiveBatcher.h"
+#include "UserPrimitiveBatcherKernels.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	UserPrimitiveBatcher::UserPrimitiveBatcher( SlimDX::Direct3D9::Device^ device, int vertexBufferSize, int indexBufferSize, bool sixteenBit )
+	{
+		if( device == nullptr )
+			throw gcnew ArgumentNullException( "device" );
+		if( vertexBufferSize <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexBufferSize" );
+		if( indexBufferSize <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "indexBufferSize" );
+
+		m_Device = device;
+		m_VertexBufferSize = vertexBufferSize;
+		m_IndexBufferSize = indexBufferSize;
+		m_SixteenBit = sixteenBit;
+
+		HRESULT hr = TIME_CALL( CreateBuffers() );
+		if( RECORD_D3D9( hr ).IsFailure )
+			throw gcnew Direct3D9Exception( Result::Last );
+
+		m_VertexStaging = new unsigned char[vertexBufferSize];
+		m_IndexStaging = new unsigned char[indexBufferSize];
+	}
+
+	UserPrimitiveBatcher::~UserPrimitiveBatcher()
+	{
+		this->!UserPrimitiveBatcher();
+	}
+
+	UserPrimitiveBatcher::!UserPrimitiveBatcher()
+	{
+		ReleaseBuffers();
+
+		delete[] m_VertexStaging;
+		delete[] m_IndexStaging;
+		m_VertexStaging = NULL;
+		m_IndexStaging = NULL;
+		m_BatchVertexCount = 0;
+	}
+
+	void UserPrimitiveBatcher::CheckDisposed()
+	{
+		if( m_VertexStaging == NULL )
+			throw gcnew ObjectDisposedException( GetType()->FullName );
+	}
+
+	HRESULT UserPrimitiveBatcher::CreateBuffers()
+	{
+		IDirect3DDevice9* device = m_Device->InternalPointer;
+		IDirect3DVertexBuffer9* vertexBuffer;
+		IDirect3DIndexBuffer9* indexBuffer;
+
+		HRESULT hr = TIME_CALL( device->CreateVertexBuffer( m_VertexBufferSize, D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, 0, D3DPOOL_DEFAULT, &vertexBuffer, NULL ) );
+		if( FAILED( hr ) )
+			return hr;
+
+		hr = TIME_CALL( device->CreateIndexBuffer( m_IndexBufferSize, D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, m_SixteenBit ? D3DFMT_INDEX16 : D3DFMT_INDEX32,
+			D3DPOOL_DEFAULT, &indexBuffer, NULL ) );
+		if( FAILED( hr ) )
+		{
+			vertexBuffer->Release();
+			return hr;
+		}
+
+		m_VertexBuffer = vertexBuffer;
+		m_IndexBuffer = indexBuffer;
+
+		// new buffers start out full, so the first upload into each one discards
+		m_VertexPosition = m_VertexBufferSize;
+		m_IndexPosition = m_IndexBufferSize;
+
+		return hr;
+	}
+
+	void UserPrimitiveBatcher::ReleaseBuffers()
+	{
+		if( m_VertexBuffer != NULL )
+			m_VertexBuffer->Release();
+		if( m_IndexBuffer != NULL )
+			m_IndexBuffer->Release();
+
+		m_VertexBuffer = NULL;
+		m_IndexBuffer = NULL;
+	}
+
+	DWORD UserPrimitiveBatcher::Reserve( int bufferSize, int% position, int alignment, int sizeInBytes, int% offset )
+	{
+		int aligned = ( ( position + alignment - 1 ) / alignment ) * alignment;
+		if( aligned <= bufferSize - sizeInBytes )
+		{
+			offset = aligned;
+			position = aligned + sizeInBytes;
+			return D3DLOCK_NOOVERWRITE;
+		}
+
+		// draws already issued keep reading the old contents; the driver hands back fresh memory
+		++m_DiscardCount;
+		offset = 0;
+		position = sizeInBytes;
+		return D3DLOCK_DISCARD;
+	}
+
+	bool UserPrimitiveBatcher::CanAppend( D3DPRIMITIVETYPE primitiveType, int vertexStride, bool indexed, int vertexCount, int indexCount )
+	{
+		if( m_BatchVertexCount == 0 )
+			return true;
+
+		if( m_BatchType != primitiveType || m_BatchStride != vertexStride || m_BatchIndexed != indexed )
+			return false;
+
+		// strips and fans would need degenerate primitives to join, so only lists are merged
+		if( primitiveType != D3DPT_POINTLIST && primitiveType != D3DPT_LINELIST && primitiveType != D3DPT_TRIANGLELIST )
+			return false;
+
+		if( m_BatchVertexCount + vertexCount > m_VertexBufferSize / vertexStride )
+			return false;
+
+		if( indexed )
+		{
+			if( m_BatchIndexCount + indexCount > m_IndexBufferSize / ( m_SixteenBit ? 2 : 4 ) )
+				return false;
+			if( m_SixteenBit && m_BatchVertexCount + vertexCount > 65536 )
+				return false;
+		}
+
+		return true;
+	}
+
+	Result UserPrimitiveBatcher::Draw( D3DPRIMITIVETYPE primitiveType, int primitiveCount, const void* vertexData, int vertexStride )
+	{
+		++m_SubmittedDrawCount;
+
+		int vertexCount = GetPrimitiveVertexCount( primitiveType, primitiveCount );
+		if( m_VertexBuffer == NULL || vertexCount > m_VertexBufferSize / vertexStride )
+		{
+			Flush();
+
+			HRESULT hr = TIME_CALL( m_Device->InternalPointer->DrawPrimitiveUP( primitiveType, primitiveCount, vertexData, vertexStride ) );
+			++m_IssuedDrawCount;
+			return RECORD_D3D9( hr );
+		}
+
+		Result result( S_OK );
+		if( !CanAppend( primitiveType, vertexStride, false, vertexCount, 0 ) )
+			result = Flush();
+
+		if( m_BatchVertexCount == 0 )
+		{
+			m_BatchType = primitiveType;
+			m_BatchStride = vertexStride;
+			m_BatchIndexed = false;
+		}
+
+		memcpy( m_VertexStaging + m_BatchVertexCount * vertexStride, vertexData, vertexCount * vertexStride );
+		m_BatchVertexCount += vertexCount;
+		m_BatchPrimitiveCount += primitiveCount;
+
+		// strips and fans can't be merged, so they are drawn straight away
+		if( !CanAppend( primitiveType, vertexStride, false, 0, 0 ) )
+			result = Flush();
+
+		return result;
+	}
+
+	Result UserPrimitiveBatcher::DrawIndexed( D3DPRIMITIVETYPE primitiveType, int minimumVertexIndex, int vertexCount, int primitiveCount,
+		const void* indexData, bool sixteenBitIndices, const void* vertexData, int vertexStride )
+	{
+		++m_SubmittedDrawCount;
+
+		int indexCount = GetPrimitiveVertexCount( primitiveType, primitiveCount );
+		if( m_VertexBuffer == NULL || vertexCount > m_VertexBufferSize / vertexStride ||
+			indexCount > m_IndexBufferSize / ( m_SixteenBit ? 2 : 4 ) || ( m_SixteenBit && vertexCount > 65536 ) )
+		{
+			Flush();
+
+			HRESULT hr = TIME_CALL( m_Device->InternalPointer->DrawIndexedPrimitiveUP( primitiveType, minimumVertexIndex, vertexCount, primitiveCount,
+				indexData, sixteenBitIndices ? D3DFMT_INDEX16 : D3DFMT_INDEX32, vertexData, vertexStride ) );
+			++m_IssuedDrawCount;
+			return RECORD_D3D9( hr );
+		}
+
+		Result result( S_OK );
+		if( !CanAppend( primitiveType, vertexStride, true, vertexCount, indexCount ) )
+			result = Flush();
+
+		if( m_BatchVertexCount == 0 )
+		{
+			m_BatchType = primitiveType;
+			m_BatchStride = vertexStride;
+			m_BatchIndexed = true;
+		}
+
+		// only the referenced vertex range is copied, so the indices are moved to point into the batch
+		memcpy( m_VertexStaging + m_BatchVertexCount * vertexStride, static_cast<const unsigned char*>( vertexData ) + minimumVertexIndex * vertexStride,
+			vertexCount * vertexStride );
+		CopyRebasedIndices( m_IndexStaging + m_BatchIndexCount * ( m_SixteenBit ? 2 : 4 ), m_SixteenBit, indexData, sixteenBitIndices,
+			indexCount, m_BatchVertexCount - minimumVertexIndex );
+
+		m_BatchVertexCount += vertexCount;
+		m_BatchIndexCount += indexCount;
+		m_BatchPrimitiveCount += primitiveCount;
+
+		// strips and fans can't be merged, so they are drawn straight away
+		if( !CanAppend( primitiveType, vertexStride, true, 0, 0 ) )
+			result = Flush();
+
+		return result;
+	}
+
+	generic<typename T>
+	Result UserPrimitiveBatcher::DrawUserPrimitives( PrimitiveType primitiveType, int primitiveCount, array<T>^ data )
+	{
+		return DrawUserPrimitives<T>( primitiveType, 0, primitiveCount, data );
+	}
+
+	generic<typename T>
+	Result UserPrimitiveBatcher::DrawUserPrimitives( PrimitiveType primitiveType, int startIndex, int primitiveCount, array<T>^ data )
+	{
+		CheckDisposed();
+
+		if( data == nullptr )
+			throw gcnew ArgumentNullException( "data" );
+		if( primitiveCount <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "primitiveCount" );
+
+		int vertexCount = GetPrimitiveVertexCount( static_cast<D3DPRIMITIVETYPE>( primitiveType ), primitiveCount );
+		if( vertexCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "primitiveType" );
+
+		Utilities::CheckArrayBounds( data, startIndex, vertexCount );
+
+		pin_ptr<T> pinnedData = &data[startIndex];
+		return Draw( static_cast<D3DPRIMITIVETYPE>( primitiveType ), primitiveCount, pinnedData, sizeof(T) );
+	}
+
+	generic<typename S, typename T>
+	Result UserPrimitiveBatcher::DrawIndexedUserPrimitives( PrimitiveType primitiveType, int minimumVertexIndex, int vertexCount, int primitiveCount,
+		array<S>^ indexData, Format indexDataFormat, array<T>^ vertexData, int vertexStride )
+	{
+		return DrawIndexedUserPrimitives<S,T>( primitiveType, 0, 0, minimumVertexIndex, vertexCount, primitiveCount, indexData, indexDataFormat, vertexData, vertexStride );
+	}
+
+	generic<typename S, typename T>
+	Result UserPrimitiveBatcher::DrawIndexedUserPrimitives( PrimitiveType primitiveType, int startIndex, int minimumVertexIndex, int vertexCount, int primitiveCount,
+		array<S>^ indexData, Format indexDataFormat, array<T>^ vertexData, int vertexStride )
+	{
+		return DrawIndexedUserPrimitives<S,T>( primitiveType, startIndex, 0, minimumVertexIndex, vertexCount, primitiveCount, indexData, indexDataFormat, vertexData, vertexStride );
+	}
+
+	generic<typename S, typename T>
+	Result UserPrimitiveBatcher::DrawIndexedUserPrimitives( PrimitiveType primitiveType, int startIndex, int startVertex, int minimumVertexIndex, int vertexCount, int primitiveCount,
+		array<S>^ indexData, Format indexDataFormat, array<T>^ vertexData, int vertexStride )
+	{
+		CheckDisposed();
+
+		if( indexData == nullptr )
+			throw gcnew ArgumentNullException( "indexData" );
+		if( vertexData == nullptr )
+			throw gcnew ArgumentNullException( "vertexData" );
+		if( indexDataFormat != Format::Index16 && indexDataFormat != Format::Index32 )
+			throw gcnew ArgumentException( "Index data must be in Index16 or Index32 format.", "indexDataFormat" );
+		if( primitiveCount <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "primitiveCount" );
+		if( minimumVertexIndex < 0 )
+			throw gcnew ArgumentOutOfRangeException( "minimumVertexIndex" );
+		if( vertexCount <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexCount" );
+		if( vertexStride <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "vertexStride" );
+		if( startIndex < 0 || startIndex >= indexData->Length )
+			throw gcnew ArgumentOutOfRangeException( "startIndex" );
+		if( startVertex < 0 || startVertex >= vertexData->Length )
+			throw gcnew ArgumentOutOfRangeException( "startVertex" );
+
+		int indexCount = GetPrimitiveVertexCount( static_cast<D3DPRIMITIVETYPE>( primitiveType ), primitiveCount );
+		if( indexCount < 0 )
+			throw gcnew ArgumentOutOfRangeException( "primitiveType" );
+
+		bool sixteenBitIndices = indexDataFormat == Format::Index16;
+		if( static_cast<Int64>( indexData->Length - startIndex ) * sizeof(S) < static_cast<Int64>( indexCount ) * ( sixteenBitIndices ? 2 : 4 ) )
+			throw gcnew ArgumentException( "The index array is too small for the given primitive count.", "indexData" );
+		if( static_cast<Int64>( vertexData->Length - startVertex ) * sizeof(T) < static_cast<Int64>( minimumVertexIndex + vertexCount ) * vertexStride )
+			throw gcnew ArgumentException( "The vertex array is too small for the given vertex range.", "vertexData" );
+
+		pin_ptr<S> pinnedIndices = &indexData[startIndex];
+		pin_ptr<T> pinnedVertices = &vertexData[startVertex];
+
+		return DrawIndexed( static_cast<D3DPRIMITIVETYPE>( primitiveType ), minimumVertexIndex, vertexCount, primitiveCount,
+			pinnedIndices, sixteenBitIndices, pinnedVertices, vertexStride );
+	}
+
+	Result UserPrimitiveBatcher::Flush()
+	{
+		CheckDisposed();
+
+		if( m_BatchVertexCount == 0 )
+			return Result( S_OK );
+
+		D3DPRIMITIVETYPE primitiveType = m_BatchType;
+		int stride = m_BatchStride;
+		bool indexed = m_BatchIndexed;
+		int vertexCount = m_BatchVertexCount;
+		int indexCount = m_BatchIndexCount;
+		int primitiveCount = m_BatchPrimitiveCount;
+		int indexSize = m_SixteenBit ? 2 : 4;
+
+		// the batch is dropped even if the upload fails, so one bad lock doesn't wedge every later draw
+		m_BatchVertexCount = 0;
+		m_BatchIndexCount = 0;
+		m_BatchPrimitiveCount = 0;
+
+		if( m_VertexBuffer == NULL )
+			return Result( S_OK );
+
+		int vertexOffset;
+		DWORD flags = Reserve( m_VertexBufferSize, m_VertexPosition, stride, vertexCount * stride, vertexOffset );
+
+		void* data;
+		HRESULT hr = TIME_CALL( m_VertexBuffer->Lock( vertexOffset, vertexCount * stride, &data, flags ) );
+		if( FAILED( hr ) )
+			return RECORD_D3D9( hr );
+
+		memcpy( data, m_VertexStaging, vertexCount * stride );
+		m_VertexBuffer->Unlock();
+
+		int indexOffset = 0;
+		if( indexed )
+		{
+			flags = Reserve( m_IndexBufferSize, m_IndexPosition, indexSize, indexCount * indexSize, indexOffset );
+
+			hr = TIME_CALL( m_IndexBuffer->Lock( indexOffset, indexCount * indexSize, &data, flags ) );
+			if( FAILED( hr ) )
+				return RECORD_D3D9( hr );
+
+			memcpy( data, m_IndexStaging, indexCount * indexSize );
+			m_IndexBuffer->Unlock();
+		}
+
+		IDirect3DDevice9* device = m_Device->InternalPointer;
+		hr = TIME_CALL( device->SetStreamSource( 0, m_VertexBuffer, 0, stride ) );
+		if( FAILED( hr ) )
+			return RECORD_D3D9( hr );
+
+		if( indexed )
+		{
+			hr = TIME_CALL( device->SetIndices( m_IndexBuffer ) );
+			if( FAILED( hr ) )
+				return RECORD_D3D9( hr );
+
+			hr = TIME_CALL( device->DrawIndexedPrimitive( primitiveType, vertexOffset / stride, 0, vertexCount, indexOffset / indexSize, primitiveCount ) );
+		}
+		else
+			hr = TIME_CALL( device->DrawPrimitive( primitiveType, vertexOffset / stride, primitiveCount ) );
+
+		++m_IssuedDrawCount;
+		return RECORD_D3D9( hr );
+	}
+
+	Result UserPrimitiveBatcher::OnLostDevice()
+	{
+		CheckDisposed();
+
+		m_BatchVertexCount = 0;
+		m_BatchIndexCount = 0;
+		m_BatchPrimitiveCount = 0;
+		ReleaseBuffers();
+
+		return Result( S_OK );
+	}
+
+	Result UserPrimitiveBatcher::OnResetDevice()
+	{
+		CheckDisposed();
+
+		if( m_VertexBuffer != NULL )
+			return Result( S_OK );
+
+		HRESULT hr = TIME_CALL( CreateBuffers() );
+		return RECORD_D3D9( hr );
+	}
+
+	void UserPrimitiveBatcher::ResetStatistics()
+	{
+		m_SubmittedDrawCount = 0;
+		m_IssuedDrawCount = 0;
+		m_DiscardCount = 0;
+	}
+}
+}
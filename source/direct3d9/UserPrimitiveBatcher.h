@@ -0,0 +1,248 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "Enums.h"
+#include "IResettable.h"
+
+namespace SlimDX
+{
+	namespace Direct3D9
+	{
+		ref class Device;
+
+		/// <summary>
+		/// Collects user-memory draws into ring buffered dynamic vertex and index buffers and merges consecutive compatible draws.
+		/// </summary>
+		/// <remarks>
+		/// <see cref="DrawUserPrimitives"/> and <see cref="DrawIndexedUserPrimitives"/> mirror the <see cref="Device"/> methods of the same
+		/// name, but only copy the data into a staging area. Consecutive point, line and triangle list draws that use the same primitive
+		/// type, vertex size and indexing are merged into one draw call; strips and fans are drawn on their own. The pending batch is
+		/// uploaded with <see cref="LockFlags">LockFlags.NoOverwrite</see>, or <see cref="LockFlags">LockFlags.Discard</see> once the ring
+		/// wraps, and drawn when an incompatible draw arrives, when it fills the ring, or when <see cref="Flush"/> is called.
+		///
+		/// The batcher cannot see calls made directly on the device, so <see cref="Flush"/> must be called before changing any device state
+		/// that should not apply to the draws queued so far, and before <see cref="Device.EndScene"/>. Flushing leaves stream 0 and the
+		/// index buffer bound to the batcher's buffers, where <see cref="Device.DrawUserPrimitives"/> leaves them unset.
+		///
+		/// The buffers are created in the default pool; call <see cref="OnLostDevice"/> before resetting the device and
+		/// <see cref="OnResetDevice"/> afterwards. Draws that do not fit in the ring, or that are made while the buffers are released,
+		/// fall back to the user-memory draw methods of the device.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class UserPrimitiveBatcher sealed : IResettable
+		{
+		private:
+			SlimDX::Direct3D9::Device^ m_Device;
+			IDirect3DVertexBuffer9* m_VertexBuffer;
+			IDirect3DIndexBuffer9* m_IndexBuffer;
+			unsigned char* m_VertexStaging;
+			unsigned char* m_IndexStaging;
+			int m_VertexBufferSize;
+			int m_IndexBufferSize;
+			bool m_SixteenBit;
+
+			int m_VertexPosition;
+			int m_IndexPosition;
+
+			D3DPRIMITIVETYPE m_BatchType;
+			int m_BatchStride;
+			bool m_BatchIndexed;
+			int m_BatchVertexCount;
+			int m_BatchIndexCount;
+			int m_BatchPrimitiveCount;
+
+			int m_SubmittedDrawCount;
+			int m_IssuedDrawCount;
+			int m_DiscardCount;
+
+			void CheckDisposed();
+			HRESULT CreateBuffers();
+			void ReleaseBuffers();
+			Result Draw( D3DPRIMITIVETYPE primitiveType, int primitiveCount, const void* vertexData, int vertexStride );
+			Result DrawIndexed( D3DPRIMITIVETYPE primitiveType, int minimumVertexIndex, int vertexCount, int primitiveCount,
+				const void* indexData, bool sixteenBitIndices, const void* vertexData, int vertexStride );
+			bool CanAppend( D3DPRIMITIVETYPE primitiveType, int vertexStride, bool indexed, int vertexCount, int indexCount );
+			DWORD Reserve( int bufferSize, int% position, int alignment, int sizeInBytes, int% offset );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="UserPrimitiveBatcher"/> class.
+			/// </summary>
+			/// <param name="device">The device to draw with.</param>
+			/// <param name="vertexBufferSize">The size of the vertex ring buffer, in bytes.</param>
+			/// <param name="indexBufferSize">The size of the index ring buffer, in bytes.</param>
+			/// <param name="sixteenBit"><c>true</c> to use 16-bit indices in the index ring buffer; <c>false</c> to use 32-bit indices.</param>
+			UserPrimitiveBatcher( SlimDX::Direct3D9::Device^ device, int vertexBufferSize, int indexBufferSize, bool sixteenBit );
+
+			/// <summary>
+			/// Releases the buffers owned by the batcher. Pending draws are discarded.
+			/// </summary>
+			~UserPrimitiveBatcher();
+
+			/// <summary>
+			/// Releases the buffers owned by the batcher.
+			/// </summary>
+			!UserPrimitiveBatcher();
+
+			/// <summary>
+			/// Queues a non-indexed draw from user memory.
+			/// </summary>
+			/// <typeparam name="T">The type of the user-supplied vertices.</typeparam>
+			/// <param name="primitiveType">Specifies the type of primitive to render.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			/// <param name="data">User-supplied vertex data.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of any draw issued by the call.</returns>
+			generic<typename T> where T : value class
+			Result DrawUserPrimitives( PrimitiveType primitiveType, int primitiveCount, array<T>^ data );
+
+			/// <summary>
+			/// Queues a non-indexed draw from user memory.
+			/// </summary>
+			/// <typeparam name="T">The type of the user-supplied vertices.</typeparam>
+			/// <param name="primitiveType">Specifies the type of primitive to render.</param>
+			/// <param name="startIndex">Index of the first vertex in the array to use.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			/// <param name="data">User-supplied vertex data.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of any draw issued by the call.</returns>
+			generic<typename T> where T : value class
+			Result DrawUserPrimitives( PrimitiveType primitiveType, int startIndex, int primitiveCount, array<T>^ data );
+
+			/// <summary>
+			/// Queues an indexed draw from user memory.
+			/// </summary>
+			/// <typeparam name="S">The type of the user-supplied indices.</typeparam>
+			/// <typeparam name="T">The type of the user-supplied vertices.</typeparam>
+			/// <param name="primitiveType">Specifies the type of primitive to render.</param>
+			/// <param name="minimumVertexIndex">Minimum vertex index referenced by the draw.</param>
+			/// <param name="vertexCount">The number of vertices used by the draw, starting at <paramref name="minimumVertexIndex"/>.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			/// <param name="indexData">User-supplied index data.</param>
+			/// <param name="indexDataFormat">The format of the supplied index data; either <see cref="Format">Format.Index16</see> or <see cref="Format">Format.Index32</see>.</param>
+			/// <param name="vertexData">User-supplied vertex data.</param>
+			/// <param name="vertexStride">The number of bytes of data for each vertex.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of any draw issued by the call.</returns>
+			generic<typename S, typename T> where S : value class where T : value class
+			Result DrawIndexedUserPrimitives( PrimitiveType primitiveType, int minimumVertexIndex, int vertexCount, int primitiveCount, array<S>^ indexData, Format indexDataFormat, array<T>^ vertexData, int vertexStride );
+
+			/// <summary>
+			/// Queues an indexed draw from user memory.
+			/// </summary>
+			/// <typeparam name="S">The type of the user-supplied indices.</typeparam>
+			/// <typeparam name="T">The type of the user-supplied vertices.</typeparam>
+			/// <param name="primitiveType">Specifies the type of primitive to render.</param>
+			/// <param name="startIndex">Index of the first element of the index array to use.</param>
+			/// <param name="minimumVertexIndex">Minimum vertex index referenced by the draw.</param>
+			/// <param name="vertexCount">The number of vertices used by the draw, starting at <paramref name="minimumVertexIndex"/>.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			/// <param name="indexData">User-supplied index data.</param>
+			/// <param name="indexDataFormat">The format of the supplied index data; either <see cref="Format">Format.Index16</see> or <see cref="Format">Format.Index32</see>.</param>
+			/// <param name="vertexData">User-supplied vertex data.</param>
+			/// <param name="vertexStride">The number of bytes of data for each vertex.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of any draw issued by the call.</returns>
+			generic<typename S, typename T> where S : value class where T : value class
+			Result DrawIndexedUserPrimitives( PrimitiveType primitiveType, int startIndex, int minimumVertexIndex, int vertexCount, int primitiveCount, array<S>^ indexData, Format indexDataFormat, array<T>^ vertexData, int vertexStride );
+
+			/// <summary>
+			/// Queues an indexed draw from user memory.
+			/// </summary>
+			/// <typeparam name="S">The type of the user-supplied indices.</typeparam>
+			/// <typeparam name="T">The type of the user-supplied vertices.</typeparam>
+			/// <param name="primitiveType">Specifies the type of primitive to render.</param>
+			/// <param name="startIndex">Index of the first element of the index array to use.</param>
+			/// <param name="startVertex">Index of the first element of the vertex array to use.</param>
+			/// <param name="minimumVertexIndex">Minimum vertex index referenced by the draw.</param>
+			/// <param name="vertexCount">The number of vertices used by the draw, starting at <paramref name="minimumVertexIndex"/>.</param>
+			/// <param name="primitiveCount">The number of primitives to render.</param>
+			/// <param name="indexData">User-supplied index data.</param>
+			/// <param name="indexDataFormat">The format of the supplied index data; either <see cref="Format">Format.Index16</see> or <see cref="Format">Format.Index32</see>.</param>
+			/// <param name="vertexData">User-supplied vertex data.</param>
+			/// <param name="vertexStride">The number of bytes of data for each vertex.</param>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of any draw issued by the call.</returns>
+			generic<typename S, typename T> where S : value class where T : value class
+			Result DrawIndexedUserPrimitives( PrimitiveType primitiveType, int startIndex, int startVertex, int minimumVertexIndex, int vertexCount, int primitiveCount, array<S>^ indexData, Format indexDataFormat, array<T>^ vertexData, int vertexStride );
+
+			/// <summary>
+			/// Uploads and draws the pending batch, if any.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			Result Flush();
+
+			/// <summary>
+			/// Releases the default pool buffers. Pending draws are discarded.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			virtual Result OnLostDevice();
+
+			/// <summary>
+			/// Recreates the default pool buffers after the device has been reset.
+			/// </summary>
+			/// <returns>A <see cref="SlimDX::Result"/> object describing the result of the operation.</returns>
+			virtual Result OnResetDevice();
+
+			/// <summary>
+			/// Resets the draw and discard counters to zero.
+			/// </summary>
+			void ResetStatistics();
+
+			/// <summary>
+			/// Gets the device the batcher draws with.
+			/// </summary>
+			property SlimDX::Direct3D9::Device^ Device
+			{
+				SlimDX::Direct3D9::Device^ get() { return m_Device; }
+			}
+
+			/// <summary>
+			/// Gets the number of draws submitted to the batcher.
+			/// </summary>
+			property int SubmittedDrawCount
+			{
+				int get() { return m_SubmittedDrawCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of draw calls the batcher issued to the device.
+			/// </summary>
+			property int IssuedDrawCount
+			{
+				int get() { return m_IssuedDrawCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of times a ring buffer was locked with <see cref="LockFlags">LockFlags.Discard</see>.
+			/// </summary>
+			property int DiscardCount
+			{
+				int get() { return m_DiscardCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of vertices in the pending batch.
+			/// </summary>
+			property int PendingVertexCount
+			{
+				int get() { return m_BatchVertexCount; }
+			}
+		};
+	}
+}
@@ -0,0 +1,83 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include <d3d9.h>
+
+#include "UserPrimitiveBatcherKernels.h"
+
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace Direct3D9
+{
+	int GetPrimitiveVertexCount( D3DPRIMITIVETYPE primitiveType, int primitiveCount )
+	{
+		switch( primitiveType )
+		{
+		case D3DPT_POINTLIST:
+			return primitiveCount;
+		case D3DPT_LINELIST:
+			return primitiveCount * 2;
+		case D3DPT_LINESTRIP:
+			return primitiveCount + 1;
+		case D3DPT_TRIANGLELIST:
+			return primitiveCount * 3;
+		case D3DPT_TRIANGLESTRIP:
+		case D3DPT_TRIANGLEFAN:
+			return primitiveCount + 2;
+		default:
+			return -1;
+		}
+	}
+
+	namespace
+	{
+		template<typename D, typename S>
+		void CopyRebased( D* destination, const S* source, int count, int bias )
+		{
+			for( int i = 0; i < count; ++i )
+				destination[i] = static_cast<D>( static_cast<int>( source[i] ) + bias );
+		}
+	}
+
+	void CopyRebasedIndices( void* destination, bool destinationSixteenBit, const void* source, bool sourceSixteenBit, int count, int bias )
+	{
+		if( destinationSixteenBit )
+		{
+			if( sourceSixteenBit )
+				CopyRebased( static_cast<WORD*>( destination ), static_cast<const WORD*>( source ), count, bias );
+			else
+				CopyRebased( static_cast<WORD*>( destination ), static_cast<const DWORD*>( source ), count, bias );
+		}
+		else
+		{
+			if( sourceSixteenBit )
+				CopyRebased( static_cast<DWORD*>( destination ), static_cast<const WORD*>( source ), count, bias );
+			else
+				CopyRebased( static_cast<DWORD*>( destination ), static_cast<const DWORD*>( source ), count, bias );
+		}
+	}
+}
+}
+
+#pragma managed(pop)
@@ -39,8 +39,8 @@ namespace Direct3D9
 	VertexBuffer::VertexBuffer( SlimDX::Direct3D9::Device^ device, int sizeInBytes, SlimDX::Direct3D9::Usage usage, VertexFormat format, SlimDX::Direct3D9::Pool pool )
 	{
 		IDirect3DVertexBuffer9* vb;
-		HRESULT hr = device->InternalPointer->CreateVertexBuffer( sizeInBytes, static_cast<DWORD>( usage ), 
-			static_cast<DWORD>( format ), static_cast<D3DPOOL>( pool ), &vb, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateVertexBuffer( sizeInBytes, static_cast<DWORD>( usage ), 
+			static_cast<DWORD>( format ), static_cast<D3DPOOL>( pool ), &vb, NULL ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -55,8 +55,8 @@ namespace Direct3D9
 	{
 		IDirect3DVertexBuffer9* vb;
 		HANDLE sharedHandleNative = NULL;
-		HRESULT hr = device->InternalPointer->CreateVertexBuffer( sizeInBytes, static_cast<DWORD>( usage ), 
-			static_cast<DWORD>( format ), static_cast<D3DPOOL>( pool ), &vb, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateVertexBuffer( sizeInBytes, static_cast<DWORD>( usage ), 
+			static_cast<DWORD>( format ), static_cast<D3DPOOL>( pool ), &vb, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -71,7 +71,7 @@ namespace Direct3D9
 	DataStream^ VertexBuffer::Lock( int offset, int size, LockFlags flags )
 	{
 		void* lockedPtr;
-		HRESULT hr = InternalPointer->Lock( offset, size, &lockedPtr, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Lock( offset, size, &lockedPtr, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -91,7 +91,7 @@ namespace Direct3D9
 	VertexBufferDescription VertexBuffer::Description::get()
 	{
 		VertexBufferDescription desc;
-		HRESULT hr = InternalPointer->GetDesc( reinterpret_cast<D3DVERTEXBUFFER_DESC*>( &desc ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( reinterpret_cast<D3DVERTEXBUFFER_DESC*>( &desc ) ) );
 		RECORD_D3D9( hr );
 
 		return desc;
@@ -59,7 +59,7 @@ namespace Direct3D9
 		
 		IDirect3DVertexDeclaration9* decl;
 
-		HRESULT hr = device->InternalPointer->CreateVertexDeclaration( elementPtr, &decl );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateVertexDeclaration( elementPtr, &decl ) );
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
 
@@ -70,7 +70,7 @@ namespace Direct3D9
 	{
 		unsigned int count = 0;
 
-		HRESULT hr = InternalPointer->GetDeclaration( 0, &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeclaration( 0, &count ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -78,7 +78,7 @@ namespace Direct3D9
 		array<VertexElement>^ decl = gcnew array<VertexElement>( count );
 		pin_ptr<VertexElement> pinnedDecl = &decl[0];
 
-		hr = InternalPointer->GetDeclaration( reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl ), &count );
+		hr = TIME_CALL( InternalPointer->GetDeclaration( reinterpret_cast<D3DVERTEXELEMENT9*>( pinnedDecl ), &count ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -44,7 +44,7 @@ namespace Direct3D9
 	{
 		VolumeDescription description;
 
-		HRESULT hr = InternalPointer->GetDesc( reinterpret_cast<D3DVOLUME_DESC*>( &description ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc( reinterpret_cast<D3DVOLUME_DESC*>( &description ) ) );
 		RECORD_D3D9( hr );
 
 		return description;
@@ -54,7 +54,7 @@ namespace Direct3D9
 	{
 		D3DLOCKED_BOX lockedBox;
 
-		HRESULT hr = InternalPointer->LockBox( &lockedBox, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockBox( &lockedBox, NULL, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -70,7 +70,7 @@ namespace Direct3D9
 	{
 		D3DLOCKED_BOX lockedBox;
 
-		HRESULT hr = InternalPointer->LockBox( &lockedBox, reinterpret_cast<D3DBOX*>( &box ), static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockBox( &lockedBox, reinterpret_cast<D3DBOX*>( &box ), static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -84,18 +84,18 @@ namespace Direct3D9
 
 	Result Volume::UnlockBox()
 	{
-		HRESULT hr = InternalPointer->UnlockBox();
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockBox() );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Volume::FromFileInMemory_Internal( Volume^ volume, const void* memory, UINT size, Filter filter, int colorKey,
 		Box* sourceBox, Box* destinationBox, PaletteEntry* palette, ImageInformation* imageInformation )
 	{
-		HRESULT hr = D3DXLoadVolumeFromFileInMemory( volume->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromFileInMemory( volume->InternalPointer, 
 			reinterpret_cast<const PALETTEENTRY*>( palette ),
 			reinterpret_cast<const D3DBOX*>( destinationBox ), memory, size,
 			reinterpret_cast<const D3DBOX*>( sourceBox ), static_cast<DWORD>( filter ),
-			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ) );
+			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ) ) );
 
 		return RECORD_D3D9( hr );
 	}
@@ -218,11 +218,11 @@ namespace Direct3D9
 		pin_ptr<ImageInformation> pinnedImageInfo = &imageInformation;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXLoadVolumeFromFile( volume->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromFile( volume->InternalPointer, 
 			reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ),
 			reinterpret_cast<const D3DBOX*>( &destinationBox ), pinnedName,
 			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ),
-			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) );
+			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -233,10 +233,10 @@ namespace Direct3D9
 		pin_ptr<ImageInformation> pinnedImageInfo = &imageInformation;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXLoadVolumeFromFile( volume->InternalPointer, NULL,
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromFile( volume->InternalPointer, NULL,
 			reinterpret_cast<const D3DBOX*>( &destinationBox ), pinnedName,
 			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ),
-			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) );
+			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -245,10 +245,10 @@ namespace Direct3D9
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXLoadVolumeFromFile( volume->InternalPointer, NULL,
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromFile( volume->InternalPointer, NULL,
 			reinterpret_cast<const D3DBOX*>( &destinationBox ), pinnedName,
 			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ),
-			static_cast<D3DCOLOR>( colorKey ), NULL );
+			static_cast<D3DCOLOR>( colorKey ), NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -256,8 +256,8 @@ namespace Direct3D9
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXLoadVolumeFromFile( volume->InternalPointer, NULL, NULL, pinnedName,
-			NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), NULL );
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromFile( volume->InternalPointer, NULL, NULL, pinnedName,
+			NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ), NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -268,26 +268,26 @@ namespace Direct3D9
 		pin_ptr<PaletteEntry> pinnedSource = sourcePalette == nullptr ? nullptr : &sourcePalette[0];
 		pin_ptr<PaletteEntry> pinnedDest = destinationPalette == nullptr ? nullptr : &destinationPalette[0];
 
-		HRESULT hr = D3DXLoadVolumeFromVolume( destinationVolume->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromVolume( destinationVolume->InternalPointer, 
 			reinterpret_cast<const PALETTEENTRY*>( pinnedDest ), reinterpret_cast<const D3DBOX*>( &destinationBox ),
 			sourceVolume->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedSource ), 
-			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) );
+			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Volume::FromVolume( Volume^ destinationVolume, Volume^ sourceVolume, Filter filter, int colorKey,
 		Box sourceBox, Box destinationBox )
 	{
-		HRESULT hr = D3DXLoadVolumeFromVolume( destinationVolume->InternalPointer, 
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromVolume( destinationVolume->InternalPointer, 
 			NULL, reinterpret_cast<const D3DBOX*>( &destinationBox ), sourceVolume->InternalPointer, NULL, 
-			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) );
+			reinterpret_cast<const D3DBOX*>( &sourceBox ), static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result Volume::FromVolume( Volume^ destinationVolume, Volume^ sourceVolume, Filter filter, int colorKey )
 	{
-		HRESULT hr = D3DXLoadVolumeFromVolume( destinationVolume->InternalPointer, NULL, NULL, 
-			sourceVolume->InternalPointer, NULL, NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) );
+		HRESULT hr = TIME_CALL( D3DXLoadVolumeFromVolume( destinationVolume->InternalPointer, NULL, NULL, 
+			sourceVolume->InternalPointer, NULL, NULL, static_cast<DWORD>( filter ), static_cast<D3DCOLOR>( colorKey ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -296,8 +296,8 @@ namespace Direct3D9
 		ID3DXBuffer *result = NULL;
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 
-		HRESULT hr = D3DXSaveVolumeToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
-			volume->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), reinterpret_cast<const D3DBOX*>( &box ) );
+		HRESULT hr = TIME_CALL( D3DXSaveVolumeToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
+			volume->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ), reinterpret_cast<const D3DBOX*>( &box ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -314,8 +314,8 @@ namespace Direct3D9
 	{
 		ID3DXBuffer *result = NULL;
 
-		HRESULT hr = D3DXSaveVolumeToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
-			volume->InternalPointer, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveVolumeToFileInMemory( &result, static_cast<D3DXIMAGE_FILEFORMAT>( format ),
+			volume->InternalPointer, NULL, NULL ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -328,9 +328,9 @@ namespace Direct3D9
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars(fileName);
 		pin_ptr<PaletteEntry> pinnedPalette = palette == nullptr ? nullptr : &palette[0];
 		
-		HRESULT hr = D3DXSaveVolumeToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+		HRESULT hr = TIME_CALL( D3DXSaveVolumeToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
 			volume->InternalPointer, reinterpret_cast<const PALETTEENTRY*>( pinnedPalette ),
-			reinterpret_cast<const D3DBOX*>( &box ) );
+			reinterpret_cast<const D3DBOX*>( &box ) ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -343,8 +343,8 @@ namespace Direct3D9
 	{
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars(fileName);
 		
-		HRESULT hr = D3DXSaveVolumeToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
-			volume->InternalPointer, NULL, NULL );
+		HRESULT hr = TIME_CALL( D3DXSaveVolumeToFile( pinnedName, static_cast<D3DXIMAGE_FILEFORMAT>( format ), 
+			volume->InternalPointer, NULL, NULL ) );
 		return RECORD_D3D9( hr );
 	}
 }
@@ -48,8 +48,8 @@ namespace Direct3D9
 	VolumeTexture::VolumeTexture( SlimDX::Direct3D9::Device^ device, int width, int height, int depth, int numLevels, Usage usage, Format format, Pool pool )
 	{
 		IDirect3DVolumeTexture9* texture = NULL;
-		HRESULT hr = device->InternalPointer->CreateVolumeTexture( width, height, depth, numLevels,
-			static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateVolumeTexture( width, height, depth, numLevels,
+			static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, NULL ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -63,8 +63,8 @@ namespace Direct3D9
 	{
 		IDirect3DVolumeTexture9* texture = NULL;
 		HANDLE sharedHandleNative = NULL;
-		HRESULT hr = device->InternalPointer->CreateVolumeTexture( width, height, depth, numLevels,
-			static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, &sharedHandleNative );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateVolumeTexture( width, height, depth, numLevels,
+			static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), &texture, &sharedHandleNative ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -83,14 +83,14 @@ namespace Direct3D9
 		HRESULT hr;									// Error code.
 
 		// Get texture requirements.
-		hr = D3DXCheckVolumeTextureRequirements(device->InternalPointer,
+		hr = TIME_CALL( D3DXCheckVolumeTextureRequirements(device->InternalPointer,
 			reinterpret_cast<UINT*>( &width ),
 			reinterpret_cast<UINT*>( &height ),
 			reinterpret_cast<UINT*>( &depth ),
 			reinterpret_cast<UINT*>( &numMipLevels ),
 			static_cast<DWORD>( usage ),
 			&d3dFormat,
-			static_cast<D3DPOOL>( pool ) );
+			static_cast<D3DPOOL>( pool ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return VolumeTextureRequirements();
@@ -111,11 +111,11 @@ namespace Direct3D9
 	{
 		IDirect3DVolumeTexture9* texture = NULL;
 
-		HRESULT hr = D3DXCreateVolumeTextureFromFileInMemoryEx( device->InternalPointer, memory, size,
+		HRESULT hr = TIME_CALL( D3DXCreateVolumeTextureFromFileInMemoryEx( device->InternalPointer, memory, size,
 			width, height, depth, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ),
 			static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ), static_cast<DWORD>( mipFilter ),
 			static_cast<D3DCOLOR>( colorKey ), reinterpret_cast<D3DXIMAGE_INFO*>( imageInformation ),
-			reinterpret_cast<PALETTEENTRY*>( palette ), &texture );
+			reinterpret_cast<PALETTEENTRY*>( palette ), &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 		{
@@ -270,10 +270,10 @@ namespace Direct3D9
 		palette = gcnew array<PaletteEntry>( 256 );
 		pin_ptr<PaletteEntry> pinnedPalette = &palette[0];
 
-		HRESULT hr = D3DXCreateVolumeTextureFromFileEx( device->InternalPointer, pinnedName, width, height,
+		HRESULT hr = TIME_CALL( D3DXCreateVolumeTextureFromFileEx( device->InternalPointer, pinnedName, width, height,
 			depth, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ),
 			static_cast<DWORD>( mipFilter ), colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), 
-			reinterpret_cast<PALETTEENTRY*>( pinnedPalette ), &texture );
+			reinterpret_cast<PALETTEENTRY*>( pinnedPalette ), &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 		{
@@ -295,10 +295,10 @@ namespace Direct3D9
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 		pin_ptr<ImageInformation> pinnedImageInfo = &imageInformation;
 
-		HRESULT hr = D3DXCreateVolumeTextureFromFileEx( device->InternalPointer, pinnedName, width, height,
+		HRESULT hr = TIME_CALL( D3DXCreateVolumeTextureFromFileEx( device->InternalPointer, pinnedName, width, height,
 			depth, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ),
 			static_cast<DWORD>( mipFilter ), colorKey, reinterpret_cast<D3DXIMAGE_INFO*>( pinnedImageInfo ), 
-			NULL, &texture );
+			NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -315,9 +315,9 @@ namespace Direct3D9
 		IDirect3DVolumeTexture9* texture = NULL;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = D3DXCreateVolumeTextureFromFileEx( device->InternalPointer, pinnedName, width, height,
+		HRESULT hr = TIME_CALL( D3DXCreateVolumeTextureFromFileEx( device->InternalPointer, pinnedName, width, height,
 			depth, numLevels, static_cast<DWORD>( usage ), static_cast<D3DFORMAT>( format ), static_cast<D3DPOOL>( pool ), static_cast<DWORD>( filter ),
-			static_cast<DWORD>( mipFilter ), colorKey, NULL, NULL, &texture );
+			static_cast<DWORD>( mipFilter ), colorKey, NULL, NULL, &texture ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -342,8 +342,8 @@ namespace Direct3D9
 	DataBox^ VolumeTexture::LockBox( int level, Box box, LockFlags flags )
 	{
 		D3DLOCKED_BOX lockedBox;
-		HRESULT hr = InternalPointer->LockBox( level, &lockedBox, reinterpret_cast<D3DBOX*>( &box ),
-			static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockBox( level, &lockedBox, reinterpret_cast<D3DBOX*>( &box ),
+			static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -358,7 +358,7 @@ namespace Direct3D9
 	DataBox^ VolumeTexture::LockBox( int level, LockFlags flags )
 	{
 		D3DLOCKED_BOX lockedBox;
-		HRESULT hr = InternalPointer->LockBox( level, &lockedBox, NULL, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->LockBox( level, &lockedBox, NULL, static_cast<DWORD>( flags ) ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -372,26 +372,26 @@ namespace Direct3D9
 
 	Result VolumeTexture::UnlockBox( int level )
 	{
-		HRESULT hr = InternalPointer->UnlockBox( level );
+		HRESULT hr = TIME_CALL( InternalPointer->UnlockBox( level ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result VolumeTexture::AddDirtyBox()
 	{
-		HRESULT hr = InternalPointer->AddDirtyBox( NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDirtyBox( NULL ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result VolumeTexture::AddDirtyBox( Box box )
 	{
-		HRESULT hr = InternalPointer->AddDirtyBox( reinterpret_cast<D3DBOX*>( &box ) );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDirtyBox( reinterpret_cast<D3DBOX*>( &box ) ) );
 		return RECORD_D3D9( hr );
 	}
 	
 	VolumeDescription VolumeTexture::GetLevelDescription( int level )
 	{
 		D3DVOLUME_DESC description;
-		HRESULT hr = InternalPointer->GetLevelDesc( level, &description );
+		HRESULT hr = TIME_CALL( InternalPointer->GetLevelDesc( level, &description ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return VolumeDescription();
@@ -412,7 +412,7 @@ namespace Direct3D9
 	{
 		IDirect3DVolume9* result;
 
-		HRESULT hr = InternalPointer->GetVolumeLevel( level, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVolumeLevel( level, &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -425,14 +425,14 @@ namespace Direct3D9
 		HRESULT hr;		// Error code.
 
 		// Call the function.
-		hr = D3DXFillVolumeTexture(InternalPointer, NativeD3DXFill3D, Marshal::GetFunctionPointerForDelegate(callback).ToPointer());
+		hr = TIME_CALL( D3DXFillVolumeTexture(InternalPointer, NativeD3DXFill3D, Marshal::GetFunctionPointerForDelegate(callback).ToPointer()) );
 
 		return RECORD_D3D9(hr);
 	}
 
 	Result VolumeTexture::Fill( TextureShader^ shader )
 	{
-		HRESULT hr = D3DXFillVolumeTextureTX( InternalPointer, shader->InternalPointer );
+		HRESULT hr = TIME_CALL( D3DXFillVolumeTextureTX( InternalPointer, shader->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 }
@@ -45,7 +45,7 @@ namespace Direct3D9
 	{
 		ID3DXFile *result;
 
-		HRESULT hr = D3DXFileCreate( &result );
+		HRESULT hr = TIME_CALL( D3DXFileCreate( &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			throw gcnew Direct3D9Exception( Result::Last );
@@ -65,7 +65,7 @@ namespace Direct3D9
 		else
 			flag = D3DXF_FILELOAD_FROMFILE;
 
-		HRESULT hr = InternalPointer->CreateEnumObject( reinterpret_cast<LPCVOID>( pinnedName ), flag, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateEnumObject( reinterpret_cast<LPCVOID>( pinnedName ), flag, &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -79,7 +79,7 @@ namespace Direct3D9
 		D3DXF_FILELOADMEMORY mem;
 		mem.dSize = size;
 
-		HRESULT hr = InternalPointer->CreateEnumObject( memory, D3DXF_FILELOAD_FROMMEMORY, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateEnumObject( memory, D3DXF_FILELOAD_FROMMEMORY, &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -119,7 +119,7 @@ namespace Direct3D9
 		else
 			flag = D3DXF_FILESAVE_TOFILE;
 
-		HRESULT hr = InternalPointer->CreateSaveObject( reinterpret_cast<LPCVOID>( pinnedName ), flag, static_cast<D3DXF_FILEFORMAT>( format ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateSaveObject( reinterpret_cast<LPCVOID>( pinnedName ), flag, static_cast<D3DXF_FILEFORMAT>( format ), &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -129,13 +129,13 @@ namespace Direct3D9
 
 	Result XFile::RegisterEnumerationTemplates( XFileEnumerationObject^ enumerationObject )
 	{
-		HRESULT hr = InternalPointer->RegisterEnumTemplates( enumerationObject->InternalPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterEnumTemplates( enumerationObject->InternalPointer ) );
 		return RECORD_D3D9( hr );
 	}
 
 	Result XFile::RegisterTemplates_Internal( const void* memory, SIZE_T size )
 	{
-		HRESULT hr = InternalPointer->RegisterTemplates( memory, size );
+		HRESULT hr = TIME_CALL( InternalPointer->RegisterTemplates( memory, size ) );
 		return RECORD_D3D9( hr );
 	}
 
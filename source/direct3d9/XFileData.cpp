@@ -43,7 +43,7 @@ namespace Direct3D9
 	{
 		ID3DXFileData *result;
 
-		HRESULT hr = InternalPointer->GetChild( id, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetChild( id, &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -55,7 +55,7 @@ namespace Direct3D9
 	{
 		ID3DXFileEnumObject *result;
 
-		HRESULT hr = InternalPointer->GetEnum( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEnum( &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -68,7 +68,7 @@ namespace Direct3D9
 		SIZE_T size;
 		const void *data;
 
-		HRESULT hr = InternalPointer->Lock( &size, &data );
+		HRESULT hr = TIME_CALL( InternalPointer->Lock( &size, &data ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -78,7 +78,7 @@ namespace Direct3D9
 
 	Result XFileData::Unlock()
 	{
-		HRESULT hr = InternalPointer->Unlock();
+		HRESULT hr = TIME_CALL( InternalPointer->Unlock() );
 		return RECORD_D3D9( hr );
 	}
 
@@ -86,7 +86,7 @@ namespace Direct3D9
 	{
 		SIZE_T result;
 
-		HRESULT hr = InternalPointer->GetChildren( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetChildren( &result ) );
 		RECORD_D3D9( hr );
 
 		if( FAILED( hr ) )
@@ -99,7 +99,7 @@ namespace Direct3D9
 	{
 		GUID guid;
 
-		HRESULT hr = InternalPointer->GetId( &guid );
+		HRESULT hr = TIME_CALL( InternalPointer->GetId( &guid ) );
 
 		if( RECORD_D3D9( hr ).IsFailure || guid == GUID_NULL )
 			return Guid::Empty;
@@ -111,13 +111,13 @@ namespace Direct3D9
 	{
 		SIZE_T size = 0;
 
-		HRESULT hr = InternalPointer->GetName( NULL, &size );
+		HRESULT hr = TIME_CALL( InternalPointer->GetName( NULL, &size ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
 		stack_array<char> name = stackalloc( char, size );
 
-		hr = InternalPointer->GetName( &name[0], &size );
+		hr = TIME_CALL( InternalPointer->GetName( &name[0], &size ) );
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
 
@@ -128,7 +128,7 @@ namespace Direct3D9
 	{
 		GUID result;
 
-		HRESULT hr = InternalPointer->GetType( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetType( &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return Guid::Empty;
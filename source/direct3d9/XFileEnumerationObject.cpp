@@ -41,7 +41,7 @@ namespace Direct3D9
 	{
 		ID3DXFileData *result;
 
-		HRESULT hr = InternalPointer->GetChild( id, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetChild( id, &result ) );
 
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -53,7 +53,7 @@ namespace Direct3D9
 	{
 		ID3DXFileData *result;
 
-		HRESULT hr = InternalPointer->GetDataObjectById( Utilities::ConvertManagedGuid( id ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDataObjectById( Utilities::ConvertManagedGuid( id ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -67,7 +67,7 @@ namespace Direct3D9
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->GetDataObjectByName( reinterpret_cast<LPCSTR>( pinnedName ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDataObjectByName( reinterpret_cast<LPCSTR>( pinnedName ), &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -79,7 +79,7 @@ namespace Direct3D9
 	{
 		ID3DXFile *result;
 
-		HRESULT hr = InternalPointer->GetFile( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFile( &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return nullptr;
@@ -91,7 +91,7 @@ namespace Direct3D9
 	{
 		SIZE_T result;
 
-		HRESULT hr = InternalPointer->GetChildren( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetChildren( &result ) );
 		
 		if( RECORD_D3D9( hr ).IsFailure )
 			return 0;
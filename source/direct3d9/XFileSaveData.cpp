@@ -50,8 +50,8 @@ namespace Direct3D9
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->AddDataObject( Utilities::ConvertManagedGuid( dataTemplate ),
-			reinterpret_cast<LPCSTR>( pinnedName ), pointer, size, data, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDataObject( Utilities::ConvertManagedGuid( dataTemplate ),
+			reinterpret_cast<LPCSTR>( pinnedName ), pointer, size, data, &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -89,7 +89,7 @@ namespace Direct3D9
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->AddDataReference( reinterpret_cast<LPCSTR>( pinnedName ), pointer );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDataReference( reinterpret_cast<LPCSTR>( pinnedName ), pointer ) );
 		return RECORD_D3D9( hr );
 	}
 
@@ -97,7 +97,7 @@ namespace Direct3D9
 	{
 		GUID guid;
 
-		HRESULT hr = InternalPointer->GetId( &guid );
+		HRESULT hr = TIME_CALL( InternalPointer->GetId( &guid ) );
 
 		if( RECORD_D3D9(hr).IsFailure || guid == GUID_NULL )
 			return Guid::Empty;
@@ -109,13 +109,13 @@ namespace Direct3D9
 	{
 		SIZE_T size = 0;
 
-		HRESULT hr = InternalPointer->GetName( NULL, &size );
+		HRESULT hr = TIME_CALL( InternalPointer->GetName( NULL, &size ) );
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 
 		stack_array<char> name = stackalloc( char, static_cast<size_t>( size ) );
 
-		hr = InternalPointer->GetName( &name[0], &size );
+		hr = TIME_CALL( InternalPointer->GetName( &name[0], &size ) );
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
 
@@ -126,7 +126,7 @@ namespace Direct3D9
 	{
 		ID3DXFileSaveObject *result;
 
-		HRESULT hr = InternalPointer->GetSave( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSave( &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -138,7 +138,7 @@ namespace Direct3D9
 	{
 		GUID result;
 
-		HRESULT hr = InternalPointer->GetType( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetType( &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return Guid::Empty;
@@ -48,8 +48,8 @@ namespace Direct3D9
 		array<unsigned char>^ nameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes( name );
 		pin_ptr<unsigned char> pinnedName = &nameBytes[0];
 
-		HRESULT hr = InternalPointer->AddDataObject( Utilities::ConvertManagedGuid( dataTemplate ),
-			reinterpret_cast<LPCSTR>( pinnedName ), pointer, size, data, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->AddDataObject( Utilities::ConvertManagedGuid( dataTemplate ),
+			reinterpret_cast<LPCSTR>( pinnedName ), pointer, size, data, &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -81,7 +81,7 @@ namespace Direct3D9
 	{
 		ID3DXFile* result;
 
-		HRESULT hr = InternalPointer->GetFile( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFile( &result ) );
 		
 		if( RECORD_D3D9(hr).IsFailure )
 			return nullptr;
@@ -91,7 +91,7 @@ namespace Direct3D9
 
 	Result XFileSaveObject::Save()
 	{
-		HRESULT hr = InternalPointer->Save();
+		HRESULT hr = TIME_CALL( InternalPointer->Save() );
 		return RECORD_D3D9( hr );
 	}
 }
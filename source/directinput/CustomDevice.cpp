@@ -108,7 +108,7 @@ namespace DirectInput
 		}
 
 		format.rgodf = &objectFormats[0];
-		HRESULT hr = InternalPointer->SetDataFormat( &format );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDataFormat( &format ) );
 
 		for( int i = 0; i < objectAttributes->Count; i++ )
 			delete objectFormats[i].pguid;
@@ -155,7 +155,7 @@ namespace DirectInput
 	IList<TDataFormat>^ CustomDevice<TDataFormat>::GetBufferedData()
 	{
 		DWORD size = INFINITE;
-		HRESULT hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -164,7 +164,7 @@ namespace DirectInput
 			return list;
 
 		stack_array<DIDEVICEOBJECTDATA> data = stackalloc( DIDEVICEOBJECTDATA, size );
-		hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 );
+		hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -198,14 +198,14 @@ namespace DirectInput
 		size_t typeSize = sizeof( TDataFormat );
 		stack_array<BYTE> bytes = stackalloc( BYTE, typeSize );
 
-		HRESULT hr = InternalPointer->GetDeviceState( static_cast<DWORD>( typeSize ), &bytes[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceState( static_cast<DWORD>( typeSize ), &bytes[0] ) );
 		if( RecordError( hr ).IsFailure )
 			return Result::Last;
 
 		pin_ptr<TDataFormat> pinnedData = &data;
 		memcpy( pinnedData, &bytes[0], typeSize );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	generic<typename TDataFormat>
@@ -228,7 +228,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( TDataFormat::typeid, name ).ToInt32(), DIPH_BYUSAGE );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( TDataFormat::typeid, name ).ToInt32(), DIPH_BYUSAGE ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
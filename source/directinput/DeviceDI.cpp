@@ -48,7 +48,7 @@ namespace DirectInput
 	Device::Device( DirectInput^ directInput, Guid subsystem )
 	{
 		IDirectInputDevice8* device;
-		HRESULT hr = directInput->InternalPointer->CreateDevice( Utilities::ConvertManagedGuid( subsystem ), &device, NULL );
+		HRESULT hr = TIME_CALL( directInput->InternalPointer->CreateDevice( Utilities::ConvertManagedGuid( subsystem ), &device, NULL ) );
 
 		if( RECORD_DINPUT( hr ).IsFailure )
 			throw gcnew DirectInputException( Result::Last );
@@ -58,7 +58,7 @@ namespace DirectInput
 
 	Result Device::SetCooperativeLevel( IntPtr handle, CooperativeLevel flags )
 	{
-		HRESULT hr = InternalPointer->SetCooperativeLevel( static_cast<HWND>( handle.ToPointer() ), static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetCooperativeLevel( static_cast<HWND>( handle.ToPointer() ), static_cast<DWORD>( flags ) ) );
 		return RECORD_DINPUT( hr );
 	}
 
@@ -69,31 +69,31 @@ namespace DirectInput
 
 	Result Device::Acquire()
 	{
-		HRESULT hr = InternalPointer->Acquire();
+		HRESULT hr = TIME_CALL( InternalPointer->Acquire() );
 		return RecordError( hr );
 	}
 
 	Result Device::Unacquire()
 	{
-		HRESULT hr = InternalPointer->Unacquire();
+		HRESULT hr = TIME_CALL( InternalPointer->Unacquire() );
 		return RecordError( hr );
 	}
 
 	Result Device::Poll()
 	{
-		HRESULT hr = InternalPointer->Poll();
+		HRESULT hr = TIME_CALL( InternalPointer->Poll() );
 		return RecordError( hr );
 	}
 
 	Result Device::RunControlPanel()
 	{
-		HRESULT hr = InternalPointer->RunControlPanel( NULL, 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->RunControlPanel( NULL, 0 ) );
 		return RECORD_DINPUT( hr );
 	}
 
 	Result Device::RunControlPanel( Control^ parent )
 	{
-		HRESULT hr = InternalPointer->RunControlPanel( static_cast<HWND>( parent->Handle.ToPointer() ), 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->RunControlPanel( static_cast<HWND>( parent->Handle.ToPointer() ), 0 ) );
 		return RECORD_DINPUT( hr );
 	}
 
@@ -104,7 +104,7 @@ namespace DirectInput
 		header.dwSize = sizeof( DIDEVICEIMAGEINFOHEADER );
 		header.dwSizeImageInfo = sizeof( DIDEVICEIMAGEINFO );
 
-		HRESULT hr = InternalPointer->GetImageInfo( &header );
+		HRESULT hr = TIME_CALL( InternalPointer->GetImageInfo( &header ) );
 		if( RECORD_DINPUT( hr ).IsFailure || header.dwBufferUsed <= 0 )
 			return DeviceImageHeader();
 
@@ -112,7 +112,7 @@ namespace DirectInput
 		header.dwBufferSize = header.dwBufferUsed;
 		header.lprgImageInfoArray = &images[0];
 
-		hr = InternalPointer->GetImageInfo( &header );
+		hr = TIME_CALL( InternalPointer->GetImageInfo( &header ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceImageHeader();
 
@@ -125,7 +125,7 @@ namespace DirectInput
 		DIEFFECTINFO info;
 		info.dwSize = sizeof( DIEFFECTINFO );
 
-		HRESULT hr = InternalPointer->GetEffectInfo( &info, nativeGuid );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEffectInfo( &info, nativeGuid ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return EffectInfo();
 
@@ -137,7 +137,7 @@ namespace DirectInput
 		DWORD length = data->Length;
 		stack_array<DIDEVICEOBJECTDATA> native = stackalloc(DIDEVICEOBJECTDATA, length);
 
-		HRESULT hr = InternalPointer->GetDeviceData(sizeof(DIDEVICEOBJECTDATA), &native[0], &length, peek ? DIGDD_PEEK : 0);
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceData(sizeof(DIDEVICEOBJECTDATA), &native[0], &length, peek ? DIGDD_PEEK : 0) );
 		if (RECORD_DINPUT(hr).IsFailure)
 			return -1;
 
@@ -158,7 +158,7 @@ namespace DirectInput
 			input[i].dwData = data[i].Data;
 		}
 
-		HRESULT hr = InternalPointer->SendDeviceData( sizeof( DIDEVICEOBJECTDATA ), &input[0], &count, overlay ? DISDD_CONTINUE : 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->SendDeviceData( sizeof( DIDEVICEOBJECTDATA ), &input[0], &count, overlay ? DISDD_CONTINUE : 0 ) );
 		return RECORD_DINPUT( hr );
 	}
 
@@ -167,7 +167,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, offset, DIPH_BYOFFSET );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, offset, DIPH_BYOFFSET ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
@@ -179,7 +179,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, usageCode, DIPH_BYUSAGE );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, usageCode, DIPH_BYUSAGE ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
@@ -191,7 +191,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, objectId, DIPH_BYID );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, objectId, DIPH_BYID ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
@@ -205,7 +205,7 @@ namespace DirectInput
 
 		DIDEVCAPS c;
 		c.dwSize = sizeof( DIDEVCAPS );
-		HRESULT hr = InternalPointer->GetCapabilities( &c );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCapabilities( &c ) );
 		
 		if( RECORD_DINPUT( hr ).IsFailure )
 			caps = nullptr;
@@ -221,7 +221,7 @@ namespace DirectInput
 
 		DIDEVICEINSTANCE deviceInstance;
 		deviceInstance.dwSize = sizeof(DIDEVICEINSTANCE);
-		HRESULT hr = InternalPointer->GetDeviceInfo( &deviceInstance );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceInfo( &deviceInstance ) );
 		
 		if( RECORD_DINPUT( hr ).IsFailure )
 			information = nullptr;
@@ -241,7 +241,7 @@ namespace DirectInput
 		List<DeviceObjectInstance>^ results = gcnew List<DeviceObjectInstance>();
 		CollectionShim<DeviceObjectInstance> shim( results );
 
-		HRESULT hr = InternalPointer->EnumObjects( static_cast<LPDIENUMDEVICEOBJECTSCALLBACK>( EnumerateObjects ), &shim, static_cast<DWORD>( objectType ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumObjects( static_cast<LPDIENUMDEVICEOBJECTSCALLBACK>( EnumerateObjects ), &shim, static_cast<DWORD>( objectType ) ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -258,7 +258,7 @@ namespace DirectInput
 		List<EffectInfo>^ results = gcnew List<EffectInfo>();
 		CollectionShim<EffectInfo> shim( results );
 
-		HRESULT hr = InternalPointer->EnumEffects( static_cast<LPDIENUMEFFECTSCALLBACK>( EnumerateEffects ), &shim, static_cast<DWORD>( type ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumEffects( static_cast<LPDIENUMEFFECTSCALLBACK>( EnumerateEffects ), &shim, static_cast<DWORD>( type ) ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -276,8 +276,8 @@ namespace DirectInput
 		CollectionShim<EffectFile> shim( results );
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( fileName );
 
-		HRESULT hr = InternalPointer->EnumEffectsInFile( reinterpret_cast<LPCWSTR>( pinnedName ), 
-			static_cast<LPDIENUMEFFECTSINFILECALLBACK>( EnumerateEffectsInFile ), &shim, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumEffectsInFile( reinterpret_cast<LPCWSTR>( pinnedName ), 
+			static_cast<LPDIENUMEFFECTSINFILECALLBACK>( EnumerateEffectsInFile ), &shim, static_cast<DWORD>( flags ) ) );
 
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
@@ -298,8 +298,8 @@ namespace DirectInput
 		for( int i = 0; i < effects->Length; i++ )
 			entries[i] = effects[i].ToUnmanaged();
 
-		HRESULT hr = InternalPointer->WriteEffectToFile( reinterpret_cast<LPCWSTR>( pinnedName ), effects->Length,
-			&entries[0], includeNonstandardEffects ? DIFEF_INCLUDENONSTANDARD : 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->WriteEffectToFile( reinterpret_cast<LPCWSTR>( pinnedName ), effects->Length,
+			&entries[0], includeNonstandardEffects ? DIFEF_INCLUDENONSTANDARD : 0 ) );
 
 		for( int i = 0; i < effects->Length; i++ )
 			delete entries[i].lpDiEffect;
@@ -309,7 +309,7 @@ namespace DirectInput
 
 	Result Device::SetNotification( WaitHandle^ eventHandle )
 	{
-		HRESULT hr = InternalPointer->SetEventNotification( eventHandle->SafeWaitHandle->DangerousGetHandle().ToPointer() );
+		HRESULT hr = TIME_CALL( InternalPointer->SetEventNotification( eventHandle->SafeWaitHandle->DangerousGetHandle().ToPointer() ) );
 		return RECORD_DINPUT( hr );
 	}
 
@@ -338,7 +338,7 @@ namespace DirectInput
 		input.lpvInBuffer = pinnedData;
 		input.lpvOutBuffer = pinnedOutput;
 
-		HRESULT hr = InternalPointer->Escape( &input );
+		HRESULT hr = TIME_CALL( InternalPointer->Escape( &input ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -358,7 +358,7 @@ namespace DirectInput
 		List<Effect^>^ results = gcnew List<Effect^>();
 		CollectionShim<Effect^> shim( results );
 
-		HRESULT hr = InternalPointer->EnumCreatedEffectObjects( static_cast<LPDIENUMCREATEDEFFECTOBJECTSCALLBACK>( EnumerateCreatedEffectObjects ), &shim, 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumCreatedEffectObjects( static_cast<LPDIENUMCREATEDEFFECTOBJECTSCALLBACK>( EnumerateCreatedEffectObjects ), &shim, 0 ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -53,7 +53,7 @@ namespace DirectInput
 		dip.diph.dwObj = DeviceConstantConverter::KeyToDIK( key );
 		dip.diph.dwHow = DIPH_BYID;
 
-		hr = pointer->GetProperty( DIPROP_KEYNAME, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_KEYNAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -71,7 +71,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_GETPORTDISPLAYNAME, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_GETPORTDISPLAYNAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -89,7 +89,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_INSTANCENAME, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_INSTANCENAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -112,7 +112,7 @@ namespace DirectInput
 			chars[i] = value[i];
 		memcpy( dip.wsz, chars, sizeof( WCHAR ) * 260 );
 
-		hr = pointer->SetProperty( DIPROP_INSTANCENAME, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_INSTANCENAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -125,7 +125,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_PRODUCTNAME, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_PRODUCTNAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -148,7 +148,7 @@ namespace DirectInput
 			chars[i] = value[i];
 		memcpy( dip.wsz, chars, sizeof( WCHAR ) * 260 );
 
-		hr = pointer->SetProperty( DIPROP_PRODUCTNAME, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_PRODUCTNAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -161,7 +161,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_TYPENAME, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_TYPENAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -179,7 +179,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_USERNAME, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_USERNAME, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -197,7 +197,7 @@ namespace DirectInput
 		dip.diph.dwObj = DeviceConstantConverter::KeyToDIK( key );
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_SCANCODE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_SCANCODE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -215,7 +215,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_APPDATA, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_APPDATA, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) || dip.uData == NULL )
@@ -243,7 +243,7 @@ namespace DirectInput
 		GCHandle handle = GCHandle::Alloc( value, GCHandleType::Pinned );
 		dip.uData = reinterpret_cast<UINT_PTR>( handle.ToIntPtr( handle ).ToPointer() );
 
-		hr = pointer->SetProperty( DIPROP_APPDATA, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_APPDATA, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		handle.Free();
@@ -258,7 +258,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_AUTOCENTER, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_AUTOCENTER, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( dip.dwData == DIPROPAUTOCENTER_OFF )
@@ -281,7 +281,7 @@ namespace DirectInput
 		else
 			dip.dwData = DIPROPAUTOCENTER_OFF;
 
-		hr = pointer->SetProperty( DIPROP_AUTOCENTER, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_AUTOCENTER, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -294,7 +294,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_AXISMODE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_AXISMODE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		return static_cast<DeviceAxisMode>( dip.dwData );
@@ -310,7 +310,7 @@ namespace DirectInput
 		dip.diph.dwHow = DIPH_DEVICE;
 		dip.dwData = static_cast<DWORD>( value );
 
-		hr = pointer->SetProperty( DIPROP_AXISMODE, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_AXISMODE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -323,7 +323,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_BUFFERSIZE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_BUFFERSIZE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -342,7 +342,7 @@ namespace DirectInput
 		dip.diph.dwHow = DIPH_DEVICE;
 		dip.dwData = value;
 
-		hr = pointer->SetProperty( DIPROP_BUFFERSIZE, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_BUFFERSIZE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -355,7 +355,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_DEADZONE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_DEADZONE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -374,7 +374,7 @@ namespace DirectInput
 		dip.diph.dwHow = DIPH_DEVICE;
 		dip.dwData = value;
 
-		hr = pointer->SetProperty( DIPROP_DEADZONE, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_DEADZONE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -387,7 +387,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_FFGAIN, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_FFGAIN, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -406,7 +406,7 @@ namespace DirectInput
 		dip.diph.dwHow = DIPH_DEVICE;
 		dip.dwData = value;
 
-		hr = pointer->SetProperty( DIPROP_FFGAIN, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_FFGAIN, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -419,7 +419,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_FFLOAD, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_FFLOAD, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -437,7 +437,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_GRANULARITY, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_GRANULARITY, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -455,7 +455,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_JOYSTICKID, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_JOYSTICKID, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -473,7 +473,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_SATURATION, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_SATURATION, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -492,7 +492,7 @@ namespace DirectInput
 		dip.diph.dwHow = DIPH_DEVICE;
 		dip.dwData = value;
 
-		hr = pointer->SetProperty( DIPROP_SATURATION, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_SATURATION, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -505,7 +505,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_GUIDANDPATH, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_GUIDANDPATH, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -523,7 +523,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_GUIDANDPATH, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_GUIDANDPATH, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -541,7 +541,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_VIDPID, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_VIDPID, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -559,7 +559,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_VIDPID, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_VIDPID, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -577,7 +577,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_RANGE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_RANGE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -595,7 +595,7 @@ namespace DirectInput
 		dip.diph.dwObj = 0;
 		dip.diph.dwHow = DIPH_DEVICE;
 
-		hr = pointer->GetProperty( DIPROP_RANGE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_RANGE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -615,7 +615,7 @@ namespace DirectInput
 		dip.lMin = lowerRange;
 		dip.lMax = upperRange;
 
-		hr = pointer->SetProperty( DIPROP_RANGE, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_RANGE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 }
@@ -51,8 +51,8 @@ namespace DirectInput
 
         try
         {
-		    HRESULT hr = DirectInput8Create( static_cast<HINSTANCE>( hInstance.ToPointer() ), DIRECTINPUT_VERSION, 
-			    IID_IDirectInput8, reinterpret_cast<void**>( &dinput ), NULL );
+		    HRESULT hr = TIME_CALL( DirectInput8Create( static_cast<HINSTANCE>( hInstance.ToPointer() ), DIRECTINPUT_VERSION, 
+			    IID_IDirectInput8, reinterpret_cast<void**>( &dinput ), NULL ) );
 
 			RECORD_DINPUT( hr );
         }
@@ -69,19 +69,19 @@ namespace DirectInput
 
 	Result DirectInput::RunControlPanel()
 	{
-		HRESULT hr = InternalPointer->RunControlPanel( NULL, 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->RunControlPanel( NULL, 0 ) );
 		return RECORD_DINPUT( hr );
 	}
 
 	Result DirectInput::RunControlPanel( IntPtr parent )
 	{
-		HRESULT hr = InternalPointer->RunControlPanel( static_cast<HWND>( parent.ToPointer() ), 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->RunControlPanel( static_cast<HWND>( parent.ToPointer() ), 0 ) );
 		return RECORD_DINPUT( hr );
 	}
 
 	bool DirectInput::IsDeviceAttached( Guid device )
 	{
-		HRESULT hr = InternalPointer->GetDeviceStatus( Utilities::ConvertManagedGuid( device ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceStatus( Utilities::ConvertManagedGuid( device ) ) );
 		return hr == DI_OK;
 	}
 
@@ -90,8 +90,8 @@ namespace DirectInput
 		GUID result;
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( name );
 
-		HRESULT hr = InternalPointer->FindDevice( Utilities::ConvertManagedGuid( deviceClass ),
-			reinterpret_cast<LPCTSTR>( pinnedName ), &result );
+		HRESULT hr = TIME_CALL( InternalPointer->FindDevice( Utilities::ConvertManagedGuid( deviceClass ),
+			reinterpret_cast<LPCTSTR>( pinnedName ), &result ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -110,7 +110,7 @@ namespace DirectInput
 		List<DeviceInstance^>^ results = gcnew List<DeviceInstance^>();
 		CollectionShim<DeviceInstance^> shim( results );
 
-		HRESULT hr = InternalPointer->EnumDevices( static_cast<DWORD>( deviceClass ), static_cast<LPDIENUMDEVICESCALLBACK>( EnumerateDevices ), &shim, static_cast<DWORD>( enumerationFlags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumDevices( static_cast<DWORD>( deviceClass ), static_cast<LPDIENUMDEVICESCALLBACK>( EnumerateDevices ), &shim, static_cast<DWORD>( enumerationFlags ) ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -122,7 +122,7 @@ namespace DirectInput
 		List<DeviceInstance^>^ results = gcnew List<DeviceInstance^>();
 		CollectionShim<DeviceInstance^> shim( results );
 
-		HRESULT hr = InternalPointer->EnumDevices( static_cast<DWORD>( deviceType ), static_cast<LPDIENUMDEVICESCALLBACK>( EnumerateDevices ), &shim, static_cast<DWORD>( enumerationFlags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->EnumDevices( static_cast<DWORD>( deviceType ), static_cast<LPDIENUMDEVICESCALLBACK>( EnumerateDevices ), &shim, static_cast<DWORD>( enumerationFlags ) ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_DINPUT(x) Result::Record<DirectInputException^>( (x), (nullptr), (nullptr) )
+#define RECORD_DINPUT(x) RECORD_RESULT( DirectInputException^, x )
 
 namespace SlimDX
 {
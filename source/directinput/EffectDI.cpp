@@ -43,7 +43,7 @@ namespace DirectInput
 		IDirectInputEffect *effect;
 		GUID nativeGuid = Utilities::ConvertManagedGuid( guid );
 
-		HRESULT hr = device->InternalPointer->CreateEffect( nativeGuid, NULL, &effect, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateEffect( nativeGuid, NULL, &effect, NULL ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			throw gcnew DirectInputException( Result::Last );
 
@@ -56,7 +56,7 @@ namespace DirectInput
 		GUID nativeGuid = Utilities::ConvertManagedGuid( guid );
 		DIEFFECT params = parameters.ToUnmanaged();
 
-		HRESULT hr = device->InternalPointer->CreateEffect( nativeGuid, &params, &effect, NULL );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateEffect( nativeGuid, &params, &effect, NULL ) );
 		parameters.Cleanup( params );
 
 		if( RECORD_DINPUT( hr ).IsFailure )
@@ -75,7 +75,7 @@ namespace DirectInput
 		DIEFFECT params;
 		params.dwSize = sizeof( DIEFFECT );
 
-		HRESULT hr = InternalPointer->GetParameters( &params, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetParameters( &params, static_cast<DWORD>( flags ) ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return EffectParameters();
 
@@ -91,7 +91,7 @@ namespace DirectInput
 	{
 		DIEFFECT params = parameters.ToUnmanaged();
 
-		HRESULT hr = InternalPointer->SetParameters( &params, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetParameters( &params, static_cast<DWORD>( flags ) ) );
 		parameters.Cleanup( params );
 
 		return RECORD_DINPUT( hr );
@@ -114,7 +114,7 @@ namespace DirectInput
 
 	Result Effect::Start( int iterations, EffectPlayFlags flags )
 	{
-		HRESULT hr = InternalPointer->Start( iterations, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Start( iterations, static_cast<DWORD>( flags ) ) );
 		return RECORD_DINPUT( hr );
 	}
 
@@ -148,7 +148,7 @@ namespace DirectInput
 		input.lpvInBuffer = pinnedData;
 		input.lpvOutBuffer = pinnedOutput;
 
-		HRESULT hr = InternalPointer->Escape( &input );
+		HRESULT hr = TIME_CALL( InternalPointer->Escape( &input ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return nullptr;
 
@@ -159,7 +159,7 @@ namespace DirectInput
 	{
 		DWORD flags = 0;
 
-		HRESULT hr = InternalPointer->GetEffectStatus( &flags );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEffectStatus( &flags ) );
 		RECORD_DINPUT( hr );
 
 		return static_cast<EffectStatus>( flags );
@@ -169,7 +169,7 @@ namespace DirectInput
 	{
 		GUID guid;
 
-		HRESULT hr = InternalPointer->GetEffectGuid( &guid );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEffectGuid( &guid ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return System::Guid::Empty;
 
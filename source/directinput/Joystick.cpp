@@ -113,7 +113,7 @@ namespace DirectInput
 
 	Joystick::Joystick( DirectInput^ directInput, Guid subsystem ) : Device( directInput, subsystem )
 	{
-		HRESULT hr = InternalPointer->SetDataFormat( &c_dfDIJoystick2 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDataFormat( &c_dfDIJoystick2 ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			throw gcnew DirectInputException( Result::Last );
 	}
@@ -121,7 +121,7 @@ namespace DirectInput
 	IList<JoystickState^>^ Joystick::GetBufferedData()
 	{
 		DWORD size = INFINITE;
-		HRESULT hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -130,7 +130,7 @@ namespace DirectInput
 			return list;
 
 		stack_array<DIDEVICEOBJECTDATA> data = stackalloc( DIDEVICEOBJECTDATA, size );
-		hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 );
+		hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -146,14 +146,14 @@ namespace DirectInput
 	Result Joystick::GetCurrentState( JoystickState^% data )
 	{
 		DIJOYSTATE2 joystate;
-		HRESULT hr = InternalPointer->GetDeviceState( sizeof( DIJOYSTATE2 ), &joystate );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceState( sizeof( DIJOYSTATE2 ), &joystate ) );
 		if( RecordError( hr ).IsFailure )
 			return Result::Last;
 
 		JoystickState^ state = safe_cast<JoystickState^>( data );
 		state->AssignState(joystate);
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	JoystickState^ Joystick::GetCurrentState()
@@ -173,7 +173,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( JoystickState::typeid, name ).ToInt32(), DIPH_BYUSAGE );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( JoystickState::typeid, name ).ToInt32(), DIPH_BYUSAGE ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
@@ -44,7 +44,7 @@ namespace DirectInput
 {
 	Keyboard::Keyboard( DirectInput^ directInput ) : Device( directInput, Utilities::ConvertNativeGuid( GUID_SysKeyboard ) )
 	{
-		HRESULT hr = InternalPointer->SetDataFormat( &c_dfDIKeyboard );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDataFormat( &c_dfDIKeyboard ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			throw gcnew DirectInputException( Result::Last );
 	}
@@ -52,7 +52,7 @@ namespace DirectInput
 	IList<KeyboardState^>^ Keyboard::GetBufferedData()
 	{
 		DWORD size = INFINITE;
-		HRESULT hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -61,7 +61,7 @@ namespace DirectInput
 			return list;
 
 		stack_array<DIDEVICEOBJECTDATA> data = stackalloc( DIDEVICEOBJECTDATA, size );
-		hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 );
+		hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -82,13 +82,13 @@ namespace DirectInput
 	Result Keyboard::GetCurrentState( KeyboardState^% data )
 	{
 		BYTE keys[256];
-		HRESULT hr = InternalPointer->GetDeviceState( 256, keys );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceState( 256, keys ) );
 		if( RecordError( hr ).IsFailure )
 			return Result::Last;
 
 		data->UpdateKeys( keys, 256 );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	KeyboardState^ Keyboard::GetCurrentState()
@@ -108,7 +108,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( KeyboardState::typeid, name ).ToInt32(), DIPH_BYUSAGE );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( KeyboardState::typeid, name ).ToInt32(), DIPH_BYUSAGE ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
@@ -122,7 +122,7 @@ namespace DirectInput
 
 	Mouse::Mouse( DirectInput^ directInput ) : Device( directInput, Utilities::ConvertNativeGuid( GUID_SysMouse ) )
 	{
-		HRESULT hr = InternalPointer->SetDataFormat( &c_dfDIMouse2 );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDataFormat( &c_dfDIMouse2 ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			throw gcnew DirectInputException( Result::Last );
 	}
@@ -130,7 +130,7 @@ namespace DirectInput
 	IList<MouseState^>^ Mouse::GetBufferedData()
 	{
 		DWORD size = INFINITE;
-		HRESULT hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), NULL, &size, DIGDD_PEEK ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -139,7 +139,7 @@ namespace DirectInput
 			return list;
 
 		stack_array<DIDEVICEOBJECTDATA> data = stackalloc( DIDEVICEOBJECTDATA, size );
-		hr = InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 );
+		hr = TIME_CALL( InternalPointer->GetDeviceData( sizeof( DIDEVICEOBJECTDATA ), &data[0], &size, 0 ) );
 		if( RecordError( hr ).IsFailure )
 			return nullptr;
 
@@ -155,13 +155,13 @@ namespace DirectInput
 	Result Mouse::GetCurrentState( MouseState^% data )
 	{
 		DIMOUSESTATE2 state;
-		HRESULT hr = InternalPointer->GetDeviceState( sizeof( DIMOUSESTATE2 ), &state );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceState( sizeof( DIMOUSESTATE2 ), &state ) );
 		if( RecordError( hr ).IsFailure )
 			return Result::Last;
 
 		data->AssignState( state );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	MouseState^ Mouse::GetCurrentState()
@@ -181,7 +181,7 @@ namespace DirectInput
 		DIDEVICEOBJECTINSTANCE di;
 		di.dwSize = sizeof( DIDEVICEOBJECTINSTANCE );
 
-		HRESULT hr = InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( MouseState::typeid, name ).ToInt32(), DIPH_BYUSAGE );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInfo( &di, Marshal::OffsetOf( MouseState::typeid, name ).ToInt32(), DIPH_BYUSAGE ) );
 		if( RECORD_DINPUT( hr ).IsFailure )
 			return DeviceObjectInstance();
 
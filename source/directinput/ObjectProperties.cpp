@@ -64,7 +64,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_RANGE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_RANGE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -82,7 +82,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_RANGE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_RANGE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -102,7 +102,7 @@ namespace DirectInput
 		dip.lMin = lowerRange;
 		dip.lMax = upperRange;
 
-		hr = pointer->SetProperty( DIPROP_RANGE, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_RANGE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -115,7 +115,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_APPDATA, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_APPDATA, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) || dip.uData == NULL )
@@ -143,7 +143,7 @@ namespace DirectInput
 		GCHandle handle = GCHandle::Alloc( value, GCHandleType::Pinned );
 		dip.uData = reinterpret_cast<UINT_PTR>( handle.ToIntPtr( handle ).ToPointer() );
 
-		hr = pointer->SetProperty( DIPROP_APPDATA, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_APPDATA, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		handle.Free();
@@ -158,7 +158,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_DEADZONE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_DEADZONE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -177,7 +177,7 @@ namespace DirectInput
 		dip.diph.dwHow = how;
 		dip.dwData = value;
 
-		hr = pointer->SetProperty( DIPROP_DEADZONE, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_DEADZONE, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -190,7 +190,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_GRANULARITY, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_GRANULARITY, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -208,7 +208,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_SATURATION, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_SATURATION, &dip.diph ) );
 		RECORD_DINPUT( hr );
 
 		if( FAILED( hr ) )
@@ -227,7 +227,7 @@ namespace DirectInput
 		dip.diph.dwHow = how;
 		dip.dwData = value;
 
-		hr = pointer->SetProperty( DIPROP_SATURATION, &dip.diph );
+		hr = TIME_CALL( pointer->SetProperty( DIPROP_SATURATION, &dip.diph ) );
 		RECORD_DINPUT( hr );
 	}
 
@@ -240,7 +240,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_LOGICALRANGE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_LOGICALRANGE, &dip.diph ) );
 		if (RECORD_DINPUT(hr).IsFailure)
 			return InputRange();
 
@@ -256,7 +256,7 @@ namespace DirectInput
 		dip.diph.dwObj = obj;
 		dip.diph.dwHow = how;
 
-		hr = pointer->GetProperty( DIPROP_PHYSICALRANGE, &dip.diph );
+		hr = TIME_CALL( pointer->GetProperty( DIPROP_PHYSICALRANGE, &dip.diph ) );
 		if (RECORD_DINPUT(hr).IsFailure)
 			return InputRange();
 
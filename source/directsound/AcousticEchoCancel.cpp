@@ -38,7 +38,7 @@ namespace DirectSound
 {
 	Result AcousticEchoCancel::Reset()
 	{
-		HRESULT hr = InternalPointer->Reset();
+		HRESULT hr = TIME_CALL( InternalPointer->Reset() );
 		return RECORD_DSOUND( hr );
 	}
 
@@ -46,7 +46,7 @@ namespace DirectSound
 	{
 		DSCFXAec param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return false;
 
@@ -57,12 +57,12 @@ namespace DirectSound
 	{
 		DSCFXAec param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fEnable = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -70,7 +70,7 @@ namespace DirectSound
 	{
 		DSCFXAec param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return false;
 
@@ -81,12 +81,12 @@ namespace DirectSound
 	{
 		DSCFXAec param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fNoiseFill = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -94,7 +94,7 @@ namespace DirectSound
 	{
 		DSCFXAec param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return AcousticEchoCancelMode::PassThrough;
 
@@ -105,19 +105,19 @@ namespace DirectSound
 	{
 		DSCFXAec param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.dwMode = static_cast<DWORD>( value );
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
 	bool AcousticEchoCancel::Uninitialized::get()
 	{
 		DWORD status = 0;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		RECORD_DSOUND( hr );
 
 		return ( status & DSCFX_AEC_STATUS_HISTORY_UNINITIALIZED ) != 0;
@@ -126,7 +126,7 @@ namespace DirectSound
 	bool AcousticEchoCancel::ContinuouslyConverged::get()
 	{
 		DWORD status = 0;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		RECORD_DSOUND( hr );
 
 		return ( status & DSCFX_AEC_STATUS_HISTORY_CONTINUOUSLY_CONVERGED ) != 0;
@@ -135,7 +135,7 @@ namespace DirectSound
 	bool AcousticEchoCancel::CurrentlyConverged::get()
 	{
 		DWORD status = 0;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		RECORD_DSOUND( hr );
 
 		return ( status & DSCFX_AEC_STATUS_CURRENTLY_CONVERGED ) != 0;
@@ -144,7 +144,7 @@ namespace DirectSound
 	bool AcousticEchoCancel::PreviouslyDiverged::get()
 	{
 		DWORD status = 0;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		RECORD_DSOUND( hr );
 
 		return ( status & DSCFX_AEC_STATUS_HISTORY_PREVIOUSLY_DIVERGED ) != 0;
@@ -48,7 +48,7 @@ namespace DirectSound
 		DSCBUFFERDESC value = description.ToUnmanaged();
 		IDirectSoundCaptureBuffer* buffer;
 
-		HRESULT hr = capture->InternalPointer->CreateCaptureBuffer( &value, &buffer, NULL );
+		HRESULT hr = TIME_CALL( capture->InternalPointer->CreateCaptureBuffer( &value, &buffer, NULL ) );
 
 		delete[] value.lpDSCFXDesc;
 		delete[] value.lpwfxFormat;
@@ -57,7 +57,7 @@ namespace DirectSound
 			throw gcnew DirectSoundException( Result::Last );
 
 		IDirectSoundCaptureBuffer8* dsCapture;
-		hr = buffer->QueryInterface( IID_IDirectSoundCaptureBuffer8, reinterpret_cast<void**>( &dsCapture ) );
+		hr = TIME_CALL( buffer->QueryInterface( IID_IDirectSoundCaptureBuffer8, reinterpret_cast<void**>( &dsCapture ) ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException( Result::Last );
@@ -67,13 +67,13 @@ namespace DirectSound
 	
 	Result CaptureBuffer::Start( bool looping )
 	{
-		HRESULT hr = InternalPointer->Start( looping ? DSCBSTART_LOOPING : 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->Start( looping ? DSCBSTART_LOOPING : 0 ) );
 		return RECORD_DSOUND( hr );
 	}
 
 	Result CaptureBuffer::Stop()
 	{
-		HRESULT hr = InternalPointer->Stop();
+		HRESULT hr = TIME_CALL( InternalPointer->Stop() );
 		return RECORD_DSOUND( hr );
 	}
 
@@ -85,7 +85,7 @@ namespace DirectSound
 
 		secondPart = nullptr;
 
-		HRESULT hr = InternalPointer->Lock( offset, sizeBytes, &buffer1, &size1, &buffer2, &size2, lockEntireBuffer ? DSCBLOCK_ENTIREBUFFER : 0 );
+		HRESULT hr = TIME_CALL( InternalPointer->Lock( offset, sizeBytes, &buffer1, &size1, &buffer2, &size2, lockEntireBuffer ? DSCBLOCK_ENTIREBUFFER : 0 ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
 
@@ -107,7 +107,7 @@ namespace DirectSound
 			size2 = static_cast<int>( secondPart->Length );
 		}
 
-		HRESULT hr = InternalPointer->Unlock( firstPart->RawPointer, static_cast<int>( firstPart->Length ), buffer2, size2 );
+		HRESULT hr = TIME_CALL( InternalPointer->Unlock( firstPart->RawPointer, static_cast<int>( firstPart->Length ), buffer2, size2 ) );
 		return RECORD_DSOUND( hr );
 	}
 
@@ -147,7 +147,7 @@ namespace DirectSound
 	Result CaptureBuffer::SetNotificationPositions( array<NotificationPosition>^ positions )
 	{
 		IDirectSoundNotify *pointer;
-		HRESULT hr = InternalPointer->QueryInterface( IID_IDirectSoundNotify, reinterpret_cast<void**>( &pointer ) );
+		HRESULT hr = TIME_CALL( InternalPointer->QueryInterface( IID_IDirectSoundNotify, reinterpret_cast<void**>( &pointer ) ) );
 
 		if( FAILED( hr ) )
 			return RECORD_DSOUND( hr );
@@ -159,7 +159,7 @@ namespace DirectSound
 			notifies[i].hEventNotify = positions[i].Event->SafeWaitHandle->DangerousGetHandle().ToPointer();
 		}
 
-		hr = pointer->SetNotificationPositions( positions->Length, &notifies[0] );
+		hr = TIME_CALL( pointer->SetNotificationPositions( positions->Length, &notifies[0] ) );
 		pointer->Release();
 
 		return RECORD_DSOUND( hr );
@@ -171,7 +171,7 @@ namespace DirectSound
 		WAVEFORMATEX* format;
 		DWORD size;
 
-		HRESULT hr = InternalPointer->GetFormat( NULL, 0, &size );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFormat( NULL, 0, &size ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
 
@@ -180,7 +180,7 @@ namespace DirectSound
 
 		try
 		{
-			hr = InternalPointer->GetFormat( format, size, NULL );
+			hr = TIME_CALL( InternalPointer->GetFormat( format, size, NULL ) );
 
 			if( RECORD_DSOUND( hr ).IsFailure )
 				return nullptr;
@@ -202,7 +202,7 @@ namespace DirectSound
 	{
 		stack_array<DWORD> results = stackalloc( DWORD, effectCount );
 
-		HRESULT hr = InternalPointer->GetFXStatus( effectCount, &results[0] );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFXStatus( effectCount, &results[0] ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
 
@@ -220,7 +220,7 @@ namespace DirectSound
 		GUID guid = Utilities::GetNativeGuidForType( T::typeid );
 		void *resultPointer;
 
-		HRESULT hr = InternalPointer->GetObjectInPath( GUID_All_Objects, index, guid, &resultPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInPath( GUID_All_Objects, index, guid, &resultPointer ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return T();
 
@@ -232,7 +232,7 @@ namespace DirectSound
 	{
 		DSCBCAPS caps;
 		caps.dwSize = sizeof( DSCBCAPS );
-		HRESULT hr = InternalPointer->GetCaps( &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCaps( &caps ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return false;
@@ -244,7 +244,7 @@ namespace DirectSound
 	{
 		DSCBCAPS caps;
 		caps.dwSize = sizeof( DSCBCAPS );
-		HRESULT hr = InternalPointer->GetCaps( &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCaps( &caps ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
@@ -255,7 +255,7 @@ namespace DirectSound
 	bool CaptureBuffer::Capturing::get()
 	{
 		DWORD status;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return false;
@@ -266,7 +266,7 @@ namespace DirectSound
 	bool CaptureBuffer::Looping::get()
 	{
 		DWORD status;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return false;
@@ -277,7 +277,7 @@ namespace DirectSound
 	int CaptureBuffer::CurrentCapturePosition::get()
 	{
 		DWORD capturePosition;
-		HRESULT hr = InternalPointer->GetCurrentPosition( &capturePosition, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentPosition( &capturePosition, NULL ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
@@ -288,7 +288,7 @@ namespace DirectSound
 	int CaptureBuffer::CurrentReadPosition::get()
 	{
 		DWORD readPosition;
-		HRESULT hr = InternalPointer->GetCurrentPosition( NULL, &readPosition );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentPosition( NULL, &readPosition ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
@@ -40,7 +40,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -51,12 +51,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fDelay = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -64,7 +64,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -75,12 +75,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fDepth = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -88,7 +88,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -99,12 +99,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fFeedback = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -112,7 +112,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -123,12 +123,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fFrequency = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -136,7 +136,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -147,12 +147,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.fWetDryMix = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -160,7 +160,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
 
@@ -171,12 +171,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.lWaveform = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -184,7 +184,7 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
 
@@ -195,12 +195,12 @@ namespace DirectSound
 	{
 		DSFXChorus param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.lPhase = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 }
@@ -49,7 +49,7 @@ namespace DirectSound
 	{
 		IDirectSound8* dsound;
 
-		HRESULT hr = DirectSoundCreate8( NULL, &dsound, NULL );
+		HRESULT hr = TIME_CALL( DirectSoundCreate8( NULL, &dsound, NULL ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException( Result::Last );
@@ -62,7 +62,7 @@ namespace DirectSound
 		IDirectSound8* dsound;
 
 		GUID guid = Utilities::ConvertManagedGuid( device );
-		HRESULT hr = DirectSoundCreate8( &guid, &dsound, NULL );
+		HRESULT hr = TIME_CALL( DirectSoundCreate8( &guid, &dsound, NULL ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException();
@@ -75,7 +75,7 @@ namespace DirectSound
 		DSCAPS caps;
 		caps.dwSize = sizeof( DSCAPS );
 
-		HRESULT hr = InternalPointer->GetCaps( &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCaps( &caps ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
@@ -85,20 +85,20 @@ namespace DirectSound
 
 	Result DirectSound::SetCooperativeLevel( IntPtr windowHandle, CooperativeLevel coopLevel )
 	{
-		HRESULT hr = InternalPointer->SetCooperativeLevel( static_cast<HWND>( windowHandle.ToPointer() ), static_cast<DWORD>( coopLevel ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetCooperativeLevel( static_cast<HWND>( windowHandle.ToPointer() ), static_cast<DWORD>( coopLevel ) ) );
 		return RECORD_DSOUND( hr );
 	}
 
 	Result DirectSound::SetSpeakerConfiguration( SpeakerConfiguration speakerSet, SpeakerGeometry geometry )
 	{
-		HRESULT hr = InternalPointer->SetSpeakerConfig( DSSPEAKER_COMBINED( static_cast<DWORD>( speakerSet ), static_cast<DWORD>( geometry ) ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetSpeakerConfig( DSSPEAKER_COMBINED( static_cast<DWORD>( speakerSet ), static_cast<DWORD>( geometry ) ) ) );
 		return RECORD_DSOUND( hr );
 	}
 
 	Result DirectSound::GetSpeakerConfiguration( [Out] SpeakerConfiguration% speakerSet, [Out] SpeakerGeometry% geometry )
 	{
 		DWORD config = 0;
-		HRESULT hr = InternalPointer->GetSpeakerConfig( &config );
+		HRESULT hr = TIME_CALL( InternalPointer->GetSpeakerConfig( &config ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 		{
@@ -110,13 +110,13 @@ namespace DirectSound
 		speakerSet = static_cast<SpeakerConfiguration>( DSSPEAKER_CONFIG( config ) );
 		geometry = static_cast<SpeakerGeometry>( DSSPEAKER_GEOMETRY( config ) );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result DirectSound::DuplicateSoundBuffer( SoundBuffer^ original, [Out] SoundBuffer^% result ) 
 	{
 		IDirectSoundBuffer* duplicate = 0;
-		HRESULT hr = InternalPointer->DuplicateSoundBuffer( original->InternalPointer, &duplicate );
+		HRESULT hr = TIME_CALL( InternalPointer->DuplicateSoundBuffer( original->InternalPointer, &duplicate ) );
 		if( RECORD_DSOUND( hr ).IsFailure ) 
 			result = nullptr;
 		else 
@@ -135,13 +135,13 @@ namespace DirectSound
 			}
 		}
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	bool DirectSound::VerifyCertification()
 	{
 		DWORD certified = DS_UNCERTIFIED;
-		HRESULT hr = InternalPointer->VerifyCertification( &certified );
+		HRESULT hr = TIME_CALL( InternalPointer->VerifyCertification( &certified ) );
 		
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return false;
@@ -154,7 +154,7 @@ namespace DirectSound
 		DeviceCollection^ results = gcnew DeviceCollection();
 		std::auto_ptr<DeviceCollectionShim> shim( new DeviceCollectionShim( results ) );
 
-		HRESULT hr = DirectSoundEnumerate( EnumerateDevices, shim.get() );
+		HRESULT hr = TIME_CALL( DirectSoundEnumerate( EnumerateDevices, shim.get() ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
@@ -43,7 +43,7 @@ namespace DirectSound
 	{
 		IDirectSoundCapture8* capture;
 
-		HRESULT hr = DirectSoundCaptureCreate8( NULL, &capture, NULL );
+		HRESULT hr = TIME_CALL( DirectSoundCaptureCreate8( NULL, &capture, NULL ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException( Result::Last );
@@ -56,7 +56,7 @@ namespace DirectSound
 		IDirectSoundCapture8* capture;
 
 		GUID guid = Utilities::ConvertManagedGuid( device );
-		HRESULT hr = DirectSoundCaptureCreate8( &guid, &capture, NULL );
+		HRESULT hr = TIME_CALL( DirectSoundCaptureCreate8( &guid, &capture, NULL ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException( Result::Last );
@@ -68,7 +68,7 @@ namespace DirectSound
 	{
 		DSCCAPS caps;
 		caps.dwSize = sizeof( DSCCAPS );
-		HRESULT hr = InternalPointer->GetCaps( &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCaps( &caps ) );
 		RECORD_DSOUND( hr );
 
 		return CaptureCapabilities( caps );
@@ -79,7 +79,7 @@ namespace DirectSound
 		DeviceCollection^ results = gcnew DeviceCollection();
 		std::auto_ptr<DeviceCollectionShim> shim( new DeviceCollectionShim( results ) );
 
-		HRESULT hr = DirectSoundCaptureEnumerate( EnumerateDevices, shim.get() );
+		HRESULT hr = TIME_CALL( DirectSoundCaptureEnumerate( EnumerateDevices, shim.get() ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
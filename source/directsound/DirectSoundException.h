@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_DSOUND(x) Result::Record<DirectSoundException^>( (x), (nullptr), (nullptr) )
+#define RECORD_DSOUND(x) RECORD_RESULT( DirectSoundException^, x )
 
 namespace SlimDX
 {
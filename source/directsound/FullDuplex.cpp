@@ -48,7 +48,7 @@ namespace DirectSound
 		IDirectSoundFullDuplex8* duplex;
 		IDirectSoundCaptureBuffer8* capture;
 		IDirectSoundBuffer8* buffer;
-		HRESULT hr = DirectSoundFullDuplexCreate( reinterpret_cast<GUID*>( &captureDevice ), reinterpret_cast<GUID*>( &playbackDevice ), &cbDesc, &bDesc, static_cast<HWND>( windowHandle.ToPointer() ), static_cast<DWORD>( level ), &duplex, &capture, &buffer, NULL );
+		HRESULT hr = TIME_CALL( DirectSoundFullDuplexCreate( reinterpret_cast<GUID*>( &captureDevice ), reinterpret_cast<GUID*>( &playbackDevice ), &cbDesc, &bDesc, static_cast<HWND>( windowHandle.ToPointer() ), static_cast<DWORD>( level ), &duplex, &capture, &buffer, NULL ) );
 		
 		delete[] cbDesc.lpwfxFormat;
 		delete[] bDesc.lpwfxFormat;
@@ -39,7 +39,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
 
@@ -50,12 +50,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.lRoom = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -63,7 +63,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
 
@@ -74,12 +74,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.lRoomHF = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -87,7 +87,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
 
@@ -98,12 +98,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.lReflections = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -111,7 +111,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0;
 
@@ -122,12 +122,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.lReverb = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -135,7 +135,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -146,12 +146,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flRoomRolloffFactor = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -159,7 +159,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -170,12 +170,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flDecayTime = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -183,7 +183,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -194,12 +194,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flDecayHFRatio = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -207,7 +207,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -218,12 +218,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flReflectionsDelay = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -231,7 +231,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -242,12 +242,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flReverbDelay = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -255,7 +255,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -266,12 +266,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flDiffusion = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -279,7 +279,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -290,12 +290,12 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flDensity = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -303,7 +303,7 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return 0.0f;
 
@@ -314,19 +314,19 @@ namespace DirectSound
 	{
 		DSFXI3DL2Reverb param;
 
-		HRESULT hr = InternalPointer->GetAllParameters( &param );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &param ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
 		param.flHFReference = value;
-		hr = InternalPointer->SetAllParameters( &param );
+		hr = TIME_CALL( InternalPointer->SetAllParameters( &param ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int I3DL2Reverb::Quality::get()
 	{
 		LONG result;
-		HRESULT hr = InternalPointer->GetQuality( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetQuality( &result ) );
 		RECORD_DSOUND( hr );
 
 		return static_cast<int>( result );
@@ -334,14 +334,14 @@ namespace DirectSound
 
 	void I3DL2Reverb::Quality::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetQuality( static_cast<LONG>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetQuality( static_cast<LONG>( value ) ) );
 		RECORD_DSOUND( hr );
 	}
 
 	I3DL2ReverbPreset I3DL2Reverb::Preset::get()
 	{
 		DWORD result;
-		HRESULT hr = InternalPointer->GetPreset( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPreset( &result ) );
 		RECORD_DSOUND( hr );
 
 		return static_cast<I3DL2ReverbPreset>( result );
@@ -349,7 +349,7 @@ namespace DirectSound
 
 	void I3DL2Reverb::Preset::set( I3DL2ReverbPreset value )
 	{
-		HRESULT hr = InternalPointer->SetPreset( static_cast<DWORD>( value ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPreset( static_cast<DWORD>( value ) ) );
 		RECORD_DSOUND( hr );
 	}
 }
@@ -38,14 +38,14 @@ namespace DirectSound
 {
 	Result NoiseSuppress::Reset()
 	{
-		HRESULT hr = InternalPointer->Reset();
+		HRESULT hr = TIME_CALL( InternalPointer->Reset() );
 		return RECORD_DSOUND( hr );
 	}
 	
 	bool NoiseSuppress::Enabled::get()
 	{
 		DSCFXNoiseSuppress result;
-		HRESULT hr = InternalPointer->GetAllParameters( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &result ) );
 		RECORD_DSOUND( hr );
 
 		return result.fEnable == TRUE;
@@ -56,7 +56,7 @@ namespace DirectSound
 		DSCFXNoiseSuppress result;
 		result.fEnable = value;
 
-		HRESULT hr = InternalPointer->SetAllParameters( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->SetAllParameters( &result ) );
 		RECORD_DSOUND( hr );
 	}
 }
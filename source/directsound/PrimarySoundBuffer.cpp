@@ -40,7 +40,7 @@ namespace DirectSound
 		IDirectSoundBuffer* buffer;
 		DSBUFFERDESC nativeDesc = description.ToUnmanaged();
 		
-		HRESULT hr = dsound->InternalPointer->CreateSoundBuffer( &nativeDesc, &buffer, NULL );
+		HRESULT hr = TIME_CALL( dsound->InternalPointer->CreateSoundBuffer( &nativeDesc, &buffer, NULL ) );
 
 		delete[] nativeDesc.lpwfxFormat;
 
@@ -43,7 +43,7 @@ namespace DirectSound
 		IDirectSoundBuffer* buffer;
 		DSBUFFERDESC nativeDesc = description.ToUnmanaged();
 		
-		HRESULT hr = dsound->InternalPointer->CreateSoundBuffer( &nativeDesc, &buffer, NULL );
+		HRESULT hr = TIME_CALL( dsound->InternalPointer->CreateSoundBuffer( &nativeDesc, &buffer, NULL ) );
 
 		delete[] nativeDesc.lpwfxFormat;
 
@@ -51,7 +51,7 @@ namespace DirectSound
 			throw gcnew DirectSoundException( Result::Last );
 
 		IDirectSoundBuffer8* result;
-		hr = buffer->QueryInterface( IID_IDirectSoundBuffer8, reinterpret_cast<void**>( &result ) );
+		hr = TIME_CALL( buffer->QueryInterface( IID_IDirectSoundBuffer8, reinterpret_cast<void**>( &result ) ) );
 		
 		buffer->Release();
 
@@ -86,7 +86,7 @@ namespace DirectSound
 			dsEffects = &inputs[0];
 		}
 
-		HRESULT hr = InternalPointer->SetFX( count, dsEffects, dwResults );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFX( count, dsEffects, dwResults ) );
 		if( RECORD_DSOUND( hr ).IsFailure || count == 0 )
 			return nullptr;
 
@@ -104,7 +104,7 @@ namespace DirectSound
 		GUID guid = Utilities::GetNativeGuidForType( T::typeid );
 		void *resultPointer;
 
-		HRESULT hr = InternalPointer->GetObjectInPath( GUID_All_Objects, index, guid, &resultPointer );
+		HRESULT hr = TIME_CALL( InternalPointer->GetObjectInPath( GUID_All_Objects, index, guid, &resultPointer ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return T();
 
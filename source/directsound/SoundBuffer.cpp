@@ -42,19 +42,19 @@ namespace DirectSound
 {
 	Result SoundBuffer::Restore()
 	{
-		HRESULT hr = InternalPointer->Restore();
+		HRESULT hr = TIME_CALL( InternalPointer->Restore() );
 		return RECORD_DSOUND( hr );
 	}
 
 	Result SoundBuffer::Play( int priority, PlayFlags flags )
 	{
-		HRESULT hr = InternalPointer->Play( 0, priority, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Play( 0, priority, static_cast<DWORD>( flags ) ) );
 		return RECORD_DSOUND( hr );
 	}
 
 	Result SoundBuffer::Stop()
 	{
-		HRESULT hr = InternalPointer->Stop();
+		HRESULT hr = TIME_CALL( InternalPointer->Stop() );
 		return RECORD_DSOUND( hr );
 	}
 
@@ -66,7 +66,7 @@ namespace DirectSound
 
 		secondPart = nullptr;
 
-		HRESULT hr = InternalPointer->Lock( offset, sizeBytes, &buffer1, &size1, &buffer2, &size2, static_cast<DWORD>( flags ) );
+		HRESULT hr = TIME_CALL( InternalPointer->Lock( offset, sizeBytes, &buffer1, &size1, &buffer2, &size2, static_cast<DWORD>( flags ) ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
 
@@ -88,7 +88,7 @@ namespace DirectSound
 			size2 = static_cast<int>( secondPart->Length );
 		}
 
-		HRESULT hr = InternalPointer->Unlock( firstPart->RawPointer, static_cast<int>( firstPart->Length ), buffer2, size2 );
+		HRESULT hr = TIME_CALL( InternalPointer->Unlock( firstPart->RawPointer, static_cast<int>( firstPart->Length ), buffer2, size2 ) );
 		return RECORD_DSOUND( hr );
 	}
 
@@ -122,7 +122,7 @@ namespace DirectSound
 	Result SoundBuffer::SetNotificationPositions( array<NotificationPosition>^ positions )
 	{
 		IDirectSoundNotify *pointer;
-		HRESULT hr = InternalPointer->QueryInterface( IID_IDirectSoundNotify, reinterpret_cast<void**>( &pointer ) );
+		HRESULT hr = TIME_CALL( InternalPointer->QueryInterface( IID_IDirectSoundNotify, reinterpret_cast<void**>( &pointer ) ) );
 
 		if( FAILED( hr ) )
 			return RECORD_DSOUND( hr );
@@ -134,7 +134,7 @@ namespace DirectSound
 			notifies[i].hEventNotify = positions[i].Event->SafeWaitHandle->DangerousGetHandle().ToPointer();
 		}
 
-		hr = pointer->SetNotificationPositions( positions->Length, &notifies[0] );
+		hr = TIME_CALL( pointer->SetNotificationPositions( positions->Length, &notifies[0] ) );
 		pointer->Release();
 
 		return RECORD_DSOUND( hr );
@@ -144,7 +144,7 @@ namespace DirectSound
 	{
 		auto_array<WAVEFORMATEX> format = WaveFormat::ToUnmanaged( sourceFormat );
 
-		HRESULT hr = InternalPointer->SetFormat( format.get() );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFormat( format.get() ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -154,7 +154,7 @@ namespace DirectSound
 		WAVEFORMATEX* format;
 		DWORD size;
 
-		HRESULT hr = InternalPointer->GetFormat( NULL, 0, &size );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFormat( NULL, 0, &size ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return nullptr;
 
@@ -163,7 +163,7 @@ namespace DirectSound
 
 		try
 		{
-			hr = InternalPointer->GetFormat( format, size, NULL );
+			hr = TIME_CALL( InternalPointer->GetFormat( format, size, NULL ) );
 
 			if( RECORD_DSOUND( hr ).IsFailure )
 				return nullptr;
@@ -184,7 +184,7 @@ namespace DirectSound
 	int SoundBuffer::CurrentPlayPosition::get()
 	{
 		DWORD position = 0;
-		HRESULT hr = InternalPointer->GetCurrentPosition( &position, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentPosition( &position, NULL ) );
 		RECORD_DSOUND( hr );
 
 		return position;
@@ -192,14 +192,14 @@ namespace DirectSound
 	
 	void SoundBuffer::CurrentPlayPosition::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetCurrentPosition( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetCurrentPosition( value ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int SoundBuffer::CurrentWritePosition::get()
 	{
 		DWORD position = 0;
-		HRESULT hr = InternalPointer->GetCurrentPosition( NULL, &position );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentPosition( NULL, &position ) );
 		RECORD_DSOUND( hr );
 
 		return position;
@@ -208,7 +208,7 @@ namespace DirectSound
 	int SoundBuffer::Frequency::get()
 	{
 		DWORD freq = 0;
-		HRESULT hr = InternalPointer->GetFrequency( &freq );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFrequency( &freq ) );
 		RECORD_DSOUND( hr );
 
 		return freq;
@@ -216,14 +216,14 @@ namespace DirectSound
 
 	void SoundBuffer::Frequency::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetFrequency( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFrequency( value ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int SoundBuffer::Volume::get()
 	{
 		LONG volume = 0;
-		HRESULT hr = InternalPointer->GetVolume( &volume );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVolume( &volume ) );
 		RECORD_DSOUND( hr );
 
 		return volume;
@@ -231,14 +231,14 @@ namespace DirectSound
 
 	void SoundBuffer::Volume::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetVolume( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVolume( value ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int SoundBuffer::Pan::get()
 	{
 		LONG pan = 0;
-		HRESULT hr = InternalPointer->GetPan( &pan );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPan( &pan ) );
 		RECORD_DSOUND( hr );
 
 		return pan;
@@ -246,14 +246,14 @@ namespace DirectSound
 
 	void SoundBuffer::Pan::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetPan( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPan( value ) );
 		RECORD_DSOUND( hr );
 	}
 
 	BufferStatus SoundBuffer::Status::get()
 	{
 		DWORD status = 0;
-		HRESULT hr = InternalPointer->GetStatus( &status );
+		HRESULT hr = TIME_CALL( InternalPointer->GetStatus( &status ) );
 		RECORD_DSOUND( hr );
 
 		return static_cast<BufferStatus>( status );
@@ -263,7 +263,7 @@ namespace DirectSound
 	{
 		DSBCAPS caps;
 		caps.dwSize = sizeof( DSBCAPS );
-		HRESULT hr = InternalPointer->GetCaps( &caps );
+		HRESULT hr = TIME_CALL( InternalPointer->GetCaps( &caps ) );
 		RECORD_DSOUND( hr );
 
 		return BufferCapabilities( caps );
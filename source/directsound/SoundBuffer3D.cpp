@@ -41,7 +41,7 @@ namespace DirectSound
 	{
 		IDirectSound3DBuffer8* buffer;
 
-		HRESULT hr = soundBuffer->InternalPointer->QueryInterface( IID_IDirectSound3DBuffer8, reinterpret_cast<void**>( &buffer ) );
+		HRESULT hr = TIME_CALL( soundBuffer->InternalPointer->QueryInterface( IID_IDirectSound3DBuffer8, reinterpret_cast<void**>( &buffer ) ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException( Result::Last );
 		
@@ -52,7 +52,7 @@ namespace DirectSound
 	{
 		DS3DBUFFER result;
 		result.dwSize = sizeof( DS3DBUFFER );
-		HRESULT hr = InternalPointer->GetAllParameters( &result );
+		HRESULT hr = TIME_CALL( InternalPointer->GetAllParameters( &result ) );
 		RECORD_DSOUND( hr );
 
 		return Buffer3DSettings( result );
@@ -61,14 +61,14 @@ namespace DirectSound
 	void SoundBuffer3D::AllParameters::set( Buffer3DSettings value )
 	{
 		DS3DBUFFER result = value.ToUnmanaged();
-		HRESULT hr = InternalPointer->SetAllParameters( &result, Deferred ? DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetAllParameters( &result, Deferred ? DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int SoundBuffer3D::InsideConeAngle::get()
 	{
 		DWORD inside = 0;
-		HRESULT hr = InternalPointer->GetConeAngles( &inside, NULL );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConeAngles( &inside, NULL ) );
 		RECORD_DSOUND( hr );
 
 		return inside; 
@@ -76,14 +76,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::InsideConeAngle::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetConeAngles( value, NULL, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetConeAngles( value, NULL, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int SoundBuffer3D::OutsideConeAngle::get()
 	{
 		DWORD outside = 0;
-		HRESULT hr = InternalPointer->GetConeAngles( NULL, &outside );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConeAngles( NULL, &outside ) );
 		RECORD_DSOUND( hr );
 
 		return outside; 
@@ -91,14 +91,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::OutsideConeAngle::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetConeAngles( NULL, value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetConeAngles( NULL, value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	Vector3 SoundBuffer3D::ConeOrientation::get()
 	{
 		D3DVECTOR orientation = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetConeOrientation( &orientation );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConeOrientation( &orientation ) );
 		RECORD_DSOUND( hr );
 
 		return Vector3( orientation.x, orientation.y, orientation.z );
@@ -106,14 +106,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::ConeOrientation::set( Vector3 value )
 	{
-		HRESULT hr = InternalPointer->SetConeOrientation( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetConeOrientation( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	int SoundBuffer3D::ConeOutsideVolume::get()
 	{
 		LONG volume = 0;
-		HRESULT hr = InternalPointer->GetConeOutsideVolume( &volume );
+		HRESULT hr = TIME_CALL( InternalPointer->GetConeOutsideVolume( &volume ) );
 		RECORD_DSOUND( hr );
 
 		return static_cast<int>( volume );
@@ -121,14 +121,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::ConeOutsideVolume::set( int value )
 	{
-		HRESULT hr = InternalPointer->SetConeOutsideVolume( static_cast<LONG>( value ), Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetConeOutsideVolume( static_cast<LONG>( value ), Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	float SoundBuffer3D::MaxDistance::get()
 	{
 		float maxDistance = 0.0f;
-		HRESULT hr = InternalPointer->GetMaxDistance( &maxDistance );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMaxDistance( &maxDistance ) );
 		RECORD_DSOUND( hr );
 
 		return maxDistance;
@@ -136,14 +136,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::MaxDistance::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetMaxDistance( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMaxDistance( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	float SoundBuffer3D::MinDistance::get()
 	{
 		float minDistance = 0.0f;
-		HRESULT hr = InternalPointer->GetMinDistance( &minDistance );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMinDistance( &minDistance ) );
 		RECORD_DSOUND( hr );
 
 		return minDistance;
@@ -151,14 +151,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::MinDistance::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetMinDistance( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMinDistance( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	Mode3D SoundBuffer3D::Mode::get()
 	{
 		DWORD mode = 0;
-		HRESULT hr = InternalPointer->GetMode( &mode );
+		HRESULT hr = TIME_CALL( InternalPointer->GetMode( &mode ) );
 		RECORD_DSOUND( hr );
 	
 		return static_cast<Mode3D>( mode );
@@ -166,14 +166,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::Mode::set( Mode3D value )
 	{
-		HRESULT hr = InternalPointer->SetMode( static_cast<DWORD>( value ), Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetMode( static_cast<DWORD>( value ), Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	Vector3 SoundBuffer3D::Position::get()
 	{
 		D3DVECTOR position = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetPosition( &position );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPosition( &position ) );
 		RECORD_DSOUND( hr );
 
 		return Vector3( position.x, position.y, position.z );
@@ -181,14 +181,14 @@ namespace DirectSound
 
 	void SoundBuffer3D::Position::set( Vector3 value )
 	{
-		HRESULT hr = InternalPointer->SetPosition( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPosition( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	Vector3 SoundBuffer3D::Velocity::get()
 	{
 		D3DVECTOR velocity = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetVelocity( &velocity );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVelocity( &velocity ) );
 		RECORD_DSOUND( hr );
 
 		return Vector3( velocity.x, velocity.y, velocity.z );
@@ -196,7 +196,7 @@ namespace DirectSound
 
 	void SoundBuffer3D::Velocity::set( Vector3 value )
 	{
-		HRESULT hr = InternalPointer->SetVelocity( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVelocity( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 }
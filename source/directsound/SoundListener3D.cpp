@@ -43,7 +43,7 @@ namespace DirectSound
 	{
 		IDirectSound3DListener8* listener;
 
-		HRESULT hr = soundBuffer->InternalPointer->QueryInterface( IID_IDirectSound3DListener8, reinterpret_cast<void**>( &listener ) );
+		HRESULT hr = TIME_CALL( soundBuffer->InternalPointer->QueryInterface( IID_IDirectSound3DListener8, reinterpret_cast<void**>( &listener ) ) );
 		if( RECORD_DSOUND( hr ).IsFailure )
 			throw gcnew DirectSoundException( Result::Last );
 		
@@ -52,14 +52,14 @@ namespace DirectSound
 
 	Result SoundListener3D::CommitDeferredSettings()
 	{
-		HRESULT hr = InternalPointer->CommitDeferredSettings();
+		HRESULT hr = TIME_CALL( InternalPointer->CommitDeferredSettings() );
 		return RECORD_DSOUND( hr );
 	}
 
 	float SoundListener3D::DistanceFactor::get()
 	{
 		float distance = 0.0f;
-		HRESULT hr = InternalPointer->GetDistanceFactor( &distance );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDistanceFactor( &distance ) );
 		RECORD_DSOUND( hr );
 
 		return distance;
@@ -67,14 +67,14 @@ namespace DirectSound
 
 	void SoundListener3D::DistanceFactor::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetDistanceFactor( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDistanceFactor( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	float SoundListener3D::DopplerFactor::get()
 	{
 		float doppler = 0.0f;
-		HRESULT hr = InternalPointer->GetDopplerFactor( &doppler );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDopplerFactor( &doppler ) );
 		RECORD_DSOUND( hr );
 
 		return doppler;
@@ -82,14 +82,14 @@ namespace DirectSound
 
 	void SoundListener3D::DopplerFactor::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetDopplerFactor( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetDopplerFactor( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	float SoundListener3D::RolloffFactor::get()
 	{
 		float rolloff = 0.0f;
-		HRESULT hr = InternalPointer->GetRolloffFactor( &rolloff );
+		HRESULT hr = TIME_CALL( InternalPointer->GetRolloffFactor( &rolloff ) );
 		RECORD_DSOUND( hr );
 
 		return rolloff;
@@ -97,7 +97,7 @@ namespace DirectSound
 
 	void SoundListener3D::RolloffFactor::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetRolloffFactor( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetRolloffFactor( value, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -105,7 +105,7 @@ namespace DirectSound
 	{
 		D3DVECTOR front = D3DVECTOR();
 		D3DVECTOR top = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetOrientation( &front, &top );
+		HRESULT hr = TIME_CALL( InternalPointer->GetOrientation( &front, &top ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return Vector3::Zero;
@@ -117,7 +117,7 @@ namespace DirectSound
 	{
 		D3DVECTOR front = D3DVECTOR();
 		D3DVECTOR top = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetOrientation( &front, &top );
+		HRESULT hr = TIME_CALL( InternalPointer->GetOrientation( &front, &top ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return Vector3::Zero;
@@ -129,13 +129,13 @@ namespace DirectSound
 	{
 		D3DVECTOR front = D3DVECTOR();
 		D3DVECTOR top = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetOrientation( &front, &top );
+		HRESULT hr = TIME_CALL( InternalPointer->GetOrientation( &front, &top ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
-		hr = InternalPointer->SetOrientation( value.X, value.Y, value.Z, top.x, top.y, top.z,
-			Deferred ? DS3D_DEFERRED : DS3D_IMMEDIATE );
+		hr = TIME_CALL( InternalPointer->SetOrientation( value.X, value.Y, value.Z, top.x, top.y, top.z,
+			Deferred ? DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
@@ -143,20 +143,20 @@ namespace DirectSound
 	{
 		D3DVECTOR front = D3DVECTOR();
 		D3DVECTOR top = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetOrientation( &front, &top );
+		HRESULT hr = TIME_CALL( InternalPointer->GetOrientation( &front, &top ) );
 
 		if( RECORD_DSOUND( hr ).IsFailure )
 			return;
 
-		hr = InternalPointer->SetOrientation( front.x, front.y, front.z, value.X, value.Y, value.Z,
-			Deferred ? DS3D_DEFERRED : DS3D_IMMEDIATE );
+		hr = TIME_CALL( InternalPointer->SetOrientation( front.x, front.y, front.z, value.X, value.Y, value.Z,
+			Deferred ? DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	Vector3 SoundListener3D::Position::get()
 	{
 		D3DVECTOR position = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetPosition( &position );
+		HRESULT hr = TIME_CALL( InternalPointer->GetPosition( &position ) );
 		RECORD_DSOUND( hr );
 
 		return Vector3( position.x, position.y, position.z );
@@ -164,14 +164,14 @@ namespace DirectSound
 
 	void SoundListener3D::Position::set( Vector3 value )
 	{
-		HRESULT hr = InternalPointer->SetPosition( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetPosition( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 
 	Vector3 SoundListener3D::Velocity::get()
 	{
 		D3DVECTOR velocity = D3DVECTOR();
-		HRESULT hr = InternalPointer->GetVelocity( &velocity );
+		HRESULT hr = TIME_CALL( InternalPointer->GetVelocity( &velocity ) );
 		RECORD_DSOUND( hr );
 
 		return Vector3( velocity.x, velocity.y, velocity.z );
@@ -179,7 +179,7 @@ namespace DirectSound
 
 	void SoundListener3D::Velocity::set( Vector3 value )
 	{
-		HRESULT hr = InternalPointer->SetVelocity( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVelocity( value.X, value.Y, value.Z, Deferred ?  DS3D_DEFERRED : DS3D_IMMEDIATE ) );
 		RECORD_DSOUND( hr );
 	}
 }
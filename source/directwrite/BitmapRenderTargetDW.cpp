@@ -41,7 +41,7 @@ namespace DirectWrite
 	{
 		IDWriteBitmapRenderTarget *pointer;
 
-		HRESULT hr = interop->InternalPointer->CreateBitmapRenderTarget(reinterpret_cast<HDC>(hdc.ToPointer()), width, height, &pointer);
+		HRESULT hr = TIME_CALL( interop->InternalPointer->CreateBitmapRenderTarget(reinterpret_cast<HDC>(hdc.ToPointer()), width, height, &pointer) );
 		if (RECORD_DW(hr).IsFailure)
 			throw gcnew DirectWriteException(Result::Last);
 
@@ -68,8 +68,8 @@ namespace DirectWrite
 		Color c = color.ToColor();
 		RECT blackBoxRect;
 
-		HRESULT hr = InternalPointer->DrawGlyphRun(baselineOriginX, baselineOriginY, static_cast<DWRITE_MEASURING_MODE>(measuringMode), &glyphs,
-			renderingParameters->InternalPointer, RGB(c.R, c.G, c.B), &blackBoxRect);
+		HRESULT hr = TIME_CALL( InternalPointer->DrawGlyphRun(baselineOriginX, baselineOriginY, static_cast<DWRITE_MEASURING_MODE>(measuringMode), &glyphs,
+			renderingParameters->InternalPointer, RGB(c.R, c.G, c.B), &blackBoxRect) );
 		
 		blackBoxBounds = Utilities::ConvertRect(blackBoxRect);
 		return RECORD_DW(hr);
@@ -77,7 +77,7 @@ namespace DirectWrite
 
 	Result BitmapRenderTarget::Resize(int width, int height)
 	{
-		HRESULT hr = InternalPointer->Resize(width, height);
+		HRESULT hr = TIME_CALL( InternalPointer->Resize(width, height) );
 		return RECORD_DW(hr);
 	}
 
@@ -85,7 +85,7 @@ namespace DirectWrite
 	{
 		Matrix3x2 result;
 		
-		HRESULT hr = InternalPointer->GetCurrentTransform(reinterpret_cast<DWRITE_MATRIX*>(&result));
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentTransform(reinterpret_cast<DWRITE_MATRIX*>(&result)) );
 		RECORD_DW(hr);
 
 		return result;
@@ -93,7 +93,7 @@ namespace DirectWrite
 
 	void BitmapRenderTarget::Transform::set(Matrix3x2 value)
 	{
-		HRESULT hr = InternalPointer->SetCurrentTransform(reinterpret_cast<DWRITE_MATRIX*>(&value));
+		HRESULT hr = TIME_CALL( InternalPointer->SetCurrentTransform(reinterpret_cast<DWRITE_MATRIX*>(&value)) );
 		RECORD_DW(hr);
 	}
 
@@ -111,7 +111,7 @@ namespace DirectWrite
 	{
 		System::Drawing::Size size;
 
-		HRESULT hr = InternalPointer->GetSize(reinterpret_cast<SIZE*>(&size));
+		HRESULT hr = TIME_CALL( InternalPointer->GetSize(reinterpret_cast<SIZE*>(&size)) );
 		RECORD_DW(hr);
 
 		return size;
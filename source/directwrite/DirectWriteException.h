@@ -21,7 +21,7 @@
 */
 #pragma once
 
-#define RECORD_DW(x) Result::Record<DirectWriteException^>( (x), (nullptr), (nullptr) )
+#define RECORD_DW(x) RECORD_RESULT( DirectWriteException^, x )
 
 #include "../SlimDXException.h"
 
@@ -51,7 +51,7 @@ namespace DirectWrite
 		IDWriteLocalizedStrings *names;
 		BOOL exists;
 
-		HRESULT hr = InternalPointer->GetInformationalStrings(static_cast<DWRITE_INFORMATIONAL_STRING_ID>(stringId), &names, &exists);
+		HRESULT hr = TIME_CALL( InternalPointer->GetInformationalStrings(static_cast<DWRITE_INFORMATIONAL_STRING_ID>(stringId), &names, &exists) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -62,7 +62,7 @@ namespace DirectWrite
 	{
 		BOOL exists = FALSE;
 
-		HRESULT hr = InternalPointer->HasCharacter(characterCode, &exists);
+		HRESULT hr = TIME_CALL( InternalPointer->HasCharacter(characterCode, &exists) );
 		RECORD_DW(hr);
 
 		return exists > 0;
@@ -72,7 +72,7 @@ namespace DirectWrite
 	{
 		IDWriteLocalizedStrings *names;
 
-		HRESULT hr = InternalPointer->GetFaceNames(&names);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFaceNames(&names) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -83,7 +83,7 @@ namespace DirectWrite
 	{
 		IDWriteFontFamily *names;
 
-		HRESULT hr = InternalPointer->GetFontFamily(&names);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFontFamily(&names) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
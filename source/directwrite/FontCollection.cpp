@@ -44,7 +44,7 @@ namespace DirectWrite
 	FontFamily^ FontCollection::default::get(int index)
 	{
 		IDWriteFontFamily* fontFamily = NULL;
-		HRESULT hr = InternalPointer->GetFontFamily( index, &fontFamily );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFontFamily( index, &fontFamily ) );
 		RECORD_DW(hr);
 
 		return FontFamily::FromPointer( fontFamily );
@@ -56,7 +56,7 @@ namespace DirectWrite
 		UINT32 index = 0;
 		pin_ptr<const wchar_t> nameChars = PtrToStringChars( familyName );
 
-		HRESULT hr = InternalPointer->FindFamilyName( nameChars, &index, &existsNative );
+		HRESULT hr = TIME_CALL( InternalPointer->FindFamilyName( nameChars, &index, &existsNative ) );
 		exists = existsNative == TRUE;
 		RECORD_DW(hr);
 
@@ -73,7 +73,7 @@ namespace DirectWrite
 	{
 		IDWriteFont* font = NULL;
 
-		HRESULT hr = InternalPointer->GetFontFromFontFace( fontFace->InternalPointer, &font );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFontFromFontFace( fontFace->InternalPointer, &font ) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -40,7 +40,7 @@ namespace DirectWrite
 		pin_ptr<GlyphMetrics> pinnedMetrics = &metrics[0];
 		pin_ptr<short> pinnedIndices = &indices[0];
 
-		HRESULT hr = InternalPointer->GetDesignGlyphMetrics(reinterpret_cast<UINT16*>(pinnedIndices), indices->Length, reinterpret_cast<DWRITE_GLYPH_METRICS*>(pinnedMetrics), isSideways);
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesignGlyphMetrics(reinterpret_cast<UINT16*>(pinnedIndices), indices->Length, reinterpret_cast<DWRITE_GLYPH_METRICS*>(pinnedMetrics), isSideways) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -56,7 +56,7 @@ namespace DirectWrite
 	{
 		FontMetrics metrics;
 
-		HRESULT hr = InternalPointer->GetGdiCompatibleMetrics(size, pixelsPerDip, reinterpret_cast<DWRITE_MATRIX*>(&transform), reinterpret_cast<DWRITE_FONT_METRICS*>(&metrics));
+		HRESULT hr = TIME_CALL( InternalPointer->GetGdiCompatibleMetrics(size, pixelsPerDip, reinterpret_cast<DWRITE_MATRIX*>(&transform), reinterpret_cast<DWRITE_FONT_METRICS*>(&metrics)) );
 		RECORD_DW(hr);
 
 		return metrics;
@@ -73,8 +73,8 @@ namespace DirectWrite
 		pin_ptr<GlyphMetrics> pinnedMetrics = &metrics[0];
 		pin_ptr<short> pinnedIndices = &indices[0];
 
-		HRESULT hr = InternalPointer->GetGdiCompatibleGlyphMetrics(size, pixelsPerDip, reinterpret_cast<DWRITE_MATRIX*>(&transform), useGdiNatural,
-			reinterpret_cast<UINT16*>(pinnedIndices), indices->Length, reinterpret_cast<DWRITE_GLYPH_METRICS*>(pinnedMetrics), isSideways);
+		HRESULT hr = TIME_CALL( InternalPointer->GetGdiCompatibleGlyphMetrics(size, pixelsPerDip, reinterpret_cast<DWRITE_MATRIX*>(&transform), useGdiNatural,
+			reinterpret_cast<UINT16*>(pinnedIndices), indices->Length, reinterpret_cast<DWRITE_GLYPH_METRICS*>(pinnedMetrics), isSideways) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -87,7 +87,7 @@ namespace DirectWrite
 		pin_ptr<short> pinnedIndices = &indices[0];
 		pin_ptr<int> pinnedPoints = &codePoints[0];
 
-		HRESULT hr = InternalPointer->GetGlyphIndices(reinterpret_cast<UINT32*>(pinnedPoints), codePoints->Length, reinterpret_cast<UINT16*>(pinnedIndices));
+		HRESULT hr = TIME_CALL( InternalPointer->GetGlyphIndices(reinterpret_cast<UINT32*>(pinnedPoints), codePoints->Length, reinterpret_cast<UINT16*>(pinnedIndices)) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -98,12 +98,12 @@ namespace DirectWrite
 	{
 		UINT32 count = 0;
 
-		HRESULT hr = InternalPointer->GetFiles(&count, NULL);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFiles(&count, NULL) );
 		if (RECORD_DW(hr).IsFailure || count == 0)
 			return nullptr;
 
 		stack_array<IDWriteFontFile*> files = stackalloc(IDWriteFontFile*, count);
-		hr = InternalPointer->GetFiles(&count, &files[0]);
+		hr = TIME_CALL( InternalPointer->GetFiles(&count, &files[0]) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -141,7 +141,7 @@ namespace DirectWrite
 			offsetsPtr = reinterpret_cast<DWRITE_GLYPH_OFFSET*>(pinnedOffsets);
 		}
 
-		HRESULT hr = InternalPointer->GetGlyphRunOutline(size, indicesPtr, advancesPtr, offsetsPtr, indices->Length, isSideways, isRightToLeft, geometrySink->InternalPointer);
+		HRESULT hr = TIME_CALL( InternalPointer->GetGlyphRunOutline(size, indicesPtr, advancesPtr, offsetsPtr, indices->Length, isSideways, isRightToLeft, geometrySink->InternalPointer) );
 		return RECORD_DW(hr);
 	}
 
@@ -149,7 +149,7 @@ namespace DirectWrite
 	{
 		DWRITE_RENDERING_MODE mode;
 
-		HRESULT hr = InternalPointer->GetRecommendedRenderingMode(size, pixelsPerDip, static_cast<DWRITE_MEASURING_MODE>(measuringMode), renderingParameters->InternalPointer, &mode);
+		HRESULT hr = TIME_CALL( InternalPointer->GetRecommendedRenderingMode(size, pixelsPerDip, static_cast<DWRITE_MEASURING_MODE>(measuringMode), renderingParameters->InternalPointer, &mode) );
 		RECORD_DW(hr);
 
 		return static_cast<RenderingMode>(mode);
@@ -167,7 +167,7 @@ namespace DirectWrite
 		void *context;
 		BOOL exists;
 
-		HRESULT hr = InternalPointer->TryGetFontTable(tableTag, &data, &size, &context, &exists);
+		HRESULT hr = TIME_CALL( InternalPointer->TryGetFontTable(tableTag, &data, &size, &context, &exists) );
 		if (RECORD_DW(hr).IsFailure || !exists)
 			return nullptr;
 
@@ -39,8 +39,8 @@ namespace DirectWrite
 	{
 		IDWriteFont *font;
 
-		HRESULT hr = InternalPointer->GetFirstMatchingFont(static_cast<DWRITE_FONT_WEIGHT>(weight), static_cast<DWRITE_FONT_STRETCH>(stretch), 
-			static_cast<DWRITE_FONT_STYLE>(style), &font);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFirstMatchingFont(static_cast<DWRITE_FONT_WEIGHT>(weight), static_cast<DWRITE_FONT_STRETCH>(stretch), 
+			static_cast<DWRITE_FONT_STYLE>(style), &font) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -51,8 +51,8 @@ namespace DirectWrite
 	{
 		IDWriteFontList *list;
 
-		HRESULT hr = InternalPointer->GetMatchingFonts(static_cast<DWRITE_FONT_WEIGHT>(weight), static_cast<DWRITE_FONT_STRETCH>(stretch), 
-			static_cast<DWRITE_FONT_STYLE>(style), &list);
+		HRESULT hr = TIME_CALL( InternalPointer->GetMatchingFonts(static_cast<DWRITE_FONT_WEIGHT>(weight), static_cast<DWRITE_FONT_STRETCH>(stretch), 
+			static_cast<DWRITE_FONT_STYLE>(style), &list) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -63,7 +63,7 @@ namespace DirectWrite
 	{
 		IDWriteLocalizedStrings* strings;
 
-		HRESULT hr = InternalPointer->GetFamilyNames(&strings);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFamilyNames(&strings) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -41,7 +41,7 @@ namespace DirectWrite
 		DWRITE_FONT_FACE_TYPE faceType;
 		UINT32 faceCount;
 
-		HRESULT hr = InternalPointer->Analyze(&isSupported, &fileType, &faceType, &faceCount);
+		HRESULT hr = TIME_CALL( InternalPointer->Analyze(&isSupported, &fileType, &faceType, &faceCount) );
 		RECORD_DW(hr);
 
 		return FontFileAnalysis(isSupported > 0, static_cast<FontFileType>(fileType), static_cast<FontFaceType>(faceType), faceCount);
@@ -52,7 +52,7 @@ namespace DirectWrite
 		const void *data;
 		UINT32 size;
 
-		HRESULT hr = InternalPointer->GetReferenceKey(&data, &size);
+		HRESULT hr = TIME_CALL( InternalPointer->GetReferenceKey(&data, &size) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -63,7 +63,7 @@ namespace DirectWrite
 	{
 		IDWriteFontFileLoader *loader;
 
-		HRESULT hr = InternalPointer->GetLoader(&loader);
+		HRESULT hr = TIME_CALL( InternalPointer->GetLoader(&loader) );
 		if (RECORD_DW(hr).IsFailure)
 		{
 			return nullptr;
@@ -42,7 +42,7 @@ namespace DirectWrite
 	{
 		BOOL next;
 
-		HRESULT hr = InternalPointer->MoveNext(&next);
+		HRESULT hr = TIME_CALL( InternalPointer->MoveNext(&next) );
 		RECORD_DW(hr);
 
 		return next > 0;
@@ -57,7 +57,7 @@ namespace DirectWrite
 	{
 		IDWriteFontFile *file;
 
-		HRESULT hr = InternalPointer->GetCurrentFontFile(&file);
+		HRESULT hr = TIME_CALL( InternalPointer->GetCurrentFontFile(&file) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -38,7 +38,7 @@ namespace DirectWrite
 	{
 		IDWriteFont *font;
 
-		HRESULT hr = InternalPointer->GetFont(index, &font);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFont(index, &font) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -49,7 +49,7 @@ namespace DirectWrite
 	{
 		IDWriteFontCollection *collection;
 
-		HRESULT hr = InternalPointer->GetFontCollection(&collection);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFontCollection(&collection) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -40,7 +40,7 @@ namespace DirectWrite
 	{
 		pin_ptr<Object^> pinnedFont = &logFont;
 
-		HRESULT hr = InternalPointer->ConvertFontFaceToLOGFONT(fontFace->InternalPointer, reinterpret_cast<LOGFONTW*>(pinnedFont));
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertFontFaceToLOGFONT(fontFace->InternalPointer, reinterpret_cast<LOGFONTW*>(pinnedFont)) );
 		return RECORD_DW(hr);
 	}
 
@@ -49,7 +49,7 @@ namespace DirectWrite
 		pin_ptr<Object^> pinnedFont = &logFont;
 		BOOL systemFont;
 
-		HRESULT hr = InternalPointer->ConvertFontToLOGFONT(font->InternalPointer, reinterpret_cast<LOGFONTW*>(pinnedFont), &systemFont);
+		HRESULT hr = TIME_CALL( InternalPointer->ConvertFontToLOGFONT(font->InternalPointer, reinterpret_cast<LOGFONTW*>(pinnedFont), &systemFont) );
 		return RECORD_DW(hr);
 	}
 
@@ -57,7 +57,7 @@ namespace DirectWrite
 	{
 		IDWriteFontFace *face;
 
-		HRESULT hr = InternalPointer->CreateFontFaceFromHdc(reinterpret_cast<HDC>(hdc.ToPointer()), &face);
+		HRESULT hr = TIME_CALL( InternalPointer->CreateFontFaceFromHdc(reinterpret_cast<HDC>(hdc.ToPointer()), &face) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -69,7 +69,7 @@ namespace DirectWrite
 		IDWriteFont *font;
 		pin_ptr<Object^> pinnedFont = &logFont;
 
-		HRESULT hr = InternalPointer->CreateFontFromLOGFONT(reinterpret_cast<LOGFONTW*>(pinnedFont), &font);
+		HRESULT hr = TIME_CALL( InternalPointer->CreateFontFromLOGFONT(reinterpret_cast<LOGFONTW*>(pinnedFont), &font) );
 		if (RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -79,7 +79,7 @@ namespace DirectWrite
 	BitmapRenderTarget ^GdiInterop::CreateBitmapRenderTarget(System::IntPtr hdc, int width, int height)
 	{
 		IDWriteBitmapRenderTarget *target = 0;
-		HRESULT hr = InternalPointer->CreateBitmapRenderTarget(static_cast<HDC>(hdc.ToPointer()), width, height, &target);
+		HRESULT hr = TIME_CALL( InternalPointer->CreateBitmapRenderTarget(static_cast<HDC>(hdc.ToPointer()), width, height, &target) );
 		if (RECORD_DW(hr).IsFailure)
 		{
 			return nullptr;
@@ -41,7 +41,7 @@ namespace DirectWrite
 		Utilities::ConvertRect(bounds, rect);
 		pin_ptr<BYTE> pinnedBytes = &alphaValues[0];
 
-		HRESULT hr = InternalPointer->CreateAlphaTexture(static_cast<DWRITE_TEXTURE_TYPE>(textureType), &rect, pinnedBytes, alphaValues->Length);
+		HRESULT hr = TIME_CALL( InternalPointer->CreateAlphaTexture(static_cast<DWRITE_TEXTURE_TYPE>(textureType), &rect, pinnedBytes, alphaValues->Length) );
 		return RECORD_DW(hr);
 	}
 
@@ -51,7 +51,7 @@ namespace DirectWrite
 		FLOAT blendEnhancedContrast;
 		FLOAT blendClearTypeLevel;
 
-		HRESULT hr = InternalPointer->GetAlphaBlendParams(renderingParameters->InternalPointer, &blendGamma, &blendEnhancedContrast, &blendClearTypeLevel);
+		HRESULT hr = TIME_CALL( InternalPointer->GetAlphaBlendParams(renderingParameters->InternalPointer, &blendGamma, &blendEnhancedContrast, &blendClearTypeLevel) );
 		if (RECORD_DW(hr).IsFailure)
 		{
 			gamma = 0.0f;
@@ -65,14 +65,14 @@ namespace DirectWrite
 			clearTypeLevel = blendClearTypeLevel;
 		}
 
-		return Result::Last;
+		return Result(hr);
 	}
 
 	System::Drawing::Rectangle GlyphRunAnalysis::GetAlphaTextureBounds(TextureType textureType)
 	{
 		RECT bounds;
 
-		HRESULT hr = InternalPointer->GetAlphaTextureBounds(static_cast<DWRITE_TEXTURE_TYPE>(textureType), &bounds);
+		HRESULT hr = TIME_CALL( InternalPointer->GetAlphaTextureBounds(static_cast<DWRITE_TEXTURE_TYPE>(textureType), &bounds) );
 		RECORD_DW(hr);
 
 		return Utilities::ConvertRect(bounds);
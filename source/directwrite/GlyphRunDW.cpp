@@ -33,23 +33,36 @@ namespace DirectWrite
 {
 	GlyphRun::GlyphRun(const DWRITE_GLYPH_RUN &run)
 	{
-		run.fontFace->AddRef();
-		FontFace = DirectWrite::FontFace::FromPointer(run.fontFace);
+		Assign(run);
+	}
+
+	void GlyphRun::Assign(const DWRITE_GLYPH_RUN &run)
+	{
+		if (FontFace == nullptr || FontFace->InternalPointer != run.fontFace)
+		{
+			run.fontFace->AddRef();
+			FontFace = DirectWrite::FontFace::FromPointer(run.fontFace);
+		}
+
 		FontSize = run.fontEmSize;
 		GlyphCount = run.glyphCount;
 		IsSideways = run.isSideways != 0;
 		BidiLevel = run.bidiLevel;
 
-		GlyphIndices = gcnew array<short>(GlyphCount);
-		GlyphAdvances = gcnew array<float>(GlyphCount);
-		GlyphOffsets = gcnew array<GlyphOffset>(GlyphCount);
+		// arrays of the right size are reused when a pooled instance is reassigned
+		if (GlyphIndices == nullptr || GlyphIndices->Length != GlyphCount)
+			GlyphIndices = gcnew array<short>(GlyphCount);
+		if (GlyphAdvances == nullptr || GlyphAdvances->Length != GlyphCount)
+			GlyphAdvances = gcnew array<float>(GlyphCount);
+		if (GlyphOffsets == nullptr || GlyphOffsets->Length != GlyphCount)
+			GlyphOffsets = gcnew array<GlyphOffset>(GlyphCount);
 
 		for (int i = 0; i < GlyphCount; i++)
 		{
 			GlyphIndices[i] = run.glyphIndices[i];
-			GlyphAdvances[i] = run.glyphAdvances[i];
-			GlyphOffsets[i].AdvanceOffset = run.glyphOffsets[i].advanceOffset;
-			GlyphOffsets[i].AscenderOffset = run.glyphOffsets[i].ascenderOffset;
+			GlyphAdvances[i] = run.glyphAdvances == NULL ? 0.0f : run.glyphAdvances[i];
+			GlyphOffsets[i].AdvanceOffset = run.glyphOffsets == NULL ? 0.0f : run.glyphOffsets[i].advanceOffset;
+			GlyphOffsets[i].AscenderOffset = run.glyphOffsets == NULL ? 0.0f : run.glyphOffsets[i].ascenderOffset;
 		}
 	}
 
@@ -21,6 +21,8 @@
 */
 #include "stdafx.h"
 
+#include "../Utilities.h"
+
 #include "GlyphRunDescription.h"
 
 using namespace System;
@@ -31,12 +33,18 @@ namespace DirectWrite
 {
 	GlyphRunDescription::GlyphRunDescription(const DWRITE_GLYPH_RUN_DESCRIPTION &desc)
 	{
-		LocaleName = gcnew String(desc.localeName);
+		Assign(desc);
+	}
+
+	void GlyphRunDescription::Assign(const DWRITE_GLYPH_RUN_DESCRIPTION &desc)
+	{
+		LocaleName = Utilities::ReuseString(LocaleName, desc.localeName);
 		Text = gcnew String(desc.string);
 		StringLength = desc.stringLength;
 		TextPosition = desc.textPosition;
 
-		ClusterMap = gcnew array<short>(StringLength);
+		if (ClusterMap == nullptr || ClusterMap->Length != StringLength)
+			ClusterMap = gcnew array<short>(StringLength);
 		for (int i = 0; i < StringLength; i++)
 			ClusterMap[i] = desc.clusterMap[i];
 	}
@@ -29,6 +29,7 @@ namespace SlimDX
 		{
 		internal:
 			GlyphRunDescription(const DWRITE_GLYPH_RUN_DESCRIPTION &desc);
+			void Assign(const DWRITE_GLYPH_RUN_DESCRIPTION &desc);
 
 		public:
 			property System::String^ LocaleName;
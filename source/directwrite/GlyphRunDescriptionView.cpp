@@ -0,0 +1,112 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "../Utilities.h"
+
+#include "GlyphRunDescriptionView.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace DirectWrite
+{
+	GlyphRunDescriptionView::GlyphRunDescriptionView(const DWRITE_GLYPH_RUN_DESCRIPTION *description)
+		: m_Description(description)
+	{
+	}
+
+	const DWRITE_GLYPH_RUN_DESCRIPTION &GlyphRunDescriptionView::GetDescription()
+	{
+		if (m_Description == NULL)
+			throw gcnew InvalidOperationException("The glyph run description view is empty.");
+
+		return *m_Description;
+	}
+
+	IntPtr GlyphRunDescriptionView::LocaleNamePointer::get()
+	{
+		return IntPtr(const_cast<WCHAR*>(GetDescription().localeName));
+	}
+
+	String^ GlyphRunDescriptionView::LocaleName::get()
+	{
+		return gcnew String(GetDescription().localeName);
+	}
+
+	IntPtr GlyphRunDescriptionView::TextPointer::get()
+	{
+		return IntPtr(const_cast<WCHAR*>(GetDescription().string));
+	}
+
+	String^ GlyphRunDescriptionView::Text::get()
+	{
+		const DWRITE_GLYPH_RUN_DESCRIPTION &description = GetDescription();
+		return gcnew String(description.string, 0, description.stringLength);
+	}
+
+	int GlyphRunDescriptionView::StringLength::get()
+	{
+		return GetDescription().stringLength;
+	}
+
+	IntPtr GlyphRunDescriptionView::ClusterMapPointer::get()
+	{
+		return IntPtr(const_cast<UINT16*>(GetDescription().clusterMap));
+	}
+
+	int GlyphRunDescriptionView::TextPosition::get()
+	{
+		return GetDescription().textPosition;
+	}
+
+	short GlyphRunDescriptionView::GetClusterMapEntry(int index)
+	{
+		const DWRITE_GLYPH_RUN_DESCRIPTION &description = GetDescription();
+		if (index < 0 || index >= static_cast<int>(description.stringLength))
+			throw gcnew ArgumentOutOfRangeException("index");
+
+		return description.clusterMap[index];
+	}
+
+	void GlyphRunDescriptionView::CopyClusterMap(array<short>^ destination, int destinationIndex)
+	{
+		const DWRITE_GLYPH_RUN_DESCRIPTION &description = GetDescription();
+		int count = description.stringLength;
+		if (destination == nullptr)
+			throw gcnew ArgumentNullException("destination");
+		if (count == 0)
+			return;
+
+		Utilities::CheckArrayBounds(destination, destinationIndex, count);
+
+		pin_ptr<short> pinnedDestination = &destination[destinationIndex];
+		memcpy(pinnedDestination, description.clusterMap, sizeof(UINT16) * count);
+	}
+
+	GlyphRunDescription^ GlyphRunDescriptionView::ToGlyphRunDescription()
+	{
+		return gcnew GlyphRunDescription(GetDescription());
+	}
+}
+}
@@ -0,0 +1,61 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "GlyphRunDescription.h"
+
+namespace SlimDX
+{
+	namespace DirectWrite
+	{
+		/// <summary>
+		/// A read-only view of a glyph run description owned by DirectWrite. The view is only valid for the duration
+		/// of the <see cref="ITextViewRenderer"/> callback that received it; use <see cref="ToGlyphRunDescription"/> to keep a copy.
+		/// </summary>
+		public value class GlyphRunDescriptionView
+		{
+		private:
+			const DWRITE_GLYPH_RUN_DESCRIPTION *m_Description;
+
+			const DWRITE_GLYPH_RUN_DESCRIPTION &GetDescription();
+
+		internal:
+			GlyphRunDescriptionView(const DWRITE_GLYPH_RUN_DESCRIPTION *description);
+
+		public:
+			property bool IsEmpty { bool get() { return m_Description == NULL; } }
+
+			property System::IntPtr LocaleNamePointer { System::IntPtr get(); }
+			property System::String^ LocaleName { System::String^ get(); }
+			property System::IntPtr TextPointer { System::IntPtr get(); }
+			property System::String^ Text { System::String^ get(); }
+			property int StringLength { int get(); }
+			property System::IntPtr ClusterMapPointer { System::IntPtr get(); }
+			property int TextPosition { int get(); }
+
+			short GetClusterMapEntry(int index);
+			void CopyClusterMap(array<short>^ destination, int destinationIndex);
+
+			GlyphRunDescription^ ToGlyphRunDescription();
+		};
+	}
+}
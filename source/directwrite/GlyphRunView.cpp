@@ -0,0 +1,182 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "GlyphRunView.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace DirectWrite
+{
+	GlyphRunView::GlyphRunView(const DWRITE_GLYPH_RUN *run)
+		: m_Run(run)
+	{
+	}
+
+	const DWRITE_GLYPH_RUN &GlyphRunView::GetRun()
+	{
+		if (m_Run == NULL)
+			throw gcnew InvalidOperationException("The glyph run view is empty.");
+
+		return *m_Run;
+	}
+
+	IntPtr GlyphRunView::FontFacePointer::get()
+	{
+		return IntPtr(GetRun().fontFace);
+	}
+
+	DirectWrite::FontFace^ GlyphRunView::FontFace::get()
+	{
+		IDWriteFontFace *fontFace = GetRun().fontFace;
+		fontFace->AddRef();
+		return DirectWrite::FontFace::FromPointer(fontFace);
+	}
+
+	float GlyphRunView::FontSize::get()
+	{
+		return GetRun().fontEmSize;
+	}
+
+	int GlyphRunView::GlyphCount::get()
+	{
+		return GetRun().glyphCount;
+	}
+
+	bool GlyphRunView::IsSideways::get()
+	{
+		return GetRun().isSideways != 0;
+	}
+
+	int GlyphRunView::BidiLevel::get()
+	{
+		return GetRun().bidiLevel;
+	}
+
+	IntPtr GlyphRunView::GlyphIndicesPointer::get()
+	{
+		return IntPtr(const_cast<UINT16*>(GetRun().glyphIndices));
+	}
+
+	IntPtr GlyphRunView::GlyphAdvancesPointer::get()
+	{
+		return IntPtr(const_cast<FLOAT*>(GetRun().glyphAdvances));
+	}
+
+	IntPtr GlyphRunView::GlyphOffsetsPointer::get()
+	{
+		return IntPtr(const_cast<DWRITE_GLYPH_OFFSET*>(GetRun().glyphOffsets));
+	}
+
+	short GlyphRunView::GetGlyphIndex(int index)
+	{
+		const DWRITE_GLYPH_RUN &run = GetRun();
+		if (index < 0 || index >= static_cast<int>(run.glyphCount))
+			throw gcnew ArgumentOutOfRangeException("index");
+
+		return run.glyphIndices[index];
+	}
+
+	float GlyphRunView::GetGlyphAdvance(int index)
+	{
+		const DWRITE_GLYPH_RUN &run = GetRun();
+		if (index < 0 || index >= static_cast<int>(run.glyphCount))
+			throw gcnew ArgumentOutOfRangeException("index");
+
+		return run.glyphAdvances == NULL ? 0.0f : run.glyphAdvances[index];
+	}
+
+	GlyphOffset GlyphRunView::GetGlyphOffset(int index)
+	{
+		const DWRITE_GLYPH_RUN &run = GetRun();
+		if (index < 0 || index >= static_cast<int>(run.glyphCount))
+			throw gcnew ArgumentOutOfRangeException("index");
+
+		GlyphOffset result;
+		if (run.glyphOffsets != NULL)
+		{
+			result.AdvanceOffset = run.glyphOffsets[index].advanceOffset;
+			result.AscenderOffset = run.glyphOffsets[index].ascenderOffset;
+		}
+
+		return result;
+	}
+
+	void GlyphRunView::CopyGlyphIndices(array<short>^ destination, int destinationIndex)
+	{
+		const DWRITE_GLYPH_RUN &run = GetRun();
+		int count = run.glyphCount;
+		if (destination == nullptr)
+			throw gcnew ArgumentNullException("destination");
+		if (count == 0)
+			return;
+
+		Utilities::CheckArrayBounds(destination, destinationIndex, count);
+
+		pin_ptr<short> pinnedDestination = &destination[destinationIndex];
+		memcpy(pinnedDestination, run.glyphIndices, sizeof(UINT16) * count);
+	}
+
+	void GlyphRunView::CopyGlyphAdvances(array<float>^ destination, int destinationIndex)
+	{
+		const DWRITE_GLYPH_RUN &run = GetRun();
+		int count = run.glyphCount;
+		if (destination == nullptr)
+			throw gcnew ArgumentNullException("destination");
+		if (count == 0)
+			return;
+
+		Utilities::CheckArrayBounds(destination, destinationIndex, count);
+
+		pin_ptr<float> pinnedDestination = &destination[destinationIndex];
+		if (run.glyphAdvances == NULL)
+			memset(pinnedDestination, 0, sizeof(FLOAT) * count);
+		else
+			memcpy(pinnedDestination, run.glyphAdvances, sizeof(FLOAT) * count);
+	}
+
+	void GlyphRunView::CopyGlyphOffsets(array<GlyphOffset>^ destination, int destinationIndex)
+	{
+		const DWRITE_GLYPH_RUN &run = GetRun();
+		int count = run.glyphCount;
+		if (destination == nullptr)
+			throw gcnew ArgumentNullException("destination");
+		if (count == 0)
+			return;
+
+		Utilities::CheckArrayBounds(destination, destinationIndex, count);
+
+		pin_ptr<GlyphOffset> pinnedDestination = &destination[destinationIndex];
+		if (run.glyphOffsets == NULL)
+			memset(pinnedDestination, 0, sizeof(DWRITE_GLYPH_OFFSET) * count);
+		else
+			memcpy(pinnedDestination, run.glyphOffsets, sizeof(DWRITE_GLYPH_OFFSET) * count);
+	}
+
+	GlyphRun^ GlyphRunView::ToGlyphRun()
+	{
+		return gcnew GlyphRun(GetRun());
+	}
+}
+}
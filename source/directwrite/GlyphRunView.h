@@ -0,0 +1,71 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "FontFace.h"
+#include "GlyphOffset.h"
+#include "GlyphRunDW.h"
+
+namespace SlimDX
+{
+	namespace DirectWrite
+	{
+		/// <summary>
+		/// A read-only view of a glyph run owned by DirectWrite. The view is only valid for the duration
+		/// of the <see cref="ITextViewRenderer"/> callback that received it; use <see cref="ToGlyphRun"/> to keep a copy.
+		/// </summary>
+		public value class GlyphRunView
+		{
+		private:
+			const DWRITE_GLYPH_RUN *m_Run;
+
+			const DWRITE_GLYPH_RUN &GetRun();
+
+		internal:
+			GlyphRunView(const DWRITE_GLYPH_RUN *run);
+
+		public:
+			property bool IsEmpty { bool get() { return m_Run == NULL; } }
+
+			property System::IntPtr FontFacePointer { System::IntPtr get(); }
+			property DirectWrite::FontFace^ FontFace { DirectWrite::FontFace^ get(); }
+			property float FontSize { float get(); }
+			property int GlyphCount { int get(); }
+			property bool IsSideways { bool get(); }
+			property int BidiLevel { int get(); }
+
+			property System::IntPtr GlyphIndicesPointer { System::IntPtr get(); }
+			property System::IntPtr GlyphAdvancesPointer { System::IntPtr get(); }
+			property System::IntPtr GlyphOffsetsPointer { System::IntPtr get(); }
+
+			short GetGlyphIndex(int index);
+			float GetGlyphAdvance(int index);
+			GlyphOffset GetGlyphOffset(int index);
+
+			void CopyGlyphIndices(array<short>^ destination, int destinationIndex);
+			void CopyGlyphAdvances(array<float>^ destination, int destinationIndex);
+			void CopyGlyphOffsets(array<GlyphOffset>^ destination, int destinationIndex);
+
+			GlyphRun^ ToGlyphRun();
+		};
+	}
+}
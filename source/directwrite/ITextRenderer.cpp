@@ -41,9 +41,25 @@ namespace DirectWrite
 		return new ITextRendererShim(wrappedInterface);
 	}
 
+	ITextRendererShim *ITextRendererShim::CreateInstance(ITextViewRenderer ^wrappedInterface)
+	{
+		if (wrappedInterface == nullptr)
+			return NULL;
+
+		return new ITextRendererShim(wrappedInterface);
+	}
+
 	ITextRendererShim::ITextRendererShim(ITextRenderer ^wrappedInterface)
 		: m_WrappedInterface(wrappedInterface),
-		m_refCount(1)
+		m_refCount(1),
+		m_ReuseArguments(Configuration::ReuseTextRendererArguments)
+	{
+	}
+
+	ITextRendererShim::ITextRendererShim(ITextViewRenderer ^wrappedInterface)
+		: m_WrappedViewInterface(wrappedInterface),
+		m_refCount(1),
+		m_ReuseArguments(false)
 	{
 	}
 
@@ -77,7 +93,11 @@ namespace DirectWrite
 	{
 		try
 		{
-			*isDisabled = m_WrappedInterface->IsPixelSnappingDisabled(IntPtr(clientDrawingContext));
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			if (viewRenderer != nullptr)
+				*isDisabled = viewRenderer->IsPixelSnappingDisabled(IntPtr(clientDrawingContext));
+			else
+				*isDisabled = m_WrappedInterface->IsPixelSnappingDisabled(IntPtr(clientDrawingContext));
 			return S_OK;
 		}
 		catch(SlimDXException^ e)
@@ -94,7 +114,8 @@ namespace DirectWrite
 	{
 		try
 		{
-			Matrix3x2 result = m_WrappedInterface->GetCurrentTransform(IntPtr(clientDrawingContext));
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			Matrix3x2 result = viewRenderer != nullptr ? viewRenderer->GetCurrentTransform(IntPtr(clientDrawingContext)) : m_WrappedInterface->GetCurrentTransform(IntPtr(clientDrawingContext));
 			memcpy(transform, &result, sizeof(DWRITE_MATRIX));
 			return S_OK;
 		}
@@ -112,7 +133,11 @@ namespace DirectWrite
 	{
 		try
 		{
-			*pixelsPerDip = m_WrappedInterface->GetPixelsPerDip(IntPtr(clientDrawingContext));
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			if (viewRenderer != nullptr)
+				*pixelsPerDip = viewRenderer->GetPixelsPerDip(IntPtr(clientDrawingContext));
+			else
+				*pixelsPerDip = m_WrappedInterface->GetPixelsPerDip(IntPtr(clientDrawingContext));
 			return S_OK;
 		}
 		catch(SlimDXException^ e)
@@ -130,8 +155,40 @@ namespace DirectWrite
 	{
 		try
 		{
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			if (viewRenderer != nullptr)
+			{
+				Result result = viewRenderer->DrawGlyphRun(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, static_cast<MeasuringMode>(measuringMode),
+					GlyphRunView(glyphRun), GlyphRunDescriptionView(glyphRunDescription), IntPtr(clientDrawingEffect));
+
+				return result.Code;
+			}
+
+			GlyphRun ^run;
+			GlyphRunDescription ^description;
+			if (m_ReuseArguments)
+			{
+				if (static_cast<GlyphRun ^>(m_GlyphRun) == nullptr)
+					m_GlyphRun = gcnew GlyphRun(*glyphRun);
+				else
+					m_GlyphRun->Assign(*glyphRun);
+
+				if (static_cast<GlyphRunDescription ^>(m_GlyphRunDescription) == nullptr)
+					m_GlyphRunDescription = gcnew GlyphRunDescription(*glyphRunDescription);
+				else
+					m_GlyphRunDescription->Assign(*glyphRunDescription);
+
+				run = m_GlyphRun;
+				description = m_GlyphRunDescription;
+			}
+			else
+			{
+				run = gcnew GlyphRun(*glyphRun);
+				description = gcnew GlyphRunDescription(*glyphRunDescription);
+			}
+
 			Result result = m_WrappedInterface->DrawGlyphRun(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, static_cast<MeasuringMode>(measuringMode),
-				gcnew GlyphRun(*glyphRun), gcnew GlyphRunDescription(*glyphRunDescription), IntPtr(clientDrawingEffect));
+				run, description, IntPtr(clientDrawingEffect));
 
 			return result.Code;
 		}
@@ -149,7 +206,27 @@ namespace DirectWrite
 	{
 		try
 		{
-			Result result = m_WrappedInterface->DrawUnderline(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, gcnew Underline(*underline), IntPtr(clientDrawingEffect));
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			if (viewRenderer != nullptr)
+			{
+				Result result = viewRenderer->DrawUnderline(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, UnderlineView(underline), IntPtr(clientDrawingEffect));
+				return result.Code;
+			}
+
+			Underline ^value;
+			if (m_ReuseArguments)
+			{
+				if (static_cast<Underline ^>(m_Underline) == nullptr)
+					m_Underline = gcnew Underline(*underline);
+				else
+					m_Underline->Assign(*underline);
+
+				value = m_Underline;
+			}
+			else
+				value = gcnew Underline(*underline);
+
+			Result result = m_WrappedInterface->DrawUnderline(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, value, IntPtr(clientDrawingEffect));
 			return result.Code;
 		}
 		catch(SlimDXException^ e)
@@ -166,7 +243,27 @@ namespace DirectWrite
 	{
 		try
 		{
-			Result result = m_WrappedInterface->DrawStrikethrough(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, gcnew Strikethrough(*strikethrough), IntPtr(clientDrawingEffect));
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			if (viewRenderer != nullptr)
+			{
+				Result result = viewRenderer->DrawStrikethrough(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, StrikethroughView(strikethrough), IntPtr(clientDrawingEffect));
+				return result.Code;
+			}
+
+			Strikethrough ^value;
+			if (m_ReuseArguments)
+			{
+				if (static_cast<Strikethrough ^>(m_Strikethrough) == nullptr)
+					m_Strikethrough = gcnew Strikethrough(*strikethrough);
+				else
+					m_Strikethrough->Assign(*strikethrough);
+
+				value = m_Strikethrough;
+			}
+			else
+				value = gcnew Strikethrough(*strikethrough);
+
+			Result result = m_WrappedInterface->DrawStrikethrough(IntPtr(clientDrawingContext), baselineOriginX, baselineOriginY, value, IntPtr(clientDrawingEffect));
 			return result.Code;
 		}
 		catch(SlimDXException^ e)
@@ -183,7 +280,10 @@ namespace DirectWrite
 	{
 		try
 		{
-			Result result = m_WrappedInterface->DrawInlineObject(IntPtr(clientDrawingContext), originX, originY, InlineObject::FromPointer(inlineObject), isSideways != 0, isRightToLeft != 0, IntPtr(clientDrawingEffect));
+			ITextViewRenderer ^viewRenderer = m_WrappedViewInterface;
+			Result result = viewRenderer != nullptr ?
+				viewRenderer->DrawInlineObject(IntPtr(clientDrawingContext), originX, originY, InlineObject::FromPointer(inlineObject), isSideways != 0, isRightToLeft != 0, IntPtr(clientDrawingEffect)) :
+				m_WrappedInterface->DrawInlineObject(IntPtr(clientDrawingContext), originX, originY, InlineObject::FromPointer(inlineObject), isSideways != 0, isRightToLeft != 0, IntPtr(clientDrawingEffect));
 			return result.Code;
 		}
 		catch(SlimDXException^ e)
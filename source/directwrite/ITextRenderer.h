@@ -30,8 +30,12 @@ extern const IID IID_IDWriteTextRenderer;
 #include "Enums.h"
 #include "GlyphRunDW.h"
 #include "GlyphRunDescription.h"
+#include "GlyphRunView.h"
+#include "GlyphRunDescriptionView.h"
 #include "Underline.h"
+#include "UnderlineView.h"
 #include "Strikethrough.h"
+#include "StrikethroughView.h"
 
 namespace SlimDX
 {
@@ -49,10 +53,27 @@ namespace SlimDX
 			Result DrawUnderline(System::IntPtr drawingContext, float baselineOriginX, float baselineOriginY, Underline^ underline, System::IntPtr clientDrawingEffect);
 		};
 
+		/// <summary>
+		/// A text renderer that receives glyph runs and decorations as views over DirectWrite's own memory,
+		/// so no managed objects are allocated per callback. Views are only valid until the callback returns.
+		/// </summary>
+		public interface struct ITextViewRenderer
+		{
+			Matrix3x2 GetCurrentTransform(System::IntPtr drawingContext);
+			float GetPixelsPerDip(System::IntPtr drawingContext);
+			bool IsPixelSnappingDisabled(System::IntPtr drawingContext);
+
+			Result DrawGlyphRun(System::IntPtr drawingContext, float baselineOriginX, float baselineOriginY, MeasuringMode measuringMode, GlyphRunView glyphRun, GlyphRunDescriptionView glyphRunDescription, System::IntPtr clientDrawingEffect);
+			Result DrawInlineObject(System::IntPtr drawingContext, float baselineOriginX, float baselineOriginY, InlineObject^ inlineObject, bool isSideways, bool isRightToLeft, System::IntPtr clientDrawingEffect);
+			Result DrawStrikethrough(System::IntPtr drawingContext, float baselineOriginX, float baselineOriginY, StrikethroughView strikethrough, System::IntPtr clientDrawingEffect);
+			Result DrawUnderline(System::IntPtr drawingContext, float baselineOriginX, float baselineOriginY, UnderlineView underline, System::IntPtr clientDrawingEffect);
+		};
+
 		class ITextRendererShim : public IDWriteTextRenderer
 		{
 		public:
 			static ITextRendererShim *CreateInstance(ITextRenderer ^wrappedInterface);
+			static ITextRendererShim *CreateInstance(ITextViewRenderer ^wrappedInterface);
 
 			STDMETHOD(QueryInterface)(REFIID riid, void **ppvObject);
 			STDMETHOD_(ULONG, AddRef)();
@@ -111,9 +132,17 @@ namespace SlimDX
 
 		private:
 			ITextRendererShim(ITextRenderer ^wrappedInterface);
+			ITextRendererShim(ITextViewRenderer ^wrappedInterface);
 
 			int m_refCount;
 			gcroot<ITextRenderer ^> m_WrappedInterface;
+			gcroot<ITextViewRenderer ^> m_WrappedViewInterface;
+
+			bool m_ReuseArguments;
+			gcroot<GlyphRun ^> m_GlyphRun;
+			gcroot<GlyphRunDescription ^> m_GlyphRunDescription;
+			gcroot<Underline ^> m_Underline;
+			gcroot<Strikethrough ^> m_Strikethrough;
 		};
 	}
 }
@@ -43,8 +43,24 @@ namespace DirectWrite
 
 		ITextRendererShim *shim = ITextRendererShim::CreateInstance(renderer);
 
-		HRESULT hr = InternalPointer->Draw(nativeClientDrawingContext, shim,
-			originX, originY, isSideways ? TRUE : FALSE, isRightToLeft ? TRUE : FALSE, nativeClientDrawingEffect);
+		HRESULT hr = TIME_CALL( InternalPointer->Draw(nativeClientDrawingContext, shim,
+			originX, originY, isSideways ? TRUE : FALSE, isRightToLeft ? TRUE : FALSE, nativeClientDrawingEffect) );
+
+		shim->Release();
+		return RECORD_DW(hr);
+	}
+
+	Result InlineObject::Draw(IntPtr clientDrawingContext, ITextViewRenderer ^renderer,
+		float originX, float originY, bool isSideways, bool isRightToLeft,
+		IClientDrawingEffect ^clientDrawingEffect)
+	{
+		IUnknown *nativeClientDrawingEffect = clientDrawingEffect == nullptr ? 0 : reinterpret_cast<IUnknown*>(clientDrawingEffect->ComPointer.ToPointer());
+		void *nativeClientDrawingContext = static_cast<void *>(clientDrawingContext);
+
+		ITextRendererShim *shim = ITextRendererShim::CreateInstance(renderer);
+
+		HRESULT hr = TIME_CALL( InternalPointer->Draw(nativeClientDrawingContext, shim,
+			originX, originY, isSideways ? TRUE : FALSE, isRightToLeft ? TRUE : FALSE, nativeClientDrawingEffect) );
 
 		shim->Release();
 		return RECORD_DW(hr);
@@ -33,6 +33,7 @@ namespace SlimDX
 	namespace DirectWrite
 	{
 		interface struct ITextRenderer;
+		interface struct ITextViewRenderer;
 		interface struct IClientDrawingEffect;
 
 		public ref class InlineObject : public ComObject
@@ -43,6 +44,9 @@ namespace SlimDX
 			Result Draw(System::IntPtr clientDrawingContext, ITextRenderer ^renderer,
 				float originX, float originY, bool isSideways, bool isRightToLeft,
 				IClientDrawingEffect ^clientDrawingEffect);
+			Result Draw(System::IntPtr clientDrawingContext, ITextViewRenderer ^renderer,
+				float originX, float originY, bool isSideways, bool isRightToLeft,
+				IClientDrawingEffect ^clientDrawingEffect);
 			Result GetBreakConditions([Out] BreakCondition %before, [Out] BreakCondition %after);
 			property InlineObjectMetrics Metrics
 			{
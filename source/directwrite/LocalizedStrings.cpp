@@ -46,12 +46,12 @@ namespace DirectWrite
 			throw gcnew ArgumentOutOfRangeException("index");
 
 		UINT32 length = 0;
-		HRESULT hr = InternalPointer->GetLocaleNameLength(index, &length);
+		HRESULT hr = TIME_CALL( InternalPointer->GetLocaleNameLength(index, &length) );
 		if(RECORD_DW(hr).IsFailure)
 			return nullptr;
 
 		stack_array<wchar_t> buffer = stackalloc(wchar_t, length);
-		hr = InternalPointer->GetLocaleName(index, &buffer[0], length);
+		hr = TIME_CALL( InternalPointer->GetLocaleName(index, &buffer[0], length) );
 		if(RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -64,12 +64,12 @@ namespace DirectWrite
 			throw gcnew ArgumentOutOfRangeException("index");
 
 		UINT32 length = 0;
-		HRESULT hr = InternalPointer->GetStringLength(index, &length);
+		HRESULT hr = TIME_CALL( InternalPointer->GetStringLength(index, &length) );
 		if(RECORD_DW(hr).IsFailure)
 			return nullptr;
 
 		stack_array<wchar_t> buffer = stackalloc(wchar_t, length);
-		hr = InternalPointer->GetString(index, &buffer[0], length);
+		hr = TIME_CALL( InternalPointer->GetString(index, &buffer[0], length) );
 		if(RECORD_DW(hr).IsFailure)
 			return nullptr;
 
@@ -81,7 +81,7 @@ namespace DirectWrite
 		BOOL existsNative = FALSE;
 		UINT32 index = 0;
 		pin_ptr<const wchar_t> nameChars = PtrToStringChars( localeName );
-		HRESULT hr = InternalPointer->FindLocaleName( nameChars, &index, &existsNative );
+		HRESULT hr = TIME_CALL( InternalPointer->FindLocaleName( nameChars, &index, &existsNative ) );
 		exists = existsNative == TRUE;
 		RECORD_DW(hr);
 		return index;
@@ -21,6 +21,8 @@
 */
 #include "stdafx.h"
 
+#include "../Utilities.h"
+
 #include "Strikethrough.h"
 
 using namespace System;
@@ -30,13 +32,18 @@ namespace SlimDX
 namespace DirectWrite
 {
 	Strikethrough::Strikethrough(const DWRITE_STRIKETHROUGH &strikethrough)
+	{
+		Assign(strikethrough);
+	}
+
+	void Strikethrough::Assign(const DWRITE_STRIKETHROUGH &strikethrough)
 	{
 		Width = strikethrough.width;
 		Thickness = strikethrough.thickness;
 		Offset = strikethrough.offset;
 		ReadingDirection = static_cast<DirectWrite::ReadingDirection>(strikethrough.readingDirection);
 		FlowDirection = static_cast<DirectWrite::FlowDirection>(strikethrough.flowDirection);
-		LocaleName = gcnew String(strikethrough.localeName);
+		LocaleName = Utilities::ReuseString(LocaleName, strikethrough.localeName);
 		MeasuringMode = static_cast<DirectWrite::MeasuringMode>(strikethrough.measuringMode);
 	}
 }
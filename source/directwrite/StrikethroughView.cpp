@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "StrikethroughView.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace DirectWrite
+{
+	StrikethroughView::StrikethroughView(const DWRITE_STRIKETHROUGH *strikethrough)
+		: m_Strikethrough(strikethrough)
+	{
+	}
+
+	const DWRITE_STRIKETHROUGH &StrikethroughView::GetStrikethrough()
+	{
+		if (m_Strikethrough == NULL)
+			throw gcnew InvalidOperationException("The strikethrough view is empty.");
+
+		return *m_Strikethrough;
+	}
+
+	float StrikethroughView::Width::get()
+	{
+		return GetStrikethrough().width;
+	}
+
+	float StrikethroughView::Thickness::get()
+	{
+		return GetStrikethrough().thickness;
+	}
+
+	float StrikethroughView::Offset::get()
+	{
+		return GetStrikethrough().offset;
+	}
+
+	DirectWrite::ReadingDirection StrikethroughView::ReadingDirection::get()
+	{
+		return static_cast<DirectWrite::ReadingDirection>(GetStrikethrough().readingDirection);
+	}
+
+	DirectWrite::FlowDirection StrikethroughView::FlowDirection::get()
+	{
+		return static_cast<DirectWrite::FlowDirection>(GetStrikethrough().flowDirection);
+	}
+
+	IntPtr StrikethroughView::LocaleNamePointer::get()
+	{
+		return IntPtr(const_cast<WCHAR*>(GetStrikethrough().localeName));
+	}
+
+	String^ StrikethroughView::LocaleName::get()
+	{
+		return gcnew String(GetStrikethrough().localeName);
+	}
+
+	DirectWrite::MeasuringMode StrikethroughView::MeasuringMode::get()
+	{
+		return static_cast<DirectWrite::MeasuringMode>(GetStrikethrough().measuringMode);
+	}
+
+	Strikethrough^ StrikethroughView::ToStrikethrough()
+	{
+		return gcnew Strikethrough(GetStrikethrough());
+	}
+}
+}
@@ -0,0 +1,60 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "Enums.h"
+#include "Strikethrough.h"
+
+namespace SlimDX
+{
+	namespace DirectWrite
+	{
+		/// <summary>
+		/// A read-only view of a strikethrough owned by DirectWrite. The view is only valid for the duration
+		/// of the <see cref="ITextViewRenderer"/> callback that received it; use <see cref="ToStrikethrough"/> to keep a copy.
+		/// </summary>
+		public value class StrikethroughView
+		{
+		private:
+			const DWRITE_STRIKETHROUGH *m_Strikethrough;
+
+			const DWRITE_STRIKETHROUGH &GetStrikethrough();
+
+		internal:
+			StrikethroughView(const DWRITE_STRIKETHROUGH *strikethrough);
+
+		public:
+			property bool IsEmpty { bool get() { return m_Strikethrough == NULL; } }
+
+			property float Width { float get(); }
+			property float Thickness { float get(); }
+			property float Offset { float get(); }
+			property DirectWrite::ReadingDirection ReadingDirection { DirectWrite::ReadingDirection get(); }
+			property DirectWrite::FlowDirection FlowDirection { DirectWrite::FlowDirection get(); }
+			property System::IntPtr LocaleNamePointer { System::IntPtr get(); }
+			property System::String^ LocaleName { System::String^ get(); }
+			property DirectWrite::MeasuringMode MeasuringMode { DirectWrite::MeasuringMode get(); }
+
+			Strikethrough^ ToStrikethrough();
+		};
+	}
+}
@@ -54,8 +54,8 @@ namespace DirectWrite
 		pin_ptr<const wchar_t> pinnedName = PtrToStringChars( familyName );
 		pin_ptr<const wchar_t> pinnedLocale = PtrToStringChars( localeName );
 
-		HRESULT hr = factory->InternalPointer->CreateTextFormat( pinnedName, fc, static_cast<DWRITE_FONT_WEIGHT>( weight ), static_cast<DWRITE_FONT_STYLE>( style ),
-			static_cast<DWRITE_FONT_STRETCH>( stretch ), fontSize, pinnedLocale, &textFormat );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateTextFormat( pinnedName, fc, static_cast<DWRITE_FONT_WEIGHT>( weight ), static_cast<DWRITE_FONT_STYLE>( style ),
+			static_cast<DWRITE_FONT_STRETCH>( stretch ), fontSize, pinnedLocale, &textFormat ) );
 
 		if( RECORD_DW( hr ).IsFailure )
 			throw gcnew DirectWriteException( Result::Last );
@@ -70,6 +70,7 @@ namespace DirectWrite
 
 	void TextFormat::FlowDirection::set(SlimDX::DirectWrite::FlowDirection value)
 	{
+		++m_Version;
 		InternalPointer->SetFlowDirection(static_cast<DWRITE_FLOW_DIRECTION>(value));
 	}
 
@@ -123,6 +124,7 @@ namespace DirectWrite
 
 	void TextFormat::IncrementalTabStop::set(float value)
 	{
+		++m_Version;
 		RECORD_DW(InternalPointer->SetIncrementalTabStop(value));
 	}
 
@@ -139,6 +141,7 @@ namespace DirectWrite
 
 	Result TextFormat::SetLineSpacing(LineSpacingMethod method, float lineSpacing, float baseline)
 	{
+		++m_Version;
 		return RECORD_DW(InternalPointer->SetLineSpacing(static_cast<DWRITE_LINE_SPACING_METHOD>(method), lineSpacing, baseline));
 	}
 
@@ -161,6 +164,7 @@ namespace DirectWrite
 
 	void TextFormat::ParagraphAlignment::set( SlimDX::DirectWrite::ParagraphAlignment value )
 	{
+		++m_Version;
 		InternalPointer->SetParagraphAlignment( static_cast<DWRITE_PARAGRAPH_ALIGNMENT>( value ) );
 	}
 
@@ -171,6 +175,7 @@ namespace DirectWrite
 
 	void TextFormat::ReadingDirection::set(SlimDX::DirectWrite::ReadingDirection value)
 	{
+		++m_Version;
 		RECORD_DW(InternalPointer->SetReadingDirection(static_cast<DWRITE_READING_DIRECTION>(value)));
 	}
 
@@ -181,6 +186,7 @@ namespace DirectWrite
 
 	void TextFormat::TextAlignment::set( SlimDX::DirectWrite::TextAlignment value )
 	{
+		++m_Version;
 		InternalPointer->SetTextAlignment( static_cast<DWRITE_TEXT_ALIGNMENT>( value ) );
 	}
 
@@ -218,6 +224,7 @@ namespace DirectWrite
 
 	void TextFormat::WordWrapping::set(SlimDX::DirectWrite::WordWrapping value)
 	{
+		++m_Version;
 		RECORD_DW(InternalPointer->SetWordWrapping(static_cast<DWRITE_WORD_WRAPPING>(value)));
 	}
 }
@@ -40,12 +40,21 @@ namespace SlimDX
 		public ref class TextFormat : public ComObject
 		{
 			COMOBJECT(IDWriteTextFormat, TextFormat);
+
+			int m_Version;
 			
 			void Init( Factory^ factory, System::String^ familyName, FontWeight weight, FontStyle style, FontStretch stretch, float fontSize, System::String^ localeName, FontCollection^ fontCollection );
 
 		private protected:
 			TextFormat() { }
 
+		internal:
+			// Incremented by every setter, so caches keyed on a format can tell when it has changed.
+			property int Version
+			{
+				int get() { return m_Version; }
+			}
+
 		public:
 			TextFormat( Factory^ factory, System::String^ familyName, FontWeight weight, FontStyle style, FontStretch stretch, float fontSize, System::String^ localeName );
 			TextFormat( Factory^ factory, System::String^ familyName, FontWeight weight, FontStyle style, FontStretch stretch, float fontSize, System::String^ localeName, FontCollection^ fontCollection );
@@ -54,7 +54,7 @@ namespace DirectWrite
 		IDWriteTextLayout *layout = NULL;
 		pin_ptr<const wchar_t> pinnedText = PtrToStringChars( text );
 
-		HRESULT hr = factory->InternalPointer->CreateTextLayout( pinnedText, text->Length, format->InternalPointer, maxWidth, maxHeight, &layout );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateTextLayout( pinnedText, text->Length, format->InternalPointer, maxWidth, maxHeight, &layout ) );
 		if( RECORD_DW( hr ).IsFailure )
 			throw gcnew DirectWriteException( Result::Last );
 
@@ -72,7 +72,17 @@ namespace DirectWrite
 	{
 		ITextRendererShim *shim = ITextRendererShim::CreateInstance(renderer);
 
-		HRESULT hr = InternalPointer->Draw(static_cast<void *>(clientDrawingContext), shim, originX, originY);
+		HRESULT hr = TIME_CALL( InternalPointer->Draw(static_cast<void *>(clientDrawingContext), shim, originX, originY) );
+		shim->Release();
+
+		return RECORD_DW(hr);
+	}
+
+	Result TextLayout::Draw(IntPtr clientDrawingContext, ITextViewRenderer ^renderer, float originX, float originY)
+	{
+		ITextRendererShim *shim = ITextRendererShim::CreateInstance(renderer);
+
+		HRESULT hr = TIME_CALL( InternalPointer->Draw(static_cast<void *>(clientDrawingContext), shim, originX, originY) );
 		shim->Release();
 
 		return RECORD_DW(hr);
@@ -84,7 +94,7 @@ namespace DirectWrite
 		BOOL trailingHit;
 		BOOL inside;
 
-		HRESULT hr = InternalPointer->HitTestPoint( pointX, pointY, &trailingHit, &inside, &htm );
+		HRESULT hr = TIME_CALL( InternalPointer->HitTestPoint( pointX, pointY, &trailingHit, &inside, &htm ) );
 		if( RECORD_DW( hr ).IsFailure )
 		{
 			return HitTestMetrics();
@@ -102,7 +112,7 @@ namespace DirectWrite
 		FLOAT x;
 		FLOAT y;
 
-		HRESULT hr = InternalPointer->HitTestTextPosition( textPosition, isTrailingHit, &x, &y, &htm );
+		HRESULT hr = TIME_CALL( InternalPointer->HitTestTextPosition( textPosition, isTrailingHit, &x, &y, &htm ) );
 		if( RECORD_DW( hr ).IsFailure )
 		{
 			return HitTestMetrics();
@@ -200,12 +210,9 @@ namespace DirectWrite
 
 	IClientDrawingEffect ^TextLayout::GetDrawingEffect(int currentPosition,	[Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		IClientDrawingEffect ^result = GetDrawingEffectInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -227,12 +234,9 @@ namespace DirectWrite
 
 	SlimDX::DirectWrite::FontCollection^ TextLayout::GetFontCollection ( int currentPosition, [Out] TextRange% textRange )
 	{
-		DWRITE_TEXT_RANGE tr;
+		DWRITE_TEXT_RANGE tr = { 0 };
 		SlimDX::DirectWrite::FontCollection ^collection = GetFontCollectionInternal(InternalPointer, currentPosition, &tr);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(tr);
-		}
+		textRange = TextRangeFromNative(tr);
 
 		return collection;
 	}
@@ -261,12 +265,9 @@ namespace DirectWrite
 
 	String^ TextLayout::GetFontFamilyName( int currentPosition, [Out] TextRange% textRange )
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		String ^familyName = GetFontFamilyNameInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 
 		return familyName;
 	}
@@ -285,12 +286,9 @@ namespace DirectWrite
 
 	float TextLayout::GetFontSize(int currentPosition, [Out] TextRange% textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		float const result = GetFontSizeInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -311,12 +309,9 @@ namespace DirectWrite
 
 	SlimDX::DirectWrite::FontStretch TextLayout::GetFontStretch(int currentPosition, [Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		SlimDX::DirectWrite::FontStretch result = GetFontStretchInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -337,12 +332,9 @@ namespace DirectWrite
 
 	SlimDX::DirectWrite::FontStyle TextLayout::GetFontStyle(int currentPosition, [Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		SlimDX::DirectWrite::FontStyle style = GetFontStyleInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return style;
 	}
 
@@ -363,12 +355,9 @@ namespace DirectWrite
 
 	SlimDX::DirectWrite::FontWeight TextLayout::GetFontWeight(int currentPosition, [Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		SlimDX::DirectWrite::FontWeight result = GetFontWeightInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -389,12 +378,9 @@ namespace DirectWrite
 
 	InlineObject ^TextLayout::GetInlineObject(int currentPosition, [Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		InlineObject ^result = GetInlineObjectInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -445,12 +431,9 @@ namespace DirectWrite
 
 	String ^TextLayout::GetLocaleName(int currentPosition, [Out] TextRange %range)
 	{
-		DWRITE_TEXT_RANGE textRange;
+		DWRITE_TEXT_RANGE textRange = { 0 };
 		String ^result = GetLocaleNameInternal(InternalPointer, currentPosition, &textRange);
-		if (Result::Last.IsSuccess)
-		{
-			range = TextRangeFromNative(textRange);
-		}
+		range = TextRangeFromNative(textRange);
 		return result;
 	}
 
@@ -473,10 +456,7 @@ namespace DirectWrite
 	{
 		DWRITE_TEXT_RANGE range = { 0 };
 		bool const result = GetStrikethroughInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -498,12 +478,9 @@ namespace DirectWrite
 
 	Typography ^TextLayout::GetTypography(int currentPosition, [Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		Typography ^result = GetTypographyInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 
 		return result;
 	}
@@ -525,12 +502,9 @@ namespace DirectWrite
 
 	bool TextLayout::GetUnderline(int currentPosition, [Out] TextRange %textRange)
 	{
-		DWRITE_TEXT_RANGE range;
+		DWRITE_TEXT_RANGE range = { 0 };
 		bool const result = GetUnderlineInternal(InternalPointer, currentPosition, &range);
-		if (Result::Last.IsSuccess)
-		{
-			textRange = TextRangeFromNative(range);
-		}
+		textRange = TextRangeFromNative(range);
 		return result;
 	}
 
@@ -0,0 +1,169 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "TextLayoutCache.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Runtime::CompilerServices;
+
+namespace SlimDX
+{
+namespace DirectWrite
+{
+	bool TextLayoutCache::Key::Equals( Key other )
+	{
+		return Object::ReferenceEquals( Format, other.Format ) && FormatVersion == other.FormatVersion &&
+			MaxWidth == other.MaxWidth && MaxHeight == other.MaxHeight &&
+			String::Equals( Text, other.Text, StringComparison::Ordinal );
+	}
+
+	bool TextLayoutCache::Key::Equals( Object^ obj )
+	{
+		if( obj == nullptr || obj->GetType() != Key::typeid )
+			return false;
+
+		return Equals( safe_cast<Key>( obj ) );
+	}
+
+	int TextLayoutCache::Key::GetHashCode()
+	{
+		int hash = Text->GetHashCode();
+		hash = hash * 31 + RuntimeHelpers::GetHashCode( Format );
+		hash = hash * 31 + FormatVersion;
+		hash = hash * 31 + MaxWidth.GetHashCode();
+		return hash * 31 + MaxHeight.GetHashCode();
+	}
+
+	TextLayoutCache::TextLayoutCache( Factory^ factory, int capacity )
+	{
+		if( factory == nullptr )
+			throw gcnew ArgumentNullException( "factory" );
+		if( capacity <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "capacity", "Capacity must be greater than zero." );
+
+		m_Factory = factory;
+		m_Capacity = capacity;
+		m_Entries = gcnew Dictionary<Key, LinkedListNode<Entry^>^>( capacity );
+		m_Order = gcnew LinkedList<Entry^>();
+	}
+
+	TextLayoutCache::~TextLayoutCache()
+	{
+		Clear();
+	}
+
+	TextLayoutCache::Entry^ TextLayoutCache::GetEntry( String^ text, TextFormat^ format, float maxWidth, float maxHeight )
+	{
+		if( text == nullptr )
+			throw gcnew ArgumentNullException( "text" );
+		if( format == nullptr )
+			throw gcnew ArgumentNullException( "format" );
+
+		Key key;
+		key.Text = text;
+		key.Format = format;
+		key.FormatVersion = format->Version;
+		key.MaxWidth = maxWidth;
+		key.MaxHeight = maxHeight;
+
+		LinkedListNode<Entry^>^ node;
+		if( m_Entries->TryGetValue( key, node ) )
+		{
+			// a layout disposed behind our back is treated as a miss and recreated
+			if( !node->Value->Layout->Disposed )
+			{
+				m_Order->Remove( node );
+				m_Order->AddFirst( node );
+				m_Hits++;
+				return node->Value;
+			}
+
+			Remove( node );
+		}
+
+		while( m_Entries->Count >= m_Capacity )
+		{
+			Remove( m_Order->Last );
+			m_Evictions++;
+		}
+
+		Entry^ entry = gcnew Entry();
+		entry->EntryKey = key;
+		entry->Layout = gcnew TextLayout( m_Factory, text, format, maxWidth, maxHeight );
+
+		m_Entries->Add( key, m_Order->AddFirst( entry ) );
+		m_Misses++;
+		return entry;
+	}
+
+	void TextLayoutCache::Remove( LinkedListNode<Entry^>^ node )
+	{
+		Entry^ entry = node->Value;
+		m_Entries->Remove( entry->EntryKey );
+		m_Order->Remove( node );
+
+		if( !entry->Layout->Disposed )
+			delete entry->Layout;
+	}
+
+	TextLayout^ TextLayoutCache::GetLayout( String^ text, TextFormat^ format, float maxWidth, float maxHeight )
+	{
+		return GetEntry( text, format, maxWidth, maxHeight )->Layout;
+	}
+
+	TextLayoutSnapshot^ TextLayoutCache::GetSnapshot( String^ text, TextFormat^ format, float maxWidth, float maxHeight )
+	{
+		Entry^ entry = GetEntry( text, format, maxWidth, maxHeight );
+		if( entry->Snapshot == nullptr )
+			entry->Snapshot = gcnew TextLayoutSnapshot( entry->Layout );
+
+		return entry->Snapshot;
+	}
+
+	int TextLayoutCache::Invalidate( TextFormat^ format )
+	{
+		int removed = 0;
+		LinkedListNode<Entry^>^ node = m_Order->First;
+		while( node != nullptr )
+		{
+			LinkedListNode<Entry^>^ next = node->Next;
+			if( Object::ReferenceEquals( node->Value->EntryKey.Format, format ) )
+			{
+				Remove( node );
+				removed++;
+			}
+
+			node = next;
+		}
+
+		return removed;
+	}
+
+	void TextLayoutCache::Clear()
+	{
+		while( m_Order->Count > 0 )
+			Remove( m_Order->Last );
+	}
+}
+}
@@ -0,0 +1,164 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "FactoryDW.h"
+#include "TextFormat.h"
+#include "TextLayout.h"
+#include "TextLayoutSnapshot.h"
+
+namespace SlimDX
+{
+	namespace DirectWrite
+	{
+		/// <summary>
+		/// Reuses <see cref="TextLayout"/> objects for text that is laid out repeatedly with the same format and layout box.
+		/// </summary>
+		/// <remarks>
+		/// Layouts are keyed by their text, format and maximum size, and the least recently used layout is disposed once
+		/// the cache is full. Changing a property of a cached format invalidates the layouts created from it. Layouts
+		/// returned by the cache remain owned by it and are only valid until they are evicted; they should not be
+		/// modified or disposed by the caller. The cache is not thread-safe.
+		/// </remarks>
+		public ref class TextLayoutCache sealed
+		{
+		private:
+			value class Key : System::IEquatable<Key>
+			{
+			public:
+				System::String^ Text;
+				TextFormat^ Format;
+				int FormatVersion;
+				float MaxWidth;
+				float MaxHeight;
+
+				virtual bool Equals( Key other );
+				virtual bool Equals( System::Object^ obj ) override;
+				virtual int GetHashCode() override;
+			};
+
+			ref class Entry
+			{
+			public:
+				Key EntryKey;
+				TextLayout^ Layout;
+				TextLayoutSnapshot^ Snapshot;
+			};
+
+			Factory^ m_Factory;
+			int m_Capacity;
+			System::Collections::Generic::Dictionary<Key, System::Collections::Generic::LinkedListNode<Entry^>^>^ m_Entries;
+			System::Collections::Generic::LinkedList<Entry^>^ m_Order;
+			int m_Hits;
+			int m_Misses;
+			int m_Evictions;
+
+			Entry^ GetEntry( System::String^ text, TextFormat^ format, float maxWidth, float maxHeight );
+			void Remove( System::Collections::Generic::LinkedListNode<Entry^>^ node );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="TextLayoutCache"/> class.
+			/// </summary>
+			/// <param name="factory">The factory used to create layouts.</param>
+			/// <param name="capacity">The maximum number of layouts held by the cache.</param>
+			TextLayoutCache( Factory^ factory, int capacity );
+
+			/// <summary>
+			/// Disposes every layout held by the cache.
+			/// </summary>
+			~TextLayoutCache();
+
+			/// <summary>
+			/// Gets a layout for the specified text, creating it if necessary.
+			/// </summary>
+			/// <param name="text">The text to lay out.</param>
+			/// <param name="format">The format applied to the text.</param>
+			/// <param name="maxWidth">The width of the layout box.</param>
+			/// <param name="maxHeight">The height of the layout box.</param>
+			/// <returns>The cached layout.</returns>
+			TextLayout^ GetLayout( System::String^ text, TextFormat^ format, float maxWidth, float maxHeight );
+
+			/// <summary>
+			/// Gets a snapshot of the metrics of the layout for the specified text, creating it if necessary.
+			/// </summary>
+			/// <param name="text">The text to lay out.</param>
+			/// <param name="format">The format applied to the text.</param>
+			/// <param name="maxWidth">The width of the layout box.</param>
+			/// <param name="maxHeight">The height of the layout box.</param>
+			/// <returns>The cached snapshot.</returns>
+			TextLayoutSnapshot^ GetSnapshot( System::String^ text, TextFormat^ format, float maxWidth, float maxHeight );
+
+			/// <summary>
+			/// Disposes every layout created from the specified format.
+			/// </summary>
+			/// <param name="format">The format whose layouts should be removed.</param>
+			/// <returns>The number of layouts removed.</returns>
+			int Invalidate( TextFormat^ format );
+
+			/// <summary>
+			/// Disposes every layout held by the cache. Call this when the fonts available to the cached formats change.
+			/// </summary>
+			void Clear();
+
+			/// <summary>
+			/// Gets the number of layouts held by the cache.
+			/// </summary>
+			property int Count
+			{
+				int get() { return m_Entries->Count; }
+			}
+
+			/// <summary>
+			/// Gets the maximum number of layouts held by the cache.
+			/// </summary>
+			property int Capacity
+			{
+				int get() { return m_Capacity; }
+			}
+
+			/// <summary>
+			/// Gets the number of requests that were satisfied by an existing layout.
+			/// </summary>
+			property int HitCount
+			{
+				int get() { return m_Hits; }
+			}
+
+			/// <summary>
+			/// Gets the number of requests that required a new layout to be created.
+			/// </summary>
+			property int MissCount
+			{
+				int get() { return m_Misses; }
+			}
+
+			/// <summary>
+			/// Gets the number of layouts disposed to make room for new ones.
+			/// </summary>
+			property int EvictionCount
+			{
+				int get() { return m_Evictions; }
+			}
+		};
+	}
+}
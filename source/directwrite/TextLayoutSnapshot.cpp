@@ -0,0 +1,236 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "TextLayout.h"
+#include "TextLayoutSnapshot.h"
+
+using namespace System;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+namespace DirectWrite
+{
+	TextLayoutSnapshot::TextLayoutSnapshot( TextLayout^ layout )
+	{
+		m_Lines = layout->GetLineMetrics();
+		m_Clusters = layout->GetClusterMetrics();
+		m_Metrics = layout->Metrics;
+
+		if( m_Lines == nullptr )
+			m_Lines = gcnew array<LineMetrics>( 0 );
+		if( m_Clusters == nullptr )
+			m_Clusters = gcnew array<ClusterMetrics>( 0 );
+
+		TextAlignment alignment = layout->TextAlignment;
+		m_IsHitTestingExact = layout->ReadingDirection == ReadingDirection::LeftToRight &&
+			layout->FlowDirection == FlowDirection::TopToBottom &&
+			m_Metrics.MaximumBidiReorderingDepth <= 1;
+
+		int lineCount = m_Lines->Length;
+		int clusterCount = m_Clusters->Length;
+
+		m_LineTops = gcnew array<float>( lineCount );
+		m_LineClusters = gcnew array<int>( lineCount + 1 );
+		m_ClusterLefts = gcnew array<float>( clusterCount );
+		m_ClusterPositions = gcnew array<int>( clusterCount + 1 );
+
+		int position = 0;
+		for( int i = 0; i < clusterCount; ++i )
+		{
+			m_ClusterPositions[i] = position;
+			position += m_Clusters[i].Length;
+
+			if( m_Clusters[i].IsRightToLeft )
+				m_IsHitTestingExact = false;
+		}
+		m_ClusterPositions[clusterCount] = position;
+
+		float top = m_Metrics.Top;
+		int lineEnd = 0;
+		int cluster = 0;
+		for( int i = 0; i < lineCount; ++i )
+		{
+			m_LineTops[i] = top;
+			top += m_Lines[i].Height;
+
+			lineEnd += m_Lines[i].Length;
+			m_LineClusters[i] = cluster;
+			while( cluster < clusterCount && m_ClusterPositions[cluster] < lineEnd )
+				++cluster;
+
+			// alignment applies to the line without its trailing whitespace
+			int first = m_LineClusters[i];
+			int last = cluster;
+			while( last > first && ( m_Clusters[last - 1].IsWhitespace || m_Clusters[last - 1].IsNewline ) )
+				--last;
+
+			float width = 0.0f;
+			for( int j = first; j < last; ++j )
+				width += m_Clusters[j].Width;
+
+			float left = 0.0f;
+			if( alignment == TextAlignment::Trailing )
+				left = m_Metrics.LayoutWidth - width;
+			else if( alignment == TextAlignment::Center )
+				left = ( m_Metrics.LayoutWidth - width ) * 0.5f;
+
+			for( int j = first; j < cluster; ++j )
+			{
+				m_ClusterLefts[j] = left;
+				left += m_Clusters[j].Width;
+			}
+		}
+		m_LineClusters[lineCount] = cluster;
+	}
+
+	ReadOnlyCollection<LineMetrics>^ TextLayoutSnapshot::Lines::get()
+	{
+		return Array::AsReadOnly( m_Lines );
+	}
+
+	ReadOnlyCollection<ClusterMetrics>^ TextLayoutSnapshot::Clusters::get()
+	{
+		return Array::AsReadOnly( m_Clusters );
+	}
+
+	int TextLayoutSnapshot::FindLineOfCluster( int cluster )
+	{
+		int low = 0;
+		int high = m_Lines->Length - 1;
+		while( low < high )
+		{
+			int middle = ( low + high + 1 ) / 2;
+			if( m_LineClusters[middle] <= cluster )
+				low = middle;
+			else
+				high = middle - 1;
+		}
+
+		return low;
+	}
+
+	HitTestMetrics TextLayoutSnapshot::GetClusterHitTestMetrics( int line, int cluster )
+	{
+		return HitTestMetrics( m_ClusterPositions[cluster], m_Clusters[cluster].Length, m_ClusterLefts[cluster], m_LineTops[line],
+			m_Clusters[cluster].Width, m_Lines[line].Height, 0, true, m_Lines[line].IsTrimmed );
+	}
+
+	HitTestMetrics TextLayoutSnapshot::HitTestTextPosition( int textPosition, bool isTrailingHit, [Out] float% pointX, [Out] float% pointY )
+	{
+		int clusterCount = m_Clusters->Length;
+		if( clusterCount == 0 || m_Lines->Length == 0 )
+		{
+			pointX = 0.0f;
+			pointY = m_Metrics.Top;
+			return HitTestMetrics();
+		}
+
+		// the last cluster whose first position is at or before the requested one
+		int low = 0;
+		int high = clusterCount - 1;
+		while( low < high )
+		{
+			int middle = ( low + high + 1 ) / 2;
+			if( m_ClusterPositions[middle] <= textPosition )
+				low = middle;
+			else
+				high = middle - 1;
+		}
+
+		int line = FindLineOfCluster( low );
+		HitTestMetrics result = GetClusterHitTestMetrics( line, low );
+
+		pointX = isTrailingHit ? result.Left + result.Width : result.Left;
+		pointY = result.Top;
+		return result;
+	}
+
+	HitTestMetrics TextLayoutSnapshot::HitTestPoint( float pointX, float pointY, [Out] bool% isTrailingHit, [Out] bool% isInside )
+	{
+		int lineCount = m_Lines->Length;
+		if( lineCount == 0 || m_Clusters->Length == 0 )
+		{
+			isTrailingHit = false;
+			isInside = false;
+			return HitTestMetrics();
+		}
+
+		bool inside = true;
+
+		int line = 0;
+		if( pointY < m_LineTops[0] )
+			inside = false;
+		else
+		{
+			while( line + 1 < lineCount && m_LineTops[line + 1] <= pointY )
+				++line;
+
+			if( pointY >= m_LineTops[line] + m_Lines[line].Height )
+				inside = false;
+		}
+
+		int first = m_LineClusters[line];
+		int last = m_LineClusters[line + 1] - 1;
+		if( last < first )
+		{
+			// an empty line still owns a position; report the start of the next cluster
+			isTrailingHit = false;
+			isInside = false;
+			return GetClusterHitTestMetrics( line, first < m_Clusters->Length ? first : m_Clusters->Length - 1 );
+		}
+
+		// a hit past the end of the line lands on the trailing edge of its last visible cluster
+		int lastVisible = last;
+		while( lastVisible > first && m_Clusters[lastVisible].IsNewline )
+			--lastVisible;
+
+		int cluster;
+		bool trailing;
+		if( pointX < m_ClusterLefts[first] )
+		{
+			cluster = first;
+			trailing = false;
+			inside = false;
+		}
+		else if( pointX >= m_ClusterLefts[lastVisible] + m_Clusters[lastVisible].Width )
+		{
+			cluster = lastVisible;
+			trailing = true;
+			inside = false;
+		}
+		else
+		{
+			cluster = first;
+			while( cluster < lastVisible && m_ClusterLefts[cluster + 1] <= pointX )
+				++cluster;
+
+			trailing = pointX >= m_ClusterLefts[cluster] + m_Clusters[cluster].Width * 0.5f;
+		}
+
+		isTrailingHit = trailing;
+		isInside = inside;
+		return GetClusterHitTestMetrics( line, cluster );
+	}
+}
+}
@@ -0,0 +1,107 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "ClusterMetrics.h"
+#include "HitTestMetrics.h"
+#include "LineMetrics.h"
+#include "TextMetrics.h"
+
+namespace SlimDX
+{
+	namespace DirectWrite
+	{
+		ref class TextLayout;
+
+		/// <summary>
+		/// An immutable copy of the line and cluster metrics of a <see cref="TextLayout"/>, used to answer
+		/// hit tests without calling into DirectWrite.
+		/// </summary>
+		/// <remarks>
+		/// Hit testing reconstructs cluster positions from their advances and the layout's text alignment. This matches
+		/// DirectWrite for horizontal left-to-right text; for other layouts <see cref="IsHitTestingExact"/> is <c>false</c>
+		/// and the layout's own hit testing methods should be used instead.
+		/// </remarks>
+		public ref class TextLayoutSnapshot sealed
+		{
+		private:
+			array<LineMetrics>^ m_Lines;
+			array<ClusterMetrics>^ m_Clusters;
+			TextMetrics m_Metrics;
+			bool m_IsHitTestingExact;
+
+			array<float>^ m_LineTops;
+			array<int>^ m_LineClusters;
+			array<float>^ m_ClusterLefts;
+			array<int>^ m_ClusterPositions;
+
+			int FindLineOfCluster( int cluster );
+			HitTestMetrics GetClusterHitTestMetrics( int line, int cluster );
+
+		internal:
+			TextLayoutSnapshot( TextLayout^ layout );
+
+		public:
+			/// <summary>
+			/// Gets the metrics of each line in the layout.
+			/// </summary>
+			property System::Collections::ObjectModel::ReadOnlyCollection<LineMetrics>^ Lines
+			{
+				System::Collections::ObjectModel::ReadOnlyCollection<LineMetrics>^ get();
+			}
+
+			/// <summary>
+			/// Gets the metrics of each glyph cluster in the layout.
+			/// </summary>
+			property System::Collections::ObjectModel::ReadOnlyCollection<ClusterMetrics>^ Clusters
+			{
+				System::Collections::ObjectModel::ReadOnlyCollection<ClusterMetrics>^ get();
+			}
+
+			/// <summary>
+			/// Gets the overall metrics of the layout.
+			/// </summary>
+			property TextMetrics Metrics
+			{
+				TextMetrics get() { return m_Metrics; }
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether hit tests on the snapshot match those of the layout.
+			/// </summary>
+			property bool IsHitTestingExact
+			{
+				bool get() { return m_IsHitTestingExact; }
+			}
+
+			/// <summary>
+			/// Determines the text position under a point relative to the layout box.
+			/// </summary>
+			HitTestMetrics HitTestPoint( float pointX, float pointY, [Out] bool% isTrailingHit, [Out] bool% isInside );
+
+			/// <summary>
+			/// Determines the location of a text position relative to the layout box.
+			/// </summary>
+			HitTestMetrics HitTestTextPosition( int textPosition, bool isTrailingHit, [Out] float% pointX, [Out] float% pointY );
+		};
+	}
+}
@@ -37,7 +37,7 @@ namespace DirectWrite
 	{
 		IDWriteTypography *typo = NULL;
 
-		HRESULT hr = factory->InternalPointer->CreateTypography( &typo );
+		HRESULT hr = TIME_CALL( factory->InternalPointer->CreateTypography( &typo ) );
 		if( RECORD_DW( hr ).IsFailure )
 			throw gcnew DirectWriteException( Result::Last );
 
@@ -50,7 +50,7 @@ namespace DirectWrite
 		ff.nameTag = static_cast<DWRITE_FONT_FEATURE_TAG>( feature.NameTag );
 		ff.parameter = feature.Value;
 
-		HRESULT hr = InternalPointer->AddFontFeature( ff );
+		HRESULT hr = TIME_CALL( InternalPointer->AddFontFeature( ff ) );
 		return RECORD_DW( hr );
 	}
 
@@ -58,7 +58,7 @@ namespace DirectWrite
 	{
 		FontFeature result;
 
-		HRESULT hr = InternalPointer->GetFontFeature( featureIndex, reinterpret_cast<DWRITE_FONT_FEATURE*>( &result ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetFontFeature( featureIndex, reinterpret_cast<DWRITE_FONT_FEATURE*>( &result ) ) );
 		RECORD_DW( hr );
 
 		return result;
@@ -21,6 +21,8 @@
 */
 #include "stdafx.h"
 
+#include "../Utilities.h"
+
 #include "Underline.h"
 
 using namespace System;
@@ -30,6 +32,11 @@ namespace SlimDX
 namespace DirectWrite
 {
 	Underline::Underline(const DWRITE_UNDERLINE &underline)
+	{
+		Assign(underline);
+	}
+
+	void Underline::Assign(const DWRITE_UNDERLINE &underline)
 	{
 		Width = underline.width;
 		Thickness = underline.thickness;
@@ -37,7 +44,7 @@ namespace DirectWrite
 		RunHeight = underline.runHeight;
 		ReadingDirection = static_cast<DirectWrite::ReadingDirection>(underline.readingDirection);
 		FlowDirection = static_cast<DirectWrite::FlowDirection>(underline.flowDirection);
-		LocaleName = gcnew String(underline.localeName);
+		LocaleName = Utilities::ReuseString(LocaleName, underline.localeName);
 		MeasuringMode = static_cast<DirectWrite::MeasuringMode>(underline.measuringMode);
 	}
 }
@@ -31,6 +31,7 @@ namespace SlimDX
 		{
 		internal:
 			Underline(const DWRITE_UNDERLINE &underline);
+			void Assign(const DWRITE_UNDERLINE &underline);
 
 		public:
 			property float Width;
@@ -0,0 +1,95 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "UnderlineView.h"
+
+using namespace System;
+
+namespace SlimDX
+{
+namespace DirectWrite
+{
+	UnderlineView::UnderlineView(const DWRITE_UNDERLINE *underline)
+		: m_Underline(underline)
+	{
+	}
+
+	const DWRITE_UNDERLINE &UnderlineView::GetUnderline()
+	{
+		if (m_Underline == NULL)
+			throw gcnew InvalidOperationException("The underline view is empty.");
+
+		return *m_Underline;
+	}
+
+	float UnderlineView::Width::get()
+	{
+		return GetUnderline().width;
+	}
+
+	float UnderlineView::Thickness::get()
+	{
+		return GetUnderline().thickness;
+	}
+
+	float UnderlineView::Offset::get()
+	{
+		return GetUnderline().offset;
+	}
+
+	float UnderlineView::RunHeight::get()
+	{
+		return GetUnderline().runHeight;
+	}
+
+	DirectWrite::ReadingDirection UnderlineView::ReadingDirection::get()
+	{
+		return static_cast<DirectWrite::ReadingDirection>(GetUnderline().readingDirection);
+	}
+
+	DirectWrite::FlowDirection UnderlineView::FlowDirection::get()
+	{
+		return static_cast<DirectWrite::FlowDirection>(GetUnderline().flowDirection);
+	}
+
+	IntPtr UnderlineView::LocaleNamePointer::get()
+	{
+		return IntPtr(const_cast<WCHAR*>(GetUnderline().localeName));
+	}
+
+	String^ UnderlineView::LocaleName::get()
+	{
+		return gcnew String(GetUnderline().localeName);
+	}
+
+	DirectWrite::MeasuringMode UnderlineView::MeasuringMode::get()
+	{
+		return static_cast<DirectWrite::MeasuringMode>(GetUnderline().measuringMode);
+	}
+
+	Underline^ UnderlineView::ToUnderline()
+	{
+		return gcnew Underline(GetUnderline());
+	}
+}
+}
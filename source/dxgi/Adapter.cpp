@@ -73,8 +73,7 @@ namespace DXGI
 	Output^ Adapter::GetOutput( int index )
 	{
 		IDXGIOutput* output = 0;
-		RECORD_DXGI( InternalPointer->EnumOutputs( index, &output) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( InternalPointer->EnumOutputs( index, &output) ).IsFailure )
 			return nullptr;
 		return Output::FromPointer( output, this );
 	}
@@ -35,7 +35,7 @@ namespace DXGI
 	AdapterDescription1 Adapter1::Description1::get()
 	{
 		DXGI_ADAPTER_DESC1 nativeDescription;
-		HRESULT hr = InternalPointer->GetDesc1( &nativeDescription );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDesc1( &nativeDescription ) );
 		if (RECORD_DXGI(hr).IsFailure)
 			return AdapterDescription1();
 
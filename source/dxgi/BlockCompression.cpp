@@ -0,0 +1,369 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "../DataStream.h"
+
+#include "BlockCompression.h"
+#include "BlockCompressionKernels.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace SlimDX
+{
+namespace DXGI
+{
+	// Tiles are square runs of blocks; large enough to amortize scheduling, small enough to balance.
+	const int TileSizeInBlocks = 16;
+
+	static bool TryGetBlockFormat( Format format, BlockFormat& result )
+	{
+		switch( format )
+		{
+		case Format::BC1_UNorm:
+		case Format::BC1_UNorm_SRGB:
+			result = BlockFormatBC1;
+			return true;
+
+		case Format::BC2_UNorm:
+		case Format::BC2_UNorm_SRGB:
+			result = BlockFormatBC2;
+			return true;
+
+		case Format::BC3_UNorm:
+		case Format::BC3_UNorm_SRGB:
+			result = BlockFormatBC3;
+			return true;
+
+		case Format::BC4_UNorm:
+			result = BlockFormatBC4UNorm;
+			return true;
+
+		case Format::BC4_SNorm:
+			result = BlockFormatBC4SNorm;
+			return true;
+
+		case Format::BC5_UNorm:
+			result = BlockFormatBC5UNorm;
+			return true;
+
+		case Format::BC5_SNorm:
+			result = BlockFormatBC5SNorm;
+			return true;
+
+		case Format::BC6_UFloat16:
+			result = BlockFormatBC6HUF16;
+			return true;
+
+		case Format::BC6_SFloat16:
+			result = BlockFormatBC6HSF16;
+			return true;
+
+		case Format::BC7_UNorm:
+		case Format::BC7_UNorm_SRGB:
+			result = BlockFormatBC7;
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	static BlockFormat GetBlockFormat( Format format )
+	{
+		BlockFormat result;
+		if( !TryGetBlockFormat( format, result ) )
+			throw gcnew ArgumentException( "The format is not a supported block compressed format.", "format" );
+
+		return result;
+	}
+
+	static void CheckBox( DataBox^ box, String^ name, int rowBytes, int rows )
+	{
+		if( box == nullptr )
+			throw gcnew ArgumentNullException( name );
+		if( box->RowPitch < rowBytes )
+			throw gcnew ArgumentException( "The row pitch is too small for the surface width.", name );
+		if( box->Data->RemainingLength < static_cast<Int64>( box->RowPitch ) * ( rows - 1 ) + rowBytes )
+			throw gcnew ArgumentException( "The data stream is too small for the surface.", name );
+	}
+
+	ref class BlockCompressionWorker
+	{
+	private:
+		ManualResetEvent^ m_Done;
+		Exception^ m_Error;
+		int m_NextTile;
+		int m_Pending;
+		int m_TilesX;
+		int m_TileCount;
+
+		BlockFormat m_Format;
+		BlockQuality m_Quality;
+		bool m_Compress;
+		const unsigned char* m_Source;
+		int m_SourcePitch;
+		unsigned char* m_Destination;
+		int m_DestinationPitch;
+		int m_Width;
+		int m_Height;
+		int m_BlocksX;
+		int m_BlocksY;
+
+		void Execute( Object^ )
+		{
+			try
+			{
+				for( int tile = Interlocked::Increment( m_NextTile ); tile < m_TileCount; tile = Interlocked::Increment( m_NextTile ) )
+				{
+					int firstBlockX = ( tile % m_TilesX ) * TileSizeInBlocks;
+					int firstBlockY = ( tile / m_TilesX ) * TileSizeInBlocks;
+					int lastBlockX = firstBlockX + TileSizeInBlocks < m_BlocksX ? firstBlockX + TileSizeInBlocks : m_BlocksX;
+					int lastBlockY = firstBlockY + TileSizeInBlocks < m_BlocksY ? firstBlockY + TileSizeInBlocks : m_BlocksY;
+
+					if( m_Compress )
+					{
+						CompressBlocks( m_Format, m_Quality, m_Source, m_SourcePitch, m_Width, m_Height,
+							m_Destination, m_DestinationPitch, firstBlockX, firstBlockY, lastBlockX, lastBlockY );
+					}
+					else
+					{
+						DecompressBlocks( m_Format, m_Source, m_SourcePitch, m_Width, m_Height,
+							m_Destination, m_DestinationPitch, firstBlockX, firstBlockY, lastBlockX, lastBlockY );
+					}
+				}
+			}
+			catch( Exception^ e )
+			{
+				// an exception escaping a pool thread would end the process, so the first one is rethrown by Run instead
+				Interlocked::CompareExchange<Exception^>( m_Error, e, nullptr );
+				Interlocked::Exchange( m_NextTile, m_TileCount );
+			}
+			finally
+			{
+				if( Interlocked::Decrement( m_Pending ) == 0 && m_Done != nullptr )
+					m_Done->Set();
+			}
+		}
+
+	public:
+		BlockCompressionWorker( BlockFormat format, BlockQuality quality, bool compress, const unsigned char* source, int sourcePitch,
+			unsigned char* destination, int destinationPitch, int width, int height )
+		{
+			m_Format = format;
+			m_Quality = quality;
+			m_Compress = compress;
+			m_Source = source;
+			m_SourcePitch = sourcePitch;
+			m_Destination = destination;
+			m_DestinationPitch = destinationPitch;
+			m_Width = width;
+			m_Height = height;
+			m_BlocksX = ( width + 3 ) / 4;
+			m_BlocksY = ( height + 3 ) / 4;
+
+			m_TilesX = ( m_BlocksX + TileSizeInBlocks - 1 ) / TileSizeInBlocks;
+			m_TileCount = m_TilesX * ( ( m_BlocksY + TileSizeInBlocks - 1 ) / TileSizeInBlocks );
+		}
+
+		void Run( int maximumThreads )
+		{
+			int threads = maximumThreads < m_TileCount ? maximumThreads : m_TileCount;
+			m_NextTile = -1;
+			m_Pending = threads;
+			m_Done = nullptr;
+			m_Error = nullptr;
+
+			if( threads > 1 )
+			{
+				m_Done = gcnew ManualResetEvent( false );
+
+				WaitCallback^ callback = gcnew WaitCallback( this, &BlockCompressionWorker::Execute );
+				for( int i = 1; i < threads; ++i )
+					ThreadPool::QueueUserWorkItem( callback );
+			}
+
+			try
+			{
+				// the calling thread takes tiles as well instead of idling
+				Execute( nullptr );
+			}
+			finally
+			{
+				// the workers write into memory owned by our caller, so they must finish before we return or throw
+				if( m_Done != nullptr )
+				{
+					m_Done->WaitOne();
+					m_Done->Close();
+				}
+			}
+
+			if( m_Error != nullptr )
+				throw m_Error;
+		}
+	};
+
+	static BlockCompression::BlockCompression()
+	{
+		m_MaximumDegreeOfParallelism = Environment::ProcessorCount;
+	}
+
+	BlockCompression::BlockCompression()
+	{
+	}
+
+	bool BlockCompression::IsSupported( Format format )
+	{
+		BlockFormat blockFormat;
+		return TryGetBlockFormat( format, blockFormat );
+	}
+
+	Format BlockCompression::GetUncompressedFormat( Format format )
+	{
+		switch( format )
+		{
+		case Format::BC1_UNorm_SRGB:
+		case Format::BC2_UNorm_SRGB:
+		case Format::BC3_UNorm_SRGB:
+		case Format::BC7_UNorm_SRGB:
+			return Format::R8G8B8A8_UNorm_SRGB;
+
+		case Format::BC4_UNorm:
+			return Format::R8_UNorm;
+
+		case Format::BC4_SNorm:
+			return Format::R8_SNorm;
+
+		case Format::BC5_UNorm:
+			return Format::R8G8_UNorm;
+
+		case Format::BC5_SNorm:
+			return Format::R8G8_SNorm;
+
+		case Format::BC6_UFloat16:
+		case Format::BC6_SFloat16:
+			return Format::R16G16B16A16_Float;
+
+		case Format::BC1_UNorm:
+		case Format::BC2_UNorm:
+		case Format::BC3_UNorm:
+		case Format::BC7_UNorm:
+			return Format::R8G8B8A8_UNorm;
+
+		default:
+			throw gcnew ArgumentException( "The format is not a supported block compressed format.", "format" );
+		}
+	}
+
+	int BlockCompression::GetRowPitch( Format format, int width )
+	{
+		if( width <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "width", "Width must be greater than zero." );
+
+		return ( ( width + 3 ) / 4 ) * GetBlockSize( GetBlockFormat( format ) );
+	}
+
+	void BlockCompression::MaximumDegreeOfParallelism::set( int value )
+	{
+		if( value <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "value", "The degree of parallelism must be greater than zero." );
+
+		m_MaximumDegreeOfParallelism = value;
+	}
+
+	void BlockCompression::Run( Format format, BlockCompressionQuality quality, DataBox^ source, int width, int height, DataBox^ destination, bool compress )
+	{
+		if( width <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "width", "Width must be greater than zero." );
+		if( height <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "height", "Height must be greater than zero." );
+		if( quality < BlockCompressionQuality::Fast || quality > BlockCompressionQuality::High )
+			throw gcnew ArgumentOutOfRangeException( "quality" );
+
+		BlockFormat blockFormat = GetBlockFormat( format );
+		int blockRowBytes = ( ( width + 3 ) / 4 ) * GetBlockSize( blockFormat );
+		int blockRows = ( height + 3 ) / 4;
+		int pixelRowBytes = width * GetUncompressedPixelSize( blockFormat );
+
+		if( compress )
+		{
+			CheckBox( source, "source", pixelRowBytes, height );
+			CheckBox( destination, "destination", blockRowBytes, blockRows );
+		}
+		else
+		{
+			CheckBox( source, "source", blockRowBytes, blockRows );
+			CheckBox( destination, "destination", pixelRowBytes, height );
+		}
+
+		BlockCompressionWorker^ worker = gcnew BlockCompressionWorker( blockFormat, static_cast<BlockQuality>( static_cast<int>( quality ) ), compress,
+			reinterpret_cast<const unsigned char*>( source->Data->PositionPointer ), source->RowPitch,
+			reinterpret_cast<unsigned char*>( destination->Data->PositionPointer ), destination->RowPitch, width, height );
+
+		worker->Run( m_MaximumDegreeOfParallelism );
+	}
+
+	DataBox^ BlockCompression::Compress( DataBox^ source, int width, int height, Format format )
+	{
+		return Compress( source, width, height, format, BlockCompressionQuality::Normal );
+	}
+
+	DataBox^ BlockCompression::Compress( DataBox^ source, int width, int height, Format format, BlockCompressionQuality quality )
+	{
+		int rowPitch = GetRowPitch( format, width );
+		if( height <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "height", "Height must be greater than zero." );
+
+		int slicePitch = rowPitch * ( ( height + 3 ) / 4 );
+		DataBox^ destination = gcnew DataBox( rowPitch, slicePitch, gcnew DataStream( slicePitch, true, true ) );
+
+		Run( format, quality, source, width, height, destination, true );
+		return destination;
+	}
+
+	void BlockCompression::Compress( DataBox^ source, int width, int height, Format format, BlockCompressionQuality quality, DataBox^ destination )
+	{
+		Run( format, quality, source, width, height, destination, true );
+	}
+
+	DataBox^ BlockCompression::Decompress( DataBox^ source, int width, int height, Format format )
+	{
+		if( width <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "width", "Width must be greater than zero." );
+		if( height <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "height", "Height must be greater than zero." );
+
+		int rowPitch = width * GetUncompressedPixelSize( GetBlockFormat( format ) );
+		int slicePitch = rowPitch * height;
+		DataBox^ destination = gcnew DataBox( rowPitch, slicePitch, gcnew DataStream( slicePitch, true, true ) );
+
+		Run( format, BlockCompressionQuality::Normal, source, width, height, destination, false );
+		return destination;
+	}
+
+	void BlockCompression::Decompress( DataBox^ source, int width, int height, Format format, DataBox^ destination )
+	{
+		Run( format, BlockCompressionQuality::Normal, source, width, height, destination, false );
+	}
+}
+}
@@ -0,0 +1,160 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../DataBox.h"
+
+#include "Enums.h"
+
+namespace SlimDX
+{
+	namespace DXGI
+	{
+		/// <summary>
+		/// Controls how much effort <see cref="BlockCompression"/> spends searching for the best encoding of each block.
+		/// </summary>
+		/// <unmanaged>None</unmanaged>
+		public enum class BlockCompressionQuality : System::Int32
+		{
+			/// <summary>
+			/// Uses the best fit line of each block without refinement. BC7 is restricted to mode 6.
+			/// </summary>
+			Fast,
+
+			/// <summary>
+			/// Refines endpoints once and searches the most likely BC7 partition.
+			/// </summary>
+			Normal,
+
+			/// <summary>
+			/// Refines endpoints repeatedly and searches every BC7 mode, several partitions and all channel rotations.
+			/// </summary>
+			High
+		};
+
+		/// <summary>
+		/// Encodes and decodes block compressed (BC1 through BC7) surfaces on the CPU, without requiring a device.
+		/// </summary>
+		/// <remarks>
+		/// Uncompressed data is laid out as <see cref="Format">R8G8B8A8_UNorm</see> for BC1, BC2, BC3 and BC7,
+		/// <see cref="Format">R8_UNorm</see> or <see cref="Format">R8_SNorm</see> for BC4,
+		/// <see cref="Format">R8G8_UNorm</see> or <see cref="Format">R8G8_SNorm</see> for BC5 and
+		/// <see cref="Format">R16G16B16A16_Float</see> for BC6H; see <see cref="GetUncompressedFormat"/>.
+		/// Surfaces are split into tiles that are processed on up to <see cref="MaximumDegreeOfParallelism"/> threads.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class BlockCompression sealed
+		{
+		private:
+			static int m_MaximumDegreeOfParallelism;
+
+			static BlockCompression();
+			BlockCompression();
+
+			static void Run( Format format, BlockCompressionQuality quality, DataBox^ source, int width, int height, DataBox^ destination, bool compress );
+
+		public:
+			/// <summary>
+			/// Determines whether the specified format can be encoded and decoded by <see cref="BlockCompression"/>.
+			/// </summary>
+			/// <param name="format">The format to check.</param>
+			/// <returns><c>true</c> if the format is a supported block compressed format; otherwise, <c>false</c>.</returns>
+			static bool IsSupported( Format format );
+
+			/// <summary>
+			/// Gets the uncompressed format that a block compressed format is encoded from and decoded to.
+			/// </summary>
+			/// <param name="format">A supported block compressed format.</param>
+			/// <returns>The matching uncompressed format.</returns>
+			static Format GetUncompressedFormat( Format format );
+
+			/// <summary>
+			/// Gets the row pitch, in bytes, of a surface in a block compressed format.
+			/// </summary>
+			/// <param name="format">A supported block compressed format.</param>
+			/// <param name="width">The width of the surface, in pixels.</param>
+			/// <returns>The number of bytes in one row of blocks.</returns>
+			static int GetRowPitch( Format format, int width );
+
+			/// <summary>
+			/// Compresses a surface using <see cref="BlockCompressionQuality">Normal</see> quality.
+			/// </summary>
+			/// <param name="source">The uncompressed surface.</param>
+			/// <param name="width">The width of the surface, in pixels.</param>
+			/// <param name="height">The height of the surface, in pixels.</param>
+			/// <param name="format">The block compressed format to produce.</param>
+			/// <returns>A new box holding the compressed surface.</returns>
+			static DataBox^ Compress( DataBox^ source, int width, int height, Format format );
+
+			/// <summary>
+			/// Compresses a surface.
+			/// </summary>
+			/// <param name="source">The uncompressed surface.</param>
+			/// <param name="width">The width of the surface, in pixels.</param>
+			/// <param name="height">The height of the surface, in pixels.</param>
+			/// <param name="format">The block compressed format to produce.</param>
+			/// <param name="quality">The effort spent on each block.</param>
+			/// <returns>A new box holding the compressed surface.</returns>
+			static DataBox^ Compress( DataBox^ source, int width, int height, Format format, BlockCompressionQuality quality );
+
+			/// <summary>
+			/// Compresses a surface into existing storage.
+			/// </summary>
+			/// <param name="source">The uncompressed surface.</param>
+			/// <param name="width">The width of the surface, in pixels.</param>
+			/// <param name="height">The height of the surface, in pixels.</param>
+			/// <param name="format">The block compressed format to produce.</param>
+			/// <param name="quality">The effort spent on each block.</param>
+			/// <param name="destination">The box that receives the compressed blocks; its row pitch is the distance between rows of blocks.</param>
+			static void Compress( DataBox^ source, int width, int height, Format format, BlockCompressionQuality quality, DataBox^ destination );
+
+			/// <summary>
+			/// Decompresses a surface.
+			/// </summary>
+			/// <param name="source">The compressed surface; its row pitch is the distance between rows of blocks.</param>
+			/// <param name="width">The width of the surface, in pixels.</param>
+			/// <param name="height">The height of the surface, in pixels.</param>
+			/// <param name="format">The block compressed format of the source.</param>
+			/// <returns>A new box holding the surface in the format given by <see cref="GetUncompressedFormat"/>.</returns>
+			static DataBox^ Decompress( DataBox^ source, int width, int height, Format format );
+
+			/// <summary>
+			/// Decompresses a surface into existing storage.
+			/// </summary>
+			/// <param name="source">The compressed surface; its row pitch is the distance between rows of blocks.</param>
+			/// <param name="width">The width of the surface, in pixels.</param>
+			/// <param name="height">The height of the surface, in pixels.</param>
+			/// <param name="format">The block compressed format of the source.</param>
+			/// <param name="destination">The box that receives the surface in the format given by <see cref="GetUncompressedFormat"/>.</param>
+			static void Decompress( DataBox^ source, int width, int height, Format format, DataBox^ destination );
+
+			/// <summary>
+			/// Gets or sets the maximum number of threads used to process a surface. The default is the number of processors.
+			/// </summary>
+			static property int MaximumDegreeOfParallelism
+			{
+				int get() { return m_MaximumDegreeOfParallelism; }
+				void set( int value );
+			}
+		};
+	}
+}
@@ -0,0 +1,2081 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <math.h>
+#include <string.h>
+
+#include "BlockCompressionKernels.h"
+
+// The kernels are compiled as native code; they are called in tight loops from worker
+// threads and gain nothing from running as IL.
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace DXGI
+{
+	namespace
+	{
+		// Bit i is the subset of pixel i.
+		const unsigned short Partitions2[64] =
+		{
+			0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+			0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+			0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+			0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+			0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+			0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+			0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+			0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+		};
+
+		const unsigned char Partitions3[64][16] =
+		{
+			{ 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2 },
+			{ 0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1 },
+			{ 0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1 },
+			{ 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1 },
+			{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2 },
+			{ 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2 },
+			{ 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 },
+			{ 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1 },
+			{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2 },
+			{ 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2 },
+			{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2 },
+			{ 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2 },
+			{ 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2 },
+			{ 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2 },
+			{ 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2 },
+			{ 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0 },
+			{ 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2 },
+			{ 0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0 },
+			{ 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2 },
+			{ 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1 },
+			{ 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2 },
+			{ 0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1 },
+			{ 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2 },
+			{ 0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0 },
+			{ 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0 },
+			{ 0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2 },
+			{ 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0 },
+			{ 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1 },
+			{ 0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2 },
+			{ 0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2 },
+			{ 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1 },
+			{ 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1 },
+			{ 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2 },
+			{ 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1 },
+			{ 0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2 },
+			{ 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0 },
+			{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0 },
+			{ 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0 },
+			{ 0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0 },
+			{ 0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1 },
+			{ 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1 },
+			{ 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2 },
+			{ 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1 },
+			{ 0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2 },
+			{ 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1 },
+			{ 0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1 },
+			{ 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1 },
+			{ 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1 },
+			{ 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2 },
+			{ 0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1 },
+			{ 0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2 },
+			{ 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2 },
+			{ 0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2 },
+			{ 0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2 },
+			{ 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2 },
+			{ 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2 },
+			{ 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2 },
+			{ 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2 },
+			{ 0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2 },
+			{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2 },
+			{ 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1 },
+			{ 0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2 },
+			{ 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 },
+			{ 0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0 }
+		};
+
+		// The pixel whose index drops its top bit in the second and third subsets.
+		const unsigned char Anchors2[64] =
+		{
+			15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+			15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+			15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+			6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15
+		};
+
+		const unsigned char Anchors3Second[64] =
+		{
+			3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3,
+			3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+			8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15,
+			3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3
+		};
+
+		const unsigned char Anchors3Third[64] =
+		{
+			15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8,
+			15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+			15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8,
+			15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8
+		};
+
+		const int Weights2[4] = { 0, 21, 43, 64 };
+		const int Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+		const int Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		const float MaximumError = 3.4e38f;
+
+		struct BC7Mode
+		{
+			int Subsets;
+			int PartitionBits;
+			int RotationBits;
+			int IndexSelectionBits;
+			int ColorBits;
+			int AlphaBits;
+			int EndpointPBits;
+			int SharedPBits;
+			int IndexBits;
+			int SecondaryIndexBits;
+		};
+
+		const BC7Mode BC7Modes[8] =
+		{
+			{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+			{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+			{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+			{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+			{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+			{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+			{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+			{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 }
+		};
+
+		// Header fields of a BC6H mode. Each layout byte names the field (high nibble) and the bit
+		// within that field (low nibble) stored at that position of the header; fields 0-11 are the
+		// R, G and B channels of the four endpoints and field 12 is the partition.
+		struct BC6HMode
+		{
+			int Code;
+			int ModeBits;
+			bool Transformed;
+			int Regions;
+			int EndpointBits;
+			int DeltaBits[3];
+			int HeaderBits;
+			unsigned char Layout[80];
+		};
+
+		const BC6HMode BC6HModes[14] =
+		{
+		{ 0x00, 2, true, 2, 10, { 5, 5, 5 }, 80,
+		  { 0x74, 0x84, 0xB4, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+		    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+		    0x29, 0x30, 0x31, 0x32, 0x33, 0x34, 0xA4, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44,
+		    0xB0, 0xA0, 0xA1, 0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0xB1, 0x80, 0x81, 0x82, 0x83, 0x60,
+		    0x61, 0x62, 0x63, 0x64, 0xB2, 0x90, 0x91, 0x92, 0x93, 0x94, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x01, 2, true, 2, 7, { 6, 6, 6 }, 80,
+		  { 0x75, 0xA4, 0xA5, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0xB0, 0xB1, 0x84, 0x10, 0x11, 0x12,
+		    0x13, 0x14, 0x15, 0x16, 0x85, 0xB2, 0x74, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0xB3, 0xB5,
+		    0xB4, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44,
+		    0x45, 0xA0, 0xA1, 0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x80, 0x81, 0x82, 0x83, 0x60,
+		    0x61, 0x62, 0x63, 0x64, 0x65, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x02, 5, true, 2, 11, { 5, 4, 4 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0x0A, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x1A, 0xB0, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x2A, 0xB1, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0x64, 0xB2, 0x90, 0x91, 0x92, 0x93, 0x94, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x06, 5, true, 2, 11, { 4, 5, 4 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x0A, 0xA4, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44, 0x1A, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x2A, 0xB1, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0xB0, 0xB2, 0x90, 0x91, 0x92, 0x93, 0x74, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x0A, 5, true, 2, 11, { 4, 4, 5 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x0A, 0x84, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x1A, 0xB0, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0x2A, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0xB1, 0xB2, 0x90, 0x91, 0x92, 0x93, 0xB4, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x0E, 5, true, 2, 9, { 5, 5, 5 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x84, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x74, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0xB4, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0xA4, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44, 0xB0, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0xB1, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0x64, 0xB2, 0x90, 0x91, 0x92, 0x93, 0x94, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x12, 5, true, 2, 8, { 6, 5, 5 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xA4, 0x84, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0xB2, 0x74, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0xB3, 0xB4, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0x35, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44, 0xB0, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0xB1, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0x64, 0x65, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x16, 5, true, 2, 8, { 5, 6, 5 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xB0, 0x84, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x75, 0x74, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0xA5, 0xB4, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0xA4, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0xB1, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0x64, 0xB2, 0x90, 0x91, 0x92, 0x93, 0x94, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x1A, 5, true, 2, 8, { 5, 5, 6 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xB1, 0x84, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x85, 0x74, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0xB5, 0xB4, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0xA4, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44, 0xB0, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0x64, 0xB2, 0x90, 0x91, 0x92, 0x93, 0x94, 0xB3, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x1E, 5, false, 2, 6, { 6, 6, 6 }, 77,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0xA4, 0xB0, 0xB1, 0x84, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x75, 0x85, 0xB2, 0x74, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0xA5, 0xB3, 0xB5, 0xB4, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0x35, 0x70, 0x71, 0x72, 0x73, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0xA0, 0xA1,
+		    0xA2, 0xA3, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x80, 0x81, 0x82, 0x83, 0x60, 0x61, 0x62, 0x63,
+		    0x64, 0x65, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4 } },
+		{ 0x03, 5, false, 1, 10, { 10, 10, 10 }, 60,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+		    0x48, 0x49, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59 } },
+		{ 0x07, 5, true, 1, 11, { 9, 9, 9 }, 60,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x0A, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+		    0x48, 0x1A, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x2A } },
+		{ 0x0B, 5, true, 1, 12, { 8, 8, 8 }, 60,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x0B, 0x0A, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+		    0x1B, 0x1A, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x2B, 0x2A } },
+		{ 0x0F, 5, true, 1, 16, { 4, 4, 4 }, 60,
+		  { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+		    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+		    0x32, 0x33, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x40, 0x41, 0x42, 0x43, 0x1F, 0x1E, 0x1D, 0x1C,
+		    0x1B, 0x1A, 0x50, 0x51, 0x52, 0x53, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A } }
+		};
+
+		const int BC6HPartitionField = 12;
+		const unsigned short HalfOne = 0x3C00;
+
+		class BitReader
+		{
+		private:
+			const unsigned char* m_Data;
+			int m_Position;
+
+		public:
+			BitReader( const unsigned char* data ) : m_Data( data ), m_Position( 0 )
+			{
+			}
+
+			int Read( int count )
+			{
+				int result = 0;
+				for( int i = 0; i < count; ++i, ++m_Position )
+					result |= ( ( m_Data[m_Position >> 3] >> ( m_Position & 7 ) ) & 1 ) << i;
+				return result;
+			}
+		};
+
+		class BitWriter
+		{
+		private:
+			unsigned char* m_Data;
+			int m_Position;
+
+		public:
+			BitWriter( unsigned char* data ) : m_Data( data ), m_Position( 0 )
+			{
+				memset( data, 0, 16 );
+			}
+
+			void Write( int value, int count )
+			{
+				for( int i = 0; i < count; ++i, ++m_Position )
+				{
+					if( ( value >> i ) & 1 )
+						m_Data[m_Position >> 3] |= static_cast<unsigned char>( 1 << ( m_Position & 7 ) );
+				}
+			}
+		};
+
+		int Clamp( int value, int low, int high )
+		{
+			return value < low ? low : ( value > high ? high : value );
+		}
+
+		float Clamp( float value, float low, float high )
+		{
+			return value < low ? low : ( value > high ? high : value );
+		}
+
+		int Round( float value )
+		{
+			return static_cast<int>( floor( value + 0.5f ) );
+		}
+
+		int Interpolate( int first, int second, int weight )
+		{
+			return ( first * ( 64 - weight ) + second * weight + 32 ) >> 6;
+		}
+
+		const int* GetWeights( int indexBits )
+		{
+			return indexBits == 2 ? Weights2 : ( indexBits == 3 ? Weights3 : Weights4 );
+		}
+
+		int GetSubset( int subsets, int partition, int pixel )
+		{
+			if( subsets == 2 )
+				return ( Partitions2[partition] >> pixel ) & 1;
+			if( subsets == 3 )
+				return Partitions3[partition][pixel];
+			return 0;
+		}
+
+		int GetAnchor( int subsets, int partition, int subset )
+		{
+			if( subset == 0 )
+				return 0;
+			if( subsets == 2 )
+				return Anchors2[partition];
+			return subset == 1 ? Anchors3Second[partition] : Anchors3Third[partition];
+		}
+
+		bool IsAnchor( int subsets, int partition, int pixel )
+		{
+			for( int subset = 0; subset < subsets; ++subset )
+			{
+				if( GetAnchor( subsets, partition, subset ) == pixel )
+					return true;
+			}
+
+			return false;
+		}
+
+		// Finds the mean of a set of points and the direction along which they vary the most.
+		// The direction is zero when all points are equal.
+		void FitLine( const float (*points)[4], const int* pixels, int count, int firstChannel, int channels, float* mean, float* axis )
+		{
+			float covariance[4][4];
+			memset( covariance, 0, sizeof( covariance ) );
+
+			for( int c = 0; c < 4; ++c )
+			{
+				mean[c] = 0.0f;
+				axis[c] = 0.0f;
+			}
+
+			for( int i = 0; i < count; ++i )
+			{
+				for( int c = firstChannel; c < firstChannel + channels; ++c )
+					mean[c] += points[pixels[i]][c];
+			}
+
+			for( int c = firstChannel; c < firstChannel + channels; ++c )
+				mean[c] /= count;
+
+			for( int i = 0; i < count; ++i )
+			{
+				for( int a = firstChannel; a < firstChannel + channels; ++a )
+				{
+					for( int b = firstChannel; b < firstChannel + channels; ++b )
+						covariance[a][b] += ( points[pixels[i]][a] - mean[a] ) * ( points[pixels[i]][b] - mean[b] );
+				}
+			}
+
+			// start from the channel with the largest spread, then refine with power iteration
+			int largest = firstChannel;
+			for( int c = firstChannel; c < firstChannel + channels; ++c )
+			{
+				if( covariance[c][c] > covariance[largest][largest] )
+					largest = c;
+			}
+
+			if( covariance[largest][largest] <= 0.0f )
+				return;
+
+			for( int c = firstChannel; c < firstChannel + channels; ++c )
+				axis[c] = covariance[largest][c];
+
+			for( int iteration = 0; iteration < 8; ++iteration )
+			{
+				float next[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				float scale = 0.0f;
+
+				for( int a = firstChannel; a < firstChannel + channels; ++a )
+				{
+					for( int b = firstChannel; b < firstChannel + channels; ++b )
+						next[a] += covariance[a][b] * axis[b];
+
+					scale = fabs( next[a] ) > scale ? fabs( next[a] ) : scale;
+				}
+
+				if( scale <= 0.0f )
+					break;
+
+				for( int c = firstChannel; c < firstChannel + channels; ++c )
+					axis[c] = next[c] / scale;
+			}
+
+			float length = 0.0f;
+			for( int c = firstChannel; c < firstChannel + channels; ++c )
+				length += axis[c] * axis[c];
+
+			length = sqrt( length );
+			for( int c = firstChannel; c < firstChannel + channels; ++c )
+				axis[c] = length > 0.0f ? axis[c] / length : 0.0f;
+		}
+
+		// Places the two endpoints at the extremes of the points projected onto their best fit line.
+		void GetLineEndpoints( const float (*points)[4], const int* pixels, int count, int firstChannel, int channels, float* first, float* second )
+		{
+			float mean[4];
+			float axis[4];
+			FitLine( points, pixels, count, firstChannel, channels, mean, axis );
+
+			float low = 0.0f;
+			float high = 0.0f;
+			for( int i = 0; i < count; ++i )
+			{
+				float t = 0.0f;
+				for( int c = firstChannel; c < firstChannel + channels; ++c )
+					t += ( points[pixels[i]][c] - mean[c] ) * axis[c];
+
+				low = t < low ? t : low;
+				high = t > high ? t : high;
+			}
+
+			for( int c = 0; c < 4; ++c )
+			{
+				first[c] = mean[c] + axis[c] * low;
+				second[c] = mean[c] + axis[c] * high;
+			}
+		}
+
+		// Solves for the endpoints that minimise the squared error given the interpolation
+		// weight (0 for the first endpoint, 1 for the second) that each pixel uses.
+		bool SolveEndpoints( const float (*points)[4], const int* pixels, int count, int firstChannel, int channels,
+			const float* weights, float* first, float* second )
+		{
+			float aa = 0.0f;
+			float ab = 0.0f;
+			float bb = 0.0f;
+			float ax[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			float bx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+			for( int i = 0; i < count; ++i )
+			{
+				float b = weights[i];
+				float a = 1.0f - b;
+
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+
+				for( int c = firstChannel; c < firstChannel + channels; ++c )
+				{
+					ax[c] += a * points[pixels[i]][c];
+					bx[c] += b * points[pixels[i]][c];
+				}
+			}
+
+			float determinant = aa * bb - ab * ab;
+			if( fabs( determinant ) < 1e-6f )
+				return false;
+
+			for( int c = firstChannel; c < firstChannel + channels; ++c )
+			{
+				first[c] = ( ax[c] * bb - bx[c] * ab ) / determinant;
+				second[c] = ( bx[c] * aa - ax[c] * ab ) / determinant;
+			}
+
+			return true;
+		}
+
+		int GetIterations( BlockQuality quality )
+		{
+			return quality == BlockQualityFast ? 0 : ( quality == BlockQualityNormal ? 1 : 4 );
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// BC1, BC2 and BC3 colour
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		int Pack565( const float* color )
+		{
+			int r = Clamp( Round( color[0] * 31.0f / 255.0f ), 0, 31 );
+			int g = Clamp( Round( color[1] * 63.0f / 255.0f ), 0, 63 );
+			int b = Clamp( Round( color[2] * 31.0f / 255.0f ), 0, 31 );
+			return ( r << 11 ) | ( g << 5 ) | b;
+		}
+
+		void Unpack565( int value, int* color )
+		{
+			int r = ( value >> 11 ) & 31;
+			int g = ( value >> 5 ) & 63;
+			int b = value & 31;
+
+			color[0] = ( r << 3 ) | ( r >> 2 );
+			color[1] = ( g << 2 ) | ( g >> 4 );
+			color[2] = ( b << 3 ) | ( b >> 2 );
+			color[3] = 255;
+		}
+
+		void GetColorPalette( int first, int second, bool fourColor, int (*palette)[4] )
+		{
+			Unpack565( first, palette[0] );
+			Unpack565( second, palette[1] );
+
+			for( int c = 0; c < 3; ++c )
+			{
+				if( fourColor )
+				{
+					palette[2][c] = ( 2 * palette[0][c] + palette[1][c] + 1 ) / 3;
+					palette[3][c] = ( palette[0][c] + 2 * palette[1][c] + 1 ) / 3;
+				}
+				else
+				{
+					palette[2][c] = ( palette[0][c] + palette[1][c] + 1 ) / 2;
+					palette[3][c] = 0;
+				}
+			}
+
+			palette[2][3] = 255;
+			palette[3][3] = fourColor ? 255 : 0;
+		}
+
+		void DecodeColorBlock( const unsigned char* block, unsigned char* rgba, bool allowThreeColor )
+		{
+			int first = block[0] | ( block[1] << 8 );
+			int second = block[2] | ( block[3] << 8 );
+			unsigned int indices = block[4] | ( block[5] << 8 ) | ( block[6] << 16 ) | ( static_cast<unsigned int>( block[7] ) << 24 );
+
+			int palette[4][4];
+			GetColorPalette( first, second, first > second || !allowThreeColor, palette );
+
+			for( int i = 0; i < 16; ++i )
+			{
+				const int* color = palette[( indices >> ( i * 2 ) ) & 3];
+				for( int c = 0; c < 4; ++c )
+					rgba[i * 4 + c] = static_cast<unsigned char>( color[c] );
+			}
+		}
+
+		struct ColorFit
+		{
+			int First;
+			int Second;
+			int Indices[16];
+			float Error;
+		};
+
+		// Quantizes a pair of endpoints in the requested mode and assigns each pixel its closest palette entry.
+		void EvaluateColor( const float (*points)[4], const bool* transparent, const float* first, const float* second,
+			bool fourColor, ColorFit& fit )
+		{
+			int a = Pack565( first );
+			int b = Pack565( second );
+
+			// the ordering of the endpoints selects the mode
+			if( fourColor ? a < b : a > b )
+			{
+				int swap = a;
+				a = b;
+				b = swap;
+			}
+
+			int palette[4][4];
+			GetColorPalette( a, b, fourColor && a != b, palette );
+
+			fit.First = a;
+			fit.Second = b;
+			fit.Error = 0.0f;
+
+			int choices = fourColor && a != b ? 4 : 3;
+			for( int i = 0; i < 16; ++i )
+			{
+				if( transparent[i] )
+				{
+					fit.Indices[i] = 3;
+					continue;
+				}
+
+				float bestError = MaximumError;
+				for( int p = 0; p < choices; ++p )
+				{
+					float error = 0.0f;
+					for( int c = 0; c < 3; ++c )
+					{
+						float delta = points[i][c] - palette[p][c];
+						error += delta * delta;
+					}
+
+					if( error < bestError )
+					{
+						bestError = error;
+						fit.Indices[i] = p;
+					}
+				}
+
+				fit.Error += bestError;
+			}
+		}
+
+		void FitColor( const float (*points)[4], const bool* transparent, const int* pixels, int count,
+			bool fourColor, BlockQuality quality, ColorFit& best )
+		{
+			const float FourColorWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+			const float ThreeColorWeights[3] = { 0.0f, 1.0f, 0.5f };
+
+			float first[4];
+			float second[4];
+			GetLineEndpoints( points, pixels, count, 0, 3, first, second );
+			EvaluateColor( points, transparent, first, second, fourColor, best );
+
+			int iterations = GetIterations( quality );
+			for( int iteration = 0; iteration < iterations && best.First != best.Second; ++iteration )
+			{
+				bool paletteHasFourColors = fourColor && best.First != best.Second;
+
+				float weights[16];
+				for( int i = 0; i < count; ++i )
+				{
+					int index = best.Indices[pixels[i]];
+					weights[i] = paletteHasFourColors ? FourColorWeights[index] : ThreeColorWeights[index];
+				}
+
+				if( !SolveEndpoints( points, pixels, count, 0, 3, weights, first, second ) )
+					break;
+
+				ColorFit candidate;
+				EvaluateColor( points, transparent, first, second, fourColor, candidate );
+				if( candidate.Error >= best.Error )
+					break;
+
+				best = candidate;
+			}
+		}
+
+		void EncodeColorBlock( const unsigned char* rgba, unsigned char* block, bool allowThreeColor, BlockQuality quality )
+		{
+			float points[16][4];
+			bool transparent[16];
+			int pixels[16];
+			int count = 0;
+
+			for( int i = 0; i < 16; ++i )
+			{
+				for( int c = 0; c < 4; ++c )
+					points[i][c] = rgba[i * 4 + c];
+
+				transparent[i] = allowThreeColor && rgba[i * 4 + 3] < 128;
+				if( !transparent[i] )
+					pixels[count++] = i;
+			}
+
+			ColorFit best;
+			if( count == 0 )
+			{
+				best.First = 0;
+				best.Second = 0;
+				for( int i = 0; i < 16; ++i )
+					best.Indices[i] = 3;
+			}
+			else if( count < 16 )
+			{
+				FitColor( points, transparent, pixels, count, false, quality, best );
+			}
+			else
+			{
+				FitColor( points, transparent, pixels, count, true, quality, best );
+
+				// the three colour mode occasionally fits better, since its midpoint is exact
+				if( allowThreeColor && quality == BlockQualityHigh && best.Error > 0.0f )
+				{
+					ColorFit candidate;
+					FitColor( points, transparent, pixels, count, false, quality, candidate );
+					if( candidate.Error < best.Error )
+						best = candidate;
+				}
+			}
+
+			unsigned int indices = 0;
+			for( int i = 0; i < 16; ++i )
+				indices |= static_cast<unsigned int>( best.Indices[i] ) << ( i * 2 );
+
+			block[0] = static_cast<unsigned char>( best.First );
+			block[1] = static_cast<unsigned char>( best.First >> 8 );
+			block[2] = static_cast<unsigned char>( best.Second );
+			block[3] = static_cast<unsigned char>( best.Second >> 8 );
+			block[4] = static_cast<unsigned char>( indices );
+			block[5] = static_cast<unsigned char>( indices >> 8 );
+			block[6] = static_cast<unsigned char>( indices >> 16 );
+			block[7] = static_cast<unsigned char>( indices >> 24 );
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// BC2 explicit alpha
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		void DecodeExplicitAlpha( const unsigned char* block, unsigned char* rgba )
+		{
+			for( int i = 0; i < 16; ++i )
+			{
+				int value = ( block[i >> 1] >> ( ( i & 1 ) * 4 ) ) & 15;
+				rgba[i * 4 + 3] = static_cast<unsigned char>( value * 17 );
+			}
+		}
+
+		void EncodeExplicitAlpha( const unsigned char* rgba, unsigned char* block )
+		{
+			memset( block, 0, 8 );
+			for( int i = 0; i < 16; ++i )
+			{
+				int value = Clamp( Round( rgba[i * 4 + 3] * 15.0f / 255.0f ), 0, 15 );
+				block[i >> 1] |= static_cast<unsigned char>( value << ( ( i & 1 ) * 4 ) );
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// BC4 and BC5 channels, also used for BC3 alpha
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		void GetChannelPalette( int first, int second, bool isSigned, float* palette )
+		{
+			palette[0] = static_cast<float>( first );
+			palette[1] = static_cast<float>( second );
+
+			if( first > second )
+			{
+				for( int i = 1; i < 7; ++i )
+					palette[i + 1] = ( ( 7 - i ) * first + i * second ) / 7.0f;
+			}
+			else
+			{
+				for( int i = 1; i < 5; ++i )
+					palette[i + 1] = ( ( 5 - i ) * first + i * second ) / 5.0f;
+
+				palette[6] = isSigned ? -127.0f : 0.0f;
+				palette[7] = isSigned ? 127.0f : 255.0f;
+			}
+		}
+
+		void DecodeChannelBlock( const unsigned char* block, unsigned char* output, int stride, bool isSigned )
+		{
+			int first = isSigned ? static_cast<signed char>( block[0] ) : block[0];
+			int second = isSigned ? static_cast<signed char>( block[1] ) : block[1];
+
+			// -128 is treated as -127 so that signed channels stay symmetric
+			if( isSigned )
+			{
+				first = first < -127 ? -127 : first;
+				second = second < -127 ? -127 : second;
+			}
+
+			float palette[8];
+			GetChannelPalette( first, second, isSigned, palette );
+
+			unsigned long long indices = 0;
+			for( int i = 7; i >= 2; --i )
+				indices = ( indices << 8 ) | block[i];
+
+			for( int i = 0; i < 16; ++i )
+				output[i * stride] = static_cast<unsigned char>( Round( palette[( indices >> ( i * 3 ) ) & 7] ) );
+		}
+
+		struct ChannelFit
+		{
+			int First;
+			int Second;
+			int Indices[16];
+			float Error;
+		};
+
+		void EvaluateChannel( const float* values, int first, int second, bool isSigned, ChannelFit& best )
+		{
+			float palette[8];
+			GetChannelPalette( first, second, isSigned, palette );
+
+			// errors are measured against the values the decoder will actually produce
+			for( int p = 0; p < 8; ++p )
+				palette[p] = static_cast<float>( Round( palette[p] ) );
+
+			ChannelFit fit;
+			fit.First = first;
+			fit.Second = second;
+			fit.Error = 0.0f;
+
+			for( int i = 0; i < 16; ++i )
+			{
+				float bestError = MaximumError;
+				for( int p = 0; p < 8; ++p )
+				{
+					float error = ( values[i] - palette[p] ) * ( values[i] - palette[p] );
+					if( error < bestError )
+					{
+						bestError = error;
+						fit.Indices[i] = p;
+					}
+				}
+
+				fit.Error += bestError;
+			}
+
+			if( fit.Error < best.Error )
+				best = fit;
+		}
+
+		// Refines one mode of a channel block by least squares over the interpolated indices.
+		void RefineChannel( const float* values, bool isSigned, bool eightValues, ChannelFit& best )
+		{
+			int low = isSigned ? -127 : 0;
+			int high = isSigned ? 127 : 255;
+
+			for( int iteration = 0; iteration < 2; ++iteration )
+			{
+				ChannelFit current = best;
+				if( ( current.First > current.Second ) != eightValues )
+					return;
+
+				float points[16][4];
+				float weights[16];
+				int pixels[16];
+				int count = 0;
+
+				for( int i = 0; i < 16; ++i )
+				{
+					int index = current.Indices[i];
+					if( !eightValues && index >= 6 )
+						continue;
+
+					points[i][0] = values[i];
+					weights[count] = index == 0 ? 0.0f : ( index == 1 ? 1.0f : ( index - 1 ) / ( eightValues ? 7.0f : 5.0f ) );
+					pixels[count++] = i;
+				}
+
+				float first[4];
+				float second[4];
+				if( count == 0 || !SolveEndpoints( points, pixels, count, 0, 1, weights, first, second ) )
+					return;
+
+				int a = Clamp( Round( first[0] ), low, high );
+				int b = Clamp( Round( second[0] ), low, high );
+				if( ( a > b ) != eightValues )
+				{
+					int swap = a;
+					a = b;
+					b = swap;
+				}
+
+				if( a == current.First && b == current.Second )
+					return;
+
+				EvaluateChannel( values, a, b, isSigned, best );
+			}
+		}
+
+		void EncodeChannelBlock( const unsigned char* input, int stride, unsigned char* block, bool isSigned, BlockQuality quality )
+		{
+			int low = isSigned ? -127 : 0;
+			int high = isSigned ? 127 : 255;
+
+			float values[16];
+			float minimum = MaximumError;
+			float maximum = -MaximumError;
+			float innerMinimum = MaximumError;
+			float innerMaximum = -MaximumError;
+
+			for( int i = 0; i < 16; ++i )
+			{
+				int value = isSigned ? static_cast<signed char>( input[i * stride] ) : input[i * stride];
+				values[i] = static_cast<float>( value < low ? low : value );
+
+				minimum = values[i] < minimum ? values[i] : minimum;
+				maximum = values[i] > maximum ? values[i] : maximum;
+
+				if( values[i] != low && values[i] != high )
+				{
+					innerMinimum = values[i] < innerMinimum ? values[i] : innerMinimum;
+					innerMaximum = values[i] > innerMaximum ? values[i] : innerMaximum;
+				}
+			}
+
+			ChannelFit best;
+			best.Error = MaximumError;
+			EvaluateChannel( values, static_cast<int>( maximum ), static_cast<int>( minimum ), isSigned, best );
+
+			if( quality != BlockQualityFast && best.Error > 0.0f )
+			{
+				// the six value mode has exact values for both ends of the range
+				if( innerMinimum <= innerMaximum )
+					EvaluateChannel( values, static_cast<int>( innerMinimum ), static_cast<int>( innerMaximum ), isSigned, best );
+
+				RefineChannel( values, isSigned, best.First > best.Second, best );
+			}
+
+			unsigned long long indices = 0;
+			for( int i = 0; i < 16; ++i )
+				indices |= static_cast<unsigned long long>( best.Indices[i] ) << ( i * 3 );
+
+			block[0] = static_cast<unsigned char>( best.First );
+			block[1] = static_cast<unsigned char>( best.Second );
+			for( int i = 2; i < 8; ++i, indices >>= 8 )
+				block[i] = static_cast<unsigned char>( indices );
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// BC6H
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		int SignExtend( int value, int bits )
+		{
+			int shift = 32 - bits;
+			return static_cast<int>( static_cast<unsigned int>( value ) << shift ) >> shift;
+		}
+
+		int UnquantizeBC6H( int value, int bits, bool isSigned )
+		{
+			if( !isSigned )
+			{
+				if( bits >= 15 || value == 0 )
+					return value;
+				if( value == ( 1 << bits ) - 1 )
+					return 0xFFFF;
+
+				return ( ( value << 16 ) + 0x8000 ) >> bits;
+			}
+
+			if( bits >= 16 )
+				return value;
+
+			bool negative = value < 0;
+			int magnitude = negative ? -value : value;
+			int result;
+
+			if( magnitude == 0 )
+				result = 0;
+			else if( magnitude >= ( 1 << ( bits - 1 ) ) - 1 )
+				result = 0x7FFF;
+			else
+				result = ( ( magnitude << 15 ) + 0x4000 ) >> ( bits - 1 );
+
+			return negative ? -result : result;
+		}
+
+		// Scales an interpolated value back to the bit pattern of a half float.
+		unsigned short FinishBC6H( int value, bool isSigned )
+		{
+			if( !isSigned )
+				return static_cast<unsigned short>( ( value * 31 ) >> 6 );
+			if( value < 0 )
+				return static_cast<unsigned short>( 0x8000 | ( ( -value * 31 ) >> 5 ) );
+
+			return static_cast<unsigned short>( ( value * 31 ) >> 5 );
+		}
+
+		void DecodeBC6HBlock( const unsigned char* block, unsigned short* rgba, bool isSigned )
+		{
+			BitReader reader( block );
+			int code = reader.Read( 2 );
+			if( code > 1 )
+				code |= reader.Read( 3 ) << 2;
+
+			const BC6HMode* mode = NULL;
+			for( int i = 0; i < 14; ++i )
+			{
+				if( BC6HModes[i].Code == code )
+					mode = &BC6HModes[i];
+			}
+
+			// reserved modes decode to opaque black
+			if( mode == NULL )
+			{
+				for( int i = 0; i < 16; ++i )
+				{
+					rgba[i * 4 + 0] = 0;
+					rgba[i * 4 + 1] = 0;
+					rgba[i * 4 + 2] = 0;
+					rgba[i * 4 + 3] = HalfOne;
+				}
+
+				return;
+			}
+
+			int fields[13];
+			memset( fields, 0, sizeof( fields ) );
+			for( int i = 0; i < mode->HeaderBits; ++i )
+				fields[mode->Layout[i] >> 4] |= reader.Read( 1 ) << ( mode->Layout[i] & 15 );
+
+			int endpointCount = mode->Regions * 2;
+			int endpoints[4][3];
+			for( int e = 0; e < endpointCount; ++e )
+			{
+				for( int c = 0; c < 3; ++c )
+				{
+					int value = fields[e * 3 + c];
+
+					if( e == 0 && isSigned )
+						value = SignExtend( value, mode->EndpointBits );
+					else if( e > 0 && ( isSigned || mode->Transformed ) )
+						value = SignExtend( value, mode->DeltaBits[c] );
+
+					endpoints[e][c] = value;
+				}
+			}
+
+			for( int e = 0; e < endpointCount; ++e )
+			{
+				for( int c = 0; c < 3; ++c )
+				{
+					if( e > 0 && mode->Transformed )
+					{
+						endpoints[e][c] = ( endpoints[0][c] + endpoints[e][c] ) & ( ( 1 << mode->EndpointBits ) - 1 );
+						if( isSigned )
+							endpoints[e][c] = SignExtend( endpoints[e][c], mode->EndpointBits );
+					}
+				}
+			}
+
+			for( int e = 0; e < endpointCount; ++e )
+			{
+				for( int c = 0; c < 3; ++c )
+					endpoints[e][c] = UnquantizeBC6H( endpoints[e][c], mode->EndpointBits, isSigned );
+			}
+
+			int partition = fields[BC6HPartitionField];
+			int indexBits = mode->Regions == 2 ? 3 : 4;
+			const int* weights = GetWeights( indexBits );
+
+			for( int i = 0; i < 16; ++i )
+			{
+				int region = GetSubset( mode->Regions, partition, i );
+				int index = reader.Read( IsAnchor( mode->Regions, partition, i ) ? indexBits - 1 : indexBits );
+
+				for( int c = 0; c < 3; ++c )
+				{
+					int value = Interpolate( endpoints[region * 2][c], endpoints[region * 2 + 1][c], weights[index] );
+					rgba[i * 4 + c] = FinishBC6H( value, isSigned );
+				}
+
+				rgba[i * 4 + 3] = HalfOne;
+			}
+		}
+
+		// Converts a half float to the integer domain that BC6H interpolates in, before the final scale.
+		float HalfToBC6H( unsigned short half, bool isSigned )
+		{
+			int magnitude = half & 0x7FFF;
+			bool negative = ( half & 0x8000 ) != 0;
+
+			// infinities clamp to the largest finite value; NaN becomes zero
+			if( magnitude >= 0x7C00 )
+				magnitude = magnitude == 0x7C00 ? 0x7BFF : 0;
+
+			if( !isSigned )
+				return negative ? 0.0f : magnitude * 64.0f / 31.0f;
+
+			return ( negative ? -magnitude : magnitude ) * 32.0f / 31.0f;
+		}
+
+		int HalfToInteger( unsigned short half )
+		{
+			return ( half & 0x8000 ) ? -( half & 0x7FFF ) : half;
+		}
+
+		int QuantizeBC6H( float value, bool isSigned )
+		{
+			// mode 0x03 stores 10 bit endpoints; unquantizing maps q to about q * 64 + 32
+			int limit = isSigned ? 511 : 1023;
+			int low = isSigned ? -limit : 0;
+
+			float magnitude = fabs( value );
+			int guess = Round( ( magnitude - 32.0f ) / 64.0f );
+			guess = value < 0.0f ? -guess : guess;
+
+			int best = Clamp( guess, low, limit );
+			float bestError = MaximumError;
+
+			for( int candidate = guess - 1; candidate <= guess + 1; ++candidate )
+			{
+				int q = Clamp( candidate, low, limit );
+				float error = fabs( UnquantizeBC6H( q, 10, isSigned ) - value );
+				if( error < bestError )
+				{
+					bestError = error;
+					best = q;
+				}
+			}
+
+			return best;
+		}
+
+		struct BC6HFit
+		{
+			int Endpoints[2][3];
+			int Indices[16];
+			float Error;
+		};
+
+		void EvaluateBC6H( const int* targets, const float* first, const float* second, bool isSigned, BC6HFit& fit )
+		{
+			int unquantized[2][3];
+			for( int c = 0; c < 3; ++c )
+			{
+				fit.Endpoints[0][c] = QuantizeBC6H( first[c], isSigned );
+				fit.Endpoints[1][c] = QuantizeBC6H( second[c], isSigned );
+				unquantized[0][c] = UnquantizeBC6H( fit.Endpoints[0][c], 10, isSigned );
+				unquantized[1][c] = UnquantizeBC6H( fit.Endpoints[1][c], 10, isSigned );
+			}
+
+			int palette[16][3];
+			for( int p = 0; p < 16; ++p )
+			{
+				for( int c = 0; c < 3; ++c )
+					palette[p][c] = HalfToInteger( FinishBC6H( Interpolate( unquantized[0][c], unquantized[1][c], Weights4[p] ), isSigned ) );
+			}
+
+			fit.Error = 0.0f;
+			for( int i = 0; i < 16; ++i )
+			{
+				float bestError = MaximumError;
+				for( int p = 0; p < 16; ++p )
+				{
+					float error = 0.0f;
+					for( int c = 0; c < 3; ++c )
+					{
+						float delta = static_cast<float>( targets[i * 3 + c] - palette[p][c] );
+						error += delta * delta;
+					}
+
+					if( error < bestError )
+					{
+						bestError = error;
+						fit.Indices[i] = p;
+					}
+				}
+
+				fit.Error += bestError;
+			}
+
+		}
+
+		// Only the single region, untransformed ten bit mode is searched: it never needs the
+		// delta range checks of the other modes and is a good fit for most smooth HDR content.
+		void EncodeBC6HBlock( const unsigned short* rgba, unsigned char* block, bool isSigned, BlockQuality quality )
+		{
+			float points[16][4];
+			int targets[16 * 3];
+			int pixels[16];
+
+			for( int i = 0; i < 16; ++i )
+			{
+				pixels[i] = i;
+				points[i][3] = 0.0f;
+
+				for( int c = 0; c < 3; ++c )
+				{
+					points[i][c] = HalfToBC6H( rgba[i * 4 + c], isSigned );
+
+					// compare against what the decoder would produce for an exact endpoint
+					unsigned short half = rgba[i * 4 + c];
+					int magnitude = half & 0x7FFF;
+					magnitude = magnitude >= 0x7C00 ? ( magnitude == 0x7C00 ? 0x7BFF : 0 ) : magnitude;
+					bool negative = ( half & 0x8000 ) != 0 && magnitude != 0;
+					targets[i * 3 + c] = isSigned ? ( negative ? -magnitude : magnitude ) : ( negative ? 0 : magnitude );
+				}
+			}
+
+			float first[4];
+			float second[4];
+			GetLineEndpoints( points, pixels, 16, 0, 3, first, second );
+
+			float low = isSigned ? -32767.0f : 0.0f;
+			float high = isSigned ? 32767.0f : 65535.0f;
+			for( int c = 0; c < 3; ++c )
+			{
+				first[c] = Clamp( first[c], low, high );
+				second[c] = Clamp( second[c], low, high );
+			}
+
+			BC6HFit best;
+			EvaluateBC6H( targets, first, second, isSigned, best );
+
+			int iterations = GetIterations( quality );
+			for( int iteration = 0; iteration < iterations && best.Error > 0.0f; ++iteration )
+			{
+				float weights[16];
+				for( int i = 0; i < 16; ++i )
+					weights[i] = Weights4[best.Indices[i]] / 64.0f;
+
+				if( !SolveEndpoints( points, pixels, 16, 0, 3, weights, first, second ) )
+					break;
+
+				for( int c = 0; c < 3; ++c )
+				{
+					first[c] = Clamp( first[c], low, high );
+					second[c] = Clamp( second[c], low, high );
+				}
+
+				BC6HFit candidate;
+				EvaluateBC6H( targets, first, second, isSigned, candidate );
+				if( candidate.Error >= best.Error )
+					break;
+
+				best = candidate;
+			}
+
+			// the anchor index drops its top bit, so swap the endpoints if it is set
+			if( best.Indices[0] >= 8 )
+			{
+				for( int c = 0; c < 3; ++c )
+				{
+					int swap = best.Endpoints[0][c];
+					best.Endpoints[0][c] = best.Endpoints[1][c];
+					best.Endpoints[1][c] = swap;
+				}
+
+				for( int i = 0; i < 16; ++i )
+					best.Indices[i] = 15 - best.Indices[i];
+			}
+
+			BitWriter writer( block );
+			writer.Write( 0x03, 5 );
+			for( int e = 0; e < 2; ++e )
+			{
+				for( int c = 0; c < 3; ++c )
+					writer.Write( best.Endpoints[e][c] & 0x3FF, 10 );
+			}
+
+			for( int i = 0; i < 16; ++i )
+				writer.Write( best.Indices[i], i == 0 ? 3 : 4 );
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// BC7
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		int ExpandBC7( int value, int bits )
+		{
+			value <<= 8 - bits;
+			return value | ( value >> bits );
+		}
+
+		void DecodeBC7Block( const unsigned char* block, unsigned char* rgba )
+		{
+			BitReader reader( block );
+
+			int modeIndex = 0;
+			while( modeIndex < 8 && reader.Read( 1 ) == 0 )
+				++modeIndex;
+
+			// reserved mode decodes to transparent black
+			if( modeIndex == 8 )
+			{
+				memset( rgba, 0, 64 );
+				return;
+			}
+
+			const BC7Mode& mode = BC7Modes[modeIndex];
+			int partition = reader.Read( mode.PartitionBits );
+			int rotation = reader.Read( mode.RotationBits );
+			int indexSelection = reader.Read( mode.IndexSelectionBits );
+
+			int endpointCount = mode.Subsets * 2;
+			int endpoints[6][4];
+			for( int c = 0; c < 3; ++c )
+			{
+				for( int e = 0; e < endpointCount; ++e )
+					endpoints[e][c] = reader.Read( mode.ColorBits );
+			}
+
+			for( int e = 0; e < endpointCount; ++e )
+				endpoints[e][3] = mode.AlphaBits ? reader.Read( mode.AlphaBits ) : 255;
+
+			int colorBits = mode.ColorBits;
+			int alphaBits = mode.AlphaBits;
+			if( mode.EndpointPBits || mode.SharedPBits )
+			{
+				int pbits[6];
+				for( int e = 0; e < endpointCount; ++e )
+					pbits[e] = mode.EndpointPBits || ( e & 1 ) == 0 ? reader.Read( 1 ) : pbits[e - 1];
+
+				for( int e = 0; e < endpointCount; ++e )
+				{
+					for( int c = 0; c < 4; ++c )
+					{
+						if( c < 3 || mode.AlphaBits )
+							endpoints[e][c] = ( endpoints[e][c] << 1 ) | pbits[e];
+					}
+				}
+
+				++colorBits;
+				alphaBits += mode.AlphaBits ? 1 : 0;
+			}
+
+			for( int e = 0; e < endpointCount; ++e )
+			{
+				for( int c = 0; c < 3; ++c )
+					endpoints[e][c] = ExpandBC7( endpoints[e][c], colorBits );
+
+				if( alphaBits )
+					endpoints[e][3] = ExpandBC7( endpoints[e][3], alphaBits );
+			}
+
+			int indices[16];
+			int secondaryIndices[16];
+			for( int i = 0; i < 16; ++i )
+				indices[i] = reader.Read( IsAnchor( mode.Subsets, partition, i ) ? mode.IndexBits - 1 : mode.IndexBits );
+
+			for( int i = 0; i < 16 && mode.SecondaryIndexBits; ++i )
+				secondaryIndices[i] = reader.Read( i == 0 ? mode.SecondaryIndexBits - 1 : mode.SecondaryIndexBits );
+
+			for( int i = 0; i < 16; ++i )
+			{
+				int subset = GetSubset( mode.Subsets, partition, i );
+				const int* first = endpoints[subset * 2];
+				const int* second = endpoints[subset * 2 + 1];
+
+				int colorWeight = GetWeights( mode.IndexBits )[indices[i]];
+				int alphaWeight = colorWeight;
+				if( mode.SecondaryIndexBits )
+				{
+					int secondaryWeight = GetWeights( mode.SecondaryIndexBits )[secondaryIndices[i]];
+					if( indexSelection )
+						colorWeight = secondaryWeight;
+					else
+						alphaWeight = secondaryWeight;
+				}
+
+				int color[4];
+				for( int c = 0; c < 3; ++c )
+					color[c] = Interpolate( first[c], second[c], colorWeight );
+				color[3] = Interpolate( first[3], second[3], alphaWeight );
+
+				if( rotation )
+				{
+					int swap = color[3];
+					color[3] = color[rotation - 1];
+					color[rotation - 1] = swap;
+				}
+
+				for( int c = 0; c < 4; ++c )
+					rgba[i * 4 + c] = static_cast<unsigned char>( color[c] );
+			}
+		}
+
+		// How one group of channels of a subset is quantized and indexed.
+		struct BC7FitParameters
+		{
+			int FirstChannel;
+			int Channels;
+			int ColorBits;
+			int AlphaBits;
+			int PBits;
+			int IndexBits;
+		};
+
+		const int PBitsNone = 0;
+		const int PBitsPerEndpoint = 1;
+		const int PBitsShared = 2;
+
+		struct BC7Fit
+		{
+			int Endpoints[2][4];
+			int PBits[2];
+			int Indices[16];
+			float Error;
+		};
+
+		int QuantizeBC7( float value, int bits, int pbit )
+		{
+			int maximum = ( 1 << bits ) - 1;
+			int total = pbit < 0 ? bits : bits + 1;
+			int guess = pbit < 0 ? Round( value * maximum / 255.0f ) : Round( ( value * ( ( 1 << total ) - 1 ) / 255.0f - pbit ) * 0.5f );
+
+			int best = Clamp( guess, 0, maximum );
+			float bestError = MaximumError;
+			for( int candidate = guess - 1; candidate <= guess + 1; ++candidate )
+			{
+				int q = Clamp( candidate, 0, maximum );
+				int expanded = ExpandBC7( pbit < 0 ? q : ( q << 1 ) | pbit, total );
+				float error = fabs( expanded - value );
+				if( error < bestError )
+				{
+					bestError = error;
+					best = q;
+				}
+			}
+
+			return best;
+		}
+
+		void EvaluateBC7( const float (*points)[4], const int* pixels, int count, const BC7FitParameters& parameters,
+			const float* first, const float* second, BC7Fit& best )
+		{
+			int combinations = parameters.PBits == PBitsPerEndpoint ? 4 : ( parameters.PBits == PBitsShared ? 2 : 1 );
+			const int* weights = GetWeights( parameters.IndexBits );
+			int paletteSize = 1 << parameters.IndexBits;
+			int lastChannel = parameters.FirstChannel + parameters.Channels;
+
+			for( int combination = 0; combination < combinations; ++combination )
+			{
+				BC7Fit fit;
+				if( parameters.PBits == PBitsNone )
+				{
+					fit.PBits[0] = -1;
+					fit.PBits[1] = -1;
+				}
+				else if( parameters.PBits == PBitsShared )
+				{
+					fit.PBits[0] = combination;
+					fit.PBits[1] = combination;
+				}
+				else
+				{
+					fit.PBits[0] = combination & 1;
+					fit.PBits[1] = combination >> 1;
+				}
+
+				int expanded[2][4];
+				for( int e = 0; e < 2; ++e )
+				{
+					const float* source = e == 0 ? first : second;
+					for( int c = parameters.FirstChannel; c < lastChannel; ++c )
+					{
+						int bits = c < 3 ? parameters.ColorBits : parameters.AlphaBits;
+						int pbit = fit.PBits[e];
+						fit.Endpoints[e][c] = QuantizeBC7( Clamp( source[c], 0.0f, 255.0f ), bits, pbit );
+						expanded[e][c] = ExpandBC7( pbit < 0 ? fit.Endpoints[e][c] : ( fit.Endpoints[e][c] << 1 ) | pbit, pbit < 0 ? bits : bits + 1 );
+					}
+				}
+
+				int palette[16][4];
+				for( int p = 0; p < paletteSize; ++p )
+				{
+					for( int c = parameters.FirstChannel; c < lastChannel; ++c )
+						palette[p][c] = Interpolate( expanded[0][c], expanded[1][c], weights[p] );
+				}
+
+				fit.Error = 0.0f;
+				for( int i = 0; i < count && fit.Error < best.Error; ++i )
+				{
+					const float* point = points[pixels[i]];
+					float bestError = MaximumError;
+
+					for( int p = 0; p < paletteSize; ++p )
+					{
+						float error = 0.0f;
+						for( int c = parameters.FirstChannel; c < lastChannel; ++c )
+						{
+							float delta = point[c] - palette[p][c];
+							error += delta * delta;
+						}
+
+						if( error < bestError )
+						{
+							bestError = error;
+							fit.Indices[i] = p;
+						}
+					}
+
+					fit.Error += bestError;
+				}
+
+				if( fit.Error < best.Error )
+					best = fit;
+			}
+		}
+
+		// Fits one subset: the best fit line gives the starting endpoints, which are then refined by
+		// least squares over the chosen indices. Indices are stored in the order of the pixel list.
+		void FitBC7( const float (*points)[4], const int* pixels, int count, const BC7FitParameters& parameters,
+			BlockQuality quality, BC7Fit& best )
+		{
+			float first[4];
+			float second[4];
+			GetLineEndpoints( points, pixels, count, parameters.FirstChannel, parameters.Channels, first, second );
+
+			best.Error = MaximumError;
+			EvaluateBC7( points, pixels, count, parameters, first, second, best );
+
+			const int* weights = GetWeights( parameters.IndexBits );
+			int iterations = GetIterations( quality );
+			for( int iteration = 0; iteration < iterations && best.Error > 0.0f; ++iteration )
+			{
+				float fitWeights[16];
+				for( int i = 0; i < count; ++i )
+					fitWeights[i] = weights[best.Indices[i]] / 64.0f;
+
+				if( !SolveEndpoints( points, pixels, count, parameters.FirstChannel, parameters.Channels, fitWeights, first, second ) )
+					break;
+
+				float previous = best.Error;
+				EvaluateBC7( points, pixels, count, parameters, first, second, best );
+				if( best.Error >= previous )
+					break;
+			}
+		}
+
+		struct BC7Candidate
+		{
+			int Mode;
+			int Partition;
+			int Rotation;
+			int IndexSelection;
+			int Endpoints[6][4];
+			int PBits[6];
+			int ColorIndices[16];
+			int AlphaIndices[16];
+			float Error;
+		};
+
+		// Estimates how well a partition suits the block from the spread of each subset around its best fit line.
+		float EstimatePartitionError( const float (*points)[4], int subsets, int partition, int channels )
+		{
+			float error = 0.0f;
+
+			for( int subset = 0; subset < subsets; ++subset )
+			{
+				int pixels[16];
+				int count = 0;
+				for( int i = 0; i < 16; ++i )
+				{
+					if( GetSubset( subsets, partition, i ) == subset )
+						pixels[count++] = i;
+				}
+
+				float mean[4];
+				float axis[4];
+				FitLine( points, pixels, count, 0, channels, mean, axis );
+
+				for( int i = 0; i < count; ++i )
+				{
+					float distance = 0.0f;
+					float projection = 0.0f;
+					for( int c = 0; c < channels; ++c )
+					{
+						float delta = points[pixels[i]][c] - mean[c];
+						distance += delta * delta;
+						projection += delta * axis[c];
+					}
+
+					error += distance - projection * projection;
+				}
+			}
+
+			return error;
+		}
+
+		// Picks the partitions with the lowest estimated error, best first.
+		int SelectPartitions( const float (*points)[4], int subsets, int partitionCount, int channels, int wanted, int* selected )
+		{
+			float errors[64];
+			for( int p = 0; p < partitionCount; ++p )
+				errors[p] = EstimatePartitionError( points, subsets, p, channels );
+
+			int count = 0;
+			for( ; count < wanted && count < partitionCount; ++count )
+			{
+				int best = -1;
+				for( int p = 0; p < partitionCount; ++p )
+				{
+					if( errors[p] < MaximumError && ( best < 0 || errors[p] < errors[best] ) )
+						best = p;
+				}
+
+				selected[count] = best;
+				errors[best] = MaximumError;
+			}
+
+			return count;
+		}
+
+		void TryBC7Partitioned( const float (*points)[4], int modeIndex, int partition, BlockQuality quality, BC7Candidate& best )
+		{
+			const BC7Mode& mode = BC7Modes[modeIndex];
+
+			BC7FitParameters parameters;
+			parameters.FirstChannel = 0;
+			parameters.Channels = mode.AlphaBits ? 4 : 3;
+			parameters.ColorBits = mode.ColorBits;
+			parameters.AlphaBits = mode.AlphaBits;
+			parameters.PBits = mode.EndpointPBits ? PBitsPerEndpoint : ( mode.SharedPBits ? PBitsShared : PBitsNone );
+			parameters.IndexBits = mode.IndexBits;
+
+			BC7Candidate candidate;
+			candidate.Mode = modeIndex;
+			candidate.Partition = partition;
+			candidate.Rotation = 0;
+			candidate.IndexSelection = 0;
+			candidate.Error = 0.0f;
+
+			// modes without alpha always decode to opaque
+			if( !mode.AlphaBits )
+			{
+				for( int i = 0; i < 16; ++i )
+					candidate.Error += ( 255.0f - points[i][3] ) * ( 255.0f - points[i][3] );
+			}
+
+			for( int subset = 0; subset < mode.Subsets && candidate.Error < best.Error; ++subset )
+			{
+				int pixels[16];
+				int count = 0;
+				for( int i = 0; i < 16; ++i )
+				{
+					if( GetSubset( mode.Subsets, partition, i ) == subset )
+						pixels[count++] = i;
+				}
+
+				BC7Fit fit;
+				FitBC7( points, pixels, count, parameters, quality, fit );
+
+				for( int e = 0; e < 2; ++e )
+				{
+					for( int c = 0; c < 4; ++c )
+						candidate.Endpoints[subset * 2 + e][c] = c < parameters.Channels ? fit.Endpoints[e][c] : 0;
+
+					candidate.PBits[subset * 2 + e] = fit.PBits[e];
+				}
+
+				for( int i = 0; i < count; ++i )
+					candidate.ColorIndices[pixels[i]] = fit.Indices[i];
+
+				candidate.Error += fit.Error;
+			}
+
+			if( candidate.Error < best.Error )
+				best = candidate;
+		}
+
+		void TryBC7Rotated( const float (*source)[4], int modeIndex, int rotation, int indexSelection, BlockQuality quality, BC7Candidate& best )
+		{
+			const BC7Mode& mode = BC7Modes[modeIndex];
+
+			float points[16][4];
+			int pixels[16];
+			for( int i = 0; i < 16; ++i )
+			{
+				for( int c = 0; c < 4; ++c )
+					points[i][c] = source[i][c];
+
+				if( rotation )
+				{
+					points[i][3] = source[i][rotation - 1];
+					points[i][rotation - 1] = source[i][3];
+				}
+
+				pixels[i] = i;
+			}
+
+			BC7FitParameters color;
+			color.FirstChannel = 0;
+			color.Channels = 3;
+			color.ColorBits = mode.ColorBits;
+			color.AlphaBits = 0;
+			color.PBits = PBitsNone;
+			color.IndexBits = indexSelection ? mode.SecondaryIndexBits : mode.IndexBits;
+
+			BC7FitParameters alpha;
+			alpha.FirstChannel = 3;
+			alpha.Channels = 1;
+			alpha.ColorBits = 0;
+			alpha.AlphaBits = mode.AlphaBits;
+			alpha.PBits = PBitsNone;
+			alpha.IndexBits = indexSelection ? mode.IndexBits : mode.SecondaryIndexBits;
+
+			BC7Fit colorFit;
+			FitBC7( points, pixels, 16, color, quality, colorFit );
+			if( colorFit.Error >= best.Error )
+				return;
+
+			BC7Fit alphaFit;
+			FitBC7( points, pixels, 16, alpha, quality, alphaFit );
+
+			BC7Candidate candidate;
+			candidate.Mode = modeIndex;
+			candidate.Partition = 0;
+			candidate.Rotation = rotation;
+			candidate.IndexSelection = indexSelection;
+			candidate.Error = colorFit.Error + alphaFit.Error;
+
+			for( int e = 0; e < 2; ++e )
+			{
+				for( int c = 0; c < 3; ++c )
+					candidate.Endpoints[e][c] = colorFit.Endpoints[e][c];
+
+				candidate.Endpoints[e][3] = alphaFit.Endpoints[e][3];
+				candidate.PBits[e] = -1;
+			}
+
+			for( int i = 0; i < 16; ++i )
+			{
+				candidate.ColorIndices[i] = colorFit.Indices[i];
+				candidate.AlphaIndices[i] = alphaFit.Indices[i];
+			}
+
+			if( candidate.Error < best.Error )
+				best = candidate;
+		}
+
+		void SwapEndpoints( BC7Candidate& candidate, int subset, int firstChannel, int lastChannel, bool swapPBits )
+		{
+			for( int c = firstChannel; c < lastChannel; ++c )
+			{
+				int swap = candidate.Endpoints[subset * 2][c];
+				candidate.Endpoints[subset * 2][c] = candidate.Endpoints[subset * 2 + 1][c];
+				candidate.Endpoints[subset * 2 + 1][c] = swap;
+			}
+
+			if( swapPBits )
+			{
+				int swap = candidate.PBits[subset * 2];
+				candidate.PBits[subset * 2] = candidate.PBits[subset * 2 + 1];
+				candidate.PBits[subset * 2 + 1] = swap;
+			}
+		}
+
+		void WriteBC7Block( BC7Candidate candidate, unsigned char* block )
+		{
+			const BC7Mode& mode = BC7Modes[candidate.Mode];
+			int endpointCount = mode.Subsets * 2;
+
+			// the anchor index of each subset drops its top bit, so flip any subset where it is set
+			if( mode.SecondaryIndexBits )
+			{
+				int colorBits = candidate.IndexSelection ? mode.SecondaryIndexBits : mode.IndexBits;
+				int alphaBits = candidate.IndexSelection ? mode.IndexBits : mode.SecondaryIndexBits;
+
+				if( candidate.ColorIndices[0] >> ( colorBits - 1 ) )
+				{
+					SwapEndpoints( candidate, 0, 0, 3, false );
+					for( int i = 0; i < 16; ++i )
+						candidate.ColorIndices[i] = ( 1 << colorBits ) - 1 - candidate.ColorIndices[i];
+				}
+
+				if( candidate.AlphaIndices[0] >> ( alphaBits - 1 ) )
+				{
+					SwapEndpoints( candidate, 0, 3, 4, false );
+					for( int i = 0; i < 16; ++i )
+						candidate.AlphaIndices[i] = ( 1 << alphaBits ) - 1 - candidate.AlphaIndices[i];
+				}
+			}
+			else
+			{
+				for( int subset = 0; subset < mode.Subsets; ++subset )
+				{
+					int anchor = GetAnchor( mode.Subsets, candidate.Partition, subset );
+					if( !( candidate.ColorIndices[anchor] >> ( mode.IndexBits - 1 ) ) )
+						continue;
+
+					SwapEndpoints( candidate, subset, 0, 4, true );
+					for( int i = 0; i < 16; ++i )
+					{
+						if( GetSubset( mode.Subsets, candidate.Partition, i ) == subset )
+							candidate.ColorIndices[i] = ( 1 << mode.IndexBits ) - 1 - candidate.ColorIndices[i];
+					}
+				}
+			}
+
+			BitWriter writer( block );
+			writer.Write( 1 << candidate.Mode, candidate.Mode + 1 );
+			writer.Write( candidate.Partition, mode.PartitionBits );
+			writer.Write( candidate.Rotation, mode.RotationBits );
+			writer.Write( candidate.IndexSelection, mode.IndexSelectionBits );
+
+			for( int c = 0; c < 3; ++c )
+			{
+				for( int e = 0; e < endpointCount; ++e )
+					writer.Write( candidate.Endpoints[e][c], mode.ColorBits );
+			}
+
+			for( int e = 0; e < endpointCount && mode.AlphaBits; ++e )
+				writer.Write( candidate.Endpoints[e][3], mode.AlphaBits );
+
+			for( int e = 0; e < endpointCount; ++e )
+			{
+				if( mode.EndpointPBits || ( mode.SharedPBits && ( e & 1 ) == 0 ) )
+					writer.Write( candidate.PBits[e], 1 );
+			}
+
+			if( mode.SecondaryIndexBits )
+			{
+				const int* primary = candidate.IndexSelection ? candidate.AlphaIndices : candidate.ColorIndices;
+				const int* secondary = candidate.IndexSelection ? candidate.ColorIndices : candidate.AlphaIndices;
+
+				for( int i = 0; i < 16; ++i )
+					writer.Write( primary[i], i == 0 ? mode.IndexBits - 1 : mode.IndexBits );
+				for( int i = 0; i < 16; ++i )
+					writer.Write( secondary[i], i == 0 ? mode.SecondaryIndexBits - 1 : mode.SecondaryIndexBits );
+			}
+			else
+			{
+				for( int i = 0; i < 16; ++i )
+				{
+					bool anchor = IsAnchor( mode.Subsets, candidate.Partition, i );
+					writer.Write( candidate.ColorIndices[i], anchor ? mode.IndexBits - 1 : mode.IndexBits );
+				}
+			}
+		}
+
+		void EncodeBC7Block( const unsigned char* rgba, unsigned char* block, BlockQuality quality )
+		{
+			float points[16][4];
+			bool opaque = true;
+			for( int i = 0; i < 16; ++i )
+			{
+				for( int c = 0; c < 4; ++c )
+					points[i][c] = rgba[i * 4 + c];
+
+				opaque = opaque && rgba[i * 4 + 3] == 255;
+			}
+
+			BC7Candidate best;
+			best.Error = MaximumError;
+
+			// mode 6 handles most blocks well on its own and is the only one the fast preset searches
+			TryBC7Partitioned( points, 6, 0, quality, best );
+
+			if( quality != BlockQualityFast && best.Error > 0.0f )
+			{
+				int partitionsWanted = quality == BlockQualityHigh ? 8 : 1;
+				int selected[64];
+
+				int count = SelectPartitions( points, 2, 64, opaque ? 3 : 4, partitionsWanted, selected );
+				for( int i = 0; i < count; ++i )
+				{
+					if( opaque )
+					{
+						TryBC7Partitioned( points, 1, selected[i], quality, best );
+						TryBC7Partitioned( points, 3, selected[i], quality, best );
+					}
+					else
+					{
+						TryBC7Partitioned( points, 7, selected[i], quality, best );
+					}
+				}
+
+				int rotations = quality == BlockQualityHigh ? 4 : 1;
+				for( int rotation = 0; rotation < rotations; ++rotation )
+				{
+					TryBC7Rotated( points, 5, rotation, 0, quality, best );
+
+					if( quality == BlockQualityHigh )
+					{
+						TryBC7Rotated( points, 4, rotation, 0, quality, best );
+						TryBC7Rotated( points, 4, rotation, 1, quality, best );
+					}
+				}
+
+				if( quality == BlockQualityHigh && opaque )
+				{
+					count = SelectPartitions( points, 3, 16, 3, partitionsWanted, selected );
+					for( int i = 0; i < count; ++i )
+						TryBC7Partitioned( points, 0, selected[i], quality, best );
+
+					count = SelectPartitions( points, 3, 64, 3, partitionsWanted, selected );
+					for( int i = 0; i < count; ++i )
+						TryBC7Partitioned( points, 2, selected[i], quality, best );
+				}
+			}
+
+			WriteBC7Block( best, block );
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////
+		// Block dispatch
+		////////////////////////////////////////////////////////////////////////////////////////
+
+		void EncodeBlock( BlockFormat format, BlockQuality quality, const unsigned char* pixels, unsigned char* block )
+		{
+			switch( format )
+			{
+			case BlockFormatBC1:
+				EncodeColorBlock( pixels, block, true, quality );
+				break;
+
+			case BlockFormatBC2:
+				EncodeExplicitAlpha( pixels, block );
+				EncodeColorBlock( pixels, block + 8, false, quality );
+				break;
+
+			case BlockFormatBC3:
+				EncodeChannelBlock( pixels + 3, 4, block, false, quality );
+				EncodeColorBlock( pixels, block + 8, false, quality );
+				break;
+
+			case BlockFormatBC4UNorm:
+			case BlockFormatBC4SNorm:
+				EncodeChannelBlock( pixels, 1, block, format == BlockFormatBC4SNorm, quality );
+				break;
+
+			case BlockFormatBC5UNorm:
+			case BlockFormatBC5SNorm:
+				EncodeChannelBlock( pixels, 2, block, format == BlockFormatBC5SNorm, quality );
+				EncodeChannelBlock( pixels + 1, 2, block + 8, format == BlockFormatBC5SNorm, quality );
+				break;
+
+			case BlockFormatBC6HUF16:
+			case BlockFormatBC6HSF16:
+				EncodeBC6HBlock( reinterpret_cast<const unsigned short*>( pixels ), block, format == BlockFormatBC6HSF16, quality );
+				break;
+
+			case BlockFormatBC7:
+				EncodeBC7Block( pixels, block, quality );
+				break;
+			}
+		}
+
+		void DecodeBlock( BlockFormat format, const unsigned char* block, unsigned char* pixels )
+		{
+			switch( format )
+			{
+			case BlockFormatBC1:
+				DecodeColorBlock( block, pixels, true );
+				break;
+
+			case BlockFormatBC2:
+				DecodeColorBlock( block + 8, pixels, false );
+				DecodeExplicitAlpha( block, pixels );
+				break;
+
+			case BlockFormatBC3:
+				DecodeColorBlock( block + 8, pixels, false );
+				DecodeChannelBlock( block, pixels + 3, 4, false );
+				break;
+
+			case BlockFormatBC4UNorm:
+			case BlockFormatBC4SNorm:
+				DecodeChannelBlock( block, pixels, 1, format == BlockFormatBC4SNorm );
+				break;
+
+			case BlockFormatBC5UNorm:
+			case BlockFormatBC5SNorm:
+				DecodeChannelBlock( block, pixels, 2, format == BlockFormatBC5SNorm );
+				DecodeChannelBlock( block + 8, pixels + 1, 2, format == BlockFormatBC5SNorm );
+				break;
+
+			case BlockFormatBC6HUF16:
+			case BlockFormatBC6HSF16:
+				DecodeBC6HBlock( block, reinterpret_cast<unsigned short*>( pixels ), format == BlockFormatBC6HSF16 );
+				break;
+
+			case BlockFormatBC7:
+				DecodeBC7Block( block, pixels );
+				break;
+			}
+		}
+	}
+
+	int GetBlockSize( BlockFormat format )
+	{
+		switch( format )
+		{
+		case BlockFormatBC1:
+		case BlockFormatBC4UNorm:
+		case BlockFormatBC4SNorm:
+			return 8;
+
+		default:
+			return 16;
+		}
+	}
+
+	int GetUncompressedPixelSize( BlockFormat format )
+	{
+		switch( format )
+		{
+		case BlockFormatBC4UNorm:
+		case BlockFormatBC4SNorm:
+			return 1;
+
+		case BlockFormatBC5UNorm:
+		case BlockFormatBC5SNorm:
+			return 2;
+
+		case BlockFormatBC6HUF16:
+		case BlockFormatBC6HSF16:
+			return 8;
+
+		default:
+			return 4;
+		}
+	}
+
+	void CompressBlocks( BlockFormat format, BlockQuality quality, const unsigned char* source, int sourcePitch,
+		int width, int height, unsigned char* destination, int destinationPitch,
+		int firstBlockX, int firstBlockY, int lastBlockX, int lastBlockY )
+	{
+		int pixelSize = GetUncompressedPixelSize( format );
+		int blockSize = GetBlockSize( format );
+
+		// aligned for the half float view used by BC6H
+		unsigned short storage[16 * 4];
+		unsigned char* pixels = reinterpret_cast<unsigned char*>( storage );
+
+		for( int blockY = firstBlockY; blockY < lastBlockY; ++blockY )
+		{
+			for( int blockX = firstBlockX; blockX < lastBlockX; ++blockX )
+			{
+				for( int y = 0; y < 4; ++y )
+				{
+					int sourceY = blockY * 4 + y < height ? blockY * 4 + y : height - 1;
+					for( int x = 0; x < 4; ++x )
+					{
+						int sourceX = blockX * 4 + x < width ? blockX * 4 + x : width - 1;
+						memcpy( pixels + ( y * 4 + x ) * pixelSize, source + sourceY * sourcePitch + sourceX * pixelSize, pixelSize );
+					}
+				}
+
+				EncodeBlock( format, quality, pixels, destination + blockY * destinationPitch + blockX * blockSize );
+			}
+		}
+	}
+
+	void DecompressBlocks( BlockFormat format, const unsigned char* source, int sourcePitch,
+		int width, int height, unsigned char* destination, int destinationPitch,
+		int firstBlockX, int firstBlockY, int lastBlockX, int lastBlockY )
+	{
+		int pixelSize = GetUncompressedPixelSize( format );
+		int blockSize = GetBlockSize( format );
+
+		unsigned short storage[16 * 4];
+		unsigned char* pixels = reinterpret_cast<unsigned char*>( storage );
+
+		for( int blockY = firstBlockY; blockY < lastBlockY; ++blockY )
+		{
+			for( int blockX = firstBlockX; blockX < lastBlockX; ++blockX )
+			{
+				DecodeBlock( format, source + blockY * sourcePitch + blockX * blockSize, pixels );
+
+				for( int y = 0; y < 4 && blockY * 4 + y < height; ++y )
+				{
+					int columns = width - blockX * 4 < 4 ? width - blockX * 4 : 4;
+					memcpy( destination + ( blockY * 4 + y ) * destinationPitch + blockX * 4 * pixelSize, pixels + y * 4 * pixelSize, columns * pixelSize );
+				}
+			}
+		}
+	}
+}
+}
+
+#pragma managed(pop)
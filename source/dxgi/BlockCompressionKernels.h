@@ -0,0 +1,72 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+namespace DXGI
+{
+	// Native block compression kernels shared by the managed BlockCompression API.
+	// Both directions work on a rectangle of 4x4 blocks so that callers can split a
+	// surface into tiles and process them on separate threads.
+
+	enum BlockFormat
+	{
+		BlockFormatBC1,
+		BlockFormatBC2,
+		BlockFormatBC3,
+		BlockFormatBC4UNorm,
+		BlockFormatBC4SNorm,
+		BlockFormatBC5UNorm,
+		BlockFormatBC5SNorm,
+		BlockFormatBC6HUF16,
+		BlockFormatBC6HSF16,
+		BlockFormatBC7
+	};
+
+	enum BlockQuality
+	{
+		BlockQualityFast,
+		BlockQualityNormal,
+		BlockQualityHigh
+	};
+
+	// Size in bytes of one compressed 4x4 block.
+	int GetBlockSize( BlockFormat format );
+
+	// Size in bytes of one pixel in the matching uncompressed layout: R8G8B8A8 for BC1-3 and BC7,
+	// R8 for BC4, R8G8 for BC5 and R16G16B16A16 half floats for BC6H.
+	int GetUncompressedPixelSize( BlockFormat format );
+
+	// Encodes blocks [firstBlockX, lastBlockX) x [firstBlockY, lastBlockY). Blocks that overhang the
+	// edge of the image are padded by repeating the last row and column.
+	void CompressBlocks( BlockFormat format, BlockQuality quality, const unsigned char* source, int sourcePitch,
+		int width, int height, unsigned char* destination, int destinationPitch,
+		int firstBlockX, int firstBlockY, int lastBlockX, int lastBlockY );
+
+	// Decodes blocks [firstBlockX, lastBlockX) x [firstBlockY, lastBlockY). Pixels that fall outside
+	// the image are discarded.
+	void DecompressBlocks( BlockFormat format, const unsigned char* source, int sourcePitch,
+		int width, int height, unsigned char* destination, int destinationPitch,
+		int firstBlockX, int firstBlockY, int lastBlockX, int lastBlockY );
+}
+}
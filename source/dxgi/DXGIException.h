@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_DXGI(x) Result::Record<DXGIException^>( (x), (nullptr), (nullptr) )
+#define RECORD_DXGI(x) RECORD_RESULT( DXGIException^, x )
 
 namespace SlimDX
 {
@@ -47,7 +47,7 @@ namespace DXGI
 	{
 		UINT latency = 0;
 
-		HRESULT hr = InternalPointer->GetMaximumFrameLatency(&latency);
+		HRESULT hr = TIME_CALL( InternalPointer->GetMaximumFrameLatency(&latency) );
 		RECORD_DXGI(hr);
 
 		return latency;
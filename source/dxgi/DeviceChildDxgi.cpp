@@ -40,8 +40,7 @@ namespace DXGI
 	Device^ DeviceChild::Device::get()
 	{
 		IDXGIDevice* device = 0;
-		RECORD_DXGI( InternalPointer->GetDevice( __uuidof( device ), reinterpret_cast<void**>( &device ) ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( InternalPointer->GetDevice( __uuidof( device ), reinterpret_cast<void**>( &device ) ) ).IsFailure )
 			return nullptr;
 
 		return DXGI::Device::FromPointer( device );
@@ -84,8 +84,7 @@ namespace DXGI
 		for( int resourceIndex = 0; resourceIndex < resources->Count; ++resourceIndex )
 			nativeResources[resourceIndex] = reinterpret_cast<IUnknown*>(resources[resourceIndex]->ComPointer.ToPointer());
 		
-		RECORD_DXGI( InternalPointer->QueryResourceResidency( &nativeResources[0], &nativeResidency[0], resources->Count ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( InternalPointer->QueryResourceResidency( &nativeResources[0], &nativeResidency[0], resources->Count ) ).IsFailure )
 			return nullptr;
 		
 		List<Residency>^ result = gcnew List<Residency>( static_cast<int>( nativeResidency.size() ) );
@@ -48,8 +48,7 @@ namespace DXGI
 	Factory::Factory()
 	{
 		IDXGIFactory* factory = 0;
-		RECORD_DXGI( CreateDXGIFactory( __uuidof( IDXGIFactory ), reinterpret_cast<void**>( &factory ) ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( CreateDXGIFactory( __uuidof( IDXGIFactory ), reinterpret_cast<void**>( &factory ) ) ).IsFailure )
 			throw gcnew DXGIException( Result::Last );
 
 		Construct( factory );
@@ -76,8 +75,7 @@ namespace DXGI
 	Adapter^ Factory::GetAdapter( int index )
 	{
 		IDXGIAdapter* adapter = 0;
-		RECORD_DXGI( InternalPointer->EnumAdapters( index, &adapter) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( InternalPointer->EnumAdapters( index, &adapter) ).IsFailure )
 			return nullptr;
 		return Adapter::FromPointer( adapter, this );
 	}
@@ -69,8 +69,7 @@ namespace DXGI
 		: Factory(true)
 	{
 		IDXGIFactory1* factory = 0;
-		RECORD_DXGI( CreateDXGIFactory1( __uuidof( IDXGIFactory1 ), reinterpret_cast<void**>( &factory ) ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( CreateDXGIFactory1( __uuidof( IDXGIFactory1 ), reinterpret_cast<void**>( &factory ) ) ).IsFailure )
 			throw gcnew DXGIException( Result::Last );
 
 		Construct( factory );
@@ -97,8 +96,7 @@ namespace DXGI
 	Adapter1^ Factory1::GetAdapter1(int index)
 	{
 		IDXGIAdapter1* adapter = 0;
-		RECORD_DXGI( InternalPointer->EnumAdapters1( index, &adapter) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( InternalPointer->EnumAdapters1( index, &adapter) ).IsFailure )
 			return nullptr;
 
 		return Adapter1::FromPointer( adapter, this );
@@ -0,0 +1,526 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <d3dx9.h>
+#include <math.h>
+#include <string.h>
+
+#include "ImageProcessingKernels.h"
+
+// The kernels are compiled as native code; they run in tight per-pixel loops on worker threads.
+#pragma managed(push, off)
+
+namespace SlimDX
+{
+namespace DXGI
+{
+	namespace
+	{
+		const float Pi = 3.14159265358979f;
+		const float KaiserAlpha = 4.0f;
+		const float WindowedRadius = 3.0f;
+
+		// Number of half precision values converted per call into D3DX.
+		const int HalfChunkSize = 64;
+
+		enum ChannelType
+		{
+			ChannelUNorm8,
+			ChannelSNorm8,
+			ChannelUNorm16,
+			ChannelSNorm16,
+			ChannelFloat16,
+			ChannelFloat32,
+			ChannelPacked
+		};
+
+		// Describes how the components of a pixel map onto linear RGBA; a negative entry is ignored.
+		struct FormatLayout
+		{
+			DXGI_FORMAT Format;
+			ChannelType Type;
+			int Channels;
+			int Map[4];
+			bool Srgb;
+			int PixelSize;
+		};
+
+		const FormatLayout Layouts[] =
+		{
+			{ DXGI_FORMAT_R8G8B8A8_UNORM, ChannelUNorm8, 4, { 0, 1, 2, 3 }, false, 4 },
+			{ DXGI_FORMAT_R8G8B8A8_UNORM_SRGB, ChannelUNorm8, 4, { 0, 1, 2, 3 }, true, 4 },
+			{ DXGI_FORMAT_R8G8B8A8_SNORM, ChannelSNorm8, 4, { 0, 1, 2, 3 }, false, 4 },
+			{ DXGI_FORMAT_B8G8R8A8_UNORM, ChannelUNorm8, 4, { 2, 1, 0, 3 }, false, 4 },
+			{ DXGI_FORMAT_B8G8R8A8_UNORM_SRGB, ChannelUNorm8, 4, { 2, 1, 0, 3 }, true, 4 },
+			{ DXGI_FORMAT_B8G8R8X8_UNORM, ChannelUNorm8, 4, { 2, 1, 0, -1 }, false, 4 },
+			{ DXGI_FORMAT_B8G8R8X8_UNORM_SRGB, ChannelUNorm8, 4, { 2, 1, 0, -1 }, true, 4 },
+			{ DXGI_FORMAT_R8G8_UNORM, ChannelUNorm8, 2, { 0, 1, -1, -1 }, false, 2 },
+			{ DXGI_FORMAT_R8G8_SNORM, ChannelSNorm8, 2, { 0, 1, -1, -1 }, false, 2 },
+			{ DXGI_FORMAT_R8_UNORM, ChannelUNorm8, 1, { 0, -1, -1, -1 }, false, 1 },
+			{ DXGI_FORMAT_R8_SNORM, ChannelSNorm8, 1, { 0, -1, -1, -1 }, false, 1 },
+			{ DXGI_FORMAT_A8_UNORM, ChannelUNorm8, 1, { 3, -1, -1, -1 }, false, 1 },
+			{ DXGI_FORMAT_R16G16B16A16_UNORM, ChannelUNorm16, 4, { 0, 1, 2, 3 }, false, 8 },
+			{ DXGI_FORMAT_R16G16B16A16_SNORM, ChannelSNorm16, 4, { 0, 1, 2, 3 }, false, 8 },
+			{ DXGI_FORMAT_R16G16_UNORM, ChannelUNorm16, 2, { 0, 1, -1, -1 }, false, 4 },
+			{ DXGI_FORMAT_R16G16_SNORM, ChannelSNorm16, 2, { 0, 1, -1, -1 }, false, 4 },
+			{ DXGI_FORMAT_R16_UNORM, ChannelUNorm16, 1, { 0, -1, -1, -1 }, false, 2 },
+			{ DXGI_FORMAT_R16_SNORM, ChannelSNorm16, 1, { 0, -1, -1, -1 }, false, 2 },
+			{ DXGI_FORMAT_R16G16B16A16_FLOAT, ChannelFloat16, 4, { 0, 1, 2, 3 }, false, 8 },
+			{ DXGI_FORMAT_R16G16_FLOAT, ChannelFloat16, 2, { 0, 1, -1, -1 }, false, 4 },
+			{ DXGI_FORMAT_R16_FLOAT, ChannelFloat16, 1, { 0, -1, -1, -1 }, false, 2 },
+			{ DXGI_FORMAT_R32G32B32A32_FLOAT, ChannelFloat32, 4, { 0, 1, 2, 3 }, false, 16 },
+			{ DXGI_FORMAT_R32G32B32_FLOAT, ChannelFloat32, 3, { 0, 1, 2, -1 }, false, 12 },
+			{ DXGI_FORMAT_R32G32_FLOAT, ChannelFloat32, 2, { 0, 1, -1, -1 }, false, 8 },
+			{ DXGI_FORMAT_R32_FLOAT, ChannelFloat32, 1, { 0, -1, -1, -1 }, false, 4 },
+			{ DXGI_FORMAT_R10G10B10A2_UNORM, ChannelPacked, 4, { 0, 1, 2, 3 }, false, 4 },
+			{ DXGI_FORMAT_B5G6R5_UNORM, ChannelPacked, 3, { 0, 1, 2, -1 }, false, 2 },
+			{ DXGI_FORMAT_B5G5R5A1_UNORM, ChannelPacked, 4, { 0, 1, 2, 3 }, false, 2 }
+		};
+
+		// 8 bit sRGB values decoded to linear, filled when the module loads.
+		struct SrgbTable
+		{
+			float Linear[256];
+
+			SrgbTable()
+			{
+				for( int i = 0; i < 256; ++i )
+				{
+					float value = i / 255.0f;
+					Linear[i] = value <= 0.04045f ? value / 12.92f : powf( ( value + 0.055f ) / 1.055f, 2.4f );
+				}
+			}
+		};
+
+		const SrgbTable Srgb;
+
+		const FormatLayout* FindLayout( DXGI_FORMAT format )
+		{
+			for( int i = 0; i < static_cast<int>( sizeof( Layouts ) / sizeof( Layouts[0] ) ); ++i )
+			{
+				if( Layouts[i].Format == format )
+					return &Layouts[i];
+			}
+
+			return NULL;
+		}
+
+		// Clamps to [0, 1], mapping NaN to zero.
+		float Saturate( float value )
+		{
+			return !( value > 0.0f ) ? 0.0f : ( value > 1.0f ? 1.0f : value );
+		}
+
+		float ClampSigned( float value )
+		{
+			return !( value > -1.0f ) ? -1.0f : ( value > 1.0f ? 1.0f : value );
+		}
+
+		float EncodeSrgb( float value )
+		{
+			value = Saturate( value );
+			return value <= 0.0031308f ? value * 12.92f : 1.055f * powf( value, 1.0f / 2.4f ) - 0.055f;
+		}
+
+		int ToUNorm( float value, int maximum )
+		{
+			return static_cast<int>( Saturate( value ) * maximum + 0.5f );
+		}
+
+		int ToSNorm( float value, int maximum )
+		{
+			return static_cast<int>( floor( ClampSigned( value ) * maximum + 0.5f ) );
+		}
+
+		void LoadPackedRow( DXGI_FORMAT format, const unsigned char* source, int width, float* destination )
+		{
+			for( int x = 0; x < width; ++x )
+			{
+				float* pixel = destination + x * 4;
+
+				if( format == DXGI_FORMAT_R10G10B10A2_UNORM )
+				{
+					unsigned int value = reinterpret_cast<const unsigned int*>( source )[x];
+					pixel[0] = ( value & 0x3FF ) / 1023.0f;
+					pixel[1] = ( ( value >> 10 ) & 0x3FF ) / 1023.0f;
+					pixel[2] = ( ( value >> 20 ) & 0x3FF ) / 1023.0f;
+					pixel[3] = ( value >> 30 ) / 3.0f;
+				}
+				else if( format == DXGI_FORMAT_B5G6R5_UNORM )
+				{
+					unsigned int value = reinterpret_cast<const unsigned short*>( source )[x];
+					pixel[0] = ( ( value >> 11 ) & 31 ) / 31.0f;
+					pixel[1] = ( ( value >> 5 ) & 63 ) / 63.0f;
+					pixel[2] = ( value & 31 ) / 31.0f;
+					pixel[3] = 1.0f;
+				}
+				else
+				{
+					unsigned int value = reinterpret_cast<const unsigned short*>( source )[x];
+					pixel[0] = ( ( value >> 10 ) & 31 ) / 31.0f;
+					pixel[1] = ( ( value >> 5 ) & 31 ) / 31.0f;
+					pixel[2] = ( value & 31 ) / 31.0f;
+					pixel[3] = static_cast<float>( value >> 15 );
+				}
+			}
+		}
+
+		void StorePackedRow( DXGI_FORMAT format, const float* source, int width, unsigned char* destination )
+		{
+			for( int x = 0; x < width; ++x )
+			{
+				const float* pixel = source + x * 4;
+
+				if( format == DXGI_FORMAT_R10G10B10A2_UNORM )
+				{
+					reinterpret_cast<unsigned int*>( destination )[x] = static_cast<unsigned int>( ToUNorm( pixel[0], 1023 ) |
+						( ToUNorm( pixel[1], 1023 ) << 10 ) | ( ToUNorm( pixel[2], 1023 ) << 20 ) ) | ( static_cast<unsigned int>( ToUNorm( pixel[3], 3 ) ) << 30 );
+				}
+				else if( format == DXGI_FORMAT_B5G6R5_UNORM )
+				{
+					reinterpret_cast<unsigned short*>( destination )[x] = static_cast<unsigned short>(
+						( ToUNorm( pixel[0], 31 ) << 11 ) | ( ToUNorm( pixel[1], 63 ) << 5 ) | ToUNorm( pixel[2], 31 ) );
+				}
+				else
+				{
+					reinterpret_cast<unsigned short*>( destination )[x] = static_cast<unsigned short>(
+						( ToUNorm( pixel[0], 31 ) << 10 ) | ( ToUNorm( pixel[1], 31 ) << 5 ) | ToUNorm( pixel[2], 31 ) | ( ToUNorm( pixel[3], 1 ) << 15 ) );
+				}
+			}
+		}
+
+		void LoadRow( const FormatLayout& layout, const unsigned char* source, int width, float* destination )
+		{
+			if( layout.Type == ChannelPacked )
+			{
+				LoadPackedRow( layout.Format, source, width, destination );
+				return;
+			}
+
+			for( int x = 0; x < width; ++x )
+			{
+				destination[x * 4 + 0] = 0.0f;
+				destination[x * 4 + 1] = 0.0f;
+				destination[x * 4 + 2] = 0.0f;
+				destination[x * 4 + 3] = 1.0f;
+			}
+
+			int count = width * layout.Channels;
+			float halves[HalfChunkSize];
+
+			for( int i = 0; i < count; ++i )
+			{
+				int channel = layout.Map[i % layout.Channels];
+				float value;
+
+				switch( layout.Type )
+				{
+				case ChannelUNorm8:
+					value = layout.Srgb && channel < 3 ? Srgb.Linear[source[i]] : source[i] / 255.0f;
+					break;
+
+				case ChannelSNorm8:
+					value = ClampSigned( reinterpret_cast<const signed char*>( source )[i] / 127.0f );
+					break;
+
+				case ChannelUNorm16:
+					value = reinterpret_cast<const unsigned short*>( source )[i] / 65535.0f;
+					break;
+
+				case ChannelSNorm16:
+					value = ClampSigned( reinterpret_cast<const short*>( source )[i] / 32767.0f );
+					break;
+
+				case ChannelFloat16:
+					if( i % HalfChunkSize == 0 )
+					{
+						int chunk = count - i < HalfChunkSize ? count - i : HalfChunkSize;
+						D3DXFloat16To32Array( halves, reinterpret_cast<const D3DXFLOAT16*>( source ) + i, chunk );
+					}
+
+					value = halves[i % HalfChunkSize];
+					break;
+
+				default:
+					value = reinterpret_cast<const float*>( source )[i];
+					break;
+				}
+
+				if( channel >= 0 )
+					destination[( i / layout.Channels ) * 4 + channel] = value;
+			}
+		}
+
+		void StoreRow( const FormatLayout& layout, const float* source, int width, unsigned char* destination )
+		{
+			if( layout.Type == ChannelPacked )
+			{
+				StorePackedRow( layout.Format, source, width, destination );
+				return;
+			}
+
+			int count = width * layout.Channels;
+			float halves[HalfChunkSize];
+
+			for( int i = 0; i < count; ++i )
+			{
+				int channel = layout.Map[i % layout.Channels];
+				float value = channel >= 0 ? source[( i / layout.Channels ) * 4 + channel] : 1.0f;
+
+				switch( layout.Type )
+				{
+				case ChannelUNorm8:
+					destination[i] = static_cast<unsigned char>( ToUNorm( layout.Srgb && channel >= 0 && channel < 3 ? EncodeSrgb( value ) : value, 255 ) );
+					break;
+
+				case ChannelSNorm8:
+					reinterpret_cast<signed char*>( destination )[i] = static_cast<signed char>( ToSNorm( value, 127 ) );
+					break;
+
+				case ChannelUNorm16:
+					reinterpret_cast<unsigned short*>( destination )[i] = static_cast<unsigned short>( ToUNorm( value, 65535 ) );
+					break;
+
+				case ChannelSNorm16:
+					reinterpret_cast<short*>( destination )[i] = static_cast<short>( ToSNorm( value, 32767 ) );
+					break;
+
+				case ChannelFloat16:
+					halves[i % HalfChunkSize] = value;
+					if( i % HalfChunkSize == HalfChunkSize - 1 || i == count - 1 )
+					{
+						int chunk = i % HalfChunkSize + 1;
+						D3DXFloat32To16Array( reinterpret_cast<D3DXFLOAT16*>( destination ) + i + 1 - chunk, halves, chunk );
+					}
+					break;
+
+				default:
+					reinterpret_cast<float*>( destination )[i] = value;
+					break;
+				}
+			}
+		}
+
+		float Sinc( float x )
+		{
+			if( fabs( x ) < 1e-5f )
+				return 1.0f;
+
+			x *= Pi;
+			return sinf( x ) / x;
+		}
+
+		float BesselI0( float x )
+		{
+			float sum = 1.0f;
+			float term = 1.0f;
+			float half = x * 0.5f;
+
+			for( int k = 1; k < 32; ++k )
+			{
+				term *= ( half / k ) * ( half / k );
+				sum += term;
+				if( term < sum * 1e-8f )
+					break;
+			}
+
+			return sum;
+		}
+
+		float FilterRadius( ResampleFilter filter )
+		{
+			return filter == ResampleFilterBox ? 0.5f : WindowedRadius;
+		}
+
+		float FilterValue( ResampleFilter filter, float x )
+		{
+			x = fabs( x );
+
+			switch( filter )
+			{
+			case ResampleFilterKaiser:
+				if( x >= WindowedRadius )
+					return 0.0f;
+				return Sinc( x ) * BesselI0( KaiserAlpha * sqrt( 1.0f - ( x / WindowedRadius ) * ( x / WindowedRadius ) ) ) / BesselI0( KaiserAlpha );
+
+			case ResampleFilterLanczos:
+				if( x >= WindowedRadius )
+					return 0.0f;
+				return Sinc( x ) * Sinc( x / WindowedRadius );
+
+			default:
+				return x <= 0.5f ? 1.0f : 0.0f;
+			}
+		}
+	}
+
+	bool IsImageFormatSupported( DXGI_FORMAT format )
+	{
+		return FindLayout( format ) != NULL;
+	}
+
+	int GetImagePixelSize( DXGI_FORMAT format )
+	{
+		const FormatLayout* layout = FindLayout( format );
+		return layout != NULL ? layout->PixelSize : 0;
+	}
+
+	void BuildFilterWeights( ResampleFilter filter, int sourceSize, int destinationSize, FilterWeights& weights )
+	{
+		float scale = static_cast<float>( sourceSize ) / destinationSize;
+
+		// when shrinking, the filter is stretched to cover every source pixel that lands in the destination pixel
+		float stretch = scale > 1.0f ? scale : 1.0f;
+		float support = FilterRadius( filter ) * stretch;
+
+		weights.First.resize( destinationSize );
+		weights.Count.resize( destinationSize );
+		weights.Offset.resize( destinationSize );
+		weights.Weights.clear();
+
+		for( int i = 0; i < destinationSize; ++i )
+		{
+			float center = ( i + 0.5f ) * scale;
+			int first = static_cast<int>( floor( center - support ) );
+			int last = static_cast<int>( ceil( center + support ) );
+			first = first < 0 ? 0 : first;
+			last = last > sourceSize - 1 ? sourceSize - 1 : last;
+
+			int offset = static_cast<int>( weights.Weights.size() );
+			float sum = 0.0f;
+			for( int j = first; j <= last; ++j )
+			{
+				float weight = FilterValue( filter, ( j + 0.5f - center ) / stretch );
+				weights.Weights.push_back( weight );
+				sum += weight;
+			}
+
+			// taps past the edges are dropped and the remainder renormalized
+			if( sum != 0.0f )
+			{
+				for( int j = offset; j < static_cast<int>( weights.Weights.size() ); ++j )
+					weights.Weights[j] /= sum;
+			}
+			else
+			{
+				int nearest = static_cast<int>( center );
+				first = nearest < sourceSize ? nearest : sourceSize - 1;
+				last = first;
+				weights.Weights.resize( offset );
+				weights.Weights.push_back( 1.0f );
+			}
+
+			weights.First[i] = first;
+			weights.Count[i] = last - first + 1;
+			weights.Offset[i] = offset;
+		}
+	}
+
+	void ResampleHorizontalRows( const ResampleJob& job, int firstRow, int lastRow )
+	{
+		const FormatLayout* layout = FindLayout( job.SourceFormat );
+		const FilterWeights& weights = job.Horizontal;
+		std::vector<float> row( job.SourceLinear == NULL ? job.SourceWidth * 4 : 0 );
+
+		for( int y = firstRow; y < lastRow; ++y )
+		{
+			const float* source;
+			if( job.SourceLinear != NULL )
+			{
+				source = job.SourceLinear + static_cast<size_t>( y ) * job.SourceWidth * 4;
+			}
+			else
+			{
+				LoadRow( *layout, job.Source + static_cast<size_t>( y ) * job.SourcePitch, job.SourceWidth, &row[0] );
+				source = &row[0];
+			}
+
+			float* destination = job.Intermediate + static_cast<size_t>( y ) * job.DestinationWidth * 4;
+			for( int x = 0; x < job.DestinationWidth; ++x )
+			{
+				const float* taps = &weights.Weights[weights.Offset[x]];
+				const float* pixel = source + weights.First[x] * 4;
+				float r = 0.0f;
+				float g = 0.0f;
+				float b = 0.0f;
+				float a = 0.0f;
+
+				for( int t = 0; t < weights.Count[x]; ++t, pixel += 4 )
+				{
+					r += pixel[0] * taps[t];
+					g += pixel[1] * taps[t];
+					b += pixel[2] * taps[t];
+					a += pixel[3] * taps[t];
+				}
+
+				destination[x * 4 + 0] = r;
+				destination[x * 4 + 1] = g;
+				destination[x * 4 + 2] = b;
+				destination[x * 4 + 3] = a;
+			}
+		}
+	}
+
+	void ResampleVerticalRows( const ResampleJob& job, int firstRow, int lastRow )
+	{
+		const FormatLayout* layout = FindLayout( job.DestinationFormat );
+		const FilterWeights& weights = job.Vertical;
+		int count = job.DestinationWidth * 4;
+		std::vector<float> row( count );
+
+		for( int y = firstRow; y < lastRow; ++y )
+		{
+			float* target = job.DestinationLinear != NULL ? job.DestinationLinear + static_cast<size_t>( y ) * count : &row[0];
+			memset( target, 0, count * sizeof( float ) );
+
+			for( int t = 0; t < weights.Count[y]; ++t )
+			{
+				const float* source = job.Intermediate + static_cast<size_t>( weights.First[y] + t ) * count;
+				float weight = weights.Weights[weights.Offset[y] + t];
+
+				for( int i = 0; i < count; ++i )
+					target[i] += source[i] * weight;
+			}
+
+			StoreRow( *layout, target, job.DestinationWidth, job.Destination + static_cast<size_t>( y ) * job.DestinationPitch );
+		}
+	}
+
+	void ConvertImageRows( DXGI_FORMAT sourceFormat, const unsigned char* source, int sourcePitch,
+		DXGI_FORMAT destinationFormat, unsigned char* destination, int destinationPitch,
+		int width, int firstRow, int lastRow )
+	{
+		const FormatLayout* sourceLayout = FindLayout( sourceFormat );
+		const FormatLayout* destinationLayout = FindLayout( destinationFormat );
+		std::vector<float> row( width * 4 );
+
+		for( int y = firstRow; y < lastRow; ++y )
+		{
+			LoadRow( *sourceLayout, source + static_cast<size_t>( y ) * sourcePitch, width, &row[0] );
+			StoreRow( *destinationLayout, &row[0], width, destination + static_cast<size_t>( y ) * destinationPitch );
+		}
+	}
+}
+}
+
+#pragma managed(pop)
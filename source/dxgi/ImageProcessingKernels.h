@@ -0,0 +1,89 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+namespace SlimDX
+{
+namespace DXGI
+{
+	// Native row kernels shared by the managed ImageProcessor API. Images are processed as rows of
+	// linear RGBA floats; each entry point works on a range of rows so that callers can split an
+	// image into bands and process them on separate threads.
+
+	enum ResampleFilter
+	{
+		ResampleFilterBox,
+		ResampleFilterKaiser,
+		ResampleFilterLanczos
+	};
+
+	// Source taps for each destination pixel along one axis.
+	struct FilterWeights
+	{
+		std::vector<int> First;
+		std::vector<int> Count;
+		std::vector<int> Offset;
+		std::vector<float> Weights;
+	};
+
+	struct ResampleJob
+	{
+		DXGI_FORMAT SourceFormat;
+		const unsigned char* Source;
+		int SourcePitch;
+		const float* SourceLinear;
+		int SourceWidth;
+		int SourceHeight;
+
+		// SourceHeight rows of DestinationWidth pixels, filtered horizontally only
+		float* Intermediate;
+
+		DXGI_FORMAT DestinationFormat;
+		unsigned char* Destination;
+		int DestinationPitch;
+		float* DestinationLinear;
+		int DestinationWidth;
+		int DestinationHeight;
+
+		FilterWeights Horizontal;
+		FilterWeights Vertical;
+	};
+
+	bool IsImageFormatSupported( DXGI_FORMAT format );
+	int GetImagePixelSize( DXGI_FORMAT format );
+
+	void BuildFilterWeights( ResampleFilter filter, int sourceSize, int destinationSize, FilterWeights& weights );
+
+	// Loads source rows [firstRow, lastRow) from Source, or SourceLinear when it is set, and filters them into Intermediate.
+	void ResampleHorizontalRows( const ResampleJob& job, int firstRow, int lastRow );
+
+	// Filters destination rows [firstRow, lastRow) from Intermediate and stores them to Destination and, when set, DestinationLinear.
+	void ResampleVerticalRows( const ResampleJob& job, int firstRow, int lastRow );
+
+	// Converts rows [firstRow, lastRow) between two supported formats.
+	void ConvertImageRows( DXGI_FORMAT sourceFormat, const unsigned char* source, int sourcePitch,
+		DXGI_FORMAT destinationFormat, unsigned char* destination, int destinationPitch,
+		int width, int firstRow, int lastRow );
+}
+}
@@ -0,0 +1,371 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "../DataStream.h"
+
+#include "ImageProcessor.h"
+#include "ImageProcessingKernels.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace SlimDX
+{
+namespace DXGI
+{
+	// Rows are handed out in bands; large enough to amortize scheduling, small enough to balance.
+	const int BandSizeInRows = 16;
+
+	enum ImagePass
+	{
+		ImagePassHorizontal,
+		ImagePassVertical,
+		ImagePassConvert
+	};
+
+	static DXGI_FORMAT GetImageFormat( Format format, String^ name )
+	{
+		if( !IsImageFormatSupported( static_cast<DXGI_FORMAT>( format ) ) )
+			throw gcnew ArgumentException( "The format is not supported by the image processor.", name );
+
+		return static_cast<DXGI_FORMAT>( format );
+	}
+
+	static void CheckSize( int width, int height )
+	{
+		if( width <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "width", "Width must be greater than zero." );
+		if( height <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "height", "Height must be greater than zero." );
+	}
+
+	static void CheckBox( DataBox^ box, String^ name, int rowBytes, int rows )
+	{
+		if( box == nullptr )
+			throw gcnew ArgumentNullException( name );
+		if( box->RowPitch < rowBytes )
+			throw gcnew ArgumentException( "The row pitch is too small for the image width.", name );
+		if( box->Data->RemainingLength < static_cast<Int64>( box->RowPitch ) * ( rows - 1 ) + rowBytes )
+			throw gcnew ArgumentException( "The data stream is too small for the image.", name );
+	}
+
+	static DataBox^ CreateBox( DXGI_FORMAT format, int width, int height )
+	{
+		int rowPitch = width * GetImagePixelSize( format );
+		int slicePitch = rowPitch * height;
+		return gcnew DataBox( rowPitch, slicePitch, gcnew DataStream( slicePitch, true, true ) );
+	}
+
+	static unsigned char* GetPointer( DataBox^ box )
+	{
+		return reinterpret_cast<unsigned char*>( box->Data->PositionPointer );
+	}
+
+	ref class ImageProcessingWorker
+	{
+	private:
+		ManualResetEvent^ m_Done;
+		Exception^ m_Error;
+		int m_NextBand;
+		int m_Pending;
+		int m_Rows;
+		int m_BandCount;
+
+		ImagePass m_Pass;
+		const ResampleJob* m_Job;
+
+		DXGI_FORMAT m_SourceFormat;
+		const unsigned char* m_Source;
+		int m_SourcePitch;
+		DXGI_FORMAT m_DestinationFormat;
+		unsigned char* m_Destination;
+		int m_DestinationPitch;
+		int m_Width;
+
+		void Execute( Object^ )
+		{
+			try
+			{
+				for( int band = Interlocked::Increment( m_NextBand ); band < m_BandCount; band = Interlocked::Increment( m_NextBand ) )
+				{
+					int firstRow = band * BandSizeInRows;
+					int lastRow = firstRow + BandSizeInRows < m_Rows ? firstRow + BandSizeInRows : m_Rows;
+
+					switch( m_Pass )
+					{
+					case ImagePassHorizontal:
+						ResampleHorizontalRows( *m_Job, firstRow, lastRow );
+						break;
+
+					case ImagePassVertical:
+						ResampleVerticalRows( *m_Job, firstRow, lastRow );
+						break;
+
+					default:
+						ConvertImageRows( m_SourceFormat, m_Source, m_SourcePitch, m_DestinationFormat, m_Destination, m_DestinationPitch,
+							m_Width, firstRow, lastRow );
+						break;
+					}
+				}
+			}
+			catch( Exception^ e )
+			{
+				// an exception escaping a pool thread would end the process, so the first one is rethrown by Run instead
+				Interlocked::CompareExchange<Exception^>( m_Error, e, nullptr );
+				Interlocked::Exchange( m_NextBand, m_BandCount );
+			}
+			finally
+			{
+				if( Interlocked::Decrement( m_Pending ) == 0 && m_Done != nullptr )
+					m_Done->Set();
+			}
+		}
+
+		void Run( int rows, int maximumThreads )
+		{
+			m_Rows = rows;
+			m_BandCount = ( rows + BandSizeInRows - 1 ) / BandSizeInRows;
+
+			int threads = maximumThreads < m_BandCount ? maximumThreads : m_BandCount;
+			m_NextBand = -1;
+			m_Pending = threads;
+			m_Done = nullptr;
+			m_Error = nullptr;
+
+			if( threads > 1 )
+			{
+				m_Done = gcnew ManualResetEvent( false );
+
+				WaitCallback^ callback = gcnew WaitCallback( this, &ImageProcessingWorker::Execute );
+				for( int i = 1; i < threads; ++i )
+					ThreadPool::QueueUserWorkItem( callback );
+			}
+
+			try
+			{
+				// the calling thread takes bands as well instead of idling
+				Execute( nullptr );
+			}
+			finally
+			{
+				// the workers write into buffers owned by our caller, so they must finish before we return or throw
+				if( m_Done != nullptr )
+				{
+					m_Done->WaitOne();
+					m_Done->Close();
+				}
+			}
+
+			if( m_Error != nullptr )
+				throw m_Error;
+		}
+
+	public:
+		void Resample( const ResampleJob& job, int maximumThreads )
+		{
+			m_Job = &job;
+
+			// every vertical band reads intermediate rows from several horizontal bands, so the passes cannot overlap
+			m_Pass = ImagePassHorizontal;
+			Run( job.SourceHeight, maximumThreads );
+
+			m_Pass = ImagePassVertical;
+			Run( job.DestinationHeight, maximumThreads );
+		}
+
+		void Convert( DXGI_FORMAT sourceFormat, const unsigned char* source, int sourcePitch,
+			DXGI_FORMAT destinationFormat, unsigned char* destination, int destinationPitch,
+			int width, int height, int maximumThreads )
+		{
+			m_Pass = ImagePassConvert;
+			m_SourceFormat = sourceFormat;
+			m_Source = source;
+			m_SourcePitch = sourcePitch;
+			m_DestinationFormat = destinationFormat;
+			m_Destination = destination;
+			m_DestinationPitch = destinationPitch;
+			m_Width = width;
+
+			Run( height, maximumThreads );
+		}
+	};
+
+	static ImageProcessor::ImageProcessor()
+	{
+		m_MaximumDegreeOfParallelism = Environment::ProcessorCount;
+	}
+
+	ImageProcessor::ImageProcessor()
+	{
+	}
+
+	bool ImageProcessor::IsFormatSupported( Format format )
+	{
+		return IsImageFormatSupported( static_cast<DXGI_FORMAT>( format ) );
+	}
+
+	void ImageProcessor::MaximumDegreeOfParallelism::set( int value )
+	{
+		if( value <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "value", "The degree of parallelism must be greater than zero." );
+
+		m_MaximumDegreeOfParallelism = value;
+	}
+
+	DataBox^ ImageProcessor::Convert( DataBox^ source, int width, int height, Format sourceFormat, Format destinationFormat )
+	{
+		CheckSize( width, height );
+
+		DataBox^ destination = CreateBox( GetImageFormat( destinationFormat, "destinationFormat" ), width, height );
+		Convert( source, width, height, sourceFormat, destination, destinationFormat );
+		return destination;
+	}
+
+	void ImageProcessor::Convert( DataBox^ source, int width, int height, Format sourceFormat, DataBox^ destination, Format destinationFormat )
+	{
+		CheckSize( width, height );
+
+		DXGI_FORMAT nativeSourceFormat = GetImageFormat( sourceFormat, "sourceFormat" );
+		DXGI_FORMAT nativeDestinationFormat = GetImageFormat( destinationFormat, "destinationFormat" );
+		CheckBox( source, "source", width * GetImagePixelSize( nativeSourceFormat ), height );
+		CheckBox( destination, "destination", width * GetImagePixelSize( nativeDestinationFormat ), height );
+
+		ImageProcessingWorker^ worker = gcnew ImageProcessingWorker();
+		worker->Convert( nativeSourceFormat, GetPointer( source ), source->RowPitch,
+			nativeDestinationFormat, GetPointer( destination ), destination->RowPitch, width, height, m_MaximumDegreeOfParallelism );
+	}
+
+	DataBox^ ImageProcessor::Resize( DataBox^ source, int width, int height, Format format, int newWidth, int newHeight, ImageFilter filter )
+	{
+		CheckSize( width, height );
+		if( newWidth <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "newWidth", "Width must be greater than zero." );
+		if( newHeight <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "newHeight", "Height must be greater than zero." );
+		if( filter < ImageFilter::Box || filter > ImageFilter::Lanczos )
+			throw gcnew ArgumentOutOfRangeException( "filter" );
+
+		DXGI_FORMAT nativeFormat = GetImageFormat( format, "format" );
+		CheckBox( source, "source", width * GetImagePixelSize( nativeFormat ), height );
+
+		DataBox^ destination = CreateBox( nativeFormat, newWidth, newHeight );
+		std::vector<float> intermediate( static_cast<size_t>( height ) * newWidth * 4 );
+
+		ResampleJob job;
+		job.SourceFormat = nativeFormat;
+		job.Source = GetPointer( source );
+		job.SourcePitch = source->RowPitch;
+		job.SourceLinear = NULL;
+		job.SourceWidth = width;
+		job.SourceHeight = height;
+		job.Intermediate = &intermediate[0];
+		job.DestinationFormat = nativeFormat;
+		job.Destination = GetPointer( destination );
+		job.DestinationPitch = destination->RowPitch;
+		job.DestinationLinear = NULL;
+		job.DestinationWidth = newWidth;
+		job.DestinationHeight = newHeight;
+		BuildFilterWeights( static_cast<ResampleFilter>( filter ), width, newWidth, job.Horizontal );
+		BuildFilterWeights( static_cast<ResampleFilter>( filter ), height, newHeight, job.Vertical );
+
+		ImageProcessingWorker^ worker = gcnew ImageProcessingWorker();
+		worker->Resample( job, m_MaximumDegreeOfParallelism );
+		return destination;
+	}
+
+	array<DataBox^>^ ImageProcessor::GenerateMipChain( DataBox^ source, int width, int height, Format format, ImageFilter filter )
+	{
+		return GenerateMipChain( source, width, height, format, filter, 0 );
+	}
+
+	array<DataBox^>^ ImageProcessor::GenerateMipChain( DataBox^ source, int width, int height, Format format, ImageFilter filter, int mipLevels )
+	{
+		CheckSize( width, height );
+		if( filter < ImageFilter::Box || filter > ImageFilter::Lanczos )
+			throw gcnew ArgumentOutOfRangeException( "filter" );
+
+		int completeLevels = 1;
+		for( int size = width > height ? width : height; size > 1; size /= 2 )
+			++completeLevels;
+
+		if( mipLevels < 0 || mipLevels > completeLevels )
+			throw gcnew ArgumentOutOfRangeException( "mipLevels", "The number of mip levels must be between zero and the length of a complete chain." );
+		if( mipLevels == 0 )
+			mipLevels = completeLevels;
+
+		DXGI_FORMAT nativeFormat = GetImageFormat( format, "format" );
+		int rowBytes = width * GetImagePixelSize( nativeFormat );
+		CheckBox( source, "source", rowBytes, height );
+
+		array<DataBox^>^ levels = gcnew array<DataBox^>( mipLevels );
+		levels[0] = CreateBox( nativeFormat, width, height );
+
+		const unsigned char* sourceRows = GetPointer( source );
+		unsigned char* topRows = GetPointer( levels[0] );
+		for( int y = 0; y < height; ++y )
+			memcpy( topRows + static_cast<size_t>( y ) * rowBytes, sourceRows + static_cast<size_t>( y ) * source->RowPitch, rowBytes );
+
+		// the first level reads the packed source; later levels read the linear result of the level above
+		std::vector<float> previousLinear;
+		std::vector<float> currentLinear;
+		std::vector<float> intermediate;
+		ImageProcessingWorker^ worker = gcnew ImageProcessingWorker();
+
+		for( int level = 1; level < mipLevels; ++level )
+		{
+			int previousWidth = width;
+			int previousHeight = height;
+			width = width > 1 ? width / 2 : 1;
+			height = height > 1 ? height / 2 : 1;
+
+			levels[level] = CreateBox( nativeFormat, width, height );
+			intermediate.resize( static_cast<size_t>( previousHeight ) * width * 4 );
+			currentLinear.resize( static_cast<size_t>( height ) * width * 4 );
+
+			ResampleJob job;
+			job.SourceFormat = nativeFormat;
+			job.Source = sourceRows;
+			job.SourcePitch = source->RowPitch;
+			job.SourceLinear = level > 1 ? &previousLinear[0] : NULL;
+			job.SourceWidth = previousWidth;
+			job.SourceHeight = previousHeight;
+			job.Intermediate = &intermediate[0];
+			job.DestinationFormat = nativeFormat;
+			job.Destination = GetPointer( levels[level] );
+			job.DestinationPitch = levels[level]->RowPitch;
+			job.DestinationLinear = &currentLinear[0];
+			job.DestinationWidth = width;
+			job.DestinationHeight = height;
+			BuildFilterWeights( static_cast<ResampleFilter>( filter ), previousWidth, width, job.Horizontal );
+			BuildFilterWeights( static_cast<ResampleFilter>( filter ), previousHeight, height, job.Vertical );
+
+			worker->Resample( job, m_MaximumDegreeOfParallelism );
+			previousLinear.swap( currentLinear );
+		}
+
+		return levels;
+	}
+}
+}
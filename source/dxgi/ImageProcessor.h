@@ -0,0 +1,150 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../DataBox.h"
+
+#include "Enums.h"
+
+namespace SlimDX
+{
+	namespace DXGI
+	{
+		/// <summary>
+		/// Specifies the filter used by <see cref="ImageProcessor"/> when resizing images.
+		/// </summary>
+		/// <unmanaged>None</unmanaged>
+		public enum class ImageFilter : System::Int32
+		{
+			/// <summary>
+			/// Averages the source pixels covered by each destination pixel. Cheapest, but prone to aliasing.
+			/// </summary>
+			Box,
+
+			/// <summary>
+			/// A Kaiser windowed sinc filter with a radius of three pixels. Sharp with little ringing; a good default for mip maps.
+			/// </summary>
+			Kaiser,
+
+			/// <summary>
+			/// A three lobed Lanczos filter. The sharpest of the filters, with slightly more ringing than <see cref="Kaiser"/>.
+			/// </summary>
+			Lanczos
+		};
+
+		/// <summary>
+		/// Converts, resizes and generates mip chains for uncompressed images on the CPU, without requiring a device.
+		/// </summary>
+		/// <remarks>
+		/// Pixels are filtered as linear floating point RGBA; sRGB formats are decoded before filtering and encoded afterwards.
+		/// Missing channels read as zero, except alpha which reads as one. Images are split into bands of rows
+		/// that are processed on up to <see cref="MaximumDegreeOfParallelism"/> threads.
+		/// </remarks>
+		/// <unmanaged>None</unmanaged>
+		public ref class ImageProcessor sealed
+		{
+		private:
+			static int m_MaximumDegreeOfParallelism;
+
+			static ImageProcessor();
+			ImageProcessor();
+
+		public:
+			/// <summary>
+			/// Determines whether the specified format can be read and written by <see cref="ImageProcessor"/>.
+			/// </summary>
+			/// <param name="format">The format to check.</param>
+			/// <returns><c>true</c> if the format is supported; otherwise, <c>false</c>.</returns>
+			static bool IsFormatSupported( Format format );
+
+			/// <summary>
+			/// Converts an image to another format.
+			/// </summary>
+			/// <param name="source">The source image.</param>
+			/// <param name="width">The width of the image, in pixels.</param>
+			/// <param name="height">The height of the image, in pixels.</param>
+			/// <param name="sourceFormat">The format of the source image.</param>
+			/// <param name="destinationFormat">The format to convert to.</param>
+			/// <returns>A new box holding the converted image.</returns>
+			static DataBox^ Convert( DataBox^ source, int width, int height, Format sourceFormat, Format destinationFormat );
+
+			/// <summary>
+			/// Converts an image to another format into existing storage.
+			/// </summary>
+			/// <param name="source">The source image.</param>
+			/// <param name="width">The width of the image, in pixels.</param>
+			/// <param name="height">The height of the image, in pixels.</param>
+			/// <param name="sourceFormat">The format of the source image.</param>
+			/// <param name="destination">The box that receives the converted image.</param>
+			/// <param name="destinationFormat">The format to convert to.</param>
+			static void Convert( DataBox^ source, int width, int height, Format sourceFormat, DataBox^ destination, Format destinationFormat );
+
+			/// <summary>
+			/// Resizes an image.
+			/// </summary>
+			/// <param name="source">The source image.</param>
+			/// <param name="width">The width of the source image, in pixels.</param>
+			/// <param name="height">The height of the source image, in pixels.</param>
+			/// <param name="format">The format of the source and resized images.</param>
+			/// <param name="newWidth">The width of the resized image, in pixels.</param>
+			/// <param name="newHeight">The height of the resized image, in pixels.</param>
+			/// <param name="filter">The filter used to resample the image.</param>
+			/// <returns>A new box holding the resized image.</returns>
+			static DataBox^ Resize( DataBox^ source, int width, int height, Format format, int newWidth, int newHeight, ImageFilter filter );
+
+			/// <summary>
+			/// Generates a complete mip chain for an image.
+			/// </summary>
+			/// <param name="source">The top level image.</param>
+			/// <param name="width">The width of the image, in pixels.</param>
+			/// <param name="height">The height of the image, in pixels.</param>
+			/// <param name="format">The format of the image and of every generated level.</param>
+			/// <param name="filter">The filter used to produce each level.</param>
+			/// <returns>One box per mip level, starting with a copy of the top level and ending with a 1x1 image.</returns>
+			static array<DataBox^>^ GenerateMipChain( DataBox^ source, int width, int height, Format format, ImageFilter filter );
+
+			/// <summary>
+			/// Generates a mip chain for an image.
+			/// </summary>
+			/// <param name="source">The top level image.</param>
+			/// <param name="width">The width of the image, in pixels.</param>
+			/// <param name="height">The height of the image, in pixels.</param>
+			/// <param name="format">The format of the image and of every generated level.</param>
+			/// <param name="filter">The filter used to produce each level.</param>
+			/// <param name="mipLevels">The number of levels to produce, including the top level, or zero for a complete chain.</param>
+			/// <returns>One box per mip level, starting with a copy of the top level.</returns>
+			/// <remarks>
+			/// Each level is filtered from the unquantized result of the level above it, so rounding errors do not accumulate down the chain.
+			/// </remarks>
+			static array<DataBox^>^ GenerateMipChain( DataBox^ source, int width, int height, Format format, ImageFilter filter, int mipLevels );
+
+			/// <summary>
+			/// Gets or sets the maximum number of threads used to process an image. The default is the number of processors.
+			/// </summary>
+			static property int MaximumDegreeOfParallelism
+			{
+				int get() { return m_MaximumDegreeOfParallelism; }
+				void set( int value );
+			}
+		};
+	}
+}
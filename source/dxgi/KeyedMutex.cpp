@@ -43,13 +43,13 @@ namespace DXGI
 
 	Result KeyedMutex::Acquire(System::Int64 key, int milliseconds)
 	{
-		HRESULT hr = InternalPointer->AcquireSync(key, milliseconds);
+		HRESULT hr = TIME_CALL( InternalPointer->AcquireSync(key, milliseconds) );
 		return RECORD_DXGI(hr);
 	}
 
 	Result KeyedMutex::Release(System::Int64 key)
 	{
-		HRESULT hr = InternalPointer->ReleaseSync(key);
+		HRESULT hr = TIME_CALL( InternalPointer->ReleaseSync(key) );
 		return RECORD_DXGI(hr);
 	}
 }
@@ -36,8 +36,7 @@ namespace DXGI
 	{
 		IUnknown* unknown = 0;
 		GUID guid = Utilities::GetNativeGuidForType(T::typeid);
-		RECORD_DXGI(InternalPointer->GetParent(guid, reinterpret_cast<void**>(&unknown)));
-		if(Result::Last.IsFailure)
+		if(RECORD_DXGI(InternalPointer->GetParent(guid, reinterpret_cast<void**>(&unknown))).IsFailure)
 			return T();
 
 		if(ObjectTable::Find(IntPtr(unknown)) != nullptr)
@@ -73,13 +73,11 @@ namespace DXGI
 	ReadOnlyCollection<ModeDescription>^ Output::GetDisplayModeList( Format format, DisplayModeEnumerationFlags flags )
 	{
 		UINT modeCount = 0;
-		RECORD_DXGI( InternalPointer->GetDisplayModeList( static_cast<DXGI_FORMAT>( format ), static_cast<UINT>( flags ), &modeCount, 0 ) );
-		if( Result::Last.IsFailure || modeCount == 0 )
+		if( RECORD_DXGI( InternalPointer->GetDisplayModeList( static_cast<DXGI_FORMAT>( format ), static_cast<UINT>( flags ), &modeCount, 0 ) ).IsFailure || modeCount == 0 )
 			return nullptr;
 		
 		stack_array<DXGI_MODE_DESC> nativeDescriptions = stackalloc( DXGI_MODE_DESC, modeCount );
-		RECORD_DXGI( InternalPointer->GetDisplayModeList( static_cast<DXGI_FORMAT>( format ), static_cast<UINT>( flags ), &modeCount, &nativeDescriptions[0] ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( InternalPointer->GetDisplayModeList( static_cast<DXGI_FORMAT>( format ), static_cast<UINT>( flags ), &modeCount, &nativeDescriptions[0] ) ).IsFailure )
 			return nullptr;
 		
 		List<ModeDescription>^ descriptions = gcnew List<ModeDescription>( modeCount );
@@ -95,11 +93,11 @@ namespace DXGI
 			
 		DXGI_MODE_DESC nativeModeToMatch = modeToMatch.CreateNativeVersion();
 		DXGI_MODE_DESC nativeResult;
-		RECORD_DXGI( InternalPointer->FindClosestMatchingMode( &nativeModeToMatch, &nativeResult, devicePtr ) );
-		if( Result::Last.IsSuccess )
+		Result status = RECORD_DXGI( InternalPointer->FindClosestMatchingMode( &nativeModeToMatch, &nativeResult, devicePtr ) );
+		if( status.IsSuccess )
 			result = ModeDescription( nativeResult );
 
-		return Result::Last;
+		return status;
 	}
 	
 	Result Output::SetGammaControl( GammaControl^ control )
@@ -72,7 +72,7 @@ namespace DXGI
 	{
 		HANDLE handle;
 
-		HRESULT hr = InternalPointer->GetSharedHandle(&handle);
+		HRESULT hr = TIME_CALL( InternalPointer->GetSharedHandle(&handle) );
 		if (RECORD_DXGI(hr).IsFailure)
 			return IntPtr::Zero;
 
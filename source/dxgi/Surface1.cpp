@@ -49,7 +49,7 @@ namespace DXGI
 	{
 		HDC hdc;
 
-		HRESULT hr = InternalPointer->GetDC(discard, &hdc);
+		HRESULT hr = TIME_CALL( InternalPointer->GetDC(discard, &hdc) );
 		if (RECORD_DXGI(hr).IsFailure)
 			return IntPtr::Zero;
 
@@ -61,13 +61,13 @@ namespace DXGI
 		RECT rect;
 		Utilities::ConvertRect(dirtyRegion, rect);
 
-		HRESULT hr = InternalPointer->ReleaseDC(&rect);
+		HRESULT hr = TIME_CALL( InternalPointer->ReleaseDC(&rect) );
 		return RECORD_DXGI(hr);
 	}
 
 	Result Surface1::ReleaseDC()
 	{
-		HRESULT hr = InternalPointer->ReleaseDC(NULL);
+		HRESULT hr = TIME_CALL( InternalPointer->ReleaseDC(NULL) );
 		return RECORD_DXGI(hr);
 	}
 }
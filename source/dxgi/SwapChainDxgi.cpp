@@ -46,8 +46,7 @@ namespace DXGI
 		
 		IDXGISwapChain* swapChain = 0;
 		DXGI_SWAP_CHAIN_DESC nativeDescription = description.CreateNativeVersion();
-		RECORD_DXGI( factory->InternalPointer->CreateSwapChain( device->UnknownPointer, &nativeDescription, &swapChain ) );
-		if( Result::Last.IsFailure )
+		if( RECORD_DXGI( factory->InternalPointer->CreateSwapChain( device->UnknownPointer, &nativeDescription, &swapChain ) ).IsFailure )
 			throw gcnew DXGIException( Result::Last );
 		
 		Construct( swapChain );
@@ -118,7 +117,8 @@ namespace DXGI
 	{
 		BOOL result = false;
 		IDXGIOutput* output = 0;
-		if( RECORD_DXGI( InternalPointer->GetFullscreenState( &result, &output ) ).IsSuccess )
+		Result status = RECORD_DXGI( InternalPointer->GetFullscreenState( &result, &output ) );
+		if( status.IsSuccess )
 		{
 			isFullScreen = result ? true : false;
 			if( output == 0 )
@@ -127,7 +127,7 @@ namespace DXGI
 				target = Output::FromPointer( output, this );
 		}
 		
-		return Result::Last;
+		return status;
 	}
 	
 	Result SwapChain::SetFullScreenState( bool isFullScreen, Output^ target )
@@ -164,7 +164,7 @@ namespace SlimDX
 		FLOAT radius;
 		pin_ptr<Vector3> pinnedPoints = &points[0];
 
-		HRESULT hr = D3DXComputeBoundingSphere( reinterpret_cast<const D3DXVECTOR3*>( pinnedPoints ), points->Length, sizeof(float) * 3, &center, &radius );
+		HRESULT hr = TIME_CALL( D3DXComputeBoundingSphere( reinterpret_cast<const D3DXVECTOR3*>( pinnedPoints ), points->Length, sizeof(float) * 3, &center, &radius ) );
 		if( RECORD_SDX( hr ).IsFailure )
 			return BoundingSphere();
 
@@ -135,7 +135,7 @@ namespace SlimDX
 		pin_ptr<float> pinnedGreen = &greenOutput[0];
 		pin_ptr<float> pinnedBlue = &blueOutput[0];
 
-		HRESULT hr = D3DXSHEvalConeLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), radius, color.Red, color.Green, color.Blue, pinnedRed, pinnedGreen, pinnedBlue );
+		HRESULT hr = TIME_CALL( D3DXSHEvalConeLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), radius, color.Red, color.Green, color.Blue, pinnedRed, pinnedGreen, pinnedBlue ) );
 		if( RECORD_SDX( hr ).IsFailure )
 		{
 			red = nullptr;
@@ -148,7 +148,7 @@ namespace SlimDX
 		green = gcnew SHVector( order, greenOutput );
 		blue = gcnew SHVector( order, blueOutput );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result SHVector::EvaluateDirectionalLight( int order, Vector3 direction, Color3 color, [Out] SHVector^% red, [Out] SHVector^% green, [Out] SHVector^% blue )
@@ -161,7 +161,7 @@ namespace SlimDX
 		pin_ptr<float> pinnedGreen = &greenOutput[0];
 		pin_ptr<float> pinnedBlue = &blueOutput[0];
 
-		HRESULT hr = D3DXSHEvalDirectionalLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), color.Red, color.Green, color.Blue, pinnedRed, pinnedGreen, pinnedBlue );
+		HRESULT hr = TIME_CALL( D3DXSHEvalDirectionalLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), color.Red, color.Green, color.Blue, pinnedRed, pinnedGreen, pinnedBlue ) );
 		if( RECORD_SDX( hr ).IsFailure )
 		{
 			red = nullptr;
@@ -174,7 +174,7 @@ namespace SlimDX
 		green = gcnew SHVector( order, greenOutput );
 		blue = gcnew SHVector( order, blueOutput );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result SHVector::EvaluateSphericalLight( int order, Vector3 direction, float radius, Color3 color, [Out] SHVector^% red, [Out] SHVector^% green, [Out] SHVector^% blue )
@@ -187,7 +187,7 @@ namespace SlimDX
 		pin_ptr<float> pinnedGreen = &greenOutput[0];
 		pin_ptr<float> pinnedBlue = &blueOutput[0];
 
-		HRESULT hr = D3DXSHEvalSphericalLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), radius, color.Red, color.Green, color.Blue, pinnedRed, pinnedGreen, pinnedBlue );
+		HRESULT hr = TIME_CALL( D3DXSHEvalSphericalLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), radius, color.Red, color.Green, color.Blue, pinnedRed, pinnedGreen, pinnedBlue ) );
 		if( RECORD_SDX( hr ).IsFailure )
 		{
 			red = nullptr;
@@ -200,7 +200,7 @@ namespace SlimDX
 		green = gcnew SHVector( order, greenOutput );
 		blue = gcnew SHVector( order, blueOutput );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result SHVector::EvaluateHemisphereLight( int order, Vector3 direction, Color4 top, Color4 bottom, [Out] SHVector^% red, [Out] SHVector^% green, [Out] SHVector^% blue )
@@ -213,8 +213,8 @@ namespace SlimDX
 		pin_ptr<float> pinnedGreen = &greenOutput[0];
 		pin_ptr<float> pinnedBlue = &blueOutput[0];
 
-		HRESULT hr = D3DXSHEvalHemisphereLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), top.ToUnmanaged(), 
-			bottom.ToUnmanaged(), pinnedRed, pinnedGreen, pinnedBlue );
+		HRESULT hr = TIME_CALL( D3DXSHEvalHemisphereLight( order, reinterpret_cast<D3DXVECTOR3*>( &direction ), top.ToUnmanaged(), 
+			bottom.ToUnmanaged(), pinnedRed, pinnedGreen, pinnedBlue ) );
 		if( RECORD_SDX( hr ).IsFailure )
 		{
 			red = nullptr;
@@ -227,7 +227,7 @@ namespace SlimDX
 		green = gcnew SHVector( order, greenOutput );
 		blue = gcnew SHVector( order, blueOutput );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	Result SHVector::ProjectCubeMap( int order, SlimDX::Direct3D9::CubeTexture^ cubeMap, [Out] SHVector^% red, [Out] SHVector^% green, [Out] SHVector^% blue )
@@ -240,7 +240,7 @@ namespace SlimDX
 		pin_ptr<float> pinnedGreen = &greenOutput[0];
 		pin_ptr<float> pinnedBlue = &blueOutput[0];
 
-		HRESULT hr = D3DXSHProjectCubeMap( order, cubeMap->InternalPointer, pinnedRed, pinnedGreen, pinnedBlue );
+		HRESULT hr = TIME_CALL( D3DXSHProjectCubeMap( order, cubeMap->InternalPointer, pinnedRed, pinnedGreen, pinnedBlue ) );
 		if( RECORD_SDX( hr ).IsFailure )
 		{
 			red = nullptr;
@@ -253,7 +253,7 @@ namespace SlimDX
 		green = gcnew SHVector( order, greenOutput );
 		blue = gcnew SHVector( order, blueOutput );
 
-		return Result::Last;
+		return Result( hr );
 	}
 
 	SHVector^ SHVector::operator + ( SHVector^ left, SHVector^ right )
@@ -37,6 +37,19 @@ namespace X3DAudio
 		MatrixCoefficients = nullptr;
 		DelayTimes = nullptr;
 
+		Assign( settings );
+	}
+
+	DspSettings::DspSettings( int sourceChannelCount, int destinationChannelCount )
+	{
+		MatrixCoefficients = gcnew array<float>( sourceChannelCount * destinationChannelCount );
+		DelayTimes = gcnew array<float>( destinationChannelCount );
+		SourceChannelCount = sourceChannelCount;
+		DestinationChannelCount = destinationChannelCount;
+	}
+
+	void DspSettings::Assign( const X3DAUDIO_DSP_SETTINGS &settings )
+	{
 		SourceChannelCount = settings.SrcChannelCount;
 		DestinationChannelCount = settings.DstChannelCount;
 		LpfDirectCoefficient = settings.LPFDirectCoefficient;
@@ -29,8 +29,11 @@ namespace SlimDX
 		{
 		internal:
 			DspSettings( const X3DAUDIO_DSP_SETTINGS &settings );
+			void Assign( const X3DAUDIO_DSP_SETTINGS &settings );
 
 		public:
+			DspSettings( int sourceChannelCount, int destinationChannelCount );
+
 			property array<float>^ MatrixCoefficients;
 			property array<float>^ DelayTimes;
 			property int SourceChannelCount;
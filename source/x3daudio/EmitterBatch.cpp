@@ -0,0 +1,512 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include <windows.h>
+#include <x3daudio.h>
+#include <xaudio2.h>
+#include <vector>
+
+#include "EmitterBatch.h"
+
+using namespace System;
+using namespace System::Threading;
+
+namespace SlimDX
+{
+namespace X3DAudio
+{
+	X3DAUDIO_VECTOR Vector3ToX3DAudio( Vector3 value );
+
+	// Splitting small batches across threads costs more than it saves.
+	const int MinimumEmittersPerThread = 64;
+
+	struct EmitterSlot
+	{
+		X3DAUDIO_CONE Cone;
+		X3DAUDIO_DISTANCE_CURVE Curves[5];
+		std::vector<X3DAUDIO_DISTANCE_CURVE_POINT> Points[5];
+		std::vector<FLOAT32> Azimuths;
+		bool InUse;
+		bool Active;
+		bool Dirty;
+	};
+
+	struct EmitterBatchData
+	{
+		std::vector<X3DAUDIO_EMITTER> Emitters;
+		std::vector<X3DAUDIO_DSP_SETTINGS> Settings;
+		std::vector<EmitterSlot> Slots;
+		std::vector<FLOAT32> Matrix;
+		std::vector<FLOAT32> DelayTimes;
+		std::vector<int> FreeSlots;
+		std::vector<int> Work;
+
+		X3DAUDIO_LISTENER Listener;
+		X3DAUDIO_CONE ListenerCone;
+		UINT32 Flags;
+		bool HasCalculated;
+	};
+
+	static void CalculateRange( const BYTE* handle, EmitterBatchData* data, UINT32 flags, int begin, int end )
+	{
+		for( int i = begin; i < end; ++i )
+		{
+			int index = data->Work[i];
+			X3DAudioCalculate( handle, &data->Listener, &data->Emitters[index], flags, &data->Settings[index] );
+		}
+	}
+
+	ref class EmitterBatchWorker
+	{
+	private:
+		ManualResetEvent^ m_Done;
+		WaitCallback^ m_Callback;
+		int m_Next;
+		int m_Pending;
+		int m_Chunks;
+
+		const BYTE* m_Handle;
+		EmitterBatchData* m_Data;
+		UINT32 m_Flags;
+
+		void Execute( Object^ )
+		{
+			int count = static_cast<int>( m_Data->Work.size() );
+			int chunk = Interlocked::Increment( m_Next );
+
+			int begin = static_cast<int>( static_cast<__int64>( count ) * chunk / m_Chunks );
+			int end = static_cast<int>( static_cast<__int64>( count ) * ( chunk + 1 ) / m_Chunks );
+			CalculateRange( m_Handle, m_Data, m_Flags, begin, end );
+
+			if( Interlocked::Decrement( m_Pending ) == 0 )
+				m_Done->Set();
+		}
+
+	public:
+		EmitterBatchWorker()
+		{
+			m_Done = gcnew ManualResetEvent( false );
+			m_Callback = gcnew WaitCallback( this, &EmitterBatchWorker::Execute );
+		}
+
+		void Close()
+		{
+			m_Done->Close();
+		}
+
+		void Run( const BYTE* handle, EmitterBatchData* data, UINT32 flags, int chunks )
+		{
+			m_Handle = handle;
+			m_Data = data;
+			m_Flags = flags;
+			m_Chunks = chunks;
+			m_Next = -1;
+			m_Pending = chunks;
+			m_Done->Reset();
+
+			for( int i = 1; i < chunks; ++i )
+				ThreadPool::QueueUserWorkItem( m_Callback );
+
+			// the calling thread takes a share of the work instead of idling
+			Execute( nullptr );
+			m_Done->WaitOne();
+		}
+	};
+
+	static bool VectorEquals( const X3DAUDIO_VECTOR& left, const X3DAUDIO_VECTOR& right )
+	{
+		return left.x == right.x && left.y == right.y && left.z == right.z;
+	}
+
+	static X3DAUDIO_DISTANCE_CURVE* CopyCurve( array<CurvePoint>^ curve, std::vector<X3DAUDIO_DISTANCE_CURVE_POINT>& points, X3DAUDIO_DISTANCE_CURVE& result )
+	{
+		if( curve == nullptr || curve->Length == 0 )
+			return NULL;
+
+		points.resize( curve->Length );
+		pin_ptr<CurvePoint> pinnedCurve = &curve[0];
+		memcpy( &points[0], pinnedCurve, sizeof( X3DAUDIO_DISTANCE_CURVE_POINT ) * curve->Length );
+
+		result.pPoints = &points[0];
+		result.PointCount = curve->Length;
+		return &result;
+	}
+
+	EmitterBatch::EmitterBatch( SlimDX::X3DAudio::X3DAudio^ x3dAudio, int capacity, int maximumSourceChannelCount, int destinationChannelCount )
+	{
+		if( x3dAudio == nullptr )
+			throw gcnew ArgumentNullException( "x3dAudio" );
+		if( capacity <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "capacity", "Capacity must be greater than zero." );
+		if( maximumSourceChannelCount <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "maximumSourceChannelCount", "Channel count must be greater than zero." );
+		if( destinationChannelCount <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "destinationChannelCount", "Channel count must be greater than zero." );
+
+		m_X3DAudio = x3dAudio;
+		m_Capacity = capacity;
+		m_MaximumSourceChannelCount = maximumSourceChannelCount;
+		m_DestinationChannelCount = destinationChannelCount;
+		m_MaximumDegreeOfParallelism = 1;
+
+		// Manual Allocation: cleaned up in the finalizer / destructor
+		m_Data = new EmitterBatchData();
+		m_Data->Emitters.resize( capacity );
+		m_Data->Settings.resize( capacity );
+		m_Data->Slots.resize( capacity );
+		m_Data->Matrix.resize( static_cast<size_t>( capacity ) * maximumSourceChannelCount * destinationChannelCount );
+		m_Data->DelayTimes.resize( static_cast<size_t>( capacity ) * destinationChannelCount );
+		m_Data->Work.reserve( capacity );
+		m_Data->FreeSlots.reserve( capacity );
+		m_Data->HasCalculated = false;
+		memset( &m_Data->Listener, 0, sizeof( m_Data->Listener ) );
+
+		for( int i = capacity - 1; i >= 0; --i )
+		{
+			m_Data->Slots[i].InUse = false;
+			m_Data->FreeSlots.push_back( i );
+
+			X3DAUDIO_DSP_SETTINGS& settings = m_Data->Settings[i];
+			memset( &settings, 0, sizeof( settings ) );
+			settings.DstChannelCount = destinationChannelCount;
+			settings.pMatrixCoefficients = &m_Data->Matrix[static_cast<size_t>( i ) * maximumSourceChannelCount * destinationChannelCount];
+			settings.pDelayTimes = &m_Data->DelayTimes[static_cast<size_t>( i ) * destinationChannelCount];
+		}
+	}
+
+	EmitterBatch::~EmitterBatch()
+	{
+		if( m_Worker != nullptr )
+		{
+			m_Worker->Close();
+			m_Worker = nullptr;
+		}
+
+		Destruct();
+	}
+
+	void EmitterBatch::Destruct()
+	{
+		if( m_Data != NULL )
+		{
+			delete m_Data;
+			m_Data = NULL;
+		}
+	}
+
+	void EmitterBatch::CheckIndex( int index )
+	{
+		if( m_Data == NULL )
+			throw gcnew ObjectDisposedException( "EmitterBatch" );
+		if( index < 0 || index >= m_Capacity || !m_Data->Slots[index].InUse )
+			throw gcnew ArgumentOutOfRangeException( "index" );
+	}
+
+	int EmitterBatch::Add( Emitter^ emitter )
+	{
+		if( m_Data == NULL )
+			throw gcnew ObjectDisposedException( "EmitterBatch" );
+		if( emitter == nullptr )
+			throw gcnew ArgumentNullException( "emitter" );
+		if( m_Data->FreeSlots.empty() )
+			throw gcnew InvalidOperationException( "The batch is full." );
+
+		int index = m_Data->FreeSlots.back();
+		m_Data->Slots[index].InUse = true;
+
+		try
+		{
+			Update( index, emitter );
+		}
+		catch( ... )
+		{
+			m_Data->Slots[index].InUse = false;
+			throw;
+		}
+
+		m_Data->FreeSlots.pop_back();
+		m_Data->Slots[index].Active = true;
+		m_Count++;
+		return index;
+	}
+
+	void EmitterBatch::Remove( int index )
+	{
+		CheckIndex( index );
+
+		m_Data->Slots[index].InUse = false;
+		m_Data->FreeSlots.push_back( index );
+		m_Count--;
+	}
+
+	void EmitterBatch::Clear()
+	{
+		if( m_Data == NULL )
+			return;
+
+		m_Data->FreeSlots.clear();
+		for( int i = m_Capacity - 1; i >= 0; --i )
+		{
+			m_Data->Slots[i].InUse = false;
+			m_Data->FreeSlots.push_back( i );
+		}
+
+		m_Count = 0;
+	}
+
+	void EmitterBatch::Update( int index, Emitter^ emitter )
+	{
+		CheckIndex( index );
+		if( emitter == nullptr )
+			throw gcnew ArgumentNullException( "emitter" );
+
+		int channelCount = emitter->ChannelCount;
+		if( channelCount <= 0 || channelCount > m_MaximumSourceChannelCount )
+			throw gcnew ArgumentException( "The emitter's channel count must be between one and the batch's maximum source channel count.", "emitter" );
+		if( channelCount > 1 && ( emitter->ChannelAzimuths == nullptr || emitter->ChannelAzimuths->Length < channelCount ) )
+			throw gcnew ArgumentException( "Emitters with more than one channel must specify an azimuth for each channel.", "emitter" );
+
+		EmitterSlot& slot = m_Data->Slots[index];
+		X3DAUDIO_EMITTER& native = m_Data->Emitters[index];
+
+		if( emitter->Cone != nullptr )
+		{
+			slot.Cone = emitter->Cone->ToUnmanaged();
+			native.pCone = &slot.Cone;
+		}
+		else
+			native.pCone = NULL;
+
+		native.OrientFront = Vector3ToX3DAudio( emitter->OrientFront );
+		native.OrientTop = Vector3ToX3DAudio( emitter->OrientTop );
+		native.Position = Vector3ToX3DAudio( emitter->Position );
+		native.Velocity = Vector3ToX3DAudio( emitter->Velocity );
+		native.InnerRadius = emitter->InnerRadius;
+		native.InnerRadiusAngle = emitter->InnerRadiusAngle;
+		native.ChannelCount = channelCount;
+		native.ChannelRadius = emitter->ChannelRadius;
+		native.CurveDistanceScaler = emitter->CurveDistance;
+		native.DopplerScaler = emitter->Doppler;
+
+		if( emitter->ChannelAzimuths != nullptr && emitter->ChannelAzimuths->Length > 0 )
+		{
+			slot.Azimuths.resize( emitter->ChannelAzimuths->Length );
+			pin_ptr<float> pinnedAzimuths = &emitter->ChannelAzimuths[0];
+			memcpy( &slot.Azimuths[0], pinnedAzimuths, sizeof( FLOAT32 ) * emitter->ChannelAzimuths->Length );
+			native.pChannelAzimuths = &slot.Azimuths[0];
+		}
+		else
+			native.pChannelAzimuths = NULL;
+
+		native.pVolumeCurve = CopyCurve( emitter->VolumeCurve, slot.Points[0], slot.Curves[0] );
+		native.pLFECurve = CopyCurve( emitter->LfeCurve, slot.Points[1], slot.Curves[1] );
+		native.pLPFDirectCurve = CopyCurve( emitter->LpfDirectCurve, slot.Points[2], slot.Curves[2] );
+		native.pLPFReverbCurve = CopyCurve( emitter->LpfReverbCurve, slot.Points[3], slot.Curves[3] );
+		native.pReverbCurve = CopyCurve( emitter->ReverbCurve, slot.Points[4], slot.Curves[4] );
+
+		m_Data->Settings[index].SrcChannelCount = channelCount;
+		slot.Dirty = true;
+	}
+
+	void EmitterBatch::SetPosition( int index, Vector3 position )
+	{
+		CheckIndex( index );
+
+		X3DAUDIO_VECTOR value = Vector3ToX3DAudio( position );
+		if( !VectorEquals( m_Data->Emitters[index].Position, value ) )
+		{
+			m_Data->Emitters[index].Position = value;
+			m_Data->Slots[index].Dirty = true;
+		}
+	}
+
+	void EmitterBatch::SetVelocity( int index, Vector3 velocity )
+	{
+		CheckIndex( index );
+
+		X3DAUDIO_VECTOR value = Vector3ToX3DAudio( velocity );
+		if( !VectorEquals( m_Data->Emitters[index].Velocity, value ) )
+		{
+			m_Data->Emitters[index].Velocity = value;
+			m_Data->Slots[index].Dirty = true;
+		}
+	}
+
+	void EmitterBatch::SetOrientation( int index, Vector3 orientFront, Vector3 orientTop )
+	{
+		CheckIndex( index );
+
+		X3DAUDIO_VECTOR front = Vector3ToX3DAudio( orientFront );
+		X3DAUDIO_VECTOR top = Vector3ToX3DAudio( orientTop );
+		if( !VectorEquals( m_Data->Emitters[index].OrientFront, front ) || !VectorEquals( m_Data->Emitters[index].OrientTop, top ) )
+		{
+			m_Data->Emitters[index].OrientFront = front;
+			m_Data->Emitters[index].OrientTop = top;
+			m_Data->Slots[index].Dirty = true;
+		}
+	}
+
+	void EmitterBatch::SetActive( int index, bool active )
+	{
+		CheckIndex( index );
+
+		// results are not kept up to date while inactive, so a reactivated emitter must be recalculated
+		EmitterSlot& slot = m_Data->Slots[index];
+		if( active && !slot.Active )
+			slot.Dirty = true;
+		slot.Active = active;
+	}
+
+	void EmitterBatch::MaximumDegreeOfParallelism::set( int value )
+	{
+		if( value <= 0 )
+			throw gcnew ArgumentOutOfRangeException( "value", "The degree of parallelism must be greater than zero." );
+
+		m_MaximumDegreeOfParallelism = value;
+	}
+
+	int EmitterBatch::Calculate( Listener^ listener, CalculateFlags flags )
+	{
+		if( m_Data == NULL )
+			throw gcnew ObjectDisposedException( "EmitterBatch" );
+		if( m_X3DAudio->InternalHandle == NULL )
+			throw gcnew ObjectDisposedException( "X3DAudio" );
+		if( listener == nullptr )
+			throw gcnew ArgumentNullException( "listener" );
+
+		X3DAUDIO_LISTENER nativeListener = listener->ToUnmanaged();
+		X3DAUDIO_CONE cone = { 0 };
+		if( listener->Cone != nullptr )
+			cone = listener->Cone->ToUnmanaged();
+
+		// every emitter's results depend on the listener, so any change to it invalidates them all
+		bool hadCone = m_Data->Listener.pCone != NULL;
+		bool changed = !m_Data->HasCalculated || m_Data->Flags != static_cast<UINT32>( flags ) ||
+			!VectorEquals( m_Data->Listener.OrientFront, nativeListener.OrientFront ) ||
+			!VectorEquals( m_Data->Listener.OrientTop, nativeListener.OrientTop ) ||
+			!VectorEquals( m_Data->Listener.Position, nativeListener.Position ) ||
+			!VectorEquals( m_Data->Listener.Velocity, nativeListener.Velocity ) ||
+			hadCone != ( listener->Cone != nullptr ) ||
+			( hadCone && memcmp( &m_Data->ListenerCone, &cone, sizeof( cone ) ) != 0 );
+
+		if( changed )
+		{
+			m_Data->Listener = nativeListener;
+			m_Data->ListenerCone = cone;
+			m_Data->Listener.pCone = listener->Cone != nullptr ? &m_Data->ListenerCone : NULL;
+			m_Data->Flags = static_cast<UINT32>( flags );
+			m_Data->HasCalculated = true;
+		}
+
+		int skipped = 0;
+		m_Data->Work.clear();
+		for( int i = 0; i < m_Capacity; ++i )
+		{
+			EmitterSlot& slot = m_Data->Slots[i];
+			if( !slot.InUse )
+				continue;
+
+			if( !slot.Active )
+			{
+				// the listener moved on without this emitter, so its stored results are stale
+				if( changed )
+					slot.Dirty = true;
+				continue;
+			}
+
+			if( slot.Dirty || changed )
+			{
+				m_Data->Work.push_back( i );
+				slot.Dirty = false;
+			}
+			else
+				skipped++;
+		}
+
+		int count = static_cast<int>( m_Data->Work.size() );
+		int chunks = count / MinimumEmittersPerThread;
+		if( chunks > m_MaximumDegreeOfParallelism )
+			chunks = m_MaximumDegreeOfParallelism;
+
+		const BYTE* handle = m_X3DAudio->InternalHandle->Handle;
+		if( chunks <= 1 )
+			CalculateRange( handle, m_Data, m_Data->Flags, 0, count );
+		else
+		{
+			if( m_Worker == nullptr )
+				m_Worker = gcnew EmitterBatchWorker();
+
+			m_Worker->Run( handle, m_Data, m_Data->Flags, chunks );
+		}
+
+		m_LastCalculatedCount = count;
+		m_LastSkippedCount = skipped;
+		return count;
+	}
+
+	void EmitterBatch::GetSettings( int index, DspSettings^ settings )
+	{
+		CheckIndex( index );
+		if( settings == nullptr )
+			throw gcnew ArgumentNullException( "settings" );
+
+		const X3DAUDIO_DSP_SETTINGS& native = m_Data->Settings[index];
+		settings->Assign( native );
+
+		int matrixCount = native.SrcChannelCount * native.DstChannelCount;
+		if( settings->MatrixCoefficients == nullptr || settings->MatrixCoefficients->Length < matrixCount )
+			settings->MatrixCoefficients = gcnew array<float>( matrixCount );
+		if( settings->DelayTimes == nullptr || settings->DelayTimes->Length < static_cast<int>( native.DstChannelCount ) )
+			settings->DelayTimes = gcnew array<float>( native.DstChannelCount );
+
+		pin_ptr<float> pinnedMatrix = &settings->MatrixCoefficients[0];
+		memcpy( pinnedMatrix, native.pMatrixCoefficients, sizeof( FLOAT32 ) * matrixCount );
+
+		pin_ptr<float> pinnedDelays = &settings->DelayTimes[0];
+		memcpy( pinnedDelays, native.pDelayTimes, sizeof( FLOAT32 ) * native.DstChannelCount );
+	}
+
+	int EmitterBatch::GetMatrixCoefficients( int index, array<float>^ destination )
+	{
+		CheckIndex( index );
+		if( destination == nullptr )
+			throw gcnew ArgumentNullException( "destination" );
+
+		const X3DAUDIO_DSP_SETTINGS& native = m_Data->Settings[index];
+		int matrixCount = native.SrcChannelCount * native.DstChannelCount;
+		if( destination->Length < matrixCount )
+			throw gcnew ArgumentException( "The destination array is too small to hold the matrix coefficients.", "destination" );
+
+		pin_ptr<float> pinnedDestination = &destination[0];
+		memcpy( pinnedDestination, native.pMatrixCoefficients, sizeof( FLOAT32 ) * matrixCount );
+		return matrixCount;
+	}
+
+	float EmitterBatch::GetDopplerFactor( int index )
+	{
+		CheckIndex( index );
+
+		return m_Data->Settings[index].DopplerFactor;
+	}
+}
+}
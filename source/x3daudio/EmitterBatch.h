@@ -0,0 +1,201 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "../math/Vector3.h"
+#include "DspSettings.h"
+#include "Emitter.h"
+#include "Enums.h"
+#include "Listener.h"
+#include "X3DAudio.h"
+
+namespace SlimDX
+{
+	namespace X3DAudio
+	{
+		struct EmitterBatchData;
+		ref class EmitterBatchWorker;
+
+		/// <summary>
+		/// Computes DSP settings for many emitters at once, keeping emitter state and results in native memory.
+		/// </summary>
+		/// <remarks>
+		/// Emitters are converted when they are added or updated rather than on every calculation, and results are written to
+		/// buffers allocated once for the capacity of the batch. Emitters whose inputs have not changed since their last
+		/// calculation are skipped unless the listener or the calculation flags change.
+		/// </remarks>
+		public ref class EmitterBatch sealed
+		{
+		private:
+			SlimDX::X3DAudio::X3DAudio^ m_X3DAudio;
+			EmitterBatchData* m_Data;
+			EmitterBatchWorker^ m_Worker;
+			int m_Capacity;
+			int m_MaximumSourceChannelCount;
+			int m_DestinationChannelCount;
+			int m_Count;
+			int m_MaximumDegreeOfParallelism;
+			int m_LastCalculatedCount;
+			int m_LastSkippedCount;
+
+			void Destruct();
+			void CheckIndex( int index );
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="EmitterBatch"/> class.
+			/// </summary>
+			/// <param name="x3dAudio">The X3DAudio instance used to perform calculations.</param>
+			/// <param name="capacity">The maximum number of emitters in the batch.</param>
+			/// <param name="maximumSourceChannelCount">The largest channel count of any emitter in the batch.</param>
+			/// <param name="destinationChannelCount">The number of channels in the destination voice.</param>
+			EmitterBatch( SlimDX::X3DAudio::X3DAudio^ x3dAudio, int capacity, int maximumSourceChannelCount, int destinationChannelCount );
+			~EmitterBatch();
+			!EmitterBatch() { Destruct(); }
+
+			/// <summary>
+			/// Adds an emitter to the batch.
+			/// </summary>
+			/// <param name="emitter">The emitter to add. Its current values are copied into the batch.</param>
+			/// <returns>The index used to refer to the emitter in the batch.</returns>
+			int Add( Emitter^ emitter );
+
+			/// <summary>
+			/// Removes an emitter from the batch, making its index available for reuse.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			void Remove( int index );
+
+			/// <summary>
+			/// Removes every emitter from the batch.
+			/// </summary>
+			void Clear();
+
+			/// <summary>
+			/// Copies every value of an emitter into the batch, including its cone and curves.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="emitter">The emitter to copy.</param>
+			void Update( int index, Emitter^ emitter );
+
+			/// <summary>
+			/// Sets the position of an emitter.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="position">The new position.</param>
+			void SetPosition( int index, Vector3 position );
+
+			/// <summary>
+			/// Sets the velocity of an emitter.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="velocity">The new velocity.</param>
+			void SetVelocity( int index, Vector3 velocity );
+
+			/// <summary>
+			/// Sets the orientation of an emitter.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="orientFront">The new forward orientation.</param>
+			/// <param name="orientTop">The new top orientation.</param>
+			void SetOrientation( int index, Vector3 orientFront, Vector3 orientTop );
+
+			/// <summary>
+			/// Sets whether an emitter takes part in calculations. Inactive emitters keep their last results.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="active"><c>true</c> to include the emitter in calculations; otherwise, <c>false</c>.</param>
+			void SetActive( int index, bool active );
+
+			/// <summary>
+			/// Computes the DSP settings of every active emitter whose inputs have changed.
+			/// </summary>
+			/// <param name="listener">The listener.</param>
+			/// <param name="flags">Flags specifying which settings to calculate.</param>
+			/// <returns>The number of emitters that were calculated.</returns>
+			int Calculate( Listener^ listener, CalculateFlags flags );
+
+			/// <summary>
+			/// Copies the most recent results for an emitter into an existing settings object, reusing its arrays when they are large enough.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="settings">The settings object that receives the results.</param>
+			void GetSettings( int index, DspSettings^ settings );
+
+			/// <summary>
+			/// Copies the most recent matrix coefficients for an emitter into an array.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <param name="destination">The array that receives the coefficients.</param>
+			/// <returns>The number of coefficients copied.</returns>
+			int GetMatrixCoefficients( int index, array<float>^ destination );
+
+			/// <summary>
+			/// Gets the most recent Doppler factor for an emitter.
+			/// </summary>
+			/// <param name="index">The index of the emitter.</param>
+			/// <returns>The Doppler factor.</returns>
+			float GetDopplerFactor( int index );
+
+			/// <summary>
+			/// Gets or sets the maximum number of threads used by <see cref="Calculate"/>. The default is 1.
+			/// </summary>
+			property int MaximumDegreeOfParallelism
+			{
+				int get() { return m_MaximumDegreeOfParallelism; }
+				void set( int value );
+			}
+
+			/// <summary>
+			/// Gets the maximum number of emitters in the batch.
+			/// </summary>
+			property int Capacity
+			{
+				int get() { return m_Capacity; }
+			}
+
+			/// <summary>
+			/// Gets the number of emitters in the batch.
+			/// </summary>
+			property int Count
+			{
+				int get() { return m_Count; }
+			}
+
+			/// <summary>
+			/// Gets the number of emitters calculated by the last call to <see cref="Calculate"/>.
+			/// </summary>
+			property int LastCalculatedCount
+			{
+				int get() { return m_LastCalculatedCount; }
+			}
+
+			/// <summary>
+			/// Gets the number of active emitters skipped by the last call to <see cref="Calculate"/> because their inputs had not changed.
+			/// </summary>
+			property int LastSkippedCount
+			{
+				int get() { return m_LastSkippedCount; }
+			}
+		};
+	}
+}
@@ -39,6 +39,12 @@ namespace SlimDX
 
 			void Destruct();
 
+		internal:
+			property HandleWrapper* InternalHandle
+			{
+				HandleWrapper* get() { return handle; }
+			}
+
 		public:
 			X3DAudio( SlimDX::Multimedia::Speakers speakers, float speedOfSound );
 			~X3DAudio() { Destruct(); }
@@ -38,7 +38,7 @@ namespace XACT3
 
 	Result Cue::Destroy()
 	{
-		HRESULT hr = InternalPointer->Destroy();
+		HRESULT hr = TIME_CALL( InternalPointer->Destroy() );
 		return RECORD_XACT3(hr);
 	}
 
@@ -46,7 +46,7 @@ namespace XACT3
 	{
 		XACTVARIABLEVALUE value;
 
-		HRESULT hr = InternalPointer->GetVariable(static_cast<XACTVARIABLEINDEX>(index), &value);
+		HRESULT hr = TIME_CALL( InternalPointer->GetVariable(static_cast<XACTVARIABLEINDEX>(index), &value) );
 		RECORD_XACT3(hr);
 
 		return value;
@@ -63,13 +63,13 @@ namespace XACT3
 
 	Result Cue::Pause(bool pause)
 	{
-		HRESULT hr = InternalPointer->Pause(pause);
+		HRESULT hr = TIME_CALL( InternalPointer->Pause(pause) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Cue::Play()
 	{
-		HRESULT hr = InternalPointer->Play();
+		HRESULT hr = TIME_CALL( InternalPointer->Play() );
 		return RECORD_XACT3(hr);
 	}
 
@@ -77,19 +77,19 @@ namespace XACT3
 	{
 		pin_ptr<float> pinnedMatrix = &matrixCoefficients[0];
 
-		HRESULT hr = InternalPointer->SetMatrixCoefficients(srcChannelCount, dstChannelCount, pinnedMatrix);
+		HRESULT hr = TIME_CALL( InternalPointer->SetMatrixCoefficients(srcChannelCount, dstChannelCount, pinnedMatrix) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Cue::SetVariable(int index, float value)
 	{
-		HRESULT hr = InternalPointer->SetVariable(static_cast<XACTVARIABLEINDEX>(index), value);
+		HRESULT hr = TIME_CALL( InternalPointer->SetVariable(static_cast<XACTVARIABLEINDEX>(index), value) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Cue::Stop(StopFlags flags)
 	{
-		HRESULT hr = InternalPointer->Stop(static_cast<DWORD>(flags));
+		HRESULT hr = TIME_CALL( InternalPointer->Stop(static_cast<DWORD>(flags)) );
 		return RECORD_XACT3(hr);
 	}
 
@@ -97,7 +97,7 @@ namespace XACT3
 	{
 		LPXACT_CUE_INSTANCE_PROPERTIES resultPointer = NULL;
 
-		HRESULT hr = InternalPointer->GetProperties(&resultPointer);
+		HRESULT hr = TIME_CALL( InternalPointer->GetProperties(&resultPointer) );
 		RECORD_XACT3(hr);
 
 		CueInstanceProperties result = CueInstanceProperties(*resultPointer);
@@ -110,7 +110,7 @@ namespace XACT3
 	{
 		DWORD result;
 
-		HRESULT hr = InternalPointer->GetState(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetState(&result) );
 		RECORD_XACT3(hr);
 
 		return static_cast<CueState>(result);
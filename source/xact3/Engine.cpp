@@ -41,7 +41,7 @@ namespace XACT3
 	{
 		IXACT3Engine *pointer;
 
-		HRESULT hr = XACT3CreateEngine(0, &pointer);
+		HRESULT hr = TIME_CALL( XACT3CreateEngine(0, &pointer) );
 		if (RECORD_XACT3(hr).IsFailure)
 			throw gcnew XACT3Exception(Result::Last);
 
@@ -52,7 +52,7 @@ namespace XACT3
 	{
 		IXACT3Engine *pointer;
 
-		HRESULT hr = XACT3CreateEngine(static_cast<DWORD>(flags), &pointer);
+		HRESULT hr = TIME_CALL( XACT3CreateEngine(static_cast<DWORD>(flags), &pointer) );
 		if (RECORD_XACT3(hr).IsFailure)
 			throw gcnew XACT3Exception(Result::Last);
 
@@ -63,22 +63,42 @@ namespace XACT3
 	{
 		IXACT3SoundBank *result;
 
-		HRESULT hr = InternalPointer->CreateSoundBank( data->RawPointer, static_cast<int>(data->Length), 0, 0, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateSoundBank( data->RawPointer, static_cast<int>(data->Length), 0, 0, &result ) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
-		return gcnew SoundBank( result );
+		SoundBankIndex^ index = nullptr;
+		try
+		{
+			index = gcnew SoundBankIndex( data->RawPointer, static_cast<int>(data->Length) );
+		}
+		catch (InvalidDataException^)
+		{
+			// lookups fall back to XACT for banks the index cannot read
+		}
+
+		return gcnew SoundBank( result, index );
 	}
 
 	WaveBank^ Engine::CreateWaveBank( DataStream^ data )
 	{
 		IXACT3WaveBank *result;
 
-		HRESULT hr = InternalPointer->CreateInMemoryWaveBank( data->RawPointer, static_cast<int>(data->Length), 0, 0, &result );
+		HRESULT hr = TIME_CALL( InternalPointer->CreateInMemoryWaveBank( data->RawPointer, static_cast<int>(data->Length), 0, 0, &result ) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
-		return gcnew WaveBank( result );
+		WaveBankIndex^ index = nullptr;
+		try
+		{
+			index = gcnew WaveBankIndex( data->RawPointer, static_cast<int>(data->Length) );
+		}
+		catch (InvalidDataException^)
+		{
+			// lookups fall back to XACT for banks the index cannot read
+		}
+
+		return gcnew WaveBank( result, index );
 	}
 
 	WaveBank^ Engine::CreateStreamingWaveBank(String^ fileName, int offset, int packetSize)
@@ -99,16 +119,38 @@ namespace XACT3
 		params.flags = 0;
 		params.packetSize = static_cast<WORD>(packetSize);
 
-		HRESULT hr = InternalPointer->CreateStreamingWaveBank(&params, &result);
+		HRESULT hr = TIME_CALL( InternalPointer->CreateStreamingWaveBank(&params, &result) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
-		return gcnew WaveBank( result, handle );
+		// XACT owns the unbuffered handle, so the header is read through a separate stream
+		WaveBankIndex^ index = nullptr;
+		try
+		{
+			FileStream^ stream = gcnew FileStream(fileName, FileMode::Open, FileAccess::Read, FileShare::ReadWrite);
+			try
+			{
+				stream->Position = offset;
+				index = gcnew WaveBankIndex( stream );
+			}
+			finally
+			{
+				delete stream;
+			}
+		}
+		catch (IOException^)
+		{
+		}
+		catch (InvalidDataException^)
+		{
+		}
+
+		return gcnew WaveBank( result, handle, index );
 	}
 
 	Result Engine::DoWork()
 	{
-		HRESULT hr = InternalPointer->DoWork();
+		HRESULT hr = TIME_CALL( InternalPointer->DoWork() );
 		return RECORD_XACT3(hr);
 	}
 
@@ -125,7 +167,7 @@ namespace XACT3
 	{
 		XACTVARIABLEVALUE result;
 
-		HRESULT hr = InternalPointer->GetGlobalVariable((XACTVARIABLEINDEX)index, &result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetGlobalVariable((XACTVARIABLEINDEX)index, &result) );
 		RECORD_XACT3(hr);
 
 		return result;
@@ -144,7 +186,7 @@ namespace XACT3
 	{
 		XACT_RENDERER_DETAILS rendererDetails;
 
-		HRESULT hr = InternalPointer->GetRendererDetails(static_cast<XACTINDEX>(rendererIndex), &rendererDetails);
+		HRESULT hr = TIME_CALL( InternalPointer->GetRendererDetails(static_cast<XACTINDEX>(rendererIndex), &rendererDetails) );
 		RECORD_XACT3(hr);
 
 		return RendererDetails(rendererDetails);
@@ -154,7 +196,7 @@ namespace XACT3
 	{
 		XACT_RUNTIME_PARAMETERS rp = parameters.ToUnmanaged();
 
-		HRESULT hr = InternalPointer->Initialize(&rp);
+		HRESULT hr = TIME_CALL( InternalPointer->Initialize(&rp) );
 		delete[] rp.pRendererID;
 
 		return RECORD_XACT3(hr);
@@ -162,38 +204,38 @@ namespace XACT3
 
 	Result Engine::Pause(int category, bool pause)
 	{
-		HRESULT hr = InternalPointer->Pause(static_cast<XACTCATEGORY>(category), pause);
+		HRESULT hr = TIME_CALL( InternalPointer->Pause(static_cast<XACTCATEGORY>(category), pause) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Engine::SetGlobalVariable(int index, float value)
 	{
-		HRESULT hr = InternalPointer->SetGlobalVariable(static_cast<XACTVARIABLEINDEX>(index), value);
+		HRESULT hr = TIME_CALL( InternalPointer->SetGlobalVariable(static_cast<XACTVARIABLEINDEX>(index), value) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Engine::SetVolume(int category, float volume)
 	{
-		HRESULT hr = InternalPointer->SetVolume(static_cast<XACTCATEGORY>(category), volume);
+		HRESULT hr = TIME_CALL( InternalPointer->SetVolume(static_cast<XACTCATEGORY>(category), volume) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Engine::Shutdown()
 	{
-		HRESULT hr = InternalPointer->ShutDown();
+		HRESULT hr = TIME_CALL( InternalPointer->ShutDown() );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Engine::Stop(int category, StopFlags flags)
 	{
-		HRESULT hr = InternalPointer->Stop(static_cast<XACTCATEGORY>(category), static_cast<DWORD>(flags));
+		HRESULT hr = TIME_CALL( InternalPointer->Stop(static_cast<XACTCATEGORY>(category), static_cast<DWORD>(flags)) );
 		return RECORD_XACT3(hr);
 	}
 
 	int Engine::RendererCount::get()
 	{
 		XACTINDEX result;
-		HRESULT hr = InternalPointer->GetRendererCount(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetRendererCount(&result) );
 		RECORD_XACT3(hr);
 
 		return static_cast<int>(result);
@@ -203,7 +245,7 @@ namespace XACT3
 	{
 		WAVEFORMATEXTENSIBLE finalMixFormat;
 
-		HRESULT hr = InternalPointer->GetFinalMixFormat(&finalMixFormat);
+		HRESULT hr = TIME_CALL( InternalPointer->GetFinalMixFormat(&finalMixFormat) );
 		RECORD_XACT3(hr);
 
 		return gcnew WaveFormatExtensible(finalMixFormat);
@@ -35,17 +35,50 @@ namespace XACT3
 	SoundBank::SoundBank( IXACT3SoundBank *pointer )
 	{
 		InternalPointer = pointer;
+		index = nullptr;
+	}
+
+	SoundBank::SoundBank( IXACT3SoundBank *pointer, SoundBankIndex^ bankIndex )
+	{
+		InternalPointer = pointer;
+		index = nullptr;
+
+		if( bankIndex == nullptr || !bankIndex->HasNames || bankIndex->CueCount != CueCount )
+			return;
+
+		// The sound bank layout is not documented, so only trust the index once XACT agrees with every name in it.
+		for( int i = 0; i < bankIndex->CueCount; i++ )
+		{
+			String^ name = bankIndex->GetCueName( i );
+			if( name == nullptr || bankIndex->GetCueIndex( name ) != i || GetEngineCueIndex( name ) != i )
+				return;
+		}
+
+		index = bankIndex;
 	}
 
 	Result SoundBank::Destroy()
 	{
-		HRESULT hr = InternalPointer->Destroy();
+		HRESULT hr = TIME_CALL( InternalPointer->Destroy() );
 		return RECORD_XACT3(hr);
 	}
 
 	int SoundBank::GetCueIndex(String^ friendlyName)
 	{
-		array<unsigned char>^ friendlyNameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes(friendlyName);
+		if (friendlyName == nullptr)
+			throw gcnew ArgumentNullException("friendlyName");
+
+		if (index != nullptr)
+			return index->GetCueIndex(friendlyName);
+
+		return GetEngineCueIndex(friendlyName);
+	}
+
+	int SoundBank::GetEngineCueIndex(String^ friendlyName)
+	{
+		// XACT expects a null terminated string
+		array<unsigned char>^ friendlyNameBytes = gcnew array<unsigned char>(friendlyName->Length + 1);
+		System::Text::ASCIIEncoding::ASCII->GetBytes(friendlyName, 0, friendlyName->Length, friendlyNameBytes, 0);
 		pin_ptr<unsigned char> pinnedFriendlyName = &friendlyNameBytes[0];
 
 		XACTINDEX result = InternalPointer->GetCueIndex(reinterpret_cast<PCSTR>(pinnedFriendlyName));
@@ -56,7 +89,7 @@ namespace XACT3
 	{
 		XACT_CUE_PROPERTIES result;
 
-		HRESULT hr = InternalPointer->GetCueProperties(static_cast<XACTINDEX>(cueIndex), &result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetCueProperties(static_cast<XACTINDEX>(cueIndex), &result) );
 		RECORD_XACT3(hr);
 
 		return CueProperties(result);
@@ -66,7 +99,7 @@ namespace XACT3
 	{
 		IXACT3Cue *cue;
 
-		HRESULT hr = InternalPointer->Prepare(static_cast<XACTINDEX>(cueIndex), 0, timeOffset, &cue);
+		HRESULT hr = TIME_CALL( InternalPointer->Prepare(static_cast<XACTINDEX>(cueIndex), 0, timeOffset, &cue) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
@@ -77,7 +110,7 @@ namespace XACT3
 	{
 		IXACT3Cue *cue = 0;
 
-		HRESULT hr = InternalPointer->Play(static_cast<XACTINDEX>(cueIndex), 0, timeOffset, &cue);
+		HRESULT hr = TIME_CALL( InternalPointer->Play(static_cast<XACTINDEX>(cueIndex), 0, timeOffset, &cue) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
@@ -86,7 +119,7 @@ namespace XACT3
 
 	Result SoundBank::Stop(int cueIndex, StopFlags flags)
 	{
-		HRESULT hr = InternalPointer->Stop(static_cast<XACTINDEX>(cueIndex), static_cast<DWORD>(flags));
+		HRESULT hr = TIME_CALL( InternalPointer->Stop(static_cast<XACTINDEX>(cueIndex), static_cast<DWORD>(flags)) );
 		return RECORD_XACT3(hr);
 	}
 
@@ -94,7 +127,7 @@ namespace XACT3
 	{
 		DWORD result;
 
-		HRESULT hr = InternalPointer->GetState(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetState(&result) );
 		RECORD_XACT3(hr);
 
 		return static_cast<SoundBankState>(result);
@@ -104,7 +137,7 @@ namespace XACT3
 	{
 		XACTINDEX result;
 
-		HRESULT hr = InternalPointer->GetNumCues(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetNumCues(&result) );
 		RECORD_XACT3(hr);
 
 		return result;
@@ -24,6 +24,7 @@
 #include "CueProperties.h"
 #include "Enums.h"
 #include "Cue.h"
+#include "SoundBankIndex.h"
 
 namespace SlimDX
 {
@@ -37,9 +38,13 @@ namespace SlimDX
 		{
 		private:
 			IXACT3SoundBank* InternalPointer;
+			SoundBankIndex^ index;
+
+			int GetEngineCueIndex(System::String^ friendlyName);
 
 		internal:
 			SoundBank( IXACT3SoundBank* pointer );
+			SoundBank( IXACT3SoundBank* pointer, SoundBankIndex^ index );
 
 		public:
 			Result Destroy();
@@ -96,6 +101,14 @@ namespace SlimDX
 			{
 				int get();
 			}
+
+			/// <summary>
+			/// Gets the header index used to look up cues by name, or <c>null</c> if cue lookups go through XACT.
+			/// </summary>
+			property SoundBankIndex^ Index
+			{
+				SoundBankIndex^ get() { return index; }
+			}
 		};
 	}
 }
@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include "SoundBankIndex.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Text;
+using namespace System::Collections::Generic;
+using namespace System::Collections::ObjectModel;
+
+namespace SlimDX
+{
+namespace XACT3
+{
+	// The sound bank format is not described by the SDK headers, so the fixed header is read field by field.
+	const int SoundBankHeaderSize = 138;
+	const int SoundBankNameLength = 64;
+	const DWORD NoOffset = 0xFFFFFFFF;
+
+	static DWORD ReadUInt16( const unsigned char* data, int offset )
+	{
+		return data[offset] | ( data[offset + 1] << 8 );
+	}
+
+	static DWORD ReadUInt32( const unsigned char* data, int offset )
+	{
+		return data[offset] | ( data[offset + 1] << 8 ) | ( data[offset + 2] << 16 ) | ( static_cast<DWORD>( data[offset + 3] ) << 24 );
+	}
+
+	static String^ ReadName( const unsigned char* data, int length )
+	{
+		int count = 0;
+		while( count < length && data[count] != 0 )
+			++count;
+
+		return gcnew String( reinterpret_cast<char*>( const_cast<unsigned char*>( data ) ), 0, count, Encoding::ASCII );
+	}
+
+	SoundBankIndex::SoundBankIndex( const void* data, int length )
+	{
+		Init( reinterpret_cast<const unsigned char*>( data ), length );
+	}
+
+	SoundBankIndex::SoundBankIndex( Stream^ stream )
+	{
+		if( stream == nullptr )
+			throw gcnew ArgumentNullException( "stream" );
+
+		MemoryStream^ memory = gcnew MemoryStream();
+		array<Byte>^ buffer = gcnew array<Byte>( 4096 );
+		for( int count = stream->Read( buffer, 0, buffer->Length ); count > 0; count = stream->Read( buffer, 0, buffer->Length ) )
+			memory->Write( buffer, 0, count );
+
+		array<Byte>^ data = memory->ToArray();
+		if( data->Length < SoundBankHeaderSize )
+			throw gcnew InvalidDataException( "Invalid sound bank file." );
+
+		pin_ptr<Byte> pinnedData = &data[0];
+		Init( pinnedData, data->Length );
+	}
+
+	void SoundBankIndex::Init( const unsigned char* data, int length )
+	{
+		if( length < SoundBankHeaderSize || memcmp( data, "SDBK", 4 ) != 0 )
+			throw gcnew InvalidDataException( "Invalid sound bank file." );
+
+		int simpleCueCount = ReadUInt16( data, 19 );
+		int complexCueCount = ReadUInt16( data, 21 );
+		int waveBankCount = data[27];
+		int cueNamesLength = ReadUInt16( data, 30 );
+		DWORD cueNamesOffset = ReadUInt32( data, 42 );
+		DWORD waveBankNamesOffset = ReadUInt32( data, 58 );
+
+		name = ReadName( data + 74, SoundBankNameLength );
+		cueCount = simpleCueCount + complexCueCount;
+
+		if( static_cast<__int64>( waveBankNamesOffset ) + waveBankCount * SoundBankNameLength > length )
+			throw gcnew InvalidDataException( "The sound bank is truncated." );
+
+		waveBankNames = gcnew array<String^>( waveBankCount );
+		for( int i = 0; i < waveBankCount; ++i )
+			waveBankNames[i] = ReadName( data + waveBankNamesOffset + i * SoundBankNameLength, SoundBankNameLength );
+
+		if( cueNamesOffset == NoOffset || cueCount == 0 )
+			return;
+
+		if( static_cast<__int64>( cueNamesOffset ) + cueNamesLength > length )
+			throw gcnew InvalidDataException( "The sound bank is truncated." );
+
+		// names are stored back to back, simple cues first, in cue index order
+		cueNames = gcnew array<String^>( cueCount );
+		names = gcnew Dictionary<String^, int>( cueCount, StringComparer::Ordinal );
+
+		const unsigned char* position = data + cueNamesOffset;
+		const unsigned char* end = position + cueNamesLength;
+		for( int i = 0; i < cueCount && position < end; ++i )
+		{
+			cueNames[i] = ReadName( position, static_cast<int>( end - position ) );
+			position += cueNames[i]->Length + 1;
+
+			if( !names->ContainsKey( cueNames[i] ) )
+				names->Add( cueNames[i], i );
+		}
+	}
+
+	int SoundBankIndex::GetCueIndex( String^ friendlyName )
+	{
+		int result;
+		if( names == nullptr || friendlyName == nullptr || !names->TryGetValue( friendlyName, result ) )
+			return -1;
+
+		return result;
+	}
+
+	String^ SoundBankIndex::GetCueName( int cueIndex )
+	{
+		if( cueIndex < 0 || cueIndex >= cueCount )
+			throw gcnew ArgumentOutOfRangeException( "cueIndex" );
+
+		return cueNames != nullptr ? cueNames[cueIndex] : nullptr;
+	}
+
+	ReadOnlyCollection<String^>^ SoundBankIndex::WaveBankNames::get()
+	{
+		return Array::AsReadOnly( waveBankNames );
+	}
+}
+}
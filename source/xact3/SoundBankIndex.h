@@ -0,0 +1,102 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	namespace XACT3
+	{
+		/// <summary>
+		/// Reads the header of an XACT sound bank (.xsb) so that cues can be looked up without the XACT engine.
+		/// </summary>
+		/// <remarks>
+		/// Cue name lookups use a hash table built once when the index is created.
+		/// </remarks>
+		public ref class SoundBankIndex sealed
+		{
+		private:
+			System::String^ name;
+			int cueCount;
+			array<System::String^>^ cueNames;
+			array<System::String^>^ waveBankNames;
+			System::Collections::Generic::Dictionary<System::String^, int>^ names;
+
+			void Init(const unsigned char* data, int length);
+
+		internal:
+			SoundBankIndex(const void* data, int length);
+
+		public:
+			/// <summary>
+			/// Reads a sound bank header from a stream.
+			/// </summary>
+			/// <param name="stream">A stream positioned at the start of the sound bank.</param>
+			SoundBankIndex(System::IO::Stream^ stream);
+
+			/// <summary>
+			/// Get a sound cue index based on a string that represents the friendly name of the cue.
+			/// </summary>
+			/// <param name="friendlyName">A string that contains the friendly name of the cue.</param>
+			/// <returns>The index for the cue if it exists, otherwise -1.</returns>
+			int GetCueIndex(System::String^ friendlyName);
+
+			/// <summary>
+			/// Gets the friendly name of a cue.
+			/// </summary>
+			/// <param name="cueIndex">The index of the cue.</param>
+			/// <returns>The friendly name of the cue, or <c>null</c> if the bank was built without names.</returns>
+			System::String^ GetCueName(int cueIndex);
+
+			/// <summary>
+			/// Gets the name of the sound bank.
+			/// </summary>
+			property System::String^ Name
+			{
+				System::String^ get() { return name; }
+			}
+
+			/// <summary>
+			/// Gets the names of the wave banks referenced by the sound bank.
+			/// </summary>
+			property System::Collections::ObjectModel::ReadOnlyCollection<System::String^>^ WaveBankNames
+			{
+				System::Collections::ObjectModel::ReadOnlyCollection<System::String^>^ get();
+			}
+
+			/// <summary>
+			/// Gets a value that is true if the sound bank contains friendly names for its cues, otherwise false.
+			/// </summary>
+			property bool HasNames
+			{
+				bool get() { return names != nullptr; }
+			}
+
+			/// <summary>
+			/// Get the number of sound cues in the sound bank.
+			/// </summary>
+			property int CueCount
+			{
+				int get() { return cueCount; }
+			}
+		};
+	}
+}
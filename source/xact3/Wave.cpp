@@ -35,19 +35,19 @@ namespace XACT3
 
 	Result Wave::Destroy()
 	{
-		HRESULT hr = InternalPointer->Destroy();
+		HRESULT hr = TIME_CALL( InternalPointer->Destroy() );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Wave::Pause(bool pause)
 	{
-		HRESULT hr = InternalPointer->Pause(pause);
+		HRESULT hr = TIME_CALL( InternalPointer->Pause(pause) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Wave::Play()
 	{
-		HRESULT hr = InternalPointer->Play();
+		HRESULT hr = TIME_CALL( InternalPointer->Play() );
 		return RECORD_XACT3(hr);
 	}
 
@@ -55,25 +55,25 @@ namespace XACT3
 	{
 		pin_ptr<float> pinnedMatrix = &matrixCoefficients[0];
 
-		HRESULT hr = InternalPointer->SetMatrixCoefficients(srcChannelCount, dstChannelCount, pinnedMatrix);
+		HRESULT hr = TIME_CALL( InternalPointer->SetMatrixCoefficients(srcChannelCount, dstChannelCount, pinnedMatrix) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Wave::SetPitch(int pitch)
 	{
-		HRESULT hr = InternalPointer->SetPitch(static_cast<XACTPITCH>(pitch));
+		HRESULT hr = TIME_CALL( InternalPointer->SetPitch(static_cast<XACTPITCH>(pitch)) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Wave::SetVolume(float volume)
 	{
-		HRESULT hr = InternalPointer->SetVolume(volume);
+		HRESULT hr = TIME_CALL( InternalPointer->SetVolume(volume) );
 		return RECORD_XACT3(hr);
 	}
 
 	Result Wave::Stop(StopFlags flags)
 	{
-		HRESULT hr = InternalPointer->Stop((DWORD)flags);
+		HRESULT hr = TIME_CALL( InternalPointer->Stop((DWORD)flags) );
 		return RECORD_XACT3(hr);
 	}
 
@@ -81,7 +81,7 @@ namespace XACT3
 	{
 		XACT_WAVE_INSTANCE_PROPERTIES result;
 
-		HRESULT hr = InternalPointer->GetProperties(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetProperties(&result) );
 		RECORD_XACT3(hr);
 
 		return WaveInstanceProperties(result);
@@ -91,7 +91,7 @@ namespace XACT3
 	{
 		DWORD result;
 
-		HRESULT hr = InternalPointer->GetState(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetState(&result) );
 		RECORD_XACT3(hr);
 
 		return static_cast<WaveState>(result);
@@ -34,17 +34,46 @@ namespace XACT3
 	{
 		InternalPointer = pointer;
 		handle = nullptr;
+		index = nullptr;
+		useIndexNames = false;
 	}
 
-	WaveBank::WaveBank( IXACT3WaveBank *pointer, Microsoft::Win32::SafeHandles::SafeFileHandle^ file )
+	WaveBank::WaveBank( IXACT3WaveBank *pointer, WaveBankIndex^ bankIndex )
+	{
+		InternalPointer = pointer;
+		handle = nullptr;
+		index = bankIndex;
+		VerifyIndexNames();
+	}
+
+	WaveBank::WaveBank( IXACT3WaveBank *pointer, Microsoft::Win32::SafeHandles::SafeFileHandle^ file, WaveBankIndex^ bankIndex )
 	{
 		InternalPointer = pointer;
 		handle = file;
+		index = bankIndex;
+		VerifyIndexNames();
+	}
+
+	void WaveBank::VerifyIndexNames()
+	{
+		useIndexNames = false;
+		if( index == nullptr || !index->HasNames || index->WaveCount != WaveCount )
+			return;
+
+		// The wave bank layout is not documented, so only answer name lookups from the index once XACT agrees with every name in it.
+		for( int i = 0; i < index->WaveCount; i++ )
+		{
+			String^ name = index->GetEntry( i ).FriendlyName;
+			if( name == nullptr || index->GetWaveIndex( name ) != i || GetEngineWaveIndex( name ) != i )
+				return;
+		}
+
+		useIndexNames = true;
 	}
 
 	Result WaveBank::Destroy()
 	{
-		HRESULT hr = InternalPointer->Destroy();
+		HRESULT hr = TIME_CALL( InternalPointer->Destroy() );
 		if (handle != nullptr)
 			delete handle;
 
@@ -53,7 +82,20 @@ namespace XACT3
 
 	int WaveBank::GetWaveIndex(String^ friendlyName)
 	{
-		array<unsigned char>^ friendlyNameBytes = System::Text::ASCIIEncoding::ASCII->GetBytes(friendlyName);
+		if (friendlyName == nullptr)
+			throw gcnew ArgumentNullException("friendlyName");
+
+		if (useIndexNames)
+			return index->GetWaveIndex(friendlyName);
+
+		return GetEngineWaveIndex(friendlyName);
+	}
+
+	int WaveBank::GetEngineWaveIndex(String^ friendlyName)
+	{
+		// XACT expects a null terminated string
+		array<unsigned char>^ friendlyNameBytes = gcnew array<unsigned char>(friendlyName->Length + 1);
+		System::Text::ASCIIEncoding::ASCII->GetBytes(friendlyName, 0, friendlyName->Length, friendlyNameBytes, 0);
 		pin_ptr<unsigned char> pinnedFriendlyName = &friendlyNameBytes[0];
 
 		XACTINDEX result = InternalPointer->GetWaveIndex(reinterpret_cast<PCSTR>(pinnedFriendlyName));
@@ -64,7 +106,7 @@ namespace XACT3
 	{
 		XACT_WAVE_PROPERTIES props;
 
-		HRESULT hr = InternalPointer->GetWaveProperties(static_cast<XACTINDEX>(waveIndex), &props);
+		HRESULT hr = TIME_CALL( InternalPointer->GetWaveProperties(static_cast<XACTINDEX>(waveIndex), &props) );
 		RECORD_XACT3(hr);
 
 		return WaveProperties(props);
@@ -74,7 +116,7 @@ namespace XACT3
 	{
 		IXACT3Wave* result;
 
-		HRESULT hr = InternalPointer->Play(static_cast<XACTINDEX>(waveIndex), static_cast<DWORD>(flags), playOffset, static_cast<XACTLOOPCOUNT>(loopCount), &result);
+		HRESULT hr = TIME_CALL( InternalPointer->Play(static_cast<XACTINDEX>(waveIndex), static_cast<DWORD>(flags), playOffset, static_cast<XACTLOOPCOUNT>(loopCount), &result) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
@@ -85,7 +127,7 @@ namespace XACT3
 	{
 		IXACT3Wave* result;
 
-		HRESULT hr = InternalPointer->Prepare(static_cast<XACTINDEX>(waveIndex), static_cast<DWORD>(flags), playOffset, static_cast<XACTLOOPCOUNT>(loopCount), &result);
+		HRESULT hr = TIME_CALL( InternalPointer->Prepare(static_cast<XACTINDEX>(waveIndex), static_cast<DWORD>(flags), playOffset, static_cast<XACTLOOPCOUNT>(loopCount), &result) );
 		if (RECORD_XACT3(hr).IsFailure)
 			return nullptr;
 
@@ -94,7 +136,7 @@ namespace XACT3
 
 	Result WaveBank::Stop(int waveIndex, StopFlags flags)
 	{
-		HRESULT hr = InternalPointer->Stop(static_cast<XACTINDEX>(waveIndex), static_cast<DWORD>(flags));
+		HRESULT hr = TIME_CALL( InternalPointer->Stop(static_cast<XACTINDEX>(waveIndex), static_cast<DWORD>(flags)) );
 		return RECORD_XACT3(hr);
 	}
 
@@ -102,7 +144,7 @@ namespace XACT3
 	{
 		DWORD result;
 
-		HRESULT hr = InternalPointer->GetState(&result);
+		HRESULT hr = TIME_CALL( InternalPointer->GetState(&result) );
 		RECORD_XACT3(hr);
 
 		return static_cast<WaveBankState>(result);
@@ -112,7 +154,7 @@ namespace XACT3
 	{
 		XACTINDEX count;
 
-		HRESULT hr = InternalPointer->GetNumWaves(&count);
+		HRESULT hr = TIME_CALL( InternalPointer->GetNumWaves(&count) );
 		RECORD_XACT3(hr);
 
 		return count;
@@ -24,6 +24,7 @@
 #include "Enums.h"
 #include "WaveProperties.h"
 #include "Wave.h"
+#include "WaveBankIndex.h"
 
 namespace SlimDX
 {
@@ -38,10 +39,16 @@ namespace SlimDX
 		private:
 			IXACT3WaveBank* InternalPointer;
 			Microsoft::Win32::SafeHandles::SafeFileHandle^ handle;
+			WaveBankIndex^ index;
+			bool useIndexNames;
+
+			void VerifyIndexNames();
+			int GetEngineWaveIndex(System::String^ friendlyName);
 
 		internal:
 			WaveBank( IXACT3WaveBank *pointer );
-			WaveBank( IXACT3WaveBank *pointer, Microsoft::Win32::SafeHandles::SafeFileHandle^ handle );
+			WaveBank( IXACT3WaveBank *pointer, WaveBankIndex^ index );
+			WaveBank( IXACT3WaveBank *pointer, Microsoft::Win32::SafeHandles::SafeFileHandle^ handle, WaveBankIndex^ index );
 
 		public:
 			Result Destroy();
@@ -102,6 +109,15 @@ namespace SlimDX
 			{
 				int get();
 			}
+
+			/// <summary>
+			/// Gets the header index used to inspect wave metadata, or <c>null</c> if the bank header could not be read. Names are only
+			/// looked up in the index when XACT agreed with every name in it at load time; otherwise lookups go through XACT.
+			/// </summary>
+			property WaveBankIndex^ Index
+			{
+				WaveBankIndex^ get() { return index; }
+			}
 		};
 	}
 }
@@ -0,0 +1,98 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "WaveBankMiniWaveFormat.h"
+#include "WaveBankSampleRegion.h"
+
+namespace SlimDX
+{
+	namespace XACT3
+	{
+		/// <summary>
+		/// The metadata stored in a wave bank for a single wave.
+		/// </summary>
+		/// <unmanaged>WAVEBANKENTRY</unmanaged>
+		public value class WaveBankEntry
+		{
+		private:
+			System::String^ name;
+			WaveBankMiniWaveFormat format;
+			int durationInSamples;
+			WaveBankSampleRegion loopRegion;
+			System::Int64 playOffset;
+			int playLength;
+
+		internal:
+			WaveBankEntry(System::String^ name, const WAVEBANKMINIWAVEFORMAT& format, int durationInSamples, const WAVEBANKSAMPLEREGION& loopRegion, System::Int64 playOffset, int playLength);
+
+		public:
+			/// <summary>
+			/// Gets the friendly name of the wave, or <c>null</c> if the bank was built without names.
+			/// </summary>
+			property System::String^ FriendlyName
+			{
+				System::String^ get() { return name; }
+			}
+
+			/// <summary>
+			/// Gets the format of the wave.
+			/// </summary>
+			property WaveBankMiniWaveFormat Format
+			{
+				WaveBankMiniWaveFormat get() { return format; }
+			}
+
+			/// <summary>
+			/// Gets the duration of the wave in samples, or zero if it cannot be determined from the bank header.
+			/// </summary>
+			property int DurationInSamples
+			{
+				int get() { return durationInSamples; }
+			}
+
+			/// <summary>
+			/// Gets the loop region of the wave.
+			/// </summary>
+			property WaveBankSampleRegion LoopRegion
+			{
+				WaveBankSampleRegion get() { return loopRegion; }
+			}
+
+			/// <summary>
+			/// Gets the offset of the wave data, in bytes from the start of the wave bank.
+			/// </summary>
+			property System::Int64 PlayOffset
+			{
+				System::Int64 get() { return playOffset; }
+			}
+
+			/// <summary>
+			/// Gets the size of the wave data, in bytes.
+			/// </summary>
+			property int PlayLength
+			{
+				int get() { return playLength; }
+			}
+		};
+	}
+}
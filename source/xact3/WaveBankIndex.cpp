@@ -0,0 +1,295 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#include "stdafx.h"
+
+#include <algorithm>
+#include <vector>
+#include <vcclr.h>
+
+#include "WaveBankIndex.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Text;
+using namespace System::Collections::Generic;
+
+namespace SlimDX
+{
+namespace XACT3
+{
+	// Reads ranges of a bank either from memory or from a seekable stream, so streaming banks only pay for their headers.
+	class BankReader
+	{
+	private:
+		const unsigned char* m_Data;
+		gcroot<Stream^> m_Stream;
+		__int64 m_Base;
+		__int64 m_Length;
+
+	public:
+		BankReader( const unsigned char* data, __int64 length, Stream^ stream )
+			: m_Data( data ), m_Stream( stream ), m_Base( 0 ), m_Length( length )
+		{
+			if( data == NULL )
+			{
+				m_Base = stream->Position;
+				m_Length = stream->Length - m_Base;
+			}
+		}
+
+		void Read( __int64 offset, void* destination, int size )
+		{
+			if( offset < 0 || size < 0 || offset + size > m_Length )
+				throw gcnew InvalidDataException( "The wave bank is truncated." );
+
+			if( size == 0 )
+				return;
+
+			if( m_Data != NULL )
+			{
+				memcpy( destination, m_Data + offset, size );
+				return;
+			}
+
+			array<Byte>^ buffer = gcnew array<Byte>( size );
+			m_Stream->Position = m_Base + offset;
+
+			int read = 0;
+			while( read < size )
+			{
+				int count = m_Stream->Read( buffer, read, size - read );
+				if( count <= 0 )
+					throw gcnew InvalidDataException( "The wave bank is truncated." );
+				read += count;
+			}
+
+			pin_ptr<Byte> pinnedBuffer = &buffer[0];
+			memcpy( destination, pinnedBuffer, size );
+		}
+	};
+
+	static String^ ReadName( const char* name, int maximumLength )
+	{
+		int length = 0;
+		while( length < maximumLength && name[length] != 0 )
+			++length;
+
+		return gcnew String( const_cast<char*>( name ), 0, length, Encoding::ASCII );
+	}
+
+	// Compact entries do not store a duration, so recover it from the data size where the format allows.
+	static int GetDuration( const WAVEBANKMINIWAVEFORMAT& format, DWORD length )
+	{
+		if( format.nChannels == 0 )
+			return 0;
+
+		switch( format.wFormatTag )
+		{
+		case WAVEBANKMINIFORMAT_TAG_PCM:
+			{
+				DWORD bytesPerSample = format.wBitsPerSample == WAVEBANKMINIFORMAT_BITDEPTH_16 ? 2 : 1;
+				return static_cast<int>( length / ( bytesPerSample * format.nChannels ) );
+			}
+
+		case WAVEBANKMINIFORMAT_TAG_ADPCM:
+			{
+				DWORD blockAlign = ( format.wBlockAlign + ADPCM_MINIWAVEFORMAT_BLOCKALIGN_CONVERSION_OFFSET ) * format.nChannels;
+				DWORD samplesPerBlock = blockAlign * 2 / format.nChannels - 12;
+				return static_cast<int>( ( length / blockAlign ) * samplesPerBlock );
+			}
+
+		default:
+			return 0;
+		}
+	}
+
+	WaveBankIndex::WaveBankIndex( const void* data, int length )
+	{
+		Init( reinterpret_cast<const unsigned char*>( data ), length, nullptr );
+	}
+
+	WaveBankIndex::WaveBankIndex( Stream^ stream )
+	{
+		if( stream == nullptr )
+			throw gcnew ArgumentNullException( "stream" );
+		if( !stream->CanSeek )
+			throw gcnew ArgumentException( "The stream must support seeking.", "stream" );
+
+		Init( NULL, 0, stream );
+	}
+
+	void WaveBankIndex::Init( const unsigned char* data, Int64 length, Stream^ stream )
+	{
+		BankReader reader( data, length, stream );
+
+		WAVEBANKHEADER header;
+		reader.Read( 0, &header, sizeof( header ) );
+
+		if( header.dwSignature != WAVEBANK_HEADER_SIGNATURE )
+			throw gcnew InvalidDataException( "Invalid wave bank file." );
+		if( header.dwVersion != XACT_CONTENT_VERSION || header.dwHeaderVersion != WAVEBANK_HEADER_VERSION )
+			throw gcnew InvalidDataException( "The wave bank was built for a different version of XACT." );
+
+		const WAVEBANKREGION& bankRegion = header.Segments[WAVEBANK_SEGIDX_BANKDATA];
+		const WAVEBANKREGION& metadataRegion = header.Segments[WAVEBANK_SEGIDX_ENTRYMETADATA];
+		const WAVEBANKREGION& namesRegion = header.Segments[WAVEBANK_SEGIDX_ENTRYNAMES];
+		const WAVEBANKREGION& waveRegion = header.Segments[WAVEBANK_SEGIDX_ENTRYWAVEDATA];
+
+		WAVEBANKDATA bank;
+		memset( &bank, 0, sizeof( bank ) );
+		reader.Read( bankRegion.dwOffset, &bank, static_cast<int>( bankRegion.dwLength < sizeof( bank ) ? bankRegion.dwLength : sizeof( bank ) ) );
+
+		name = ReadName( bank.szBankName, WAVEBANK_BANKNAME_LENGTH );
+		isStreaming = ( bank.dwFlags & WAVEBANK_TYPE_MASK ) == WAVEBANK_TYPE_STREAMING;
+		alignment = bank.dwAlignment == 0 ? 1 : bank.dwAlignment;
+
+		bool compact = ( bank.dwFlags & WAVEBANK_FLAGS_COMPACT ) != 0;
+		DWORD elementSize = compact ? sizeof( WAVEBANKENTRYCOMPACT ) : bank.dwEntryMetaDataElementSize;
+		__int64 metadataSize = static_cast<__int64>( bank.dwEntryCount ) * elementSize;
+		if( elementSize == 0 || metadataSize > metadataRegion.dwLength )
+			throw gcnew InvalidDataException( "Invalid wave bank entry metadata." );
+
+		std::vector<unsigned char> metadata( static_cast<size_t>( metadataSize ) + 1 );
+		reader.Read( metadataRegion.dwOffset, &metadata[0], static_cast<int>( metadataSize ) );
+
+		array<String^>^ entryNames = nullptr;
+		if( ( bank.dwFlags & WAVEBANK_FLAGS_ENTRYNAMES ) != 0 && bank.dwEntryNameElementSize > 0 &&
+			static_cast<__int64>( bank.dwEntryCount ) * bank.dwEntryNameElementSize <= namesRegion.dwLength )
+		{
+			std::vector<char> nameData( static_cast<size_t>( bank.dwEntryCount ) * bank.dwEntryNameElementSize + 1 );
+			reader.Read( namesRegion.dwOffset, &nameData[0], static_cast<int>( bank.dwEntryCount * bank.dwEntryNameElementSize ) );
+
+			entryNames = gcnew array<String^>( bank.dwEntryCount );
+			names = gcnew Dictionary<String^, int>( bank.dwEntryCount, StringComparer::Ordinal );
+			for( DWORD i = 0; i < bank.dwEntryCount; ++i )
+			{
+				entryNames[i] = ReadName( &nameData[i * bank.dwEntryNameElementSize], bank.dwEntryNameElementSize );
+
+				// XACT resolves duplicate names to the first wave that uses them
+				if( !names->ContainsKey( entryNames[i] ) )
+					names->Add( entryNames[i], i );
+			}
+		}
+
+		entries = gcnew array<WaveBankEntry>( bank.dwEntryCount );
+		for( DWORD i = 0; i < bank.dwEntryCount; ++i )
+		{
+			WAVEBANKENTRY entry;
+			memset( &entry, 0, sizeof( entry ) );
+
+			if( compact )
+			{
+				WAVEBANKENTRYCOMPACT current;
+				memcpy( &current, &metadata[i * elementSize], sizeof( current ) );
+
+				DWORD end = waveRegion.dwLength;
+				if( i + 1 < bank.dwEntryCount )
+				{
+					WAVEBANKENTRYCOMPACT next;
+					memcpy( &next, &metadata[( i + 1 ) * elementSize], sizeof( next ) );
+					end = next.dwOffset * alignment;
+				}
+
+				entry.Format = bank.CompactFormat;
+				entry.PlayRegion.dwOffset = current.dwOffset * alignment;
+				entry.PlayRegion.dwLength = end - entry.PlayRegion.dwOffset - current.dwLengthDeviation;
+				entry.Duration = GetDuration( entry.Format, entry.PlayRegion.dwLength );
+			}
+			else
+			{
+				// older banks use a shorter entry without the loop region
+				memcpy( &entry, &metadata[i * elementSize], elementSize < sizeof( entry ) ? elementSize : sizeof( entry ) );
+			}
+
+			if( static_cast<__int64>( entry.PlayRegion.dwOffset ) + entry.PlayRegion.dwLength > waveRegion.dwLength )
+				throw gcnew InvalidDataException( "A wave bank entry lies outside of the wave data." );
+
+			entries[i] = WaveBankEntry( entryNames != nullptr ? entryNames[i] : nullptr, entry.Format, entry.Duration, entry.LoopRegion,
+				static_cast<Int64>( waveRegion.dwOffset ) + entry.PlayRegion.dwOffset, entry.PlayRegion.dwLength );
+		}
+	}
+
+	int WaveBankIndex::GetWaveIndex( String^ friendlyName )
+	{
+		int result;
+		if( names == nullptr || friendlyName == nullptr || !names->TryGetValue( friendlyName, result ) )
+			return -1;
+
+		return result;
+	}
+
+	WaveBankEntry WaveBankIndex::GetEntry( int waveIndex )
+	{
+		if( waveIndex < 0 || waveIndex >= entries->Length )
+			throw gcnew ArgumentOutOfRangeException( "waveIndex" );
+
+		return entries[waveIndex];
+	}
+
+	array<WaveBankReadRange>^ WaveBankIndex::PlanPrefetch( array<int>^ waveIndices, int bytesPerWave )
+	{
+		if( waveIndices == nullptr )
+			throw gcnew ArgumentNullException( "waveIndices" );
+		if( bytesPerWave < 0 )
+			throw gcnew ArgumentOutOfRangeException( "bytesPerWave" );
+
+		std::vector<std::pair<__int64, __int64>> ranges;
+		ranges.reserve( waveIndices->Length );
+
+		for( int i = 0; i < waveIndices->Length; ++i )
+		{
+			WaveBankEntry entry = GetEntry( waveIndices[i] );
+
+			__int64 length = entry.PlayLength;
+			if( bytesPerWave > 0 && bytesPerWave < length )
+				length = bytesPerWave;
+
+			if( length == 0 )
+				continue;
+
+			// streaming reads must start and end on the bank's alignment
+			__int64 start = entry.PlayOffset - entry.PlayOffset % alignment;
+			__int64 end = entry.PlayOffset + length;
+			end += ( alignment - end % alignment ) % alignment;
+			ranges.push_back( std::make_pair( start, end ) );
+		}
+
+		std::sort( ranges.begin(), ranges.end() );
+
+		List<WaveBankReadRange>^ result = gcnew List<WaveBankReadRange>( static_cast<int>( ranges.size() ) );
+		for( size_t i = 0; i < ranges.size(); )
+		{
+			__int64 start = ranges[i].first;
+			__int64 end = ranges[i].second;
+			for( ++i; i < ranges.size() && ranges[i].first <= end; ++i )
+			{
+				if( ranges[i].second > end )
+					end = ranges[i].second;
+			}
+
+			result->Add( WaveBankReadRange( start, static_cast<int>( end - start ) ) );
+		}
+
+		return result->ToArray();
+	}
+}
+}
@@ -0,0 +1,122 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "WaveBankEntry.h"
+#include "WaveBankReadRange.h"
+
+namespace SlimDX
+{
+	namespace XACT3
+	{
+		/// <summary>
+		/// Reads the header of an XACT wave bank (.xwb) so that waves can be looked up and inspected without the XACT engine.
+		/// </summary>
+		/// <remarks>
+		/// Only the bank header, entry metadata and entry names are read; wave data is never touched. Name lookups use a hash
+		/// table built once when the index is created.
+		/// </remarks>
+		public ref class WaveBankIndex sealed
+		{
+		private:
+			System::String^ name;
+			bool isStreaming;
+			int alignment;
+			array<WaveBankEntry>^ entries;
+			System::Collections::Generic::Dictionary<System::String^, int>^ names;
+
+			void Init(const unsigned char* data, System::Int64 length, System::IO::Stream^ stream);
+
+		internal:
+			WaveBankIndex(const void* data, int length);
+
+		public:
+			/// <summary>
+			/// Reads a wave bank header from a stream.
+			/// </summary>
+			/// <param name="stream">A seekable stream positioned at the start of the wave bank.</param>
+			WaveBankIndex(System::IO::Stream^ stream);
+
+			/// <summary>
+			/// Get a wave index based on a string that represents the friendly name of the wave.
+			/// </summary>
+			/// <param name="friendlyName">A string that contains the friendly name of the wave.</param>
+			/// <returns>The index for the wave if it exists, otherwise -1.</returns>
+			int GetWaveIndex(System::String^ friendlyName);
+
+			/// <summary>
+			/// Gets the metadata of a wave.
+			/// </summary>
+			/// <param name="waveIndex">The index of the wave.</param>
+			/// <returns>The metadata of the wave.</returns>
+			WaveBankEntry GetEntry(int waveIndex);
+
+			/// <summary>
+			/// Determines the file reads needed to prefetch the start of a set of waves from a streaming bank.
+			/// </summary>
+			/// <param name="waveIndices">The indices of the waves to prefetch.</param>
+			/// <param name="bytesPerWave">The number of bytes to read from the start of each wave, or zero to read whole waves.</param>
+			/// <returns>Ranges aligned to the bank's alignment, sorted by offset, with overlapping and adjacent ranges merged.</returns>
+			array<WaveBankReadRange>^ PlanPrefetch(array<int>^ waveIndices, int bytesPerWave);
+
+			/// <summary>
+			/// Gets the name of the wave bank.
+			/// </summary>
+			property System::String^ Name
+			{
+				System::String^ get() { return name; }
+			}
+
+			/// <summary>
+			/// Gets a value that is true if the wave bank is a streaming bank, otherwise false.
+			/// </summary>
+			property bool IsStreaming
+			{
+				bool get() { return isStreaming; }
+			}
+
+			/// <summary>
+			/// Gets a value that is true if the wave bank contains friendly names for its waves, otherwise false.
+			/// </summary>
+			property bool HasNames
+			{
+				bool get() { return names != nullptr; }
+			}
+
+			/// <summary>
+			/// Gets the alignment of wave data in the bank, in bytes.
+			/// </summary>
+			property int Alignment
+			{
+				int get() { return alignment; }
+			}
+
+			/// <summary>
+			/// Gets the number of wave entries in the wave bank.
+			/// </summary>
+			property int WaveCount
+			{
+				int get() { return entries->Length; }
+			}
+		};
+	}
+}
@@ -0,0 +1,61 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+namespace SlimDX
+{
+	namespace XACT3
+	{
+		/// <summary>
+		/// A range of bytes in a wave bank file.
+		/// </summary>
+		public value class WaveBankReadRange
+		{
+		private:
+			System::Int64 offset;
+			int length;
+
+		internal:
+			WaveBankReadRange(System::Int64 offset, int length)
+				: offset(offset), length(length)
+			{
+			}
+
+		public:
+			/// <summary>
+			/// Gets the offset of the range, in bytes from the start of the wave bank.
+			/// </summary>
+			property System::Int64 Offset
+			{
+				System::Int64 get() { return offset; }
+			}
+
+			/// <summary>
+			/// Gets the size of the range, in bytes.
+			/// </summary>
+			property int Length
+			{
+				int get() { return length; }
+			}
+		};
+	}
+}
@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_XACT3(x) Result::Record<XACT3Exception^>( (x), (nullptr), (nullptr) )
+#define RECORD_XACT3(x) RECORD_RESULT( XACT3Exception^, x )
 
 namespace SlimDX
 {
@@ -41,7 +41,7 @@ namespace XAudio2
 	{
 		IXAudio2MasteringVoice *pointer;
 
-		HRESULT hr = device->InternalPointer->CreateMasteringVoice( &pointer, inputChannels, inputSampleRate, 0, deviceIndex );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateMasteringVoice( &pointer, inputChannels, inputSampleRate, 0, deviceIndex ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -53,7 +53,7 @@ namespace XAudio2
 	{
 		IXAudio2MasteringVoice *pointer;
 
-		HRESULT hr = device->InternalPointer->CreateMasteringVoice( &pointer, inputChannels, inputSampleRate, 0, 0 );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateMasteringVoice( &pointer, inputChannels, inputSampleRate, 0, 0 ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -65,7 +65,7 @@ namespace XAudio2
 	{
 		IXAudio2MasteringVoice *pointer;
 
-		HRESULT hr = device->InternalPointer->CreateMasteringVoice( &pointer, inputChannels, XAUDIO2_DEFAULT_SAMPLERATE, 0, 0 );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateMasteringVoice( &pointer, inputChannels, XAUDIO2_DEFAULT_SAMPLERATE, 0, 0 ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -77,7 +77,7 @@ namespace XAudio2
 	{
 		IXAudio2MasteringVoice *pointer;
 
-		HRESULT hr = device->InternalPointer->CreateMasteringVoice( &pointer, XAUDIO2_DEFAULT_CHANNELS, XAUDIO2_DEFAULT_SAMPLERATE, 0, 0 );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateMasteringVoice( &pointer, XAUDIO2_DEFAULT_CHANNELS, XAUDIO2_DEFAULT_SAMPLERATE, 0, 0 ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -50,7 +50,7 @@ namespace XAudio2
 		// Manual Allocation: cleaned up in the destructor / finalizer
 		callback = new VoiceCallbackShim( this );
 
-		HRESULT hr = device->InternalPointer->CreateSourceVoice( &pointer, format.get(), static_cast<UINT32>( flags ), maximumFrequencyRatio, callback );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateSourceVoice( &pointer, format.get(), static_cast<UINT32>( flags ), maximumFrequencyRatio, callback ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -66,7 +66,7 @@ namespace XAudio2
 		// Manual Allocation: cleaned up in the destructor / finalizer
 		callback = new VoiceCallbackShim( this );
 
-		HRESULT hr = device->InternalPointer->CreateSourceVoice( &pointer, format.get(), static_cast<UINT32>( flags ), XAUDIO2_DEFAULT_FREQ_RATIO, callback );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateSourceVoice( &pointer, format.get(), static_cast<UINT32>( flags ), XAUDIO2_DEFAULT_FREQ_RATIO, callback ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -82,7 +82,7 @@ namespace XAudio2
 		// Manual Allocation: cleaned up in the destructor / finalizer
 		callback = new VoiceCallbackShim( this );
 
-		HRESULT hr = device->InternalPointer->CreateSourceVoice( &pointer, format.get(), 0, XAUDIO2_DEFAULT_FREQ_RATIO, callback );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateSourceVoice( &pointer, format.get(), 0, XAUDIO2_DEFAULT_FREQ_RATIO, callback ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -145,61 +145,61 @@ namespace XAudio2
 
 	Result SourceVoice::Discontinuity()
 	{
-		HRESULT hr = SourcePointer->Discontinuity();
+		HRESULT hr = TIME_CALL( SourcePointer->Discontinuity() );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::FlushSourceBuffers()
 	{
-		HRESULT hr = SourcePointer->FlushSourceBuffers();
+		HRESULT hr = TIME_CALL( SourcePointer->FlushSourceBuffers() );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::ExitLoop()
 	{
-		HRESULT hr = SourcePointer->ExitLoop();
+		HRESULT hr = TIME_CALL( SourcePointer->ExitLoop() );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::ExitLoop( int operationSet )
 	{
-		HRESULT hr = SourcePointer->ExitLoop( operationSet );
+		HRESULT hr = TIME_CALL( SourcePointer->ExitLoop( operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::Start()
 	{
-		HRESULT hr = SourcePointer->Start( 0 );
+		HRESULT hr = TIME_CALL( SourcePointer->Start( 0 ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::Start( PlayFlags flags )
 	{
-		HRESULT hr = SourcePointer->Start( static_cast<UINT32>( flags ) );
+		HRESULT hr = TIME_CALL( SourcePointer->Start( static_cast<UINT32>( flags ) ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::Start( PlayFlags flags, int operationSet )
 	{
-		HRESULT hr = SourcePointer->Start( static_cast<UINT32>( flags ), operationSet );
+		HRESULT hr = TIME_CALL( SourcePointer->Start( static_cast<UINT32>( flags ), operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::Stop()
 	{
-		HRESULT hr = SourcePointer->Stop( 0 );
+		HRESULT hr = TIME_CALL( SourcePointer->Stop( 0 ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::Stop( PlayFlags flags )
 	{
-		HRESULT hr = SourcePointer->Stop( static_cast<UINT32>( flags ) );
+		HRESULT hr = TIME_CALL( SourcePointer->Stop( static_cast<UINT32>( flags ) ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result SourceVoice::Stop( PlayFlags flags, int operationSet )
 	{
-		HRESULT hr = SourcePointer->Stop( static_cast<UINT32>( flags ), operationSet );
+		HRESULT hr = TIME_CALL( SourcePointer->Stop( static_cast<UINT32>( flags ), operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -207,7 +207,7 @@ namespace XAudio2
 	{
 		XAUDIO2_BUFFER input = buffer->ToUnmanaged();
 
-		HRESULT hr = SourcePointer->SubmitSourceBuffer( &input );
+		HRESULT hr = TIME_CALL( SourcePointer->SubmitSourceBuffer( &input ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -224,14 +224,14 @@ namespace XAudio2
 		wma.pDecodedPacketCumulativeBytes = reinterpret_cast<UINT32*>( pinnedData );
 #endif
 
-		HRESULT hr = SourcePointer->SubmitSourceBuffer( &input, &wma );
+		HRESULT hr = TIME_CALL( SourcePointer->SubmitSourceBuffer( &input, &wma ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 #if SLIMDX_XAUDIO2_VERSION >= 24
 	Result SourceVoice::SetSourceSampleRate( int sampleRate ) 
 	{
-		HRESULT hr = SourcePointer->SetSourceSampleRate( sampleRate );
+		HRESULT hr = TIME_CALL( SourcePointer->SetSourceSampleRate( sampleRate ) );
 		return RECORD_XAUDIO2( hr );
 	}
 #endif
@@ -260,7 +260,7 @@ namespace XAudio2
 
 	void SourceVoice::FrequencyRatio::set( float value )
 	{
-		HRESULT hr = SourcePointer->SetFrequencyRatio( value );
+		HRESULT hr = TIME_CALL( SourcePointer->SetFrequencyRatio( value ) );
 		RECORD_XAUDIO2( hr );
 	}
 }
@@ -41,7 +41,7 @@ namespace XAudio2
 	{
 		IXAudio2SubmixVoice *pointer;
 
-		HRESULT hr = device->InternalPointer->CreateSubmixVoice( &pointer, inputChannels, inputSampleRate, 0, processingStage );
+		HRESULT hr = TIME_CALL( device->InternalPointer->CreateSubmixVoice( &pointer, inputChannels, inputSampleRate, 0, processingStage ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
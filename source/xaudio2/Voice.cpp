@@ -37,25 +37,25 @@ namespace XAudio2
 {
 	Result Voice::DisableEffect( int effectIndex )
 	{
-		HRESULT hr = InternalPointer->DisableEffect( effectIndex );
+		HRESULT hr = TIME_CALL( InternalPointer->DisableEffect( effectIndex ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result Voice::DisableEffect( int effectIndex, int operationSet )
 	{
-		HRESULT hr = InternalPointer->DisableEffect( effectIndex, operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->DisableEffect( effectIndex, operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result Voice::EnableEffect( int effectIndex )
 	{
-		HRESULT hr = InternalPointer->EnableEffect( effectIndex );
+		HRESULT hr = TIME_CALL( InternalPointer->EnableEffect( effectIndex ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result Voice::EnableEffect( int effectIndex, int operationSet )
 	{
-		HRESULT hr = InternalPointer->EnableEffect( effectIndex, operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->EnableEffect( effectIndex, operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -73,7 +73,7 @@ namespace XAudio2
 	{
 		pin_ptr<float> pinVolumes = &volumes[0];
 
-		HRESULT hr = InternalPointer->SetChannelVolumes( channels, reinterpret_cast<const float*>( pinVolumes ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetChannelVolumes( channels, reinterpret_cast<const float*>( pinVolumes ) ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -81,7 +81,7 @@ namespace XAudio2
 	{
 		pin_ptr<float> pinVolumes = &volumes[0];
 
-		HRESULT hr = InternalPointer->SetChannelVolumes( channels, reinterpret_cast<const float*>( pinVolumes ), operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->SetChannelVolumes( channels, reinterpret_cast<const float*>( pinVolumes ), operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -89,7 +89,7 @@ namespace XAudio2
 	{
 		pin_ptr<Byte> pinParams = &parameters[0];
 
-		HRESULT hr = InternalPointer->GetEffectParameters( effectIndex, pinParams, parameters->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEffectParameters( effectIndex, pinParams, parameters->Length ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -97,7 +97,7 @@ namespace XAudio2
 	T Voice::GetEffectParameters( int effectIndex )
 	{
 		T results;
-		HRESULT hr = InternalPointer->GetEffectParameters( effectIndex, &results, Marshal::SizeOf( T::typeid ) );
+		HRESULT hr = TIME_CALL( InternalPointer->GetEffectParameters( effectIndex, &results, Marshal::SizeOf( T::typeid ) ) );
 		RECORD_XAUDIO2( hr );
 
 		return results;
@@ -107,7 +107,7 @@ namespace XAudio2
 	{
 		pin_ptr<Byte> pinParams = &parameters[0];
 
-		HRESULT hr = InternalPointer->SetEffectParameters( effectIndex, pinParams, parameters->Length );
+		HRESULT hr = TIME_CALL( InternalPointer->SetEffectParameters( effectIndex, pinParams, parameters->Length ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -115,21 +115,21 @@ namespace XAudio2
 	{
 		pin_ptr<Byte> pinParams = &parameters[0];
 
-		HRESULT hr = InternalPointer->SetEffectParameters( effectIndex, pinParams, parameters->Length, operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->SetEffectParameters( effectIndex, pinParams, parameters->Length, operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	generic<typename T>
 	Result Voice::SetEffectParameters( int effectIndex, T parameters )
 	{
-		HRESULT hr = InternalPointer->SetEffectParameters( effectIndex, &parameters, Marshal::SizeOf( T::typeid ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetEffectParameters( effectIndex, &parameters, Marshal::SizeOf( T::typeid ) ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	generic<typename T>
 	Result Voice::SetEffectParameters( int effectIndex, T parameters, int operationSet )
 	{
-		HRESULT hr = InternalPointer->SetEffectParameters( effectIndex, &parameters, Marshal::SizeOf( T::typeid ), operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->SetEffectParameters( effectIndex, &parameters, Marshal::SizeOf( T::typeid ), operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -170,7 +170,7 @@ namespace XAudio2
 		chain.EffectCount = effects->Length;
 		chain.pEffectDescriptors = &descriptors[0];
 
-		HRESULT hr = InternalPointer->SetEffectChain( &chain );
+		HRESULT hr = TIME_CALL( InternalPointer->SetEffectChain( &chain ) );
 		
 		for (int i = 0; i < effects->Length; i++)
 			effects[i].Free();
@@ -189,8 +189,8 @@ namespace XAudio2
 
 		IXAudio2Voice *voice = destinationVoice == nullptr ? NULL : destinationVoice->InternalPointer;
 
-		HRESULT hr = InternalPointer->SetOutputMatrix( voice, sourceChannels,
-			destinationChannels, reinterpret_cast<const float*>( pinMatrix ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetOutputMatrix( voice, sourceChannels,
+			destinationChannels, reinterpret_cast<const float*>( pinMatrix ) ) );
 
 		return RECORD_XAUDIO2( hr );
 	}
@@ -206,8 +206,8 @@ namespace XAudio2
 
 		IXAudio2Voice *voice = destinationVoice == nullptr ? NULL : destinationVoice->InternalPointer;
 
-		HRESULT hr = InternalPointer->SetOutputMatrix( voice, sourceChannels,
-			destinationChannels, reinterpret_cast<const float*>( pinMatrix ), operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->SetOutputMatrix( voice, sourceChannels,
+			destinationChannels, reinterpret_cast<const float*>( pinMatrix ), operationSet ) );
 
 		return RECORD_XAUDIO2( hr );
 	}
@@ -221,7 +221,7 @@ namespace XAudio2
 		HRESULT hr;
 
 		if( outputVoices == nullptr || outputVoices->Length == 0 )
-			hr = InternalPointer->SetOutputVoices( NULL );
+			hr = TIME_CALL( InternalPointer->SetOutputVoices( NULL ) );
 		else
 		{
 #if SLIMDX_XAUDIO2_VERSION < 24
@@ -242,7 +242,7 @@ namespace XAudio2
 			sendList.pSends = &voices[0];
 #endif
 
-			hr = InternalPointer->SetOutputVoices( &sendList );
+			hr = TIME_CALL( InternalPointer->SetOutputVoices( &sendList ) );
 		}
 
 		return RECORD_XAUDIO2( hr );
@@ -266,7 +266,7 @@ namespace XAudio2
 	{
 		pin_ptr<SlimDX::XAudio2::FilterParameters> pinValue = &value;
 
-		HRESULT hr = InternalPointer->SetFilterParameters( reinterpret_cast<const XAUDIO2_FILTER_PARAMETERS*>( pinValue ) );
+		HRESULT hr = TIME_CALL( InternalPointer->SetFilterParameters( reinterpret_cast<const XAUDIO2_FILTER_PARAMETERS*>( pinValue ) ) );
 		RECORD_XAUDIO2( hr );
 	}
 
@@ -294,7 +294,7 @@ namespace XAudio2
 
 	void Voice::Volume::set( float value )
 	{
-		HRESULT hr = InternalPointer->SetVolume( value );
+		HRESULT hr = TIME_CALL( InternalPointer->SetVolume( value ) );
 		RECORD_XAUDIO2( hr );
 	}
 }
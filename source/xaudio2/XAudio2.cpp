@@ -44,7 +44,7 @@ namespace XAudio2
 	{
 		IXAudio2 *pointer;
 
-		HRESULT hr = XAudio2Create( &pointer, 0, XAUDIO2_DEFAULT_PROCESSOR );
+		HRESULT hr = TIME_CALL( XAudio2Create( &pointer, 0, XAUDIO2_DEFAULT_PROCESSOR ) );
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
 
@@ -52,7 +52,7 @@ namespace XAudio2
 
 		// Manual Allocation: cleaned up in the finalizer / destructor
 		callback = new EngineCallbackShim( this );
-		hr = pointer->RegisterForCallbacks( callback );
+		hr = TIME_CALL( pointer->RegisterForCallbacks( callback ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -62,7 +62,7 @@ namespace XAudio2
 	{
 		IXAudio2 *pointer;
 
-		HRESULT hr = XAudio2Create( &pointer, static_cast<UINT32>( flags ), static_cast<XAUDIO2_PROCESSOR>( processor ) );
+		HRESULT hr = TIME_CALL( XAudio2Create( &pointer, static_cast<UINT32>( flags ), static_cast<XAUDIO2_PROCESSOR>( processor ) ) );
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
 
@@ -70,7 +70,7 @@ namespace XAudio2
 
 		// Manual Allocation: cleaned up in the finalizer / destructor
 		callback = new EngineCallbackShim( this );
-		hr = pointer->RegisterForCallbacks( callback );
+		hr = TIME_CALL( pointer->RegisterForCallbacks( callback ) );
 
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			throw gcnew XAudio2Exception( Result::Last );
@@ -108,7 +108,7 @@ namespace XAudio2
 
 	Result XAudio2::StartEngine()
 	{
-		HRESULT hr = InternalPointer->StartEngine();
+		HRESULT hr = TIME_CALL( InternalPointer->StartEngine() );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -119,13 +119,13 @@ namespace XAudio2
 
 	Result XAudio2::CommitChanges()
 	{
-		HRESULT hr = InternalPointer->CommitChanges( XAUDIO2_COMMIT_ALL );
+		HRESULT hr = TIME_CALL( InternalPointer->CommitChanges( XAUDIO2_COMMIT_ALL ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
 	Result XAudio2::CommitChanges( int operationSet )
 	{
-		HRESULT hr = InternalPointer->CommitChanges( operationSet );
+		HRESULT hr = TIME_CALL( InternalPointer->CommitChanges( operationSet ) );
 		return RECORD_XAUDIO2( hr );
 	}
 
@@ -133,7 +133,7 @@ namespace XAudio2
 	{
 		XAUDIO2_DEVICE_DETAILS deviceDetails;
 
-		HRESULT hr = InternalPointer->GetDeviceDetails( index, &deviceDetails );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceDetails( index, &deviceDetails ) );
 		if( RECORD_XAUDIO2( hr ).IsFailure )
 			return nullptr;
 
@@ -148,7 +148,7 @@ namespace XAudio2
 	int XAudio2::DeviceCount::get()
 	{
 		UINT32 count = 0;
-		HRESULT hr = InternalPointer->GetDeviceCount( &count );
+		HRESULT hr = TIME_CALL( InternalPointer->GetDeviceCount( &count ) );
 		RECORD_XAUDIO2( hr );
 
 		return count;
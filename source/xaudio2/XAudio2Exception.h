@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_XAUDIO2(x) Result::Record<XAudio2Exception^>( (x), (nullptr), (nullptr) )
+#define RECORD_XAUDIO2(x) RECORD_RESULT( XAudio2Exception^, x )
 
 namespace SlimDX
 {
@@ -100,10 +100,11 @@ namespace XInput
 	Result Controller::GetKeystroke( DeviceQueryType device, Keystroke% result )
 	{
 		XINPUT_KEYSTROKE keystroke;
-		if( RECORD_XINPUT( ConvertError( XInputGetKeystroke( m_UserIndex, static_cast<DWORD>( device ), &keystroke ) ) ).IsSuccess )
+		Result status = RECORD_XINPUT( ConvertError( XInputGetKeystroke( m_UserIndex, static_cast<DWORD>( device ), &keystroke ) ) );
+		if( status.IsSuccess )
 			result = Keystroke( keystroke );
 		
-		return Result::Last;
+		return status;
 	}
 	
 	Result Controller::SetVibration( Vibration vibration )
@@ -23,7 +23,7 @@
 
 #include "../SlimDXException.h"
 
-#define RECORD_XINPUT(x) Result::Record<XInputException^>( (x), (nullptr), (nullptr) )
+#define RECORD_XINPUT(x) RECORD_RESULT( XInputException^, x )
 
 namespace SlimDX
 {
@@ -0,0 +1,263 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Benchmark.h"
+#include "ScopedThrowOnError.h"
+#include "ReferenceDevice11.h"
+
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+// Each iteration of the stream benchmarks processes StreamElements values, so
+// the reported time covers the whole pass rather than a single element.
+static const int StreamElements = 1024;
+
+// The ComObject benchmarks track real native objects created by the reference
+// device, so they measure the wrapper and the object table rather than a driver.
+ref class BenchmarkDevice
+{
+public:
+	BenchmarkDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(IntPtr(static_cast<ID3D11Device *>(reference))))
+	{
+	}
+	~BenchmarkDevice()
+	{
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	ID3D11Buffer *CreateNativeBuffer()
+	{
+		D3D11_BUFFER_DESC description = { 256, D3D11_USAGE_DEFAULT, D3D11_BIND_VERTEX_BUFFER, 0, 0, 0 };
+		ID3D11Buffer *buffer = 0;
+		if (FAILED(reference->CreateBuffer(&description, 0, &buffer)))
+			throw gcnew InvalidOperationException("The reference device failed to create a buffer.");
+		return buffer;
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+};
+
+BENCHMARK(DataStream, WriteInt32)
+{
+	DataStream ^stream = gcnew DataStream(StreamElements * sizeof(int), true, true);
+	while (state.KeepRunning())
+	{
+		stream->Position = 0;
+		for (int i = 0; i < StreamElements; ++i)
+			stream->Write<int>(i);
+	}
+	delete stream;
+}
+
+BENCHMARK(DataStream, ReadInt32)
+{
+	DataStream ^stream = gcnew DataStream(StreamElements * sizeof(int), true, true);
+	int sum = 0;
+	while (state.KeepRunning())
+	{
+		stream->Position = 0;
+		for (int i = 0; i < StreamElements; ++i)
+			sum += stream->Read<int>();
+	}
+	BenchmarkConsume(static_cast<float>(sum));
+	delete stream;
+}
+
+BENCHMARK(DataStream, WriteVector4)
+{
+	DataStream ^stream = gcnew DataStream(StreamElements * sizeof(Vector4), true, true);
+	Vector4 value(1.0f, 2.0f, 3.0f, 4.0f);
+	while (state.KeepRunning())
+	{
+		stream->Position = 0;
+		for (int i = 0; i < StreamElements; ++i)
+			stream->Write<Vector4>(value);
+	}
+	delete stream;
+}
+
+BENCHMARK(DataStream, WriteRange)
+{
+	DataStream ^stream = gcnew DataStream(StreamElements * sizeof(float), true, true);
+	array<float> ^data = gcnew array<float>(StreamElements);
+	while (state.KeepRunning())
+	{
+		stream->Position = 0;
+		stream->WriteRange<float>(data);
+	}
+	delete stream;
+}
+
+BENCHMARK(DataStream, ReadRange)
+{
+	DataStream ^stream = gcnew DataStream(StreamElements * sizeof(float), true, true);
+	array<float> ^data = gcnew array<float>(StreamElements);
+	while (state.KeepRunning())
+	{
+		stream->Position = 0;
+		stream->ReadRange<float>(data, 0, StreamElements);
+	}
+	BenchmarkConsume(data[0]);
+	delete stream;
+}
+
+BENCHMARK(DataStream, ReadRangeAllocating)
+{
+	DataStream ^stream = gcnew DataStream(StreamElements * sizeof(float), true, true);
+	float sum = 0.0f;
+	while (state.KeepRunning())
+	{
+		stream->Position = 0;
+		sum += stream->ReadRange<float>(StreamElements)[0];
+	}
+	BenchmarkConsume(sum);
+	delete stream;
+}
+
+BENCHMARK(ObjectTable, AddRemove)
+{
+	BenchmarkDevice ^device = gcnew BenchmarkDevice();
+	while (state.KeepRunning())
+	{
+		ObjectTable::Remove(device->Device);
+		ObjectTable::Add(device->Device, nullptr);
+	}
+	delete device;
+}
+
+BENCHMARK(ObjectTable, Find)
+{
+	BenchmarkDevice ^device = gcnew BenchmarkDevice();
+	IntPtr pointer = device->Device->ComPointer;
+	int found = 0;
+	while (state.KeepRunning())
+	{
+		if (ObjectTable::Find(pointer) != nullptr)
+			++found;
+	}
+	BenchmarkConsume(static_cast<float>(found));
+	delete device;
+}
+
+BENCHMARK(ObjectTable, FindMissing)
+{
+	IntPtr pointer(0x1000);
+	int found = 0;
+	while (state.KeepRunning())
+	{
+		if (ObjectTable::Find(pointer) != nullptr)
+			++found;
+	}
+	BenchmarkConsume(static_cast<float>(found));
+}
+
+BENCHMARK(ComObject, FromPointerConstruct)
+{
+	BenchmarkDevice ^device = gcnew BenchmarkDevice();
+	ID3D11Buffer *native = device->CreateNativeBuffer();
+	IntPtr pointer(native);
+	while (state.KeepRunning())
+	{
+		Buffer ^buffer = Buffer::FromPointer(pointer);
+		delete buffer;
+	}
+	native->Release();
+	delete device;
+}
+
+BENCHMARK(ComObject, FromPointerLookup)
+{
+	BenchmarkDevice ^device = gcnew BenchmarkDevice();
+	ID3D11Buffer *native = device->CreateNativeBuffer();
+	IntPtr pointer(native);
+	Buffer ^tracked = Buffer::FromPointer(pointer);
+	while (state.KeepRunning())
+	{
+		GC::KeepAlive(Buffer::FromPointer(pointer));
+	}
+	delete tracked;
+	native->Release();
+	delete device;
+}
+
+BENCHMARK(Result, RecordSuccess)
+{
+	while (state.KeepRunning())
+	{
+		Result::Record<Direct3D11Exception ^>(S_OK, nullptr, nullptr);
+	}
+}
+
+// Stores the result code in thread-static storage on every call, as Result.Record
+// did before successes stopped touching it; compare against RecordSuccess.
+BENCHMARK(Result, RecordSuccessAlwaysRecorded)
+{
+	bool saved = Configuration::AlwaysRecordLastResult;
+	Configuration::AlwaysRecordLastResult = true;
+	try
+	{
+		while (state.KeepRunning())
+		{
+			Result::Record<Direct3D11Exception ^>(S_OK, nullptr, nullptr);
+		}
+	}
+	finally
+	{
+		Configuration::AlwaysRecordLastResult = saved;
+	}
+}
+
+BENCHMARK(Result, RecordSuccessWithCallSite)
+{
+	// the expansion of RECORD_RESULT, which skips the call site bookkeeping while instrumentation is disabled
+	while (state.KeepRunning())
+	{
+		if (CallInstrumentation::Enabled)
+		{
+			CallInstrumentation::Begin("S_OK");
+			Result::Record<Direct3D11Exception ^>(S_OK, nullptr, nullptr, __FUNCTION__, __LINE__);
+		}
+		else
+			Result::Record<Direct3D11Exception ^>(S_OK, nullptr, nullptr);
+	}
+}
+
+BENCHMARK(Result, RecordFailure)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	while (state.KeepRunning())
+	{
+		Result::Record<Direct3D11Exception ^>(E_INVALIDARG, nullptr, nullptr);
+	}
+}
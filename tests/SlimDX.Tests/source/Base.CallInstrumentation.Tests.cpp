@@ -0,0 +1,231 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+// Call sites are keyed by the address of their function name, so each
+// site uses a single named string rather than repeated literals.
+static const char InlineSite[] = "InlineSite";
+static const char StoredSite[] = "StoredSite";
+static const char ThreadSite[] = "ThreadSite";
+
+// Mirrors the expansion of RECORD_RESULT, which only attributes the call while instrumentation is enabled.
+static void RecordCall(const char *site, const char *expression, int hr)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	if (CallInstrumentation::Enabled)
+	{
+		CallInstrumentation::Begin(expression);
+		Result::Record<Direct3D11Exception ^>(hr, nullptr, nullptr, site, 42);
+	}
+	else
+		Result::Record<Direct3D11Exception ^>(hr, nullptr, nullptr);
+}
+
+ref class RecordingThread
+{
+public:
+	static void Run()
+	{
+		for (int i = 0; i < 3; ++i)
+			RecordCall(ThreadSite, "Call()", S_OK);
+	}
+
+	static void RunToCompletion()
+	{
+		System::Threading::Thread ^thread = gcnew System::Threading::Thread(gcnew System::Threading::ThreadStart(&RecordingThread::Run));
+		thread->Start();
+		thread->Join();
+	}
+};
+
+class CallInstrumentationTest : public SlimDXTest
+{
+protected:
+	virtual void SetUp()
+	{
+		Configuration::EnableCallInstrumentation = true;
+		CallInstrumentation::SampleInterval = 1;
+		CallInstrumentation::Reset();
+	}
+
+	virtual void TearDown()
+	{
+		Configuration::EnableCallInstrumentation = false;
+		CallInstrumentation::SampleInterval = 16;
+		CallInstrumentation::Reset();
+		SlimDXTest::TearDown();
+	}
+
+	static void Record(const char *site, const char *expression, int hr)
+	{
+		RecordCall(site, expression, hr);
+	}
+
+	static CallSiteStatistics ^FindSite(CallInstrumentationSnapshot ^snapshot, const char *site)
+	{
+		String ^name = gcnew String(site);
+		for each (CallSiteStatistics ^statistics in snapshot->Sites)
+		{
+			if (statistics->FunctionName == name)
+				return statistics;
+		}
+		return nullptr;
+	}
+};
+
+TEST_F(CallInstrumentationTest, CountsCallsAndFailures)
+{
+	Record(InlineSite, "Call()", S_OK);
+	Record(InlineSite, "Call()", E_INVALIDARG);
+	Record(InlineSite, "Call()", S_OK);
+	Record(InlineSite, "Call()", E_FAIL);
+	Record(InlineSite, "Call()", S_FALSE);
+
+	CallSiteStatistics ^site = FindSite(CallInstrumentation::TakeSnapshot(), InlineSite);
+	ASSERT_TRUE(site != nullptr);
+	ASSERT_EQ(42, site->Line);
+	ASSERT_EQ(5, site->CallCount);
+	ASSERT_EQ(2, site->FailureCount);
+}
+
+TEST_F(CallInstrumentationTest, InlineCallsAreSampled)
+{
+	for (int i = 0; i < 4; ++i)
+		Record(InlineSite, "Call()", S_OK);
+
+	CallSiteStatistics ^site = FindSite(CallInstrumentation::TakeSnapshot(), InlineSite);
+	ASSERT_TRUE(site != nullptr);
+	ASSERT_EQ(4, site->SampleCount);
+
+	Int64 histogramTotal = 0;
+	for each (Int64 count in site->LatencyHistogram)
+		histogramTotal += count;
+	ASSERT_EQ(4, histogramTotal);
+}
+
+TEST_F(CallInstrumentationTest, StoredResultsAreCountedButNotSampled)
+{
+	for (int i = 0; i < 4; ++i)
+		Record(StoredSite, "hr", S_OK);
+
+	CallSiteStatistics ^site = FindSite(CallInstrumentation::TakeSnapshot(), StoredSite);
+	ASSERT_TRUE(site != nullptr);
+	ASSERT_EQ(4, site->CallCount);
+	ASSERT_EQ(0, site->SampleCount);
+}
+
+TEST_F(CallInstrumentationTest, TimedStoredResultsAreSampled)
+{
+	// what TIME_CALL does around a call whose result is stored in a local
+	for (int i = 0; i < 4; ++i)
+	{
+		CallInstrumentation::Begin();
+		int hr = S_OK;
+		Record(StoredSite, "hr", hr);
+	}
+
+	CallSiteStatistics ^site = FindSite(CallInstrumentation::TakeSnapshot(), StoredSite);
+	ASSERT_TRUE(site != nullptr);
+	ASSERT_EQ(4, site->CallCount);
+	ASSERT_EQ(4, site->SampleCount);
+}
+
+TEST_F(CallInstrumentationTest, CountsSurviveThreadExit)
+{
+	RecordingThread::RunToCompletion();
+	ASSERT_EQ(3, FindSite(CallInstrumentation::TakeSnapshot(), ThreadSite)->CallCount);
+
+	// registering the second thread retires the first thread's table
+	RecordingThread::RunToCompletion();
+	CallSiteStatistics ^site = FindSite(CallInstrumentation::TakeSnapshot(), ThreadSite);
+	ASSERT_TRUE(site != nullptr);
+	ASSERT_EQ(6, site->CallCount);
+	ASSERT_EQ(6, site->SampleCount);
+
+	CallInstrumentation::Reset();
+	RecordingThread::RunToCompletion();
+	ASSERT_EQ(3, FindSite(CallInstrumentation::TakeSnapshot(), ThreadSite)->CallCount);
+}
+
+TEST_F(CallInstrumentationTest, SampleIntervalSamplesEveryNthInlineCall)
+{
+	CallInstrumentation::SampleInterval = 4;
+	for (int i = 0; i < 8; ++i)
+	{
+		Record(InlineSite, "Call()", S_OK);
+		Record(StoredSite, "hr", S_OK);
+	}
+
+	CallInstrumentationSnapshot ^snapshot = CallInstrumentation::TakeSnapshot();
+	ASSERT_EQ(2, FindSite(snapshot, InlineSite)->SampleCount);
+	ASSERT_EQ(0, FindSite(snapshot, StoredSite)->SampleCount);
+}
+
+TEST_F(CallInstrumentationTest, EndFrameReportsDeltas)
+{
+	Record(InlineSite, "Call()", S_OK);
+	Record(InlineSite, "Call()", S_OK);
+	CallInstrumentation::EndFrame();
+
+	Record(InlineSite, "Call()", S_OK);
+	Record(InlineSite, "Call()", S_OK);
+	Record(InlineSite, "Call()", E_FAIL);
+	CallInstrumentationSnapshot ^frame = CallInstrumentation::EndFrame();
+
+	ASSERT_TRUE(frame == CallInstrumentation::LastFrame);
+	CallSiteStatistics ^site = FindSite(frame, InlineSite);
+	ASSERT_TRUE(site != nullptr);
+	ASSERT_EQ(3, site->CallCount);
+	ASSERT_EQ(1, site->FailureCount);
+	ASSERT_EQ(5, FindSite(CallInstrumentation::TakeSnapshot(), InlineSite)->CallCount);
+}
+
+TEST_F(CallInstrumentationTest, ResetDiscardsCounts)
+{
+	Record(InlineSite, "Call()", S_OK);
+	CallInstrumentation::Reset();
+
+	ASSERT_TRUE(FindSite(CallInstrumentation::TakeSnapshot(), InlineSite) == nullptr);
+	ASSERT_TRUE(CallInstrumentation::LastFrame == nullptr);
+}
+
+TEST_F(CallInstrumentationTest, DisabledRecordsNothing)
+{
+	Configuration::EnableCallInstrumentation = false;
+	Record(InlineSite, "Call()", S_OK);
+
+	ASSERT_TRUE(FindSite(CallInstrumentation::TakeSnapshot(), InlineSite) == nullptr);
+}
+
+TEST_F(CallInstrumentationTest, SampleIntervalRejectsZero)
+{
+	ASSERT_MANAGED_THROW(CallInstrumentation::SampleInterval = 0, ArgumentOutOfRangeException);
+}
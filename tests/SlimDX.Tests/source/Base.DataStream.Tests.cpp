@@ -66,3 +66,16 @@ TEST( DatastreamTests, ManagedArrayBackingReadBytesFromStart )
 	ASSERT_EQ( -1, stream->ReadByte() );
 	delete stream;
 }
+
+TEST( DatastreamTests, AccessAfterDisposeThrows )
+{
+	DataStream^ stream = gcnew DataStream( 16, true, true );
+	delete stream;
+
+	int value;
+	ASSERT_MANAGED_THROW( value = stream->ReadByte(), ObjectDisposedException );
+	ASSERT_MANAGED_THROW( value = stream->Read<int>(), ObjectDisposedException );
+	ASSERT_MANAGED_THROW( stream->Write( 1 ), ObjectDisposedException );
+	ASSERT_MANAGED_THROW( stream->Seek( 0, System::IO::SeekOrigin::Begin ), ObjectDisposedException );
+	ASSERT_EQ( 0, stream->Length );
+}
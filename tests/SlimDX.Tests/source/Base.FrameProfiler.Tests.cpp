@@ -0,0 +1,404 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace SlimDX;
+
+// Each timestamp slot reads back one millisecond after the previous one,
+// so GPU times in a resolved frame count the slots written between them.
+ref class GpuTimestampSourceFake : public IGpuTimestampSource
+{
+public:
+	GpuTimestampSourceFake(int frameLatency)
+	{
+		Latency = frameLatency;
+		Available = true;
+		Frequency = 1000000;
+		TicksPerSlot = 1000;
+	}
+
+	property int FrameLatency
+	{
+		virtual int get() { return Latency; }
+	}
+
+	virtual void BeginFrame(Int64 frame)
+	{
+		++BeginCount;
+	}
+
+	virtual void WriteTimestamp(Int64 frame, int slot)
+	{
+		++WriteCount;
+	}
+
+	virtual void EndFrame(Int64 frame)
+	{
+		++EndCount;
+	}
+
+	virtual bool TryGetTimestamps(Int64 frame, array<Int64> ^timestamps, int count, Int64 %frequency, bool %isDisjoint)
+	{
+		frequency = 0;
+		isDisjoint = false;
+		if (!Available)
+			return false;
+
+		for (int i = 0; i < count; ++i)
+			timestamps[i] = 5000 + i * TicksPerSlot;
+		frequency = Frequency;
+		isDisjoint = Disjoint;
+		return true;
+	}
+
+	int Latency;
+	bool Available;
+	bool Disjoint;
+	Int64 Frequency;
+	Int64 TicksPerSlot;
+	int BeginCount;
+	int WriteCount;
+	int EndCount;
+};
+
+class FrameProfilerTest : public SlimDXTest
+{
+protected:
+	// Records Frame { Draw { Shadows }, Post }, writing eight timestamps.
+	static void RecordNestedFrame(FrameProfiler ^profiler)
+	{
+		profiler->BeginFrame();
+		ProfilerScope ^draw = profiler->BeginScope("Draw");
+		ProfilerScope ^shadows = profiler->BeginScope("Shadows");
+		delete shadows;
+		delete draw;
+		ProfilerScope ^post = profiler->BeginScope("Post");
+		delete post;
+		profiler->EndFrame();
+	}
+
+	static void RecordSingleScopeFrame(FrameProfiler ^profiler, String ^name)
+	{
+		profiler->BeginFrame();
+		ProfilerScope ^scope = profiler->BeginScope(name);
+		delete scope;
+		profiler->EndFrame();
+	}
+
+	static ProfilerStatistics ^FindStatistics(FrameProfiler ^profiler, String ^path)
+	{
+		for each (ProfilerStatistics ^statistics in profiler->GetStatistics())
+		{
+			if (statistics->Path == path)
+				return statistics;
+		}
+		return nullptr;
+	}
+};
+
+TEST_F(FrameProfilerTest, NestedScopesBuildTree)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(2);
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+	RecordNestedFrame(profiler);
+
+	ProfilerFrame ^frame = profiler->LastFrame;
+	ASSERT_TRUE(frame != nullptr);
+	ASSERT_EQ(0, frame->FrameNumber);
+	ASSERT_TRUE(frame->HasGpuTimings);
+	ASSERT_FALSE(frame->IsDisjoint);
+
+	ProfilerNode ^root = frame->Root;
+	ASSERT_TRUE(gcnew String("Frame") == root->Name);
+	ASSERT_EQ(0, root->Depth);
+	ASSERT_EQ(2, root->Children->Count);
+
+	ProfilerNode ^draw = root->Children[0];
+	ASSERT_TRUE(gcnew String("Frame/Draw") == draw->Path);
+	ASSERT_EQ(1, draw->Depth);
+	ASSERT_EQ(1, draw->Children->Count);
+
+	ProfilerNode ^shadows = draw->Children[0];
+	ASSERT_TRUE(gcnew String("Frame/Draw/Shadows") == shadows->Path);
+	ASSERT_EQ(2, shadows->Depth);
+	ASSERT_EQ(0, shadows->Children->Count);
+
+	ProfilerNode ^post = root->Children[1];
+	ASSERT_TRUE(gcnew String("Frame/Post") == post->Path);
+	ASSERT_EQ(0, post->Children->Count);
+
+	ASSERT_EQ(1, source->BeginCount);
+	ASSERT_EQ(8, source->WriteCount);
+	ASSERT_EQ(1, source->EndCount);
+}
+
+TEST_F(FrameProfilerTest, GpuTimesFollowTimestampSlots)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler(gcnew GpuTimestampSourceFake(2));
+	RecordNestedFrame(profiler);
+
+	ProfilerNode ^root = profiler->LastFrame->Root;
+	ASSERT_DOUBLE_EQ(0.0, root->GpuStart);
+	ASSERT_DOUBLE_EQ(7.0, root->GpuTime);
+
+	ProfilerNode ^draw = root->Children[0];
+	ASSERT_DOUBLE_EQ(1.0, draw->GpuStart);
+	ASSERT_DOUBLE_EQ(3.0, draw->GpuTime);
+
+	ProfilerNode ^shadows = draw->Children[0];
+	ASSERT_DOUBLE_EQ(2.0, shadows->GpuStart);
+	ASSERT_DOUBLE_EQ(1.0, shadows->GpuTime);
+
+	ProfilerNode ^post = root->Children[1];
+	ASSERT_DOUBLE_EQ(5.0, post->GpuStart);
+	ASSERT_DOUBLE_EQ(1.0, post->GpuTime);
+
+	ASSERT_GE(root->CpuTime, draw->CpuTime);
+	ASSERT_GE(draw->CpuTime, shadows->CpuTime);
+}
+
+TEST_F(FrameProfilerTest, ScopesMustEndInReverseOrder)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler();
+	profiler->BeginFrame();
+	ProfilerScope ^outer = profiler->BeginScope("Outer");
+	ProfilerScope ^inner = profiler->BeginScope("Inner");
+	ASSERT_MANAGED_THROW(delete outer, InvalidOperationException);
+	ASSERT_MANAGED_THROW(profiler->EndFrame(), InvalidOperationException);
+	delete inner;
+	profiler->EndScope();
+	profiler->EndFrame();
+	ASSERT_EQ(1, profiler->LastFrame->Root->Children->Count);
+}
+
+TEST_F(FrameProfilerTest, CpuOnlyFramesResolveImmediately)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler();
+	RecordNestedFrame(profiler);
+
+	ProfilerFrame ^frame = profiler->LastFrame;
+	ASSERT_TRUE(frame != nullptr);
+	ASSERT_FALSE(frame->HasGpuTimings);
+	ASSERT_TRUE(Double::IsNaN(frame->Root->GpuTime));
+	ASSERT_EQ(0, profiler->PendingFrameCount);
+	ASSERT_EQ(0, profiler->DroppedFrameCount);
+	ASSERT_EQ(1, profiler->FrameNumber);
+}
+
+TEST_F(FrameProfilerTest, SourceMustAllowOneFrameInFlight)
+{
+	ASSERT_MANAGED_THROW(gcnew FrameProfiler(gcnew GpuTimestampSourceFake(0)), ArgumentException);
+}
+
+TEST_F(FrameProfilerTest, LateTimestampsResolveOnFlush)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(2);
+	source->Available = false;
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+	RecordNestedFrame(profiler);
+
+	ASSERT_TRUE(profiler->LastFrame == nullptr);
+	ASSERT_EQ(1, profiler->PendingFrameCount);
+
+	source->Available = true;
+	profiler->Flush();
+
+	ASSERT_TRUE(profiler->LastFrame != nullptr);
+	ASSERT_TRUE(profiler->LastFrame->HasGpuTimings);
+	ASSERT_EQ(0, profiler->PendingFrameCount);
+	ASSERT_EQ(0, profiler->DroppedFrameCount);
+}
+
+TEST_F(FrameProfilerTest, FramesBeyondLatencyAreDropped)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(2);
+	source->Available = false;
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+
+	RecordSingleScopeFrame(profiler, "Draw");
+	RecordSingleScopeFrame(profiler, "Draw");
+	ASSERT_EQ(2, profiler->PendingFrameCount);
+	ASSERT_EQ(0, profiler->DroppedFrameCount);
+
+	RecordSingleScopeFrame(profiler, "Draw");
+	ASSERT_EQ(2, profiler->PendingFrameCount);
+	ASSERT_EQ(1, profiler->DroppedFrameCount);
+
+	// A dropped frame still reports its CPU times.
+	ProfilerFrame ^frame = profiler->LastFrame;
+	ASSERT_EQ(0, frame->FrameNumber);
+	ASSERT_FALSE(frame->HasGpuTimings);
+	ASSERT_FALSE(frame->IsDisjoint);
+	ASSERT_TRUE(Double::IsNaN(frame->Root->GpuTime));
+	ASSERT_FALSE(Double::IsNaN(frame->Root->CpuTime));
+}
+
+TEST_F(FrameProfilerTest, FlushDropsUnavailableFrames)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(3);
+	source->Available = false;
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+	RecordSingleScopeFrame(profiler, "Draw");
+	RecordSingleScopeFrame(profiler, "Draw");
+
+	profiler->Flush();
+
+	ASSERT_EQ(0, profiler->PendingFrameCount);
+	ASSERT_EQ(2, profiler->DroppedFrameCount);
+	ASSERT_EQ(1, profiler->LastFrame->FrameNumber);
+}
+
+TEST_F(FrameProfilerTest, DisjointFramesHaveNoGpuTimes)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(2);
+	source->Disjoint = true;
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+	RecordSingleScopeFrame(profiler, "Draw");
+
+	ProfilerFrame ^frame = profiler->LastFrame;
+	ASSERT_TRUE(frame->IsDisjoint);
+	ASSERT_FALSE(frame->HasGpuTimings);
+	ASSERT_TRUE(Double::IsNaN(frame->Root->Children[0]->GpuTime));
+	ASSERT_EQ(0, profiler->DroppedFrameCount);
+
+	ProfilerStatistics ^statistics = FindStatistics(profiler, "Frame/Draw");
+	ASSERT_TRUE(statistics != nullptr);
+	ASSERT_EQ(1, statistics->SampleCount);
+	ASSERT_EQ(0, statistics->GpuSampleCount);
+	ASSERT_TRUE(Double::IsNaN(statistics->GpuAverage));
+}
+
+TEST_F(FrameProfilerTest, StatisticsSkipMissingGpuSamples)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(2);
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+	RecordSingleScopeFrame(profiler, "Draw");
+	source->TicksPerSlot = 3000;
+	RecordSingleScopeFrame(profiler, "Draw");
+	source->Disjoint = true;
+	RecordSingleScopeFrame(profiler, "Draw");
+
+	ProfilerStatistics ^statistics = FindStatistics(profiler, "Frame/Draw");
+	ASSERT_EQ(3, statistics->SampleCount);
+	ASSERT_EQ(2, statistics->GpuSampleCount);
+	ASSERT_DOUBLE_EQ(2.0, statistics->GpuAverage);
+	ASSERT_DOUBLE_EQ(1.0, statistics->GpuMinimum);
+	ASSERT_DOUBLE_EQ(3.0, statistics->GpuMaximum);
+	ASSERT_LE(statistics->CpuMinimum, statistics->CpuAverage);
+	ASSERT_LE(statistics->CpuAverage, statistics->CpuMaximum);
+}
+
+TEST_F(FrameProfilerTest, HistoryKeepsLastFrames)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler();
+	profiler->HistoryLength = 3;
+	for (int i = 0; i < 5; ++i)
+		RecordSingleScopeFrame(profiler, "Update");
+
+	ASSERT_EQ(2, profiler->GetStatistics()->Count);
+	ASSERT_TRUE(gcnew String("Frame") == profiler->GetStatistics()[0]->Path);
+	ASSERT_EQ(3, FindStatistics(profiler, "Frame/Update")->SampleCount);
+
+	RecordSingleScopeFrame(profiler, "Render");
+	ASSERT_EQ(3, profiler->GetStatistics()->Count);
+	ASSERT_EQ(1, FindStatistics(profiler, "Frame/Render")->SampleCount);
+	ASSERT_EQ(3, FindStatistics(profiler, "Frame/Update")->SampleCount);
+}
+
+TEST_F(FrameProfilerTest, HistoryLengthResetsStatistics)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler();
+	RecordSingleScopeFrame(profiler, "Update");
+	ASSERT_EQ(2, profiler->GetStatistics()->Count);
+
+	profiler->HistoryLength = 10;
+	ASSERT_EQ(10, profiler->HistoryLength);
+	ASSERT_EQ(0, profiler->GetStatistics()->Count);
+
+	ASSERT_MANAGED_THROW(profiler->HistoryLength = 0, ArgumentOutOfRangeException);
+}
+
+TEST_F(FrameProfilerTest, WriteStatisticsCsv)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler(gcnew GpuTimestampSourceFake(2));
+	RecordSingleScopeFrame(profiler, "Draw, Opaque");
+
+	StringWriter ^writer = gcnew StringWriter();
+	profiler->WriteStatisticsCsv(writer);
+	array<String ^> ^lines = writer->ToString()->Split(gcnew array<String ^> { writer->NewLine }, StringSplitOptions::RemoveEmptyEntries);
+
+	ASSERT_EQ(3, lines->Length);
+	ASSERT_TRUE(gcnew String("Path,Samples,CpuAverage,CpuMinimum,CpuMaximum,GpuSamples,GpuAverage,GpuMinimum,GpuMaximum") == lines[0]);
+	ASSERT_TRUE(lines[1]->StartsWith("Frame,1,"));
+	ASSERT_TRUE(lines[1]->EndsWith(",1,3,3,3"));
+	ASSERT_TRUE(lines[2]->StartsWith("\"Frame/Draw, Opaque\",1,"));
+	ASSERT_TRUE(lines[2]->EndsWith(",1,1,1,1"));
+	ASSERT_MANAGED_THROW(profiler->WriteStatisticsCsv(nullptr), ArgumentNullException);
+}
+
+TEST_F(FrameProfilerTest, WriteStatisticsJson)
+{
+	GpuTimestampSourceFake ^source = gcnew GpuTimestampSourceFake(2);
+	source->Disjoint = true;
+	FrameProfiler ^profiler = gcnew FrameProfiler(source);
+	RecordSingleScopeFrame(profiler, "Draw \"Opaque\"");
+
+	StringWriter ^writer = gcnew StringWriter();
+	profiler->WriteStatisticsJson(writer);
+	String ^json = writer->ToString();
+
+	ASSERT_TRUE(json->StartsWith("[{\"path\":\"Frame\",\"samples\":1,"));
+	ASSERT_TRUE(json->Contains("{\"path\":\"Frame/Draw \\\"Opaque\\\"\",\"samples\":1,"));
+	ASSERT_TRUE(json->Contains("\"gpuSamples\":0,\"gpuAverage\":null,\"gpuMinimum\":null,\"gpuMaximum\":null}"));
+	ASSERT_TRUE(json->EndsWith("}]"));
+	ASSERT_MANAGED_THROW(profiler->WriteStatisticsJson(nullptr), ArgumentNullException);
+}
+
+TEST_F(FrameProfilerTest, WriteFrameJsonAndCsv)
+{
+	FrameProfiler ^profiler = gcnew FrameProfiler(gcnew GpuTimestampSourceFake(2));
+	RecordNestedFrame(profiler);
+	ProfilerFrame ^frame = profiler->LastFrame;
+
+	StringWriter ^json = gcnew StringWriter();
+	frame->WriteJson(json);
+	ASSERT_TRUE(json->ToString()->StartsWith("{\"frame\":0,\"hasGpuTimings\":true,\"disjoint\":false,\"root\":{\"name\":\"Frame\","));
+	ASSERT_TRUE(json->ToString()->Contains("{\"name\":\"Shadows\","));
+	ASSERT_TRUE(json->ToString()->Contains(",\"gpuStart\":2,\"gpuTime\":1,\"children\":[]}"));
+
+	StringWriter ^csv = gcnew StringWriter();
+	frame->WriteCsv(csv);
+	array<String ^> ^lines = csv->ToString()->Split(gcnew array<String ^> { csv->NewLine }, StringSplitOptions::RemoveEmptyEntries);
+	ASSERT_EQ(5, lines->Length);
+	ASSERT_TRUE(gcnew String("Path,Depth,CpuStart,CpuTime,GpuStart,GpuTime") == lines[0]);
+	ASSERT_TRUE(lines[1]->StartsWith("Frame,0,0,"));
+	ASSERT_TRUE(lines[2]->StartsWith("Frame/Draw,1,"));
+	ASSERT_TRUE(lines[3]->StartsWith("Frame/Draw/Shadows,2,"));
+	ASSERT_TRUE(lines[3]->EndsWith(",2,1"));
+	ASSERT_TRUE(lines[4]->StartsWith("Frame/Post,1,"));
+}
@@ -0,0 +1,253 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+
+// A square grid of n by n quads, two triangles each, in row order.
+template <typename T>
+static std::vector<T> BuildGrid(int n)
+{
+	std::vector<T> indices;
+	for (int y = 0; y < n; ++y)
+	{
+		for (int x = 0; x < n; ++x)
+		{
+			T a = static_cast<T>(y * (n + 1) + x);
+			T b = static_cast<T>(a + 1);
+			T c = static_cast<T>(a + n + 1);
+			T d = static_cast<T>(c + 1);
+			T quad[] = { a, b, c, c, b, d };
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+
+	return indices;
+}
+
+// Rotates each triangle so its smallest index comes first, which keeps the winding, and sorts the triangles.
+template <typename T>
+static std::vector<std::vector<T> > CanonicalTriangles(const std::vector<T> &indices)
+{
+	std::vector<std::vector<T> > triangles;
+	for (size_t i = 0; i < indices.size(); i += 3)
+	{
+		std::vector<T> triangle(indices.begin() + i, indices.begin() + i + 3);
+		std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+		triangles.push_back(triangle);
+	}
+
+	std::sort(triangles.begin(), triangles.end());
+	return triangles;
+}
+
+class MeshOptimizerTest : public SlimDXTest
+{
+protected:
+	template <typename T>
+	static DataStream ^ToStream(const std::vector<T> &values)
+	{
+		DataStream ^stream = gcnew DataStream(static_cast<Int64>(values.size() * sizeof(T)), true, true);
+		memcpy(stream->DataPointer.ToPointer(), &values[0], values.size() * sizeof(T));
+		return stream;
+	}
+
+	template <typename T>
+	static std::vector<T> ToVector(DataStream ^stream, size_t count)
+	{
+		const T *data = static_cast<const T *>(stream->DataPointer.ToPointer());
+		return std::vector<T>(data, data + count);
+	}
+
+	template <typename T>
+	static VertexCacheStatistics Analyze(const std::vector<T> &indices, int vertexCount, int cacheSize)
+	{
+		DataStream ^stream = ToStream(indices);
+		VertexCacheStatistics statistics = MeshOptimizer::AnalyzeVertexCache(stream, static_cast<int>(indices.size()), sizeof(T) == 4, vertexCount, cacheSize);
+		delete stream;
+		return statistics;
+	}
+
+	template <typename T>
+	static std::vector<T> OptimizeVertexCache(const std::vector<T> &indices, int vertexCount, int cacheSize)
+	{
+		DataStream ^stream = ToStream(indices);
+		MeshOptimizer::OptimizeVertexCache(stream, static_cast<int>(indices.size()), sizeof(T) == 4, vertexCount, cacheSize);
+		std::vector<T> result = ToVector<T>(stream, indices.size());
+		delete stream;
+		return result;
+	}
+};
+
+TEST_F(MeshOptimizerTest, AnalyzeSimulatesFifoCache)
+{
+	const unsigned short strip[] = { 0, 1, 2,  2, 1, 3 };
+	VertexCacheStatistics statistics = Analyze(std::vector<unsigned short>(strip, strip + 6), 4, 3);
+	ASSERT_EQ(2, statistics.TriangleCount);
+	ASSERT_EQ(4, statistics.VertexCount);
+	ASSERT_EQ(4, statistics.VerticesTransformed);
+	ASSERT_EQ(3, statistics.CacheSize);
+	ASSERT_FLOAT_EQ(2.0f, statistics.AverageCacheMissRatio);
+	ASSERT_FLOAT_EQ(1.0f, statistics.AverageTransformToVertexRatio);
+	ASSERT_TRUE(statistics == VertexCacheStatistics(2, 4, 4, 3));
+
+	// a cache of two entries has evicted the first vertex by the time the triangle repeats
+	const unsigned int repeated[] = { 0, 1, 2,  0, 1, 2 };
+	ASSERT_EQ(6, Analyze(std::vector<unsigned int>(repeated, repeated + 6), 3, 2).VerticesTransformed);
+	ASSERT_EQ(3, Analyze(std::vector<unsigned int>(repeated, repeated + 6), 3, 3).VerticesTransformed);
+
+	// unreferenced vertices do not count towards the transform to vertex ratio
+	ASSERT_EQ(3, Analyze(std::vector<unsigned int>(repeated, repeated + 6), 10, 3).VertexCount);
+}
+
+TEST_F(MeshOptimizerTest, AnalyzeEmptyList)
+{
+	std::vector<unsigned int> none(1);
+	DataStream ^stream = ToStream(none);
+	VertexCacheStatistics statistics = MeshOptimizer::AnalyzeVertexCache(stream, 0, true, 0, 16);
+	ASSERT_EQ(0, statistics.TriangleCount);
+	ASSERT_EQ(0, statistics.VerticesTransformed);
+	ASSERT_EQ(0.0f, statistics.AverageCacheMissRatio);
+	ASSERT_EQ(0.0f, statistics.AverageTransformToVertexRatio);
+
+	// nothing to reorder is not an error
+	MeshOptimizer::OptimizeVertexCache(stream, 0, true, 0, 16);
+	delete stream;
+}
+
+TEST_F(MeshOptimizerTest, OptimizeVertexCacheReordersTriangles)
+{
+	const int Size = 16;
+	const int VertexCount = (Size + 1) * (Size + 1);
+	std::vector<unsigned int> grid = BuildGrid<unsigned int>(Size);
+
+	std::vector<unsigned int> optimized = OptimizeVertexCache(grid, VertexCount, 16);
+	ASSERT_TRUE(CanonicalTriangles(grid) == CanonicalTriangles(optimized));
+
+	VertexCacheStatistics before = Analyze(grid, VertexCount, 16);
+	VertexCacheStatistics after = Analyze(optimized, VertexCount, 16);
+	ASSERT_LT(after.VerticesTransformed, before.VerticesTransformed);
+	ASSERT_LT(after.AverageCacheMissRatio, 0.75f);
+	ASSERT_GE(after.VerticesTransformed, VertexCount);
+
+	// 16 bit indices go through the same optimizer
+	std::vector<unsigned short> shortGrid = BuildGrid<unsigned short>(Size);
+	std::vector<unsigned short> shortOptimized = OptimizeVertexCache(shortGrid, VertexCount, 16);
+	ASSERT_EQ(optimized.size(), shortOptimized.size());
+	for (size_t i = 0; i < optimized.size(); ++i)
+		ASSERT_EQ(optimized[i], shortOptimized[i]);
+}
+
+TEST_F(MeshOptimizerTest, OptimizeVertexFetchNumbersVerticesByFirstUse)
+{
+	// vertex 2 is never referenced and moves to the end
+	const unsigned short indexData[] = { 3, 1, 4,  1, 3, 0 };
+	const float vertexData[] = { 0.0f, 10.0f, 20.0f, 30.0f, 40.0f };
+	DataStream ^indices = ToStream(std::vector<unsigned short>(indexData, indexData + 6));
+	DataStream ^vertices = ToStream(std::vector<float>(vertexData, vertexData + 5));
+
+	array<int> ^remap = MeshOptimizer::OptimizeVertexFetch(indices, 6, false, vertices, 5, sizeof(float));
+
+	const int expectedRemap[] = { 3, 1, 4, 0, 2 };
+	ASSERT_EQ(5, remap->Length);
+	for (int i = 0; i < remap->Length; ++i)
+		ASSERT_EQ(expectedRemap[i], remap[i]);
+
+	const unsigned short expectedIndices[] = { 0, 1, 2,  1, 0, 3 };
+	std::vector<unsigned short> newIndices = ToVector<unsigned short>(indices, 6);
+	ASSERT_EQ(0, memcmp(expectedIndices, &newIndices[0], sizeof(expectedIndices)));
+
+	const float expectedVertices[] = { 30.0f, 10.0f, 40.0f, 0.0f, 20.0f };
+	std::vector<float> newVertices = ToVector<float>(vertices, 5);
+	ASSERT_EQ(0, memcmp(expectedVertices, &newVertices[0], sizeof(expectedVertices)));
+
+	delete vertices;
+	delete indices;
+}
+
+TEST_F(MeshOptimizerTest, OptimizeOverdrawDrawsOutwardClustersFirst)
+{
+	// two disconnected quads facing +z, one below the mesh center and one above it
+	const float positions[] =
+	{
+		0.0f, 0.0f, -1.0f,  1.0f, 0.0f, -1.0f,  0.0f, 1.0f, -1.0f,  1.0f, 1.0f, -1.0f,
+		0.0f, 0.0f, 1.0f,  1.0f, 0.0f, 1.0f,  0.0f, 1.0f, 1.0f,  1.0f, 1.0f, 1.0f
+	};
+	const unsigned int indexData[] = { 0, 1, 2,  2, 1, 3,  4, 5, 6,  6, 5, 7 };
+	DataStream ^indices = ToStream(std::vector<unsigned int>(indexData, indexData + 12));
+	DataStream ^vertices = ToStream(std::vector<float>(positions, positions + 24));
+
+	MeshOptimizer::OptimizeOverdraw(indices, 12, true, vertices, 8, 3 * sizeof(float), 0, 16, 1.05f);
+
+	// the quad facing away from the center is the likelier occluder
+	const unsigned int expected[] = { 4, 5, 6,  6, 5, 7,  0, 1, 2,  2, 1, 3 };
+	std::vector<unsigned int> result = ToVector<unsigned int>(indices, 12);
+	ASSERT_EQ(0, memcmp(expected, &result[0], sizeof(expected)));
+
+	delete vertices;
+	delete indices;
+}
+
+TEST_F(MeshOptimizerTest, RejectsInvalidArguments)
+{
+	const unsigned short indexData[] = { 0, 1, 2,  2, 1, 3 };
+	std::vector<unsigned short> triangles(indexData, indexData + 6);
+	DataStream ^indices = ToStream(triangles);
+	DataStream ^vertices = ToStream(std::vector<float>(12));
+	DataStream ^readOnly = gcnew DataStream(static_cast<const void *>(&triangles[0]), 12, true, true);
+	VertexCacheStatistics statistics;
+	array<int> ^remap;
+
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(nullptr, 6, false, 4, 16), ArgumentNullException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(indices, 4, false, 4, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(indices, 6, false, -1, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(indices, 6, false, 4, 0), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(indices, 6, false, 3, 16), ArgumentException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(indices, 6, true, 4, 16), ArgumentException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeVertexCache(readOnly, 6, false, 4, 16), NotSupportedException);
+	ASSERT_MANAGED_THROW(statistics = MeshOptimizer::AnalyzeVertexCache(indices, 6, false, 4, -1), ArgumentOutOfRangeException);
+
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeOverdraw(indices, 6, false, nullptr, 4, 12, 0, 16, 1.05f), ArgumentNullException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeOverdraw(indices, 6, false, vertices, 4, 0, 0, 16, 1.05f), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeOverdraw(indices, 6, false, vertices, 4, 16, 0, 16, 1.05f), ArgumentException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeOverdraw(indices, 6, false, vertices, 4, 12, 4, 16, 1.05f), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(MeshOptimizer::OptimizeOverdraw(indices, 6, false, vertices, 4, 12, 0, 16, 0.5f), ArgumentOutOfRangeException);
+
+	// the vertex fetch optimizer takes any index list, not only triangles
+	ASSERT_MANAGED_THROW(remap = MeshOptimizer::OptimizeVertexFetch(indices, -1, false, vertices, 4, 12), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(remap = MeshOptimizer::OptimizeVertexFetch(indices, 6, false, readOnly, 4, 3), NotSupportedException);
+
+	// nothing was modified by the rejected calls
+	ASSERT_TRUE(ToVector<unsigned short>(indices, 6) == triangles);
+
+	delete readOnly;
+	delete vertices;
+	delete indices;
+}
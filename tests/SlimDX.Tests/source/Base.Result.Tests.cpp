@@ -0,0 +1,107 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+static void RecordSuccessOnThread()
+{
+	Result::Record<Direct3D11Exception ^>(S_OK, nullptr, nullptr);
+}
+
+class ResultTest : public SlimDXTest
+{
+protected:
+	virtual void TearDown()
+	{
+		Configuration::AlwaysRecordLastResult = false;
+		SlimDXTest::TearDown();
+	}
+
+	static Result Record(int hr)
+	{
+		SCOPED_THROW_ON_ERROR(false);
+		return Result::Record<Direct3D11Exception ^>(hr, nullptr, nullptr);
+	}
+};
+
+TEST_F(ResultTest, LastReportsFailure)
+{
+	Record(E_INVALIDARG);
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+}
+
+TEST_F(ResultTest, SuccessLeavesLastFailure)
+{
+	Record(E_INVALIDARG);
+	ASSERT_EQ(S_OK, Record(S_OK).Code);
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+}
+
+TEST_F(ResultTest, SuccessCodesAreReturnedNotRecorded)
+{
+	ASSERT_EQ(S_FALSE, Record(S_FALSE).Code);
+	AssertLastResultSucceeded();
+	ASSERT_EQ(S_OK, Result::Last.Code);
+}
+
+TEST_F(ResultTest, ExpectedFailureIsRecordedWithoutThrowing)
+{
+	Result result = Result::Record<Direct3D11Exception ^>(E_INVALIDARG, false, nullptr, nullptr);
+	ASSERT_EQ(E_INVALIDARG, result.Code);
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+}
+
+TEST_F(ResultTest, LastIsPerThread)
+{
+	Record(E_INVALIDARG);
+	System::Threading::Thread ^thread = gcnew System::Threading::Thread(gcnew System::Threading::ThreadStart(&RecordSuccessOnThread));
+	thread->Start();
+	thread->Join();
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+}
+
+TEST_F(ResultTest, AlwaysRecordLastResultKeepsSemantics)
+{
+	Configuration::AlwaysRecordLastResult = true;
+	Record(E_INVALIDARG);
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+	Record(S_FALSE);
+	ASSERT_EQ(S_FALSE, Result::Last.Code);
+	Record(S_OK);
+	ASSERT_EQ(S_OK, Result::Last.Code);
+}
+
+TEST_F(ResultTest, SwitchingModesKeepsLast)
+{
+	Configuration::AlwaysRecordLastResult = true;
+	Record(E_INVALIDARG);
+	Configuration::AlwaysRecordLastResult = false;
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+	Record(S_OK);
+	ASSERT_EQ(E_INVALIDARG, Result::Last.Code);
+}
@@ -0,0 +1,338 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Benchmark.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics;
+using namespace System::Globalization;
+using namespace System::IO;
+using namespace System::Threading;
+
+namespace
+{
+	const int MaximumIterations = 1 << 30;
+
+	volatile float BenchmarkSink;
+
+	LONGLONG QueryCounter()
+	{
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		return counter.QuadPart;
+	}
+
+	double CounterFrequency()
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		return static_cast<double>(frequency.QuadPart);
+	}
+
+	double Median(array<double> ^sorted)
+	{
+		int middle = sorted->Length / 2;
+		if (sorted->Length % 2 == 0)
+			return (sorted[middle - 1] + sorted[middle]) / 2.0;
+		return sorted[middle];
+	}
+
+	bool ParseOption(String ^argument, String ^name, String ^%value)
+	{
+		String ^prefix = name + "=";
+		if (!argument->StartsWith(prefix, StringComparison::Ordinal))
+			return false;
+		value = argument->Substring(prefix->Length);
+		return true;
+	}
+}
+
+BenchmarkRegistration *BenchmarkRegistration::First = 0;
+
+BenchmarkRegistration::BenchmarkRegistration(const char *name, BenchmarkFunction function)
+	: Name(name),
+	Function(function),
+	Next(First)
+{
+	First = this;
+}
+
+void BenchmarkConsume(float value)
+{
+	BenchmarkSink = value;
+}
+
+BenchmarkState::BenchmarkState(int iterations)
+	: m_iterations(iterations),
+	m_remaining(iterations),
+	m_start(0),
+	m_elapsed(0)
+{
+}
+
+void BenchmarkState::Start()
+{
+	m_start = QueryCounter();
+}
+
+void BenchmarkState::Stop()
+{
+	m_elapsed = QueryCounter() - m_start;
+}
+
+double BenchmarkState::ElapsedSeconds() const
+{
+	return static_cast<double>(m_elapsed) / CounterFrequency();
+}
+
+BenchmarkRunner::BenchmarkRunner()
+	: m_filter(String::Empty),
+	m_samples(15),
+	m_minimumSampleTime(0.025),
+	m_tolerance(10.0)
+{
+}
+
+bool BenchmarkRunner::IsRequested(array<String ^> ^args)
+{
+	for each (String ^argument in args)
+	{
+		if (argument == "--benchmark" || argument->StartsWith("--benchmark_", StringComparison::Ordinal))
+			return true;
+	}
+	return false;
+}
+
+int BenchmarkRunner::Run(array<String ^> ^args)
+{
+	BenchmarkRunner ^runner = gcnew BenchmarkRunner();
+	if (!runner->ParseArguments(args))
+		return 2;
+
+	runner->PrepareEnvironment();
+	return runner->Execute();
+}
+
+bool BenchmarkRunner::ParseArguments(array<String ^> ^args)
+{
+	for each (String ^argument in args)
+	{
+		String ^value;
+		if (argument == "--benchmark")
+			continue;
+		else if (ParseOption(argument, "--benchmark_filter", value))
+			m_filter = value;
+		else if (ParseOption(argument, "--benchmark_samples", value))
+			m_samples = Int32::Parse(value, CultureInfo::InvariantCulture);
+		else if (ParseOption(argument, "--benchmark_min_time", value))
+			m_minimumSampleTime = Double::Parse(value, CultureInfo::InvariantCulture) / 1000.0;
+		else if (ParseOption(argument, "--benchmark_save", value))
+			m_savePath = value;
+		else if (ParseOption(argument, "--benchmark_baseline", value))
+			m_baselinePath = value;
+		else if (ParseOption(argument, "--benchmark_tolerance", value))
+			m_tolerance = Double::Parse(value, CultureInfo::InvariantCulture);
+		else
+		{
+			Console::Error->WriteLine("Unrecognized benchmark option '{0}'.", argument);
+			return false;
+		}
+	}
+
+	if (m_samples < 1 || m_minimumSampleTime <= 0.0 || m_tolerance < 0.0)
+	{
+		Console::Error->WriteLine("Benchmark samples, minimum time and tolerance must be positive.");
+		return false;
+	}
+	return true;
+}
+
+void BenchmarkRunner::PrepareEnvironment()
+{
+	// Keep the scheduler and the processor from moving the measurement around:
+	// run at raised priority, pinned to the first processor, and keep the
+	// diagnostics that add per-call work out of the timed paths.
+	try
+	{
+		Process::GetCurrentProcess()->PriorityClass = ProcessPriorityClass::High;
+	}
+	catch (ComponentModel::Win32Exception ^)
+	{
+		Console::Error->WriteLine("Warning: unable to raise the process priority.");
+	}
+	Thread::CurrentThread->Priority = ThreadPriority::Highest;
+	Thread::BeginThreadAffinity();
+	SetThreadAffinityMask(GetCurrentThread(), 1);
+
+	SlimDX::Configuration::EnableObjectTracking = false;
+	SlimDX::Configuration::EnableCallInstrumentation = false;
+
+#ifndef NDEBUG
+	Console::Error->WriteLine("Warning: benchmarking a debug build; results are not comparable to release baselines.");
+#endif
+	if (Debugger::IsAttached)
+		Console::Error->WriteLine("Warning: a debugger is attached; results will be inflated.");
+}
+
+double BenchmarkRunner::Measure(BenchmarkRegistration *benchmark, int iterations)
+{
+	BenchmarkState state(iterations);
+	benchmark->Function(state);
+	if (!state.Completed())
+		throw gcnew InvalidOperationException(String::Format(CultureInfo::InvariantCulture,
+			"Benchmark {0} returned before running all of its iterations.", gcnew String(benchmark->Name)));
+	return state.ElapsedSeconds();
+}
+
+int BenchmarkRunner::Calibrate(BenchmarkRegistration *benchmark)
+{
+	int iterations = 1;
+	for (;;)
+	{
+		double elapsed = Measure(benchmark, iterations);
+		if (elapsed >= m_minimumSampleTime || iterations >= MaximumIterations)
+			return iterations;
+
+		// Aim a little past the target so the next attempt is likely to be long
+		// enough, but do not trust a very short measurement for more than 10x.
+		double scale = elapsed > 0.0 ? m_minimumSampleTime * 1.25 / elapsed : 10.0;
+		scale = Math::Min(Math::Max(scale, 2.0), 10.0);
+		iterations = static_cast<int>(Math::Min(iterations * scale, static_cast<double>(MaximumIterations)));
+	}
+}
+
+array<double> ^BenchmarkRunner::Sample(BenchmarkRegistration *benchmark, int iterations)
+{
+	array<double> ^samples = gcnew array<double>(m_samples);
+
+	// Start each benchmark from a clean heap so collections caused by earlier
+	// benchmarks are not charged to this one.
+	GC::Collect();
+	GC::WaitForPendingFinalizers();
+	GC::Collect();
+
+	for (int i = 0; i < samples->Length; ++i)
+		samples[i] = Measure(benchmark, iterations) * 1.0e9 / iterations;
+
+	Array::Sort(samples);
+	return samples;
+}
+
+Dictionary<String ^, double> ^BenchmarkRunner::LoadBaseline(String ^path)
+{
+	Dictionary<String ^, double> ^baseline = gcnew Dictionary<String ^, double>(StringComparer::Ordinal);
+	for each (String ^line in File::ReadAllLines(path))
+	{
+		if (line->Length == 0 || line[0] == '#')
+			continue;
+
+		array<String ^> ^fields = line->Split('\t');
+		if (fields->Length != 2)
+			throw gcnew InvalidDataException(String::Format(CultureInfo::InvariantCulture,
+				"Malformed benchmark baseline line '{0}' in {1}.", line, path));
+		baseline[fields[0]] = Double::Parse(fields[1], CultureInfo::InvariantCulture);
+	}
+	return baseline;
+}
+
+void BenchmarkRunner::SaveBaseline(String ^path, SortedDictionary<String ^, double> ^results)
+{
+	StreamWriter ^writer = gcnew StreamWriter(path, false);
+	try
+	{
+		writer->WriteLine("# SlimDX benchmark baseline: median nanoseconds per iteration");
+		writer->WriteLine(String::Format(CultureInfo::InvariantCulture, "# Recorded {0:u} on {1}, {2} processors, CLR {3}, {4}-bit",
+			DateTime::UtcNow, Environment::MachineName, Environment::ProcessorCount, Environment::Version, IntPtr::Size * 8));
+		for each (KeyValuePair<String ^, double> result in results)
+			writer->WriteLine(String::Format(CultureInfo::InvariantCulture, "{0}\t{1:R}", result.Key, result.Value));
+	}
+	finally
+	{
+		delete writer;
+	}
+}
+
+int BenchmarkRunner::Execute()
+{
+	SortedList<String ^, IntPtr> ^benchmarks = gcnew SortedList<String ^, IntPtr>(StringComparer::Ordinal);
+	for (BenchmarkRegistration *benchmark = BenchmarkRegistration::First; benchmark != 0; benchmark = benchmark->Next)
+	{
+		String ^name = gcnew String(benchmark->Name);
+		if (name->IndexOf(m_filter, StringComparison::OrdinalIgnoreCase) >= 0)
+			benchmarks->Add(name, IntPtr(benchmark));
+	}
+
+	Dictionary<String ^, double> ^baseline = m_baselinePath != nullptr ? LoadBaseline(m_baselinePath) : nullptr;
+	SortedDictionary<String ^, double> ^results = gcnew SortedDictionary<String ^, double>(StringComparer::Ordinal);
+	int regressions = 0;
+
+	Console::WriteLine("{0,-44}{1,12}{2,12}{3,9}{4,12}{5,9}", "Benchmark", "Median ns", "Min ns", "Spread", "Baseline", "Delta");
+	for each (KeyValuePair<String ^, IntPtr> entry in benchmarks)
+	{
+		BenchmarkRegistration *benchmark = static_cast<BenchmarkRegistration *>(entry.Value.ToPointer());
+
+		// The first pass pays for JIT compilation and lazily created state.
+		Measure(benchmark, 1);
+		array<double> ^samples = Sample(benchmark, Calibrate(benchmark));
+
+		double median = Median(samples);
+		array<double> ^deviations = gcnew array<double>(samples->Length);
+		for (int i = 0; i < samples->Length; ++i)
+			deviations[i] = Math::Abs(samples[i] - median);
+		Array::Sort(deviations);
+		double spread = median > 0.0 ? Median(deviations) * 100.0 / median : 0.0;
+		results[entry.Key] = median;
+
+		String ^line = String::Format(CultureInfo::InvariantCulture, "{0,-44}{1,12:F2}{2,12:F2}{3,8:F1}%", entry.Key, median, samples[0], spread);
+		double reference;
+		if (baseline != nullptr && baseline->TryGetValue(entry.Key, reference) && reference > 0.0)
+		{
+			double delta = (median - reference) * 100.0 / reference;
+			line += String::Format(CultureInfo::InvariantCulture, "{0,12:F2}{1,8:+0.0;-0.0}%", reference, delta);
+			if (delta > m_tolerance)
+			{
+				line += "  REGRESSED";
+				++regressions;
+			}
+		}
+		else if (baseline != nullptr)
+		{
+			line += String::Format(CultureInfo::InvariantCulture, "{0,12}", "new");
+		}
+		Console::WriteLine(line);
+	}
+
+	if (m_savePath != nullptr)
+	{
+		SaveBaseline(m_savePath, results);
+		Console::WriteLine("Saved baseline for {0} benchmarks to {1}.", results->Count, m_savePath);
+	}
+
+	if (regressions > 0)
+	{
+		Console::WriteLine("{0} benchmarks exceeded the baseline by more than {1}%.", regressions, m_tolerance);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+// A small microbenchmark harness for measuring the overhead SlimDX adds on top
+// of the operations it wraps. Benchmarks are registered with the BENCHMARK macro
+// and run by passing --benchmark to the test executable; see BenchmarkRunner for
+// the remaining options.
+//
+// A benchmark body performs its setup, then loops while KeepRunning() returns
+// true, then cleans up. Only the loop itself is timed:
+//
+//	BENCHMARK(Group, Name)
+//	{
+//		// setup
+//		while (state.KeepRunning())
+//		{
+//			// operation under test
+//		}
+//		// teardown
+//	}
+class BenchmarkState
+{
+public:
+	explicit BenchmarkState(int iterations);
+
+	bool KeepRunning()
+	{
+		if (m_remaining == m_iterations)
+			Start();
+		if (m_remaining-- > 0)
+			return true;
+		Stop();
+		return false;
+	}
+
+	int Iterations() const { return m_iterations; }
+	bool Completed() const { return m_remaining < 0; }
+	double ElapsedSeconds() const;
+
+private:
+	void Start();
+	void Stop();
+
+	int m_iterations;
+	int m_remaining;
+	LONGLONG m_start;
+	LONGLONG m_elapsed;
+};
+
+typedef void (__clrcall *BenchmarkFunction)(BenchmarkState &state);
+
+// Registrations form an intrusive list that is built by static initializers,
+// in the same way Google Test collects its TEST bodies.
+struct BenchmarkRegistration
+{
+	BenchmarkRegistration(const char *name, BenchmarkFunction function);
+
+	const char *Name;
+	BenchmarkFunction Function;
+	BenchmarkRegistration *Next;
+
+	static BenchmarkRegistration *First;
+};
+
+// Keeps a computed value observable so the JIT cannot discard the work that
+// produced it.
+void BenchmarkConsume(float value);
+
+#define BENCHMARK(group_, name_) \
+	static void __clrcall group_##_##name_##_Benchmark(BenchmarkState &state); \
+	static BenchmarkRegistration group_##_##name_##_Registration(#group_ "." #name_, &group_##_##name_##_Benchmark); \
+	static void __clrcall group_##_##name_##_Benchmark(BenchmarkState &state)
+
+// Runs the registered benchmarks and optionally saves or compares against a
+// baseline file. Recognized arguments:
+//
+//	--benchmark                    run benchmarks instead of tests
+//	--benchmark_filter=<text>      only run benchmarks whose name contains <text>
+//	--benchmark_samples=<count>    timed samples per benchmark (default 15)
+//	--benchmark_min_time=<ms>      minimum duration of one sample (default 25)
+//	--benchmark_save=<file>        write the results as a new baseline
+//	--benchmark_baseline=<file>    compare the results against a saved baseline
+//	--benchmark_tolerance=<pct>    allowed slowdown against the baseline (default 10)
+//
+// The exit code is non-zero when any benchmark is slower than its baseline by
+// more than the tolerance, so the run can gate a library upgrade.
+ref class BenchmarkRunner
+{
+public:
+	static bool IsRequested(array<System::String ^> ^args);
+	static int Run(array<System::String ^> ^args);
+
+private:
+	BenchmarkRunner();
+
+	bool ParseArguments(array<System::String ^> ^args);
+	void PrepareEnvironment();
+	double Measure(BenchmarkRegistration *benchmark, int iterations);
+	int Calibrate(BenchmarkRegistration *benchmark);
+	array<double> ^Sample(BenchmarkRegistration *benchmark, int iterations);
+	System::Collections::Generic::Dictionary<System::String ^, double> ^LoadBaseline(System::String ^path);
+	void SaveBaseline(System::String ^path, System::Collections::Generic::SortedDictionary<System::String ^, double> ^results);
+	int Execute();
+
+	System::String ^m_filter;
+	int m_samples;
+	double m_minimumSampleTime;
+	System::String ^m_baselinePath;
+	System::String ^m_savePath;
+	double m_tolerance;
+};
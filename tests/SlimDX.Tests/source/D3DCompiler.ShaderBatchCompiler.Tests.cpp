@@ -0,0 +1,217 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace System::Text;
+using namespace SlimDX;
+using namespace SlimDX::D3DCompiler;
+
+static const char *ShaderSource =
+	"#include \"scale.hlsl\"\n"
+	"float4 Main(float4 position : POSITION) : SV_POSITION { return position * SCALE; }\n"
+	"float4 Other(float4 position : POSITION) : SV_POSITION { return position; }\n";
+
+// Serves scale.hlsl and counts how often it is opened. The value of SCALE comes from a macro when one is defined.
+ref class CountingInclude : public Include
+{
+public:
+	int OpenCount;
+	bool Fail;
+
+	virtual void Open(IncludeType, String ^fileName, Stream ^, [Runtime::InteropServices::Out] Stream ^%stream)
+	{
+		++OpenCount;
+		if (Fail)
+			throw gcnew FileNotFoundException("No such include.", fileName);
+
+		stream = gcnew MemoryStream(Encoding::ASCII->GetBytes("#ifndef SCALE\n#define SCALE 2\n#endif\n"));
+	}
+
+	virtual void Close(Stream ^stream)
+	{
+		delete stream;
+	}
+};
+
+class ShaderBatchCompilerTest : public SlimDXTest
+{
+protected:
+	static ShaderCompilationJob ^Job(String ^entryPoint, array<ShaderMacro> ^defines)
+	{
+		return gcnew ShaderCompilationJob(gcnew String(ShaderSource), entryPoint, "vs_4_0", defines);
+	}
+
+	static array<ShaderMacro> ^Scale(String ^value)
+	{
+		array<ShaderMacro> ^defines = gcnew array<ShaderMacro>(1);
+		defines[0] = ShaderMacro("SCALE", value);
+		return defines;
+	}
+
+	static bool SameBytecode(ShaderBytecode ^left, ShaderBytecode ^right)
+	{
+		ID3D10Blob *a = left->InternalPointer;
+		ID3D10Blob *b = right->InternalPointer;
+		return a->GetBufferSize() == b->GetBufferSize() && memcmp(a->GetBufferPointer(), b->GetBufferPointer(), a->GetBufferSize()) == 0;
+	}
+
+	static void DeleteBytecode(array<ShaderCompilationResult^> ^results)
+	{
+		for each (ShaderCompilationResult ^result in results)
+			delete result->Bytecode;
+	}
+};
+
+#define SHADERBATCHCOMPILER_TEST(name_) TEST_F(ShaderBatchCompilerTest, name_)
+
+SHADERBATCHCOMPILER_TEST(CompilesIdenticalPermutationsOnce)
+{
+	CountingInclude include;
+	array<ShaderCompilationJob^> ^jobs = gcnew array<ShaderCompilationJob^>(4);
+	jobs[0] = Job("Main", nullptr);
+	jobs[1] = Job("Main", Scale("2"));		// preprocesses to the same text as the include's default
+	jobs[2] = Job("Main", Scale("3"));
+	jobs[3] = Job("Main", nullptr);
+
+	array<ShaderCompilationResult^> ^results = ShaderBatchCompiler::Compile(jobs, %include, 2);
+	ASSERT_EQ(4, results->Length);
+	for (int i = 0; i < results->Length; ++i)
+	{
+		ASSERT_TRUE(results[i]->Job == jobs[i]);
+		ASSERT_TRUE(results[i]->IsSuccess);
+		ASSERT_TRUE(results[i]->ResultCode.IsSuccess);
+		ASSERT_TRUE(results[i]->Error == nullptr);
+	}
+
+	// the last job repeats the first one's source and macros, so it is not preprocessed again
+	ASSERT_EQ(3, include.OpenCount);
+	ASSERT_TRUE(TimeSpan::Zero == results[3]->PreprocessTime);
+
+	ASSERT_FALSE(results[0]->IsDuplicate);
+	ASSERT_TRUE(results[1]->IsDuplicate);
+	ASSERT_FALSE(results[2]->IsDuplicate);
+	ASSERT_TRUE(results[3]->IsDuplicate);
+	ASSERT_TRUE(SameBytecode(results[0]->Bytecode, results[1]->Bytecode));
+	ASSERT_TRUE(SameBytecode(results[0]->Bytecode, results[3]->Bytecode));
+	ASSERT_FALSE(SameBytecode(results[0]->Bytecode, results[2]->Bytecode));
+
+	// duplicates get their own copy rather than sharing the compiler's blob
+	ASSERT_TRUE(results[0]->Bytecode->InternalPointer != results[1]->Bytecode->InternalPointer);
+
+	DeleteBytecode(results);
+}
+
+SHADERBATCHCOMPILER_TEST(CompilesDifferentEntryPointsSeparately)
+{
+	CountingInclude include;
+	array<ShaderCompilationJob^> ^jobs = gcnew array<ShaderCompilationJob^>(2);
+	jobs[0] = Job("Main", nullptr);
+	jobs[1] = Job("Other", nullptr);
+
+	array<ShaderCompilationResult^> ^results = ShaderBatchCompiler::Compile(jobs, %include, 1);
+	ASSERT_EQ(1, include.OpenCount);
+	ASSERT_TRUE(results[0]->IsSuccess);
+	ASSERT_TRUE(results[1]->IsSuccess);
+	ASSERT_FALSE(results[1]->IsDuplicate);
+	ASSERT_FALSE(SameBytecode(results[0]->Bytecode, results[1]->Bytecode));
+
+	DeleteBytecode(results);
+}
+
+SHADERBATCHCOMPILER_TEST(ReportsErrorsPerJob)
+{
+	CountingInclude include;
+	array<ShaderCompilationJob^> ^jobs = gcnew array<ShaderCompilationJob^>(3);
+	jobs[0] = Job("Main", nullptr);
+	jobs[1] = Job("Missing", nullptr);
+	jobs[2] = gcnew ShaderCompilationJob("#error stop here\n", "Main", "vs_4_0", nullptr);
+
+	array<ShaderCompilationResult^> ^results = nullptr;
+	ASSERT_NO_THROW(results = ShaderBatchCompiler::Compile(jobs, %include, 0));
+
+	// one failing job does not affect the others
+	ASSERT_TRUE(results[0]->IsSuccess);
+
+	ASSERT_FALSE(results[1]->IsSuccess);
+	ASSERT_TRUE(results[1]->Bytecode == nullptr);
+	ASSERT_TRUE(results[1]->ResultCode.IsFailure);
+	ASSERT_TRUE(results[1]->CompilationErrors->Contains("Missing"));
+	ASSERT_TRUE(results[1]->Error == nullptr);
+
+	// preprocessor failures never reach the compiler
+	ASSERT_FALSE(results[2]->IsSuccess);
+	ASSERT_TRUE(results[2]->ResultCode.IsFailure);
+	ASSERT_TRUE(results[2]->CompilationErrors->Contains("stop here"));
+	ASSERT_TRUE(TimeSpan::Zero == results[2]->CompileTime);
+
+	DeleteBytecode(results);
+}
+
+SHADERBATCHCOMPILER_TEST(ReportsIncludeFailures)
+{
+	CountingInclude include;
+	include.Fail = true;
+	array<ShaderCompilationJob^> ^jobs = gcnew array<ShaderCompilationJob^>(2);
+	jobs[0] = Job("Main", Scale("4"));
+	jobs[1] = Job("Other", Scale("4"));
+
+	array<ShaderCompilationResult^> ^results = ShaderBatchCompiler::Compile(jobs, %include, 0);
+	ASSERT_EQ(1, include.OpenCount);
+	ASSERT_FALSE(results[0]->IsSuccess);
+	ASSERT_FALSE(results[1]->IsSuccess);
+	ASSERT_TRUE(results[0]->ResultCode.IsFailure);
+	ASSERT_TRUE(results[1]->ResultCode.IsFailure);
+
+	// the batch keeps working afterwards with the same macros
+	include.Fail = false;
+	results = ShaderBatchCompiler::Compile(jobs, %include, 0);
+	ASSERT_TRUE(results[0]->IsSuccess);
+	ASSERT_TRUE(results[1]->IsSuccess);
+
+	DeleteBytecode(results);
+}
+
+SHADERBATCHCOMPILER_TEST(RejectsInvalidJobs)
+{
+	array<ShaderCompilationResult^> ^results = nullptr;
+	ASSERT_MANAGED_THROW(results = ShaderBatchCompiler::Compile(nullptr), ArgumentNullException);
+
+	array<ShaderCompilationJob^> ^jobs = gcnew array<ShaderCompilationJob^>(1);
+	ASSERT_MANAGED_THROW(results = ShaderBatchCompiler::Compile(jobs), ArgumentException);
+
+	jobs[0] = gcnew ShaderCompilationJob("", "Main", "vs_4_0", nullptr);
+	ASSERT_MANAGED_THROW(results = ShaderBatchCompiler::Compile(jobs), ArgumentException);
+
+	jobs[0] = gcnew ShaderCompilationJob(gcnew String(ShaderSource), "Main", nullptr, nullptr);
+	ASSERT_MANAGED_THROW(results = ShaderBatchCompiler::Compile(jobs), ArgumentException);
+
+	results = ShaderBatchCompiler::Compile(gcnew array<ShaderCompilationJob^>(0));
+	ASSERT_EQ(0, results->Length);
+}
@@ -0,0 +1,390 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::D3DCompiler;
+
+// Builds a small vertex shader container by hand: an input signature with
+// one element, resource definitions with one constant buffer and one
+// texture, and a statistics chunk.
+static void PutUInt32(std::vector<unsigned char> &bytes, unsigned int value)
+{
+	for (int i = 0; i < 4; ++i)
+		bytes.push_back(static_cast<unsigned char>(value >> (i * 8)));
+}
+
+static void PutUInt16(std::vector<unsigned char> &bytes, unsigned int value)
+{
+	bytes.push_back(static_cast<unsigned char>(value));
+	bytes.push_back(static_cast<unsigned char>(value >> 8));
+}
+
+static void PutString(std::vector<unsigned char> &bytes, const char *value)
+{
+	bytes.insert(bytes.end(), value, value + strlen(value) + 1);
+}
+
+static unsigned int FourCC(const char *name)
+{
+	return name[0] | (name[1] << 8) | (name[2] << 16) | (name[3] << 24);
+}
+
+static std::vector<unsigned char> BuildInputSignature()
+{
+	std::vector<unsigned char> chunk;
+	PutUInt32(chunk, 1);		// element count
+	PutUInt32(chunk, 8);		// element offset
+	PutUInt32(chunk, 32);		// name offset
+	PutUInt32(chunk, 0);		// semantic index
+	PutUInt32(chunk, 0);		// system value
+	PutUInt32(chunk, D3D10_REGISTER_COMPONENT_FLOAT32);
+	PutUInt32(chunk, 0);		// register
+	chunk.push_back(0x0f);		// mask
+	chunk.push_back(0x07);		// read/write mask
+	PutUInt16(chunk, 0);
+	PutString(chunk, "POSITION");
+	while (chunk.size() % 4)
+		chunk.push_back(0);
+	return chunk;
+}
+
+static std::vector<unsigned char> BuildResourceDefinitions()
+{
+	std::vector<unsigned char> chunk;
+	PutUInt32(chunk, 1);		// constant buffer count
+	PutUInt32(chunk, 60);		// constant buffer offset
+	PutUInt32(chunk, 1);		// resource count
+	PutUInt32(chunk, 28);		// resource offset
+	PutUInt32(chunk, 0xfffe0400);	// vs_4_0
+	PutUInt32(chunk, 0);		// flags
+	PutUInt32(chunk, 144);		// creator offset
+
+	PutUInt32(chunk, 120);		// "DiffuseMap"
+	PutUInt32(chunk, D3D10_SIT_TEXTURE);
+	PutUInt32(chunk, D3D10_RETURN_TYPE_FLOAT);
+	PutUInt32(chunk, D3D10_SRV_DIMENSION_TEXTURE2D);
+	PutUInt32(chunk, 0xffffffff);	// sample count
+	PutUInt32(chunk, 2);		// bind point
+	PutUInt32(chunk, 1);		// bind count
+	PutUInt32(chunk, 0);		// flags
+
+	PutUInt32(chunk, 131);		// "Globals"
+	PutUInt32(chunk, 1);		// variable count
+	PutUInt32(chunk, 84);		// variable offset
+	PutUInt32(chunk, 16);		// size
+	PutUInt32(chunk, 0);		// flags
+	PutUInt32(chunk, D3D10_CT_CBUFFER);
+
+	PutUInt32(chunk, 139);		// "Tint"
+	PutUInt32(chunk, 0);		// start offset
+	PutUInt32(chunk, 16);		// size
+	PutUInt32(chunk, D3D10_SVF_USED);
+	PutUInt32(chunk, 108);		// type offset
+	PutUInt32(chunk, 0);		// no default value
+
+	PutUInt16(chunk, D3D10_SVC_VECTOR);
+	PutUInt16(chunk, D3D10_SVT_FLOAT);
+	PutUInt16(chunk, 1);		// rows
+	PutUInt16(chunk, 4);		// columns
+	PutUInt16(chunk, 0);		// elements
+	PutUInt16(chunk, 0);		// members
+
+	PutString(chunk, "DiffuseMap");
+	PutString(chunk, "Globals");
+	PutString(chunk, "Tint");
+	PutString(chunk, "Builder");
+	return chunk;
+}
+
+static std::vector<unsigned char> BuildStatistics()
+{
+	std::vector<unsigned char> chunk;
+	PutUInt32(chunk, 12);		// instruction count
+	PutUInt32(chunk, 3);		// temp register count
+	for (int i = 2; i < 37; ++i)
+		PutUInt32(chunk, 0);
+	return chunk;
+}
+
+static std::vector<unsigned char> BuildContainer()
+{
+	const char *names[] = { "ISGN", "RDEF", "STAT" };
+	std::vector<unsigned char> chunks[] = { BuildInputSignature(), BuildResourceDefinitions(), BuildStatistics() };
+	const unsigned int count = NUM_OF(names);
+
+	unsigned int totalSize = 32 + count * 4;
+	for (unsigned int i = 0; i < count; ++i)
+		totalSize += 8 + static_cast<unsigned int>(chunks[i].size());
+
+	std::vector<unsigned char> bytes;
+	PutUInt32(bytes, FourCC("DXBC"));
+	for (int i = 0; i < 4; ++i)
+		PutUInt32(bytes, 0);		// checksum
+	PutUInt32(bytes, 1);			// version
+	PutUInt32(bytes, totalSize);
+	PutUInt32(bytes, count);
+
+	unsigned int offset = 32 + count * 4;
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		PutUInt32(bytes, offset);
+		offset += 8 + static_cast<unsigned int>(chunks[i].size());
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		PutUInt32(bytes, FourCC(names[i]));
+		PutUInt32(bytes, static_cast<unsigned int>(chunks[i].size()));
+		bytes.insert(bytes.end(), chunks[i].begin(), chunks[i].end());
+	}
+
+	return bytes;
+}
+
+class ShaderContainerTest : public SlimDXTest
+{
+protected:
+	static DataStream ^ToStream(const std::vector<unsigned char> &bytes)
+	{
+		return gcnew DataStream(&bytes[0], static_cast<Int64>(bytes.size()), true, true);
+	}
+
+	static void Overwrite(std::vector<unsigned char> &bytes, size_t offset, unsigned int value)
+	{
+		for (int i = 0; i < 4; ++i)
+			bytes[offset + i] = static_cast<unsigned char>(value >> (i * 8));
+	}
+
+	static void AssertRejected(const std::vector<unsigned char> &bytes, size_t size)
+	{
+		DataStream ^stream = gcnew DataStream(&bytes[0], static_cast<Int64>(size), true, true);
+		ShaderContainer ^container = nullptr;
+		ASSERT_MANAGED_THROW(container = gcnew ShaderContainer(stream), D3DCompilerException);
+		ASSERT_TRUE(container == nullptr);
+		delete stream;
+	}
+};
+
+TEST_F(ShaderContainerTest, ReadsChunkTable)
+{
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	ASSERT_EQ(3, container->ChunkCount);
+	ASSERT_TRUE(gcnew String("ISGN") == container->GetChunkName(0));
+	ASSERT_TRUE(gcnew String("RDEF") == container->GetChunkName(1));
+	ASSERT_TRUE(gcnew String("STAT") == container->GetChunkName(2));
+	ASSERT_EQ(148, container->GetChunk("STAT")->Length);
+	ASSERT_TRUE(container->GetChunk("SHEX") == nullptr);
+	ASSERT_MANAGED_THROW(container->GetChunkName(3), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(container->GetChunk("TOOLONG"), ArgumentException);
+
+	delete container;
+	delete stream;
+}
+
+TEST_F(ShaderContainerTest, ReadsInputSignature)
+{
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	ShaderParameterDescription parameter = container->GetInputParameterDescription(0);
+	ASSERT_TRUE(gcnew String("POSITION") == parameter.SemanticName);
+	ASSERT_EQ(0u, parameter.SemanticIndex);
+	ASSERT_EQ(0u, parameter.Register);
+	ASSERT_EQ(D3D10_REGISTER_COMPONENT_FLOAT32, static_cast<int>(parameter.ComponentType));
+	ASSERT_EQ(0x0f, static_cast<int>(parameter.UsageMask));
+	ASSERT_EQ(0x07, static_cast<int>(parameter.ReadWriteMask));
+
+	// shaders without outputs or patch constants may omit those chunks entirely
+	ShaderDescription ^description = container->Description;
+	ASSERT_EQ(1, description->InputParameters);
+	ASSERT_EQ(0, description->OutputParameters);
+	ASSERT_EQ(0, description->PatchConstantParameters);
+
+	delete container;
+	delete stream;
+}
+
+TEST_F(ShaderContainerTest, InvalidParameterIndexRecordsFailure)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	container->GetInputParameterDescription(1);
+	AssertLastResultFailed();
+	container->GetOutputParameterDescription(0);
+	AssertLastResultFailed();
+
+	delete container;
+	delete stream;
+	Result::Record<D3DCompilerException ^>(S_OK, nullptr, nullptr);
+}
+
+TEST_F(ShaderContainerTest, ReadsResourceDefinitions)
+{
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	ShaderDescription ^description = container->Description;
+	ASSERT_TRUE(gcnew String("Builder") == description->Creator);
+	ASSERT_EQ(1, description->ConstantBuffers);
+	ASSERT_EQ(1, description->BoundResources);
+
+	InputBindingDescription binding = container->GetResourceBindingDescription("DiffuseMap");
+	ASSERT_EQ(D3D10_SIT_TEXTURE, static_cast<int>(binding.Type));
+	ASSERT_EQ(2, binding.BindPoint);
+	ASSERT_EQ(1, binding.BindCount);
+	ASSERT_EQ(D3D10_SRV_DIMENSION_TEXTURE2D, static_cast<int>(binding.Dimension));
+
+	ConstantBufferDescription buffer = container->GetConstantBufferDescription("Globals");
+	ASSERT_EQ(16, buffer.Size);
+	ASSERT_EQ(1, buffer.Variables);
+
+	ShaderVariableDescription variable = container->GetVariableDescription(0, 0);
+	ASSERT_TRUE(gcnew String("Tint") == variable.Name);
+	ASSERT_EQ(0, variable.StartOffset);
+	ASSERT_EQ(16, variable.Size);
+	ASSERT_TRUE(IntPtr::Zero == variable.DefaultValue);
+
+	ShaderTypeDescription type = container->GetVariableTypeDescription(0, 0);
+	ASSERT_EQ(D3D10_SVC_VECTOR, static_cast<int>(type.Class));
+	ASSERT_EQ(D3D10_SVT_FLOAT, static_cast<int>(type.Type));
+	ASSERT_EQ(1, type.Rows);
+	ASSERT_EQ(4, type.Columns);
+
+	delete container;
+	delete stream;
+}
+
+TEST_F(ShaderContainerTest, ReadsStatistics)
+{
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	ASSERT_EQ(12, container->Description->InstructionCount);
+	ASSERT_EQ(3, container->Description->TempRegisterCount);
+	ASSERT_EQ(0, container->Description->TextureLoadInstructions);
+
+	delete container;
+	delete stream;
+}
+
+TEST_F(ShaderContainerTest, RejectsTruncatedContainer)
+{
+	std::vector<unsigned char> bytes = BuildContainer();
+	AssertRejected(bytes, bytes.size() - 5);
+}
+
+TEST_F(ShaderContainerTest, RejectsTotalSizeSmallerThanHeader)
+{
+	std::vector<unsigned char> bytes = BuildContainer();
+	Overwrite(bytes, 24, 16);
+	AssertRejected(bytes, bytes.size());
+}
+
+TEST_F(ShaderContainerTest, RejectsChunkOffsetPastEnd)
+{
+	std::vector<unsigned char> bytes = BuildContainer();
+	Overwrite(bytes, 32, static_cast<unsigned int>(bytes.size()) - 4);
+	AssertRejected(bytes, bytes.size());
+}
+
+TEST_F(ShaderContainerTest, RejectsSignatureNamePastChunk)
+{
+	std::vector<unsigned char> bytes = BuildContainer();
+
+	// the element name offset is the third field of the input signature chunk
+	Overwrite(bytes, 32 + 3 * 4 + 8 + 8, 0x1000);
+	AssertRejected(bytes, bytes.size());
+}
+
+TEST_F(ShaderContainerTest, ReturnedDataReadsSourceInPlace)
+{
+	std::vector<unsigned char> bytes = BuildContainer();
+	DataStream ^stream = ToStream(bytes);
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	// the first chunk's data follows the header, three chunk offsets and its own FourCC and size
+	DataStream ^chunk = container->GetChunk(0);
+	ASSERT_TRUE(stream->RawPointer + 32 + 3 * 4 + 8 == chunk->RawPointer);
+	ASSERT_EQ(1, chunk->Read<int>());
+
+	ShaderSignature ^signature = container->InputSignature;
+	ASSERT_TRUE(stream->RawPointer == signature->Data->RawPointer);
+	ASSERT_EQ(static_cast<Int64>(bytes.size()), signature->Data->Length);
+	ASSERT_EQ(static_cast<int>(FourCC("DXBC")), signature->Data->Read<int>());
+
+	delete chunk;
+	delete signature;
+	delete container;
+	delete stream;
+}
+
+TEST_F(ShaderContainerTest, ReturnedDataIsDisposedWithContainer)
+{
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+
+	DataStream ^chunk = container->GetChunk("STAT");
+	ShaderSignature ^signature = container->InputSignature;
+
+	// a view the caller already disposed is skipped
+	DataStream ^disposed = container->GetChunk(0);
+	delete disposed;
+
+	delete container;
+	delete stream;
+
+	int value;
+	ASSERT_MANAGED_THROW(value = chunk->Read<int>(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(value = signature->Data->Read<int>(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(chunk->Position = 0, ObjectDisposedException);
+	ASSERT_EQ(0, chunk->Length);
+	ASSERT_TRUE(signature->Data->RawPointer == 0);
+
+	delete signature;
+}
+
+TEST_F(ShaderContainerTest, AccessAfterDisposeThrows)
+{
+	DataStream ^stream = ToStream(BuildContainer());
+	ShaderContainer ^container = gcnew ShaderContainer(stream);
+	delete container;
+	delete stream;
+
+	ASSERT_MANAGED_THROW(container->ChunkCount, ObjectDisposedException);
+	ASSERT_MANAGED_THROW(container->Description, ObjectDisposedException);
+	ASSERT_MANAGED_THROW(container->InputSignature, ObjectDisposedException);
+	ASSERT_MANAGED_THROW(container->GetChunk("ISGN"), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(container->GetInputParameterDescription(0), ObjectDisposedException);
+}
@@ -0,0 +1,453 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::DXGI;
+
+// Expands an IEEE half to a float; BC6H round trips are compared in float space.
+static float HalfToFloat(unsigned short value)
+{
+	int exponent = (value >> 10) & 0x1f;
+	float mantissa = static_cast<float>(value & 0x3ff);
+	float result = exponent == 0 ? ldexp(mantissa, -24) : ldexp(mantissa + 1024.0f, exponent - 25);
+	return (value & 0x8000) != 0 ? -result : result;
+}
+
+// A smooth RGBA gradient with a varying alpha ramp; hard enough that the
+// quality levels produce different encodings.
+static std::vector<unsigned char> BuildGradient(int width, int height)
+{
+	std::vector<unsigned char> pixels(width * height * 4);
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			unsigned char *pixel = &pixels[(y * width + x) * 4];
+			pixel[0] = static_cast<unsigned char>(x * 4);
+			pixel[1] = static_cast<unsigned char>(y * 4);
+			pixel[2] = static_cast<unsigned char>((x + y) * 2);
+			pixel[3] = static_cast<unsigned char>(255 - ((x * y) & 127));
+		}
+	}
+
+	return pixels;
+}
+
+static std::vector<unsigned char> BuildNoise(int width, int height)
+{
+	std::vector<unsigned char> pixels(width * height * 4);
+	unsigned int seed = 12345;
+	for (size_t i = 0; i < pixels.size(); ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		pixels[i] = static_cast<unsigned char>(seed >> 16);
+	}
+
+	return pixels;
+}
+
+class BlockCompressionTest : public SlimDXTest
+{
+protected:
+	virtual void SetUp()
+	{
+		m_Parallelism = BlockCompression::MaximumDegreeOfParallelism;
+	}
+
+	virtual void TearDown()
+	{
+		BlockCompression::MaximumDegreeOfParallelism = m_Parallelism;
+		SlimDXTest::TearDown();
+	}
+
+	static DataBox ^ToBox(const void *data, size_t size, int rowPitch)
+	{
+		return gcnew DataBox(rowPitch, static_cast<int>(size), gcnew DataStream(data, static_cast<Int64>(size), true, true));
+	}
+
+	static DataBox ^ToBox(const std::vector<unsigned char> &bytes, int rowPitch)
+	{
+		return ToBox(&bytes[0], bytes.size(), rowPitch);
+	}
+
+	static DataBox ^CreateFilledBox(int rowPitch, int rows, unsigned char fill)
+	{
+		DataStream ^stream = gcnew DataStream(rowPitch * rows, true, true);
+		memset(stream->DataPointer.ToPointer(), fill, rowPitch * rows);
+		return gcnew DataBox(rowPitch, rowPitch * rows, stream);
+	}
+
+	static std::vector<unsigned char> ToVector(DataBox ^box)
+	{
+		const unsigned char *data = static_cast<const unsigned char *>(box->Data->DataPointer.ToPointer());
+		return std::vector<unsigned char>(data, data + static_cast<size_t>(box->Data->Length));
+	}
+
+	static void Free(DataBox ^box)
+	{
+		delete box->Data;
+	}
+
+	static std::vector<unsigned char> Decode(const unsigned char *block, int blockSize, Format format)
+	{
+		DataBox ^source = ToBox(block, blockSize, blockSize);
+		DataBox ^pixels = BlockCompression::Decompress(source, 4, 4, format);
+		std::vector<unsigned char> result = ToVector(pixels);
+		Free(pixels);
+		Free(source);
+		return result;
+	}
+
+	static std::vector<unsigned char> RoundTrip(const std::vector<unsigned char> &pixels, int width, int height, int pixelSize,
+		Format format, BlockCompressionQuality quality)
+	{
+		DataBox ^source = ToBox(pixels, width * pixelSize);
+		DataBox ^compressed = BlockCompression::Compress(source, width, height, format, quality);
+		DataBox ^decoded = BlockCompression::Decompress(compressed, width, height, format);
+		std::vector<unsigned char> result = ToVector(decoded);
+		Free(decoded);
+		Free(compressed);
+		Free(source);
+		return result;
+	}
+
+	// A solid surface that does not fill its last blocks must come back unchanged at every quality level.
+	static void AssertSolidRoundTrip(Format format, const unsigned char *pixel, int pixelSize, int tolerance)
+	{
+		const int Width = 5;
+		const int Height = 3;
+		std::vector<unsigned char> pixels(Width * Height * pixelSize);
+		for (int i = 0; i < Width * Height; ++i)
+			memcpy(&pixels[i * pixelSize], pixel, pixelSize);
+
+		for (int quality = 0; quality < 3; ++quality)
+		{
+			std::vector<unsigned char> result = RoundTrip(pixels, Width, Height, pixelSize, format, static_cast<BlockCompressionQuality>(quality));
+			ASSERT_EQ(pixels.size(), result.size());
+			for (size_t i = 0; i < pixels.size(); ++i)
+				ASSERT_NEAR(pixels[i], result[i], tolerance) << "quality " << quality << ", byte " << i;
+		}
+	}
+
+	static double SquaredError(const std::vector<unsigned char> &expected, const std::vector<unsigned char> &actual)
+	{
+		double error = 0.0;
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			double difference = static_cast<double>(expected[i]) - actual[i];
+			error += difference * difference;
+		}
+
+		return error;
+	}
+
+private:
+	int m_Parallelism;
+};
+
+TEST_F(BlockCompressionTest, ReportsFormatsAndPitches)
+{
+	ASSERT_TRUE(BlockCompression::IsSupported(Format::BC1_UNorm));
+	ASSERT_TRUE(BlockCompression::IsSupported(Format::BC6_SFloat16));
+	ASSERT_TRUE(BlockCompression::IsSupported(Format::BC7_UNorm_SRGB));
+	ASSERT_FALSE(BlockCompression::IsSupported(Format::R8G8B8A8_UNorm));
+
+	ASSERT_EQ(static_cast<int>(Format::R8G8B8A8_UNorm), static_cast<int>(BlockCompression::GetUncompressedFormat(Format::BC3_UNorm)));
+	ASSERT_EQ(static_cast<int>(Format::R8G8B8A8_UNorm_SRGB), static_cast<int>(BlockCompression::GetUncompressedFormat(Format::BC7_UNorm_SRGB)));
+	ASSERT_EQ(static_cast<int>(Format::R8_SNorm), static_cast<int>(BlockCompression::GetUncompressedFormat(Format::BC4_SNorm)));
+	ASSERT_EQ(static_cast<int>(Format::R8G8_UNorm), static_cast<int>(BlockCompression::GetUncompressedFormat(Format::BC5_UNorm)));
+	ASSERT_EQ(static_cast<int>(Format::R16G16B16A16_Float), static_cast<int>(BlockCompression::GetUncompressedFormat(Format::BC6_UFloat16)));
+
+	ASSERT_EQ(16, BlockCompression::GetRowPitch(Format::BC1_UNorm, 5));
+	ASSERT_EQ(32, BlockCompression::GetRowPitch(Format::BC3_UNorm, 5));
+	ASSERT_EQ(8, BlockCompression::GetRowPitch(Format::BC4_UNorm, 4));
+	ASSERT_EQ(48, BlockCompression::GetRowPitch(Format::BC7_UNorm, 9));
+
+	Format format;
+	int pitch;
+	ASSERT_MANAGED_THROW(format = BlockCompression::GetUncompressedFormat(Format::R8G8B8A8_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(pitch = BlockCompression::GetRowPitch(Format::BC1_UNorm, 0), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(pitch = BlockCompression::GetRowPitch(Format::R8_UNorm, 4), ArgumentException);
+}
+
+TEST_F(BlockCompressionTest, DecodesFourColorBC1Block)
+{
+	// color0 is pure red and color1 pure blue; the first row selects each palette entry in turn
+	const unsigned char block[] = { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0x00, 0x00, 0x00 };
+	std::vector<unsigned char> pixels = Decode(block, sizeof(block), Format::BC1_UNorm);
+
+	const unsigned char firstRow[] = { 255, 0, 0, 255,  0, 0, 255, 255,  170, 0, 85, 255,  85, 0, 170, 255 };
+	ASSERT_EQ(64u, pixels.size());
+	ASSERT_EQ(0, memcmp(firstRow, &pixels[0], sizeof(firstRow)));
+	for (int i = 4; i < 16; ++i)
+	{
+		ASSERT_EQ(255, pixels[i * 4 + 0]);
+		ASSERT_EQ(0, pixels[i * 4 + 2]);
+	}
+}
+
+TEST_F(BlockCompressionTest, DecodesThreeColorBC1BlockWithTransparentBlack)
+{
+	// color0 <= color1 switches to the three color palette, where index 3 is transparent black
+	const unsigned char block[] = { 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0x00, 0x00, 0x00 };
+	std::vector<unsigned char> pixels = Decode(block, sizeof(block), Format::BC1_UNorm);
+
+	const unsigned char firstRow[] = { 0, 0, 255, 255,  255, 0, 0, 255,  128, 0, 128, 255,  0, 0, 0, 0 };
+	ASSERT_EQ(0, memcmp(firstRow, &pixels[0], sizeof(firstRow)));
+}
+
+TEST_F(BlockCompressionTest, DecodesBC2ExplicitAlpha)
+{
+	// each pixel carries its own index as a 4-bit alpha over a white color block
+	const unsigned char block[] =
+	{
+		0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE,
+		0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
+	};
+	std::vector<unsigned char> pixels = Decode(block, sizeof(block), Format::BC2_UNorm);
+
+	for (int i = 0; i < 16; ++i)
+	{
+		ASSERT_EQ(255, pixels[i * 4 + 0]);
+		ASSERT_EQ(i * 17, pixels[i * 4 + 3]);
+	}
+}
+
+TEST_F(BlockCompressionTest, DecodesBC4EightAndSixValuePalettes)
+{
+	// the first eight pixels select indices 0 through 7
+	unsigned char block[] = { 200, 100, 0x88, 0xC6, 0xFA, 0x00, 0x00, 0x00 };
+	std::vector<unsigned char> pixels = Decode(block, sizeof(block), Format::BC4_UNorm);
+	const unsigned char eightValues[] = { 200, 100, 186, 171, 157, 143, 129, 114 };
+	ASSERT_EQ(16u, pixels.size());
+	ASSERT_EQ(0, memcmp(eightValues, &pixels[0], sizeof(eightValues)));
+	ASSERT_EQ(200, pixels[15]);
+
+	// red0 <= red1 interpolates six values and reserves indices 6 and 7 for 0 and 255
+	block[0] = 100;
+	block[1] = 200;
+	pixels = Decode(block, sizeof(block), Format::BC4_UNorm);
+	const unsigned char sixValues[] = { 100, 200, 120, 140, 160, 180, 0, 255 };
+	ASSERT_EQ(0, memcmp(sixValues, &pixels[0], sizeof(sixValues)));
+}
+
+TEST_F(BlockCompressionTest, DecodesSignedBC4Palette)
+{
+	const unsigned char block[] = { 100, static_cast<unsigned char>(-100), 0x88, 0xC6, 0xFA, 0x00, 0x00, 0x00 };
+	std::vector<unsigned char> pixels = Decode(block, sizeof(block), Format::BC4_SNorm);
+
+	const signed char expected[] = { 100, -100, 71, 43, 14, -14, -43, -71 };
+	for (size_t i = 0; i < NUM_OF(expected); ++i)
+		ASSERT_EQ(expected[i], static_cast<signed char>(pixels[i]));
+}
+
+TEST_F(BlockCompressionTest, SolidColorsRoundTripExactly)
+{
+	// 132, 48 and 99 are exactly representable as 5:6:5
+	const unsigned char opaque[] = { 132, 48, 99, 255 };
+	AssertSolidRoundTrip(Format::BC1_UNorm, opaque, 4, 0);
+
+	const unsigned char translucent[] = { 132, 48, 99, 77 };
+	AssertSolidRoundTrip(Format::BC3_UNorm, translucent, 4, 0);
+
+	const unsigned char red[] = { 93 };
+	AssertSolidRoundTrip(Format::BC4_UNorm, red, 1, 0);
+
+	const unsigned char signedRed[] = { static_cast<unsigned char>(-57) };
+	AssertSolidRoundTrip(Format::BC4_SNorm, signedRed, 1, 0);
+
+	const unsigned char redGreen[] = { 17, 230 };
+	AssertSolidRoundTrip(Format::BC5_UNorm, redGreen, 2, 0);
+}
+
+TEST_F(BlockCompressionTest, SolidColorsRoundTripThroughBC7)
+{
+	// the fast path is restricted to mode 6, whose shared p-bit can cost one step
+	const unsigned char color[] = { 200, 100, 50, 255 };
+	AssertSolidRoundTrip(Format::BC7_UNorm, color, 4, 1);
+
+	const unsigned char translucent[] = { 37, 181, 90, 140 };
+	AssertSolidRoundTrip(Format::BC7_UNorm, translucent, 4, 1);
+}
+
+TEST_F(BlockCompressionTest, HalfFloatsRoundTripThroughBC6H)
+{
+	const unsigned short unsignedPixel[] = { 0x3C00, 0x3800, 0x4000, 0x3C00 };
+	const unsigned short signedPixel[] = { 0xBC00, 0x3800, 0x4000, 0x3C00 };
+	array<Format> ^formats = { Format::BC6_UFloat16, Format::BC6_SFloat16 };
+	const unsigned short *sources[] = { unsignedPixel, signedPixel };
+
+	for (int f = 0; f < formats->Length; ++f)
+	{
+		std::vector<unsigned char> pixels(5 * 3 * 8);
+		for (int i = 0; i < 15; ++i)
+			memcpy(&pixels[i * 8], sources[f], 8);
+
+		std::vector<unsigned char> result = RoundTrip(pixels, 5, 3, 8, formats[f], BlockCompressionQuality::Normal);
+		ASSERT_EQ(pixels.size(), result.size());
+
+		const unsigned short *expected = reinterpret_cast<const unsigned short *>(&pixels[0]);
+		const unsigned short *actual = reinterpret_cast<const unsigned short *>(&result[0]);
+		for (int i = 0; i < 15 * 4; ++i)
+			ASSERT_NEAR(HalfToFloat(expected[i]), HalfToFloat(actual[i]), 0.05f) << "format " << f << ", channel " << i;
+
+		// BC6H has no alpha; the decoder always writes one
+		ASSERT_EQ(0x3C00, actual[3]);
+	}
+}
+
+TEST_F(BlockCompressionTest, HigherQualityNeverIncreasesError)
+{
+	const int Size = 64;
+	std::vector<unsigned char> pixels = BuildGradient(Size, Size);
+	array<Format> ^formats = { Format::BC1_UNorm, Format::BC3_UNorm, Format::BC7_UNorm };
+
+	for (int f = 0; f < formats->Length; ++f)
+	{
+		std::vector<unsigned char> reference = pixels;
+		if (formats[f] == Format::BC1_UNorm)
+		{
+			// BC1 has at most one bit of alpha; compare color only
+			for (int i = 3; i < static_cast<int>(reference.size()); i += 4)
+				reference[i] = 255;
+		}
+
+		double errors[3];
+		for (int quality = 0; quality < 3; ++quality)
+			errors[quality] = SquaredError(reference, RoundTrip(reference, Size, Size, 4, formats[f], static_cast<BlockCompressionQuality>(quality)));
+
+		ASSERT_LE(errors[1], errors[0]) << "format " << f;
+		ASSERT_LE(errors[2], errors[1]) << "format " << f;
+		ASSERT_LT(errors[0] / reference.size(), 16.0) << "format " << f;
+	}
+}
+
+TEST_F(BlockCompressionTest, ParallelTilesMatchSingleThreadedOutput)
+{
+	// 25x18 blocks spans four 16x16 block tiles, the last ones partial
+	const int Width = 100;
+	const int Height = 72;
+	std::vector<unsigned char> pixels = BuildNoise(Width, Height);
+	DataBox ^source = ToBox(pixels, Width * 4);
+
+	array<Format> ^formats = { Format::BC1_UNorm, Format::BC7_UNorm };
+	for (int f = 0; f < formats->Length; ++f)
+	{
+		BlockCompression::MaximumDegreeOfParallelism = 1;
+		DataBox ^serial = BlockCompression::Compress(source, Width, Height, formats[f], BlockCompressionQuality::Fast);
+		DataBox ^serialPixels = BlockCompression::Decompress(serial, Width, Height, formats[f]);
+
+		BlockCompression::MaximumDegreeOfParallelism = 4;
+		DataBox ^parallel = BlockCompression::Compress(source, Width, Height, formats[f], BlockCompressionQuality::Fast);
+		DataBox ^parallelPixels = BlockCompression::Decompress(parallel, Width, Height, formats[f]);
+
+		ASSERT_TRUE(ToVector(serial) == ToVector(parallel)) << "format " << f;
+		ASSERT_TRUE(ToVector(serialPixels) == ToVector(parallelPixels)) << "format " << f;
+
+		Free(parallelPixels);
+		Free(parallel);
+		Free(serialPixels);
+		Free(serial);
+	}
+
+	Free(source);
+}
+
+TEST_F(BlockCompressionTest, CallerDestinationKeepsRowPadding)
+{
+	const int Width = 9;
+	const int Height = 6;
+	const int Padding = 12;
+	std::vector<unsigned char> pixels = BuildNoise(Width, Height);
+	DataBox ^source = ToBox(pixels, Width * 4);
+
+	DataBox ^tight = BlockCompression::Compress(source, Width, Height, Format::BC1_UNorm, BlockCompressionQuality::Normal);
+	int blockRowBytes = BlockCompression::GetRowPitch(Format::BC1_UNorm, Width);
+	DataBox ^padded = CreateFilledBox(blockRowBytes + Padding, 2, 0xCD);
+	BlockCompression::Compress(source, Width, Height, Format::BC1_UNorm, BlockCompressionQuality::Normal, padded);
+
+	std::vector<unsigned char> expected = ToVector(tight);
+	std::vector<unsigned char> actual = ToVector(padded);
+	for (int row = 0; row < 2; ++row)
+	{
+		ASSERT_EQ(0, memcmp(&expected[row * blockRowBytes], &actual[row * (blockRowBytes + Padding)], blockRowBytes));
+		for (int i = 0; i < Padding; ++i)
+			ASSERT_EQ(0xCD, actual[row * (blockRowBytes + Padding) + blockRowBytes + i]);
+	}
+
+	// decoding writes only the pixels inside the surface, not the rest of the last blocks
+	DataBox ^decoded = CreateFilledBox(Width * 4 + Padding, Height, 0xCD);
+	BlockCompression::Decompress(padded, Width, Height, Format::BC1_UNorm, decoded);
+	std::vector<unsigned char> decodedBytes = ToVector(decoded);
+	for (int row = 0; row < Height; ++row)
+	{
+		for (int i = 0; i < Padding; ++i)
+			ASSERT_EQ(0xCD, decodedBytes[row * (Width * 4 + Padding) + Width * 4 + i]);
+	}
+
+	Free(decoded);
+	Free(padded);
+	Free(tight);
+	Free(source);
+}
+
+TEST_F(BlockCompressionTest, RejectsInvalidArguments)
+{
+	std::vector<unsigned char> pixels(4 * 4 * 4);
+	DataBox ^source = ToBox(pixels, 16);
+	DataBox ^result = nullptr;
+
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(nullptr, 4, 4, Format::BC1_UNorm), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(source, 0, 4, Format::BC1_UNorm), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(source, 4, 0, Format::BC1_UNorm), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(source, 4, 4, Format::R8G8B8A8_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(source, 4, 4, Format::BC1_UNorm, static_cast<BlockCompressionQuality>(3)), ArgumentOutOfRangeException);
+
+	// eight pixels do not fit in a 16 byte row, and eight rows do not fit in the stream
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(source, 8, 4, Format::BC1_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(result = BlockCompression::Compress(source, 4, 8, Format::BC1_UNorm), ArgumentException);
+
+	DataBox ^narrow = CreateFilledBox(4, 2, 0);
+	ASSERT_MANAGED_THROW(BlockCompression::Compress(source, 4, 4, Format::BC1_UNorm, BlockCompressionQuality::Normal, narrow), ArgumentException);
+
+	const unsigned char block[8] = { 0 };
+	DataBox ^compressed = ToBox(block, sizeof(block), sizeof(block));
+	ASSERT_MANAGED_THROW(result = BlockCompression::Decompress(compressed, 4, 8, Format::BC1_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(result = BlockCompression::Decompress(nullptr, 4, 4, Format::BC1_UNorm), ArgumentNullException);
+	ASSERT_MANAGED_THROW(BlockCompression::Decompress(compressed, 4, 4, Format::BC1_UNorm, nullptr), ArgumentNullException);
+
+	ASSERT_MANAGED_THROW(BlockCompression::MaximumDegreeOfParallelism = 0, ArgumentOutOfRangeException);
+	ASSERT_TRUE(result == nullptr);
+
+	Free(compressed);
+	Free(narrow);
+	Free(source);
+}
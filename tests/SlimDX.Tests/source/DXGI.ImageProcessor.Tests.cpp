@@ -0,0 +1,395 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <limits>
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::DXGI;
+
+class ImageProcessorTest : public SlimDXTest
+{
+protected:
+	virtual void SetUp()
+	{
+		m_Parallelism = ImageProcessor::MaximumDegreeOfParallelism;
+	}
+
+	virtual void TearDown()
+	{
+		ImageProcessor::MaximumDegreeOfParallelism = m_Parallelism;
+		SlimDXTest::TearDown();
+	}
+
+	static DataBox ^ToBox(const void *data, size_t size, int rowPitch)
+	{
+		return gcnew DataBox(rowPitch, static_cast<int>(size), gcnew DataStream(data, static_cast<Int64>(size), true, true));
+	}
+
+	template <typename T>
+	static DataBox ^ToBox(const std::vector<T> &pixels, int rowPitch)
+	{
+		return ToBox(&pixels[0], pixels.size() * sizeof(T), rowPitch);
+	}
+
+	template <typename T>
+	static std::vector<T> ToVector(DataBox ^box)
+	{
+		const T *data = static_cast<const T *>(box->Data->DataPointer.ToPointer());
+		return std::vector<T>(data, data + static_cast<size_t>(box->Data->Length) / sizeof(T));
+	}
+
+	static void Free(DataBox ^box)
+	{
+		delete box->Data;
+	}
+
+	static void Free(array<DataBox^> ^boxes)
+	{
+		for (int i = 0; i < boxes->Length; ++i)
+			Free(boxes[i]);
+	}
+
+	template <typename TSource, typename TDestination>
+	static std::vector<TDestination> Convert(const std::vector<TSource> &pixels, int width, Format sourceFormat, Format destinationFormat)
+	{
+		DataBox ^source = ToBox(pixels, static_cast<int>(pixels.size() * sizeof(TSource)));
+		DataBox ^converted = ImageProcessor::Convert(source, width, 1, sourceFormat, destinationFormat);
+		std::vector<TDestination> result = ToVector<TDestination>(converted);
+		Free(converted);
+		Free(source);
+		return result;
+	}
+
+private:
+	int m_Parallelism;
+};
+
+TEST_F(ImageProcessorTest, ReportsSupportedFormats)
+{
+	ASSERT_TRUE(ImageProcessor::IsFormatSupported(Format::R8G8B8A8_UNorm));
+	ASSERT_TRUE(ImageProcessor::IsFormatSupported(Format::B8G8R8A8_UNorm_SRGB));
+	ASSERT_TRUE(ImageProcessor::IsFormatSupported(Format::R16G16B16A16_Float));
+	ASSERT_TRUE(ImageProcessor::IsFormatSupported(Format::R10G10B10A2_UNorm));
+	ASSERT_FALSE(ImageProcessor::IsFormatSupported(Format::BC1_UNorm));
+	ASSERT_FALSE(ImageProcessor::IsFormatSupported(Format::R32G32B32A32_UInt));
+}
+
+TEST_F(ImageProcessorTest, SwizzlesAndFillsMissingChannels)
+{
+	const unsigned char rgba[] = { 10, 20, 30, 40,  250, 128, 0, 7 };
+	std::vector<unsigned char> pixels(rgba, rgba + sizeof(rgba));
+
+	std::vector<unsigned char> bgra = Convert<unsigned char, unsigned char>(pixels, 2, Format::R8G8B8A8_UNorm, Format::B8G8R8A8_UNorm);
+	const unsigned char expectedBgra[] = { 30, 20, 10, 40,  0, 128, 250, 7 };
+	ASSERT_EQ(0, memcmp(expectedBgra, &bgra[0], sizeof(expectedBgra)));
+
+	// the unused channel of an X format is written as one
+	std::vector<unsigned char> bgrx = Convert<unsigned char, unsigned char>(pixels, 2, Format::R8G8B8A8_UNorm, Format::B8G8R8X8_UNorm);
+	ASSERT_EQ(255, bgrx[3]);
+	ASSERT_EQ(255, bgrx[7]);
+
+	// formats without color load as black, formats without alpha as opaque
+	const unsigned char alphaOnly[] = { 99, 200 };
+	std::vector<unsigned char> alpha = Convert<unsigned char, unsigned char>(std::vector<unsigned char>(alphaOnly, alphaOnly + 2), 2,
+		Format::A8_UNorm, Format::R8G8B8A8_UNorm);
+	const unsigned char expectedAlpha[] = { 0, 0, 0, 99,  0, 0, 0, 200 };
+	ASSERT_EQ(0, memcmp(expectedAlpha, &alpha[0], sizeof(expectedAlpha)));
+
+	const unsigned char redGreen[] = { 1, 2,  3, 4 };
+	std::vector<unsigned char> opaque = Convert<unsigned char, unsigned char>(std::vector<unsigned char>(redGreen, redGreen + 4), 2,
+		Format::R8G8_UNorm, Format::R8G8B8A8_UNorm);
+	const unsigned char expectedOpaque[] = { 1, 2, 0, 255,  3, 4, 0, 255 };
+	ASSERT_EQ(0, memcmp(expectedOpaque, &opaque[0], sizeof(expectedOpaque)));
+}
+
+TEST_F(ImageProcessorTest, ConvertsBetweenNormalizedAndFloat)
+{
+	const unsigned char rgba[] = { 0, 51, 255, 102 };
+	std::vector<float> floats = Convert<unsigned char, float>(std::vector<unsigned char>(rgba, rgba + 4), 1,
+		Format::R8G8B8A8_UNorm, Format::R32G32B32A32_Float);
+	ASSERT_FLOAT_EQ(0.0f, floats[0]);
+	ASSERT_FLOAT_EQ(0.2f, floats[1]);
+	ASSERT_FLOAT_EQ(1.0f, floats[2]);
+	ASSERT_FLOAT_EQ(0.4f, floats[3]);
+
+	// stores round to nearest and clamp, and NaN becomes zero
+	const float values[] = { 0.5f, 1.5f, -0.2f, std::numeric_limits<float>::quiet_NaN() };
+	std::vector<unsigned char> unorm = Convert<float, unsigned char>(std::vector<float>(values, values + 4), 4,
+		Format::R32_Float, Format::R8_UNorm);
+	const unsigned char expectedUNorm[] = { 128, 255, 0, 0 };
+	ASSERT_EQ(0, memcmp(expectedUNorm, &unorm[0], sizeof(expectedUNorm)));
+
+	const float signedValues[] = { -1.0f, -0.5f, 0.5f, 2.0f };
+	std::vector<signed char> snorm = Convert<float, signed char>(std::vector<float>(signedValues, signedValues + 4), 4,
+		Format::R32_Float, Format::R8_SNorm);
+	const signed char expectedSNorm[] = { -127, -63, 64, 127 };
+	ASSERT_EQ(0, memcmp(expectedSNorm, &snorm[0], sizeof(expectedSNorm)));
+
+	// -128 and -127 both mean -1
+	const signed char minimum[] = { -128, -127 };
+	std::vector<float> loaded = Convert<signed char, float>(std::vector<signed char>(minimum, minimum + 2), 2,
+		Format::R8_SNorm, Format::R32_Float);
+	ASSERT_FLOAT_EQ(-1.0f, loaded[0]);
+	ASSERT_FLOAT_EQ(-1.0f, loaded[1]);
+
+	const float halves[] = { 1.0f, -2.0f, 0.5f };
+	std::vector<unsigned short> half = Convert<float, unsigned short>(std::vector<float>(halves, halves + 3), 3,
+		Format::R32_Float, Format::R16_Float);
+	ASSERT_EQ(0x3C00, half[0]);
+	ASSERT_EQ(0xC000, half[1]);
+	ASSERT_EQ(0x3800, half[2]);
+}
+
+TEST_F(ImageProcessorTest, PacksAndUnpacksPackedFormats)
+{
+	const unsigned char rgba[] = { 255, 255, 0, 255,  0, 0, 255, 0 };
+	std::vector<unsigned char> pixels(rgba, rgba + sizeof(rgba));
+
+	std::vector<unsigned short> b5g6r5 = Convert<unsigned char, unsigned short>(pixels, 2, Format::R8G8B8A8_UNorm, Format::B5G6R5_UNorm);
+	ASSERT_EQ(0xFFE0, b5g6r5[0]);
+	ASSERT_EQ(0x001F, b5g6r5[1]);
+
+	std::vector<unsigned short> b5g5r5a1 = Convert<unsigned char, unsigned short>(pixels, 2, Format::R8G8B8A8_UNorm, Format::B5G5R5A1_UNorm);
+	ASSERT_EQ(0xFFE0, b5g5r5a1[0]);
+	ASSERT_EQ(0x001F, b5g5r5a1[1]);
+
+	std::vector<unsigned int> r10g10b10a2 = Convert<unsigned char, unsigned int>(pixels, 2, Format::R8G8B8A8_UNorm, Format::R10G10B10A2_UNorm);
+	ASSERT_EQ(0xC00FFFFFu, r10g10b10a2[0]);
+	ASSERT_EQ(0x3FF00000u, r10g10b10a2[1]);
+
+	std::vector<unsigned char> back = Convert<unsigned short, unsigned char>(b5g6r5, 2, Format::B5G6R5_UNorm, Format::R8G8B8A8_UNorm);
+	const unsigned char expected[] = { 255, 255, 0, 255,  0, 0, 255, 255 };
+	ASSERT_EQ(0, memcmp(expected, &back[0], sizeof(expected)));
+}
+
+TEST_F(ImageProcessorTest, DecodesAndEncodesSrgb)
+{
+	std::vector<unsigned char> pixels(256 * 4);
+	for (int i = 0; i < 256; ++i)
+	{
+		for (int c = 0; c < 4; ++c)
+			pixels[i * 4 + c] = static_cast<unsigned char>(i);
+	}
+
+	// every sRGB value survives a trip through linear float
+	std::vector<float> linear = Convert<unsigned char, float>(pixels, 256, Format::R8G8B8A8_UNorm_SRGB, Format::R32G32B32A32_Float);
+	ASSERT_NEAR(0.21586f, linear[128 * 4], 1e-4f);
+	ASSERT_FLOAT_EQ(128 / 255.0f, linear[128 * 4 + 3]);
+
+	std::vector<unsigned char> back = Convert<float, unsigned char>(linear, 256, Format::R32G32B32A32_Float, Format::R8G8B8A8_UNorm_SRGB);
+	ASSERT_TRUE(pixels == back);
+
+	// alpha is never gamma encoded
+	std::vector<unsigned char> unorm = Convert<unsigned char, unsigned char>(pixels, 256, Format::R8G8B8A8_UNorm_SRGB, Format::R8G8B8A8_UNorm);
+	ASSERT_EQ(55, unorm[128 * 4]);
+	ASSERT_EQ(128, unorm[128 * 4 + 3]);
+}
+
+TEST_F(ImageProcessorTest, ConvertHonorsRowPitches)
+{
+	const int Padding = 3;
+	const unsigned char rows[] = { 1, 2, 3, 4, 0xEE, 0xEE, 0xEE,  5, 6, 7, 8, 0xEE, 0xEE, 0xEE };
+	DataBox ^source = ToBox(rows, sizeof(rows), 4 + Padding);
+
+	DataBox ^destination = ImageProcessor::Convert(source, 1, 2, Format::R8G8B8A8_UNorm, Format::B8G8R8A8_UNorm);
+	ASSERT_EQ(4, destination->RowPitch);
+	std::vector<unsigned char> result = ToVector<unsigned char>(destination);
+	const unsigned char expected[] = { 3, 2, 1, 4,  7, 6, 5, 8 };
+	ASSERT_EQ(sizeof(expected), result.size());
+	ASSERT_EQ(0, memcmp(expected, &result[0], sizeof(expected)));
+
+	Free(destination);
+	Free(source);
+}
+
+TEST_F(ImageProcessorTest, BoxFilterAveragesBlocks)
+{
+	std::vector<float> pixels(16);
+	for (int i = 0; i < 16; ++i)
+		pixels[i] = static_cast<float>(i);
+
+	DataBox ^source = ToBox(pixels, 4 * sizeof(float));
+	DataBox ^resized = ImageProcessor::Resize(source, 4, 4, Format::R32_Float, 2, 2, ImageFilter::Box);
+	std::vector<float> result = ToVector<float>(resized);
+
+	ASSERT_EQ(4u, result.size());
+	ASSERT_FLOAT_EQ(2.5f, result[0]);
+	ASSERT_FLOAT_EQ(4.5f, result[1]);
+	ASSERT_FLOAT_EQ(10.5f, result[2]);
+	ASSERT_FLOAT_EQ(12.5f, result[3]);
+
+	Free(resized);
+	Free(source);
+}
+
+TEST_F(ImageProcessorTest, WindowedFiltersPreserveConstantImages)
+{
+	std::vector<float> pixels(16 * 16 * 4);
+	for (size_t i = 0; i < pixels.size(); ++i)
+		pixels[i] = (i % 4) == 3 ? 1.0f : 0.25f;
+
+	DataBox ^source = ToBox(pixels, 16 * 4 * sizeof(float));
+	array<ImageFilter> ^filters = { ImageFilter::Box, ImageFilter::Kaiser, ImageFilter::Lanczos };
+	for (int f = 0; f < filters->Length; ++f)
+	{
+		// shrink along one axis and enlarge along the other
+		DataBox ^resized = ImageProcessor::Resize(source, 16, 16, Format::R32G32B32A32_Float, 5, 23, filters[f]);
+		std::vector<float> result = ToVector<float>(resized);
+		ASSERT_EQ(5u * 23 * 4, result.size());
+		for (size_t i = 0; i < result.size(); ++i)
+			ASSERT_NEAR((i % 4) == 3 ? 1.0f : 0.25f, result[i], 1e-5f) << "filter " << f << ", value " << i;
+
+		Free(resized);
+	}
+
+	Free(source);
+}
+
+TEST_F(ImageProcessorTest, GeneratesCompleteMipChain)
+{
+	std::vector<float> pixels(8 * 4);
+	for (int i = 0; i < 32; ++i)
+		pixels[i] = static_cast<float>(i);
+
+	DataBox ^source = ToBox(pixels, 8 * sizeof(float));
+	array<DataBox^> ^levels = ImageProcessor::GenerateMipChain(source, 8, 4, Format::R32_Float, ImageFilter::Box);
+
+	ASSERT_EQ(4, levels->Length);
+	ASSERT_TRUE(ToVector<float>(levels[0]) == pixels);
+	ASSERT_EQ(4 * sizeof(float), static_cast<size_t>(levels[1]->RowPitch));
+	ASSERT_EQ(8u, ToVector<float>(levels[1]).size());
+	ASSERT_EQ(2u, ToVector<float>(levels[2]).size());
+
+	std::vector<float> level1 = ToVector<float>(levels[1]);
+	ASSERT_FLOAT_EQ((0 + 1 + 8 + 9) / 4.0f, level1[0]);
+	ASSERT_FLOAT_EQ((22 + 23 + 30 + 31) / 4.0f, level1[7]);
+
+	std::vector<float> level3 = ToVector<float>(levels[3]);
+	ASSERT_EQ(1u, level3.size());
+	ASSERT_FLOAT_EQ(15.5f, level3[0]);
+
+	Free(levels);
+
+	// a partial chain and a non power of two size
+	std::vector<float> odd(5 * 3);
+	DataBox ^oddSource = ToBox(odd, 5 * sizeof(float));
+	levels = ImageProcessor::GenerateMipChain(oddSource, 5, 3, Format::R32_Float, ImageFilter::Lanczos, 2);
+	ASSERT_EQ(2, levels->Length);
+	ASSERT_EQ(2 * sizeof(float), static_cast<size_t>(levels[1]->RowPitch));
+	ASSERT_EQ(2 * sizeof(float), static_cast<size_t>(levels[1]->SlicePitch));
+
+	Free(levels);
+	Free(oddSource);
+	Free(source);
+}
+
+TEST_F(ImageProcessorTest, MipsOfSrgbImagesAverageInLinearSpace)
+{
+	// a black and a white pixel average to linear one half
+	const unsigned char pixels[] = { 0, 0, 0, 255,  255, 255, 255, 255 };
+	DataBox ^source = ToBox(pixels, sizeof(pixels), sizeof(pixels));
+
+	array<DataBox^> ^srgb = ImageProcessor::GenerateMipChain(source, 2, 1, Format::R8G8B8A8_UNorm_SRGB, ImageFilter::Box);
+	std::vector<unsigned char> srgbLevel = ToVector<unsigned char>(srgb[1]);
+	ASSERT_EQ(188, srgbLevel[0]);
+	ASSERT_EQ(255, srgbLevel[3]);
+
+	array<DataBox^> ^unorm = ImageProcessor::GenerateMipChain(source, 2, 1, Format::R8G8B8A8_UNorm, ImageFilter::Box);
+	ASSERT_EQ(128, ToVector<unsigned char>(unorm[1])[0]);
+
+	Free(unorm);
+	Free(srgb);
+	Free(source);
+}
+
+TEST_F(ImageProcessorTest, ParallelBandsMatchSingleThreadedOutput)
+{
+	// 80 rows makes five bands of sixteen
+	const int Width = 64;
+	const int Height = 80;
+	std::vector<unsigned char> pixels(Width * Height * 4);
+	unsigned int seed = 12345;
+	for (size_t i = 0; i < pixels.size(); ++i)
+	{
+		seed = seed * 1103515245 + 12345;
+		pixels[i] = static_cast<unsigned char>(seed >> 16);
+	}
+
+	DataBox ^source = ToBox(pixels, Width * 4);
+
+	ImageProcessor::MaximumDegreeOfParallelism = 1;
+	DataBox ^serial = ImageProcessor::Resize(source, Width, Height, Format::R8G8B8A8_UNorm_SRGB, 37, 50, ImageFilter::Lanczos);
+	DataBox ^serialConverted = ImageProcessor::Convert(source, Width, Height, Format::R8G8B8A8_UNorm, Format::R16G16B16A16_Float);
+
+	ImageProcessor::MaximumDegreeOfParallelism = 4;
+	DataBox ^parallel = ImageProcessor::Resize(source, Width, Height, Format::R8G8B8A8_UNorm_SRGB, 37, 50, ImageFilter::Lanczos);
+	DataBox ^parallelConverted = ImageProcessor::Convert(source, Width, Height, Format::R8G8B8A8_UNorm, Format::R16G16B16A16_Float);
+
+	ASSERT_TRUE(ToVector<unsigned char>(serial) == ToVector<unsigned char>(parallel));
+	ASSERT_TRUE(ToVector<unsigned char>(serialConverted) == ToVector<unsigned char>(parallelConverted));
+
+	Free(parallelConverted);
+	Free(parallel);
+	Free(serialConverted);
+	Free(serial);
+	Free(source);
+}
+
+TEST_F(ImageProcessorTest, RejectsInvalidArguments)
+{
+	std::vector<unsigned char> pixels(4 * 4 * 4);
+	DataBox ^source = ToBox(pixels, 16);
+	DataBox ^result = nullptr;
+	array<DataBox^> ^levels = nullptr;
+
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Convert(nullptr, 4, 4, Format::R8G8B8A8_UNorm, Format::B8G8R8A8_UNorm), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Convert(source, 0, 4, Format::R8G8B8A8_UNorm, Format::B8G8R8A8_UNorm), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Convert(source, 4, 4, Format::BC1_UNorm, Format::B8G8R8A8_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Convert(source, 4, 4, Format::R8G8B8A8_UNorm, Format::BC1_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Convert(source, 8, 4, Format::R8G8B8A8_UNorm, Format::B8G8R8A8_UNorm), ArgumentException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Convert(source, 4, 4, Format::R32G32B32A32_Float, Format::B8G8R8A8_UNorm), ArgumentException);
+
+	DataBox ^small = ToBox(pixels, 8);
+	ASSERT_MANAGED_THROW(ImageProcessor::Convert(source, 4, 4, Format::R8G8B8A8_UNorm, small, Format::R8G8B8A8_UNorm), ArgumentException);
+
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Resize(source, 4, 4, Format::R8G8B8A8_UNorm, 0, 2, ImageFilter::Box), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Resize(source, 4, 4, Format::R8G8B8A8_UNorm, 2, 0, ImageFilter::Box), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = ImageProcessor::Resize(source, 4, 4, Format::R8G8B8A8_UNorm, 2, 2, static_cast<ImageFilter>(3)), ArgumentOutOfRangeException);
+
+	ASSERT_MANAGED_THROW(levels = ImageProcessor::GenerateMipChain(source, 4, 4, Format::R8G8B8A8_UNorm, ImageFilter::Box, 4), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(levels = ImageProcessor::GenerateMipChain(source, 4, 4, Format::R8G8B8A8_UNorm, ImageFilter::Box, -1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(levels = ImageProcessor::GenerateMipChain(source, 4, 0, Format::R8G8B8A8_UNorm, ImageFilter::Box), ArgumentOutOfRangeException);
+
+	ASSERT_MANAGED_THROW(ImageProcessor::MaximumDegreeOfParallelism = 0, ArgumentOutOfRangeException);
+	ASSERT_TRUE(result == nullptr);
+	ASSERT_TRUE(levels == nullptr);
+
+	Free(small);
+	Free(source);
+}
@@ -0,0 +1,282 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "ID3D10ShaderResourceViewMock.h"
+#include "ID3DX10SpriteMock.h"
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D10;
+
+// The texture of the first sprite in each draw call, in submission order.
+static std::vector<ID3D10ShaderResourceView*> drawnTextures;
+static std::vector<UINT> drawnCounts;
+
+static HRESULT RecordDraw(D3DX10_SPRITE *sprites, UINT count, UINT, UINT)
+{
+	drawnTextures.push_back(sprites[0].pTexture);
+	drawnCounts.push_back(count);
+	return S_OK;
+}
+
+class SpriteBatchTest : public SlimDXTest
+{
+protected:
+	static void RecordDraws(ID3DX10SpriteMock &sprite)
+	{
+		drawnTextures.clear();
+		drawnCounts.clear();
+		ON_CALL(sprite, DrawSpritesImmediate(_, _, _, _))
+			.WillByDefault(Invoke(RecordDraw));
+	}
+
+	// Adds sprites with the given textures through the native layout, which is the one path that takes raw pointers.
+	static void AddNative(SpriteBatch ^batch, ID3D10ShaderResourceView *const *textures, int count)
+	{
+		std::vector<D3DX10_SPRITE> instances(count);
+		for (int i = 0; i < count; ++i)
+		{
+			memset(&instances[i], 0, sizeof(D3DX10_SPRITE));
+			instances[i].pTexture = textures[i];
+		}
+
+		DataStream ^stream = gcnew DataStream(IntPtr(&instances[0]), count * sizeof(D3DX10_SPRITE), true, false);
+		batch->Add(stream, count);
+		ASSERT_EQ(stream->Length, stream->Position);
+		delete stream;
+	}
+};
+
+#define SPRITEBATCH_TEST(name_) TEST_F(SpriteBatchTest, name_)
+
+SPRITEBATCH_TEST(KeepsSubmissionOrderByDefault)
+{
+	ID3DX10SpriteMock sprite;
+	ID3D10ShaderResourceViewMock first;
+	ID3D10ShaderResourceViewMock second;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper);
+	ASSERT_FALSE(batch->SortByTexture);
+
+	ID3D10ShaderResourceView *textures[] = { &first, &second, &first, &first };
+	AddNative(batch, textures, 4);
+	ASSERT_EQ(4, batch->Count);
+	ASSERT_TRUE(batch->Flush().IsSuccess);
+
+	ASSERT_EQ(3u, drawnTextures.size());
+	ASSERT_TRUE(drawnTextures[0] == &first);
+	ASSERT_TRUE(drawnTextures[1] == &second);
+	ASSERT_TRUE(drawnTextures[2] == &first);
+	ASSERT_EQ(2u, drawnCounts[2]);
+	ASSERT_EQ(4, batch->LastSpriteCount);
+	ASSERT_EQ(3, batch->LastBatchCount);
+	ASSERT_EQ(0, batch->Count);
+
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(SortsByTextureWhenEnabled)
+{
+	ID3DX10SpriteMock sprite;
+	ID3D10ShaderResourceViewMock first;
+	ID3D10ShaderResourceViewMock second;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper);
+	batch->SortByTexture = true;
+
+	ID3D10ShaderResourceView *textures[] = { &first, &second, &first, &second };
+	AddNative(batch, textures, 4);
+	ASSERT_TRUE(batch->Flush().IsSuccess);
+
+	ASSERT_EQ(2u, drawnTextures.size());
+	ASSERT_EQ(2u, drawnCounts[0]);
+	ASSERT_EQ(2u, drawnCounts[1]);
+	ASSERT_TRUE(drawnTextures[0] != drawnTextures[1]);
+	ASSERT_EQ(2, batch->LastBatchCount);
+
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(SplitsBatchesLargerThanMaximum)
+{
+	ID3DX10SpriteMock sprite;
+	ID3D10ShaderResourceViewMock first;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper, 2);
+	batch->MaximumBatchSize = 2;
+
+	ID3D10ShaderResourceView *textures[] = { &first, &first, &first, &first, &first };
+	AddNative(batch, textures, 5);
+	ASSERT_TRUE(batch->Capacity >= 5);
+	ASSERT_TRUE(batch->Flush().IsSuccess);
+
+	ASSERT_EQ(3u, drawnCounts.size());
+	ASSERT_EQ(2u, drawnCounts[0]);
+	ASSERT_EQ(2u, drawnCounts[1]);
+	ASSERT_EQ(1u, drawnCounts[2]);
+	ASSERT_EQ(1, batch->LastBatchCount);
+	ASSERT_EQ(3, batch->LastDrawCallCount);
+	ASSERT_EQ(5, batch->TotalSpriteCount);
+	ASSERT_EQ(3, batch->TotalDrawCallCount);
+
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(HoldsTexturesUntilDrawn)
+{
+	ID3DX10SpriteMock sprite;
+	ID3D10ShaderResourceViewMock first;
+	ID3D10ShaderResourceViewMock second;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper);
+
+	ID3D10ShaderResourceView *textures[] = { &first, &second, &first };
+	EXPECT_CALL(first, AddRef()).Times(2);
+	EXPECT_CALL(second, AddRef()).Times(1);
+	EXPECT_CALL(first, Release()).Times(0);
+	EXPECT_CALL(second, Release()).Times(0);
+	AddNative(batch, textures, 3);
+	ASSERT_TRUE(Mock::VerifyAndClearExpectations(&first));
+	ASSERT_TRUE(Mock::VerifyAndClearExpectations(&second));
+
+	// every reference is dropped once the sprites have been drawn
+	EXPECT_CALL(first, Release()).Times(2);
+	EXPECT_CALL(second, Release()).Times(1);
+	ASSERT_TRUE(batch->Flush().IsSuccess);
+	ASSERT_TRUE(Mock::VerifyAndClearExpectations(&first));
+	ASSERT_TRUE(Mock::VerifyAndClearExpectations(&second));
+
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(ReleasesTexturesWhenDrawFails)
+{
+	SCOPED_THROW_ON_ERROR(false);
+
+	ID3DX10SpriteMock sprite;
+	ID3D10ShaderResourceViewMock first;
+	ID3D10ShaderResourceViewMock second;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper);
+
+	ID3D10ShaderResourceView *textures[] = { &first, &second };
+	AddNative(batch, textures, 2);
+
+	EXPECT_CALL(sprite, DrawSpritesImmediate(_, _, _, _))
+		.WillOnce(Return(E_FAIL));
+	EXPECT_CALL(first, Release()).Times(1);
+	EXPECT_CALL(second, Release()).Times(1);
+	ASSERT_TRUE(batch->Flush().IsFailure);
+	ASSERT_EQ(1, batch->LastDrawCallCount);
+	ASSERT_EQ(0, batch->Count);
+
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(ClearAndDisposeReleaseTextures)
+{
+	ID3DX10SpriteMock sprite;
+	ID3D10ShaderResourceViewMock first;
+	ID3D10ShaderResourceViewMock second;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper);
+
+	ID3D10ShaderResourceView *textures[] = { &first, &second };
+	AddNative(batch, textures, 2);
+
+	EXPECT_CALL(first, Release()).Times(1);
+	EXPECT_CALL(second, Release()).Times(1);
+	batch->Clear();
+	ASSERT_EQ(0, batch->Count);
+	ASSERT_TRUE(Mock::VerifyAndClearExpectations(&first));
+	ASSERT_TRUE(Mock::VerifyAndClearExpectations(&second));
+
+	AddNative(batch, textures, 1);
+	EXPECT_CALL(first, Release()).Times(1);
+	EXPECT_CALL(second, Release()).Times(0);
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(SpritesWithoutTextureAreDrawnTogether)
+{
+	ID3DX10SpriteMock sprite;
+	RecordDraws(sprite);
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = gcnew SpriteBatch(wrapper);
+
+	SpriteData data;
+	batch->Add(data);
+	batch->Add(gcnew array<SpriteData>(3), 1, 2);
+	batch->Add(gcnew array<SpriteData>(2));
+	ASSERT_EQ(5, batch->Count);
+	ASSERT_TRUE(batch->Flush().IsSuccess);
+
+	ASSERT_EQ(1u, drawnCounts.size());
+	ASSERT_EQ(5u, drawnCounts[0]);
+	ASSERT_TRUE(drawnTextures[0] == 0);
+
+	delete batch;
+	delete wrapper;
+}
+
+SPRITEBATCH_TEST(RejectsInvalidArguments)
+{
+	ID3DX10SpriteMock sprite;
+	Sprite ^wrapper = Sprite::FromPointer(&sprite);
+	SpriteBatch ^batch = nullptr;
+	ASSERT_MANAGED_THROW(batch = gcnew SpriteBatch(nullptr), ArgumentNullException);
+	ASSERT_MANAGED_THROW(batch = gcnew SpriteBatch(wrapper, -1), ArgumentOutOfRangeException);
+
+	batch = gcnew SpriteBatch(wrapper);
+	ASSERT_MANAGED_THROW(batch->MaximumBatchSize = 0, ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(batch->Add(static_cast<array<SpriteData>^>(nullptr)), ArgumentNullException);
+	ASSERT_MANAGED_THROW(batch->Add(static_cast<DataStream^>(nullptr), 1), ArgumentNullException);
+
+	DataStream ^stream = gcnew DataStream(sizeof(D3DX10_SPRITE), true, true);
+	ASSERT_MANAGED_THROW(batch->Add(stream, 2), System::IO::EndOfStreamException);
+	ASSERT_MANAGED_THROW(batch->Add(stream, -1), ArgumentOutOfRangeException);
+	ASSERT_EQ(0, batch->Count);
+
+	delete stream;
+	delete batch;
+	delete wrapper;
+}
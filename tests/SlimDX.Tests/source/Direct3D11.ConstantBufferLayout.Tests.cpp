@@ -0,0 +1,796 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <d3d11shader.h>
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+#include "ReferenceDeviceContext11.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+// Reflection interfaces are plain vtables without reference counting, so the fakes below
+// simply own their children and are deleted by the test once the layout has been built.
+class FakeReflectionType : public ID3D11ShaderReflectionType
+{
+public:
+	FakeReflectionType(D3D_SHADER_VARIABLE_CLASS variableClass, D3D_SHADER_VARIABLE_TYPE type, UINT rows, UINT columns, UINT elements, UINT offset)
+	{
+		memset(&description, 0, sizeof(description));
+		description.Class = variableClass;
+		description.Type = type;
+		description.Rows = rows;
+		description.Columns = columns;
+		description.Elements = elements;
+		description.Offset = offset;
+	}
+	~FakeReflectionType()
+	{
+		for (size_t i = 0; i < members.size(); ++i)
+			delete members[i];
+	}
+
+	FakeReflectionType *AddMember(const char *name, FakeReflectionType *member)
+	{
+		names.push_back(name);
+		members.push_back(member);
+		description.Members = static_cast<UINT>(members.size());
+		return this;
+	}
+
+	STDMETHOD(GetDesc)(D3D11_SHADER_TYPE_DESC *desc)
+	{
+		*desc = description;
+		return S_OK;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionType*, GetMemberTypeByIndex)(UINT index)
+	{
+		return index < members.size() ? members[index] : 0;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionType*, GetMemberTypeByName)(LPCSTR name)
+	{
+		for (size_t i = 0; i < names.size(); ++i)
+			if (names[i] == name)
+				return members[i];
+		return 0;
+	}
+	STDMETHOD_(LPCSTR, GetMemberTypeName)(UINT index)
+	{
+		return index < names.size() ? names[index].c_str() : 0;
+	}
+	STDMETHOD(IsEqual)(ID3D11ShaderReflectionType *type)
+	{
+		return type == this ? S_OK : S_FALSE;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionType*, GetSubType)()
+	{
+		return 0;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionType*, GetBaseClass)()
+	{
+		return 0;
+	}
+	STDMETHOD_(UINT, GetNumInterfaces)()
+	{
+		return 0;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionType*, GetInterfaceByIndex)(UINT)
+	{
+		return 0;
+	}
+	STDMETHOD(IsOfType)(ID3D11ShaderReflectionType *type)
+	{
+		return type == this ? S_OK : S_FALSE;
+	}
+	STDMETHOD(ImplementsInterface)(ID3D11ShaderReflectionType *)
+	{
+		return S_FALSE;
+	}
+
+private:
+	D3D11_SHADER_TYPE_DESC description;
+	std::vector<std::string> names;
+	std::vector<FakeReflectionType*> members;
+};
+
+class FakeReflectionVariable : public ID3D11ShaderReflectionVariable
+{
+public:
+	FakeReflectionVariable(ID3D11ShaderReflectionConstantBuffer *owner, const char *name, UINT startOffset, UINT size, FakeReflectionType *type)
+		: owner(owner), name(name), startOffset(startOffset), size(size), type(type)
+	{
+	}
+	~FakeReflectionVariable()
+	{
+		delete type;
+	}
+
+	void SetDefaultValue(const void *data, UINT dataSize)
+	{
+		const BYTE *bytes = static_cast<const BYTE*>(data);
+		defaultValue.assign(bytes, bytes + dataSize);
+	}
+
+	STDMETHOD(GetDesc)(D3D11_SHADER_VARIABLE_DESC *desc)
+	{
+		memset(desc, 0, sizeof(*desc));
+		desc->Name = name.c_str();
+		desc->StartOffset = startOffset;
+		desc->Size = size;
+		desc->uFlags = D3D10_SVF_USED;
+		desc->DefaultValue = defaultValue.empty() ? 0 : &defaultValue[0];
+		return S_OK;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionType*, GetType)()
+	{
+		return type;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionConstantBuffer*, GetBuffer)()
+	{
+		return owner;
+	}
+	STDMETHOD_(UINT, GetInterfaceSlot)(UINT)
+	{
+		return 0;
+	}
+
+private:
+	ID3D11ShaderReflectionConstantBuffer *owner;
+	std::string name;
+	UINT startOffset;
+	UINT size;
+	FakeReflectionType *type;
+	std::vector<BYTE> defaultValue;
+};
+
+class FakeReflectionConstantBuffer : public ID3D11ShaderReflectionConstantBuffer
+{
+public:
+	FakeReflectionConstantBuffer(const char *name, UINT size)
+		: name(name), size(size)
+	{
+	}
+	~FakeReflectionConstantBuffer()
+	{
+		for (size_t i = 0; i < variables.size(); ++i)
+			delete variables[i];
+	}
+
+	FakeReflectionVariable *AddVariable(const char *variableName, UINT startOffset, UINT variableSize, FakeReflectionType *type)
+	{
+		variables.push_back(new FakeReflectionVariable(this, variableName, startOffset, variableSize, type));
+		return variables.back();
+	}
+
+	STDMETHOD(GetDesc)(D3D11_SHADER_BUFFER_DESC *desc)
+	{
+		memset(desc, 0, sizeof(*desc));
+		desc->Name = name.c_str();
+		desc->Variables = static_cast<UINT>(variables.size());
+		desc->Size = size;
+		return S_OK;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionVariable*, GetVariableByIndex)(UINT index)
+	{
+		return index < variables.size() ? variables[index] : 0;
+	}
+	STDMETHOD_(ID3D11ShaderReflectionVariable*, GetVariableByName)(LPCSTR variableName)
+	{
+		for (size_t i = 0; i < variables.size(); ++i)
+		{
+			D3D11_SHADER_VARIABLE_DESC desc;
+			variables[i]->GetDesc(&desc);
+			if (strcmp(desc.Name, variableName) == 0)
+				return variables[i];
+		}
+		return 0;
+	}
+
+private:
+	std::string name;
+	UINT size;
+	std::vector<FakeReflectionVariable*> variables;
+};
+
+static FakeReflectionType *Scalar(D3D_SHADER_VARIABLE_TYPE type, UINT elements, UINT offset)
+{
+	return new FakeReflectionType(D3D10_SVC_SCALAR, type, 1, 1, elements, offset);
+}
+
+static FakeReflectionType *FloatVector(UINT columns, UINT offset)
+{
+	return new FakeReflectionType(D3D10_SVC_VECTOR, D3D10_SVT_FLOAT, 1, columns, 0, offset);
+}
+
+static FakeReflectionType *FloatMatrix(D3D_SHADER_VARIABLE_CLASS variableClass, UINT rows, UINT columns)
+{
+	return new FakeReflectionType(variableClass, D3D10_SVT_FLOAT, rows, columns, 0, 0);
+}
+
+// Mirrors what the compiler reflects for
+//
+// cbuffer Globals
+// {
+//     float Scale = 1.5f;                       // 0
+//     int Count;                                // 4
+//     float3 Tint;                              // 16
+//     row_major float4x4 World;                 // 32
+//     column_major float4x4 ViewProjection;     // 96
+//     float Weights[3];                         // 160, 16 byte stride
+//     Light Lights[2];                          // 208, 32 byte stride
+// };
+//
+// struct Light { float3 Position; float Range; float4 Color; };
+static FakeReflectionConstantBuffer *CreateGlobals()
+{
+	FakeReflectionConstantBuffer *buffer = new FakeReflectionConstantBuffer("Globals", 272);
+
+	float scale = 1.5f;
+	buffer->AddVariable("Scale", 0, 4, Scalar(D3D10_SVT_FLOAT, 0, 0))->SetDefaultValue(&scale, sizeof(scale));
+	buffer->AddVariable("Count", 4, 4, Scalar(D3D10_SVT_INT, 0, 0));
+	buffer->AddVariable("Tint", 16, 12, FloatVector(3, 0));
+	buffer->AddVariable("World", 32, 64, FloatMatrix(D3D10_SVC_MATRIX_ROWS, 4, 4));
+	buffer->AddVariable("ViewProjection", 96, 64, FloatMatrix(D3D10_SVC_MATRIX_COLUMNS, 4, 4));
+	buffer->AddVariable("Weights", 160, 36, Scalar(D3D10_SVT_FLOAT, 3, 0));
+
+	FakeReflectionType *light = new FakeReflectionType(D3D10_SVC_STRUCT, D3D10_SVT_VOID, 1, 8, 2, 0);
+	light->AddMember("Position", FloatVector(3, 0));
+	light->AddMember("Range", Scalar(D3D10_SVT_FLOAT, 0, 12));
+	light->AddMember("Color", FloatVector(4, 16));
+	buffer->AddVariable("Lights", 208, 64, light);
+
+	return buffer;
+}
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+class ConstantBufferLayoutTest : public SlimDXTest
+{
+};
+
+#define CONSTANTBUFFERLAYOUT_TEST(name_) TEST_F(ConstantBufferLayoutTest, name_)
+
+static ConstantBufferLayout ^CreateLayout(FakeReflectionConstantBuffer *buffer)
+{
+	return gcnew ConstantBufferLayout(gcnew D3DCompiler::ConstantBuffer(IntPtr(static_cast<ID3D11ShaderReflectionConstantBuffer*>(buffer))));
+}
+
+static float ReadFloat(ShadowConstantBuffer ^shadow, int offset)
+{
+	ReferenceResource11 *storage = ReferenceResource11::FromResource(shadow->Buffer->InternalPointer);
+	float value;
+	memcpy(&value, storage->GetData(0) + offset, sizeof(value));
+	return value;
+}
+
+static int ReadInt(ShadowConstantBuffer ^shadow, int offset)
+{
+	ReferenceResource11 *storage = ReferenceResource11::FromResource(shadow->Buffer->InternalPointer);
+	int value;
+	memcpy(&value, storage->GetData(0) + offset, sizeof(value));
+	return value;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(DescribesBuffer)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ASSERT_TRUE(gcnew String("Globals") == layout->Name);
+	ASSERT_EQ(272, layout->SizeInBytes);
+	ASSERT_EQ(12, layout->FieldCount);
+	ASSERT_EQ(272, layout->DefaultData->Length);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(PacksScalarsAndVectors)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ConstantBufferField scale = layout->GetField("Scale");
+	ASSERT_EQ(0, scale.Offset);
+	ASSERT_EQ(4, scale.Size);
+	ASSERT_EQ(static_cast<int>(D3DCompiler::ShaderVariableClass::Scalar), static_cast<int>(scale.Class));
+	ASSERT_EQ(static_cast<int>(D3DCompiler::ShaderVariableType::Float), static_cast<int>(scale.Type));
+
+	ConstantBufferField count = layout->GetField("Count");
+	ASSERT_EQ(4, count.Offset);
+	ASSERT_EQ(static_cast<int>(D3DCompiler::ShaderVariableType::Int), static_cast<int>(count.Type));
+
+	ConstantBufferField tint = layout->GetField("Tint");
+	ASSERT_EQ(16, tint.Offset);
+	ASSERT_EQ(12, tint.Size);
+	ASSERT_EQ(3, tint.Columns);
+	ASSERT_EQ(0, tint.Elements);
+	ASSERT_EQ(16, tint.ElementStride);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(PacksMatricesOneRegisterPerRowOrColumn)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ConstantBufferField world = layout->GetField("World");
+	ASSERT_EQ(32, world.Offset);
+	ASSERT_EQ(64, world.Size);
+	ASSERT_EQ(static_cast<int>(D3DCompiler::ShaderVariableClass::MatrixRows), static_cast<int>(world.Class));
+
+	ConstantBufferField viewProjection = layout->GetField("ViewProjection");
+	ASSERT_EQ(96, viewProjection.Offset);
+	ASSERT_EQ(64, viewProjection.Size);
+	ASSERT_EQ(static_cast<int>(D3DCompiler::ShaderVariableClass::MatrixColumns), static_cast<int>(viewProjection.Class));
+}
+
+CONSTANTBUFFERLAYOUT_TEST(NonSquareMatrixSizeDependsOnMajority)
+{
+	FakeReflectionConstantBuffer *buffer = new FakeReflectionConstantBuffer("Bones", 112);
+	buffer->AddVariable("RowMajor", 0, 48, FloatMatrix(D3D10_SVC_MATRIX_ROWS, 3, 4));
+	buffer->AddVariable("ColumnMajor", 48, 60, FloatMatrix(D3D10_SVC_MATRIX_COLUMNS, 3, 4));
+	ConstantBufferLayout ^layout = CreateLayout(buffer);
+	delete buffer;
+
+	// three rows of four floats, or four columns where the last one only holds three floats
+	ASSERT_EQ(48, layout->GetField("RowMajor").Size);
+	ASSERT_EQ(60, layout->GetField("ColumnMajor").Size);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(ArrayElementsStartOnRegisterBoundaries)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ConstantBufferField weights = layout->GetField("Weights");
+	ASSERT_EQ(160, weights.Offset);
+	ASSERT_EQ(3, weights.Elements);
+	ASSERT_EQ(16, weights.ElementStride);
+
+	// the last element is not padded out to a full register
+	ASSERT_EQ(36, weights.Size);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(FlattensStructArrays)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ASSERT_EQ(-1, layout->IndexOf("Lights"));
+	ASSERT_EQ(6, layout->IndexOf("Lights[0].Position"));
+	ASSERT_EQ(11, layout->IndexOf("Lights[1].Color"));
+
+	ASSERT_EQ(208, layout->GetField("Lights[0].Position").Offset);
+	ASSERT_EQ(220, layout->GetField("Lights[0].Range").Offset);
+	ASSERT_EQ(224, layout->GetField("Lights[0].Color").Offset);
+
+	// each light is rounded up to two registers
+	ASSERT_EQ(240, layout->GetField("Lights[1].Position").Offset);
+	ASSERT_EQ(252, layout->GetField("Lights[1].Range").Offset);
+	ASSERT_EQ(256, layout->GetField("Lights[1].Color").Offset);
+	ASSERT_EQ(16, layout->GetField("Lights[1].Color").Size);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(CopiesDefaultValues)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ASSERT_EQ(1.5f, BitConverter::ToSingle(layout->DefaultData, 0));
+
+	// variables without an initializer stay zero
+	ASSERT_EQ(0, BitConverter::ToInt32(layout->DefaultData, 4));
+}
+
+CONSTANTBUFFERLAYOUT_TEST(FieldLookup)
+{
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	ASSERT_EQ(2, layout->IndexOf("Tint"));
+	ASSERT_EQ(-1, layout->IndexOf("Missing"));
+	ASSERT_TRUE(gcnew String("Tint") == layout->GetField(2).Name);
+
+	String ^noName = nullptr;
+	ConstantBufferField field;
+	ASSERT_MANAGED_THROW(layout->IndexOf(noName), ArgumentNullException);
+	ASSERT_MANAGED_THROW(field = layout->GetField("Missing"), ArgumentException);
+	ASSERT_MANAGED_THROW(field = layout->GetField(-1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(field = layout->GetField(12), ArgumentOutOfRangeException);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(FieldOutsideBufferThrows)
+{
+	FakeReflectionConstantBuffer *buffer = new FakeReflectionConstantBuffer("Broken", 16);
+	buffer->AddVariable("Color", 4, 16, FloatVector(4, 0));
+
+	ConstantBufferLayout ^layout;
+	ASSERT_MANAGED_THROW(layout = CreateLayout(buffer), InvalidOperationException);
+	delete buffer;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(NullConstantBufferThrows)
+{
+	D3DCompiler::ConstantBuffer ^noBuffer = nullptr;
+	ASSERT_MANAGED_THROW(gcnew ConstantBufferLayout(noBuffer), ArgumentNullException);
+}
+
+CONSTANTBUFFERLAYOUT_TEST(ShadowStartsDirtyWithDefaults)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	ASSERT_TRUE(shadow->IsDirty);
+	ASSERT_EQ(0, shadow->DirtyOffset);
+	ASSERT_EQ(272, shadow->DirtySize);
+	ASSERT_EQ(272, shadow->Buffer->Description.SizeInBytes);
+
+	ASSERT_TRUE(shadow->Commit(device.Context).IsSuccess);
+	ASSERT_FALSE(shadow->IsDirty);
+	ASSERT_EQ(0, shadow->DirtySize);
+	ASSERT_EQ(1.5f, ReadFloat(shadow, 0));
+	ASSERT_EQ(1, shadow->UploadCount);
+	ASSERT_EQ(272, shadow->UploadedBytes);
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(DynamicShadowMapsWithDiscard)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	shadow->Commit(device.Context);
+	ASSERT_EQ(1u, device.Reference.GetStatistics().MapCalls);
+	ASSERT_EQ(1u, device.Reference.GetStatistics().DiscardMapCalls);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+	ASSERT_FALSE(ReferenceResource11::FromResource(shadow->Buffer->InternalPointer)->IsMapped(0));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(DefaultShadowUsesUpdateSubresource)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals), ResourceUsage::Default);
+	delete globals;
+
+	shadow->Set(shadow->Layout->IndexOf("Count"), 7);
+	ASSERT_TRUE(shadow->Commit(device.Context).IsSuccess);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().MapCalls);
+	ASSERT_EQ(1u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+	ASSERT_EQ(1.5f, ReadFloat(shadow, 0));
+	ASSERT_EQ(7, ReadInt(shadow, 4));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(CleanShadowSkipsUpload)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	shadow->Commit(device.Context);
+	ASSERT_TRUE(shadow->Commit(device.Context).IsSuccess);
+	ASSERT_EQ(1, shadow->UploadCount);
+	ASSERT_EQ(1, shadow->SkippedUploadCount);
+	ASSERT_EQ(1u, device.Reference.GetStatistics().MapCalls);
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(SetMarksOnlyTheFieldDirty)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	shadow->Commit(device.Context);
+	shadow->Set(shadow->Layout->IndexOf("Tint"), Vector3(1.0f, 2.0f, 3.0f));
+	ASSERT_TRUE(shadow->IsDirty);
+	ASSERT_EQ(16, shadow->DirtyOffset);
+	ASSERT_EQ(12, shadow->DirtySize);
+
+	shadow->Set(shadow->Layout->IndexOf("Lights[1].Color"), Color4(1.0f, 0.25f, 0.5f, 0.75f));
+	ASSERT_EQ(16, shadow->DirtyOffset);
+	ASSERT_EQ(256, shadow->DirtySize);
+
+	// the whole buffer is still uploaded since a discard leaves the rest undefined
+	shadow->Commit(device.Context);
+	ASSERT_EQ(544, shadow->UploadedBytes);
+	ASSERT_EQ(1.0f, ReadFloat(shadow, 16));
+	ASSERT_EQ(3.0f, ReadFloat(shadow, 24));
+	ASSERT_EQ(0.25f, ReadFloat(shadow, 256));
+	ASSERT_EQ(1.0f, ReadFloat(shadow, 268));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(VectorsAreTruncatedToFieldColumns)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	shadow->Set(shadow->Layout->IndexOf("Tint"), Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+	shadow->Commit(device.Context);
+	ASSERT_EQ(3.0f, ReadFloat(shadow, 24));
+	ASSERT_EQ(0.0f, ReadFloat(shadow, 28));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(UnchangedWritesStayClean)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	int scale = shadow->Layout->IndexOf("Scale");
+	int world = shadow->Layout->IndexOf("World");
+	shadow->Set(world, Matrix::Identity);
+	shadow->Commit(device.Context);
+
+	// the default value counts as already written
+	shadow->Set(scale, 1.5f);
+	shadow->Set(world, Matrix::Identity);
+	ASSERT_FALSE(shadow->IsDirty);
+	ASSERT_EQ(2, shadow->RedundantWriteCount);
+
+	shadow->Commit(device.Context);
+	ASSERT_EQ(1, shadow->UploadCount);
+	ASSERT_EQ(1, shadow->SkippedUploadCount);
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(RowMajorMatrixIsStoredByRows)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	Matrix world = Matrix::Identity;
+	world.M12 = 2.0f;
+	world.M41 = 5.0f;
+	shadow->Set(shadow->Layout->IndexOf("World"), world);
+	shadow->Commit(device.Context);
+
+	ASSERT_EQ(1.0f, ReadFloat(shadow, 32));
+	ASSERT_EQ(2.0f, ReadFloat(shadow, 36));
+	ASSERT_EQ(5.0f, ReadFloat(shadow, 32 + 48));
+	ASSERT_EQ(0.0f, ReadFloat(shadow, 32 + 12));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(ColumnMajorMatrixIsTransposed)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	Matrix viewProjection = Matrix::Identity;
+	viewProjection.M12 = 2.0f;
+	viewProjection.M41 = 5.0f;
+	shadow->Set(shadow->Layout->IndexOf("ViewProjection"), viewProjection);
+	shadow->Commit(device.Context);
+
+	// register c holds column c, so M12 lands in the second register and M41 at the end of the first
+	ASSERT_EQ(1.0f, ReadFloat(shadow, 96));
+	ASSERT_EQ(2.0f, ReadFloat(shadow, 96 + 16));
+	ASSERT_EQ(5.0f, ReadFloat(shadow, 96 + 12));
+	ASSERT_EQ(0.0f, ReadFloat(shadow, 96 + 4));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(ArraysAreWrittenWithElementStride)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	array<float> ^weights = { 0.5f, 0.25f, 0.125f };
+	shadow->Set(shadow->Layout->IndexOf("Weights"), weights);
+	shadow->Commit(device.Context);
+
+	ASSERT_EQ(0.5f, ReadFloat(shadow, 160));
+	ASSERT_EQ(0.0f, ReadFloat(shadow, 164));
+	ASSERT_EQ(0.25f, ReadFloat(shadow, 176));
+	ASSERT_EQ(0.125f, ReadFloat(shadow, 192));
+
+	array<float> ^tooMany = gcnew array<float>(4);
+	ASSERT_MANAGED_THROW(shadow->Set(shadow->Layout->IndexOf("Weights"), tooMany), ArgumentOutOfRangeException);
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(IntegerFields)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	int count = shadow->Layout->IndexOf("Count");
+	shadow->Set(count, 42);
+	shadow->Commit(device.Context);
+	ASSERT_EQ(42, ReadInt(shadow, 4));
+
+	shadow->Set(count, true);
+	shadow->Commit(device.Context);
+	ASSERT_EQ(1, ReadInt(shadow, 4));
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(MismatchedValuesThrow)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	int scale = shadow->Layout->IndexOf("Scale");
+	int count = shadow->Layout->IndexOf("Count");
+	int world = shadow->Layout->IndexOf("World");
+
+	ASSERT_MANAGED_THROW(shadow->Set(scale, 7), ArgumentException);
+	ASSERT_MANAGED_THROW(shadow->Set(count, 7.0f), ArgumentException);
+	ASSERT_MANAGED_THROW(shadow->Set(scale, Matrix::Identity), ArgumentException);
+	ASSERT_MANAGED_THROW(shadow->Set(world, 1.0f), ArgumentException);
+	ASSERT_MANAGED_THROW(shadow->Set(shadow->Layout->FieldCount, 1.0f), ArgumentOutOfRangeException);
+
+	array<float> ^noValues = nullptr;
+	ASSERT_MANAGED_THROW(shadow->Set(scale, noValues), ArgumentNullException);
+	ASSERT_EQ(0, shadow->RedundantWriteCount);
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(InvalidateAndResetStatistics)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	shadow->Commit(device.Context);
+	shadow->Commit(device.Context);
+	shadow->Set(shadow->Layout->IndexOf("Scale"), 1.5f);
+
+	// a context that lost its contents needs the whole buffer again
+	shadow->Invalidate();
+	ASSERT_TRUE(shadow->IsDirty);
+	ASSERT_EQ(0, shadow->DirtyOffset);
+	ASSERT_EQ(272, shadow->DirtySize);
+	shadow->Commit(device.Context);
+	ASSERT_EQ(2, shadow->UploadCount);
+
+	shadow->ResetStatistics();
+	ASSERT_EQ(0, shadow->UploadCount);
+	ASSERT_EQ(0, shadow->SkippedUploadCount);
+	ASSERT_EQ(0, shadow->RedundantWriteCount);
+	ASSERT_EQ(0, shadow->UploadedBytes);
+
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(ShadowValidatesArguments)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ConstantBufferLayout ^layout = CreateLayout(globals);
+	delete globals;
+
+	FakeReflectionConstantBuffer *empty = new FakeReflectionConstantBuffer("Empty", 0);
+	ConstantBufferLayout ^emptyLayout = CreateLayout(empty);
+	delete empty;
+
+	SlimDX::Direct3D11::Device ^noDevice = nullptr;
+	ConstantBufferLayout ^noLayout = nullptr;
+	ASSERT_MANAGED_THROW(gcnew ShadowConstantBuffer(noDevice, layout), ArgumentNullException);
+	ASSERT_MANAGED_THROW(gcnew ShadowConstantBuffer(device.Device, noLayout), ArgumentNullException);
+	ASSERT_MANAGED_THROW(gcnew ShadowConstantBuffer(device.Device, layout, ResourceUsage::Immutable), ArgumentException);
+	ASSERT_MANAGED_THROW(gcnew ShadowConstantBuffer(device.Device, emptyLayout), ArgumentException);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().ResourcesCreated);
+
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, layout);
+	DeviceContext ^noContext = nullptr;
+	ASSERT_MANAGED_THROW(shadow->Commit(noContext), ArgumentNullException);
+	delete shadow;
+}
+
+CONSTANTBUFFERLAYOUT_TEST(DisposedShadowThrows)
+{
+	ReferencedDevice device;
+	FakeReflectionConstantBuffer *globals = CreateGlobals();
+	ShadowConstantBuffer ^shadow = gcnew ShadowConstantBuffer(device.Device, CreateLayout(globals));
+	delete globals;
+
+	delete shadow;
+	ASSERT_MANAGED_THROW(shadow->Set(0, 1.0f), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(shadow->Commit(device.Context), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(shadow->Invalidate(), ObjectDisposedException);
+}
@@ -0,0 +1,479 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace SlimDX;
+using namespace SlimDX::DXGI;
+using namespace SlimDX::Direct3D11;
+
+// Field offsets from the start of the file, including the four byte magic number.
+static size_t const HeaderFlags = 8;
+static size_t const HeaderHeight = 12;
+static size_t const HeaderWidth = 16;
+static size_t const HeaderDepth = 24;
+static size_t const HeaderMipMapCount = 28;
+static size_t const PixelFormatFlags = 80;
+static size_t const PixelFormatFourCC = 84;
+static size_t const PixelFormatBitCount = 88;
+static size_t const PixelFormatMasks = 92;
+static size_t const HeaderCaps2 = 112;
+static size_t const ExtensionOffset = 128;
+static size_t const HeaderSize = 128;
+static size_t const ExtendedHeaderSize = 148;
+
+static void Put(std::vector<unsigned char> &bytes, size_t offset, unsigned int value)
+{
+	for (int i = 0; i < 4; ++i)
+		bytes[offset + i] = static_cast<unsigned char>(value >> (i * 8));
+}
+
+static unsigned int FourCC(const char *code)
+{
+	return code[0] | (code[1] << 8) | (code[2] << 16) | (code[3] << 24);
+}
+
+// A legacy header with no pixel format; callers fill in the format and append the data.
+static std::vector<unsigned char> BuildHeader(int width, int height, int mipLevels)
+{
+	std::vector<unsigned char> bytes(HeaderSize);
+	Put(bytes, 0, FourCC("DDS "));
+	Put(bytes, 4, 124);
+	Put(bytes, HeaderFlags, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000);
+	Put(bytes, HeaderHeight, height);
+	Put(bytes, HeaderWidth, width);
+	Put(bytes, HeaderMipMapCount, mipLevels);
+	Put(bytes, 76, 32);
+	Put(bytes, 108, 0x1000);
+	return bytes;
+}
+
+static void SetFourCC(std::vector<unsigned char> &bytes, const char *code)
+{
+	Put(bytes, PixelFormatFlags, 0x4);
+	Put(bytes, PixelFormatFourCC, FourCC(code));
+}
+
+static void SetMasks(std::vector<unsigned char> &bytes, unsigned int flags, unsigned int bitCount,
+	unsigned int r, unsigned int g, unsigned int b, unsigned int a)
+{
+	Put(bytes, PixelFormatFlags, flags);
+	Put(bytes, PixelFormatBitCount, bitCount);
+	Put(bytes, PixelFormatMasks + 0, r);
+	Put(bytes, PixelFormatMasks + 4, g);
+	Put(bytes, PixelFormatMasks + 8, b);
+	Put(bytes, PixelFormatMasks + 12, a);
+}
+
+static void AddExtension(std::vector<unsigned char> &bytes, DXGI_FORMAT format, D3D11_RESOURCE_DIMENSION dimension,
+	unsigned int miscFlag, unsigned int arraySize)
+{
+	SetFourCC(bytes, "DX10");
+	bytes.resize(ExtendedHeaderSize);
+	Put(bytes, ExtensionOffset + 0, format);
+	Put(bytes, ExtensionOffset + 4, dimension);
+	Put(bytes, ExtensionOffset + 8, miscFlag);
+	Put(bytes, ExtensionOffset + 12, arraySize);
+}
+
+static void AddData(std::vector<unsigned char> &bytes, size_t length)
+{
+	bytes.resize(bytes.size() + length);
+}
+
+// A stream that can be read but not repositioned, so its length is unknown to the reader.
+ref class ForwardOnlyStream : public MemoryStream
+{
+public:
+	ForwardOnlyStream(array<Byte> ^bytes)
+		: MemoryStream(bytes)
+	{
+	}
+
+	virtual property bool CanSeek { bool get() override { return false; } }
+};
+
+class DdsFileTest : public SlimDXTest
+{
+protected:
+	static array<Byte> ^ToArray(const std::vector<unsigned char> &bytes)
+	{
+		array<Byte> ^memory = gcnew array<Byte>(static_cast<int>(bytes.size()));
+		pin_ptr<Byte> pinnedMemory = &memory[0];
+		memcpy(pinnedMemory, &bytes[0], bytes.size());
+		return memory;
+	}
+
+	static DdsFile ^Parse(const std::vector<unsigned char> &bytes)
+	{
+		return DdsFile::FromMemory(ToArray(bytes));
+	}
+
+	static void AssertRejected(const std::vector<unsigned char> &bytes)
+	{
+		DdsFile ^file = nullptr;
+		ASSERT_MANAGED_THROW(file = Parse(bytes), InvalidDataException);
+		ASSERT_TRUE(file == nullptr);
+	}
+
+	static void AssertRejectedFromForwardOnlyStream(const std::vector<unsigned char> &bytes)
+	{
+		ForwardOnlyStream stream(ToArray(bytes));
+		DdsFile ^file = nullptr;
+		ASSERT_MANAGED_THROW(file = DdsFile::FromStream(%stream), InvalidDataException);
+		ASSERT_TRUE(file == nullptr);
+	}
+
+	static void AssertSubresource(DdsFile ^file, int mipLevel, int arraySlice, Int64 offset, int length,
+		int width, int height, int rowPitch, int slicePitch)
+	{
+		DdsSubresource subresource = file->GetSubresource(mipLevel, arraySlice);
+		ASSERT_EQ(offset, subresource.Offset);
+		ASSERT_EQ(length, subresource.Length);
+		ASSERT_EQ(mipLevel, subresource.MipLevel);
+		ASSERT_EQ(arraySlice, subresource.ArraySlice);
+		ASSERT_EQ(width, subresource.Width);
+		ASSERT_EQ(height, subresource.Height);
+		ASSERT_EQ(rowPitch, subresource.RowPitch);
+		ASSERT_EQ(slicePitch, subresource.SlicePitch);
+	}
+};
+
+TEST_F(DdsFileTest, ReadsLegacyBC1MipChain)
+{
+	std::vector<unsigned char> bytes = BuildHeader(256, 128, 9);
+	SetFourCC(bytes, "DXT1");
+	AddData(bytes, 21864);
+
+	DdsFile ^file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::BC1_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(static_cast<int>(ResourceDimension::Texture2D), static_cast<int>(file->Dimension));
+	ASSERT_EQ(256, file->Width);
+	ASSERT_EQ(128, file->Height);
+	ASSERT_EQ(1, file->Depth);
+	ASSERT_EQ(9, file->MipLevels);
+	ASSERT_EQ(1, file->ArraySize);
+	ASSERT_FALSE(file->IsCubeMap);
+	ASSERT_EQ(128, file->DataOffset);
+	ASSERT_EQ(21864, file->DataLength);
+	ASSERT_EQ(9, file->Subresources->Count);
+
+	AssertSubresource(file, 0, 0, 128, 16384, 256, 128, 512, 16384);
+	AssertSubresource(file, 1, 0, 16512, 4096, 128, 64, 256, 4096);
+
+	// levels below one block still occupy a whole block
+	AssertSubresource(file, 6, 0, 21968, 8, 4, 2, 8, 8);
+	AssertSubresource(file, 7, 0, 21976, 8, 2, 1, 8, 8);
+	AssertSubresource(file, 8, 0, 21984, 8, 1, 1, 8, 8);
+}
+
+TEST_F(DdsFileTest, MissingMipCountMeansOneLevel)
+{
+	std::vector<unsigned char> bytes = BuildHeader(8, 8, 0);
+	SetFourCC(bytes, "DXT5");
+	AddData(bytes, 64);
+
+	DdsFile ^file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::BC3_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(1, file->MipLevels);
+	ASSERT_EQ(64, file->DataLength);
+}
+
+TEST_F(DdsFileTest, MapsLegacyPixelFormats)
+{
+	std::vector<unsigned char> bytes = BuildHeader(5, 3, 1);
+	SetMasks(bytes, 0x41, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+	AddData(bytes, 60);
+	DdsFile ^file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::B8G8R8A8_UNorm), static_cast<int>(file->Format));
+	AssertSubresource(file, 0, 0, 128, 60, 5, 3, 20, 60);
+
+	bytes = BuildHeader(5, 3, 1);
+	SetMasks(bytes, 0x40, 16, 0xF800, 0x07E0, 0x001F, 0);
+	AddData(bytes, 30);
+	file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::B5G6R5_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(10, file->GetSubresource(0, 0).RowPitch);
+
+	bytes = BuildHeader(5, 3, 1);
+	SetMasks(bytes, 0x20000, 8, 0xFF, 0, 0, 0);
+	AddData(bytes, 15);
+	file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::R8_UNorm), static_cast<int>(file->Format));
+
+	// packed 4:2:2 stores two pixels in four bytes
+	bytes = BuildHeader(5, 3, 1);
+	SetFourCC(bytes, "RGBG");
+	AddData(bytes, 36);
+	file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::R8G8_B8G8_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(12, file->GetSubresource(0, 0).RowPitch);
+
+	// older writers put a D3DFORMAT value (D3DFMT_A16B16G16R16F) where the FourCC belongs
+	bytes = BuildHeader(2, 2, 1);
+	Put(bytes, PixelFormatFlags, 0x4);
+	Put(bytes, PixelFormatFourCC, 113);
+	AddData(bytes, 32);
+	file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::R16G16B16A16_Float), static_cast<int>(file->Format));
+}
+
+TEST_F(DdsFileTest, ReadsLegacyCubeMap)
+{
+	std::vector<unsigned char> bytes = BuildHeader(8, 8, 4);
+	SetMasks(bytes, 0x41, 32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
+	Put(bytes, HeaderCaps2, 0x200 | 0xFC00);
+	AddData(bytes, 6 * 340);
+
+	DdsFile ^file = Parse(bytes);
+	ASSERT_TRUE(file->IsCubeMap);
+	ASSERT_EQ(6, file->ArraySize);
+	ASSERT_EQ(24, file->Subresources->Count);
+	ASSERT_EQ(6 * 340, file->DataLength);
+
+	// faces are stored one after another, each with its whole mip chain
+	AssertSubresource(file, 0, 1, 128 + 340, 256, 8, 8, 32, 256);
+	AssertSubresource(file, 3, 5, 128 + 5 * 340 + 336, 4, 1, 1, 4, 4);
+	ASSERT_EQ(6 * 256, file->GetMipLevelSize(0));
+}
+
+TEST_F(DdsFileTest, ReadsLegacyVolume)
+{
+	std::vector<unsigned char> bytes = BuildHeader(8, 8, 4);
+	SetMasks(bytes, 0x2, 8, 0, 0, 0, 0xFF);
+	Put(bytes, HeaderFlags, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x800000);
+	Put(bytes, HeaderDepth, 4);
+	Put(bytes, HeaderCaps2, 0x200000);
+	AddData(bytes, 256 + 32 + 4 + 1);
+
+	DdsFile ^file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::A8_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(static_cast<int>(ResourceDimension::Texture3D), static_cast<int>(file->Dimension));
+	ASSERT_EQ(4, file->Depth);
+
+	DdsSubresource level1 = file->GetSubresource(1, 0);
+	ASSERT_EQ(2, level1.Depth);
+	ASSERT_EQ(16, level1.SlicePitch);
+	ASSERT_EQ(32, level1.Length);
+	ASSERT_EQ(128 + 256, level1.Offset);
+	ASSERT_EQ(1, file->GetSubresource(3, 0).Depth);
+}
+
+TEST_F(DdsFileTest, ReadsExtendedHeaderArray)
+{
+	std::vector<unsigned char> bytes = BuildHeader(16, 16, 2);
+	AddExtension(bytes, DXGI_FORMAT_BC7_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, 3);
+	AddData(bytes, 3 * 320);
+
+	DdsFile ^file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(Format::BC7_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(3, file->ArraySize);
+	ASSERT_EQ(148, file->DataOffset);
+	ASSERT_EQ(5, file->GetSubresourceIndex(1, 2));
+	AssertSubresource(file, 1, 2, 148 + 2 * 320 + 256, 64, 8, 8, 32, 64);
+	ASSERT_EQ(3 * 256, file->GetMipLevelSize(0));
+
+	// the smallest level of every slice comes first
+	array<int> ^order = file->GetLoadOrder();
+	const int expected[] = { 1, 3, 5, 0, 2, 4 };
+	ASSERT_EQ(static_cast<int>(NUM_OF(expected)), order->Length);
+	for (int i = 0; i < order->Length; ++i)
+		ASSERT_EQ(expected[i], order[i]);
+}
+
+TEST_F(DdsFileTest, ReadsExtendedHeaderCubeAndTexture1D)
+{
+	std::vector<unsigned char> bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, D3D11_RESOURCE_MISC_TEXTURECUBE, 2);
+	AddData(bytes, 12 * 64);
+	DdsFile ^file = Parse(bytes);
+	ASSERT_TRUE(file->IsCubeMap);
+	ASSERT_EQ(12, file->ArraySize);
+
+	// one-dimensional textures ignore whatever height the header carries
+	bytes = BuildHeader(10, 7, 1);
+	AddExtension(bytes, DXGI_FORMAT_R32G32B32A32_FLOAT, D3D11_RESOURCE_DIMENSION_TEXTURE1D, 0, 1);
+	AddData(bytes, 160);
+	file = Parse(bytes);
+	ASSERT_EQ(static_cast<int>(ResourceDimension::Texture1D), static_cast<int>(file->Dimension));
+	ASSERT_EQ(1, file->Height);
+	AssertSubresource(file, 0, 0, 148, 160, 10, 1, 160, 160);
+}
+
+TEST_F(DdsFileTest, ReadsFromStreamAtItsPosition)
+{
+	std::vector<unsigned char> bytes = BuildHeader(16, 16, 2);
+	AddExtension(bytes, DXGI_FORMAT_BC7_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, 1);
+	AddData(bytes, 320);
+
+	MemoryStream ^stream = gcnew MemoryStream();
+	stream->Write(gcnew array<Byte>(10), 0, 10);
+	stream->Write(ToArray(bytes), 0, static_cast<int>(bytes.size()));
+	stream->Position = 10;
+
+	DdsFile ^file = DdsFile::FromStream(stream);
+	ASSERT_EQ(static_cast<int>(Format::BC7_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(148, file->DataOffset);
+	ASSERT_EQ(320, file->DataLength);
+
+	// the data must fit in what remains after the starting position
+	stream->SetLength(stream->Length - 1);
+	stream->Position = 10;
+	ASSERT_MANAGED_THROW(file = DdsFile::FromStream(stream), InvalidDataException);
+
+	delete stream;
+}
+
+TEST_F(DdsFileTest, ReadsFromStreamThatCannotSeek)
+{
+	std::vector<unsigned char> bytes = BuildHeader(16, 16, 2);
+	AddExtension(bytes, DXGI_FORMAT_BC7_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, 1);
+	AddData(bytes, 320);
+
+	ForwardOnlyStream stream(ToArray(bytes));
+	DdsFile ^file = DdsFile::FromStream(%stream);
+	ASSERT_EQ(static_cast<int>(Format::BC7_UNorm), static_cast<int>(file->Format));
+	ASSERT_EQ(2, file->Subresources->Count);
+	ASSERT_EQ(320, file->DataLength);
+}
+
+TEST_F(DdsFileTest, RejectsOversizedSubresourceTables)
+{
+	// six times this slice count wraps a 32-bit int back to a small positive value
+	std::vector<unsigned char> bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, D3D11_RESOURCE_MISC_TEXTURECUBE, 0x2AAAAAAB);
+	AddData(bytes, 64);
+	AssertRejected(bytes);
+	AssertRejectedFromForwardOnlyStream(bytes);
+
+	bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION + 1);
+	AddData(bytes, 64);
+	AssertRejected(bytes);
+	AssertRejectedFromForwardOnlyStream(bytes);
+
+	// the largest array Direct3D 11 allows is still accepted
+	bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION);
+	AddData(bytes, D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION * 64);
+	ASSERT_EQ(D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION, Parse(bytes)->ArraySize);
+
+	// a mip count with the top bit set turns negative once it is stored as an int
+	bytes = BuildHeader(4, 4, 1);
+	SetFourCC(bytes, "DXT1");
+	Put(bytes, HeaderMipMapCount, 0x80000000);
+	AddData(bytes, 8);
+	AssertRejected(bytes);
+	AssertRejectedFromForwardOnlyStream(bytes);
+}
+
+TEST_F(DdsFileTest, RejectsMalformedFiles)
+{
+	std::vector<unsigned char> valid = BuildHeader(256, 128, 9);
+	SetFourCC(valid, "DXT1");
+	AddData(valid, 21864);
+	ASSERT_TRUE(Parse(valid) != nullptr);
+
+	std::vector<unsigned char> bytes = valid;
+	Put(bytes, 0, FourCC("DDS_"));
+	AssertRejected(bytes);
+
+	bytes.assign(valid.begin(), valid.begin() + 100);
+	AssertRejected(bytes);
+
+	bytes = valid;
+	Put(bytes, 4, 120);
+	AssertRejected(bytes);
+
+	bytes = valid;
+	SetFourCC(bytes, "XYZW");
+	AssertRejected(bytes);
+
+	bytes = valid;
+	Put(bytes, HeaderMipMapCount, 10);
+	AssertRejected(bytes);
+
+	bytes = valid;
+	Put(bytes, HeaderWidth, 0);
+	AssertRejected(bytes);
+
+	bytes.assign(valid.begin(), valid.end() - 1);
+	AssertRejected(bytes);
+
+	bytes = valid;
+	Put(bytes, HeaderCaps2, 0x200 | 0x400);
+	AssertRejected(bytes);
+}
+
+TEST_F(DdsFileTest, RejectsMalformedExtendedHeaders)
+{
+	std::vector<unsigned char> bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, 1);
+	std::vector<unsigned char> truncated(bytes.begin(), bytes.begin() + 140);
+	AssertRejected(truncated);
+
+	bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_BUFFER, 0, 1);
+	AddData(bytes, 64);
+	AssertRejected(bytes);
+
+	bytes = BuildHeader(4, 4, 1);
+	Put(bytes, HeaderDepth, 4);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE3D, 0, 2);
+	AddData(bytes, 512);
+	AssertRejected(bytes);
+
+	bytes = BuildHeader(4, 4, 1);
+	Put(bytes, HeaderDepth, 4);
+	AddExtension(bytes, DXGI_FORMAT_R8G8B8A8_UNORM, D3D11_RESOURCE_DIMENSION_TEXTURE3D, D3D11_RESOURCE_MISC_TEXTURECUBE, 1);
+	AddData(bytes, 512);
+	AssertRejected(bytes);
+
+	bytes = BuildHeader(4, 4, 1);
+	AddExtension(bytes, DXGI_FORMAT_UNKNOWN, D3D11_RESOURCE_DIMENSION_TEXTURE2D, 0, 1);
+	AddData(bytes, 64);
+	AssertRejected(bytes);
+}
+
+TEST_F(DdsFileTest, RejectsInvalidArguments)
+{
+	std::vector<unsigned char> bytes = BuildHeader(4, 4, 1);
+	SetFourCC(bytes, "DXT1");
+	AddData(bytes, 8);
+	DdsFile ^file = Parse(bytes);
+
+	DdsSubresource subresource;
+	ASSERT_MANAGED_THROW(subresource = file->GetSubresource(1, 0), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(subresource = file->GetSubresource(0, 1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(subresource = file->GetSubresource(-1, 0), ArgumentOutOfRangeException);
+
+	ASSERT_MANAGED_THROW(file = DdsFile::FromMemory(nullptr), ArgumentNullException);
+	ASSERT_MANAGED_THROW(file = DdsFile::FromMemory(gcnew array<Byte>(0)), InvalidDataException);
+	ASSERT_MANAGED_THROW(file = DdsFile::FromStream(nullptr), ArgumentNullException);
+}
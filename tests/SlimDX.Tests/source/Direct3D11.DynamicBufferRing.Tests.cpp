@@ -0,0 +1,224 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+#include "ReferenceObjects11.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+class DynamicBufferRingTest : public SlimDXTest
+{
+protected:
+	static const unsigned char *Contents(DynamicBufferRing %ring)
+	{
+		return ReferenceResource11::FromResource(ring.Buffer->InternalPointer)->GetData(0);
+	}
+
+	static array<Byte> ^Bytes(int count, Byte first)
+	{
+		array<Byte> ^bytes = gcnew array<Byte>(count);
+		for (int i = 0; i < count; ++i)
+			bytes[i] = static_cast<Byte>(first + i);
+		return bytes;
+	}
+};
+
+#define DYNAMICBUFFERRING_TEST(name_) TEST_F(DynamicBufferRingTest, name_)
+
+DYNAMICBUFFERRING_TEST(CreatesDynamicBuffer)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 256, BindFlags::VertexBuffer | BindFlags::IndexBuffer);
+
+	ASSERT_EQ(256, ring.SizeInBytes);
+	ASSERT_EQ(256, ring.Buffer->Description.SizeInBytes);
+	ASSERT_EQ(static_cast<int>(ResourceUsage::Dynamic), static_cast<int>(ring.Buffer->Description.Usage));
+	ASSERT_EQ(static_cast<int>(CpuAccessFlags::Write), static_cast<int>(ring.Buffer->Description.CpuAccessFlags));
+	ASSERT_EQ(0, ring.UsedBytes);
+}
+
+DYNAMICBUFFERRING_TEST(RejectsInvalidArguments)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ^ring;
+
+	ASSERT_MANAGED_THROW(ring = gcnew DynamicBufferRing(nullptr, 256, BindFlags::VertexBuffer), ArgumentNullException);
+	ASSERT_MANAGED_THROW(ring = gcnew DynamicBufferRing(device.Device, 0, BindFlags::VertexBuffer), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(ring = gcnew DynamicBufferRing(device.Device, 256, BindFlags::None), ArgumentException);
+	ASSERT_MANAGED_THROW(ring = gcnew DynamicBufferRing(device.Device, 256, BindFlags::ConstantBuffer), ArgumentException);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().ResourcesCreated);
+}
+
+DYNAMICBUFFERRING_TEST(RejectsInvalidWrites)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::VertexBuffer);
+	int offset;
+
+	ASSERT_MANAGED_THROW(offset = ring.Write(nullptr, Bytes(4, 0)), ArgumentNullException);
+	ASSERT_MANAGED_THROW(offset = ring.Write<Byte>(device.Context, nullptr), ArgumentNullException);
+	ASSERT_MANAGED_THROW(offset = ring.Write(device.Context, Bytes(65, 0)), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(offset = ring.Write(device.Context, Bytes(4, 0), 0, 4, 0), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(offset = ring.Write(device.Context, Bytes(4, 0), 2, 4, 1), ArgumentException);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().MapCalls);
+}
+
+DYNAMICBUFFERRING_TEST(FirstWriteDiscardsThenAppendsWithoutOverwrite)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::VertexBuffer);
+
+	ASSERT_EQ(0, ring.Write(device.Context, Bytes(8, 1)));
+	ASSERT_EQ(8, ring.Write(device.Context, Bytes(8, 9)));
+
+	ReferenceStatistics11 statistics = device.Reference.GetStatistics();
+	ASSERT_EQ(2u, statistics.MapCalls);
+	ASSERT_EQ(1u, statistics.DiscardMapCalls);
+	ASSERT_EQ(0, ring.DiscardCount);
+
+	const unsigned char *contents = Contents(ring);
+	for (int i = 0; i < 16; ++i)
+		ASSERT_EQ(i + 1, contents[i]);
+}
+
+DYNAMICBUFFERRING_TEST(AlignsOffsets)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::VertexBuffer);
+
+	ASSERT_EQ(0, ring.Write(device.Context, Bytes(3, 1)));
+
+	// arrays are aligned to their element size unless told otherwise
+	array<float> ^values = gcnew array<float>(2);
+	values[0] = 1.0f;
+	values[1] = 2.0f;
+	ASSERT_EQ(4, ring.Write(device.Context, values));
+	ASSERT_EQ(16, ring.Write(device.Context, values, 0, 2, 16));
+
+	ASSERT_EQ(24, ring.UsedBytes);
+	ASSERT_EQ(24, ring.CurrentFrameBytes);
+	ASSERT_EQ(2.0f, *reinterpret_cast<const float*>(Contents(ring) + 20));
+}
+
+DYNAMICBUFFERRING_TEST(WritesFromStreamPosition)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::IndexBuffer);
+	DataStream ^stream = gcnew DataStream(Bytes(8, 1), true, false);
+	stream->Position = 2;
+
+	ASSERT_EQ(0, ring.Write(device.Context, stream, 4, 1));
+	ASSERT_EQ(6, static_cast<int>(stream->Position));
+	ASSERT_EQ(3, Contents(ring)[0]);
+	ASSERT_EQ(6, Contents(ring)[3]);
+
+	int offset;
+	ASSERT_MANAGED_THROW(offset = ring.Write(device.Context, stream, 4, 1), EndOfStreamException);
+	ASSERT_EQ(6, static_cast<int>(stream->Position));
+
+	delete stream;
+}
+
+DYNAMICBUFFERRING_TEST(DiscardsWhenNoSpaceIsRetired)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::VertexBuffer);
+
+	ASSERT_EQ(0, ring.Write(device.Context, Bytes(48, 0)));
+
+	// nothing has been fenced, so the ring starts over in a renamed buffer instead of waiting
+	ASSERT_EQ(0, ring.Write(device.Context, Bytes(32, 100)));
+	ASSERT_EQ(1, ring.DiscardCount);
+	ASSERT_EQ(2u, device.Reference.GetStatistics().DiscardMapCalls);
+	ASSERT_EQ(32, ring.UsedBytes);
+	ASSERT_EQ(48, ring.PeakUsedBytes);
+	ASSERT_EQ(100, Contents(ring)[0]);
+}
+
+DYNAMICBUFFERRING_TEST(FillsBufferExactly)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::VertexBuffer);
+
+	ASSERT_EQ(0, ring.Write(device.Context, Bytes(32, 0)));
+	ASSERT_EQ(32, ring.Write(device.Context, Bytes(32, 0)));
+	ASSERT_EQ(0, ring.DiscardCount);
+	ASSERT_EQ(64, ring.UsedBytes);
+
+	ASSERT_EQ(0, ring.Write(device.Context, Bytes(1, 0)));
+	ASSERT_EQ(1, ring.DiscardCount);
+}
+
+DYNAMICBUFFERRING_TEST(EndFrameWithoutWritesNeedsNoFence)
+{
+	ReferencedDevice device;
+	DynamicBufferRing ring(device.Device, 64, BindFlags::VertexBuffer);
+
+	ring.EndFrame(device.Context);
+	ASSERT_EQ(0, ring.LastFrameBytes);
+	ASSERT_EQ(0, ring.PeakFrameBytes);
+	ASSERT_MANAGED_THROW(ring.EndFrame(nullptr), ArgumentNullException);
+}
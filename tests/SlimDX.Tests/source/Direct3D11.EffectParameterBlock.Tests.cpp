@@ -0,0 +1,309 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::D3DCompiler;
+using namespace SlimDX::Direct3D11;
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+static const char *EffectSource =
+	"cbuffer Frame\n"
+	"{\n"
+	"	float4x4 viewProjection;\n"
+	"	float3 eyePosition;\n"
+	"	float time;\n"
+	"};\n"
+	"cbuffer Object\n"
+	"{\n"
+	"	float4x4 world;\n"
+	"	float4 tint;\n"
+	"	float weights[3];\n"
+	"	int lightCount;\n"
+	"	bool visible;\n"
+	"};\n"
+	"struct Material\n"
+	"{\n"
+	"	float4 diffuse;\n"
+	"	float specular;\n"
+	"};\n"
+	"Material material;\n"
+	"float4 palette[4];\n"
+	"Texture2D diffuseMap;\n";
+
+class EffectParameterBlockTest : public SlimDXTest
+{
+protected:
+	static Effect ^CreateEffect(SlimDX::Direct3D11::Device ^device)
+	{
+		ShaderBytecode ^bytecode = ShaderBytecode::Compile(gcnew String(EffectSource), "fx_5_0", ShaderFlags::None, EffectFlags::None);
+		Effect ^effect = gcnew Effect(device, bytecode);
+		delete bytecode;
+		return effect;
+	}
+
+	static int OffsetOf(EffectParameterBlock ^block, String ^name)
+	{
+		return block->GetParameterDescription(block->IndexOf(name)).Offset;
+	}
+};
+
+#define EFFECTPARAMETERBLOCK_TEST(name_) TEST_F(EffectParameterBlockTest, name_)
+
+EFFECTPARAMETERBLOCK_TEST(DescribesParameters)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock block(effect, "viewProjection", "eyePosition", "time");
+
+	ASSERT_EQ(3, block.ParameterCount);
+	ASSERT_EQ(1, block.IndexOf("eyePosition"));
+	ASSERT_EQ(-1, block.IndexOf("world"));
+
+	ConstantBufferField eyePosition = block.GetParameterDescription(1);
+	ASSERT_EQ(gcnew String(L"eyePosition"), eyePosition.Name);
+	ASSERT_EQ(64, eyePosition.Offset);
+	ASSERT_EQ(12, eyePosition.Size);
+	ASSERT_EQ(3, eyePosition.Columns);
+	ASSERT_EQ(76, block.GetParameterDescription(2).Offset);
+
+	ConstantBufferField field;
+	ASSERT_MANAGED_THROW(field = block.GetParameterDescription(3), ArgumentOutOfRangeException);
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(ResolvesMembersAndElements)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock block(effect, "material.diffuse", "material.specular", "palette[0]", "palette[2]");
+
+	ASSERT_EQ(16, OffsetOf(%block, "material.specular") - OffsetOf(%block, "material.diffuse"));
+	ASSERT_EQ(32, OffsetOf(%block, "palette[2]") - OffsetOf(%block, "palette[0]"));
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(RejectsVariablesOutsideConstantBuffers)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock ^block;
+
+	ASSERT_MANAGED_THROW(block = gcnew EffectParameterBlock(nullptr, "time"), ArgumentNullException);
+	ASSERT_MANAGED_THROW(block = gcnew EffectParameterBlock(effect, "missing"), ArgumentException);
+	ASSERT_MANAGED_THROW(block = gcnew EffectParameterBlock(effect, "material.missing"), ArgumentException);
+	ASSERT_MANAGED_THROW(block = gcnew EffectParameterBlock(effect, "palette[x]"), ArgumentException);
+	ASSERT_MANAGED_THROW(block = gcnew EffectParameterBlock(effect, "diffuseMap"), ArgumentException);
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(ApplyWritesValuesIntoEffect)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock block(effect, "world", "tint", "weights", "lightCount", "visible");
+
+	Matrix world = Matrix::Translation(1.0f, 2.0f, 3.0f);
+	array<float> ^weights = gcnew array<float>(3);
+	weights[0] = 0.25f;
+	weights[1] = 0.5f;
+	weights[2] = 0.75f;
+
+	block.Set(0, world);
+	block.Set(1, Vector4(1.0f, 0.5f, 0.25f, 1.0f));
+	block.Set(2, weights);
+	block.Set(3, 4);
+	block.Set(4, true);
+	ASSERT_TRUE(block.Apply().IsSuccess);
+
+	// the variables are column-major, so this also checks that the block transposed the matrix
+	ASSERT_TRUE(world == effect->GetVariableByName("world")->AsMatrix()->GetMatrix());
+	ASSERT_TRUE(Vector4(1.0f, 0.5f, 0.25f, 1.0f) == effect->GetVariableByName("tint")->AsVector()->GetVector());
+	ASSERT_EQ(0.75f, effect->GetVariableByName("weights")->AsScalar()->GetFloatArray(3)[2]);
+	ASSERT_EQ(4, effect->GetVariableByName("lightCount")->AsScalar()->GetInt());
+	ASSERT_TRUE(effect->GetVariableByName("visible")->AsScalar()->GetBool());
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(SkipsRedundantWrites)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock block(effect, "tint", "time");
+
+	// the copies start out holding the effect's values, which are zero
+	block.Set(1, 0.0f);
+	block.Set(0, Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+	block.Set(0, Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+	ASSERT_EQ(2, block.RedundantWriteCount);
+
+	block.Apply();
+	ASSERT_EQ(1, block.RawValueCallCount);
+
+	// nothing changed since the last apply
+	block.Apply();
+	ASSERT_EQ(1, block.RawValueCallCount);
+
+	block.ResetStatistics();
+	ASSERT_EQ(0, block.RedundantWriteCount);
+	ASSERT_EQ(0, block.RawValueCallCount);
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(ApplyKeepsValuesBetweenDirtyParameters)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock block(effect, "world", "lightCount");
+
+	// tint lies between the two parameters and is set outside the block
+	effect->GetVariableByName("tint")->AsVector()->Set(Vector4(0.5f, 0.5f, 0.5f, 0.5f));
+
+	block.Set(0, Matrix::Identity);
+	block.Set(1, 2);
+	block.Apply();
+
+	// one read of the spanned range and one write, rather than a write per parameter
+	ASSERT_EQ(2, block.RawValueCallCount);
+	ASSERT_TRUE(Vector4(0.5f, 0.5f, 0.5f, 0.5f) == effect->GetVariableByName("tint")->AsVector()->GetVector());
+	ASSERT_EQ(2, effect->GetVariableByName("lightCount")->AsScalar()->GetInt());
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(InvalidateReadsValuesWrittenElsewhere)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock first(effect, "time");
+	EffectParameterBlock second(effect, "time");
+
+	first.Set(0, 1.0f);
+	first.Apply();
+
+	// the second block still believes time is zero
+	second.Set(0, 0.0f);
+	ASSERT_EQ(1, second.RedundantWriteCount);
+	second.Apply();
+	ASSERT_EQ(1.0f, effect->GetVariableByName("time")->AsScalar()->GetFloat());
+
+	ASSERT_TRUE(second.Invalidate().IsSuccess);
+	second.Set(0, 0.0f);
+	second.Apply();
+	ASSERT_EQ(0.0f, effect->GetVariableByName("time")->AsScalar()->GetFloat());
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(RejectsMismatchedValues)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock block(effect, "world", "lightCount", "weights");
+
+	ASSERT_MANAGED_THROW(block.Set(0, Vector4(1.0f, 1.0f, 1.0f, 1.0f)), ArgumentException);
+	ASSERT_MANAGED_THROW(block.Set(1, 1.0f), ArgumentException);
+	ASSERT_MANAGED_THROW(block.Set(2, 1), ArgumentException);
+	ASSERT_MANAGED_THROW(block.Set(2, gcnew array<float>(4)), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(block.Set(3, 1.0f), ArgumentOutOfRangeException);
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(ThrowsAfterDispose)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+	EffectParameterBlock ^block = gcnew EffectParameterBlock(effect, "time");
+
+	delete block;
+	ASSERT_MANAGED_THROW(block->Set(0, 1.0f), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(block->Apply(), ObjectDisposedException);
+
+	delete effect;
+}
+
+EFFECTPARAMETERBLOCK_TEST(EffectReusesVariableWrappers)
+{
+	ReferencedDevice device;
+	Effect ^effect = CreateEffect(device.Device);
+
+	EffectVariable ^tint = effect->GetVariableByName("tint");
+	ASSERT_TRUE(tint == effect->GetVariableByName("tint"));
+	ASSERT_TRUE(tint != effect->GetVariableByName("time"));
+	ASSERT_TRUE(tint->AsVector() == tint->AsVector());
+
+	EffectVariable ^world = effect->GetVariableByName("world");
+	ASSERT_TRUE(world->AsMatrix() == world->AsMatrix());
+
+	EffectVariable ^time = effect->GetVariableByName("time");
+	ASSERT_TRUE(time->AsScalar() == time->AsScalar());
+
+	delete effect;
+}
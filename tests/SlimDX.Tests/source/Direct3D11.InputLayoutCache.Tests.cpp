@@ -0,0 +1,246 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::D3DCompiler;
+using namespace SlimDX::Direct3D11;
+using namespace SlimDX::DXGI;
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+class InputLayoutCacheTest : public SlimDXTest
+{
+protected:
+	// Not a shader container, so the cache keys on the whole blob.
+	static ShaderSignature ^Signature(Byte tag)
+	{
+		array<Byte> ^bytes = gcnew array<Byte>(16);
+		for (int i = 0; i < bytes->Length; ++i)
+			bytes[i] = static_cast<Byte>(tag + i);
+		return gcnew ShaderSignature(gcnew DataStream(bytes, true, false));
+	}
+
+	static array<InputElement> ^PositionColor()
+	{
+		array<InputElement> ^elements = gcnew array<InputElement>(2);
+		elements[0] = InputElement("POSITION", 0, Format::R32G32B32_Float, 0, 0);
+		elements[1] = InputElement("COLOR", 0, Format::R8G8B8A8_UNorm, 12, 0);
+		return elements;
+	}
+
+	static array<InputElement> ^PositionTexture()
+	{
+		array<InputElement> ^elements = gcnew array<InputElement>(2);
+		elements[0] = InputElement("POSITION", 0, Format::R32G32B32_Float, 0, 0);
+		elements[1] = InputElement("TEXCOORD", 0, Format::R32G32_Float, 12, 0);
+		return elements;
+	}
+
+	// Created in a separate frame so that no local in the test keeps the cache reachable.
+	static WeakReference ^CreateAbandonedCache(SlimDX::Direct3D11::Device ^device)
+	{
+		return gcnew WeakReference(gcnew InputLayoutCache(device));
+	}
+};
+
+#define INPUTLAYOUTCACHE_TEST(name_) TEST_F(InputLayoutCacheTest, name_)
+
+INPUTLAYOUTCACHE_TEST(SharesLayoutForEqualRequests)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	ShaderSignature ^sameSignature = Signature(1);
+	InputLayoutCache cache(device.Device);
+
+	InputLayout ^layout = cache.Acquire(signature, PositionColor());
+	ASSERT_TRUE(layout == cache.Acquire(sameSignature, PositionColor()));
+	ASSERT_EQ(1, cache.Count);
+	ASSERT_EQ(1, cache.HitCount);
+	ASSERT_EQ(1, cache.MissCount);
+
+	delete sameSignature;
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(DifferentElementsOrSignatureMiss)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	ShaderSignature ^otherSignature = Signature(2);
+	InputLayoutCache cache(device.Device);
+
+	InputLayout ^layout = cache.Acquire(signature, PositionColor());
+	ASSERT_TRUE(layout != cache.Acquire(signature, PositionTexture()));
+	ASSERT_TRUE(layout != cache.Acquire(otherSignature, PositionColor()));
+	ASSERT_EQ(3, cache.Count);
+	ASSERT_EQ(0, cache.HitCount);
+	ASSERT_EQ(3, cache.MissCount);
+
+	delete otherSignature;
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(ReleaseDisposesOnLastReference)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	InputLayoutCache cache(device.Device);
+
+	InputLayout ^layout = cache.Acquire(signature, PositionColor());
+	cache.Acquire(signature, PositionColor());
+
+	ASSERT_TRUE(cache.Release(layout));
+	ASSERT_FALSE(layout->Disposed);
+	ASSERT_EQ(1, cache.Count);
+
+	ASSERT_TRUE(cache.Release(layout));
+	ASSERT_TRUE(layout->Disposed);
+	ASSERT_EQ(0, cache.Count);
+	ASSERT_FALSE(cache.Release(layout));
+
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(ReleaseIgnoresLayoutsItDidNotCreate)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	InputLayoutCache cache(device.Device);
+	InputLayout ^layout = gcnew InputLayout(device.Device, signature, PositionColor());
+
+	ASSERT_FALSE(cache.Release(layout));
+	ASSERT_FALSE(layout->Disposed);
+
+	delete layout;
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(ForgetsLayoutsDisposedDirectly)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	InputLayoutCache cache(device.Device);
+
+	InputLayout ^layout = cache.Acquire(signature, PositionColor());
+	delete layout;
+	ASSERT_EQ(0, cache.Count);
+
+	InputLayout ^recreated = cache.Acquire(signature, PositionColor());
+	ASSERT_FALSE(recreated->Disposed);
+	ASSERT_EQ(2, cache.MissCount);
+
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(ClearDisposesEveryLayout)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	InputLayoutCache cache(device.Device);
+
+	InputLayout ^first = cache.Acquire(signature, PositionColor());
+	InputLayout ^second = cache.Acquire(signature, PositionTexture());
+	cache.Acquire(signature, PositionTexture());
+
+	cache.Clear();
+	ASSERT_TRUE(first->Disposed);
+	ASSERT_TRUE(second->Disposed);
+	ASSERT_EQ(0, cache.Count);
+
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(DisposedCacheIgnoresRemovedObjects)
+{
+	ReferencedDevice device;
+	ShaderSignature ^signature = Signature(1);
+	InputLayoutCache ^cache = gcnew InputLayoutCache(device.Device);
+	InputLayout ^layout = cache->Acquire(signature, PositionColor());
+
+	delete cache;
+	ASSERT_TRUE(layout->Disposed);
+
+	// removing other layouts from the table must not reach the disposed cache
+	InputLayout ^other = gcnew InputLayout(device.Device, signature, PositionColor());
+	delete other;
+
+	delete signature;
+}
+
+INPUTLAYOUTCACHE_TEST(UndisposedCacheCanBeCollected)
+{
+	ReferencedDevice device;
+	WeakReference ^cache = CreateAbandonedCache(device.Device);
+
+	GC::Collect();
+	GC::WaitForPendingFinalizers();
+	ASSERT_FALSE(cache->IsAlive);
+
+	// the subscription left behind drops itself on the next removal
+	ShaderSignature ^signature = Signature(1);
+	InputLayout ^layout = gcnew InputLayout(device.Device, signature, PositionColor());
+	delete layout;
+
+	delete signature;
+}
@@ -0,0 +1,179 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+#include "ReferenceDeviceContext11.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+class ReferenceDeviceTest : public SlimDXTest
+{
+};
+
+#define REFERENCEDEVICE_TEST(name_) TEST_F(ReferenceDeviceTest, name_)
+
+static Buffer ^CreateDynamicVertexBuffer(SlimDX::Direct3D11::Device ^device, int sizeInBytes)
+{
+	return gcnew Buffer(device, BufferDescription(sizeInBytes, ResourceUsage::Dynamic, BindFlags::VertexBuffer,
+		CpuAccessFlags::Write, ResourceOptionFlags::None, 0));
+}
+
+REFERENCEDEVICE_TEST(CreateBuffer)
+{
+	ReferencedDevice device;
+	Buffer ^buffer = CreateDynamicVertexBuffer(device.Device, 64);
+	ASSERT_EQ(64, buffer->Description.SizeInBytes);
+	ASSERT_EQ(1u, device.Reference.GetStatistics().ResourcesCreated);
+	ASSERT_EQ(64u, device.Reference.GetStatistics().BytesAllocated);
+	delete buffer;
+}
+
+REFERENCEDEVICE_TEST(CreateBufferRejectsInvalidDescription)
+{
+	ReferencedDevice device;
+	ASSERT_MANAGED_THROW(gcnew Buffer(device.Device, BufferDescription(20, ResourceUsage::Default, BindFlags::ConstantBuffer,
+		CpuAccessFlags::None, ResourceOptionFlags::None, 0)), Direct3D11Exception);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().ResourcesCreated);
+}
+
+REFERENCEDEVICE_TEST(MapWritesIntoBuffer)
+{
+	ReferencedDevice device;
+	Buffer ^buffer = CreateDynamicVertexBuffer(device.Device, 16);
+
+	DataBox ^box = device.Context->MapSubresource(buffer, MapMode::WriteDiscard, MapFlags::None);
+	box->Data->Write(42.0f);
+	device.Context->UnmapSubresource(buffer, 0);
+
+	const ReferenceStatistics11 &statistics = device.Reference.GetStatistics();
+	ASSERT_EQ(1u, statistics.MapCalls);
+	ASSERT_EQ(1u, statistics.DiscardMapCalls);
+	ASSERT_EQ(16u, statistics.BytesUploaded);
+
+	ReferenceResource11 *storage = ReferenceResource11::FromResource(buffer->InternalPointer);
+	ASSERT_TRUE(storage != 0);
+	float value;
+	memcpy(&value, storage->GetData(0), sizeof(value));
+	ASSERT_EQ(42.0f, value);
+	ASSERT_FALSE(storage->IsMapped(0));
+	delete buffer;
+}
+
+REFERENCEDEVICE_TEST(MapRejectsReadOfDynamicBuffer)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	ReferencedDevice device;
+	Buffer ^buffer = CreateDynamicVertexBuffer(device.Device, 16);
+	ASSERT_TRUE(device.Context->MapSubresource(buffer, MapMode::Read, MapFlags::None) == nullptr);
+	AssertLastResultFailed();
+	delete buffer;
+}
+
+REFERENCEDEVICE_TEST(CountsRedundantStateAndDraws)
+{
+	ReferencedDevice device;
+	Buffer ^buffer = CreateDynamicVertexBuffer(device.Device, 48);
+	device.Reference.ResetStatistics();
+
+	device.Context->InputAssembler->PrimitiveTopology = PrimitiveTopology::TriangleList;
+	device.Context->InputAssembler->PrimitiveTopology = PrimitiveTopology::TriangleList;
+	device.Context->InputAssembler->SetVertexBuffers(0, VertexBufferBinding(buffer, 16, 0));
+	device.Context->Draw(3, 0);
+
+	const ReferenceStatistics11 &statistics = device.Reference.GetStatistics();
+	ASSERT_EQ(3u, statistics.StateCalls);
+	ASSERT_EQ(1u, statistics.RedundantStateCalls);
+	ASSERT_EQ(1u, statistics.DrawCalls);
+
+	ID3D11Buffer *bound = 0;
+	UINT stride = 0;
+	UINT offset = 0;
+	device.Reference.GetReferenceContext()->IAGetVertexBuffers(0, 1, &bound, &stride, &offset);
+	ASSERT_EQ(buffer->InternalPointer, bound);
+	ASSERT_EQ(16u, stride);
+	bound->Release();
+
+	device.Context->ClearState();
+	delete buffer;
+}
+
+REFERENCEDEVICE_TEST(RecordsCallStream)
+{
+	ReferencedDevice device;
+	device.Reference.SetRecording(true);
+
+	device.Context->InputAssembler->PrimitiveTopology = PrimitiveTopology::PointList;
+	device.Context->Draw(5, 2);
+
+	const std::vector<ReferenceCall11> &calls = device.Reference.GetCalls();
+	ASSERT_EQ(2u, calls.size());
+	ASSERT_STREQ("IASetPrimitiveTopology", calls[0].Method);
+	ASSERT_STREQ("Draw", calls[1].Method);
+	ASSERT_EQ(2u, calls[1].First);
+	ASSERT_EQ(5u, calls[1].Count);
+}
@@ -0,0 +1,215 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+class StateCacheTest : public SlimDXTest
+{
+protected:
+	static SamplerDescription Sampler(Filter filter)
+	{
+		SamplerDescription description;
+		description.Filter = filter;
+		description.AddressU = TextureAddressMode::Wrap;
+		description.AddressV = TextureAddressMode::Wrap;
+		description.AddressW = TextureAddressMode::Wrap;
+		description.MaximumLod = Single::MaxValue;
+		return description;
+	}
+
+	static WeakReference ^CreateAbandonedCache(SlimDX::Direct3D11::Device ^device)
+	{
+		return gcnew WeakReference(gcnew StateCache(device));
+	}
+};
+
+#define STATECACHE_TEST(name_) TEST_F(StateCacheTest, name_)
+
+STATECACHE_TEST(ReturnsSameStateForEqualDescriptions)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	SamplerState ^state = cache.GetSamplerState(Sampler(Filter::MinMagMipLinear));
+	ASSERT_TRUE(state == cache.GetSamplerState(Sampler(Filter::MinMagMipLinear)));
+	ASSERT_EQ(1, cache.Count);
+	ASSERT_EQ(1, cache.HitCount);
+	ASSERT_EQ(1, cache.MissCount);
+}
+
+STATECACHE_TEST(DifferentDescriptionsMiss)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	SamplerState ^linear = cache.GetSamplerState(Sampler(Filter::MinMagMipLinear));
+	ASSERT_TRUE(linear != cache.GetSamplerState(Sampler(Filter::MinMagMipPoint)));
+	ASSERT_EQ(2, cache.Count);
+	ASSERT_EQ(0, cache.HitCount);
+	ASSERT_EQ(2, cache.MissCount);
+}
+
+STATECACHE_TEST(HitsDoNotCallIntoTheDevice)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	// the reference device returns a new object for every creation call, each getting its own wrapper
+	cache.GetRasterizerState(RasterizerStateDescription());
+	int objects = ObjectTable::Objects->Count;
+	cache.GetRasterizerState(RasterizerStateDescription());
+	cache.GetRasterizerState(RasterizerStateDescription());
+
+	ASSERT_EQ(objects, ObjectTable::Objects->Count);
+	ASSERT_EQ(2, cache.HitCount);
+}
+
+STATECACHE_TEST(KeysDoNotAliasCallerArrays)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	BlendStateDescription description;
+	BlendState ^opaque = cache.GetBlendState(description);
+
+	// changing the caller's render target array must not change the cached key
+	description.RenderTargets[0].BlendEnable = true;
+	BlendState ^blended = cache.GetBlendState(description);
+
+	ASSERT_TRUE(opaque != blended);
+	ASSERT_TRUE(opaque == cache.GetBlendState(BlendStateDescription()));
+	ASSERT_EQ(2, cache.Count);
+}
+
+STATECACHE_TEST(CachesEachStateKindSeparately)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	cache.GetBlendState(BlendStateDescription());
+	cache.GetDepthStencilState(DepthStencilStateDescription());
+	cache.GetRasterizerState(RasterizerStateDescription());
+	cache.GetSamplerState(Sampler(Filter::MinMagMipPoint));
+
+	ASSERT_EQ(4, cache.Count);
+	ASSERT_EQ(4, cache.MissCount);
+}
+
+STATECACHE_TEST(ForgetsStatesDisposedDirectly)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	SamplerState ^state = cache.GetSamplerState(Sampler(Filter::MinMagMipLinear));
+	delete state;
+	ASSERT_EQ(0, cache.Count);
+
+	SamplerState ^recreated = cache.GetSamplerState(Sampler(Filter::MinMagMipLinear));
+	ASSERT_FALSE(recreated->Disposed);
+	ASSERT_EQ(2, cache.MissCount);
+}
+
+STATECACHE_TEST(ClearDisposesCreatedStatesAndResetsStatistics)
+{
+	ReferencedDevice device;
+	StateCache cache(device.Device);
+
+	BlendState ^blend = cache.GetBlendState(BlendStateDescription());
+	SamplerState ^sampler = cache.GetSamplerState(Sampler(Filter::MinMagMipPoint));
+	cache.GetSamplerState(Sampler(Filter::MinMagMipPoint));
+
+	cache.Clear();
+	ASSERT_TRUE(blend->Disposed);
+	ASSERT_TRUE(sampler->Disposed);
+	ASSERT_EQ(0, cache.Count);
+	ASSERT_EQ(0, cache.HitCount);
+	ASSERT_EQ(0, cache.MissCount);
+}
+
+STATECACHE_TEST(DisposeReleasesStates)
+{
+	ReferencedDevice device;
+	StateCache ^cache = gcnew StateCache(device.Device);
+	RasterizerState ^state = cache->GetRasterizerState(RasterizerStateDescription());
+
+	delete cache;
+	ASSERT_TRUE(state->Disposed);
+}
+
+STATECACHE_TEST(UndisposedCacheCanBeCollected)
+{
+	ReferencedDevice device;
+	WeakReference ^cache = CreateAbandonedCache(device.Device);
+
+	GC::Collect();
+	GC::WaitForPendingFinalizers();
+	ASSERT_FALSE(cache->IsAlive);
+
+	// the subscription left behind drops itself on the next removal
+	SamplerState ^state = SamplerState::FromDescription(device.Device, Sampler(Filter::MinMagMipPoint));
+	delete state;
+}
@@ -0,0 +1,353 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+#include "ReferenceDevice11.h"
+#include "ReferenceObjects11.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D11;
+
+ref class ReferencedDevice
+{
+public:
+	ReferencedDevice()
+		: reference(new ReferenceDevice11),
+		device(SlimDX::Direct3D11::Device::FromPointer(System::IntPtr(static_cast<ID3D11Device*>(reference)))),
+		context(device->ImmediateContext)
+	{
+	}
+	~ReferencedDevice()
+	{
+		delete context;
+		context = nullptr;
+		delete device;
+		device = nullptr;
+		reference->Release();
+		reference = 0;
+	}
+	property ReferenceDevice11 &Reference
+	{
+		ReferenceDevice11 &get() { return *reference; }
+	}
+	property SlimDX::Direct3D11::Device ^Device
+	{
+		SlimDX::Direct3D11::Device ^get() { return device; }
+	}
+	property DeviceContext ^Context
+	{
+		DeviceContext ^get() { return context; }
+	}
+
+private:
+	ReferenceDevice11 *reference;
+	SlimDX::Direct3D11::Device ^device;
+	DeviceContext ^context;
+};
+
+// Fails every read that reaches into the texture data, as a dropped network connection would.
+ref class FailingStream : public MemoryStream
+{
+public:
+	FailingStream(array<Byte> ^bytes, Int64 offset)
+		: MemoryStream(bytes), failAt(offset)
+	{
+	}
+
+	virtual int Read(array<Byte> ^buffer, int offset, int count) override
+	{
+		if (Position >= failAt)
+			throw gcnew IOException("The connection was lost.");
+		return MemoryStream::Read(buffer, offset, count);
+	}
+
+private:
+	Int64 failAt;
+};
+
+// A stream that can be read but not repositioned.
+ref class ForwardOnlyStream : public MemoryStream
+{
+public:
+	ForwardOnlyStream(array<Byte> ^bytes)
+		: MemoryStream(bytes)
+	{
+	}
+
+	virtual property bool CanSeek { bool get() override { return false; } }
+};
+
+static int const DataOffset = 148;
+
+static void Put(std::vector<unsigned char> &bytes, size_t offset, unsigned int value)
+{
+	for (int i = 0; i < 4; ++i)
+		bytes[offset + i] = static_cast<unsigned char>(value >> (i * 8));
+}
+
+static unsigned char LevelValue(int mipLevel, int arraySlice)
+{
+	return static_cast<unsigned char>(arraySlice * 16 + mipLevel + 1);
+}
+
+// An R8G8B8A8 file with an extended header, every byte of a subresource set to LevelValue.
+static array<Byte> ^BuildFile(int size, int mipLevels, int arraySize, bool cube, D3D11_RESOURCE_DIMENSION dimension)
+{
+	std::vector<unsigned char> bytes(DataOffset);
+	Put(bytes, 0, 'D' | ('D' << 8) | ('S' << 16) | (' ' << 24));
+	Put(bytes, 4, 124);
+	Put(bytes, 8, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000);
+	Put(bytes, 12, size);
+	Put(bytes, 16, size);
+	Put(bytes, 24, 1);
+	Put(bytes, 28, mipLevels);
+	Put(bytes, 76, 32);
+	Put(bytes, 80, 0x4);
+	Put(bytes, 84, 'D' | ('X' << 8) | ('1' << 16) | ('0' << 24));
+	Put(bytes, 108, 0x1000);
+	Put(bytes, 128, DXGI_FORMAT_R8G8B8A8_UNORM);
+	Put(bytes, 132, dimension);
+	Put(bytes, 136, cube ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0);
+	Put(bytes, 140, arraySize);
+
+	int slices = cube ? arraySize * 6 : arraySize;
+	for (int slice = 0; slice < slices; ++slice)
+	{
+		for (int level = 0; level < mipLevels; ++level)
+		{
+			int width = size >> level;
+			bytes.resize(bytes.size() + width * width * 4, LevelValue(level, slice));
+		}
+	}
+
+	array<Byte> ^result = gcnew array<Byte>(static_cast<int>(bytes.size()));
+	pin_ptr<Byte> pinnedResult = &result[0];
+	memcpy(pinnedResult, &bytes[0], bytes.size());
+	return result;
+}
+
+static array<Byte> ^BuildFile(int size, int mipLevels)
+{
+	return BuildFile(size, mipLevels, 1, false, D3D11_RESOURCE_DIMENSION_TEXTURE2D);
+}
+
+class TextureStreamerTest : public SlimDXTest
+{
+protected:
+	static void AssertLevel(Texture2D ^texture, int mipLevel, int arraySlice, int mipLevels)
+	{
+		ReferenceResource11 *storage = ReferenceResource11::FromResource(texture->InternalPointer);
+		ASSERT_TRUE(storage != 0);
+
+		UINT subresource = D3D11CalcSubresource(mipLevel, arraySlice, mipLevels);
+		const unsigned char *data = storage->GetData(subresource);
+		for (UINT i = 0; i < storage->GetSize(subresource); ++i)
+			ASSERT_EQ(LevelValue(mipLevel, arraySlice), data[i]);
+	}
+};
+
+#define TEXTURESTREAMER_TEST(name_) TEST_F(TextureStreamerTest, name_)
+
+TEXTURESTREAMER_TEST(LoadsMipTailThenOneLevelPerCall)
+{
+	ReferencedDevice device;
+	MemoryStream stream(BuildFile(256, 9));
+	TextureStreamer streamer(device.Device, %stream);
+	Texture2D ^texture = streamer.Texture;
+	ASSERT_EQ(9, texture->Description.MipLevels);
+	ASSERT_EQ(9, streamer.ResidentMipLevel);
+	ASSERT_FALSE(streamer.IsComplete);
+	device.Reference.ResetStatistics();
+
+	// levels 2 to 8 add up to less than 64 KB; level 1 alone is 64 KB and waits for the next call
+	ASSERT_TRUE(streamer.LoadNext(device.Context));
+	ASSERT_EQ(2, streamer.ResidentMipLevel);
+	ASSERT_EQ(7u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+	ASSERT_EQ(2.0f, device.Context->GetMinimumLod(texture));
+	for (int level = 2; level < 9; ++level)
+		AssertLevel(texture, level, 0, 9);
+
+	ASSERT_TRUE(streamer.LoadNext(device.Context));
+	ASSERT_EQ(1, streamer.ResidentMipLevel);
+	ASSERT_EQ(8u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+	ASSERT_EQ(1.0f, device.Context->GetMinimumLod(texture));
+	AssertLevel(texture, 1, 0, 9);
+
+	ASSERT_FALSE(streamer.LoadNext(device.Context));
+	ASSERT_TRUE(streamer.IsComplete);
+	ASSERT_EQ(0, streamer.ResidentMipLevel);
+	ASSERT_EQ(0.0f, device.Context->GetMinimumLod(texture));
+	AssertLevel(texture, 0, 0, 9);
+	ASSERT_EQ(349524u, device.Reference.GetStatistics().BytesUploaded);
+
+	// nothing is left to upload
+	ASSERT_FALSE(streamer.LoadNext(device.Context));
+	ASSERT_EQ(9u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+
+	delete texture;
+}
+
+TEXTURESTREAMER_TEST(LoadNextStaysWithinBudget)
+{
+	ReferencedDevice device;
+	MemoryStream stream(BuildFile(64, 7));
+	TextureStreamer streamer(device.Device, %stream);
+	Texture2D ^texture = streamer.Texture;
+
+	// at least one level is always uploaded, even when it is larger than the budget
+	ASSERT_TRUE(streamer.LoadNext(device.Context, 1));
+	ASSERT_EQ(6, streamer.ResidentMipLevel);
+
+	// 16 + 64 + 256 bytes fit; the 1 KB level does not
+	ASSERT_TRUE(streamer.LoadNext(device.Context, 400));
+	ASSERT_EQ(3, streamer.ResidentMipLevel);
+	ASSERT_EQ(3.0f, device.Context->GetMinimumLod(texture));
+
+	streamer.LoadAll(device.Context);
+	ASSERT_TRUE(streamer.IsComplete);
+	for (int level = 0; level < 7; ++level)
+		AssertLevel(texture, level, 0, 7);
+
+	delete texture;
+}
+
+TEXTURESTREAMER_TEST(LoadsEveryFaceOfCubeMap)
+{
+	ReferencedDevice device;
+	MemoryStream stream(BuildFile(8, 4, 1, true, D3D11_RESOURCE_DIMENSION_TEXTURE2D));
+	TextureStreamer streamer(device.Device, %stream);
+	Texture2D ^texture = streamer.Texture;
+	ASSERT_EQ(6, texture->Description.ArraySize);
+	ASSERT_EQ(static_cast<int>(ResourceOptionFlags::TextureCube), static_cast<int>(texture->Description.OptionFlags));
+	device.Reference.ResetStatistics();
+
+	streamer.LoadAll(device.Context);
+	ASSERT_TRUE(streamer.IsComplete);
+	ASSERT_EQ(24u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+	for (int face = 0; face < 6; ++face)
+	{
+		for (int level = 0; level < 4; ++level)
+			AssertLevel(texture, level, face, 4);
+	}
+
+	delete texture;
+}
+
+TEXTURESTREAMER_TEST(LoadsFromMappedFile)
+{
+	String ^fileName = Path::GetTempFileName();
+	File::WriteAllBytes(fileName, BuildFile(32, 6));
+
+	ReferencedDevice device;
+	TextureStreamer ^streamer = gcnew TextureStreamer(device.Device, fileName);
+	Texture2D ^texture = streamer->Texture;
+	ASSERT_EQ(32, streamer->File->Width);
+
+	streamer->LoadAll(device.Context);
+	ASSERT_TRUE(streamer->IsComplete);
+	for (int level = 0; level < 6; ++level)
+		AssertLevel(texture, level, 0, 6);
+
+	// a complete load has already released the mapping
+	File::Delete(fileName);
+	ASSERT_FALSE(File::Exists(fileName));
+
+	delete streamer;
+	delete texture;
+}
+
+TEXTURESTREAMER_TEST(ReadFailureSurfacesAsIOException)
+{
+	ReferencedDevice device;
+	FailingStream stream(BuildFile(16, 5), DataOffset);
+	TextureStreamer streamer(device.Device, %stream);
+	Texture2D ^texture = streamer.Texture;
+
+	try
+	{
+		streamer.LoadNext(device.Context);
+		FAIL() << "Expected an IOException.";
+	}
+	catch (IOException ^e)
+	{
+		ASSERT_TRUE(e->InnerException != nullptr);
+		ASSERT_EQ(gcnew String(L"The connection was lost."), e->InnerException->Message);
+	}
+	ASSERT_EQ(5, streamer.ResidentMipLevel);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().UpdateSubresourceCalls);
+
+	delete texture;
+}
+
+TEXTURESTREAMER_TEST(LoadAfterDisposeThrows)
+{
+	ReferencedDevice device;
+	MemoryStream stream(BuildFile(256, 9));
+	TextureStreamer ^streamer = gcnew TextureStreamer(device.Device, %stream);
+	Texture2D ^texture = streamer->Texture;
+	ASSERT_TRUE(streamer->LoadNext(device.Context));
+
+	delete streamer;
+	ASSERT_MANAGED_THROW(streamer->LoadNext(device.Context), ObjectDisposedException);
+
+	delete texture;
+}
+
+TEXTURESTREAMER_TEST(RejectsUnsupportedSources)
+{
+	ReferencedDevice device;
+	TextureStreamer ^streamer = nullptr;
+
+	MemoryStream volume(BuildFile(4, 1, 1, false, D3D11_RESOURCE_DIMENSION_TEXTURE3D));
+	ASSERT_MANAGED_THROW(streamer = gcnew TextureStreamer(device.Device, %volume), NotSupportedException);
+
+	ForwardOnlyStream forwardOnly(BuildFile(4, 1));
+	ASSERT_MANAGED_THROW(streamer = gcnew TextureStreamer(device.Device, %forwardOnly), ArgumentException);
+
+	ASSERT_TRUE(streamer == nullptr);
+	ASSERT_EQ(0u, device.Reference.GetStatistics().ResourcesCreated);
+}
+
+TEXTURESTREAMER_TEST(RejectsNullArguments)
+{
+	ReferencedDevice device;
+	MemoryStream stream(BuildFile(4, 1));
+	TextureStreamer ^streamer = nullptr;
+
+	ASSERT_MANAGED_THROW(streamer = gcnew TextureStreamer(nullptr, %stream), ArgumentNullException);
+	ASSERT_MANAGED_THROW(streamer = gcnew TextureStreamer(device.Device, static_cast<Stream^>(nullptr)), ArgumentNullException);
+	ASSERT_MANAGED_THROW(streamer = gcnew TextureStreamer(device.Device, static_cast<String^>(nullptr)), ArgumentNullException);
+
+	streamer = gcnew TextureStreamer(device.Device, %stream);
+	Texture2D ^texture = streamer->Texture;
+	ASSERT_MANAGED_THROW(streamer->LoadNext(nullptr), ArgumentNullException);
+
+	delete streamer;
+	delete texture;
+}
@@ -0,0 +1,400 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+#include "RecordingDevice9.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D9;
+
+class CommandBufferTest : public SlimDXTest
+{
+};
+
+#define COMMANDBUFFER_TEST(name_) TEST_F(CommandBufferTest, name_)
+
+template <size_t N>
+static void AssertCall(const RecordedCall9 &call, const char *method, const UINT_PTR (&arguments)[N])
+{
+	ASSERT_EQ(std::string(method), call.Method);
+	ASSERT_EQ(std::vector<UINT_PTR>(arguments, arguments + N), call.Arguments);
+}
+
+static UINT_PTR Address(const void *object)
+{
+	return reinterpret_cast<UINT_PTR>(object);
+}
+
+COMMANDBUFFER_TEST(RecordsWithoutCallingDevice)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	buffer->SetRenderState(RenderState::ZEnable, true);
+	buffer->SetSamplerState(0, SamplerState::MinFilter, TextureFilter::Linear);
+	buffer->DrawPrimitives(PrimitiveType::TriangleList, 0, 2);
+
+	ASSERT_EQ(3, buffer->CommandCount);
+	ASSERT_EQ((3 + 4 + 4) * 4, buffer->SizeInBytes);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+
+	buffer->Reset();
+	ASSERT_EQ(0, buffer->CommandCount);
+	ASSERT_EQ(0, buffer->SizeInBytes);
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(ExecuteReplaysInOrder)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	buffer->SetRenderState(RenderState::ZEnable, true);
+	buffer->SetSamplerState(0, SamplerState::MinFilter, TextureFilter::Linear);
+	buffer->SetVertexFormat(VertexFormat::Position);
+	buffer->SetViewport(Viewport(1, 2, 64, 32));
+	buffer->SetScissorRect(Drawing::Rectangle(4, 8, 16, 16));
+	buffer->DrawPrimitives(PrimitiveType::TriangleList, 3, 2);
+	buffer->DrawIndexedPrimitives(PrimitiveType::TriangleStrip, -1, 2, 6, 9, 4);
+
+	ASSERT_TRUE(buffer->Execute(device.Device).IsSuccess);
+	ASSERT_EQ(0, buffer->SkippedCommandCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(7u, calls.size());
+
+	UINT_PTR renderState[] = { D3DRS_ZENABLE, TRUE };
+	AssertCall(calls[0], "SetRenderState", renderState);
+	UINT_PTR samplerState[] = { 0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR };
+	AssertCall(calls[1], "SetSamplerState", samplerState);
+	UINT_PTR fvf[] = { D3DFVF_XYZ };
+	AssertCall(calls[2], "SetFVF", fvf);
+
+	ASSERT_EQ(std::string("SetViewport"), calls[3].Method);
+	ASSERT_EQ(sizeof(D3DVIEWPORT9), calls[3].Data.size());
+	const D3DVIEWPORT9 &viewport = *reinterpret_cast<const D3DVIEWPORT9 *>(&calls[3].Data[0]);
+	ASSERT_EQ(1u, viewport.X);
+	ASSERT_EQ(2u, viewport.Y);
+	ASSERT_EQ(64u, viewport.Width);
+	ASSERT_EQ(32u, viewport.Height);
+
+	ASSERT_EQ(std::string("SetScissorRect"), calls[4].Method);
+	ASSERT_EQ(sizeof(RECT), calls[4].Data.size());
+	const RECT &rect = *reinterpret_cast<const RECT *>(&calls[4].Data[0]);
+	ASSERT_EQ(4, rect.left);
+	ASSERT_EQ(8, rect.top);
+	ASSERT_EQ(20, rect.right);
+	ASSERT_EQ(24, rect.bottom);
+
+	UINT_PTR draw[] = { D3DPT_TRIANGLELIST, 3, 2 };
+	AssertCall(calls[5], "DrawPrimitive", draw);
+	UINT_PTR drawIndexed[] = { D3DPT_TRIANGLESTRIP, static_cast<UINT_PTR>(-1), 2, 6, 9, 4 };
+	AssertCall(calls[6], "DrawIndexedPrimitive", drawIndexed);
+
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(ExecuteSkipsRedundantState)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	buffer->SetRenderState(RenderState::CullMode, 1);
+	buffer->SetRenderState(RenderState::CullMode, 1);
+	buffer->SetRenderState(RenderState::Lighting, false);
+	buffer->SetRenderState(RenderState::CullMode, 3);
+	buffer->SetSamplerState(1, SamplerState::MinFilter, TextureFilter::Linear);
+	buffer->SetSamplerState(1, SamplerState::MinFilter, TextureFilter::Linear);
+	buffer->SetVertexFormat(VertexFormat::Position);
+	buffer->SetVertexFormat(VertexFormat::Position);
+	buffer->SetScissorRect(Drawing::Rectangle(0, 0, 8, 8));
+	buffer->SetScissorRect(Drawing::Rectangle(0, 0, 8, 8));
+	buffer->DrawPrimitives(PrimitiveType::TriangleList, 0, 1);
+	buffer->DrawPrimitives(PrimitiveType::TriangleList, 0, 1);
+
+	ASSERT_TRUE(buffer->Execute(device.Device).IsSuccess);
+	ASSERT_EQ(4, buffer->SkippedCommandCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(8u, calls.size());
+	UINT_PTR cullNone[] = { D3DRS_CULLMODE, 1 };
+	AssertCall(calls[0], "SetRenderState", cullNone);
+	UINT_PTR lighting[] = { D3DRS_LIGHTING, FALSE };
+	AssertCall(calls[1], "SetRenderState", lighting);
+	UINT_PTR cullCcw[] = { D3DRS_CULLMODE, 3 };
+	AssertCall(calls[2], "SetRenderState", cullCcw);
+	ASSERT_EQ(std::string("SetSamplerState"), calls[3].Method);
+	ASSERT_EQ(std::string("SetFVF"), calls[4].Method);
+	ASSERT_EQ(std::string("SetScissorRect"), calls[5].Method);
+	ASSERT_EQ(std::string("DrawPrimitive"), calls[6].Method);
+	ASSERT_EQ(std::string("DrawPrimitive"), calls[7].Method);
+
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(ExecuteSharesShadowStateAcrossBuffersInOneCall)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^first = gcnew CommandBuffer();
+	first->SetRenderState(RenderState::CullMode, 1);
+	CommandBuffer ^second = gcnew CommandBuffer();
+	second->SetRenderState(RenderState::CullMode, 1);
+	second->SetRenderState(RenderState::Lighting, true);
+
+	ASSERT_TRUE(CommandBuffer::Execute(device.Device, gcnew array<CommandBuffer ^> { first, second }).IsSuccess);
+	ASSERT_EQ(0, first->SkippedCommandCount);
+	ASSERT_EQ(1, second->SkippedCommandCount);
+	ASSERT_EQ(2u, device.Recording.GetCalls().size());
+
+	// Each call starts from unknown device state, so nothing is skipped the second time round.
+	device.Recording.ClearCalls();
+	ASSERT_TRUE(second->Execute(device.Device).IsSuccess);
+	ASSERT_EQ(0, second->SkippedCommandCount);
+	ASSERT_EQ(2u, device.Recording.GetCalls().size());
+
+	delete first;
+	delete second;
+}
+
+COMMANDBUFFER_TEST(ExecuteAlwaysReplaysConstantsTransformsClearsAndDraws)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	Matrix world = Matrix::Translation(1.0f, 2.0f, 3.0f);
+	for (int i = 0; i < 2; ++i)
+	{
+		buffer->SetVertexShaderConstant(0, world);
+		buffer->SetTransform(TransformState::World, world);
+		buffer->Clear(ClearFlags::Target, 0x11223344, 0.5f, 7);
+		buffer->DrawPrimitives(PrimitiveType::TriangleList, 0, 1);
+	}
+
+	ASSERT_TRUE(buffer->Execute(device.Device).IsSuccess);
+	ASSERT_EQ(0, buffer->SkippedCommandCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(8u, calls.size());
+
+	UINT_PTR constants[] = { 0, 4 };
+	AssertCall(calls[4], "SetVertexShaderConstantF", constants);
+	ASSERT_EQ(sizeof(Matrix), calls[4].Data.size());
+	ASSERT_EQ(0, memcmp(&world, &calls[4].Data[0], sizeof(Matrix)));
+
+	UINT_PTR transform[] = { D3DTS_WORLD };
+	AssertCall(calls[5], "SetTransform", transform);
+	ASSERT_EQ(0, memcmp(&world, &calls[5].Data[0], sizeof(Matrix)));
+
+	float z = 0.5f;
+	UINT_PTR clear[] = { 0, D3DCLEAR_TARGET, 0x11223344, *reinterpret_cast<DWORD *>(&z), 7 };
+	AssertCall(calls[6], "Clear", clear);
+	ASSERT_TRUE(calls[6].Data.empty());
+
+	ASSERT_EQ(std::string("DrawPrimitive"), calls[7].Method);
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(ConstantsAreCopiedWhenRecorded)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	array<float> ^data = gcnew array<float> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+	buffer->SetPixelShaderConstant(3, data, 4, 2);
+	data[4] = 100.0f;
+
+	ASSERT_TRUE(buffer->Execute(device.Device).IsSuccess);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(1u, calls.size());
+	UINT_PTR constants[] = { 3, 2 };
+	AssertCall(calls[0], "SetPixelShaderConstantF", constants);
+
+	const float *registers = device.Recording.GetPixelShaderConstants();
+	for (int i = 0; i < 8; ++i)
+		ASSERT_EQ(static_cast<float>(i + 5), registers[3 * 4 + i]);
+
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(StreamSourceRedundancyComparesBufferOffsetAndStride)
+{
+	WrappedRecordingDevice9 device;
+	VertexBuffer ^vertices = gcnew VertexBuffer(device.Device, 256, Usage::None, VertexFormat::None, Pool::Managed);
+	device.Recording.ClearCalls();
+
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	buffer->SetStreamSource(0, vertices, 0, 16);
+	buffer->SetStreamSource(0, vertices, 0, 16);
+	buffer->SetStreamSource(0, vertices, 64, 16);
+	buffer->SetStreamSource(0, vertices, 64, 32);
+	buffer->SetStreamSource(1, vertices, 64, 32);
+	buffer->SetStreamSource(0, nullptr, 0, 0);
+
+	ASSERT_TRUE(buffer->Execute(device.Device).IsSuccess);
+	ASSERT_EQ(1, buffer->SkippedCommandCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(5u, calls.size());
+	UINT_PTR first[] = { 0, Address(vertices->InternalPointer), 0, 16 };
+	AssertCall(calls[0], "SetStreamSource", first);
+	UINT_PTR offset[] = { 0, Address(vertices->InternalPointer), 64, 16 };
+	AssertCall(calls[1], "SetStreamSource", offset);
+	UINT_PTR stride[] = { 0, Address(vertices->InternalPointer), 64, 32 };
+	AssertCall(calls[2], "SetStreamSource", stride);
+	UINT_PTR stream[] = { 1, Address(vertices->InternalPointer), 64, 32 };
+	AssertCall(calls[3], "SetStreamSource", stream);
+	UINT_PTR unbind[] = { 0, 0, 0, 0 };
+	AssertCall(calls[4], "SetStreamSource", unbind);
+
+	delete buffer;
+	delete vertices;
+}
+
+COMMANDBUFFER_TEST(RecordedObjectsAreHeldUntilReset)
+{
+	WrappedRecordingDevice9 device;
+	VertexBuffer ^vertices = gcnew VertexBuffer(device.Device, 64, Usage::None, VertexFormat::None, Pool::Managed);
+	IndexBuffer ^indices = gcnew IndexBuffer(device.Device, 64, Usage::None, Pool::Managed, true);
+	ASSERT_EQ(2, device.Recording.GetLiveBufferCount());
+
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	buffer->SetStreamSource(0, vertices, 0, 16);
+	buffer->SetIndices(indices);
+	delete vertices;
+	delete indices;
+	ASSERT_EQ(2, device.Recording.GetLiveBufferCount());
+
+	buffer->Reset();
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+
+	IndexBuffer ^moreIndices = gcnew IndexBuffer(device.Device, 64, Usage::None, Pool::Managed, false);
+	buffer->SetIndices(moreIndices);
+	delete moreIndices;
+	ASSERT_EQ(1, device.Recording.GetLiveBufferCount());
+
+	delete buffer;
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+}
+
+COMMANDBUFFER_TEST(SamplerSlotsCoverVertexTexturesOnly)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	buffer->SetSamplerState(D3DVERTEXTEXTURESAMPLER0, SamplerState::MinFilter, TextureFilter::Point);
+	buffer->SetSamplerState(D3DVERTEXTEXTURESAMPLER0, SamplerState::MinFilter, TextureFilter::Point);
+	buffer->SetSamplerState(300, SamplerState::MinFilter, TextureFilter::Point);
+	buffer->SetSamplerState(300, SamplerState::MinFilter, TextureFilter::Point);
+	buffer->SetRenderState(static_cast<RenderState>(300), 1);
+	buffer->SetRenderState(static_cast<RenderState>(300), 1);
+
+	ASSERT_TRUE(buffer->Execute(device.Device).IsSuccess);
+	ASSERT_EQ(1, buffer->SkippedCommandCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(5u, calls.size());
+	UINT_PTR vertexSampler[] = { D3DVERTEXTEXTURESAMPLER0, D3DSAMP_MINFILTER, D3DTEXF_POINT };
+	AssertCall(calls[0], "SetSamplerState", vertexSampler);
+	UINT_PTR unknownSampler[] = { 300, D3DSAMP_MINFILTER, D3DTEXF_POINT };
+	AssertCall(calls[1], "SetSamplerState", unknownSampler);
+	AssertCall(calls[2], "SetSamplerState", unknownSampler);
+
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(ExecuteStopsAtFirstFailure)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	WrappedRecordingDevice9 device;
+	device.Recording.FailCalls("SetFVF", D3DERR_INVALIDCALL);
+
+	CommandBuffer ^first = gcnew CommandBuffer();
+	first->SetRenderState(RenderState::CullMode, 1);
+	first->SetRenderState(RenderState::CullMode, 1);
+	first->SetVertexFormat(VertexFormat::Position);
+	first->DrawPrimitives(PrimitiveType::TriangleList, 0, 1);
+	CommandBuffer ^second = gcnew CommandBuffer();
+	second->DrawPrimitives(PrimitiveType::TriangleList, 0, 1);
+
+	Result result = CommandBuffer::Execute(device.Device, gcnew array<CommandBuffer ^> { first, second });
+	ASSERT_TRUE(result.IsFailure);
+	ASSERT_EQ(D3DERR_INVALIDCALL, result.Code);
+	ASSERT_EQ(1, first->SkippedCommandCount);
+	ASSERT_EQ(0, second->SkippedCommandCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(2u, calls.size());
+	ASSERT_EQ(std::string("SetRenderState"), calls[0].Method);
+	ASSERT_EQ(std::string("SetFVF"), calls[1].Method);
+
+	delete first;
+	delete second;
+}
+
+COMMANDBUFFER_TEST(ExecuteWithNoBuffersDoesNothing)
+{
+	WrappedRecordingDevice9 device;
+	ASSERT_TRUE(CommandBuffer::Execute(device.Device, gcnew array<CommandBuffer ^>(0)).IsSuccess);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+}
+
+COMMANDBUFFER_TEST(RejectsInvalidArguments)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	Result result;
+
+	ASSERT_MANAGED_THROW(result = buffer->Execute(nullptr), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = CommandBuffer::Execute(device.Device, nullptr), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = CommandBuffer::Execute(device.Device, gcnew array<CommandBuffer ^> { buffer, nullptr }), ArgumentException);
+
+	array<float> ^data = gcnew array<float>(4);
+	ASSERT_MANAGED_THROW(buffer->SetVertexShaderConstant(0, data, 0, 2), ArgumentException);
+	ASSERT_MANAGED_THROW(buffer->SetVertexShaderConstant(0, data, -1, 1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(buffer->SetPixelShaderConstant(0, gcnew array<Vector4>(2), 1, 2), ArgumentException);
+	ASSERT_EQ(0, buffer->CommandCount);
+
+	delete buffer;
+}
+
+COMMANDBUFFER_TEST(ThrowsWhenDisposed)
+{
+	WrappedRecordingDevice9 device;
+	CommandBuffer ^buffer = gcnew CommandBuffer();
+	CommandBuffer ^disposed = gcnew CommandBuffer();
+	delete disposed;
+	Result result;
+	int count;
+
+	ASSERT_MANAGED_THROW(disposed->SetRenderState(RenderState::CullMode, 1), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(disposed->DrawPrimitives(PrimitiveType::TriangleList, 0, 1), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(disposed->Reset(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(count = disposed->CommandCount, ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = disposed->Execute(device.Device), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = CommandBuffer::Execute(device.Device, gcnew array<CommandBuffer ^> { buffer, disposed }), ObjectDisposedException);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+
+	delete buffer;
+}
@@ -0,0 +1,349 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D9;
+
+// An 8 by 8 quad grid over 81 vertices in the xy plane, either flat or bowl shaped.
+static const int GridSize = 8;
+static const int GridVertexCount = (GridSize + 1) * (GridSize + 1);
+static const int GridFaceCount = GridSize * GridSize * 2;
+
+static std::vector<float> BuildGridPositions(bool curved)
+{
+	std::vector<float> positions;
+	for (int y = 0; y <= GridSize; ++y)
+	{
+		for (int x = 0; x <= GridSize; ++x)
+		{
+			float dx = static_cast<float>(x - GridSize / 2);
+			float dy = static_cast<float>(y - GridSize / 2);
+			positions.push_back(static_cast<float>(x));
+			positions.push_back(static_cast<float>(y));
+			positions.push_back(curved ? 0.1f * (dx * dx + dy * dy) : 0.0f);
+		}
+	}
+
+	return positions;
+}
+
+static std::vector<unsigned short> BuildGridIndices()
+{
+	std::vector<unsigned short> indices;
+	for (int y = 0; y < GridSize; ++y)
+	{
+		for (int x = 0; x < GridSize; ++x)
+		{
+			unsigned short a = static_cast<unsigned short>(y * (GridSize + 1) + x);
+			unsigned short b = static_cast<unsigned short>(a + 1);
+			unsigned short c = static_cast<unsigned short>(a + GridSize + 1);
+			unsigned short d = static_cast<unsigned short>(c + 1);
+			unsigned short quad[] = { a, b, c, c, b, d };
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+
+	return indices;
+}
+
+static std::set<int> DistinctVertices(array<int> ^level)
+{
+	std::set<int> vertices;
+	for (int i = 0; i < level->Length; ++i)
+		vertices.insert(level[i]);
+	return vertices;
+}
+
+static bool LevelsEqual(array<int> ^left, array<int> ^right)
+{
+	if (left->Length != right->Length)
+		return false;
+
+	for (int i = 0; i < left->Length; ++i)
+	{
+		if (left[i] != right[i])
+			return false;
+	}
+
+	return true;
+}
+
+class MeshSimplifierTest : public SlimDXTest
+{
+protected:
+	virtual void SetUp()
+	{
+		m_Parallelism = MeshSimplifier::MaximumDegreeOfParallelism;
+		m_Positions = BuildGridPositions(false);
+		m_Indices = BuildGridIndices();
+	}
+
+	virtual void TearDown()
+	{
+		MeshSimplifier::MaximumDegreeOfParallelism = m_Parallelism;
+		SlimDXTest::TearDown();
+	}
+
+	template <typename T>
+	static DataStream ^ToStream(const std::vector<T> &values)
+	{
+		DataStream ^stream = gcnew DataStream(static_cast<Int64>(values.size() * sizeof(T)), true, true);
+		memcpy(stream->DataPointer.ToPointer(), &values[0], values.size() * sizeof(T));
+		return stream;
+	}
+
+	static array<VertexElement> ^PositionElements()
+	{
+		array<VertexElement> ^elements =
+		{
+			VertexElement(0, 0, DeclarationType::Float3, DeclarationMethod::Default, DeclarationUsage::Position, 0),
+			VertexElement::VertexDeclarationEnd
+		};
+		return elements;
+	}
+
+	static MeshSimplifier ^CreateGrid(bool curved)
+	{
+		DataStream ^vertices = ToStream(BuildGridPositions(curved));
+		DataStream ^indices = ToStream(BuildGridIndices());
+		MeshSimplifier ^simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, PositionElements(), indices, GridFaceCount, false);
+		delete indices;
+		delete vertices;
+		return simplifier;
+	}
+
+	// Every face keeps the counter clockwise winding of the grid when seen from +z, and no face collapses to a line.
+	void AssertFacesUpright(array<int> ^level, bool curved)
+	{
+		std::vector<float> positions = BuildGridPositions(curved);
+		ASSERT_EQ(0, level->Length % 3);
+		for (int i = 0; i < level->Length; i += 3)
+		{
+			const float *a = &positions[level[i] * 3];
+			const float *b = &positions[level[i + 1] * 3];
+			const float *c = &positions[level[i + 2] * 3];
+			float area = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+			ASSERT_GT(area, 0.0f);
+		}
+	}
+
+	void AssertNestedLevels(array<array<int>^> ^levels, array<float> ^errors)
+	{
+		ASSERT_EQ(levels->Length, errors->Length);
+		for (int i = 1; i < levels->Length; ++i)
+		{
+			std::set<int> previous = DistinctVertices(levels[i - 1]);
+			std::set<int> current = DistinctVertices(levels[i]);
+			ASSERT_TRUE(std::includes(previous.begin(), previous.end(), current.begin(), current.end()));
+			ASSERT_LE(levels[i]->Length, levels[i - 1]->Length);
+			ASSERT_GE(errors[i], errors[i - 1]);
+		}
+	}
+
+	int m_Parallelism;
+	std::vector<float> m_Positions;
+	std::vector<unsigned short> m_Indices;
+};
+
+TEST_F(MeshSimplifierTest, Construct)
+{
+	MeshSimplifier ^simplifier = CreateGrid(false);
+	ASSERT_EQ(GridFaceCount, simplifier->FaceCount);
+	ASSERT_EQ(GridVertexCount, simplifier->VertexCount);
+	delete simplifier;
+}
+
+TEST_F(MeshSimplifierTest, FlatGridFaceTargets)
+{
+	MeshSimplifier ^simplifier = CreateGrid(false);
+	array<int> ^targets = { 64, 16, 2 };
+	array<float> ^errors;
+	array<array<int>^> ^levels = simplifier->GenerateLodChain(targets, MeshSimplification::Face, errors);
+
+	ASSERT_EQ(3, levels->Length);
+	for (int i = 0; i < levels->Length; ++i)
+	{
+		ASSERT_EQ(targets[i] * 3, levels[i]->Length);
+		AssertFacesUpright(levels[i], false);
+	}
+
+	// collapses within the plane cost nothing until the outline itself has to change
+	ASSERT_NEAR(0.0f, errors[0], 1e-4f);
+	ASSERT_NEAR(0.0f, errors[1], 1e-4f);
+	ASSERT_GT(errors[2], 1.0f);
+	AssertNestedLevels(levels, errors);
+
+	// the corners define the outline
+	std::set<int> corners = DistinctVertices(levels[1]);
+	ASSERT_EQ(1U, corners.count(0));
+	ASSERT_EQ(1U, corners.count(GridSize));
+	ASSERT_EQ(1U, corners.count(GridVertexCount - GridSize - 1));
+	ASSERT_EQ(1U, corners.count(GridVertexCount - 1));
+
+	delete simplifier;
+}
+
+TEST_F(MeshSimplifierTest, CurvedGridFaceTargets)
+{
+	MeshSimplifier ^simplifier = CreateGrid(true);
+	array<int> ^targets = { 64, 16, 2 };
+	array<float> ^errors;
+	array<array<int>^> ^levels = simplifier->GenerateLodChain(targets, MeshSimplification::Face, errors);
+
+	ASSERT_EQ(3, levels->Length);
+	for (int i = 0; i < levels->Length; ++i)
+	{
+		ASSERT_EQ(targets[i] * 3, levels[i]->Length);
+		AssertFacesUpright(levels[i], true);
+	}
+
+	ASSERT_GT(errors[0], 0.0f);
+	AssertNestedLevels(levels, errors);
+
+	delete simplifier;
+}
+
+TEST_F(MeshSimplifierTest, VertexTargets)
+{
+	array<int> ^targets = { 40, 12, 4 };
+	for (int shape = 0; shape < 2; ++shape)
+	{
+		bool curved = shape != 0;
+		MeshSimplifier ^simplifier = CreateGrid(curved);
+		array<float> ^errors;
+		array<array<int>^> ^levels = simplifier->GenerateLodChain(targets, MeshSimplification::Vertex, errors);
+
+		ASSERT_EQ(3, levels->Length);
+		for (int i = 0; i < levels->Length; ++i)
+		{
+			ASSERT_EQ(static_cast<size_t>(targets[i]), DistinctVertices(levels[i]).size());
+			AssertFacesUpright(levels[i], curved);
+		}
+		AssertNestedLevels(levels, errors);
+
+		delete simplifier;
+	}
+}
+
+TEST_F(MeshSimplifierTest, TargetAboveCountKeepsMesh)
+{
+	MeshSimplifier ^simplifier = CreateGrid(true);
+	array<int> ^targets = { GridFaceCount + 72 };
+	array<float> ^errors;
+	array<array<int>^> ^levels = simplifier->GenerateLodChain(targets, MeshSimplification::Face, errors);
+
+	ASSERT_EQ(1, levels->Length);
+	ASSERT_EQ(static_cast<int>(m_Indices.size()), levels[0]->Length);
+	for (int i = 0; i < levels[0]->Length; ++i)
+		ASSERT_EQ(static_cast<int>(m_Indices[i]), levels[0][i]);
+	ASSERT_EQ(0.0f, errors[0]);
+
+	delete simplifier;
+}
+
+TEST_F(MeshSimplifierTest, GenerateLodChainsMatchesSingleChains)
+{
+	array<MeshSimplifier^> ^simplifiers = { CreateGrid(false), CreateGrid(true), CreateGrid(true) };
+	array<float> ^ratios = { 0.5f, 0.125f };
+	array<int> ^targets = { GridFaceCount / 2, GridFaceCount / 8 };
+
+	// a single worker and more workers than meshes must agree with simplifying one mesh at a time
+	for (int parallelism = 1; parallelism <= 4; parallelism += 3)
+	{
+		MeshSimplifier::MaximumDegreeOfParallelism = parallelism;
+		array<array<array<int>^>^> ^chains = MeshSimplifier::GenerateLodChains(simplifiers, ratios, MeshSimplification::Face);
+
+		ASSERT_EQ(simplifiers->Length, chains->Length);
+		for (int i = 0; i < simplifiers->Length; ++i)
+		{
+			array<array<int>^> ^expected = simplifiers[i]->GenerateLodChain(targets, MeshSimplification::Face);
+			ASSERT_EQ(expected->Length, chains[i]->Length);
+			for (int level = 0; level < expected->Length; ++level)
+				ASSERT_TRUE(LevelsEqual(expected[level], chains[i][level]));
+		}
+	}
+
+	for (int i = 0; i < simplifiers->Length; ++i)
+		delete simplifiers[i];
+}
+
+TEST_F(MeshSimplifierTest, RejectsInvalidArguments)
+{
+	DataStream ^vertices = ToStream(m_Positions);
+	DataStream ^indices = ToStream(m_Indices);
+	array<VertexElement> ^noPosition =
+	{
+		VertexElement(0, 0, DeclarationType::Float3, DeclarationMethod::Default, DeclarationUsage::Normal, 0),
+		VertexElement::VertexDeclarationEnd
+	};
+	MeshSimplifier ^simplifier;
+
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(nullptr, GridVertexCount, PositionElements(), indices, GridFaceCount, false), ArgumentNullException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, nullptr, indices, GridFaceCount, false), ArgumentNullException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, PositionElements(), nullptr, GridFaceCount, false), ArgumentNullException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, -1, PositionElements(), indices, GridFaceCount, false), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, PositionElements(), indices, -1, false), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, noPosition, indices, GridFaceCount, false), ArgumentException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount + 1, PositionElements(), indices, GridFaceCount, false), ArgumentException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, PositionElements(), indices, GridFaceCount, true), ArgumentException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount - 1, PositionElements(), indices, GridFaceCount, false), ArgumentException);
+	ASSERT_MANAGED_THROW(simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, PositionElements(), indices, GridFaceCount, false,
+		AttributeWeights(), gcnew array<float>(GridVertexCount - 1)), ArgumentException);
+	ASSERT_MANAGED_THROW(MeshSimplifier::MaximumDegreeOfParallelism = 0, ArgumentOutOfRangeException);
+
+	simplifier = gcnew MeshSimplifier(vertices, GridVertexCount, PositionElements(), indices, GridFaceCount, false);
+	array<array<int>^> ^levels;
+	array<array<array<int>^>^> ^chains;
+	array<int> ^valid = { 64 };
+	array<int> ^increasing = { 16, 64 };
+	array<int> ^negative = { -1 };
+	array<float> ^ratios = { 0.5f };
+	array<float> ^outOfRange = { 1.5f };
+	array<MeshSimplifier^> ^withNull = { simplifier, nullptr };
+
+	ASSERT_MANAGED_THROW(levels = simplifier->GenerateLodChain(nullptr, MeshSimplification::Face), ArgumentNullException);
+	ASSERT_MANAGED_THROW(levels = simplifier->GenerateLodChain(increasing, MeshSimplification::Face), ArgumentException);
+	ASSERT_MANAGED_THROW(levels = simplifier->GenerateLodChain(negative, MeshSimplification::Face), ArgumentException);
+	ASSERT_MANAGED_THROW(levels = simplifier->GenerateLodChain(valid, static_cast<MeshSimplification>(0)), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(chains = MeshSimplifier::GenerateLodChains(nullptr, ratios, MeshSimplification::Face), ArgumentNullException);
+	ASSERT_MANAGED_THROW(chains = MeshSimplifier::GenerateLodChains(withNull, nullptr, MeshSimplification::Face), ArgumentNullException);
+	ASSERT_MANAGED_THROW(chains = MeshSimplifier::GenerateLodChains(withNull, outOfRange, MeshSimplification::Face), ArgumentException);
+	ASSERT_MANAGED_THROW(chains = MeshSimplifier::GenerateLodChains(withNull, ratios, MeshSimplification::Face), ArgumentException);
+
+	delete simplifier;
+	array<MeshSimplifier^> ^disposed = { simplifier };
+	ASSERT_MANAGED_THROW(levels = simplifier->GenerateLodChain(valid, MeshSimplification::Face), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(chains = MeshSimplifier::GenerateLodChains(disposed, ratios, MeshSimplification::Face), ObjectDisposedException);
+
+	delete indices;
+	delete vertices;
+}
@@ -0,0 +1,375 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+#include "RecordingDevice9.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D9;
+
+class ShaderConstantCacheTest : public SlimDXTest
+{
+};
+
+#define SHADERCONSTANTCACHE_TEST(name_) TEST_F(ShaderConstantCacheTest, name_)
+
+static void AssertUpload(const RecordedCall9 &call, const char *method, UINT startRegister, UINT count)
+{
+	ASSERT_EQ(std::string(method), call.Method);
+	ASSERT_EQ(2u, call.Arguments.size());
+	ASSERT_EQ(startRegister, call.Arguments[0]);
+	ASSERT_EQ(count, call.Arguments[1]);
+}
+
+static array<Vector4> ^MakeRegisters(int count, float first)
+{
+	array<Vector4> ^registers = gcnew array<Vector4>(count);
+	for (int i = 0; i < count; ++i)
+		registers[i] = Vector4(first + i, 0.0f, 0.0f, 0.0f);
+
+	return registers;
+}
+
+SHADERCONSTANTCACHE_TEST(WritesAreDeferredUntilCommit)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	ASSERT_FALSE(cache->IsDirty);
+
+	cache->SetVertexShaderConstant(4, Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+	ASSERT_TRUE(cache->IsDirty);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+
+	ASSERT_TRUE(cache->Commit().IsSuccess);
+	ASSERT_FALSE(cache->IsDirty);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(1u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 4, 1);
+
+	const float *registers = device.Recording.GetVertexShaderConstants();
+	ASSERT_EQ(1.0f, registers[16]);
+	ASSERT_EQ(4.0f, registers[19]);
+
+	ASSERT_EQ(1, cache->RegistersWritten);
+	ASSERT_EQ(1, cache->RegistersUploaded);
+	ASSERT_EQ(1, cache->UploadCount);
+
+	// nothing left to upload
+	ASSERT_TRUE(cache->Commit().IsSuccess);
+	ASSERT_EQ(1u, calls.size());
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(UnchangedWritesAreNotUploaded)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+
+	// a register that was never uploaded is dirty even when it is written with the shadow's initial zeroes
+	cache->SetPixelShaderConstant(0, Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	ASSERT_TRUE(cache->IsDirty);
+	cache->Commit();
+	ASSERT_EQ(1u, device.Recording.GetCalls().size());
+
+	device.Recording.ClearCalls();
+	cache->SetPixelShaderConstant(0, Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+	ASSERT_FALSE(cache->IsDirty);
+	ASSERT_TRUE(cache->Commit().IsSuccess);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+	ASSERT_EQ(2, cache->RegistersWritten);
+	ASSERT_EQ(1, cache->RegistersUploaded);
+
+	cache->SetPixelShaderConstant(0, Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+	ASSERT_TRUE(cache->IsDirty);
+	cache->Commit();
+	ASSERT_EQ(1u, device.Recording.GetCalls().size());
+	AssertUpload(device.Recording.GetCalls()[0], "SetPixelShaderConstantF", 0, 1);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(AdjacentRegistersShareOneUpload)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	cache->SetVertexShaderConstant(10, Matrix::Identity);
+	cache->SetVertexShaderConstant(14, Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+	cache->Commit();
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(1u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 10, 5);
+	ASSERT_EQ(5 * 16u, calls[0].Data.size());
+	ASSERT_EQ(5, cache->RegistersUploaded);
+	ASSERT_EQ(1, cache->UploadCount);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(MergeGapBridgesUploadedRegisters)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	cache->SetVertexShaderConstant(0, MakeRegisters(8, 0.0f), 0, 8);
+	cache->Commit();
+	device.Recording.ClearCalls();
+	cache->ResetStatistics();
+
+	// two clean registers in between are re-sent rather than paying for a second call
+	cache->SetVertexShaderConstant(0, Vector4(100.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetVertexShaderConstant(3, Vector4(103.0f, 0.0f, 0.0f, 0.0f));
+	cache->Commit();
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(1u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 0, 4);
+	ASSERT_EQ(4, cache->RegistersUploaded);
+	ASSERT_EQ(2.0f, device.Recording.GetVertexShaderConstants()[2 * 4]);
+
+	// three are too many
+	device.Recording.ClearCalls();
+	cache->SetVertexShaderConstant(0, Vector4(200.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetVertexShaderConstant(4, Vector4(204.0f, 0.0f, 0.0f, 0.0f));
+	cache->Commit();
+	ASSERT_EQ(2u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 0, 1);
+	AssertUpload(calls[1], "SetVertexShaderConstantF", 4, 1);
+
+	device.Recording.ClearCalls();
+	cache->MergeGap = 3;
+	cache->SetVertexShaderConstant(0, Vector4(300.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetVertexShaderConstant(4, Vector4(304.0f, 0.0f, 0.0f, 0.0f));
+	cache->Commit();
+	ASSERT_EQ(1u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 0, 5);
+
+	device.Recording.ClearCalls();
+	cache->MergeGap = 0;
+	cache->SetVertexShaderConstant(0, Vector4(400.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetVertexShaderConstant(2, Vector4(402.0f, 0.0f, 0.0f, 0.0f));
+	cache->Commit();
+	ASSERT_EQ(2u, calls.size());
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(MergeGapDoesNotBridgeUnknownRegisters)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+
+	// register 1 has never been uploaded, so sending the shadow's copy would clobber whatever the device holds
+	cache->SetPixelShaderConstant(0, Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetPixelShaderConstant(2, Vector4(3.0f, 0.0f, 0.0f, 0.0f));
+	cache->Commit();
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(2u, calls.size());
+	AssertUpload(calls[0], "SetPixelShaderConstantF", 0, 1);
+	AssertUpload(calls[1], "SetPixelShaderConstantF", 2, 1);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(InvalidateForgetsDeviceContents)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	cache->SetVertexShaderConstant(0, MakeRegisters(4, 1.0f), 0, 4);
+	cache->Commit();
+	device.Recording.ClearCalls();
+
+	cache->Invalidate();
+	ASSERT_FALSE(cache->IsDirty);
+
+	// the same values are uploaded again, and the registers between them are no longer bridged
+	cache->SetVertexShaderConstant(0, Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetVertexShaderConstant(2, Vector4(3.0f, 0.0f, 0.0f, 0.0f));
+	ASSERT_TRUE(cache->IsDirty);
+	cache->Commit();
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(2u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 0, 1);
+	AssertUpload(calls[1], "SetVertexShaderConstantF", 2, 1);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(TransposedMatricesAreStoredByColumn)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	Matrix matrix;
+	for (int row = 0; row < 4; ++row)
+		for (int column = 0; column < 4; ++column)
+			matrix[row, column] = static_cast<float>(row * 4 + column);
+
+	cache->SetVertexShaderConstant(8, matrix, true);
+	cache->SetPixelShaderConstant(0, gcnew array<Matrix> { Matrix::Identity, matrix }, 0, 2, true);
+	cache->SetPixelShaderConstant(8, matrix);
+	cache->Commit();
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(2u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 8, 4);
+	AssertUpload(calls[1], "SetPixelShaderConstantF", 0, 12);
+
+	const float *vertexRegisters = device.Recording.GetVertexShaderConstants();
+	const float *pixelRegisters = device.Recording.GetPixelShaderConstants();
+	for (int row = 0; row < 4; ++row)
+	{
+		for (int column = 0; column < 4; ++column)
+		{
+			float expected = matrix[row, column];
+			ASSERT_EQ(expected, vertexRegisters[(8 + column) * 4 + row]);
+			ASSERT_EQ(expected, pixelRegisters[(4 + column) * 4 + row]);
+			ASSERT_EQ(expected, pixelRegisters[(8 + row) * 4 + column]);
+		}
+	}
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(ColorsAndFloatArraysFillRegisters)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	cache->SetPixelShaderConstant(0, Color4(0.125f, 1.0f, 0.5f, 0.25f));
+	cache->SetPixelShaderConstant(4, gcnew array<float> { 9, 9, 9, 9, 1, 2, 3, 4, 5, 6, 7, 8 }, 4, 2);
+	cache->Commit();
+
+	const float *registers = device.Recording.GetPixelShaderConstants();
+	ASSERT_EQ(1.0f, registers[0]);
+	ASSERT_EQ(0.5f, registers[1]);
+	ASSERT_EQ(0.25f, registers[2]);
+	ASSERT_EQ(0.125f, registers[3]);
+	for (int i = 0; i < 8; ++i)
+		ASSERT_EQ(static_cast<float>(i + 1), registers[16 + i]);
+
+	ASSERT_EQ(3, cache->RegistersWritten);
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(FailedCommitKeepsRegistersDirty)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	cache->SetVertexShaderConstant(0, Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetVertexShaderConstant(8, Vector4(2.0f, 0.0f, 0.0f, 0.0f));
+	cache->SetPixelShaderConstant(0, Vector4(3.0f, 0.0f, 0.0f, 0.0f));
+
+	device.Recording.FailCalls("SetVertexShaderConstantF", D3DERR_INVALIDCALL);
+	Result result = cache->Commit();
+	ASSERT_TRUE(result.IsFailure);
+	ASSERT_EQ(D3DERR_INVALIDCALL, result.Code);
+	ASSERT_TRUE(cache->IsDirty);
+	ASSERT_EQ(1u, device.Recording.GetCalls().size());
+	ASSERT_EQ(0, cache->UploadCount);
+
+	device.Recording.FailCalls(NULL, S_OK);
+	device.Recording.ClearCalls();
+	ASSERT_TRUE(cache->Commit().IsSuccess);
+	ASSERT_FALSE(cache->IsDirty);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(3u, calls.size());
+	AssertUpload(calls[0], "SetVertexShaderConstantF", 0, 1);
+	AssertUpload(calls[1], "SetVertexShaderConstantF", 8, 1);
+	AssertUpload(calls[2], "SetPixelShaderConstantF", 0, 1);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(ResetStatistics)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	cache->SetVertexShaderConstant(0, Matrix::Identity);
+	cache->Commit();
+	ASSERT_EQ(4, cache->RegistersWritten);
+	ASSERT_EQ(4, cache->RegistersUploaded);
+	ASSERT_EQ(1, cache->UploadCount);
+
+	cache->ResetStatistics();
+	ASSERT_EQ(0, cache->RegistersWritten);
+	ASSERT_EQ(0, cache->RegistersUploaded);
+	ASSERT_EQ(0, cache->UploadCount);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(RejectsInvalidArguments)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache;
+	ASSERT_MANAGED_THROW(cache = gcnew ShaderConstantCache(nullptr), ArgumentNullException);
+	ASSERT_MANAGED_THROW(cache = gcnew ShaderConstantCache(device.Device, -1, 4), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(cache = gcnew ShaderConstantCache(device.Device, 8, -1), ArgumentOutOfRangeException);
+
+	cache = gcnew ShaderConstantCache(device.Device, 8, 4);
+	ASSERT_EQ(2, cache->MergeGap);
+	ASSERT_MANAGED_THROW(cache->MergeGap = -1, ArgumentOutOfRangeException);
+
+	ASSERT_MANAGED_THROW(cache->SetVertexShaderConstant(-1, Vector4()), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(cache->SetVertexShaderConstant(8, Vector4()), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(cache->SetVertexShaderConstant(5, Matrix::Identity), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(cache->SetPixelShaderConstant(1, Matrix::Identity, true), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(cache->SetPixelShaderConstant(3, MakeRegisters(2, 0.0f), 0, 2), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(cache->SetPixelShaderConstant(0, MakeRegisters(2, 0.0f), 1, 2), ArgumentException);
+	ASSERT_MANAGED_THROW(cache->SetVertexShaderConstant(0, gcnew array<float>(4), 0, 2), ArgumentException);
+	ASSERT_MANAGED_THROW(cache->SetVertexShaderConstant(0, gcnew array<Matrix>(3), 0, 3, false), ArgumentOutOfRangeException);
+	ASSERT_FALSE(cache->IsDirty);
+	ASSERT_EQ(0, cache->RegistersWritten);
+
+	cache->SetVertexShaderConstant(4, Matrix::Identity);
+	cache->SetPixelShaderConstant(3, Vector4());
+	ASSERT_EQ(5, cache->RegistersWritten);
+
+	delete cache;
+}
+
+SHADERCONSTANTCACHE_TEST(ThrowsWhenDisposed)
+{
+	WrappedRecordingDevice9 device;
+	ShaderConstantCache ^cache = gcnew ShaderConstantCache(device.Device);
+	delete cache;
+
+	Result result;
+	bool dirty;
+	ASSERT_MANAGED_THROW(cache->SetVertexShaderConstant(0, Vector4()), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(cache->SetPixelShaderConstant(0, Matrix::Identity), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = cache->Commit(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(cache->Invalidate(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(dirty = cache->IsDirty, ObjectDisposedException);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+}
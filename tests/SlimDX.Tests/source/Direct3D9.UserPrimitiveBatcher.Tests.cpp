@@ -0,0 +1,518 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Asserts.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+#include "RecordingDevice9.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Direct3D9;
+
+class UserPrimitiveBatcherTest : public SlimDXTest
+{
+};
+
+#define USERPRIMITIVEBATCHER_TEST(name_) TEST_F(UserPrimitiveBatcherTest, name_)
+
+template <size_t N>
+static void AssertCall(const RecordedCall9 &call, const char *method, const UINT_PTR (&arguments)[N])
+{
+	ASSERT_EQ(std::string(method), call.Method);
+	ASSERT_EQ(std::vector<UINT_PTR>(arguments, arguments + N), call.Arguments);
+}
+
+template <size_t N>
+static void AssertMethods(const std::vector<RecordedCall9> &calls, const char *(&methods)[N])
+{
+	ASSERT_EQ(N, calls.size());
+	for (size_t i = 0; i < N; ++i)
+		ASSERT_EQ(std::string(methods[i]), calls[i].Method);
+}
+
+// Vertices whose X component counts up from first, so each one can be told apart after upload.
+static array<Vector4> ^MakeVertices(int count, float first)
+{
+	array<Vector4> ^vertices = gcnew array<Vector4>(count);
+	for (int i = 0; i < count; ++i)
+		vertices[i] = Vector4(first + i, 0.0f, 0.0f, 1.0f);
+
+	return vertices;
+}
+
+// Reads the X component of a Vector4 vertex held in a recorded vertex buffer.
+static float VertexX(UINT_PTR buffer, int vertex)
+{
+	IDirect3DVertexBuffer9 *vertexBuffer = reinterpret_cast<IDirect3DVertexBuffer9 *>(buffer);
+	return reinterpret_cast<const float *>(static_cast<RecordingVertexBuffer9 *>(vertexBuffer)->GetContents())[vertex * 4];
+}
+
+static const WORD *IndexContents(UINT_PTR buffer)
+{
+	IDirect3DIndexBuffer9 *indexBuffer = reinterpret_cast<IDirect3DIndexBuffer9 *>(buffer);
+	return reinterpret_cast<const WORD *>(static_cast<RecordingIndexBuffer9 *>(indexBuffer)->GetContents());
+}
+
+USERPRIMITIVEBATCHER_TEST(ConstructorCreatesDynamicBuffers)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(2u, calls.size());
+	UINT_PTR vertexBuffer[] = { 1024, D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, 0, D3DPOOL_DEFAULT };
+	AssertCall(calls[0], "CreateVertexBuffer", vertexBuffer);
+	UINT_PTR indexBuffer[] = { 256, D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY, D3DFMT_INDEX16, D3DPOOL_DEFAULT };
+	AssertCall(calls[1], "CreateIndexBuffer", indexBuffer);
+	ASSERT_EQ(2, device.Recording.GetLiveBufferCount());
+
+	delete batcher;
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+}
+
+USERPRIMITIVEBATCHER_TEST(ConstructorThrowsWhenBufferCreationFails)
+{
+	WrappedRecordingDevice9 device;
+	device.Recording.FailCalls("CreateIndexBuffer", E_OUTOFMEMORY);
+	UserPrimitiveBatcher ^batcher;
+
+	ASSERT_MANAGED_THROW(batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, false), Direct3D9Exception);
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+}
+
+USERPRIMITIVEBATCHER_TEST(MergesTriangleLists)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	ASSERT_TRUE(batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f)).IsSuccess);
+	ASSERT_TRUE(batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 2, MakeVertices(6, 3.0f)).IsSuccess);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+	ASSERT_EQ(9, batcher->PendingVertexCount);
+	ASSERT_EQ(2, batcher->SubmittedDrawCount);
+	ASSERT_EQ(0, batcher->IssuedDrawCount);
+
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+	ASSERT_EQ(1, batcher->IssuedDrawCount);
+	ASSERT_EQ(1, batcher->DiscardCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(3u, calls.size());
+	UINT_PTR vertexBuffer = calls[0].Arguments[0];
+	UINT_PTR lock[] = { vertexBuffer, 0, 9 * 16, D3DLOCK_DISCARD };
+	AssertCall(calls[0], "Lock", lock);
+	UINT_PTR streamSource[] = { 0, vertexBuffer, 0, 16 };
+	AssertCall(calls[1], "SetStreamSource", streamSource);
+	UINT_PTR draw[] = { D3DPT_TRIANGLELIST, 0, 3 };
+	AssertCall(calls[2], "DrawPrimitive", draw);
+
+	for (int i = 0; i < 9; ++i)
+		ASSERT_EQ(static_cast<float>(i), VertexX(vertexBuffer, i));
+
+	// later batches are appended behind the ones already drawn
+	device.Recording.ClearCalls();
+	ASSERT_TRUE(batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 20.0f)).IsSuccess);
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	ASSERT_EQ(1, batcher->DiscardCount);
+
+	UINT_PTR appendLock[] = { vertexBuffer, 9 * 16, 3 * 16, D3DLOCK_NOOVERWRITE };
+	AssertCall(calls[0], "Lock", appendLock);
+	UINT_PTR appendDraw[] = { D3DPT_TRIANGLELIST, 9, 1 };
+	AssertCall(calls[2], "DrawPrimitive", appendDraw);
+	ASSERT_EQ(20.0f, VertexX(vertexBuffer, 9));
+	ASSERT_EQ(0.0f, VertexX(vertexBuffer, 0));
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(FlushWithNothingPendingDoesNothing)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+	ASSERT_EQ(0, batcher->IssuedDrawCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(IncompatibleDrawsFlushThePendingBatch)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	batcher->DrawUserPrimitives(PrimitiveType::LineList, 1, MakeVertices(2, 0.0f));
+	ASSERT_EQ(2, batcher->PendingVertexCount);
+
+	const char *typeChange[] = { "Lock", "SetStreamSource", "DrawPrimitive" };
+	AssertMethods(device.Recording.GetCalls(), typeChange);
+	UINT_PTR triangles[] = { D3DPT_TRIANGLELIST, 0, 1 };
+	AssertCall(device.Recording.GetCalls()[2], "DrawPrimitive", triangles);
+
+	device.Recording.ClearCalls();
+	batcher->DrawUserPrimitives(PrimitiveType::LineList, 1, gcnew array<Vector3>(2));
+	ASSERT_EQ(2, batcher->PendingVertexCount);
+	ASSERT_EQ(3u, device.Recording.GetCalls().size());
+	UINT_PTR lines[] = { D3DPT_LINELIST, 3, 1 };
+	AssertCall(device.Recording.GetCalls()[2], "DrawPrimitive", lines);
+
+	device.Recording.ClearCalls();
+	array<short> ^indices = gcnew array<short> { 0, 1 };
+	batcher->DrawIndexedUserPrimitives(PrimitiveType::LineList, 0, 2, 1, indices, Format::Index16, gcnew array<Vector3>(2), 12);
+	ASSERT_EQ(2, batcher->PendingVertexCount);
+	ASSERT_EQ(3u, device.Recording.GetCalls().size());
+	ASSERT_EQ(3, batcher->IssuedDrawCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(StripsAndFansAreDrawnImmediately)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleStrip, 2, MakeVertices(4, 0.0f));
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleFan, 1, MakeVertices(3, 4.0f));
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	const char *methods[] = { "Lock", "SetStreamSource", "DrawPrimitive", "Lock", "SetStreamSource", "DrawPrimitive" };
+	AssertMethods(calls, methods);
+	UINT_PTR strip[] = { D3DPT_TRIANGLESTRIP, 0, 2 };
+	AssertCall(calls[2], "DrawPrimitive", strip);
+	UINT_PTR fan[] = { D3DPT_TRIANGLEFAN, 4, 1 };
+	AssertCall(calls[5], "DrawPrimitive", fan);
+	ASSERT_EQ(2, batcher->IssuedDrawCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(MergedIndicesAreRebased)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	// only vertices 2 to 4 are referenced, so only they are copied
+	array<short> ^first = gcnew array<short> { 2, 3, 4 };
+	batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 2, 3, 1, first, Format::Index16, MakeVertices(6, 0.0f), 16);
+	array<int> ^second = gcnew array<int> { 0, 1, 2, 2, 1, 3 };
+	batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 4, 2, second, Format::Index32, MakeVertices(4, 10.0f), 16);
+	ASSERT_EQ(7, batcher->PendingVertexCount);
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	const char *methods[] = { "Lock", "Lock", "SetStreamSource", "SetIndices", "DrawIndexedPrimitive" };
+	AssertMethods(calls, methods);
+	UINT_PTR vertexBuffer = calls[0].Arguments[0];
+	UINT_PTR indexBuffer = calls[1].Arguments[0];
+	UINT_PTR vertexLock[] = { vertexBuffer, 0, 7 * 16, D3DLOCK_DISCARD };
+	AssertCall(calls[0], "Lock", vertexLock);
+	UINT_PTR indexLock[] = { indexBuffer, 0, 9 * 2, D3DLOCK_DISCARD };
+	AssertCall(calls[1], "Lock", indexLock);
+	UINT_PTR setIndices[] = { indexBuffer };
+	AssertCall(calls[3], "SetIndices", setIndices);
+	UINT_PTR draw[] = { D3DPT_TRIANGLELIST, 0, 0, 7, 0, 3 };
+	AssertCall(calls[4], "DrawIndexedPrimitive", draw);
+
+	const float expectedVertices[] = { 2, 3, 4, 10, 11, 12, 13 };
+	for (int i = 0; i < 7; ++i)
+		ASSERT_EQ(expectedVertices[i], VertexX(vertexBuffer, i));
+
+	const WORD expectedIndices[] = { 0, 1, 2, 3, 4, 5, 5, 4, 6 };
+	const WORD *indices = IndexContents(indexBuffer);
+	for (int i = 0; i < 9; ++i)
+		ASSERT_EQ(expectedIndices[i], indices[i]);
+
+	// the next indexed batch lands after the first in both buffers
+	device.Recording.ClearCalls();
+	batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 1, 0, 0, 3, 1, gcnew array<short> { 9, 0, 1, 2 }, Format::Index16,
+		MakeVertices(3, 20.0f), 16);
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	UINT_PTR appendDraw[] = { D3DPT_TRIANGLELIST, 7, 0, 3, 9, 1 };
+	AssertCall(device.Recording.GetCalls()[4], "DrawIndexedPrimitive", appendDraw);
+	ASSERT_EQ(0, indices[9]);
+	ASSERT_EQ(2, indices[11]);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(StartVertexOffsetsTheVertexArray)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, false);
+	device.Recording.ClearCalls();
+
+	batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 2, 1, 3, 1, gcnew array<int> { 1, 2, 3 }, Format::Index32,
+		MakeVertices(8, 0.0f), 16);
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(3.0f, VertexX(calls[0].Arguments[0], 0));
+	ASSERT_EQ(5.0f, VertexX(calls[0].Arguments[0], 2));
+
+	const DWORD *indices = reinterpret_cast<const DWORD *>(IndexContents(calls[1].Arguments[0]));
+	ASSERT_EQ(0u, indices[0]);
+	ASSERT_EQ(2u, indices[2]);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(VertexOffsetIsAlignedToStride)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, gcnew array<Vector3>(3));
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	device.Recording.ClearCalls();
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	UINT_PTR lock[] = { calls[0].Arguments[0], 48, 48, D3DLOCK_NOOVERWRITE };
+	AssertCall(calls[0], "Lock", lock);
+	UINT_PTR draw[] = { D3DPT_TRIANGLELIST, 3, 1 };
+	AssertCall(calls[2], "DrawPrimitive", draw);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(FullRingDiscards)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 6 * 16, 256, true);
+	device.Recording.ClearCalls();
+
+	// two triangles fill the buffer, so the third starts a new batch
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 3.0f));
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 6.0f));
+	ASSERT_EQ(3, batcher->PendingVertexCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	ASSERT_EQ(3u, calls.size());
+	UINT_PTR vertexBuffer = calls[0].Arguments[0];
+	UINT_PTR full[] = { vertexBuffer, 0, 6 * 16, D3DLOCK_DISCARD };
+	AssertCall(calls[0], "Lock", full);
+	UINT_PTR fullDraw[] = { D3DPT_TRIANGLELIST, 0, 2 };
+	AssertCall(calls[2], "DrawPrimitive", fullDraw);
+
+	// no room is left behind the first batch, so the buffer is discarded again
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	UINT_PTR wrapped[] = { vertexBuffer, 0, 3 * 16, D3DLOCK_DISCARD };
+	AssertCall(calls[3], "Lock", wrapped);
+	ASSERT_EQ(6.0f, VertexX(vertexBuffer, 0));
+	ASSERT_EQ(2, batcher->DiscardCount);
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 9.0f));
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	UINT_PTR appended[] = { vertexBuffer, 3 * 16, 3 * 16, D3DLOCK_NOOVERWRITE };
+	AssertCall(calls[6], "Lock", appended);
+	ASSERT_EQ(2, batcher->DiscardCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(OversizedDrawsUseUserPointers)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 3 * 16, 6, true);
+	device.Recording.ClearCalls();
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	array<Vector4> ^vertices = MakeVertices(6, 3.0f);
+	ASSERT_TRUE(batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 2, vertices).IsSuccess);
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+
+	const std::vector<RecordedCall9> &calls = device.Recording.GetCalls();
+	const char *methods[] = { "Lock", "SetStreamSource", "DrawPrimitive", "DrawPrimitiveUP" };
+	AssertMethods(calls, methods);
+	UINT_PTR drawUP[] = { D3DPT_TRIANGLELIST, 2, 16 };
+	AssertCall(calls[3], "DrawPrimitiveUP", drawUP);
+	ASSERT_EQ(6 * 16u, calls[3].Data.size());
+	pin_ptr<Vector4> pinnedVertices = &vertices[0];
+	ASSERT_EQ(0, memcmp(&calls[3].Data[0], pinnedVertices, 6 * 16));
+
+	// six 16-bit indices need more than the six byte index buffer
+	device.Recording.ClearCalls();
+	array<short> ^indices = gcnew array<short> { 1, 2, 0, 1, 0, 2 };
+	ASSERT_TRUE(batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 2, indices, Format::Index16, vertices, 16).IsSuccess);
+	ASSERT_EQ(1u, calls.size());
+	UINT_PTR drawIndexedUP[] = { D3DPT_TRIANGLELIST, 0, 3, 2, D3DFMT_INDEX16, 16 };
+	AssertCall(calls[0], "DrawIndexedPrimitiveUP", drawIndexedUP);
+	ASSERT_EQ(6 * 2 + 3 * 16u, calls[0].Data.size());
+	pin_ptr<short> pinnedIndices = &indices[0];
+	ASSERT_EQ(0, memcmp(&calls[0].Data[0], pinnedIndices, 6 * 2));
+
+	ASSERT_EQ(3, batcher->SubmittedDrawCount);
+	ASSERT_EQ(3, batcher->IssuedDrawCount);
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(LostDeviceReleasesBuffers)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	ASSERT_TRUE(batcher->OnLostDevice().IsSuccess);
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+	ASSERT_TRUE(device.Recording.GetCalls().empty());
+
+	// without buffers every draw goes straight to the device
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+	ASSERT_EQ(1u, device.Recording.GetCalls().size());
+	ASSERT_EQ(std::string("DrawPrimitiveUP"), device.Recording.GetCalls()[0].Method);
+
+	device.Recording.ClearCalls();
+	ASSERT_TRUE(batcher->OnResetDevice().IsSuccess);
+	ASSERT_TRUE(batcher->OnResetDevice().IsSuccess);
+	ASSERT_EQ(2, device.Recording.GetLiveBufferCount());
+	const char *created[] = { "CreateVertexBuffer", "CreateIndexBuffer" };
+	AssertMethods(device.Recording.GetCalls(), created);
+
+	// the recreated buffers are discarded on first use
+	device.Recording.ClearCalls();
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	ASSERT_EQ(static_cast<UINT_PTR>(D3DLOCK_DISCARD), device.Recording.GetCalls()[0].Arguments[3]);
+
+	delete batcher;
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+}
+
+USERPRIMITIVEBATCHER_TEST(FailedUploadDropsBatch)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	device.Recording.ClearCalls();
+	device.Recording.FailCalls("Lock", D3DERR_INVALIDCALL);
+
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	Result result = batcher->Flush();
+	ASSERT_TRUE(result.IsFailure);
+	ASSERT_EQ(D3DERR_INVALIDCALL, result.Code);
+	ASSERT_EQ(0, batcher->PendingVertexCount);
+	ASSERT_EQ(0, batcher->IssuedDrawCount);
+	ASSERT_EQ(1u, device.Recording.GetCalls().size());
+
+	device.Recording.FailCalls(NULL, S_OK);
+	device.Recording.ClearCalls();
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	ASSERT_TRUE(batcher->Flush().IsSuccess);
+	ASSERT_EQ(1, batcher->IssuedDrawCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(ResetStatistics)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f));
+	batcher->Flush();
+	ASSERT_EQ(1, batcher->SubmittedDrawCount);
+	ASSERT_EQ(1, batcher->IssuedDrawCount);
+	ASSERT_EQ(1, batcher->DiscardCount);
+
+	batcher->ResetStatistics();
+	ASSERT_EQ(0, batcher->SubmittedDrawCount);
+	ASSERT_EQ(0, batcher->IssuedDrawCount);
+	ASSERT_EQ(0, batcher->DiscardCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(RejectsInvalidArguments)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher;
+	ASSERT_MANAGED_THROW(batcher = gcnew UserPrimitiveBatcher(nullptr, 1024, 256, true), ArgumentNullException);
+	ASSERT_MANAGED_THROW(batcher = gcnew UserPrimitiveBatcher(device.Device, 0, 256, true), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, -1, true), ArgumentOutOfRangeException);
+
+	batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	array<Vector4> ^vertices = MakeVertices(3, 0.0f);
+	array<short> ^indices = gcnew array<short> { 0, 1, 2 };
+	array<Vector4> ^noVertices = nullptr;
+	array<short> ^noIndices = nullptr;
+	Result result;
+
+	ASSERT_MANAGED_THROW(result = batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, noVertices), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 0, vertices), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 2, vertices), ArgumentException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, 1, vertices), ArgumentException);
+
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 1, noIndices, Format::Index16, vertices, 16), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 1, indices, Format::Index16, noVertices, 16), ArgumentNullException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 1, indices, Format::A8R8G8B8, vertices, 16), ArgumentException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 0, indices, Format::Index16, vertices, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, -1, 3, 1, indices, Format::Index16, vertices, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 0, 1, indices, Format::Index16, vertices, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 1, indices, Format::Index16, vertices, 0), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 3, 0, 3, 1, indices, Format::Index16, vertices, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 0, 3, 1, indices, Format::Index16, vertices, 16), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 2, indices, Format::Index16, vertices, 16), ArgumentException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 1, indices, Format::Index32, vertices, 16), ArgumentException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 1, 3, 1, indices, Format::Index16, vertices, 16), ArgumentException);
+	ASSERT_EQ(0, batcher->SubmittedDrawCount);
+
+	delete batcher;
+}
+
+USERPRIMITIVEBATCHER_TEST(ThrowsWhenDisposed)
+{
+	WrappedRecordingDevice9 device;
+	UserPrimitiveBatcher ^batcher = gcnew UserPrimitiveBatcher(device.Device, 1024, 256, true);
+	delete batcher;
+	ASSERT_EQ(0, device.Recording.GetLiveBufferCount());
+
+	Result result;
+	ASSERT_MANAGED_THROW(result = batcher->DrawUserPrimitives(PrimitiveType::TriangleList, 1, MakeVertices(3, 0.0f)), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = batcher->DrawIndexedUserPrimitives(PrimitiveType::TriangleList, 0, 3, 1, gcnew array<short> { 0, 1, 2 },
+		Format::Index16, MakeVertices(3, 0.0f), 16), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = batcher->Flush(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = batcher->OnLostDevice(), ObjectDisposedException);
+	ASSERT_MANAGED_THROW(result = batcher->OnResetDevice(), ObjectDisposedException);
+}
@@ -21,6 +21,7 @@
 * THE SOFTWARE.
 */
 
+#include "IDWriteFactoryMock.h"
 #include "IDWriteFontCollectionMock.h"
 #include "IDWriteTextLayoutMock.h"
 #include "SlimDXTest.h"
@@ -31,34 +32,6 @@ using namespace SlimDX::Direct2D;
 using namespace SlimDX::DirectWrite;
 using namespace System;
 
-class IDWriteFactoryMock : public IDWriteFactory
-{
-public:
-	MOCK_IUNKNOWN;
-
-	MOCK_METHOD2_WITH_CALLTYPE(STDMETHODCALLTYPE, GetSystemFontCollection, HRESULT(IDWriteFontCollection**, BOOL) );
-	MOCK_METHOD4_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateCustomFontCollection, HRESULT(IDWriteFontCollectionLoader*, void const*, UINT32, IDWriteFontCollection**));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, RegisterFontCollectionLoader, HRESULT(IDWriteFontCollectionLoader*));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, UnregisterFontCollectionLoader, HRESULT(IDWriteFontCollectionLoader*));
-	MOCK_METHOD3_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateFontFileReference, HRESULT(WCHAR const*, FILETIME const*, IDWriteFontFile**));
-	MOCK_METHOD4_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateCustomFontFileReference, HRESULT(void const*, UINT32, IDWriteFontFileLoader*, IDWriteFontFile**));
-	MOCK_METHOD6_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateFontFace, HRESULT(DWRITE_FONT_FACE_TYPE, UINT32, IDWriteFontFile* const*, UINT32, DWRITE_FONT_SIMULATIONS, IDWriteFontFace**));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateRenderingParams, HRESULT(IDWriteRenderingParams**));
-	MOCK_METHOD2_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateMonitorRenderingParams, HRESULT(HMONITOR, IDWriteRenderingParams**));
-	MOCK_METHOD6_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateCustomRenderingParams, HRESULT(FLOAT, FLOAT, FLOAT, DWRITE_PIXEL_GEOMETRY, DWRITE_RENDERING_MODE, IDWriteRenderingParams**));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, RegisterFontFileLoader, HRESULT(IDWriteFontFileLoader*));
-	STDMETHOD(UnregisterFontFileLoader)(IDWriteFontFileLoader* fontFileLoader) { return E_NOTIMPL; } 
-	MOCK_METHOD8_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateTextFormat, HRESULT(WCHAR const*, IDWriteFontCollection*, DWRITE_FONT_WEIGHT, DWRITE_FONT_STYLE, DWRITE_FONT_STRETCH, FLOAT, WCHAR const*, IDWriteTextFormat**));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateTypography, HRESULT(IDWriteTypography**));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, GetGdiInterop, HRESULT(IDWriteGdiInterop**));
-	MOCK_METHOD6_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateTextLayout, HRESULT(WCHAR const*, UINT32, IDWriteTextFormat*, FLOAT, FLOAT, IDWriteTextLayout**));
-	MOCK_METHOD9_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateGdiCompatibleTextLayout, HRESULT(WCHAR const*, UINT32, IDWriteTextFormat*, FLOAT, FLOAT, FLOAT, DWRITE_MATRIX const*, BOOL, IDWriteTextLayout**) );
-	MOCK_METHOD2_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateEllipsisTrimmingSign, HRESULT(IDWriteTextFormat*, IDWriteInlineObject**));
-	MOCK_METHOD1_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateTextAnalyzer, HRESULT(IDWriteTextAnalyzer**));
-	MOCK_METHOD4_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateNumberSubstitution, HRESULT(DWRITE_NUMBER_SUBSTITUTION_METHOD, WCHAR const*, BOOL, IDWriteNumberSubstitution**));
-	MOCK_METHOD8_WITH_CALLTYPE(STDMETHODCALLTYPE, CreateGlyphRunAnalysis, HRESULT(DWRITE_GLYPH_RUN const*, FLOAT, DWRITE_MATRIX const*, DWRITE_RENDERING_MODE, DWRITE_MEASURING_MODE, FLOAT, FLOAT, IDWriteGlyphRunAnalysis**));
-};
-
 class IDWriteFontFileFake : public IDWriteFontFile
 {
 public:
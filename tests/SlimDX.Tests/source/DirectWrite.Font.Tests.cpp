@@ -22,6 +22,7 @@
 */
 
 #include "Asserts.h"
+#include "SlimDXTest.h"
 #include "IDWriteFontMock.h"
 #include "IDWriteFontFaceMock.h"
 
@@ -64,6 +65,7 @@ class FontTest : public testing::Test
 protected:
 	virtual void TearDown()
 	{
+		SlimDXTest::ClearLastResult();
 		ASSERT_EQ(0, ObjectTable::Objects->Count);
 	}
 };
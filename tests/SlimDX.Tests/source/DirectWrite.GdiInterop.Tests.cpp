@@ -65,6 +65,7 @@ class GdiInteropTest : public SlimDXTest
 protected:
 	virtual void TearDown()
 	{
+		SlimDXTest::ClearLastResult();
 		ASSERT_EQ(0, ObjectTable::Objects->Count);
 	}
 };
@@ -27,45 +27,13 @@
 #include "CommonMocks.h"
 #include "IDWriteFontCollectionMock.h"
 #include "IDWriteInlineObjectMock.h"
+#include "IDWriteTextFormatMock.h"
 #include "SlimDXTest.h"
 
 using namespace testing;
 using namespace SlimDX::DirectWrite;
 using namespace System;
 
-class IDWriteTextFormatMock : public IDWriteTextFormat
-{
-public:
-	MOCK_IUNKNOWN;
-
-	// IDWriteTextFormat
-	STDMETHOD(SetTextAlignment)(DWRITE_TEXT_ALIGNMENT textAlignment) { return E_NOTIMPL; }
-	STDMETHOD(SetParagraphAlignment)(DWRITE_PARAGRAPH_ALIGNMENT paragraphAlignment) { return E_NOTIMPL; }
-	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, SetWordWrapping, HRESULT(DWRITE_WORD_WRAPPING) );
-	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, SetReadingDirection, HRESULT(DWRITE_READING_DIRECTION) );
-	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, SetFlowDirection, HRESULT(DWRITE_FLOW_DIRECTION) );
-	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, SetIncrementalTabStop, HRESULT(FLOAT) );
-	MOCK_METHOD2_WITH_CALLTYPE( STDMETHODCALLTYPE, SetTrimming, HRESULT(DWRITE_TRIMMING const*, IDWriteInlineObject*) );
-	MOCK_METHOD3_WITH_CALLTYPE( STDMETHODCALLTYPE, SetLineSpacing, HRESULT(DWRITE_LINE_SPACING_METHOD, FLOAT, FLOAT) );
-	STDMETHOD_(DWRITE_TEXT_ALIGNMENT, GetTextAlignment)() { return DWRITE_TEXT_ALIGNMENT(-1); }
-	STDMETHOD_(DWRITE_PARAGRAPH_ALIGNMENT, GetParagraphAlignment)() { return DWRITE_PARAGRAPH_ALIGNMENT(-1); }
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetWordWrapping, DWRITE_WORD_WRAPPING() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetReadingDirection, DWRITE_READING_DIRECTION() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFlowDirection, DWRITE_FLOW_DIRECTION() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetIncrementalTabStop, FLOAT() );
-	MOCK_METHOD2_WITH_CALLTYPE( STDMETHODCALLTYPE, GetTrimming, HRESULT(DWRITE_TRIMMING*, IDWriteInlineObject**) );
-	MOCK_METHOD3_WITH_CALLTYPE( STDMETHODCALLTYPE, GetLineSpacing, HRESULT(DWRITE_LINE_SPACING_METHOD*, FLOAT*, FLOAT*) );
-	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontCollection, HRESULT(IDWriteFontCollection**) );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontFamilyNameLength, UINT32() );
-	MOCK_METHOD2_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontFamilyName, HRESULT(WCHAR*, UINT32) );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontWeight, DWRITE_FONT_WEIGHT() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontStyle, DWRITE_FONT_STYLE() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontStretch, DWRITE_FONT_STRETCH() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetFontSize, FLOAT() );
-	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, GetLocaleNameLength, UINT32() );
-	MOCK_METHOD2_WITH_CALLTYPE( STDMETHODCALLTYPE, GetLocaleName, HRESULT(WCHAR*, UINT32) );
-};
-
 ref class MockedTextFormat
 {
 public:
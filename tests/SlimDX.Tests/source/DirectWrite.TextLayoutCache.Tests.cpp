@@ -0,0 +1,426 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include <dwrite.h>
+
+#include "Asserts.h"
+#include "IDWriteFactoryMock.h"
+#include "IDWriteTextFormatMock.h"
+#include "IDWriteTextLayoutMock.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::DirectWrite;
+
+// A text layout whose line, cluster and overall metrics are supplied by the
+// test, so snapshot hit testing can be checked against known positions.
+struct IDWriteTextLayoutFake : IDWriteTextLayoutMock
+{
+	std::vector<DWRITE_LINE_METRICS> Lines;
+	std::vector<DWRITE_CLUSTER_METRICS> Clusters;
+	DWRITE_TEXT_METRICS Metrics;
+	DWRITE_TEXT_ALIGNMENT Alignment;
+	DWRITE_READING_DIRECTION Direction;
+
+	STDMETHODIMP_(DWRITE_TEXT_ALIGNMENT) GetTextAlignment() { return Alignment; }
+	STDMETHODIMP_(DWRITE_READING_DIRECTION) GetReadingDirection() { return Direction; }
+	STDMETHODIMP GetMetrics(DWRITE_TEXT_METRICS *textMetrics) { *textMetrics = Metrics; return S_OK; }
+
+	STDMETHODIMP GetLineMetrics(DWRITE_LINE_METRICS *lineMetrics, UINT32 maxLineCount, UINT32 *actualLineCount)
+	{
+		*actualLineCount = static_cast<UINT32>(Lines.size());
+		if (maxLineCount < Lines.size())
+			return E_NOT_SUFFICIENT_BUFFER;
+
+		std::copy(Lines.begin(), Lines.end(), lineMetrics);
+		return S_OK;
+	}
+
+	STDMETHODIMP GetClusterMetrics(DWRITE_CLUSTER_METRICS *clusterMetrics, UINT32 maxClusterCount, UINT32 *actualClusterCount)
+	{
+		*actualClusterCount = static_cast<UINT32>(Clusters.size());
+		if (maxClusterCount < Clusters.size())
+			return E_NOT_SUFFICIENT_BUFFER;
+
+		std::copy(Clusters.begin(), Clusters.end(), clusterMetrics);
+		return S_OK;
+	}
+};
+
+static DWRITE_LINE_METRICS MakeLineMetrics(UINT32 length, UINT32 trailingWhitespaceLength, FLOAT height)
+{
+	DWRITE_LINE_METRICS const metrics = { length, trailingWhitespaceLength, 0, height, height*0.8f, FALSE };
+	return metrics;
+}
+
+static DWRITE_CLUSTER_METRICS MakeClusterMetrics(FLOAT width, bool isWhitespace)
+{
+	DWRITE_CLUSTER_METRICS metrics = { 0 };
+	metrics.width = width;
+	metrics.length = 1;
+	metrics.canWrapLineAfter = isWhitespace;
+	metrics.isWhitespace = isWhitespace;
+	return metrics;
+}
+
+// Hands out a distinct layout for every CreateTextLayout call, each laid out
+// as "ab " on a first line and "cd" on a second one.
+class TextLayoutSource
+{
+public:
+	TextLayoutSource()
+		: Alignment(DWRITE_TEXT_ALIGNMENT_LEADING),
+		Direction(DWRITE_READING_DIRECTION_LEFT_TO_RIGHT),
+		RightToLeftCluster(false),
+		m_Created(0)
+	{
+	}
+
+	HRESULT Create(WCHAR const *text, UINT32 length, IDWriteTextFormat *format, FLOAT maxWidth, FLOAT maxHeight, IDWriteTextLayout **layout)
+	{
+		if (m_Created == NUM_OF(m_Layouts))
+			return E_OUTOFMEMORY;
+
+		IDWriteTextLayoutFake &created = m_Layouts[m_Created++];
+		created.Lines.clear();
+		created.Lines.push_back(MakeLineMetrics(3, 1, 20.0f));
+		created.Lines.push_back(MakeLineMetrics(2, 0, 20.0f));
+		created.Clusters.clear();
+		created.Clusters.push_back(MakeClusterMetrics(10.0f, false));
+		created.Clusters.push_back(MakeClusterMetrics(12.0f, false));
+		created.Clusters.push_back(MakeClusterMetrics(4.0f, true));
+		created.Clusters.push_back(MakeClusterMetrics(8.0f, false));
+		created.Clusters.push_back(MakeClusterMetrics(6.0f, false));
+		created.Clusters[3].isRightToLeft = RightToLeftCluster;
+
+		DWRITE_TEXT_METRICS const metrics = { 0.0f, 5.0f, 26.0f, 26.0f, 40.0f, 100.0f, 60.0f, 1, 2 };
+		created.Metrics = metrics;
+		created.Alignment = Alignment;
+		created.Direction = Direction;
+
+		*layout = &created;
+		return S_OK;
+	}
+
+	int Created() const { return m_Created; }
+
+	DWRITE_TEXT_ALIGNMENT Alignment;
+	DWRITE_READING_DIRECTION Direction;
+	bool RightToLeftCluster;
+
+private:
+	IDWriteTextLayoutFake m_Layouts[8];
+	int m_Created;
+};
+
+ref class MockedTextLayoutCache
+{
+public:
+	MockedTextLayoutCache(int capacity)
+		: mockFactory(new IDWriteFactoryMock),
+		mockFormat(new IDWriteTextFormatMock),
+		source(new TextLayoutSource)
+	{
+		EXPECT_CALL(*mockFactory, CreateTextLayout(NotNull(), _, static_cast<IDWriteTextFormat *>(mockFormat), _, _, NotNull()))
+			.WillRepeatedly(Invoke(source, &TextLayoutSource::Create));
+		factory = Factory::FromPointer(IntPtr(mockFactory));
+		format = TextFormat::FromPointer(IntPtr(mockFormat));
+		cache = gcnew TextLayoutCache(factory, capacity);
+	}
+	~MockedTextLayoutCache()
+	{
+		delete cache;
+		cache = nullptr;
+		delete format;
+		format = nullptr;
+		delete factory;
+		factory = nullptr;
+		delete source;
+		source = 0;
+		delete mockFormat;
+		mockFormat = 0;
+		delete mockFactory;
+		mockFactory = 0;
+	}
+	property TextLayoutCache ^Cache
+	{
+		TextLayoutCache ^get() { return cache; }
+	}
+	property TextFormat ^Format
+	{
+		TextFormat ^get() { return format; }
+	}
+	property IDWriteTextFormatMock &FormatMock
+	{
+		IDWriteTextFormatMock &get() { return *mockFormat; }
+	}
+	property TextLayoutSource &Source
+	{
+		TextLayoutSource &get() { return *source; }
+	}
+	property Factory ^LayoutFactory
+	{
+		Factory ^get() { return factory; }
+	}
+
+private:
+	IDWriteFactoryMock *mockFactory;
+	IDWriteTextFormatMock *mockFormat;
+	TextLayoutSource *source;
+	Factory ^factory;
+	TextFormat ^format;
+	TextLayoutCache ^cache;
+};
+
+class TextLayoutCacheTest : public SlimDXTest
+{
+};
+
+#define TEXT_LAYOUT_CACHE_TEST(name_) TEST_F(TextLayoutCacheTest, name_)
+
+TEXT_LAYOUT_CACHE_TEST(ConstructorValidatesArguments)
+{
+	MockedTextLayoutCache cache(1);
+	TextLayoutCache ^other;
+	ASSERT_MANAGED_THROW(other = gcnew TextLayoutCache(nullptr, 1), ArgumentNullException);
+	ASSERT_MANAGED_THROW(other = gcnew TextLayoutCache(cache.LayoutFactory, 0), ArgumentOutOfRangeException);
+	ASSERT_EQ(1, cache.Cache->Capacity);
+}
+
+TEXT_LAYOUT_CACHE_TEST(NullArgumentsThrow)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayout ^layout;
+	ASSERT_MANAGED_THROW(layout = cache.Cache->GetLayout(nullptr, cache.Format, 100.0f, 60.0f), ArgumentNullException);
+	ASSERT_MANAGED_THROW(layout = cache.Cache->GetLayout("ab cd", nullptr, 100.0f, 60.0f), ArgumentNullException);
+	ASSERT_EQ(0, cache.Source.Created());
+}
+
+TEXT_LAYOUT_CACHE_TEST(SameKeyReturnsCachedLayout)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayout ^first = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+	TextLayout ^second = cache.Cache->GetLayout(gcnew String("ab cd"), cache.Format, 100.0f, 60.0f);
+
+	ASSERT_TRUE(Object::ReferenceEquals(first, second));
+	ASSERT_EQ(1, cache.Source.Created());
+	ASSERT_EQ(1, cache.Cache->Count);
+	ASSERT_EQ(1, cache.Cache->HitCount);
+	ASSERT_EQ(1, cache.Cache->MissCount);
+}
+
+TEXT_LAYOUT_CACHE_TEST(DifferentTextOrSizeCreatesNewLayout)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayout ^layout = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+	ASSERT_FALSE(Object::ReferenceEquals(layout, cache.Cache->GetLayout("ab ce", cache.Format, 100.0f, 60.0f)));
+	ASSERT_FALSE(Object::ReferenceEquals(layout, cache.Cache->GetLayout("ab cd", cache.Format, 101.0f, 60.0f)));
+	ASSERT_FALSE(Object::ReferenceEquals(layout, cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 61.0f)));
+
+	ASSERT_EQ(4, cache.Source.Created());
+	ASSERT_EQ(4, cache.Cache->Count);
+	ASSERT_EQ(0, cache.Cache->HitCount);
+	ASSERT_EQ(4, cache.Cache->MissCount);
+}
+
+TEXT_LAYOUT_CACHE_TEST(EvictsLeastRecentlyUsedLayout)
+{
+	MockedTextLayoutCache cache(2);
+	TextLayout ^a = cache.Cache->GetLayout("a", cache.Format, 100.0f, 60.0f);
+	TextLayout ^b = cache.Cache->GetLayout("b", cache.Format, 100.0f, 60.0f);
+	ASSERT_TRUE(Object::ReferenceEquals(a, cache.Cache->GetLayout("a", cache.Format, 100.0f, 60.0f)));
+	TextLayout ^c = cache.Cache->GetLayout("c", cache.Format, 100.0f, 60.0f);
+
+	ASSERT_EQ(2, cache.Cache->Count);
+	ASSERT_EQ(1, cache.Cache->EvictionCount);
+	ASSERT_TRUE(b->Disposed);
+	ASSERT_FALSE(a->Disposed);
+	ASSERT_FALSE(c->Disposed);
+
+	TextLayout ^newB = cache.Cache->GetLayout("b", cache.Format, 100.0f, 60.0f);
+	ASSERT_FALSE(Object::ReferenceEquals(b, newB));
+	ASSERT_TRUE(a->Disposed);
+	ASSERT_EQ(4, cache.Source.Created());
+	ASSERT_EQ(2, cache.Cache->EvictionCount);
+}
+
+TEXT_LAYOUT_CACHE_TEST(FormatChangeMissesAndInvalidateRemovesLayouts)
+{
+	MockedTextLayoutCache cache(4);
+	EXPECT_CALL(cache.FormatMock, SetWordWrapping(DWRITE_WORD_WRAPPING_NO_WRAP))
+		.Times(1)
+		.WillOnce(Return(S_OK));
+	TextLayout ^before = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+	cache.Format->WordWrapping = WordWrapping::NoWrap;
+	TextLayout ^after = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+
+	ASSERT_FALSE(Object::ReferenceEquals(before, after));
+	ASSERT_EQ(2, cache.Cache->MissCount);
+	ASSERT_EQ(2, cache.Cache->Count);
+
+	ASSERT_EQ(2, cache.Cache->Invalidate(cache.Format));
+	ASSERT_EQ(0, cache.Cache->Count);
+	ASSERT_TRUE(before->Disposed);
+	ASSERT_TRUE(after->Disposed);
+}
+
+TEXT_LAYOUT_CACHE_TEST(LayoutDisposedByCallerIsRecreated)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayout ^layout = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+	delete layout;
+	TextLayout ^recreated = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+
+	ASSERT_FALSE(recreated->Disposed);
+	ASSERT_EQ(1, cache.Cache->Count);
+	ASSERT_EQ(0, cache.Cache->HitCount);
+	ASSERT_EQ(2, cache.Cache->MissCount);
+}
+
+TEXT_LAYOUT_CACHE_TEST(ClearDisposesLayouts)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayout ^a = cache.Cache->GetLayout("a", cache.Format, 100.0f, 60.0f);
+	TextLayout ^b = cache.Cache->GetLayout("b", cache.Format, 100.0f, 60.0f);
+	cache.Cache->Clear();
+
+	ASSERT_EQ(0, cache.Cache->Count);
+	ASSERT_TRUE(a->Disposed);
+	ASSERT_TRUE(b->Disposed);
+}
+
+TEXT_LAYOUT_CACHE_TEST(SnapshotIsCachedWithItsLayout)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayoutSnapshot ^snapshot = cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f);
+
+	ASSERT_TRUE(Object::ReferenceEquals(snapshot, cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f)));
+	ASSERT_EQ(1, cache.Source.Created());
+	ASSERT_EQ(2, snapshot->Lines->Count);
+	ASSERT_EQ(5, snapshot->Clusters->Count);
+	ASSERT_EQ(5.0f, snapshot->Metrics.Top);
+	ASSERT_TRUE(snapshot->IsHitTestingExact);
+}
+
+TEXT_LAYOUT_CACHE_TEST(SnapshotHitTestsTextPositions)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayoutSnapshot ^snapshot = cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f);
+
+	float x = -1.0f;
+	float y = -1.0f;
+	HitTestMetrics metrics = snapshot->HitTestTextPosition(1, false, x, y);
+	ASSERT_EQ(1, metrics.TextPosition);
+	ASSERT_EQ(1, metrics.Length);
+	ASSERT_EQ(10.0f, metrics.Left);
+	ASSERT_EQ(5.0f, metrics.Top);
+	ASSERT_EQ(12.0f, metrics.Width);
+	ASSERT_EQ(20.0f, metrics.Height);
+	ASSERT_EQ(10.0f, x);
+	ASSERT_EQ(5.0f, y);
+
+	snapshot->HitTestTextPosition(1, true, x, y);
+	ASSERT_EQ(22.0f, x);
+
+	metrics = snapshot->HitTestTextPosition(4, false, x, y);
+	ASSERT_EQ(4, metrics.TextPosition);
+	ASSERT_EQ(8.0f, x);
+	ASSERT_EQ(25.0f, y);
+}
+
+TEXT_LAYOUT_CACHE_TEST(SnapshotHitTestsPoints)
+{
+	MockedTextLayoutCache cache(4);
+	TextLayoutSnapshot ^snapshot = cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f);
+
+	bool isTrailingHit = true;
+	bool isInside = false;
+	HitTestMetrics metrics = snapshot->HitTestPoint(15.0f, 10.0f, isTrailingHit, isInside);
+	ASSERT_EQ(1, metrics.TextPosition);
+	ASSERT_FALSE(isTrailingHit);
+	ASSERT_TRUE(isInside);
+
+	metrics = snapshot->HitTestPoint(20.0f, 10.0f, isTrailingHit, isInside);
+	ASSERT_EQ(1, metrics.TextPosition);
+	ASSERT_TRUE(isTrailingHit);
+	ASSERT_TRUE(isInside);
+
+	metrics = snapshot->HitTestPoint(50.0f, 30.0f, isTrailingHit, isInside);
+	ASSERT_EQ(4, metrics.TextPosition);
+	ASSERT_EQ(25.0f, metrics.Top);
+	ASSERT_TRUE(isTrailingHit);
+	ASSERT_FALSE(isInside);
+
+	metrics = snapshot->HitTestPoint(2.0f, 0.0f, isTrailingHit, isInside);
+	ASSERT_EQ(0, metrics.TextPosition);
+	ASSERT_FALSE(isTrailingHit);
+	ASSERT_FALSE(isInside);
+}
+
+TEXT_LAYOUT_CACHE_TEST(SnapshotAppliesAlignmentWithoutTrailingWhitespace)
+{
+	MockedTextLayoutCache cache(4);
+	cache.Source.Alignment = DWRITE_TEXT_ALIGNMENT_CENTER;
+	TextLayoutSnapshot ^centered = cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f);
+	cache.Source.Alignment = DWRITE_TEXT_ALIGNMENT_TRAILING;
+	TextLayoutSnapshot ^trailing = cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 61.0f);
+
+	float x, y;
+	centered->HitTestTextPosition(0, false, x, y);
+	ASSERT_EQ(39.0f, x);
+	centered->HitTestTextPosition(3, false, x, y);
+	ASSERT_EQ(43.0f, x);
+	trailing->HitTestTextPosition(0, false, x, y);
+	ASSERT_EQ(78.0f, x);
+	trailing->HitTestTextPosition(4, true, x, y);
+	ASSERT_EQ(100.0f, x);
+}
+
+TEXT_LAYOUT_CACHE_TEST(SnapshotOfBidiTextIsNotExact)
+{
+	MockedTextLayoutCache cache(4);
+	cache.Source.RightToLeftCluster = true;
+	ASSERT_FALSE(cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f)->IsHitTestingExact);
+
+	cache.Source.RightToLeftCluster = false;
+	cache.Source.Direction = DWRITE_READING_DIRECTION_RIGHT_TO_LEFT;
+	ASSERT_FALSE(cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 61.0f)->IsHitTestingExact);
+}
+
+TEXT_LAYOUT_CACHE_TEST(SnapshotOutlivesEvictedLayout)
+{
+	MockedTextLayoutCache cache(1);
+	TextLayoutSnapshot ^snapshot = cache.Cache->GetSnapshot("ab cd", cache.Format, 100.0f, 60.0f);
+	TextLayout ^evicted = cache.Cache->GetLayout("ab cd", cache.Format, 100.0f, 60.0f);
+	cache.Cache->GetLayout("other", cache.Format, 100.0f, 60.0f);
+
+	ASSERT_TRUE(evicted->Disposed);
+	float x, y;
+	ASSERT_EQ(3, snapshot->HitTestTextPosition(3, false, x, y).TextPosition);
+	ASSERT_EQ(25.0f, y);
+}
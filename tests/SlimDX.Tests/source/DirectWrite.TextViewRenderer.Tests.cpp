@@ -0,0 +1,488 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <dwrite.h>
+
+#include "Asserts.h"
+#include "IDWriteFontFaceMock.h"
+#include "IDWriteTextLayoutMock.h"
+#include "ScopedThrowOnError.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace SlimDX;
+using namespace SlimDX::DirectWrite;
+
+static UINT16 const GlyphIndices[] = { 36, 69, 70 };
+static FLOAT const GlyphAdvances[] = { 7.5f, 6.25f, 5.0f };
+static DWRITE_GLYPH_OFFSET const GlyphOffsets[] = { { 0.5f, -1.0f }, { 0.0f, 0.0f }, { 1.5f, 2.0f } };
+static WCHAR const RunText[] = L"abc";
+static UINT16 const RunClusterMap[] = { 0, 1, 2 };
+
+// The glyph runs and decorations a mocked IDWriteTextLayout::Draw feeds
+// to the renderer it is given; passed through as the drawing context.
+struct DrawScript
+{
+	DWRITE_GLYPH_RUN Run;
+	DWRITE_GLYPH_RUN_DESCRIPTION Description;
+	DWRITE_UNDERLINE Underline;
+	DWRITE_STRIKETHROUGH Strikethrough;
+	int GlyphRunCount;
+	bool DrawDecorations;
+
+	DrawScript(IDWriteFontFace *fontFace, int glyphRunCount, bool drawDecorations)
+		: GlyphRunCount(glyphRunCount),
+		DrawDecorations(drawDecorations)
+	{
+		Run.fontFace = fontFace;
+		Run.fontEmSize = 14.0f;
+		Run.glyphCount = NUM_OF(GlyphIndices);
+		Run.glyphIndices = GlyphIndices;
+		Run.glyphAdvances = GlyphAdvances;
+		Run.glyphOffsets = GlyphOffsets;
+		Run.isSideways = TRUE;
+		Run.bidiLevel = 2;
+
+		Description.localeName = L"en-us";
+		Description.string = RunText;
+		Description.stringLength = NUM_OF(RunText) - 1;
+		Description.clusterMap = RunClusterMap;
+		Description.textPosition = 7;
+
+		Underline.width = 19.0f;
+		Underline.thickness = 1.5f;
+		Underline.offset = 2.5f;
+		Underline.runHeight = 16.0f;
+		Underline.readingDirection = DWRITE_READING_DIRECTION_RIGHT_TO_LEFT;
+		Underline.flowDirection = DWRITE_FLOW_DIRECTION_TOP_TO_BOTTOM;
+		Underline.localeName = L"fr-fr";
+		Underline.measuringMode = DWRITE_MEASURING_MODE_GDI_NATURAL;
+
+		Strikethrough.width = 21.0f;
+		Strikethrough.thickness = 0.75f;
+		Strikethrough.offset = -4.0f;
+		Strikethrough.readingDirection = DWRITE_READING_DIRECTION_LEFT_TO_RIGHT;
+		Strikethrough.flowDirection = DWRITE_FLOW_DIRECTION_TOP_TO_BOTTOM;
+		Strikethrough.localeName = L"de-de";
+		Strikethrough.measuringMode = DWRITE_MEASURING_MODE_GDI_CLASSIC;
+	}
+};
+
+static HRESULT ReplayDrawScript(void *clientDrawingContext, IDWriteTextRenderer *renderer, FLOAT originX, FLOAT originY)
+{
+	DrawScript *script = static_cast<DrawScript *>(clientDrawingContext);
+	for (int i = 0; i < script->GlyphRunCount; ++i)
+	{
+		HRESULT hr = renderer->DrawGlyphRun(clientDrawingContext, originX, originY + 20.0f*i,
+			DWRITE_MEASURING_MODE_GDI_CLASSIC, &script->Run, &script->Description, 0);
+		if (FAILED(hr))
+			return hr;
+	}
+
+	if (script->DrawDecorations)
+	{
+		HRESULT hr = renderer->DrawUnderline(clientDrawingContext, originX, originY + 3.0f, &script->Underline, 0);
+		if (FAILED(hr))
+			return hr;
+
+		hr = renderer->DrawStrikethrough(clientDrawingContext, originX, originY - 3.0f, &script->Strikethrough, 0);
+		if (FAILED(hr))
+			return hr;
+	}
+
+	return S_OK;
+}
+
+// Views are only valid inside the callback, so the fake copies out
+// everything the tests look at before returning.
+ref class TextViewRendererFake : public ITextViewRenderer
+{
+public:
+	TextViewRendererFake()
+		: DrawResult(S_OK)
+	{
+	}
+
+	virtual Matrix3x2 GetCurrentTransform(IntPtr drawingContext) { return Matrix3x2::Identity; }
+	virtual float GetPixelsPerDip(IntPtr drawingContext) { return 1.0f; }
+	virtual bool IsPixelSnappingDisabled(IntPtr drawingContext) { return false; }
+
+	virtual Result DrawGlyphRun(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, MeasuringMode measuringMode,
+		GlyphRunView glyphRun, GlyphRunDescriptionView glyphRunDescription, IntPtr clientDrawingEffect)
+	{
+		++GlyphRunCalls;
+		DrawingContext = drawingContext;
+		OriginX = baselineOriginX;
+		OriginY = baselineOriginY;
+		Mode = measuringMode;
+
+		FontFacePointer = glyphRun.FontFacePointer;
+		FontSize = glyphRun.FontSize;
+		IsSideways = glyphRun.IsSideways;
+		BidiLevel = glyphRun.BidiLevel;
+		Indices = gcnew array<short>(glyphRun.GlyphCount);
+		glyphRun.CopyGlyphIndices(Indices, 0);
+		Advances = gcnew array<float>(glyphRun.GlyphCount);
+		glyphRun.CopyGlyphAdvances(Advances, 0);
+		Offsets = gcnew array<GlyphOffset>(glyphRun.GlyphCount);
+		glyphRun.CopyGlyphOffsets(Offsets, 0);
+		IndicesPointer = glyphRun.GlyphIndicesPointer;
+
+		Text = glyphRunDescription.Text;
+		LocaleName = glyphRunDescription.LocaleName;
+		TextPosition = glyphRunDescription.TextPosition;
+		ClusterMap = gcnew array<short>(glyphRunDescription.StringLength);
+		glyphRunDescription.CopyClusterMap(ClusterMap, 0);
+
+		return Result(DrawResult);
+	}
+
+	virtual Result DrawInlineObject(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, InlineObject^ inlineObject,
+		bool isSideways, bool isRightToLeft, IntPtr clientDrawingEffect)
+	{
+		return Result(E_NOTIMPL);
+	}
+
+	virtual Result DrawStrikethrough(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, StrikethroughView strikethrough, IntPtr clientDrawingEffect)
+	{
+		StrikethroughCopy = strikethrough.ToStrikethrough();
+		return Result(DrawResult);
+	}
+
+	virtual Result DrawUnderline(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, UnderlineView underline, IntPtr clientDrawingEffect)
+	{
+		UnderlineRunHeight = underline.RunHeight;
+		UnderlineCopy = underline.ToUnderline();
+		return Result(DrawResult);
+	}
+
+	int DrawResult;
+	int GlyphRunCalls;
+	IntPtr DrawingContext;
+	float OriginX;
+	float OriginY;
+	MeasuringMode Mode;
+	IntPtr FontFacePointer;
+	float FontSize;
+	bool IsSideways;
+	int BidiLevel;
+	array<short>^ Indices;
+	array<float>^ Advances;
+	array<GlyphOffset>^ Offsets;
+	IntPtr IndicesPointer;
+	String^ Text;
+	String^ LocaleName;
+	int TextPosition;
+	array<short>^ ClusterMap;
+	float UnderlineRunHeight;
+	Underline^ UnderlineCopy;
+	Strikethrough^ StrikethroughCopy;
+};
+
+// Records the argument objects handed to the allocating renderer
+// interface, along with the locale and first glyph index each one held
+// at the time.
+ref class TextRendererFake : public ITextRenderer
+{
+public:
+	TextRendererFake()
+		: Runs(gcnew List<GlyphRun^>()),
+		Descriptions(gcnew List<GlyphRunDescription^>()),
+		Locales(gcnew List<String^>()),
+		FirstGlyphs(gcnew List<short>())
+	{
+	}
+
+	virtual Matrix3x2 GetCurrentTransform(IntPtr drawingContext) { return Matrix3x2::Identity; }
+	virtual float GetPixelsPerDip(IntPtr drawingContext) { return 1.0f; }
+	virtual bool IsPixelSnappingDisabled(IntPtr drawingContext) { return false; }
+
+	virtual Result DrawGlyphRun(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, MeasuringMode measuringMode,
+		GlyphRun^ glyphRun, GlyphRunDescription^ glyphRunDescription, IntPtr clientDrawingEffect)
+	{
+		Runs->Add(glyphRun);
+		Descriptions->Add(glyphRunDescription);
+		Locales->Add(glyphRunDescription->LocaleName);
+		FirstGlyphs->Add(glyphRun->GlyphIndices[0]);
+
+		// the next run of the script differs, so a reused instance must be reassigned
+		DrawScript *script = static_cast<DrawScript *>(drawingContext.ToPointer());
+		const_cast<UINT16 *>(script->Run.glyphIndices)[0]++;
+		return Result(S_OK);
+	}
+
+	virtual Result DrawInlineObject(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, InlineObject^ inlineObject,
+		bool isSideways, bool isRightToLeft, IntPtr clientDrawingEffect)
+	{
+		return Result(E_NOTIMPL);
+	}
+
+	virtual Result DrawStrikethrough(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, Strikethrough^ strikethrough, IntPtr clientDrawingEffect)
+	{
+		return Result(S_OK);
+	}
+
+	virtual Result DrawUnderline(IntPtr drawingContext, float baselineOriginX, float baselineOriginY, Underline^ underline, IntPtr clientDrawingEffect)
+	{
+		return Result(S_OK);
+	}
+
+	List<GlyphRun^>^ Runs;
+	List<GlyphRunDescription^>^ Descriptions;
+	List<String^>^ Locales;
+	List<short>^ FirstGlyphs;
+};
+
+class TextViewRendererTest : public SlimDXTest
+{
+};
+
+#define TEXT_VIEW_RENDERER_TEST(name_) TEST_F(TextViewRendererTest, name_)
+
+TEXT_VIEW_RENDERER_TEST(DrawPassesGlyphRunView)
+{
+	IDWriteFontFaceMock mockFace;
+	IDWriteTextLayoutMock mockLayout;
+	DrawScript script(&mockFace, 1, false);
+	EXPECT_CALL(mockLayout, Draw(static_cast<void *>(&script), NotNull(), 12.5f, 33.0f))
+		.Times(1)
+		.WillOnce(Invoke(ReplayDrawScript));
+	TextLayout ^layout = TextLayout::FromPointer(IntPtr(&mockLayout));
+	TextViewRendererFake ^renderer = gcnew TextViewRendererFake();
+
+	ASSERT_TRUE(layout->Draw(IntPtr(&script), renderer, 12.5f, 33.0f).IsSuccess);
+	delete layout;
+
+	ASSERT_EQ(1, renderer->GlyphRunCalls);
+	ASSERT_TRUE(IntPtr(&script) == renderer->DrawingContext);
+	ASSERT_EQ(12.5f, renderer->OriginX);
+	ASSERT_EQ(33.0f, renderer->OriginY);
+	ASSERT_EQ(static_cast<int>(MeasuringMode::GdiClassic), static_cast<int>(renderer->Mode));
+	ASSERT_TRUE(IntPtr(&mockFace) == renderer->FontFacePointer);
+	ASSERT_EQ(14.0f, renderer->FontSize);
+	ASSERT_TRUE(renderer->IsSideways);
+	ASSERT_EQ(2, renderer->BidiLevel);
+	ASSERT_TRUE(IntPtr(const_cast<UINT16 *>(GlyphIndices)) == renderer->IndicesPointer);
+	ASSERT_EQ(3, renderer->Indices->Length);
+	for (int i = 0; i < 3; ++i)
+	{
+		ASSERT_EQ(GlyphIndices[i], renderer->Indices[i]);
+		ASSERT_EQ(GlyphAdvances[i], renderer->Advances[i]);
+		ASSERT_EQ(GlyphOffsets[i].advanceOffset, renderer->Offsets[i].AdvanceOffset);
+		ASSERT_EQ(GlyphOffsets[i].ascenderOffset, renderer->Offsets[i].AscenderOffset);
+		ASSERT_EQ(RunClusterMap[i], renderer->ClusterMap[i]);
+	}
+	ASSERT_TRUE(gcnew String("abc") == renderer->Text);
+	ASSERT_TRUE(gcnew String("en-us") == renderer->LocaleName);
+	ASSERT_EQ(7, renderer->TextPosition);
+}
+
+TEXT_VIEW_RENDERER_TEST(DrawPassesDecorationViews)
+{
+	IDWriteTextLayoutMock mockLayout;
+	DrawScript script(0, 0, true);
+	EXPECT_CALL(mockLayout, Draw(static_cast<void *>(&script), NotNull(), 0.0f, 0.0f))
+		.Times(1)
+		.WillOnce(Invoke(ReplayDrawScript));
+	TextLayout ^layout = TextLayout::FromPointer(IntPtr(&mockLayout));
+	TextViewRendererFake ^renderer = gcnew TextViewRendererFake();
+
+	ASSERT_TRUE(layout->Draw(IntPtr(&script), renderer, 0.0f, 0.0f).IsSuccess);
+	delete layout;
+
+	ASSERT_EQ(0, renderer->GlyphRunCalls);
+	ASSERT_EQ(16.0f, renderer->UnderlineRunHeight);
+	Underline ^underline = renderer->UnderlineCopy;
+	ASSERT_TRUE(underline != nullptr);
+	ASSERT_EQ(19.0f, underline->Width);
+	ASSERT_EQ(1.5f, underline->Thickness);
+	ASSERT_EQ(2.5f, underline->Offset);
+	ASSERT_EQ(16.0f, underline->RunHeight);
+	ASSERT_EQ(static_cast<int>(ReadingDirection::RightToLeft), static_cast<int>(underline->ReadingDirection));
+	ASSERT_EQ(static_cast<int>(MeasuringMode::GdiNatural), static_cast<int>(underline->MeasuringMode));
+	ASSERT_TRUE(gcnew String("fr-fr") == underline->LocaleName);
+
+	Strikethrough ^strikethrough = renderer->StrikethroughCopy;
+	ASSERT_TRUE(strikethrough != nullptr);
+	ASSERT_EQ(21.0f, strikethrough->Width);
+	ASSERT_EQ(0.75f, strikethrough->Thickness);
+	ASSERT_EQ(-4.0f, strikethrough->Offset);
+	ASSERT_EQ(static_cast<int>(MeasuringMode::GdiClassic), static_cast<int>(strikethrough->MeasuringMode));
+	ASSERT_TRUE(gcnew String("de-de") == strikethrough->LocaleName);
+}
+
+TEXT_VIEW_RENDERER_TEST(RendererFailureIsReturnedFromDraw)
+{
+	SCOPED_THROW_ON_ERROR(false);
+	IDWriteTextLayoutMock mockLayout;
+	DrawScript script(0, 2, false);
+	EXPECT_CALL(mockLayout, Draw(static_cast<void *>(&script), NotNull(), 0.0f, 0.0f))
+		.Times(1)
+		.WillOnce(Invoke(ReplayDrawScript));
+	TextLayout ^layout = TextLayout::FromPointer(IntPtr(&mockLayout));
+	TextViewRendererFake ^renderer = gcnew TextViewRendererFake();
+	renderer->DrawResult = E_ABORT;
+
+	Result result = layout->Draw(IntPtr(&script), renderer, 0.0f, 0.0f);
+	delete layout;
+
+	ASSERT_EQ(E_ABORT, result.Code);
+	ASSERT_EQ(1, renderer->GlyphRunCalls);
+}
+
+TEXT_VIEW_RENDERER_TEST(EmptyViewsThrow)
+{
+	GlyphRunView run;
+	GlyphRunDescriptionView description;
+	UnderlineView underline;
+	StrikethroughView strikethrough;
+	ASSERT_TRUE(run.IsEmpty);
+	ASSERT_TRUE(description.IsEmpty);
+	ASSERT_TRUE(underline.IsEmpty);
+	ASSERT_TRUE(strikethrough.IsEmpty);
+	int count;
+	String ^text;
+	float width;
+	ASSERT_MANAGED_THROW(count = run.GlyphCount, InvalidOperationException);
+	ASSERT_MANAGED_THROW(text = description.Text, InvalidOperationException);
+	ASSERT_MANAGED_THROW(width = underline.Width, InvalidOperationException);
+	ASSERT_MANAGED_THROW(width = strikethrough.Width, InvalidOperationException);
+}
+
+TEXT_VIEW_RENDERER_TEST(GlyphRunViewChecksIndices)
+{
+	DrawScript script(0, 1, false);
+	GlyphRunView run(&script.Run);
+	ASSERT_EQ(70, run.GetGlyphIndex(2));
+	ASSERT_MANAGED_THROW(run.GetGlyphIndex(-1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(run.GetGlyphIndex(3), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(run.GetGlyphAdvance(3), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(run.GetGlyphOffset(3), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(run.CopyGlyphIndices(nullptr, 0), ArgumentNullException);
+	ASSERT_MANAGED_THROW(run.CopyGlyphIndices(gcnew array<short>(2), 0), ArgumentException);
+	ASSERT_MANAGED_THROW(run.CopyGlyphIndices(gcnew array<short>(3), 1), ArgumentException);
+
+	array<short>^ indices = gcnew array<short>(5);
+	run.CopyGlyphIndices(indices, 2);
+	ASSERT_EQ(0, indices[1]);
+	ASSERT_EQ(36, indices[2]);
+	ASSERT_EQ(70, indices[4]);
+
+	GlyphRunDescriptionView description(&script.Description);
+	ASSERT_EQ(3, description.StringLength);
+	ASSERT_EQ(2, description.GetClusterMapEntry(2));
+	ASSERT_MANAGED_THROW(description.GetClusterMapEntry(3), ArgumentOutOfRangeException);
+}
+
+TEXT_VIEW_RENDERER_TEST(GlyphRunViewWithoutAdvancesOrOffsetsReadsZero)
+{
+	DrawScript script(0, 1, false);
+	script.Run.glyphAdvances = 0;
+	script.Run.glyphOffsets = 0;
+	GlyphRunView run(&script.Run);
+
+	ASSERT_EQ(0.0f, run.GetGlyphAdvance(1));
+	ASSERT_EQ(0.0f, run.GetGlyphOffset(1).AdvanceOffset);
+
+	array<float>^ advances = gcnew array<float>(3) { 1.0f, 1.0f, 1.0f };
+	run.CopyGlyphAdvances(advances, 0);
+	array<GlyphOffset>^ offsets = gcnew array<GlyphOffset>(3);
+	offsets[2].AscenderOffset = 1.0f;
+	run.CopyGlyphOffsets(offsets, 0);
+	for (int i = 0; i < 3; ++i)
+	{
+		ASSERT_EQ(0.0f, advances[i]);
+		ASSERT_EQ(0.0f, offsets[i].AscenderOffset);
+	}
+}
+
+TEXT_VIEW_RENDERER_TEST(DescriptionCopyOutlivesView)
+{
+	WCHAR text[] = L"xyz";
+	DrawScript script(0, 1, false);
+	script.Description.string = text;
+	GlyphRunDescription ^copy = GlyphRunDescriptionView(&script.Description).ToGlyphRunDescription();
+	text[0] = L'q';
+
+	ASSERT_TRUE(gcnew String("xyz") == copy->Text);
+	ASSERT_TRUE(gcnew String("en-us") == copy->LocaleName);
+	ASSERT_EQ(3, copy->ClusterMap->Length);
+	ASSERT_EQ(7, copy->TextPosition);
+}
+
+TEXT_VIEW_RENDERER_TEST(TextRendererAllocatesArgumentsByDefault)
+{
+	ASSERT_FALSE(Configuration::ReuseTextRendererArguments);
+	UINT16 indices[] = { 10, 11, 12 };
+	IDWriteFontFaceMock mockFace;
+	IDWriteTextLayoutMock mockLayout;
+	DrawScript script(&mockFace, 2, false);
+	script.Run.glyphIndices = indices;
+	EXPECT_CALL(mockLayout, Draw(static_cast<void *>(&script), NotNull(), 0.0f, 0.0f))
+		.Times(1)
+		.WillOnce(Invoke(ReplayDrawScript));
+	TextLayout ^layout = TextLayout::FromPointer(IntPtr(&mockLayout));
+	TextRendererFake ^renderer = gcnew TextRendererFake();
+
+	ASSERT_TRUE(layout->Draw(IntPtr(&script), renderer, 0.0f, 0.0f).IsSuccess);
+	delete layout;
+
+	ASSERT_EQ(2, renderer->Runs->Count);
+	ASSERT_FALSE(Object::ReferenceEquals(renderer->Runs[0], renderer->Runs[1]));
+	ASSERT_FALSE(Object::ReferenceEquals(renderer->Descriptions[0], renderer->Descriptions[1]));
+	ASSERT_EQ(10, renderer->Runs[0]->GlyphIndices[0]);
+	ASSERT_EQ(11, renderer->Runs[1]->GlyphIndices[0]);
+	ASSERT_TRUE(Object::ReferenceEquals(renderer->Runs[0]->FontFace, renderer->Runs[1]->FontFace));
+	delete renderer->Runs[0]->FontFace;
+}
+
+TEXT_VIEW_RENDERER_TEST(TextRendererReusesArgumentsWhenConfigured)
+{
+	Configuration::ReuseTextRendererArguments = true;
+	UINT16 indices[] = { 10, 11, 12 };
+	IDWriteFontFaceMock mockFace;
+	IDWriteTextLayoutMock mockLayout;
+	DrawScript script(&mockFace, 2, false);
+	script.Run.glyphIndices = indices;
+	EXPECT_CALL(mockLayout, Draw(static_cast<void *>(&script), NotNull(), 0.0f, 0.0f))
+		.Times(1)
+		.WillOnce(Invoke(ReplayDrawScript));
+	TextLayout ^layout = TextLayout::FromPointer(IntPtr(&mockLayout));
+	TextRendererFake ^renderer = gcnew TextRendererFake();
+
+	Result result = layout->Draw(IntPtr(&script), renderer, 0.0f, 0.0f);
+	Configuration::ReuseTextRendererArguments = false;
+	delete layout;
+
+	ASSERT_TRUE(result.IsSuccess);
+	ASSERT_EQ(2, renderer->Runs->Count);
+	ASSERT_TRUE(Object::ReferenceEquals(renderer->Runs[0], renderer->Runs[1]));
+	ASSERT_TRUE(Object::ReferenceEquals(renderer->Descriptions[0], renderer->Descriptions[1]));
+	ASSERT_EQ(10, renderer->FirstGlyphs[0]);
+	ASSERT_EQ(11, renderer->FirstGlyphs[1]);
+	// the locale did not change between runs, so the string is not reallocated either
+	ASSERT_TRUE(Object::ReferenceEquals(renderer->Locales[0], renderer->Locales[1]));
+	delete renderer->Runs[0]->FontFace;
+}
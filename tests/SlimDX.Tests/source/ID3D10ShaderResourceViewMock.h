@@ -0,0 +1,35 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "CommonMocks.h"
+
+struct ID3D10ShaderResourceViewMock : ID3D10ShaderResourceView {
+	MOCK_IUNKNOWN;
+
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetDevice, void( ID3D10Device** ) );
+	MOCK_METHOD3_WITH_CALLTYPE( STDMETHODCALLTYPE, GetPrivateData, HRESULT( REFGUID, UINT*, void* ) );
+	MOCK_METHOD3_WITH_CALLTYPE( STDMETHODCALLTYPE, SetPrivateData, HRESULT( REFGUID, UINT, const void* ) );
+	MOCK_METHOD2_WITH_CALLTYPE( STDMETHODCALLTYPE, SetPrivateDataInterface, HRESULT( REFGUID, const IUnknown* ) );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetResource, void( ID3D10Resource** ) );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetDesc, void( D3D10_SHADER_RESOURCE_VIEW_DESC* ) );
+};
@@ -0,0 +1,41 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <d3dx10.h>
+
+#include "CommonMocks.h"
+
+struct ID3DX10SpriteMock : ID3DX10Sprite {
+	MOCK_IUNKNOWN;
+
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, Begin, HRESULT( UINT ) );
+	MOCK_METHOD2_WITH_CALLTYPE( STDMETHODCALLTYPE, DrawSpritesBuffered, HRESULT( D3DX10_SPRITE*, UINT ) );
+	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, Flush, HRESULT() );
+	MOCK_METHOD4_WITH_CALLTYPE( STDMETHODCALLTYPE, DrawSpritesImmediate, HRESULT( D3DX10_SPRITE*, UINT, UINT, UINT ) );
+	MOCK_METHOD0_WITH_CALLTYPE( STDMETHODCALLTYPE, End, HRESULT() );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetViewTransform, HRESULT( D3DXMATRIX* ) );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, SetViewTransform, HRESULT( D3DXMATRIX* ) );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetProjectionTransform, HRESULT( D3DXMATRIX* ) );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, SetProjectionTransform, HRESULT( D3DXMATRIX* ) );
+	MOCK_METHOD1_WITH_CALLTYPE( STDMETHODCALLTYPE, GetDevice, HRESULT( ID3D10Device** ) );
+};
@@ -0,0 +1,164 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "Benchmark.h"
+
+using namespace System;
+using namespace SlimDX;
+
+// Each iteration of the array benchmarks processes a whole array, so the
+// reported time covers MatrixElements or VectorElements values.
+static const int MatrixElements = 256;
+static const int VectorElements = 1024;
+
+static Matrix CreateTransform()
+{
+	return Matrix::RotationYawPitchRoll(0.3f, 0.5f, 0.7f) * Matrix::Translation(1.0f, 2.0f, 3.0f);
+}
+
+static array<Vector3> ^CreateVectors()
+{
+	array<Vector3> ^vectors = gcnew array<Vector3>(VectorElements);
+	for (int i = 0; i < vectors->Length; ++i)
+		vectors[i] = Vector3(static_cast<float>(i), 1.0f, -static_cast<float>(i));
+	return vectors;
+}
+
+BENCHMARK(Matrix, Multiply)
+{
+	Matrix left = CreateTransform();
+	Matrix right = Matrix::Scaling(2.0f, 2.0f, 2.0f);
+	Matrix result;
+	while (state.KeepRunning())
+	{
+		Matrix::Multiply(left, right, result);
+		left.M41 = result.M11;
+	}
+	BenchmarkConsume(result.M11);
+}
+
+BENCHMARK(Matrix, MultiplyArray)
+{
+	array<Matrix> ^left = gcnew array<Matrix>(MatrixElements);
+	array<Matrix> ^right = gcnew array<Matrix>(MatrixElements);
+	array<Matrix> ^result = gcnew array<Matrix>(MatrixElements);
+	for (int i = 0; i < MatrixElements; ++i)
+	{
+		left[i] = CreateTransform();
+		right[i] = Matrix::Scaling(1.0f, static_cast<float>(i), 1.0f);
+	}
+	while (state.KeepRunning())
+	{
+		Matrix::Multiply(left, right, result);
+	}
+	BenchmarkConsume(result[MatrixElements - 1].M11);
+}
+
+BENCHMARK(Matrix, MultiplyArrayBySingle)
+{
+	array<Matrix> ^left = gcnew array<Matrix>(MatrixElements);
+	array<Matrix> ^result = gcnew array<Matrix>(MatrixElements);
+	for (int i = 0; i < MatrixElements; ++i)
+		left[i] = Matrix::Translation(static_cast<float>(i), 0.0f, 0.0f);
+	Matrix right = CreateTransform();
+	while (state.KeepRunning())
+	{
+		Matrix::Multiply(left, right, result);
+	}
+	BenchmarkConsume(result[MatrixElements - 1].M41);
+}
+
+BENCHMARK(Vector3, TransformArray)
+{
+	array<Vector3> ^vectors = CreateVectors();
+	array<Vector4> ^result = gcnew array<Vector4>(VectorElements);
+	Matrix transform = CreateTransform();
+	while (state.KeepRunning())
+	{
+		Vector3::Transform(vectors, transform, result);
+	}
+	BenchmarkConsume(result[VectorElements - 1].W);
+}
+
+BENCHMARK(Vector3, TransformCoordinateArray)
+{
+	array<Vector3> ^vectors = CreateVectors();
+	array<Vector3> ^result = gcnew array<Vector3>(VectorElements);
+	Matrix transform = CreateTransform();
+	while (state.KeepRunning())
+	{
+		Vector3::TransformCoordinate(vectors, transform, result);
+	}
+	BenchmarkConsume(result[VectorElements - 1].X);
+}
+
+BENCHMARK(Vector3, TransformNormalArray)
+{
+	array<Vector3> ^vectors = CreateVectors();
+	array<Vector3> ^result = gcnew array<Vector3>(VectorElements);
+	Matrix transform = CreateTransform();
+	while (state.KeepRunning())
+	{
+		Vector3::TransformNormal(vectors, transform, result);
+	}
+	BenchmarkConsume(result[VectorElements - 1].X);
+}
+
+BENCHMARK(Half, FromFloat)
+{
+	float value = 0.0f;
+	float sum = 0.0f;
+	while (state.KeepRunning())
+	{
+		sum += static_cast<float>(static_cast<Half>(value));
+		value += 0.25f;
+	}
+	BenchmarkConsume(sum);
+}
+
+BENCHMARK(Half, ConvertToHalfArray)
+{
+	array<float> ^values = gcnew array<float>(VectorElements);
+	for (int i = 0; i < values->Length; ++i)
+		values[i] = i * 0.5f;
+	float sum = 0.0f;
+	while (state.KeepRunning())
+	{
+		sum += static_cast<float>(Half::ConvertToHalf(values)[VectorElements - 1]);
+	}
+	BenchmarkConsume(sum);
+}
+
+BENCHMARK(Half, ConvertToFloatArray)
+{
+	array<float> ^values = gcnew array<float>(VectorElements);
+	for (int i = 0; i < values->Length; ++i)
+		values[i] = i * 0.5f;
+	array<Half> ^halves = Half::ConvertToHalf(values);
+	float sum = 0.0f;
+	while (state.KeepRunning())
+	{
+		sum += Half::ConvertToFloat(halves)[VectorElements - 1];
+	}
+	BenchmarkConsume(sum);
+}
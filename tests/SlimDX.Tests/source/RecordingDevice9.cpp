@@ -0,0 +1,931 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "RecordingDevice9.h"
+
+namespace
+{
+	UINT_PTR FloatBits( float value )
+	{
+		DWORD bits;
+		memcpy( &bits, &value, sizeof(bits) );
+		return bits;
+	}
+
+	UINT_PTR Address( const void* object )
+	{
+		return reinterpret_cast<UINT_PTR>( object );
+	}
+
+	UINT GetVertexCount( D3DPRIMITIVETYPE primitiveType, UINT primitiveCount )
+	{
+		switch( primitiveType )
+		{
+		case D3DPT_POINTLIST: return primitiveCount;
+		case D3DPT_LINELIST: return primitiveCount * 2;
+		case D3DPT_LINESTRIP: return primitiveCount + 1;
+		case D3DPT_TRIANGLELIST: return primitiveCount * 3;
+		case D3DPT_TRIANGLESTRIP:
+		case D3DPT_TRIANGLEFAN: return primitiveCount + 2;
+		default: return 0;
+		}
+	}
+}
+
+template< typename Interface, typename Description >
+RecordingBuffer9<Interface, Description>::RecordingBuffer9( RecordingDevice9* device, const Description& description )
+: m_Device( device ), m_ReferenceCount( 1 ), m_Description( description ), m_Contents( description.Size ), m_Priority( 0 ), m_Locked( false )
+{
+	m_Device->AddRef();
+	++m_Device->m_LiveBufferCount;
+}
+
+template< typename Interface, typename Description >
+RecordingBuffer9<Interface, Description>::~RecordingBuffer9()
+{
+	--m_Device->m_LiveBufferCount;
+	m_Device->Release();
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::QueryInterface( REFIID iid, void** object )
+{
+	if( object == NULL )
+		return E_POINTER;
+
+	if( iid == __uuidof(IUnknown) || iid == __uuidof(IDirect3DResource9) || iid == __uuidof(Interface) )
+	{
+		*object = static_cast<Interface*>( this );
+		AddRef();
+		return S_OK;
+	}
+
+	*object = NULL;
+	return E_NOINTERFACE;
+}
+
+template< typename Interface, typename Description >
+ULONG STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::AddRef()
+{
+	return InterlockedIncrement( &m_ReferenceCount );
+}
+
+template< typename Interface, typename Description >
+ULONG STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::Release()
+{
+	ULONG count = InterlockedDecrement( &m_ReferenceCount );
+	if( count == 0 )
+		delete this;
+
+	return count;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::GetDevice( IDirect3DDevice9** device )
+{
+	if( device == NULL )
+		return D3DERR_INVALIDCALL;
+
+	m_Device->AddRef();
+	*device = m_Device;
+	return D3D_OK;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::SetPrivateData( REFGUID, const void*, DWORD, DWORD )
+{
+	return E_NOTIMPL;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::GetPrivateData( REFGUID, void*, DWORD* )
+{
+	return E_NOTIMPL;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::FreePrivateData( REFGUID )
+{
+	return E_NOTIMPL;
+}
+
+template< typename Interface, typename Description >
+DWORD STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::SetPriority( DWORD priority )
+{
+	DWORD previous = m_Priority;
+	m_Priority = priority;
+	return previous;
+}
+
+template< typename Interface, typename Description >
+DWORD STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::GetPriority()
+{
+	return m_Priority;
+}
+
+template< typename Interface, typename Description >
+void STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::PreLoad()
+{
+}
+
+template< typename Interface, typename Description >
+D3DRESOURCETYPE STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::GetType()
+{
+	return m_Description.Type;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::Lock( UINT offset, UINT size, void** data, DWORD flags )
+{
+	UINT_PTR arguments[] = { Address( static_cast<Interface*>( this ) ), offset, size, flags };
+	HRESULT hr = m_Device->Record( "Lock", arguments );
+	if( FAILED( hr ) )
+		return hr;
+
+	// a size of zero locks everything from the offset to the end
+	if( size == 0 )
+		size = offset <= m_Description.Size ? m_Description.Size - offset : 0;
+
+	if( data == NULL || m_Locked || offset > m_Description.Size || size > m_Description.Size - offset )
+		return D3DERR_INVALIDCALL;
+
+	m_Locked = true;
+	*data = &m_Contents[offset];
+	return D3D_OK;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::Unlock()
+{
+	if( !m_Locked )
+		return D3DERR_INVALIDCALL;
+
+	m_Locked = false;
+	return D3D_OK;
+}
+
+template< typename Interface, typename Description >
+HRESULT STDMETHODCALLTYPE RecordingBuffer9<Interface, Description>::GetDesc( Description* description )
+{
+	if( description == NULL )
+		return D3DERR_INVALIDCALL;
+
+	*description = m_Description;
+	return D3D_OK;
+}
+
+template class RecordingBuffer9<IDirect3DVertexBuffer9, D3DVERTEXBUFFER_DESC>;
+template class RecordingBuffer9<IDirect3DIndexBuffer9, D3DINDEXBUFFER_DESC>;
+
+RecordingDevice9::RecordingDevice9()
+: m_ReferenceCount( 1 ), m_FailResult( S_OK ), m_LiveBufferCount( 0 )
+{
+	memset( m_VertexShaderConstants, 0, sizeof(m_VertexShaderConstants) );
+	memset( m_PixelShaderConstants, 0, sizeof(m_PixelShaderConstants) );
+}
+
+RecordingDevice9::~RecordingDevice9()
+{
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::QueryInterface( REFIID iid, void** object )
+{
+	if( object == NULL )
+		return E_POINTER;
+
+	if( iid == __uuidof(IUnknown) || iid == __uuidof(IDirect3DDevice9) )
+	{
+		*object = static_cast<IDirect3DDevice9*>( this );
+		AddRef();
+		return S_OK;
+	}
+
+	*object = NULL;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE RecordingDevice9::AddRef()
+{
+	return InterlockedIncrement( &m_ReferenceCount );
+}
+
+ULONG STDMETHODCALLTYPE RecordingDevice9::Release()
+{
+	ULONG count = InterlockedDecrement( &m_ReferenceCount );
+	if( count == 0 )
+		delete this;
+
+	return count;
+}
+
+void RecordingDevice9::FailCalls( const char* method, HRESULT result )
+{
+	m_FailMethod = method != NULL ? method : "";
+	m_FailResult = result;
+}
+
+HRESULT RecordingDevice9::RecordCall( const char* method, const UINT_PTR* arguments, size_t argumentCount, const void* data, size_t size )
+{
+	RecordedCall9 call;
+	call.Method = method;
+	call.Arguments.assign( arguments, arguments + argumentCount );
+	if( data != NULL && size > 0 )
+		call.Data.assign( static_cast<const BYTE*>( data ), static_cast<const BYTE*>( data ) + size );
+
+	m_Calls.push_back( call );
+	return m_FailMethod == method ? m_FailResult : D3D_OK;
+}
+
+HRESULT RecordingDevice9::RecordConstants( const char* method, UINT startRegister, const void* data, UINT count, size_t registerSize )
+{
+	UINT_PTR arguments[] = { startRegister, count };
+	return Record( method, arguments, data, count * registerSize );
+}
+
+HRESULT RecordingDevice9::SetConstants( float* registers, UINT registerCount, const char* method, UINT startRegister, const float* data, UINT count )
+{
+	HRESULT hr = RecordConstants( method, startRegister, data, count, 4 * sizeof(float) );
+	if( FAILED( hr ) )
+		return hr;
+
+	if( data == NULL || startRegister > registerCount || count > registerCount - startRegister )
+		return D3DERR_INVALIDCALL;
+
+	memcpy( registers + startRegister * 4, data, count * 4 * sizeof(float) );
+	return D3D_OK;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::TestCooperativeLevel()
+{
+	return D3D_OK;
+}
+
+UINT STDMETHODCALLTYPE RecordingDevice9::GetAvailableTextureMem()
+{
+	return 0;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::EvictManagedResources()
+{
+	return D3D_OK;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetDirect3D( IDirect3D9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetDeviceCaps( D3DCAPS9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetDisplayMode( UINT, D3DDISPLAYMODE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetCreationParameters( D3DDEVICE_CREATION_PARAMETERS* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetCursorProperties( UINT, UINT, IDirect3DSurface9* )
+{
+	return E_NOTIMPL;
+}
+
+void STDMETHODCALLTYPE RecordingDevice9::SetCursorPosition( int, int, DWORD )
+{
+}
+
+BOOL STDMETHODCALLTYPE RecordingDevice9::ShowCursor( BOOL )
+{
+	return FALSE;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateAdditionalSwapChain( D3DPRESENT_PARAMETERS*, IDirect3DSwapChain9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetSwapChain( UINT, IDirect3DSwapChain9** )
+{
+	return E_NOTIMPL;
+}
+
+UINT STDMETHODCALLTYPE RecordingDevice9::GetNumberOfSwapChains()
+{
+	return 0;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::Reset( D3DPRESENT_PARAMETERS* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::Present( const RECT*, const RECT*, HWND, const RGNDATA* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetBackBuffer( UINT, UINT, D3DBACKBUFFER_TYPE, IDirect3DSurface9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetRasterStatus( UINT, D3DRASTER_STATUS* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetDialogBoxMode( BOOL )
+{
+	return E_NOTIMPL;
+}
+
+void STDMETHODCALLTYPE RecordingDevice9::SetGammaRamp( UINT, DWORD, const D3DGAMMARAMP* )
+{
+}
+
+void STDMETHODCALLTYPE RecordingDevice9::GetGammaRamp( UINT, D3DGAMMARAMP* )
+{
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateTexture( UINT, UINT, UINT, DWORD, D3DFORMAT, D3DPOOL, IDirect3DTexture9**, HANDLE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateVolumeTexture( UINT, UINT, UINT, UINT, DWORD, D3DFORMAT, D3DPOOL, IDirect3DVolumeTexture9**, HANDLE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateCubeTexture( UINT, UINT, DWORD, D3DFORMAT, D3DPOOL, IDirect3DCubeTexture9**, HANDLE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateVertexBuffer( UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, IDirect3DVertexBuffer9** vertexBuffer,
+	HANDLE* sharedHandle )
+{
+	UINT_PTR arguments[] = { length, usage, fvf, static_cast<UINT_PTR>( pool ) };
+	HRESULT hr = Record( "CreateVertexBuffer", arguments );
+	if( FAILED( hr ) )
+		return hr;
+
+	if( vertexBuffer == NULL || length == 0 || ( sharedHandle != NULL && *sharedHandle != NULL ) )
+		return D3DERR_INVALIDCALL;
+
+	D3DVERTEXBUFFER_DESC description;
+	description.Format = D3DFMT_VERTEXDATA;
+	description.Type = D3DRTYPE_VERTEXBUFFER;
+	description.Usage = usage;
+	description.Pool = pool;
+	description.Size = length;
+	description.FVF = fvf;
+
+	*vertexBuffer = new RecordingVertexBuffer9( this, description );
+	return D3D_OK;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateIndexBuffer( UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, IDirect3DIndexBuffer9** indexBuffer,
+	HANDLE* sharedHandle )
+{
+	UINT_PTR arguments[] = { length, usage, static_cast<UINT_PTR>( format ), static_cast<UINT_PTR>( pool ) };
+	HRESULT hr = Record( "CreateIndexBuffer", arguments );
+	if( FAILED( hr ) )
+		return hr;
+
+	if( indexBuffer == NULL || length == 0 || ( format != D3DFMT_INDEX16 && format != D3DFMT_INDEX32 ) ||
+		( sharedHandle != NULL && *sharedHandle != NULL ) )
+		return D3DERR_INVALIDCALL;
+
+	D3DINDEXBUFFER_DESC description;
+	description.Format = format;
+	description.Type = D3DRTYPE_INDEXBUFFER;
+	description.Usage = usage;
+	description.Pool = pool;
+	description.Size = length;
+
+	*indexBuffer = new RecordingIndexBuffer9( this, description );
+	return D3D_OK;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateRenderTarget( UINT, UINT, D3DFORMAT, D3DMULTISAMPLE_TYPE, DWORD, BOOL, IDirect3DSurface9**, HANDLE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateDepthStencilSurface( UINT, UINT, D3DFORMAT, D3DMULTISAMPLE_TYPE, DWORD, BOOL, IDirect3DSurface9**, HANDLE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::UpdateSurface( IDirect3DSurface9*, const RECT*, IDirect3DSurface9*, const POINT* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::UpdateTexture( IDirect3DBaseTexture9*, IDirect3DBaseTexture9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetRenderTargetData( IDirect3DSurface9*, IDirect3DSurface9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetFrontBufferData( UINT, IDirect3DSurface9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::StretchRect( IDirect3DSurface9*, const RECT*, IDirect3DSurface9*, const RECT*, D3DTEXTUREFILTERTYPE )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::ColorFill( IDirect3DSurface9*, const RECT*, D3DCOLOR )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateOffscreenPlainSurface( UINT, UINT, D3DFORMAT, D3DPOOL, IDirect3DSurface9**, HANDLE* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetRenderTarget( DWORD renderTargetIndex, IDirect3DSurface9* renderTarget )
+{
+	UINT_PTR arguments[] = { renderTargetIndex, Address( renderTarget ) };
+	return Record( "SetRenderTarget", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetRenderTarget( DWORD, IDirect3DSurface9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetDepthStencilSurface( IDirect3DSurface9* depthStencil )
+{
+	UINT_PTR arguments[] = { Address( depthStencil ) };
+	return Record( "SetDepthStencilSurface", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetDepthStencilSurface( IDirect3DSurface9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::BeginScene()
+{
+	return RecordCall( "BeginScene", NULL, 0, NULL, 0 );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::EndScene()
+{
+	return RecordCall( "EndScene", NULL, 0, NULL, 0 );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::Clear( DWORD count, const D3DRECT* rects, DWORD flags, D3DCOLOR color, float z, DWORD stencil )
+{
+	UINT_PTR arguments[] = { count, flags, color, FloatBits( z ), stencil };
+	return Record( "Clear", arguments, rects, rects != NULL ? count * sizeof(D3DRECT) : 0 );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetTransform( D3DTRANSFORMSTATETYPE state, const D3DMATRIX* matrix )
+{
+	UINT_PTR arguments[] = { static_cast<UINT_PTR>( state ) };
+	return Record( "SetTransform", arguments, matrix, matrix != NULL ? sizeof(D3DMATRIX) : 0 );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetTransform( D3DTRANSFORMSTATETYPE, D3DMATRIX* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::MultiplyTransform( D3DTRANSFORMSTATETYPE, const D3DMATRIX* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetViewport( const D3DVIEWPORT9* viewport )
+{
+	return RecordCall( "SetViewport", NULL, 0, viewport, viewport != NULL ? sizeof(D3DVIEWPORT9) : 0 );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetViewport( D3DVIEWPORT9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetMaterial( const D3DMATERIAL9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetMaterial( D3DMATERIAL9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetLight( DWORD, const D3DLIGHT9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetLight( DWORD, D3DLIGHT9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::LightEnable( DWORD, BOOL )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetLightEnable( DWORD, BOOL* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetClipPlane( DWORD, const float* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetClipPlane( DWORD, float* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetRenderState( D3DRENDERSTATETYPE state, DWORD value )
+{
+	UINT_PTR arguments[] = { static_cast<UINT_PTR>( state ), value };
+	return Record( "SetRenderState", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetRenderState( D3DRENDERSTATETYPE, DWORD* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateStateBlock( D3DSTATEBLOCKTYPE, IDirect3DStateBlock9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::BeginStateBlock()
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::EndStateBlock( IDirect3DStateBlock9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetClipStatus( const D3DCLIPSTATUS9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetClipStatus( D3DCLIPSTATUS9* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetTexture( DWORD, IDirect3DBaseTexture9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetTexture( DWORD stage, IDirect3DBaseTexture9* texture )
+{
+	UINT_PTR arguments[] = { stage, Address( texture ) };
+	return Record( "SetTexture", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetTextureStageState( DWORD, D3DTEXTURESTAGESTATETYPE, DWORD* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetTextureStageState( DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD value )
+{
+	UINT_PTR arguments[] = { stage, static_cast<UINT_PTR>( type ), value };
+	return Record( "SetTextureStageState", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetSamplerState( DWORD, D3DSAMPLERSTATETYPE, DWORD* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetSamplerState( DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value )
+{
+	UINT_PTR arguments[] = { sampler, static_cast<UINT_PTR>( type ), value };
+	return Record( "SetSamplerState", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::ValidateDevice( DWORD* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetPaletteEntries( UINT, const PALETTEENTRY* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetPaletteEntries( UINT, PALETTEENTRY* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetCurrentTexturePalette( UINT )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetCurrentTexturePalette( UINT* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetScissorRect( const RECT* rect )
+{
+	return RecordCall( "SetScissorRect", NULL, 0, rect, rect != NULL ? sizeof(RECT) : 0 );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetScissorRect( RECT* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetSoftwareVertexProcessing( BOOL )
+{
+	return E_NOTIMPL;
+}
+
+BOOL STDMETHODCALLTYPE RecordingDevice9::GetSoftwareVertexProcessing()
+{
+	return FALSE;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetNPatchMode( float )
+{
+	return E_NOTIMPL;
+}
+
+float STDMETHODCALLTYPE RecordingDevice9::GetNPatchMode()
+{
+	return 0.0f;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DrawPrimitive( D3DPRIMITIVETYPE primitiveType, UINT startVertex, UINT primitiveCount )
+{
+	UINT_PTR arguments[] = { static_cast<UINT_PTR>( primitiveType ), startVertex, primitiveCount };
+	return Record( "DrawPrimitive", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DrawIndexedPrimitive( D3DPRIMITIVETYPE primitiveType, INT baseVertexIndex, UINT minimumVertexIndex,
+	UINT vertexCount, UINT startIndex, UINT primitiveCount )
+{
+	UINT_PTR arguments[] = { static_cast<UINT_PTR>( primitiveType ), static_cast<UINT_PTR>( baseVertexIndex ), minimumVertexIndex, vertexCount,
+		startIndex, primitiveCount };
+	return Record( "DrawIndexedPrimitive", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DrawPrimitiveUP( D3DPRIMITIVETYPE primitiveType, UINT primitiveCount, const void* vertexData, UINT vertexStride )
+{
+	UINT_PTR arguments[] = { static_cast<UINT_PTR>( primitiveType ), primitiveCount, vertexStride };
+	return Record( "DrawPrimitiveUP", arguments, vertexData, GetVertexCount( primitiveType, primitiveCount ) * vertexStride );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DrawIndexedPrimitiveUP( D3DPRIMITIVETYPE primitiveType, UINT minimumVertexIndex, UINT vertexCount,
+	UINT primitiveCount, const void* indexData, D3DFORMAT indexDataFormat, const void* vertexData, UINT vertexStride )
+{
+	size_t indexSize = GetVertexCount( primitiveType, primitiveCount ) * ( indexDataFormat == D3DFMT_INDEX16 ? 2 : 4 );
+	size_t vertexSize = ( minimumVertexIndex + vertexCount ) * vertexStride;
+
+	std::vector<BYTE> data( indexSize + vertexSize );
+	if( indexData != NULL && indexSize > 0 )
+		memcpy( &data[0], indexData, indexSize );
+	if( vertexData != NULL && vertexSize > 0 )
+		memcpy( &data[indexSize], vertexData, vertexSize );
+
+	UINT_PTR arguments[] = { static_cast<UINT_PTR>( primitiveType ), minimumVertexIndex, vertexCount, primitiveCount,
+		static_cast<UINT_PTR>( indexDataFormat ), vertexStride };
+	return Record( "DrawIndexedPrimitiveUP", arguments, data.empty() ? NULL : &data[0], data.size() );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::ProcessVertices( UINT, UINT, UINT, IDirect3DVertexBuffer9*, IDirect3DVertexDeclaration9*, DWORD )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateVertexDeclaration( const D3DVERTEXELEMENT9*, IDirect3DVertexDeclaration9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetVertexDeclaration( IDirect3DVertexDeclaration9* declaration )
+{
+	UINT_PTR arguments[] = { Address( declaration ) };
+	return Record( "SetVertexDeclaration", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetVertexDeclaration( IDirect3DVertexDeclaration9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetFVF( DWORD fvf )
+{
+	UINT_PTR arguments[] = { fvf };
+	return Record( "SetFVF", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetFVF( DWORD* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateVertexShader( const DWORD*, IDirect3DVertexShader9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetVertexShader( IDirect3DVertexShader9* shader )
+{
+	UINT_PTR arguments[] = { Address( shader ) };
+	return Record( "SetVertexShader", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetVertexShader( IDirect3DVertexShader9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetVertexShaderConstantF( UINT startRegister, const float* data, UINT count )
+{
+	return SetConstants( m_VertexShaderConstants, VertexShaderRegisterCount, "SetVertexShaderConstantF", startRegister, data, count );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetVertexShaderConstantF( UINT startRegister, float* data, UINT count )
+{
+	if( data == NULL || startRegister > VertexShaderRegisterCount || count > VertexShaderRegisterCount - startRegister )
+		return D3DERR_INVALIDCALL;
+
+	memcpy( data, m_VertexShaderConstants + startRegister * 4, count * 4 * sizeof(float) );
+	return D3D_OK;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetVertexShaderConstantI( UINT startRegister, const int* data, UINT count )
+{
+	return RecordConstants( "SetVertexShaderConstantI", startRegister, data, count, 4 * sizeof(int) );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetVertexShaderConstantI( UINT, int*, UINT )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetVertexShaderConstantB( UINT startRegister, const BOOL* data, UINT count )
+{
+	return RecordConstants( "SetVertexShaderConstantB", startRegister, data, count, sizeof(BOOL) );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetVertexShaderConstantB( UINT, BOOL*, UINT )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetStreamSource( UINT streamNumber, IDirect3DVertexBuffer9* streamData, UINT offsetInBytes, UINT stride )
+{
+	UINT_PTR arguments[] = { streamNumber, Address( streamData ), offsetInBytes, stride };
+	return Record( "SetStreamSource", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetStreamSource( UINT, IDirect3DVertexBuffer9**, UINT*, UINT* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetStreamSourceFreq( UINT streamNumber, UINT setting )
+{
+	UINT_PTR arguments[] = { streamNumber, setting };
+	return Record( "SetStreamSourceFreq", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetStreamSourceFreq( UINT, UINT* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetIndices( IDirect3DIndexBuffer9* indexData )
+{
+	UINT_PTR arguments[] = { Address( indexData ) };
+	return Record( "SetIndices", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetIndices( IDirect3DIndexBuffer9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreatePixelShader( const DWORD*, IDirect3DPixelShader9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetPixelShader( IDirect3DPixelShader9* shader )
+{
+	UINT_PTR arguments[] = { Address( shader ) };
+	return Record( "SetPixelShader", arguments );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetPixelShader( IDirect3DPixelShader9** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetPixelShaderConstantF( UINT startRegister, const float* data, UINT count )
+{
+	return SetConstants( m_PixelShaderConstants, PixelShaderRegisterCount, "SetPixelShaderConstantF", startRegister, data, count );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetPixelShaderConstantF( UINT startRegister, float* data, UINT count )
+{
+	if( data == NULL || startRegister > PixelShaderRegisterCount || count > PixelShaderRegisterCount - startRegister )
+		return D3DERR_INVALIDCALL;
+
+	memcpy( data, m_PixelShaderConstants + startRegister * 4, count * 4 * sizeof(float) );
+	return D3D_OK;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetPixelShaderConstantI( UINT startRegister, const int* data, UINT count )
+{
+	return RecordConstants( "SetPixelShaderConstantI", startRegister, data, count, 4 * sizeof(int) );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetPixelShaderConstantI( UINT, int*, UINT )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::SetPixelShaderConstantB( UINT startRegister, const BOOL* data, UINT count )
+{
+	return RecordConstants( "SetPixelShaderConstantB", startRegister, data, count, sizeof(BOOL) );
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::GetPixelShaderConstantB( UINT, BOOL*, UINT )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DrawRectPatch( UINT, const float*, const D3DRECTPATCH_INFO* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DrawTriPatch( UINT, const float*, const D3DTRIPATCH_INFO* )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::DeletePatch( UINT )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE RecordingDevice9::CreateQuery( D3DQUERYTYPE, IDirect3DQuery9** )
+{
+	return E_NOTIMPL;
+}
@@ -0,0 +1,299 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <d3d9.h>
+#include <string>
+#include <vector>
+
+class RecordingDevice9;
+
+// One call made on a recording device or on one of its buffers. Arguments holds the scalar and object pointer arguments
+// in declaration order, with floats stored by their bits. Data holds a copy of the constants, matrix, viewport, rectangles
+// or user memory the call read; for DrawIndexedPrimitiveUP the indices come first, followed by every vertex up to the end
+// of the referenced range.
+struct RecordedCall9
+{
+	std::string Method;
+	std::vector<UINT_PTR> Arguments;
+	std::vector<BYTE> Data;
+};
+
+// A system memory vertex or index buffer created by a RecordingDevice9. Locks are recorded on the device, and the
+// contents can be inspected once unlocked. Discard locks keep the old contents rather than renaming the buffer.
+template< typename Interface, typename Description >
+class RecordingBuffer9 : public Interface
+{
+public:
+	RecordingBuffer9( RecordingDevice9* device, const Description& description );
+
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface( REFIID iid, void** object );
+	virtual ULONG STDMETHODCALLTYPE AddRef();
+	virtual ULONG STDMETHODCALLTYPE Release();
+
+	virtual HRESULT STDMETHODCALLTYPE GetDevice( IDirect3DDevice9** device );
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateData( REFGUID guid, const void* data, DWORD size, DWORD flags );
+	virtual HRESULT STDMETHODCALLTYPE GetPrivateData( REFGUID guid, void* data, DWORD* size );
+	virtual HRESULT STDMETHODCALLTYPE FreePrivateData( REFGUID guid );
+	virtual DWORD STDMETHODCALLTYPE SetPriority( DWORD priority );
+	virtual DWORD STDMETHODCALLTYPE GetPriority();
+	virtual void STDMETHODCALLTYPE PreLoad();
+	virtual D3DRESOURCETYPE STDMETHODCALLTYPE GetType();
+	virtual HRESULT STDMETHODCALLTYPE Lock( UINT offset, UINT size, void** data, DWORD flags );
+	virtual HRESULT STDMETHODCALLTYPE Unlock();
+	virtual HRESULT STDMETHODCALLTYPE GetDesc( Description* description );
+
+	const BYTE* GetContents() const { return &m_Contents[0]; }
+	bool IsLocked() const { return m_Locked; }
+
+private:
+	~RecordingBuffer9();
+
+	RecordingDevice9* m_Device;
+	LONG m_ReferenceCount;
+	Description m_Description;
+	std::vector<BYTE> m_Contents;
+	DWORD m_Priority;
+	bool m_Locked;
+};
+
+typedef RecordingBuffer9<IDirect3DVertexBuffer9, D3DVERTEXBUFFER_DESC> RecordingVertexBuffer9;
+typedef RecordingBuffer9<IDirect3DIndexBuffer9, D3DINDEXBUFFER_DESC> RecordingIndexBuffer9;
+
+// A GPU-free implementation of IDirect3DDevice9 that appends every state, shader constant, clear and draw call to a call
+// list and keeps the float shader constant registers. Wrap it with Device::FromPointer to run the SlimDX wrappers against
+// it. Vertex and index buffers live in system memory.
+//
+// Every other method returns E_NOTIMPL. No state is validated or tracked apart from the constant registers, and
+// draws do nothing.
+class RecordingDevice9 : public IDirect3DDevice9
+{
+public:
+	static const UINT VertexShaderRegisterCount = 256;
+	static const UINT PixelShaderRegisterCount = 224;
+
+	RecordingDevice9();
+
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface( REFIID iid, void** object );
+	virtual ULONG STDMETHODCALLTYPE AddRef();
+	virtual ULONG STDMETHODCALLTYPE Release();
+
+	virtual HRESULT STDMETHODCALLTYPE TestCooperativeLevel();
+	virtual UINT STDMETHODCALLTYPE GetAvailableTextureMem();
+	virtual HRESULT STDMETHODCALLTYPE EvictManagedResources();
+	virtual HRESULT STDMETHODCALLTYPE GetDirect3D( IDirect3D9** direct3D );
+	virtual HRESULT STDMETHODCALLTYPE GetDeviceCaps( D3DCAPS9* caps );
+	virtual HRESULT STDMETHODCALLTYPE GetDisplayMode( UINT swapChain, D3DDISPLAYMODE* mode );
+	virtual HRESULT STDMETHODCALLTYPE GetCreationParameters( D3DDEVICE_CREATION_PARAMETERS* parameters );
+	virtual HRESULT STDMETHODCALLTYPE SetCursorProperties( UINT hotSpotX, UINT hotSpotY, IDirect3DSurface9* cursorBitmap );
+	virtual void STDMETHODCALLTYPE SetCursorPosition( int x, int y, DWORD flags );
+	virtual BOOL STDMETHODCALLTYPE ShowCursor( BOOL show );
+	virtual HRESULT STDMETHODCALLTYPE CreateAdditionalSwapChain( D3DPRESENT_PARAMETERS* presentParameters, IDirect3DSwapChain9** swapChain );
+	virtual HRESULT STDMETHODCALLTYPE GetSwapChain( UINT swapChainIndex, IDirect3DSwapChain9** swapChain );
+	virtual UINT STDMETHODCALLTYPE GetNumberOfSwapChains();
+	virtual HRESULT STDMETHODCALLTYPE Reset( D3DPRESENT_PARAMETERS* presentParameters );
+	virtual HRESULT STDMETHODCALLTYPE Present( const RECT* sourceRect, const RECT* destinationRect, HWND destinationWindowOverride, const RGNDATA* dirtyRegion );
+	virtual HRESULT STDMETHODCALLTYPE GetBackBuffer( UINT swapChain, UINT backBuffer, D3DBACKBUFFER_TYPE type, IDirect3DSurface9** surface );
+	virtual HRESULT STDMETHODCALLTYPE GetRasterStatus( UINT swapChain, D3DRASTER_STATUS* rasterStatus );
+	virtual HRESULT STDMETHODCALLTYPE SetDialogBoxMode( BOOL enableDialogs );
+	virtual void STDMETHODCALLTYPE SetGammaRamp( UINT swapChain, DWORD flags, const D3DGAMMARAMP* ramp );
+	virtual void STDMETHODCALLTYPE GetGammaRamp( UINT swapChain, D3DGAMMARAMP* ramp );
+	virtual HRESULT STDMETHODCALLTYPE CreateTexture( UINT width, UINT height, UINT levels, DWORD usage, D3DFORMAT format, D3DPOOL pool,
+		IDirect3DTexture9** texture, HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE CreateVolumeTexture( UINT width, UINT height, UINT depth, UINT levels, DWORD usage, D3DFORMAT format,
+		D3DPOOL pool, IDirect3DVolumeTexture9** texture, HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE CreateCubeTexture( UINT edgeLength, UINT levels, DWORD usage, D3DFORMAT format, D3DPOOL pool,
+		IDirect3DCubeTexture9** texture, HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE CreateVertexBuffer( UINT length, DWORD usage, DWORD fvf, D3DPOOL pool, IDirect3DVertexBuffer9** vertexBuffer,
+		HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE CreateIndexBuffer( UINT length, DWORD usage, D3DFORMAT format, D3DPOOL pool, IDirect3DIndexBuffer9** indexBuffer,
+		HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE CreateRenderTarget( UINT width, UINT height, D3DFORMAT format, D3DMULTISAMPLE_TYPE multisample,
+		DWORD multisampleQuality, BOOL lockable, IDirect3DSurface9** surface, HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE CreateDepthStencilSurface( UINT width, UINT height, D3DFORMAT format, D3DMULTISAMPLE_TYPE multisample,
+		DWORD multisampleQuality, BOOL discard, IDirect3DSurface9** surface, HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE UpdateSurface( IDirect3DSurface9* sourceSurface, const RECT* sourceRect, IDirect3DSurface9* destinationSurface,
+		const POINT* destinationPoint );
+	virtual HRESULT STDMETHODCALLTYPE UpdateTexture( IDirect3DBaseTexture9* sourceTexture, IDirect3DBaseTexture9* destinationTexture );
+	virtual HRESULT STDMETHODCALLTYPE GetRenderTargetData( IDirect3DSurface9* renderTarget, IDirect3DSurface9* destinationSurface );
+	virtual HRESULT STDMETHODCALLTYPE GetFrontBufferData( UINT swapChain, IDirect3DSurface9* destinationSurface );
+	virtual HRESULT STDMETHODCALLTYPE StretchRect( IDirect3DSurface9* sourceSurface, const RECT* sourceRect, IDirect3DSurface9* destinationSurface,
+		const RECT* destinationRect, D3DTEXTUREFILTERTYPE filter );
+	virtual HRESULT STDMETHODCALLTYPE ColorFill( IDirect3DSurface9* surface, const RECT* rect, D3DCOLOR color );
+	virtual HRESULT STDMETHODCALLTYPE CreateOffscreenPlainSurface( UINT width, UINT height, D3DFORMAT format, D3DPOOL pool, IDirect3DSurface9** surface,
+		HANDLE* sharedHandle );
+	virtual HRESULT STDMETHODCALLTYPE SetRenderTarget( DWORD renderTargetIndex, IDirect3DSurface9* renderTarget );
+	virtual HRESULT STDMETHODCALLTYPE GetRenderTarget( DWORD renderTargetIndex, IDirect3DSurface9** renderTarget );
+	virtual HRESULT STDMETHODCALLTYPE SetDepthStencilSurface( IDirect3DSurface9* depthStencil );
+	virtual HRESULT STDMETHODCALLTYPE GetDepthStencilSurface( IDirect3DSurface9** depthStencil );
+	virtual HRESULT STDMETHODCALLTYPE BeginScene();
+	virtual HRESULT STDMETHODCALLTYPE EndScene();
+	virtual HRESULT STDMETHODCALLTYPE Clear( DWORD count, const D3DRECT* rects, DWORD flags, D3DCOLOR color, float z, DWORD stencil );
+	virtual HRESULT STDMETHODCALLTYPE SetTransform( D3DTRANSFORMSTATETYPE state, const D3DMATRIX* matrix );
+	virtual HRESULT STDMETHODCALLTYPE GetTransform( D3DTRANSFORMSTATETYPE state, D3DMATRIX* matrix );
+	virtual HRESULT STDMETHODCALLTYPE MultiplyTransform( D3DTRANSFORMSTATETYPE state, const D3DMATRIX* matrix );
+	virtual HRESULT STDMETHODCALLTYPE SetViewport( const D3DVIEWPORT9* viewport );
+	virtual HRESULT STDMETHODCALLTYPE GetViewport( D3DVIEWPORT9* viewport );
+	virtual HRESULT STDMETHODCALLTYPE SetMaterial( const D3DMATERIAL9* material );
+	virtual HRESULT STDMETHODCALLTYPE GetMaterial( D3DMATERIAL9* material );
+	virtual HRESULT STDMETHODCALLTYPE SetLight( DWORD index, const D3DLIGHT9* light );
+	virtual HRESULT STDMETHODCALLTYPE GetLight( DWORD index, D3DLIGHT9* light );
+	virtual HRESULT STDMETHODCALLTYPE LightEnable( DWORD index, BOOL enable );
+	virtual HRESULT STDMETHODCALLTYPE GetLightEnable( DWORD index, BOOL* enable );
+	virtual HRESULT STDMETHODCALLTYPE SetClipPlane( DWORD index, const float* plane );
+	virtual HRESULT STDMETHODCALLTYPE GetClipPlane( DWORD index, float* plane );
+	virtual HRESULT STDMETHODCALLTYPE SetRenderState( D3DRENDERSTATETYPE state, DWORD value );
+	virtual HRESULT STDMETHODCALLTYPE GetRenderState( D3DRENDERSTATETYPE state, DWORD* value );
+	virtual HRESULT STDMETHODCALLTYPE CreateStateBlock( D3DSTATEBLOCKTYPE type, IDirect3DStateBlock9** stateBlock );
+	virtual HRESULT STDMETHODCALLTYPE BeginStateBlock();
+	virtual HRESULT STDMETHODCALLTYPE EndStateBlock( IDirect3DStateBlock9** stateBlock );
+	virtual HRESULT STDMETHODCALLTYPE SetClipStatus( const D3DCLIPSTATUS9* clipStatus );
+	virtual HRESULT STDMETHODCALLTYPE GetClipStatus( D3DCLIPSTATUS9* clipStatus );
+	virtual HRESULT STDMETHODCALLTYPE GetTexture( DWORD stage, IDirect3DBaseTexture9** texture );
+	virtual HRESULT STDMETHODCALLTYPE SetTexture( DWORD stage, IDirect3DBaseTexture9* texture );
+	virtual HRESULT STDMETHODCALLTYPE GetTextureStageState( DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD* value );
+	virtual HRESULT STDMETHODCALLTYPE SetTextureStageState( DWORD stage, D3DTEXTURESTAGESTATETYPE type, DWORD value );
+	virtual HRESULT STDMETHODCALLTYPE GetSamplerState( DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD* value );
+	virtual HRESULT STDMETHODCALLTYPE SetSamplerState( DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value );
+	virtual HRESULT STDMETHODCALLTYPE ValidateDevice( DWORD* passCount );
+	virtual HRESULT STDMETHODCALLTYPE SetPaletteEntries( UINT paletteNumber, const PALETTEENTRY* entries );
+	virtual HRESULT STDMETHODCALLTYPE GetPaletteEntries( UINT paletteNumber, PALETTEENTRY* entries );
+	virtual HRESULT STDMETHODCALLTYPE SetCurrentTexturePalette( UINT paletteNumber );
+	virtual HRESULT STDMETHODCALLTYPE GetCurrentTexturePalette( UINT* paletteNumber );
+	virtual HRESULT STDMETHODCALLTYPE SetScissorRect( const RECT* rect );
+	virtual HRESULT STDMETHODCALLTYPE GetScissorRect( RECT* rect );
+	virtual HRESULT STDMETHODCALLTYPE SetSoftwareVertexProcessing( BOOL software );
+	virtual BOOL STDMETHODCALLTYPE GetSoftwareVertexProcessing();
+	virtual HRESULT STDMETHODCALLTYPE SetNPatchMode( float segments );
+	virtual float STDMETHODCALLTYPE GetNPatchMode();
+	virtual HRESULT STDMETHODCALLTYPE DrawPrimitive( D3DPRIMITIVETYPE primitiveType, UINT startVertex, UINT primitiveCount );
+	virtual HRESULT STDMETHODCALLTYPE DrawIndexedPrimitive( D3DPRIMITIVETYPE primitiveType, INT baseVertexIndex, UINT minimumVertexIndex,
+		UINT vertexCount, UINT startIndex, UINT primitiveCount );
+	virtual HRESULT STDMETHODCALLTYPE DrawPrimitiveUP( D3DPRIMITIVETYPE primitiveType, UINT primitiveCount, const void* vertexData, UINT vertexStride );
+	virtual HRESULT STDMETHODCALLTYPE DrawIndexedPrimitiveUP( D3DPRIMITIVETYPE primitiveType, UINT minimumVertexIndex, UINT vertexCount,
+		UINT primitiveCount, const void* indexData, D3DFORMAT indexDataFormat, const void* vertexData, UINT vertexStride );
+	virtual HRESULT STDMETHODCALLTYPE ProcessVertices( UINT sourceStartIndex, UINT destinationIndex, UINT vertexCount, IDirect3DVertexBuffer9* destinationBuffer,
+		IDirect3DVertexDeclaration9* vertexDeclaration, DWORD flags );
+	virtual HRESULT STDMETHODCALLTYPE CreateVertexDeclaration( const D3DVERTEXELEMENT9* elements, IDirect3DVertexDeclaration9** declaration );
+	virtual HRESULT STDMETHODCALLTYPE SetVertexDeclaration( IDirect3DVertexDeclaration9* declaration );
+	virtual HRESULT STDMETHODCALLTYPE GetVertexDeclaration( IDirect3DVertexDeclaration9** declaration );
+	virtual HRESULT STDMETHODCALLTYPE SetFVF( DWORD fvf );
+	virtual HRESULT STDMETHODCALLTYPE GetFVF( DWORD* fvf );
+	virtual HRESULT STDMETHODCALLTYPE CreateVertexShader( const DWORD* function, IDirect3DVertexShader9** shader );
+	virtual HRESULT STDMETHODCALLTYPE SetVertexShader( IDirect3DVertexShader9* shader );
+	virtual HRESULT STDMETHODCALLTYPE GetVertexShader( IDirect3DVertexShader9** shader );
+	virtual HRESULT STDMETHODCALLTYPE SetVertexShaderConstantF( UINT startRegister, const float* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE GetVertexShaderConstantF( UINT startRegister, float* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE SetVertexShaderConstantI( UINT startRegister, const int* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE GetVertexShaderConstantI( UINT startRegister, int* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE SetVertexShaderConstantB( UINT startRegister, const BOOL* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE GetVertexShaderConstantB( UINT startRegister, BOOL* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE SetStreamSource( UINT streamNumber, IDirect3DVertexBuffer9* streamData, UINT offsetInBytes, UINT stride );
+	virtual HRESULT STDMETHODCALLTYPE GetStreamSource( UINT streamNumber, IDirect3DVertexBuffer9** streamData, UINT* offsetInBytes, UINT* stride );
+	virtual HRESULT STDMETHODCALLTYPE SetStreamSourceFreq( UINT streamNumber, UINT setting );
+	virtual HRESULT STDMETHODCALLTYPE GetStreamSourceFreq( UINT streamNumber, UINT* setting );
+	virtual HRESULT STDMETHODCALLTYPE SetIndices( IDirect3DIndexBuffer9* indexData );
+	virtual HRESULT STDMETHODCALLTYPE GetIndices( IDirect3DIndexBuffer9** indexData );
+	virtual HRESULT STDMETHODCALLTYPE CreatePixelShader( const DWORD* function, IDirect3DPixelShader9** shader );
+	virtual HRESULT STDMETHODCALLTYPE SetPixelShader( IDirect3DPixelShader9* shader );
+	virtual HRESULT STDMETHODCALLTYPE GetPixelShader( IDirect3DPixelShader9** shader );
+	virtual HRESULT STDMETHODCALLTYPE SetPixelShaderConstantF( UINT startRegister, const float* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE GetPixelShaderConstantF( UINT startRegister, float* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE SetPixelShaderConstantI( UINT startRegister, const int* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE GetPixelShaderConstantI( UINT startRegister, int* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE SetPixelShaderConstantB( UINT startRegister, const BOOL* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE GetPixelShaderConstantB( UINT startRegister, BOOL* data, UINT count );
+	virtual HRESULT STDMETHODCALLTYPE DrawRectPatch( UINT handle, const float* segmentCounts, const D3DRECTPATCH_INFO* patchInfo );
+	virtual HRESULT STDMETHODCALLTYPE DrawTriPatch( UINT handle, const float* segmentCounts, const D3DTRIPATCH_INFO* patchInfo );
+	virtual HRESULT STDMETHODCALLTYPE DeletePatch( UINT handle );
+	virtual HRESULT STDMETHODCALLTYPE CreateQuery( D3DQUERYTYPE type, IDirect3DQuery9** query );
+
+	const std::vector<RecordedCall9>& GetCalls() const { return m_Calls; }
+	void ClearCalls() { m_Calls.clear(); }
+
+	// Makes every later call to the named method, including buffer locks, return the given failure after it has been
+	// recorded. Pass NULL to stop failing calls.
+	void FailCalls( const char* method, HRESULT result );
+
+	// Gets the float constant registers of a shader stage, four floats per register, as last set on the device.
+	const float* GetVertexShaderConstants() const { return m_VertexShaderConstants; }
+	const float* GetPixelShaderConstants() const { return m_PixelShaderConstants; }
+
+	// Gets the number of vertex and index buffers that have been created and not yet destroyed.
+	int GetLiveBufferCount() const { return m_LiveBufferCount; }
+
+private:
+	template< typename Interface, typename Description >
+	friend class RecordingBuffer9;
+
+	~RecordingDevice9();
+
+	// Appends a call, copying size bytes of data, and returns the result the call should report.
+	template< size_t N >
+	HRESULT Record( const char* method, const UINT_PTR (&arguments)[N], const void* data = NULL, size_t size = 0 )
+	{
+		return RecordCall( method, arguments, N, data, size );
+	}
+
+	HRESULT RecordCall( const char* method, const UINT_PTR* arguments, size_t argumentCount, const void* data, size_t size );
+
+	HRESULT SetConstants( float* registers, UINT registerCount, const char* method, UINT startRegister, const float* data, UINT count );
+	HRESULT RecordConstants( const char* method, UINT startRegister, const void* data, UINT count, size_t registerSize );
+
+	LONG m_ReferenceCount;
+	std::vector<RecordedCall9> m_Calls;
+	std::string m_FailMethod;
+	HRESULT m_FailResult;
+	float m_VertexShaderConstants[VertexShaderRegisterCount * 4];
+	float m_PixelShaderConstants[PixelShaderRegisterCount * 4];
+	int m_LiveBufferCount;
+};
+
+// Owns a recording device and the SlimDX Device wrapping it for the length of a test.
+ref class WrappedRecordingDevice9
+{
+public:
+	WrappedRecordingDevice9()
+		: recording(new RecordingDevice9),
+		device(SlimDX::Direct3D9::Device::FromPointer(System::IntPtr(static_cast<IDirect3DDevice9*>(recording))))
+	{
+	}
+	~WrappedRecordingDevice9()
+	{
+		delete device;
+		device = nullptr;
+		recording->Release();
+		recording = 0;
+	}
+	property RecordingDevice9 &Recording
+	{
+		RecordingDevice9 &get() { return *recording; }
+	}
+	property SlimDX::Direct3D9::Device ^Device
+	{
+		SlimDX::Direct3D9::Device ^get() { return device; }
+	}
+
+private:
+	RecordingDevice9 *recording;
+	SlimDX::Direct3D9::Device ^device;
+};
@@ -0,0 +1,452 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "ReferenceDevice11.h"
+#include "ReferenceDeviceContext11.h"
+
+namespace
+{
+	// Hands a new object to the caller, or only validates the arguments when the caller passed no output
+	// pointer, as the runtime does.
+	template< typename T, typename I >
+	HRESULT Return( T* object, I** result )
+	{
+		if( object == NULL )
+			return E_INVALIDARG;
+
+		if( result == NULL )
+		{
+			object->Release();
+			return S_FALSE;
+		}
+
+		*result = object;
+		return S_OK;
+	}
+
+	template< typename T, typename I >
+	HRESULT CreateShader( ID3D11Device* device, const void* bytecode, SIZE_T length, I** shader )
+	{
+		if( bytecode == NULL || length == 0 )
+			return E_INVALIDARG;
+
+		return Return( new T( device, bytecode, length ), shader );
+	}
+
+	template< typename T, typename I, typename Description >
+	HRESULT CreateView( ID3D11Device* device, ID3D11Resource* resource, const Description* description, I** view )
+	{
+		if( ReferenceResource11::FromResource( resource ) == NULL )
+			return E_INVALIDARG;
+
+		// without a description the view covers the whole resource in its own format, which is left unknown here
+		Description viewDescription;
+		if( description != NULL )
+			viewDescription = *description;
+		else
+			memset( &viewDescription, 0, sizeof(viewDescription) );
+
+		return Return( new T( device, resource, viewDescription ), view );
+	}
+}
+
+ReferenceDevice11::ReferenceDevice11()
+: m_ReferenceCount( 1 ), m_ExceptionMode( 0 ), m_Recording( false )
+{
+	memset( &m_Statistics, 0, sizeof(m_Statistics) );
+	m_ImmediateContext = new ReferenceDeviceContext11( this );
+}
+
+ReferenceDevice11::~ReferenceDevice11()
+{
+	delete m_ImmediateContext;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::QueryInterface( REFIID iid, void** object )
+{
+	if( object == NULL )
+		return E_POINTER;
+
+	if( iid == __uuidof(IUnknown) || iid == __uuidof(ID3D11Device) )
+	{
+		*object = static_cast<ID3D11Device*>( this );
+		AddRef();
+		return S_OK;
+	}
+
+	*object = NULL;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE ReferenceDevice11::AddRef()
+{
+	return InterlockedIncrement( &m_ReferenceCount );
+}
+
+ULONG STDMETHODCALLTYPE ReferenceDevice11::Release()
+{
+	ULONG count = InterlockedDecrement( &m_ReferenceCount );
+	if( count == 0 )
+		delete this;
+
+	return count;
+}
+
+void ReferenceDevice11::ResetStatistics()
+{
+	memset( &m_Statistics, 0, sizeof(m_Statistics) );
+}
+
+void ReferenceDevice11::Record( const char* method, UINT first, UINT count )
+{
+	if( !m_Recording )
+		return;
+
+	ReferenceCall11 call = { method, first, count };
+	m_Calls.push_back( call );
+}
+
+void ReferenceDevice11::TrackResource( ReferenceResource11* resource )
+{
+	if( resource == NULL )
+		return;
+
+	++m_Statistics.ResourcesCreated;
+	m_Statistics.BytesAllocated += resource->GetTotalSize();
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateBuffer( const D3D11_BUFFER_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Buffer** buffer )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	ReferenceBuffer11* result = ReferenceBuffer11::Create( this, *description, initialData );
+	if( result != NULL && buffer != NULL )
+	{
+		TrackResource( result );
+		if( initialData != NULL )
+			m_Statistics.BytesUploaded += result->GetTotalSize();
+	}
+
+	return Return( result, buffer );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateTexture1D( const D3D11_TEXTURE1D_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture1D** texture )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	ReferenceTexture1D11* result = ReferenceTexture1D11::Create( this, *description, initialData );
+	if( result != NULL && texture != NULL )
+	{
+		TrackResource( result );
+		if( initialData != NULL )
+			m_Statistics.BytesUploaded += result->GetTotalSize();
+	}
+
+	return Return( result, texture );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateTexture2D( const D3D11_TEXTURE2D_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture2D** texture )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	ReferenceTexture2D11* result = ReferenceTexture2D11::Create( this, *description, initialData );
+	if( result != NULL && texture != NULL )
+	{
+		TrackResource( result );
+		if( initialData != NULL )
+			m_Statistics.BytesUploaded += result->GetTotalSize();
+	}
+
+	return Return( result, texture );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateTexture3D( const D3D11_TEXTURE3D_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture3D** texture )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	ReferenceTexture3D11* result = ReferenceTexture3D11::Create( this, *description, initialData );
+	if( result != NULL && texture != NULL )
+	{
+		TrackResource( result );
+		if( initialData != NULL )
+			m_Statistics.BytesUploaded += result->GetTotalSize();
+	}
+
+	return Return( result, texture );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateShaderResourceView( ID3D11Resource* resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* description, ID3D11ShaderResourceView** view )
+{
+	return CreateView<ReferenceShaderResourceView11>( this, resource, description, view );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateUnorderedAccessView( ID3D11Resource* resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* description, ID3D11UnorderedAccessView** view )
+{
+	return CreateView<ReferenceUnorderedAccessView11>( this, resource, description, view );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateRenderTargetView( ID3D11Resource* resource, const D3D11_RENDER_TARGET_VIEW_DESC* description, ID3D11RenderTargetView** view )
+{
+	return CreateView<ReferenceRenderTargetView11>( this, resource, description, view );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateDepthStencilView( ID3D11Resource* resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* description, ID3D11DepthStencilView** view )
+{
+	return CreateView<ReferenceDepthStencilView11>( this, resource, description, view );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateInputLayout( const D3D11_INPUT_ELEMENT_DESC* elements, UINT elementCount, const void* bytecode, SIZE_T bytecodeLength, ID3D11InputLayout** layout )
+{
+	if( elements == NULL || elementCount == 0 || elementCount > D3D11_IA_VERTEX_INPUT_STRUCTURE_ELEMENT_COUNT || bytecode == NULL || bytecodeLength == 0 )
+		return E_INVALIDARG;
+
+	return Return( new ReferenceInputLayout11( this, elements, elementCount ), layout );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateVertexShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11VertexShader** shader )
+{
+	return CreateShader< ReferenceShader11<ID3D11VertexShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateGeometryShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11GeometryShader** shader )
+{
+	return CreateShader< ReferenceShader11<ID3D11GeometryShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateGeometryShaderWithStreamOutput( const void* bytecode, SIZE_T bytecodeLength, const D3D11_SO_DECLARATION_ENTRY* entries,
+	UINT entryCount, const UINT*, UINT strideCount, UINT, ID3D11ClassLinkage*, ID3D11GeometryShader** shader )
+{
+	if( ( entries == NULL && entryCount > 0 ) || strideCount > D3D11_SO_BUFFER_SLOT_COUNT )
+		return E_INVALIDARG;
+
+	return CreateShader< ReferenceShader11<ID3D11GeometryShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreatePixelShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11PixelShader** shader )
+{
+	return CreateShader< ReferenceShader11<ID3D11PixelShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateHullShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11HullShader** shader )
+{
+	return CreateShader< ReferenceShader11<ID3D11HullShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateDomainShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11DomainShader** shader )
+{
+	return CreateShader< ReferenceShader11<ID3D11DomainShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateComputeShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage*, ID3D11ComputeShader** shader )
+{
+	return CreateShader< ReferenceShader11<ID3D11ComputeShader> >( this, bytecode, bytecodeLength, shader );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateClassLinkage( ID3D11ClassLinkage** linkage )
+{
+	return Return( new ReferenceClassLinkage11( this ), linkage );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateBlendState( const D3D11_BLEND_DESC* description, ID3D11BlendState** state )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	return Return( new ReferenceBlendState11( this, *description ), state );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateDepthStencilState( const D3D11_DEPTH_STENCIL_DESC* description, ID3D11DepthStencilState** state )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	return Return( new ReferenceDepthStencilState11( this, *description ), state );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateRasterizerState( const D3D11_RASTERIZER_DESC* description, ID3D11RasterizerState** state )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	return Return( new ReferenceRasterizerState11( this, *description ), state );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateSamplerState( const D3D11_SAMPLER_DESC* description, ID3D11SamplerState** state )
+{
+	if( description == NULL )
+		return E_INVALIDARG;
+
+	return Return( new ReferenceSamplerState11( this, *description ), state );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateQuery( const D3D11_QUERY_DESC*, ID3D11Query** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreatePredicate( const D3D11_QUERY_DESC*, ID3D11Predicate** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateCounter( const D3D11_COUNTER_DESC*, ID3D11Counter** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CreateDeferredContext( UINT, ID3D11DeviceContext** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::OpenSharedResource( HANDLE, REFIID, void** )
+{
+	return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CheckFormatSupport( DXGI_FORMAT format, UINT* support )
+{
+	if( support == NULL )
+		return E_INVALIDARG;
+
+	UINT blockSize;
+	if( GetReferenceElementSize( format, blockSize ) == 0 )
+	{
+		*support = 0;
+		return E_FAIL;
+	}
+
+	*support = D3D11_FORMAT_SUPPORT_BUFFER | D3D11_FORMAT_SUPPORT_TEXTURE1D | D3D11_FORMAT_SUPPORT_TEXTURE2D | D3D11_FORMAT_SUPPORT_TEXTURE3D |
+		D3D11_FORMAT_SUPPORT_MIP | D3D11_FORMAT_SUPPORT_SHADER_LOAD | D3D11_FORMAT_SUPPORT_CPU_LOCKABLE;
+	return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CheckMultisampleQualityLevels( DXGI_FORMAT format, UINT sampleCount, UINT* qualityLevels )
+{
+	if( qualityLevels == NULL )
+		return E_INVALIDARG;
+
+	// multisampling is not modelled, so only single sample resources have a quality level
+	UINT blockSize;
+	*qualityLevels = sampleCount == 1 && GetReferenceElementSize( format, blockSize ) != 0 ? 1 : 0;
+	return S_OK;
+}
+
+void STDMETHODCALLTYPE ReferenceDevice11::CheckCounterInfo( D3D11_COUNTER_INFO* info )
+{
+	if( info != NULL )
+		memset( info, 0, sizeof(D3D11_COUNTER_INFO) );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CheckCounter( const D3D11_COUNTER_DESC*, D3D11_COUNTER_TYPE*, UINT*, LPSTR, UINT*, LPSTR, UINT*, LPSTR, UINT* )
+{
+	return E_INVALIDARG;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::CheckFeatureSupport( D3D11_FEATURE feature, void* data, UINT size )
+{
+	if( data == NULL )
+		return E_INVALIDARG;
+
+	switch( feature )
+	{
+	case D3D11_FEATURE_THREADING:
+		if( size != sizeof(D3D11_FEATURE_DATA_THREADING) )
+			return E_INVALIDARG;
+
+		memset( data, 0, size );
+		return S_OK;
+
+	case D3D11_FEATURE_DOUBLES:
+		if( size != sizeof(D3D11_FEATURE_DATA_DOUBLES) )
+			return E_INVALIDARG;
+
+		memset( data, 0, size );
+		return S_OK;
+
+	case D3D11_FEATURE_FORMAT_SUPPORT:
+	{
+		if( size != sizeof(D3D11_FEATURE_DATA_FORMAT_SUPPORT) )
+			return E_INVALIDARG;
+
+		D3D11_FEATURE_DATA_FORMAT_SUPPORT* formatSupport = static_cast<D3D11_FEATURE_DATA_FORMAT_SUPPORT*>( data );
+		return CheckFormatSupport( formatSupport->InFormat, &formatSupport->OutFormatSupport );
+	}
+
+	default:
+		return E_INVALIDARG;
+	}
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::GetPrivateData( REFGUID guid, UINT* size, void* data )
+{
+	return m_PrivateData.Get( guid, size, data );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::SetPrivateData( REFGUID guid, UINT size, const void* data )
+{
+	return m_PrivateData.Set( guid, size, data );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::SetPrivateDataInterface( REFGUID guid, const IUnknown* data )
+{
+	return m_PrivateData.SetInterface( guid, data );
+}
+
+D3D_FEATURE_LEVEL STDMETHODCALLTYPE ReferenceDevice11::GetFeatureLevel()
+{
+	return D3D_FEATURE_LEVEL_11_0;
+}
+
+UINT STDMETHODCALLTYPE ReferenceDevice11::GetCreationFlags()
+{
+	return 0;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::GetDeviceRemovedReason()
+{
+	return S_OK;
+}
+
+void STDMETHODCALLTYPE ReferenceDevice11::GetImmediateContext( ID3D11DeviceContext** context )
+{
+	m_ImmediateContext->AddRef();
+	*context = m_ImmediateContext;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDevice11::SetExceptionMode( UINT flags )
+{
+	m_ExceptionMode = flags;
+	return S_OK;
+}
+
+UINT STDMETHODCALLTYPE ReferenceDevice11::GetExceptionMode()
+{
+	return m_ExceptionMode;
+}
@@ -0,0 +1,147 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <vector>
+
+#include "ReferenceObjects11.h"
+
+class ReferenceDeviceContext11;
+
+// Counters kept by a reference device and its immediate context.
+struct ReferenceStatistics11
+{
+	UINT ResourcesCreated;
+	UINT64 BytesAllocated;
+
+	// Every Draw* and Dispatch* call, including the indirect ones.
+	UINT DrawCalls;
+	UINT DispatchCalls;
+
+	// Calls that bind pipeline state, and the subset that left the bound state unchanged.
+	UINT StateCalls;
+	UINT RedundantStateCalls;
+
+	UINT MapCalls;
+	UINT DiscardMapCalls;
+	UINT UpdateSubresourceCalls;
+	UINT CopyCalls;
+	UINT ClearCalls;
+
+	// Bytes written into resources by write maps, UpdateSubresource and initial data.
+	UINT64 BytesUploaded;
+};
+
+// One call made on the immediate context. First and Count hold the start slot and slot count for binding calls, and the
+// start location and vertex, index or thread group count for draws and dispatches.
+struct ReferenceCall11
+{
+	const char* Method;
+	UINT First;
+	UINT Count;
+};
+
+// A GPU-free implementation of ID3D11Device. Resources live in system memory, and the immediate context tracks bound
+// state, serves Map and UpdateSubresource from that memory, and counts the work it is given instead of doing it.
+// Wrap it with Device::FromPointer to run the SlimDX wrappers against it.
+//
+// Queries, predicates, counters, class linkage, deferred contexts and shared resources are not supported, and their
+// Create methods return E_NOTIMPL. Clears, copies between mismatched formats and draws do not touch resource contents.
+class ReferenceDevice11 : public ID3D11Device
+{
+public:
+	ReferenceDevice11();
+
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface( REFIID iid, void** object );
+	virtual ULONG STDMETHODCALLTYPE AddRef();
+	virtual ULONG STDMETHODCALLTYPE Release();
+
+	virtual HRESULT STDMETHODCALLTYPE CreateBuffer( const D3D11_BUFFER_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Buffer** buffer );
+	virtual HRESULT STDMETHODCALLTYPE CreateTexture1D( const D3D11_TEXTURE1D_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture1D** texture );
+	virtual HRESULT STDMETHODCALLTYPE CreateTexture2D( const D3D11_TEXTURE2D_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture2D** texture );
+	virtual HRESULT STDMETHODCALLTYPE CreateTexture3D( const D3D11_TEXTURE3D_DESC* description, const D3D11_SUBRESOURCE_DATA* initialData, ID3D11Texture3D** texture );
+	virtual HRESULT STDMETHODCALLTYPE CreateShaderResourceView( ID3D11Resource* resource, const D3D11_SHADER_RESOURCE_VIEW_DESC* description, ID3D11ShaderResourceView** view );
+	virtual HRESULT STDMETHODCALLTYPE CreateUnorderedAccessView( ID3D11Resource* resource, const D3D11_UNORDERED_ACCESS_VIEW_DESC* description, ID3D11UnorderedAccessView** view );
+	virtual HRESULT STDMETHODCALLTYPE CreateRenderTargetView( ID3D11Resource* resource, const D3D11_RENDER_TARGET_VIEW_DESC* description, ID3D11RenderTargetView** view );
+	virtual HRESULT STDMETHODCALLTYPE CreateDepthStencilView( ID3D11Resource* resource, const D3D11_DEPTH_STENCIL_VIEW_DESC* description, ID3D11DepthStencilView** view );
+	virtual HRESULT STDMETHODCALLTYPE CreateInputLayout( const D3D11_INPUT_ELEMENT_DESC* elements, UINT elementCount, const void* bytecode, SIZE_T bytecodeLength, ID3D11InputLayout** layout );
+	virtual HRESULT STDMETHODCALLTYPE CreateVertexShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* linkage, ID3D11VertexShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreateGeometryShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* linkage, ID3D11GeometryShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreateGeometryShaderWithStreamOutput( const void* bytecode, SIZE_T bytecodeLength, const D3D11_SO_DECLARATION_ENTRY* entries,
+		UINT entryCount, const UINT* strides, UINT strideCount, UINT rasterizedStream, ID3D11ClassLinkage* linkage, ID3D11GeometryShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreatePixelShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* linkage, ID3D11PixelShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreateHullShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* linkage, ID3D11HullShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreateDomainShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* linkage, ID3D11DomainShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreateComputeShader( const void* bytecode, SIZE_T bytecodeLength, ID3D11ClassLinkage* linkage, ID3D11ComputeShader** shader );
+	virtual HRESULT STDMETHODCALLTYPE CreateClassLinkage( ID3D11ClassLinkage** linkage );
+	virtual HRESULT STDMETHODCALLTYPE CreateBlendState( const D3D11_BLEND_DESC* description, ID3D11BlendState** state );
+	virtual HRESULT STDMETHODCALLTYPE CreateDepthStencilState( const D3D11_DEPTH_STENCIL_DESC* description, ID3D11DepthStencilState** state );
+	virtual HRESULT STDMETHODCALLTYPE CreateRasterizerState( const D3D11_RASTERIZER_DESC* description, ID3D11RasterizerState** state );
+	virtual HRESULT STDMETHODCALLTYPE CreateSamplerState( const D3D11_SAMPLER_DESC* description, ID3D11SamplerState** state );
+	virtual HRESULT STDMETHODCALLTYPE CreateQuery( const D3D11_QUERY_DESC* description, ID3D11Query** query );
+	virtual HRESULT STDMETHODCALLTYPE CreatePredicate( const D3D11_QUERY_DESC* description, ID3D11Predicate** predicate );
+	virtual HRESULT STDMETHODCALLTYPE CreateCounter( const D3D11_COUNTER_DESC* description, ID3D11Counter** counter );
+	virtual HRESULT STDMETHODCALLTYPE CreateDeferredContext( UINT flags, ID3D11DeviceContext** context );
+	virtual HRESULT STDMETHODCALLTYPE OpenSharedResource( HANDLE resource, REFIID iid, void** object );
+	virtual HRESULT STDMETHODCALLTYPE CheckFormatSupport( DXGI_FORMAT format, UINT* support );
+	virtual HRESULT STDMETHODCALLTYPE CheckMultisampleQualityLevels( DXGI_FORMAT format, UINT sampleCount, UINT* qualityLevels );
+	virtual void STDMETHODCALLTYPE CheckCounterInfo( D3D11_COUNTER_INFO* info );
+	virtual HRESULT STDMETHODCALLTYPE CheckCounter( const D3D11_COUNTER_DESC* description, D3D11_COUNTER_TYPE* type, UINT* activeCounters,
+		LPSTR name, UINT* nameLength, LPSTR units, UINT* unitsLength, LPSTR counterDescription, UINT* descriptionLength );
+	virtual HRESULT STDMETHODCALLTYPE CheckFeatureSupport( D3D11_FEATURE feature, void* data, UINT size );
+	virtual HRESULT STDMETHODCALLTYPE GetPrivateData( REFGUID guid, UINT* size, void* data );
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateData( REFGUID guid, UINT size, const void* data );
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface( REFGUID guid, const IUnknown* data );
+	virtual D3D_FEATURE_LEVEL STDMETHODCALLTYPE GetFeatureLevel();
+	virtual UINT STDMETHODCALLTYPE GetCreationFlags();
+	virtual HRESULT STDMETHODCALLTYPE GetDeviceRemovedReason();
+	virtual void STDMETHODCALLTYPE GetImmediateContext( ID3D11DeviceContext** context );
+	virtual HRESULT STDMETHODCALLTYPE SetExceptionMode( UINT flags );
+	virtual UINT STDMETHODCALLTYPE GetExceptionMode();
+
+	const ReferenceStatistics11& GetStatistics() const { return m_Statistics; }
+	void ResetStatistics();
+
+	// Starts or stops appending immediate context calls to the call stream.
+	void SetRecording( bool recording ) { m_Recording = recording; }
+	const std::vector<ReferenceCall11>& GetCalls() const { return m_Calls; }
+	void ClearCalls() { m_Calls.clear(); }
+
+	ReferenceDeviceContext11* GetReferenceContext() { return m_ImmediateContext; }
+
+private:
+	friend class ReferenceDeviceContext11;
+
+	~ReferenceDevice11();
+
+	void Record( const char* method, UINT first, UINT count );
+	void TrackResource( ReferenceResource11* resource );
+
+	LONG m_ReferenceCount;
+	ReferencePrivateData11 m_PrivateData;
+	ReferenceDeviceContext11* m_ImmediateContext;
+	UINT m_ExceptionMode;
+
+	ReferenceStatistics11 m_Statistics;
+	std::vector<ReferenceCall11> m_Calls;
+	bool m_Recording;
+};
@@ -0,0 +1,760 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "ReferenceDevice11.h"
+#include "ReferenceDeviceContext11.h"
+
+// Defines the eight binding methods of a shader stage on top of the shared stage helpers.
+#define REFERENCE_SHADER_STAGE_IMPLEMENTATION( prefix, shaderType, stageIndex ) \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##SetShaderResources( UINT startSlot, UINT count, ID3D11ShaderResourceView* const* views ) \
+	{ \
+		bool changed = BindRange( m_Stages[stageIndex].ShaderResources, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, startSlot, count, views ); \
+		CountState( #prefix "SetShaderResources", startSlot, count, changed ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##SetShader( shaderType* shader, ID3D11ClassInstance* const*, UINT ) \
+	{ \
+		SetShader( m_Stages[stageIndex], #prefix "SetShader", shader ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##SetSamplers( UINT startSlot, UINT count, ID3D11SamplerState* const* samplers ) \
+	{ \
+		bool changed = BindRange( m_Stages[stageIndex].Samplers, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, startSlot, count, samplers ); \
+		CountState( #prefix "SetSamplers", startSlot, count, changed ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##SetConstantBuffers( UINT startSlot, UINT count, ID3D11Buffer* const* buffers ) \
+	{ \
+		bool changed = BindRange( m_Stages[stageIndex].ConstantBuffers, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, startSlot, count, buffers ); \
+		CountState( #prefix "SetConstantBuffers", startSlot, count, changed ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##GetShaderResources( UINT startSlot, UINT count, ID3D11ShaderResourceView** views ) \
+	{ \
+		GetRange( m_Stages[stageIndex].ShaderResources, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, startSlot, count, views ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##GetShader( shaderType** shader, ID3D11ClassInstance** classInstances, UINT* classInstanceCount ) \
+	{ \
+		ID3D11DeviceChild* bound; \
+		GetShader( m_Stages[stageIndex], &bound, classInstances, classInstanceCount ); \
+		*shader = static_cast<shaderType*>( bound ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##GetSamplers( UINT startSlot, UINT count, ID3D11SamplerState** samplers ) \
+	{ \
+		GetRange( m_Stages[stageIndex].Samplers, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, startSlot, count, samplers ); \
+	} \
+	void STDMETHODCALLTYPE ReferenceDeviceContext11::prefix##GetConstantBuffers( UINT startSlot, UINT count, ID3D11Buffer** buffers ) \
+	{ \
+		GetRange( m_Stages[stageIndex].ConstantBuffers, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, startSlot, count, buffers ); \
+	}
+
+namespace
+{
+	template< typename T >
+	bool Bind( T*& slot, T* value )
+	{
+		if( slot == value )
+			return false;
+
+		if( value != NULL )
+			value->AddRef();
+		if( slot != NULL )
+			slot->Release();
+
+		slot = value;
+		return true;
+	}
+
+	template< typename T >
+	void Get( T* slot, T** value )
+	{
+		if( value == NULL )
+			return;
+
+		if( slot != NULL )
+			slot->AddRef();
+
+		*value = slot;
+	}
+}
+
+ReferenceDeviceContext11::ReferenceDeviceContext11( ReferenceDevice11* device )
+: ReferenceDeviceChild11<ID3D11DeviceContext>( device ), m_Owner( device )
+{
+	memset( m_Stages, 0, sizeof(m_Stages) );
+
+	m_InputLayout = NULL;
+	m_Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	memset( m_VertexBuffers, 0, sizeof(m_VertexBuffers) );
+	memset( m_VertexStrides, 0, sizeof(m_VertexStrides) );
+	memset( m_VertexOffsets, 0, sizeof(m_VertexOffsets) );
+	m_IndexBuffer = NULL;
+	m_IndexFormat = DXGI_FORMAT_UNKNOWN;
+	m_IndexOffset = 0;
+
+	memset( m_StreamOutTargets, 0, sizeof(m_StreamOutTargets) );
+	memset( m_StreamOutOffsets, 0, sizeof(m_StreamOutOffsets) );
+
+	m_RasterizerState = NULL;
+	memset( m_Viewports, 0, sizeof(m_Viewports) );
+	m_ViewportCount = 0;
+	memset( m_ScissorRects, 0, sizeof(m_ScissorRects) );
+	m_ScissorRectCount = 0;
+
+	memset( m_RenderTargets, 0, sizeof(m_RenderTargets) );
+	m_DepthStencilView = NULL;
+	memset( m_OutputViews, 0, sizeof(m_OutputViews) );
+	memset( m_ComputeViews, 0, sizeof(m_ComputeViews) );
+	m_BlendState = NULL;
+	for( int i = 0; i < 4; ++i )
+		m_BlendFactor[i] = 1.0f;
+	m_SampleMask = 0xffffffff;
+	m_DepthStencilState = NULL;
+	m_StencilReference = 0;
+
+	m_Predicate = NULL;
+	m_PredicateValue = FALSE;
+}
+
+ReferenceDeviceContext11::~ReferenceDeviceContext11()
+{
+	ClearState();
+}
+
+ULONG STDMETHODCALLTYPE ReferenceDeviceContext11::AddRef()
+{
+	return m_Owner->AddRef();
+}
+
+ULONG STDMETHODCALLTYPE ReferenceDeviceContext11::Release()
+{
+	return m_Owner->Release();
+}
+
+REFERENCE_SHADER_STAGE_IMPLEMENTATION( VS, ID3D11VertexShader, VertexStage )
+REFERENCE_SHADER_STAGE_IMPLEMENTATION( HS, ID3D11HullShader, HullStage )
+REFERENCE_SHADER_STAGE_IMPLEMENTATION( DS, ID3D11DomainShader, DomainStage )
+REFERENCE_SHADER_STAGE_IMPLEMENTATION( GS, ID3D11GeometryShader, GeometryStage )
+REFERENCE_SHADER_STAGE_IMPLEMENTATION( PS, ID3D11PixelShader, PixelStage )
+REFERENCE_SHADER_STAGE_IMPLEMENTATION( CS, ID3D11ComputeShader, ComputeStage )
+
+void ReferenceDeviceContext11::SetShader( ShaderStage& stage, const char* method, ID3D11DeviceChild* shader )
+{
+	CountState( method, 0, 1, Bind( stage.Shader, shader ) );
+}
+
+void ReferenceDeviceContext11::GetShader( ShaderStage& stage, ID3D11DeviceChild** shader, ID3D11ClassInstance**, UINT* classInstanceCount )
+{
+	Get( stage.Shader, shader );
+
+	// class instances are not supported, so none are ever bound
+	if( classInstanceCount != NULL )
+		*classInstanceCount = 0;
+}
+
+template< typename T >
+bool ReferenceDeviceContext11::BindRange( T** slots, UINT slotCount, UINT startSlot, UINT count, T* const* values )
+{
+	// the runtime drops calls that reach past the last slot
+	if( startSlot > slotCount || count > slotCount - startSlot )
+		return false;
+
+	bool changed = false;
+	for( UINT i = 0; i < count; ++i )
+		changed |= Bind( slots[startSlot + i], values != NULL ? values[i] : static_cast<T*>( NULL ) );
+
+	return changed;
+}
+
+template< typename T >
+void ReferenceDeviceContext11::GetRange( T* const* slots, UINT slotCount, UINT startSlot, UINT count, T** values )
+{
+	if( values == NULL )
+		return;
+
+	for( UINT i = 0; i < count; ++i )
+	{
+		UINT slot = startSlot + i;
+		Get( slot < slotCount ? slots[slot] : static_cast<T*>( NULL ), &values[i] );
+	}
+}
+
+void ReferenceDeviceContext11::CountState( const char* method, UINT first, UINT count, bool changed )
+{
+	++m_Owner->m_Statistics.StateCalls;
+	if( !changed )
+		++m_Owner->m_Statistics.RedundantStateCalls;
+
+	m_Owner->Record( method, first, count );
+}
+
+void ReferenceDeviceContext11::CountDraw( const char* method, UINT first, UINT count )
+{
+	++m_Owner->m_Statistics.DrawCalls;
+	m_Owner->Record( method, first, count );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DrawIndexed( UINT indexCount, UINT startIndexLocation, INT )
+{
+	CountDraw( "DrawIndexed", startIndexLocation, indexCount );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::Draw( UINT vertexCount, UINT startVertexLocation )
+{
+	CountDraw( "Draw", startVertexLocation, vertexCount );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DrawIndexedInstanced( UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT, UINT )
+{
+	CountDraw( "DrawIndexedInstanced", startIndexLocation, indexCountPerInstance * instanceCount );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DrawInstanced( UINT vertexCountPerInstance, UINT instanceCount, UINT startVertexLocation, UINT )
+{
+	CountDraw( "DrawInstanced", startVertexLocation, vertexCountPerInstance * instanceCount );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DrawAuto()
+{
+	CountDraw( "DrawAuto", 0, 0 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DrawIndexedInstancedIndirect( ID3D11Buffer*, UINT alignedByteOffset )
+{
+	CountDraw( "DrawIndexedInstancedIndirect", alignedByteOffset, 0 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DrawInstancedIndirect( ID3D11Buffer*, UINT alignedByteOffset )
+{
+	CountDraw( "DrawInstancedIndirect", alignedByteOffset, 0 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::Dispatch( UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ )
+{
+	++m_Owner->m_Statistics.DispatchCalls;
+	m_Owner->Record( "Dispatch", 0, threadGroupCountX * threadGroupCountY * threadGroupCountZ );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::DispatchIndirect( ID3D11Buffer*, UINT alignedByteOffset )
+{
+	++m_Owner->m_Statistics.DispatchCalls;
+	m_Owner->Record( "DispatchIndirect", alignedByteOffset, 0 );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDeviceContext11::Map( ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT, D3D11_MAPPED_SUBRESOURCE* mapped )
+{
+	++m_Owner->m_Statistics.MapCalls;
+	m_Owner->Record( "Map", subresource, 1 );
+
+	ReferenceResource11* storage = ReferenceResource11::FromResource( resource );
+	if( storage == NULL || mapped == NULL || subresource >= storage->GetSubresourceCount() || storage->IsMapped( subresource ) )
+		return E_INVALIDARG;
+
+	bool reads = mapType == D3D11_MAP_READ || mapType == D3D11_MAP_READ_WRITE;
+	bool writes = mapType != D3D11_MAP_READ;
+	bool renames = mapType == D3D11_MAP_WRITE_DISCARD || mapType == D3D11_MAP_WRITE_NO_OVERWRITE;
+	UINT access = storage->GetCpuAccessFlags();
+
+	// dynamic resources only support the renaming map types, and nothing else supports them
+	if( ( reads && ( access & D3D11_CPU_ACCESS_READ ) == 0 ) || ( writes && ( access & D3D11_CPU_ACCESS_WRITE ) == 0 ) ||
+		renames != ( storage->GetUsage() == D3D11_USAGE_DYNAMIC ) )
+		return E_INVALIDARG;
+
+	if( mapType == D3D11_MAP_WRITE_DISCARD )
+		++m_Owner->m_Statistics.DiscardMapCalls;
+
+	// the whole subresource counts as uploaded, since the application may write any of it
+	if( writes )
+		m_Owner->m_Statistics.BytesUploaded += storage->GetSize( subresource );
+
+	storage->SetMapped( subresource, true );
+	mapped->pData = storage->GetData( subresource );
+	mapped->RowPitch = storage->GetRowPitch( subresource );
+	mapped->DepthPitch = storage->GetDepthPitch( subresource );
+	return S_OK;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::Unmap( ID3D11Resource* resource, UINT subresource )
+{
+	m_Owner->Record( "Unmap", subresource, 1 );
+
+	ReferenceResource11* storage = ReferenceResource11::FromResource( resource );
+	if( storage != NULL && subresource < storage->GetSubresourceCount() )
+		storage->SetMapped( subresource, false );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IASetInputLayout( ID3D11InputLayout* layout )
+{
+	CountState( "IASetInputLayout", 0, 1, Bind( m_InputLayout, layout ) );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IASetVertexBuffers( UINT startSlot, UINT count, ID3D11Buffer* const* buffers, const UINT* strides, const UINT* offsets )
+{
+	bool changed = BindRange( m_VertexBuffers, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, startSlot, count, buffers );
+	if( startSlot <= D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT && count <= D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT - startSlot )
+	{
+		for( UINT i = 0; i < count; ++i )
+		{
+			UINT stride = strides != NULL ? strides[i] : 0;
+			UINT offset = offsets != NULL ? offsets[i] : 0;
+
+			changed |= m_VertexStrides[startSlot + i] != stride || m_VertexOffsets[startSlot + i] != offset;
+			m_VertexStrides[startSlot + i] = stride;
+			m_VertexOffsets[startSlot + i] = offset;
+		}
+	}
+
+	CountState( "IASetVertexBuffers", startSlot, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IASetIndexBuffer( ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset )
+{
+	bool changed = Bind( m_IndexBuffer, buffer ) || m_IndexFormat != format || m_IndexOffset != offset;
+	m_IndexFormat = format;
+	m_IndexOffset = offset;
+
+	CountState( "IASetIndexBuffer", 0, 1, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY topology )
+{
+	bool changed = m_Topology != topology;
+	m_Topology = topology;
+
+	CountState( "IASetPrimitiveTopology", 0, 1, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::Begin( ID3D11Asynchronous* )
+{
+	m_Owner->Record( "Begin", 0, 0 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::End( ID3D11Asynchronous* )
+{
+	m_Owner->Record( "End", 0, 0 );
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDeviceContext11::GetData( ID3D11Asynchronous*, void*, UINT, UINT )
+{
+	// the device cannot create queries, so nothing passed here can be one of its own
+	return E_INVALIDARG;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::SetPredication( ID3D11Predicate* predicate, BOOL value )
+{
+	bool changed = Bind( m_Predicate, predicate ) || m_PredicateValue != value;
+	m_PredicateValue = value;
+
+	CountState( "SetPredication", 0, 1, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMSetRenderTargets( UINT count, ID3D11RenderTargetView* const* views, ID3D11DepthStencilView* depthStencilView )
+{
+	if( count > D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT )
+	{
+		CountState( "OMSetRenderTargets", 0, count, false );
+		return;
+	}
+
+	// slots past the given count are unbound
+	bool changed = BindRange( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, 0, count, views );
+	changed |= BindRange<ID3D11RenderTargetView>( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, count, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT - count, NULL );
+	changed |= Bind( m_DepthStencilView, depthStencilView );
+
+	CountState( "OMSetRenderTargets", 0, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMSetRenderTargetsAndUnorderedAccessViews( UINT renderTargetCount, ID3D11RenderTargetView* const* renderTargets,
+	ID3D11DepthStencilView* depthStencilView, UINT startSlot, UINT count, ID3D11UnorderedAccessView* const* views, const UINT* )
+{
+	bool changed = false;
+	if( renderTargetCount != D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL && renderTargetCount <= D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT )
+	{
+		changed |= BindRange( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, 0, renderTargetCount, renderTargets );
+		changed |= BindRange<ID3D11RenderTargetView>( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, renderTargetCount,
+			D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT - renderTargetCount, NULL );
+		changed |= Bind( m_DepthStencilView, depthStencilView );
+	}
+
+	if( count != D3D11_KEEP_UNORDERED_ACCESS_VIEWS )
+		changed |= BindRange( m_OutputViews, D3D11_PS_CS_UAV_REGISTER_COUNT, startSlot, count, views );
+
+	CountState( "OMSetRenderTargetsAndUnorderedAccessViews", startSlot, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMSetBlendState( ID3D11BlendState* state, const FLOAT blendFactor[4], UINT sampleMask )
+{
+	static const FLOAT defaultFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+	const FLOAT* factor = blendFactor != NULL ? blendFactor : defaultFactor;
+
+	bool changed = Bind( m_BlendState, state ) || memcmp( m_BlendFactor, factor, sizeof(m_BlendFactor) ) != 0 || m_SampleMask != sampleMask;
+	memcpy( m_BlendFactor, factor, sizeof(m_BlendFactor) );
+	m_SampleMask = sampleMask;
+
+	CountState( "OMSetBlendState", 0, 1, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMSetDepthStencilState( ID3D11DepthStencilState* state, UINT stencilReference )
+{
+	bool changed = Bind( m_DepthStencilState, state ) || m_StencilReference != stencilReference;
+	m_StencilReference = stencilReference;
+
+	CountState( "OMSetDepthStencilState", 0, 1, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::SOSetTargets( UINT count, ID3D11Buffer* const* buffers, const UINT* offsets )
+{
+	if( count > D3D11_SO_BUFFER_SLOT_COUNT )
+	{
+		CountState( "SOSetTargets", 0, count, false );
+		return;
+	}
+
+	bool changed = BindRange( m_StreamOutTargets, D3D11_SO_BUFFER_SLOT_COUNT, 0, count, buffers );
+	changed |= BindRange<ID3D11Buffer>( m_StreamOutTargets, D3D11_SO_BUFFER_SLOT_COUNT, count, D3D11_SO_BUFFER_SLOT_COUNT - count, NULL );
+	for( UINT i = 0; i < D3D11_SO_BUFFER_SLOT_COUNT; ++i )
+		m_StreamOutOffsets[i] = i < count && offsets != NULL ? offsets[i] : 0;
+
+	CountState( "SOSetTargets", 0, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::RSSetState( ID3D11RasterizerState* state )
+{
+	CountState( "RSSetState", 0, 1, Bind( m_RasterizerState, state ) );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::RSSetViewports( UINT count, const D3D11_VIEWPORT* viewports )
+{
+	if( count > D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE || ( count > 0 && viewports == NULL ) )
+	{
+		CountState( "RSSetViewports", 0, count, false );
+		return;
+	}
+
+	bool changed = count != m_ViewportCount || ( count > 0 && memcmp( m_Viewports, viewports, count * sizeof(D3D11_VIEWPORT) ) != 0 );
+	memset( m_Viewports, 0, sizeof(m_Viewports) );
+	if( count > 0 )
+		memcpy( m_Viewports, viewports, count * sizeof(D3D11_VIEWPORT) );
+	m_ViewportCount = count;
+
+	CountState( "RSSetViewports", 0, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::RSSetScissorRects( UINT count, const D3D11_RECT* rectangles )
+{
+	if( count > D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE || ( count > 0 && rectangles == NULL ) )
+	{
+		CountState( "RSSetScissorRects", 0, count, false );
+		return;
+	}
+
+	bool changed = count != m_ScissorRectCount || ( count > 0 && memcmp( m_ScissorRects, rectangles, count * sizeof(D3D11_RECT) ) != 0 );
+	memset( m_ScissorRects, 0, sizeof(m_ScissorRects) );
+	if( count > 0 )
+		memcpy( m_ScissorRects, rectangles, count * sizeof(D3D11_RECT) );
+	m_ScissorRectCount = count;
+
+	CountState( "RSSetScissorRects", 0, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::CopySubresourceRegion( ID3D11Resource* destination, UINT destinationSubresource, UINT x, UINT y, UINT z,
+	ID3D11Resource* source, UINT sourceSubresource, const D3D11_BOX* box )
+{
+	++m_Owner->m_Statistics.CopyCalls;
+	m_Owner->Record( "CopySubresourceRegion", destinationSubresource, 1 );
+
+	ReferenceResource11* to = ReferenceResource11::FromResource( destination );
+	ReferenceResource11* from = ReferenceResource11::FromResource( source );
+	if( to != NULL && from != NULL && to->GetUsage() != D3D11_USAGE_IMMUTABLE )
+		to->CopyRegion( destinationSubresource, x, y, z, from, sourceSubresource, box );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::CopyResource( ID3D11Resource* destination, ID3D11Resource* source )
+{
+	++m_Owner->m_Statistics.CopyCalls;
+	m_Owner->Record( "CopyResource", 0, 0 );
+
+	ReferenceResource11* to = ReferenceResource11::FromResource( destination );
+	ReferenceResource11* from = ReferenceResource11::FromResource( source );
+	if( to == NULL || from == NULL || to == from || to->GetUsage() == D3D11_USAGE_IMMUTABLE ||
+		to->GetSubresourceCount() != from->GetSubresourceCount() || to->GetTotalSize() != from->GetTotalSize() )
+		return;
+
+	for( UINT i = 0; i < to->GetSubresourceCount(); ++i )
+		to->CopyRegion( i, 0, 0, 0, from, i, NULL );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::UpdateSubresource( ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, const void* data, UINT rowPitch, UINT depthPitch )
+{
+	++m_Owner->m_Statistics.UpdateSubresourceCalls;
+	m_Owner->Record( "UpdateSubresource", subresource, 1 );
+
+	ReferenceResource11* storage = ReferenceResource11::FromResource( resource );
+	if( storage == NULL || storage->GetUsage() == D3D11_USAGE_IMMUTABLE || storage->GetUsage() == D3D11_USAGE_DYNAMIC )
+		return;
+
+	m_Owner->m_Statistics.BytesUploaded += storage->Write( subresource, box, data, rowPitch, depthPitch );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::CopyStructureCount( ID3D11Buffer*, UINT alignedByteOffset, ID3D11UnorderedAccessView* )
+{
+	++m_Owner->m_Statistics.CopyCalls;
+	m_Owner->Record( "CopyStructureCount", alignedByteOffset, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ClearRenderTargetView( ID3D11RenderTargetView*, const FLOAT[4] )
+{
+	++m_Owner->m_Statistics.ClearCalls;
+	m_Owner->Record( "ClearRenderTargetView", 0, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ClearUnorderedAccessViewUint( ID3D11UnorderedAccessView*, const UINT[4] )
+{
+	++m_Owner->m_Statistics.ClearCalls;
+	m_Owner->Record( "ClearUnorderedAccessViewUint", 0, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ClearUnorderedAccessViewFloat( ID3D11UnorderedAccessView*, const FLOAT[4] )
+{
+	++m_Owner->m_Statistics.ClearCalls;
+	m_Owner->Record( "ClearUnorderedAccessViewFloat", 0, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ClearDepthStencilView( ID3D11DepthStencilView*, UINT, FLOAT, UINT8 )
+{
+	++m_Owner->m_Statistics.ClearCalls;
+	m_Owner->Record( "ClearDepthStencilView", 0, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::GenerateMips( ID3D11ShaderResourceView* )
+{
+	m_Owner->Record( "GenerateMips", 0, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::SetResourceMinLOD( ID3D11Resource* resource, FLOAT minLod )
+{
+	m_Owner->Record( "SetResourceMinLOD", 0, 1 );
+
+	ReferenceResource11* storage = ReferenceResource11::FromResource( resource );
+	if( storage != NULL )
+		storage->SetMinLOD( minLod );
+}
+
+FLOAT STDMETHODCALLTYPE ReferenceDeviceContext11::GetResourceMinLOD( ID3D11Resource* resource )
+{
+	ReferenceResource11* storage = ReferenceResource11::FromResource( resource );
+	return storage != NULL ? storage->GetMinLOD() : 0.0f;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ResolveSubresource( ID3D11Resource*, UINT destinationSubresource, ID3D11Resource*, UINT, DXGI_FORMAT )
+{
+	++m_Owner->m_Statistics.CopyCalls;
+	m_Owner->Record( "ResolveSubresource", destinationSubresource, 1 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ExecuteCommandList( ID3D11CommandList*, BOOL )
+{
+	m_Owner->Record( "ExecuteCommandList", 0, 0 );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::CSSetUnorderedAccessViews( UINT startSlot, UINT count, ID3D11UnorderedAccessView* const* views, const UINT* )
+{
+	bool changed = BindRange( m_ComputeViews, D3D11_PS_CS_UAV_REGISTER_COUNT, startSlot, count, views );
+	CountState( "CSSetUnorderedAccessViews", startSlot, count, changed );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IAGetInputLayout( ID3D11InputLayout** layout )
+{
+	Get( m_InputLayout, layout );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IAGetVertexBuffers( UINT startSlot, UINT count, ID3D11Buffer** buffers, UINT* strides, UINT* offsets )
+{
+	GetRange( m_VertexBuffers, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, startSlot, count, buffers );
+
+	for( UINT i = 0; i < count; ++i )
+	{
+		UINT slot = startSlot + i;
+		if( strides != NULL )
+			strides[i] = slot < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT ? m_VertexStrides[slot] : 0;
+		if( offsets != NULL )
+			offsets[i] = slot < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT ? m_VertexOffsets[slot] : 0;
+	}
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IAGetIndexBuffer( ID3D11Buffer** buffer, DXGI_FORMAT* format, UINT* offset )
+{
+	Get( m_IndexBuffer, buffer );
+	if( format != NULL )
+		*format = m_IndexFormat;
+	if( offset != NULL )
+		*offset = m_IndexOffset;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::IAGetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY* topology )
+{
+	*topology = m_Topology;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::GetPredication( ID3D11Predicate** predicate, BOOL* value )
+{
+	Get( m_Predicate, predicate );
+	if( value != NULL )
+		*value = m_PredicateValue;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMGetRenderTargets( UINT count, ID3D11RenderTargetView** views, ID3D11DepthStencilView** depthStencilView )
+{
+	GetRange( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, 0, count, views );
+	Get( m_DepthStencilView, depthStencilView );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMGetRenderTargetsAndUnorderedAccessViews( UINT renderTargetCount, ID3D11RenderTargetView** renderTargets,
+	ID3D11DepthStencilView** depthStencilView, UINT startSlot, UINT count, ID3D11UnorderedAccessView** views )
+{
+	GetRange( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, 0, renderTargetCount, renderTargets );
+	Get( m_DepthStencilView, depthStencilView );
+	GetRange( m_OutputViews, D3D11_PS_CS_UAV_REGISTER_COUNT, startSlot, count, views );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMGetBlendState( ID3D11BlendState** state, FLOAT blendFactor[4], UINT* sampleMask )
+{
+	Get( m_BlendState, state );
+	if( blendFactor != NULL )
+		memcpy( blendFactor, m_BlendFactor, sizeof(m_BlendFactor) );
+	if( sampleMask != NULL )
+		*sampleMask = m_SampleMask;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::OMGetDepthStencilState( ID3D11DepthStencilState** state, UINT* stencilReference )
+{
+	Get( m_DepthStencilState, state );
+	if( stencilReference != NULL )
+		*stencilReference = m_StencilReference;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::SOGetTargets( UINT count, ID3D11Buffer** buffers )
+{
+	GetRange( m_StreamOutTargets, D3D11_SO_BUFFER_SLOT_COUNT, 0, count, buffers );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::RSGetState( ID3D11RasterizerState** state )
+{
+	Get( m_RasterizerState, state );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::RSGetViewports( UINT* count, D3D11_VIEWPORT* viewports )
+{
+	if( viewports != NULL )
+	{
+		for( UINT i = 0; i < *count && i < D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE; ++i )
+			viewports[i] = m_Viewports[i];
+	}
+	else
+	{
+		*count = m_ViewportCount;
+	}
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::RSGetScissorRects( UINT* count, D3D11_RECT* rectangles )
+{
+	if( rectangles != NULL )
+	{
+		for( UINT i = 0; i < *count && i < D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE; ++i )
+			rectangles[i] = m_ScissorRects[i];
+	}
+	else
+	{
+		*count = m_ScissorRectCount;
+	}
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::CSGetUnorderedAccessViews( UINT startSlot, UINT count, ID3D11UnorderedAccessView** views )
+{
+	GetRange( m_ComputeViews, D3D11_PS_CS_UAV_REGISTER_COUNT, startSlot, count, views );
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::ClearState()
+{
+	m_Owner->Record( "ClearState", 0, 0 );
+
+	for( int i = 0; i < StageCount; ++i )
+	{
+		ShaderStage& stage = m_Stages[i];
+		Bind<ID3D11DeviceChild>( stage.Shader, NULL );
+		BindRange<ID3D11Buffer>( stage.ConstantBuffers, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, 0, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, NULL );
+		BindRange<ID3D11ShaderResourceView>( stage.ShaderResources, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, 0, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, NULL );
+		BindRange<ID3D11SamplerState>( stage.Samplers, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, 0, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, NULL );
+	}
+
+	Bind<ID3D11InputLayout>( m_InputLayout, NULL );
+	m_Topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	BindRange<ID3D11Buffer>( m_VertexBuffers, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, 0, D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT, NULL );
+	memset( m_VertexStrides, 0, sizeof(m_VertexStrides) );
+	memset( m_VertexOffsets, 0, sizeof(m_VertexOffsets) );
+	Bind<ID3D11Buffer>( m_IndexBuffer, NULL );
+	m_IndexFormat = DXGI_FORMAT_UNKNOWN;
+	m_IndexOffset = 0;
+
+	BindRange<ID3D11Buffer>( m_StreamOutTargets, D3D11_SO_BUFFER_SLOT_COUNT, 0, D3D11_SO_BUFFER_SLOT_COUNT, NULL );
+	memset( m_StreamOutOffsets, 0, sizeof(m_StreamOutOffsets) );
+
+	Bind<ID3D11RasterizerState>( m_RasterizerState, NULL );
+	memset( m_Viewports, 0, sizeof(m_Viewports) );
+	m_ViewportCount = 0;
+	memset( m_ScissorRects, 0, sizeof(m_ScissorRects) );
+	m_ScissorRectCount = 0;
+
+	BindRange<ID3D11RenderTargetView>( m_RenderTargets, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, 0, D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, NULL );
+	Bind<ID3D11DepthStencilView>( m_DepthStencilView, NULL );
+	BindRange<ID3D11UnorderedAccessView>( m_OutputViews, D3D11_PS_CS_UAV_REGISTER_COUNT, 0, D3D11_PS_CS_UAV_REGISTER_COUNT, NULL );
+	BindRange<ID3D11UnorderedAccessView>( m_ComputeViews, D3D11_PS_CS_UAV_REGISTER_COUNT, 0, D3D11_PS_CS_UAV_REGISTER_COUNT, NULL );
+	Bind<ID3D11BlendState>( m_BlendState, NULL );
+	for( int i = 0; i < 4; ++i )
+		m_BlendFactor[i] = 1.0f;
+	m_SampleMask = 0xffffffff;
+	Bind<ID3D11DepthStencilState>( m_DepthStencilState, NULL );
+	m_StencilReference = 0;
+
+	Bind<ID3D11Predicate>( m_Predicate, NULL );
+	m_PredicateValue = FALSE;
+}
+
+void STDMETHODCALLTYPE ReferenceDeviceContext11::Flush()
+{
+	m_Owner->Record( "Flush", 0, 0 );
+}
+
+D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE ReferenceDeviceContext11::GetType()
+{
+	return D3D11_DEVICE_CONTEXT_IMMEDIATE;
+}
+
+UINT STDMETHODCALLTYPE ReferenceDeviceContext11::GetContextFlags()
+{
+	return 0;
+}
+
+HRESULT STDMETHODCALLTYPE ReferenceDeviceContext11::FinishCommandList( BOOL, ID3D11CommandList** )
+{
+	// only deferred contexts can record command lists
+	return DXGI_ERROR_INVALID_CALL;
+}
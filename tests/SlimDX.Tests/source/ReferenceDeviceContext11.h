@@ -0,0 +1,188 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include "ReferenceObjects11.h"
+
+class ReferenceDevice11;
+
+// Declares the eight binding methods every shader stage has.
+#define REFERENCE_SHADER_STAGE( prefix, shaderType ) \
+	virtual void STDMETHODCALLTYPE prefix##SetShaderResources( UINT startSlot, UINT count, ID3D11ShaderResourceView* const* views ); \
+	virtual void STDMETHODCALLTYPE prefix##SetShader( shaderType* shader, ID3D11ClassInstance* const* classInstances, UINT classInstanceCount ); \
+	virtual void STDMETHODCALLTYPE prefix##SetSamplers( UINT startSlot, UINT count, ID3D11SamplerState* const* samplers ); \
+	virtual void STDMETHODCALLTYPE prefix##SetConstantBuffers( UINT startSlot, UINT count, ID3D11Buffer* const* buffers ); \
+	virtual void STDMETHODCALLTYPE prefix##GetShaderResources( UINT startSlot, UINT count, ID3D11ShaderResourceView** views ); \
+	virtual void STDMETHODCALLTYPE prefix##GetShader( shaderType** shader, ID3D11ClassInstance** classInstances, UINT* classInstanceCount ); \
+	virtual void STDMETHODCALLTYPE prefix##GetSamplers( UINT startSlot, UINT count, ID3D11SamplerState** samplers ); \
+	virtual void STDMETHODCALLTYPE prefix##GetConstantBuffers( UINT startSlot, UINT count, ID3D11Buffer** buffers )
+
+// The immediate context of a ReferenceDevice11. It shares the device's reference count, as a hardware immediate context
+// does. Bound objects are referenced until they are unbound or the state is cleared, and every call is counted in the
+// device's statistics.
+class ReferenceDeviceContext11 : public ReferenceDeviceChild11<ID3D11DeviceContext>
+{
+public:
+	explicit ReferenceDeviceContext11( ReferenceDevice11* device );
+	virtual ~ReferenceDeviceContext11();
+
+	virtual ULONG STDMETHODCALLTYPE AddRef();
+	virtual ULONG STDMETHODCALLTYPE Release();
+
+	REFERENCE_SHADER_STAGE( VS, ID3D11VertexShader );
+	REFERENCE_SHADER_STAGE( HS, ID3D11HullShader );
+	REFERENCE_SHADER_STAGE( DS, ID3D11DomainShader );
+	REFERENCE_SHADER_STAGE( GS, ID3D11GeometryShader );
+	REFERENCE_SHADER_STAGE( PS, ID3D11PixelShader );
+	REFERENCE_SHADER_STAGE( CS, ID3D11ComputeShader );
+
+	virtual void STDMETHODCALLTYPE DrawIndexed( UINT indexCount, UINT startIndexLocation, INT baseVertexLocation );
+	virtual void STDMETHODCALLTYPE Draw( UINT vertexCount, UINT startVertexLocation );
+	virtual HRESULT STDMETHODCALLTYPE Map( ID3D11Resource* resource, UINT subresource, D3D11_MAP mapType, UINT mapFlags, D3D11_MAPPED_SUBRESOURCE* mapped );
+	virtual void STDMETHODCALLTYPE Unmap( ID3D11Resource* resource, UINT subresource );
+	virtual void STDMETHODCALLTYPE IASetInputLayout( ID3D11InputLayout* layout );
+	virtual void STDMETHODCALLTYPE IASetVertexBuffers( UINT startSlot, UINT count, ID3D11Buffer* const* buffers, const UINT* strides, const UINT* offsets );
+	virtual void STDMETHODCALLTYPE IASetIndexBuffer( ID3D11Buffer* buffer, DXGI_FORMAT format, UINT offset );
+	virtual void STDMETHODCALLTYPE DrawIndexedInstanced( UINT indexCountPerInstance, UINT instanceCount, UINT startIndexLocation, INT baseVertexLocation, UINT startInstanceLocation );
+	virtual void STDMETHODCALLTYPE DrawInstanced( UINT vertexCountPerInstance, UINT instanceCount, UINT startVertexLocation, UINT startInstanceLocation );
+	virtual void STDMETHODCALLTYPE IASetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY topology );
+	virtual void STDMETHODCALLTYPE Begin( ID3D11Asynchronous* async );
+	virtual void STDMETHODCALLTYPE End( ID3D11Asynchronous* async );
+	virtual HRESULT STDMETHODCALLTYPE GetData( ID3D11Asynchronous* async, void* data, UINT size, UINT flags );
+	virtual void STDMETHODCALLTYPE SetPredication( ID3D11Predicate* predicate, BOOL value );
+	virtual void STDMETHODCALLTYPE OMSetRenderTargets( UINT count, ID3D11RenderTargetView* const* views, ID3D11DepthStencilView* depthStencilView );
+	virtual void STDMETHODCALLTYPE OMSetRenderTargetsAndUnorderedAccessViews( UINT renderTargetCount, ID3D11RenderTargetView* const* renderTargets,
+		ID3D11DepthStencilView* depthStencilView, UINT startSlot, UINT count, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts );
+	virtual void STDMETHODCALLTYPE OMSetBlendState( ID3D11BlendState* state, const FLOAT blendFactor[4], UINT sampleMask );
+	virtual void STDMETHODCALLTYPE OMSetDepthStencilState( ID3D11DepthStencilState* state, UINT stencilReference );
+	virtual void STDMETHODCALLTYPE SOSetTargets( UINT count, ID3D11Buffer* const* buffers, const UINT* offsets );
+	virtual void STDMETHODCALLTYPE DrawAuto();
+	virtual void STDMETHODCALLTYPE DrawIndexedInstancedIndirect( ID3D11Buffer* arguments, UINT alignedByteOffset );
+	virtual void STDMETHODCALLTYPE DrawInstancedIndirect( ID3D11Buffer* arguments, UINT alignedByteOffset );
+	virtual void STDMETHODCALLTYPE Dispatch( UINT threadGroupCountX, UINT threadGroupCountY, UINT threadGroupCountZ );
+	virtual void STDMETHODCALLTYPE DispatchIndirect( ID3D11Buffer* arguments, UINT alignedByteOffset );
+	virtual void STDMETHODCALLTYPE RSSetState( ID3D11RasterizerState* state );
+	virtual void STDMETHODCALLTYPE RSSetViewports( UINT count, const D3D11_VIEWPORT* viewports );
+	virtual void STDMETHODCALLTYPE RSSetScissorRects( UINT count, const D3D11_RECT* rectangles );
+	virtual void STDMETHODCALLTYPE CopySubresourceRegion( ID3D11Resource* destination, UINT destinationSubresource, UINT x, UINT y, UINT z,
+		ID3D11Resource* source, UINT sourceSubresource, const D3D11_BOX* box );
+	virtual void STDMETHODCALLTYPE CopyResource( ID3D11Resource* destination, ID3D11Resource* source );
+	virtual void STDMETHODCALLTYPE UpdateSubresource( ID3D11Resource* resource, UINT subresource, const D3D11_BOX* box, const void* data, UINT rowPitch, UINT depthPitch );
+	virtual void STDMETHODCALLTYPE CopyStructureCount( ID3D11Buffer* destination, UINT alignedByteOffset, ID3D11UnorderedAccessView* source );
+	virtual void STDMETHODCALLTYPE ClearRenderTargetView( ID3D11RenderTargetView* view, const FLOAT color[4] );
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewUint( ID3D11UnorderedAccessView* view, const UINT values[4] );
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat( ID3D11UnorderedAccessView* view, const FLOAT values[4] );
+	virtual void STDMETHODCALLTYPE ClearDepthStencilView( ID3D11DepthStencilView* view, UINT flags, FLOAT depth, UINT8 stencil );
+	virtual void STDMETHODCALLTYPE GenerateMips( ID3D11ShaderResourceView* view );
+	virtual void STDMETHODCALLTYPE SetResourceMinLOD( ID3D11Resource* resource, FLOAT minLod );
+	virtual FLOAT STDMETHODCALLTYPE GetResourceMinLOD( ID3D11Resource* resource );
+	virtual void STDMETHODCALLTYPE ResolveSubresource( ID3D11Resource* destination, UINT destinationSubresource, ID3D11Resource* source, UINT sourceSubresource, DXGI_FORMAT format );
+	virtual void STDMETHODCALLTYPE ExecuteCommandList( ID3D11CommandList* commandList, BOOL restoreState );
+	virtual void STDMETHODCALLTYPE CSSetUnorderedAccessViews( UINT startSlot, UINT count, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts );
+	virtual void STDMETHODCALLTYPE IAGetInputLayout( ID3D11InputLayout** layout );
+	virtual void STDMETHODCALLTYPE IAGetVertexBuffers( UINT startSlot, UINT count, ID3D11Buffer** buffers, UINT* strides, UINT* offsets );
+	virtual void STDMETHODCALLTYPE IAGetIndexBuffer( ID3D11Buffer** buffer, DXGI_FORMAT* format, UINT* offset );
+	virtual void STDMETHODCALLTYPE IAGetPrimitiveTopology( D3D11_PRIMITIVE_TOPOLOGY* topology );
+	virtual void STDMETHODCALLTYPE GetPredication( ID3D11Predicate** predicate, BOOL* value );
+	virtual void STDMETHODCALLTYPE OMGetRenderTargets( UINT count, ID3D11RenderTargetView** views, ID3D11DepthStencilView** depthStencilView );
+	virtual void STDMETHODCALLTYPE OMGetRenderTargetsAndUnorderedAccessViews( UINT renderTargetCount, ID3D11RenderTargetView** renderTargets,
+		ID3D11DepthStencilView** depthStencilView, UINT startSlot, UINT count, ID3D11UnorderedAccessView** views );
+	virtual void STDMETHODCALLTYPE OMGetBlendState( ID3D11BlendState** state, FLOAT blendFactor[4], UINT* sampleMask );
+	virtual void STDMETHODCALLTYPE OMGetDepthStencilState( ID3D11DepthStencilState** state, UINT* stencilReference );
+	virtual void STDMETHODCALLTYPE SOGetTargets( UINT count, ID3D11Buffer** buffers );
+	virtual void STDMETHODCALLTYPE RSGetState( ID3D11RasterizerState** state );
+	virtual void STDMETHODCALLTYPE RSGetViewports( UINT* count, D3D11_VIEWPORT* viewports );
+	virtual void STDMETHODCALLTYPE RSGetScissorRects( UINT* count, D3D11_RECT* rectangles );
+	virtual void STDMETHODCALLTYPE CSGetUnorderedAccessViews( UINT startSlot, UINT count, ID3D11UnorderedAccessView** views );
+	virtual void STDMETHODCALLTYPE ClearState();
+	virtual void STDMETHODCALLTYPE Flush();
+	virtual D3D11_DEVICE_CONTEXT_TYPE STDMETHODCALLTYPE GetType();
+	virtual UINT STDMETHODCALLTYPE GetContextFlags();
+	virtual HRESULT STDMETHODCALLTYPE FinishCommandList( BOOL restoreState, ID3D11CommandList** commandList );
+
+private:
+	struct ShaderStage
+	{
+		ID3D11DeviceChild* Shader;
+		ID3D11Buffer* ConstantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+		ID3D11ShaderResourceView* ShaderResources[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+		ID3D11SamplerState* Samplers[D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT];
+	};
+
+	enum
+	{
+		VertexStage,
+		HullStage,
+		DomainStage,
+		GeometryStage,
+		PixelStage,
+		ComputeStage,
+		StageCount
+	};
+
+	void SetShader( ShaderStage& stage, const char* method, ID3D11DeviceChild* shader );
+	void GetShader( ShaderStage& stage, ID3D11DeviceChild** shader, ID3D11ClassInstance** classInstances, UINT* classInstanceCount );
+
+	// Binds count objects starting at startSlot, or unbinds them if values is NULL. Returns true if any slot changed.
+	template< typename T >
+	bool BindRange( T** slots, UINT slotCount, UINT startSlot, UINT count, T* const* values );
+
+	template< typename T >
+	void GetRange( T* const* slots, UINT slotCount, UINT startSlot, UINT count, T** values );
+
+	void CountState( const char* method, UINT first, UINT count, bool changed );
+	void CountDraw( const char* method, UINT first, UINT count );
+
+	ReferenceDevice11* m_Owner;
+	ShaderStage m_Stages[StageCount];
+
+	ID3D11InputLayout* m_InputLayout;
+	D3D11_PRIMITIVE_TOPOLOGY m_Topology;
+	ID3D11Buffer* m_VertexBuffers[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT m_VertexStrides[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT m_VertexOffsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	ID3D11Buffer* m_IndexBuffer;
+	DXGI_FORMAT m_IndexFormat;
+	UINT m_IndexOffset;
+
+	ID3D11Buffer* m_StreamOutTargets[D3D11_SO_BUFFER_SLOT_COUNT];
+	UINT m_StreamOutOffsets[D3D11_SO_BUFFER_SLOT_COUNT];
+
+	ID3D11RasterizerState* m_RasterizerState;
+	D3D11_VIEWPORT m_Viewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+	UINT m_ViewportCount;
+	D3D11_RECT m_ScissorRects[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+	UINT m_ScissorRectCount;
+
+	ID3D11RenderTargetView* m_RenderTargets[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT];
+	ID3D11DepthStencilView* m_DepthStencilView;
+	ID3D11UnorderedAccessView* m_OutputViews[D3D11_PS_CS_UAV_REGISTER_COUNT];
+	ID3D11UnorderedAccessView* m_ComputeViews[D3D11_PS_CS_UAV_REGISTER_COUNT];
+	ID3D11BlendState* m_BlendState;
+	FLOAT m_BlendFactor[4];
+	UINT m_SampleMask;
+	ID3D11DepthStencilState* m_DepthStencilState;
+	UINT m_StencilReference;
+
+	ID3D11Predicate* m_Predicate;
+	BOOL m_PredicateValue;
+};
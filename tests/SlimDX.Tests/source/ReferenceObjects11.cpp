@@ -0,0 +1,472 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "ReferenceObjects11.h"
+
+// {5C1F3E2A-8D4B-4F6E-9A7C-2B3D4E5F6A71}
+const GUID IID_ReferenceResource11 = { 0x5c1f3e2a, 0x8d4b, 0x4f6e, { 0x9a, 0x7c, 0x2b, 0x3d, 0x4e, 0x5f, 0x6a, 0x71 } };
+
+ReferencePrivateData11::~ReferencePrivateData11()
+{
+	for( size_t i = 0; i < m_Entries.size(); ++i )
+	{
+		if( m_Entries[i].Interface != NULL )
+			m_Entries[i].Interface->Release();
+	}
+}
+
+HRESULT ReferencePrivateData11::Get( REFGUID guid, UINT* size, void* data )
+{
+	if( size == NULL )
+		return E_INVALIDARG;
+
+	for( size_t i = 0; i < m_Entries.size(); ++i )
+	{
+		Entry& entry = m_Entries[i];
+		if( entry.Guid != guid )
+			continue;
+
+		UINT required = entry.Interface != NULL ? sizeof(IUnknown*) : static_cast<UINT>( entry.Data.size() );
+		if( data == NULL )
+		{
+			*size = required;
+			return S_OK;
+		}
+
+		if( *size < required )
+		{
+			*size = required;
+			return DXGI_ERROR_MORE_DATA;
+		}
+
+		*size = required;
+		if( entry.Interface != NULL )
+		{
+			entry.Interface->AddRef();
+			*static_cast<IUnknown**>( data ) = entry.Interface;
+		}
+		else if( required > 0 )
+		{
+			memcpy( data, &entry.Data[0], required );
+		}
+
+		return S_OK;
+	}
+
+	*size = 0;
+	return DXGI_ERROR_NOT_FOUND;
+}
+
+HRESULT ReferencePrivateData11::Set( REFGUID guid, UINT size, const void* data )
+{
+	Remove( guid );
+	if( data == NULL || size == 0 )
+		return S_OK;
+
+	Entry entry;
+	entry.Guid = guid;
+	entry.Data.assign( static_cast<const unsigned char*>( data ), static_cast<const unsigned char*>( data ) + size );
+	entry.Interface = NULL;
+	m_Entries.push_back( entry );
+	return S_OK;
+}
+
+HRESULT ReferencePrivateData11::SetInterface( REFGUID guid, const IUnknown* data )
+{
+	Remove( guid );
+	if( data == NULL )
+		return S_OK;
+
+	Entry entry;
+	entry.Guid = guid;
+	entry.Interface = const_cast<IUnknown*>( data );
+	entry.Interface->AddRef();
+	m_Entries.push_back( entry );
+	return S_OK;
+}
+
+void ReferencePrivateData11::Remove( REFGUID guid )
+{
+	for( size_t i = 0; i < m_Entries.size(); ++i )
+	{
+		if( m_Entries[i].Guid != guid )
+			continue;
+
+		if( m_Entries[i].Interface != NULL )
+			m_Entries[i].Interface->Release();
+
+		m_Entries.erase( m_Entries.begin() + i );
+		return;
+	}
+}
+
+namespace
+{
+	UINT GetMipExtent( UINT extent, UINT mip )
+	{
+		extent >>= mip;
+		return extent > 0 ? extent : 1;
+	}
+
+	// Applies the usage rules the runtime enforces for every resource type.
+	bool IsValidUsage( D3D11_USAGE usage, UINT cpuAccessFlags, UINT bindFlags, const D3D11_SUBRESOURCE_DATA* initialData )
+	{
+		switch( usage )
+		{
+		case D3D11_USAGE_DEFAULT:
+			return cpuAccessFlags == 0;
+		case D3D11_USAGE_IMMUTABLE:
+			return cpuAccessFlags == 0 && initialData != NULL;
+		case D3D11_USAGE_DYNAMIC:
+			return cpuAccessFlags == D3D11_CPU_ACCESS_WRITE;
+		case D3D11_USAGE_STAGING:
+			return bindFlags == 0 && cpuAccessFlags != 0;
+		default:
+			return false;
+		}
+	}
+}
+
+UINT GetReferenceElementSize( DXGI_FORMAT format, UINT& blockSize )
+{
+	blockSize = 1;
+
+	if( format >= DXGI_FORMAT_R32G32B32A32_TYPELESS && format <= DXGI_FORMAT_R32G32B32A32_SINT )
+		return 16;
+	if( format >= DXGI_FORMAT_R32G32B32_TYPELESS && format <= DXGI_FORMAT_R32G32B32_SINT )
+		return 12;
+	if( format >= DXGI_FORMAT_R16G16B16A16_TYPELESS && format <= DXGI_FORMAT_X32_TYPELESS_G8X24_UINT )
+		return 8;
+	if( format >= DXGI_FORMAT_R10G10B10A2_TYPELESS && format <= DXGI_FORMAT_X24_TYPELESS_G8_UINT )
+		return 4;
+	if( format >= DXGI_FORMAT_R8G8_TYPELESS && format <= DXGI_FORMAT_R16_SINT )
+		return 2;
+	if( format >= DXGI_FORMAT_R8_TYPELESS && format <= DXGI_FORMAT_A8_UNORM )
+		return 1;
+	if( format >= DXGI_FORMAT_R9G9B9E5_SHAREDEXP && format <= DXGI_FORMAT_G8R8_G8B8_UNORM )
+		return 4;
+	if( format >= DXGI_FORMAT_B5G6R5_UNORM && format <= DXGI_FORMAT_B5G5R5A1_UNORM )
+		return 2;
+	if( format >= DXGI_FORMAT_B8G8R8A8_UNORM && format <= DXGI_FORMAT_B8G8R8X8_UNORM_SRGB )
+		return 4;
+
+	blockSize = 4;
+	if( ( format >= DXGI_FORMAT_BC1_TYPELESS && format <= DXGI_FORMAT_BC1_UNORM_SRGB ) ||
+		( format >= DXGI_FORMAT_BC4_TYPELESS && format <= DXGI_FORMAT_BC4_SNORM ) )
+		return 8;
+	if( ( format >= DXGI_FORMAT_BC2_TYPELESS && format <= DXGI_FORMAT_BC3_UNORM_SRGB ) ||
+		( format >= DXGI_FORMAT_BC5_TYPELESS && format <= DXGI_FORMAT_BC5_SNORM ) ||
+		( format >= DXGI_FORMAT_BC6H_TYPELESS && format <= DXGI_FORMAT_BC7_UNORM_SRGB ) )
+		return 16;
+
+	blockSize = 1;
+	return 0;
+}
+
+ReferenceResource11* ReferenceResource11::FromResource( ID3D11Resource* resource )
+{
+	if( resource == NULL )
+		return NULL;
+
+	void* storage = NULL;
+	if( FAILED( resource->QueryInterface( IID_ReferenceResource11, &storage ) ) )
+		return NULL;
+
+	// the caller's reference keeps the resource alive
+	resource->Release();
+	return static_cast<ReferenceResource11*>( storage );
+}
+
+ReferenceResource11::ReferenceResource11()
+: m_EvictionPriority( DXGI_RESOURCE_PRIORITY_NORMAL ), m_Usage( D3D11_USAGE_DEFAULT ), m_CpuAccessFlags( 0 ), m_ElementSize( 1 ), m_BlockSize( 1 ), m_MinLOD( 0.0f )
+{
+}
+
+bool ReferenceResource11::InitializeBuffer( UINT size, D3D11_USAGE usage, UINT cpuAccessFlags )
+{
+	if( size == 0 )
+		return false;
+
+	Subresource subresource = { 0, size, size, 1, 1, size, 1, 1, false };
+	m_Subresources.push_back( subresource );
+	m_Data.resize( size );
+	m_Usage = usage;
+	m_CpuAccessFlags = cpuAccessFlags;
+	return true;
+}
+
+bool ReferenceResource11::InitializeTexture( DXGI_FORMAT format, UINT width, UINT height, UINT depth, UINT& mipLevels, UINT arraySize,
+	D3D11_USAGE usage, UINT cpuAccessFlags )
+{
+	m_ElementSize = GetReferenceElementSize( format, m_BlockSize );
+	if( m_ElementSize == 0 || width == 0 || height == 0 || depth == 0 || arraySize == 0 )
+		return false;
+
+	UINT largest = width > height ? width : height;
+	if( depth > largest )
+		largest = depth;
+
+	UINT fullChain = 1;
+	for( ; largest > 1; largest >>= 1 )
+		++fullChain;
+
+	if( mipLevels == 0 )
+		mipLevels = fullChain;
+	else if( mipLevels > fullChain )
+		return false;
+
+	size_t offset = 0;
+	for( UINT slice = 0; slice < arraySize; ++slice )
+	{
+		for( UINT mip = 0; mip < mipLevels; ++mip )
+		{
+			Subresource subresource;
+			subresource.Offset = offset;
+			subresource.Width = GetMipExtent( width, mip );
+			subresource.Height = GetMipExtent( height, mip );
+			subresource.Depth = GetMipExtent( depth, mip );
+			subresource.Rows = ( subresource.Height + m_BlockSize - 1 ) / m_BlockSize;
+			subresource.Slices = subresource.Depth;
+			subresource.RowPitch = ( subresource.Width + m_BlockSize - 1 ) / m_BlockSize * m_ElementSize;
+			subresource.DepthPitch = subresource.RowPitch * subresource.Rows;
+			subresource.Mapped = false;
+
+			m_Subresources.push_back( subresource );
+			offset += subresource.DepthPitch * subresource.Slices;
+		}
+	}
+
+	m_Data.resize( offset );
+	m_Usage = usage;
+	m_CpuAccessFlags = cpuAccessFlags;
+	return true;
+}
+
+void ReferenceResource11::Fill( const D3D11_SUBRESOURCE_DATA* initialData )
+{
+	if( initialData == NULL )
+		return;
+
+	for( UINT i = 0; i < GetSubresourceCount(); ++i )
+	{
+		if( initialData[i].pSysMem != NULL )
+			Write( i, NULL, initialData[i].pSysMem, initialData[i].SysMemPitch, initialData[i].SysMemSlicePitch );
+	}
+}
+
+bool ReferenceResource11::GetRegion( UINT subresource, const D3D11_BOX* box, UINT& offset, UINT& rowBytes, UINT& rows, UINT& slices ) const
+{
+	if( subresource >= GetSubresourceCount() )
+		return false;
+
+	const Subresource& target = m_Subresources[subresource];
+	if( box == NULL )
+	{
+		offset = 0;
+		rowBytes = target.RowPitch;
+		rows = target.Rows;
+		slices = target.Slices;
+		return true;
+	}
+
+	if( box->left >= box->right || box->top >= box->bottom || box->front >= box->back ||
+		box->right > target.Width || box->bottom > target.Height || box->back > target.Depth )
+		return false;
+
+	offset = box->front * target.DepthPitch + box->top / m_BlockSize * target.RowPitch + box->left / m_BlockSize * m_ElementSize;
+	rowBytes = ( box->right - box->left + m_BlockSize - 1 ) / m_BlockSize * m_ElementSize;
+	rows = ( box->bottom - box->top + m_BlockSize - 1 ) / m_BlockSize;
+	slices = box->back - box->front;
+	return true;
+}
+
+UINT ReferenceResource11::Write( UINT subresource, const D3D11_BOX* box, const void* data, UINT rowPitch, UINT depthPitch )
+{
+	UINT offset, rowBytes, rows, slices;
+	if( data == NULL || !GetRegion( subresource, box, offset, rowBytes, rows, slices ) )
+		return 0;
+
+	// a single row or slice needs no pitch, as with D3D11_SUBRESOURCE_DATA for buffers
+	if( rows == 1 )
+		rowPitch = rowBytes;
+	if( slices == 1 )
+		depthPitch = rowPitch * rows;
+
+	const Subresource& target = m_Subresources[subresource];
+	unsigned char* destination = &m_Data[target.Offset + offset];
+	const unsigned char* source = static_cast<const unsigned char*>( data );
+
+	for( UINT z = 0; z < slices; ++z )
+	{
+		for( UINT y = 0; y < rows; ++y )
+			memcpy( destination + z * target.DepthPitch + y * target.RowPitch, source + z * depthPitch + y * rowPitch, rowBytes );
+	}
+
+	return rowBytes * rows * slices;
+}
+
+UINT ReferenceResource11::CopyRegion( UINT subresource, UINT x, UINT y, UINT z, ReferenceResource11* source, UINT sourceSubresource, const D3D11_BOX* box )
+{
+	if( source == NULL || source->m_ElementSize != m_ElementSize || source->m_BlockSize != m_BlockSize || sourceSubresource >= source->GetSubresourceCount() )
+		return 0;
+
+	const Subresource& from = source->m_Subresources[sourceSubresource];
+	D3D11_BOX sourceBox = { 0, 0, 0, from.Width, from.Height, from.Depth };
+	if( box != NULL )
+		sourceBox = *box;
+
+	UINT sourceOffset, rowBytes, rows, slices;
+	if( !source->GetRegion( sourceSubresource, &sourceBox, sourceOffset, rowBytes, rows, slices ) )
+		return 0;
+
+	D3D11_BOX destinationBox = { x, y, z, x + sourceBox.right - sourceBox.left, y + sourceBox.bottom - sourceBox.top, z + sourceBox.back - sourceBox.front };
+	UINT offset, destinationRowBytes, destinationRows, destinationSlices;
+	if( !GetRegion( subresource, &destinationBox, offset, destinationRowBytes, destinationRows, destinationSlices ) )
+		return 0;
+
+	const Subresource& to = m_Subresources[subresource];
+	unsigned char* destination = &m_Data[to.Offset + offset];
+	const unsigned char* sourceData = &source->m_Data[from.Offset + sourceOffset];
+
+	for( UINT slice = 0; slice < slices; ++slice )
+	{
+		// memmove, since a resource may copy between regions of itself
+		for( UINT row = 0; row < rows; ++row )
+			memmove( destination + slice * to.DepthPitch + row * to.RowPitch, sourceData + slice * from.DepthPitch + row * from.RowPitch, rowBytes );
+	}
+
+	return rowBytes * rows * slices;
+}
+
+ReferenceBuffer11::ReferenceBuffer11( ID3D11Device* device, const D3D11_BUFFER_DESC& description )
+: ReferenceResourceBase11<ID3D11Buffer, D3D11_RESOURCE_DIMENSION_BUFFER>( device ), m_Description( description )
+{
+}
+
+ReferenceBuffer11* ReferenceBuffer11::Create( ID3D11Device* device, const D3D11_BUFFER_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData )
+{
+	if( !IsValidUsage( description.Usage, description.CPUAccessFlags, description.BindFlags, initialData ) )
+		return NULL;
+
+	// constant buffers must be a multiple of 16 bytes and cannot be bound as anything else
+	if( ( description.BindFlags & D3D11_BIND_CONSTANT_BUFFER ) != 0 &&
+		( description.BindFlags != D3D11_BIND_CONSTANT_BUFFER || description.ByteWidth % 16 != 0 ) )
+		return NULL;
+
+	if( ( description.MiscFlags & D3D11_RESOURCE_MISC_BUFFER_STRUCTURED ) != 0 &&
+		( description.StructureByteStride == 0 || description.ByteWidth % description.StructureByteStride != 0 ) )
+		return NULL;
+
+	ReferenceBuffer11* buffer = new ReferenceBuffer11( device, description );
+	if( !buffer->InitializeBuffer( description.ByteWidth, description.Usage, description.CPUAccessFlags ) )
+	{
+		buffer->Release();
+		return NULL;
+	}
+
+	buffer->Fill( initialData );
+	return buffer;
+}
+
+ReferenceTexture1D11::ReferenceTexture1D11( ID3D11Device* device, const D3D11_TEXTURE1D_DESC& description )
+: ReferenceResourceBase11<ID3D11Texture1D, D3D11_RESOURCE_DIMENSION_TEXTURE1D>( device ), m_Description( description )
+{
+}
+
+ReferenceTexture1D11* ReferenceTexture1D11::Create( ID3D11Device* device, const D3D11_TEXTURE1D_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData )
+{
+	if( !IsValidUsage( description.Usage, description.CPUAccessFlags, description.BindFlags, initialData ) )
+		return NULL;
+
+	ReferenceTexture1D11* texture = new ReferenceTexture1D11( device, description );
+	if( !texture->InitializeTexture( description.Format, description.Width, 1, 1, texture->m_Description.MipLevels, description.ArraySize,
+		description.Usage, description.CPUAccessFlags ) )
+	{
+		texture->Release();
+		return NULL;
+	}
+
+	texture->Fill( initialData );
+	return texture;
+}
+
+ReferenceTexture2D11::ReferenceTexture2D11( ID3D11Device* device, const D3D11_TEXTURE2D_DESC& description )
+: ReferenceResourceBase11<ID3D11Texture2D, D3D11_RESOURCE_DIMENSION_TEXTURE2D>( device ), m_Description( description )
+{
+}
+
+ReferenceTexture2D11* ReferenceTexture2D11::Create( ID3D11Device* device, const D3D11_TEXTURE2D_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData )
+{
+	if( !IsValidUsage( description.Usage, description.CPUAccessFlags, description.BindFlags, initialData ) )
+		return NULL;
+
+	// multisampled textures cannot have mip maps
+	if( description.SampleDesc.Count == 0 || ( description.SampleDesc.Count > 1 && description.MipLevels != 1 ) )
+		return NULL;
+
+	ReferenceTexture2D11* texture = new ReferenceTexture2D11( device, description );
+	if( !texture->InitializeTexture( description.Format, description.Width, description.Height, 1, texture->m_Description.MipLevels,
+		description.ArraySize, description.Usage, description.CPUAccessFlags ) )
+	{
+		texture->Release();
+		return NULL;
+	}
+
+	texture->Fill( initialData );
+	return texture;
+}
+
+ReferenceTexture3D11::ReferenceTexture3D11( ID3D11Device* device, const D3D11_TEXTURE3D_DESC& description )
+: ReferenceResourceBase11<ID3D11Texture3D, D3D11_RESOURCE_DIMENSION_TEXTURE3D>( device ), m_Description( description )
+{
+}
+
+ReferenceTexture3D11* ReferenceTexture3D11::Create( ID3D11Device* device, const D3D11_TEXTURE3D_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData )
+{
+	if( !IsValidUsage( description.Usage, description.CPUAccessFlags, description.BindFlags, initialData ) )
+		return NULL;
+
+	ReferenceTexture3D11* texture = new ReferenceTexture3D11( device, description );
+	if( !texture->InitializeTexture( description.Format, description.Width, description.Height, description.Depth, texture->m_Description.MipLevels,
+		1, description.Usage, description.CPUAccessFlags ) )
+	{
+		texture->Release();
+		return NULL;
+	}
+
+	texture->Fill( initialData );
+	return texture;
+}
+
+ReferenceInputLayout11::ReferenceInputLayout11( ID3D11Device* device, const D3D11_INPUT_ELEMENT_DESC* elements, UINT count )
+: ReferenceDeviceChild11<ID3D11InputLayout>( device ), m_Elements( elements, elements + count )
+{
+	// copy the semantic names first, since growing the vector may move the strings
+	for( UINT i = 0; i < count; ++i )
+		m_SemanticNames.push_back( elements[i].SemanticName != NULL ? elements[i].SemanticName : "" );
+
+	for( UINT i = 0; i < count; ++i )
+		m_Elements[i].SemanticName = m_SemanticNames[i].c_str();
+}
@@ -0,0 +1,420 @@
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Reference implementations of the Direct3D 11 resource, view, state and shader interfaces. They are
+// backed by system memory so that ReferenceDevice11 can stand in for a hardware device in tests.
+
+// Stores the blobs and interfaces attached through Get/SetPrivateData.
+class ReferencePrivateData11
+{
+public:
+	~ReferencePrivateData11();
+
+	HRESULT Get( REFGUID guid, UINT* size, void* data );
+	HRESULT Set( REFGUID guid, UINT size, const void* data );
+	HRESULT SetInterface( REFGUID guid, const IUnknown* data );
+
+private:
+	struct Entry
+	{
+		GUID Guid;
+		std::vector<unsigned char> Data;
+		IUnknown* Interface;
+	};
+
+	void Remove( REFGUID guid );
+
+	std::vector<Entry> m_Entries;
+};
+
+// Implements IUnknown and ID3D11DeviceChild for an interface T, which also answers queries for Parent.
+// Objects hold a weak pointer to their device, so the device must outlive everything it created.
+template< typename T, typename Parent = ID3D11DeviceChild >
+class ReferenceDeviceChild11 : public T
+{
+public:
+	explicit ReferenceDeviceChild11( ID3D11Device* device )
+	: m_Device( device ), m_ReferenceCount( 1 )
+	{
+	}
+
+	virtual ~ReferenceDeviceChild11()
+	{
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface( REFIID iid, void** object )
+	{
+		if( object == NULL )
+			return E_POINTER;
+
+		if( iid == __uuidof(IUnknown) || iid == __uuidof(ID3D11DeviceChild) || iid == __uuidof(Parent) || iid == __uuidof(T) )
+		{
+			*object = static_cast<T*>( this );
+			AddRef();
+			return S_OK;
+		}
+
+		*object = NULL;
+		return E_NOINTERFACE;
+	}
+
+	virtual ULONG STDMETHODCALLTYPE AddRef()
+	{
+		return InterlockedIncrement( &m_ReferenceCount );
+	}
+
+	virtual ULONG STDMETHODCALLTYPE Release()
+	{
+		ULONG count = InterlockedDecrement( &m_ReferenceCount );
+		if( count == 0 )
+			delete this;
+
+		return count;
+	}
+
+	virtual void STDMETHODCALLTYPE GetDevice( ID3D11Device** device )
+	{
+		m_Device->AddRef();
+		*device = m_Device;
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE GetPrivateData( REFGUID guid, UINT* size, void* data )
+	{
+		return m_PrivateData.Get( guid, size, data );
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateData( REFGUID guid, UINT size, const void* data )
+	{
+		return m_PrivateData.Set( guid, size, data );
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface( REFGUID guid, const IUnknown* data )
+	{
+		return m_PrivateData.SetInterface( guid, data );
+	}
+
+private:
+	ID3D11Device* m_Device;
+	LONG m_ReferenceCount;
+	ReferencePrivateData11 m_PrivateData;
+};
+
+// The system memory behind a buffer or texture, split into subresources laid out the way Map exposes them.
+class ReferenceResource11
+{
+public:
+	// Finds the storage behind a resource created by a ReferenceDevice11. Returns NULL for any other resource.
+	static ReferenceResource11* FromResource( ID3D11Resource* resource );
+
+	virtual ~ReferenceResource11()
+	{
+	}
+
+	UINT GetSubresourceCount() const { return static_cast<UINT>( m_Subresources.size() ); }
+	unsigned char* GetData( UINT subresource ) { return &m_Data[m_Subresources[subresource].Offset]; }
+	UINT GetRowPitch( UINT subresource ) const { return m_Subresources[subresource].RowPitch; }
+	UINT GetDepthPitch( UINT subresource ) const { return m_Subresources[subresource].DepthPitch; }
+	UINT GetSize( UINT subresource ) const { return m_Subresources[subresource].DepthPitch * m_Subresources[subresource].Slices; }
+	UINT GetTotalSize() const { return static_cast<UINT>( m_Data.size() ); }
+
+	D3D11_USAGE GetUsage() const { return m_Usage; }
+	UINT GetCpuAccessFlags() const { return m_CpuAccessFlags; }
+
+	bool IsMapped( UINT subresource ) const { return m_Subresources[subresource].Mapped; }
+	void SetMapped( UINT subresource, bool mapped ) { m_Subresources[subresource].Mapped = mapped; }
+
+	FLOAT GetMinLOD() const { return m_MinLOD; }
+	void SetMinLOD( FLOAT minLod ) { m_MinLOD = minLod; }
+
+	// Copies a region into a subresource. A NULL box means the whole subresource. Returns the number of bytes written,
+	// or 0 if the box does not fit.
+	UINT Write( UINT subresource, const D3D11_BOX* box, const void* data, UINT rowPitch, UINT depthPitch );
+
+	// Copies a region of another subresource with the same element size into this one. Returns the number of bytes written.
+	UINT CopyRegion( UINT subresource, UINT x, UINT y, UINT z, ReferenceResource11* source, UINT sourceSubresource, const D3D11_BOX* box );
+
+protected:
+	ReferenceResource11();
+
+	// Lays out a buffer as a single subresource. Returns false if the size is zero.
+	bool InitializeBuffer( UINT size, D3D11_USAGE usage, UINT cpuAccessFlags );
+
+	// Lays out the mip chain of every array slice, and sets mipLevels if it is 0. Returns false for formats without a
+	// known element size.
+	bool InitializeTexture( DXGI_FORMAT format, UINT width, UINT height, UINT depth, UINT& mipLevels, UINT arraySize,
+		D3D11_USAGE usage, UINT cpuAccessFlags );
+
+	// Fills the subresources from the initial data given to a Create method.
+	void Fill( const D3D11_SUBRESOURCE_DATA* initialData );
+
+	UINT m_EvictionPriority;
+
+private:
+	struct Subresource
+	{
+		size_t Offset;
+		UINT RowPitch;
+		UINT DepthPitch;
+		UINT Rows;
+		UINT Slices;
+		UINT Width;
+		UINT Height;
+		UINT Depth;
+		bool Mapped;
+	};
+
+	bool GetRegion( UINT subresource, const D3D11_BOX* box, UINT& offset, UINT& rowBytes, UINT& rows, UINT& slices ) const;
+
+	std::vector<unsigned char> m_Data;
+	std::vector<Subresource> m_Subresources;
+	D3D11_USAGE m_Usage;
+	UINT m_CpuAccessFlags;
+	UINT m_ElementSize;
+	UINT m_BlockSize;
+	FLOAT m_MinLOD;
+};
+
+// Gets the size of one element of a format, or of one 4x4 block for block compressed formats. Returns 0 for
+// formats the reference device does not support.
+UINT GetReferenceElementSize( DXGI_FORMAT format, UINT& blockSize );
+
+// The private interface a reference resource answers with its ReferenceResource11 storage.
+extern const GUID IID_ReferenceResource11;
+
+template< typename T, D3D11_RESOURCE_DIMENSION Dimension >
+class ReferenceResourceBase11 : public ReferenceDeviceChild11<T, ID3D11Resource>, public ReferenceResource11
+{
+public:
+	explicit ReferenceResourceBase11( ID3D11Device* device )
+	: ReferenceDeviceChild11<T, ID3D11Resource>( device )
+	{
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface( REFIID iid, void** object )
+	{
+		if( object != NULL && iid == IID_ReferenceResource11 )
+		{
+			*object = static_cast<ReferenceResource11*>( this );
+			this->AddRef();
+			return S_OK;
+		}
+
+		return ReferenceDeviceChild11<T, ID3D11Resource>::QueryInterface( iid, object );
+	}
+
+	virtual void STDMETHODCALLTYPE GetType( D3D11_RESOURCE_DIMENSION* dimension )
+	{
+		*dimension = Dimension;
+	}
+
+	virtual void STDMETHODCALLTYPE SetEvictionPriority( UINT priority )
+	{
+		m_EvictionPriority = priority;
+	}
+
+	virtual UINT STDMETHODCALLTYPE GetEvictionPriority()
+	{
+		return m_EvictionPriority;
+	}
+};
+
+class ReferenceBuffer11 : public ReferenceResourceBase11<ID3D11Buffer, D3D11_RESOURCE_DIMENSION_BUFFER>
+{
+public:
+	// Returns NULL if the description is invalid.
+	static ReferenceBuffer11* Create( ID3D11Device* device, const D3D11_BUFFER_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData );
+
+	virtual void STDMETHODCALLTYPE GetDesc( D3D11_BUFFER_DESC* description )
+	{
+		*description = m_Description;
+	}
+
+private:
+	ReferenceBuffer11( ID3D11Device* device, const D3D11_BUFFER_DESC& description );
+
+	D3D11_BUFFER_DESC m_Description;
+};
+
+class ReferenceTexture1D11 : public ReferenceResourceBase11<ID3D11Texture1D, D3D11_RESOURCE_DIMENSION_TEXTURE1D>
+{
+public:
+	static ReferenceTexture1D11* Create( ID3D11Device* device, const D3D11_TEXTURE1D_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData );
+
+	virtual void STDMETHODCALLTYPE GetDesc( D3D11_TEXTURE1D_DESC* description )
+	{
+		*description = m_Description;
+	}
+
+private:
+	ReferenceTexture1D11( ID3D11Device* device, const D3D11_TEXTURE1D_DESC& description );
+
+	D3D11_TEXTURE1D_DESC m_Description;
+};
+
+class ReferenceTexture2D11 : public ReferenceResourceBase11<ID3D11Texture2D, D3D11_RESOURCE_DIMENSION_TEXTURE2D>
+{
+public:
+	static ReferenceTexture2D11* Create( ID3D11Device* device, const D3D11_TEXTURE2D_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData );
+
+	virtual void STDMETHODCALLTYPE GetDesc( D3D11_TEXTURE2D_DESC* description )
+	{
+		*description = m_Description;
+	}
+
+private:
+	ReferenceTexture2D11( ID3D11Device* device, const D3D11_TEXTURE2D_DESC& description );
+
+	D3D11_TEXTURE2D_DESC m_Description;
+};
+
+class ReferenceTexture3D11 : public ReferenceResourceBase11<ID3D11Texture3D, D3D11_RESOURCE_DIMENSION_TEXTURE3D>
+{
+public:
+	static ReferenceTexture3D11* Create( ID3D11Device* device, const D3D11_TEXTURE3D_DESC& description, const D3D11_SUBRESOURCE_DATA* initialData );
+
+	virtual void STDMETHODCALLTYPE GetDesc( D3D11_TEXTURE3D_DESC* description )
+	{
+		*description = m_Description;
+	}
+
+private:
+	ReferenceTexture3D11( ID3D11Device* device, const D3D11_TEXTURE3D_DESC& description );
+
+	D3D11_TEXTURE3D_DESC m_Description;
+};
+
+// A view keeps its resource alive and returns the description it was created with.
+template< typename T, typename Description >
+class ReferenceView11 : public ReferenceDeviceChild11<T, ID3D11View>
+{
+public:
+	ReferenceView11( ID3D11Device* device, ID3D11Resource* resource, const Description& description )
+	: ReferenceDeviceChild11<T, ID3D11View>( device ), m_Resource( resource ), m_Description( description )
+	{
+		m_Resource->AddRef();
+	}
+
+	virtual ~ReferenceView11()
+	{
+		m_Resource->Release();
+	}
+
+	virtual void STDMETHODCALLTYPE GetResource( ID3D11Resource** resource )
+	{
+		m_Resource->AddRef();
+		*resource = m_Resource;
+	}
+
+	virtual void STDMETHODCALLTYPE GetDesc( Description* description )
+	{
+		*description = m_Description;
+	}
+
+private:
+	ID3D11Resource* m_Resource;
+	Description m_Description;
+};
+
+typedef ReferenceView11<ID3D11ShaderResourceView, D3D11_SHADER_RESOURCE_VIEW_DESC> ReferenceShaderResourceView11;
+typedef ReferenceView11<ID3D11RenderTargetView, D3D11_RENDER_TARGET_VIEW_DESC> ReferenceRenderTargetView11;
+typedef ReferenceView11<ID3D11DepthStencilView, D3D11_DEPTH_STENCIL_VIEW_DESC> ReferenceDepthStencilView11;
+typedef ReferenceView11<ID3D11UnorderedAccessView, D3D11_UNORDERED_ACCESS_VIEW_DESC> ReferenceUnorderedAccessView11;
+
+template< typename T, typename Description >
+class ReferenceState11 : public ReferenceDeviceChild11<T>
+{
+public:
+	ReferenceState11( ID3D11Device* device, const Description& description )
+	: ReferenceDeviceChild11<T>( device ), m_Description( description )
+	{
+	}
+
+	virtual void STDMETHODCALLTYPE GetDesc( Description* description )
+	{
+		*description = m_Description;
+	}
+
+private:
+	Description m_Description;
+};
+
+typedef ReferenceState11<ID3D11BlendState, D3D11_BLEND_DESC> ReferenceBlendState11;
+typedef ReferenceState11<ID3D11DepthStencilState, D3D11_DEPTH_STENCIL_DESC> ReferenceDepthStencilState11;
+typedef ReferenceState11<ID3D11RasterizerState, D3D11_RASTERIZER_DESC> ReferenceRasterizerState11;
+typedef ReferenceState11<ID3D11SamplerState, D3D11_SAMPLER_DESC> ReferenceSamplerState11;
+
+// Shaders keep a copy of their bytecode so tests can tell them apart.
+template< typename T >
+class ReferenceShader11 : public ReferenceDeviceChild11<T>
+{
+public:
+	ReferenceShader11( ID3D11Device* device, const void* bytecode, SIZE_T length )
+	: ReferenceDeviceChild11<T>( device ),
+	  m_Bytecode( static_cast<const unsigned char*>( bytecode ), static_cast<const unsigned char*>( bytecode ) + length )
+	{
+	}
+
+	const std::vector<unsigned char>& GetBytecode() const { return m_Bytecode; }
+
+private:
+	std::vector<unsigned char> m_Bytecode;
+};
+
+// Class linkages hold no classes; the effects framework creates one for every effect whether it uses interfaces or not.
+class ReferenceClassLinkage11 : public ReferenceDeviceChild11<ID3D11ClassLinkage>
+{
+public:
+	explicit ReferenceClassLinkage11( ID3D11Device* device )
+	: ReferenceDeviceChild11<ID3D11ClassLinkage>( device )
+	{
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE GetClassInstance( LPCSTR, UINT, ID3D11ClassInstance** instance )
+	{
+		if( instance != NULL )
+			*instance = NULL;
+		return E_INVALIDARG;
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE CreateClassInstance( LPCSTR, UINT, UINT, UINT, UINT, ID3D11ClassInstance** instance )
+	{
+		if( instance != NULL )
+			*instance = NULL;
+		return E_NOTIMPL;
+	}
+};
+
+class ReferenceInputLayout11 : public ReferenceDeviceChild11<ID3D11InputLayout>
+{
+public:
+	ReferenceInputLayout11( ID3D11Device* device, const D3D11_INPUT_ELEMENT_DESC* elements, UINT count );
+
+	const std::vector<D3D11_INPUT_ELEMENT_DESC>& GetElements() const { return m_Elements; }
+
+private:
+	std::vector<D3D11_INPUT_ELEMENT_DESC> m_Elements;
+	std::vector<std::string> m_SemanticNames;
+};
@@ -28,9 +28,20 @@ using namespace System::Runtime::InteropServices;
 
 void SlimDXTest::TearDown()
 {
+	ClearLastResult();
 	ASSERT_EQ(0, SlimDX::ObjectTable::Objects->Count);
 }
 
+// Result::Last only changes on failure, so a failure recorded by one test
+// would otherwise still be visible to the next test on this thread.
+void SlimDXTest::ClearLastResult()
+{
+	bool saved = SlimDX::Configuration::AlwaysRecordLastResult;
+	SlimDX::Configuration::AlwaysRecordLastResult = true;
+	SlimDX::Result::Record<SlimDX::SlimDXException ^>(S_OK, nullptr, nullptr);
+	SlimDX::Configuration::AlwaysRecordLastResult = saved;
+}
+
 void SlimDXTest::AssertLastResultSucceeded()
 {
 	ASSERT_TRUE(SlimDX::Result::Last.IsSuccess);
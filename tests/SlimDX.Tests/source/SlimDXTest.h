@@ -27,6 +27,7 @@ class SlimDXTest : public testing::Test
 {
 protected:
 	virtual void TearDown();
+	static void ClearLastResult();
 	void AssertLastResultSucceeded();
 	void AssertLastResultFailed();
 };
@@ -0,0 +1,226 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace SlimDX;
+using namespace SlimDX::Multimedia;
+using namespace SlimDX::X3DAudio;
+
+ref class AudioBatch
+{
+public:
+	AudioBatch()
+		: audio(gcnew SlimDX::X3DAudio::X3DAudio(Speakers::Stereo, 343.5f)),
+		batch(gcnew EmitterBatch(audio, 4, 1, 2))
+	{
+	}
+	~AudioBatch()
+	{
+		delete batch;
+		batch = nullptr;
+		delete audio;
+		audio = nullptr;
+	}
+	property EmitterBatch ^Batch
+	{
+		EmitterBatch ^get() { return batch; }
+	}
+
+private:
+	SlimDX::X3DAudio::X3DAudio ^audio;
+	EmitterBatch ^batch;
+};
+
+class EmitterBatchTest : public SlimDXTest
+{
+};
+
+#define EMITTERBATCH_TEST(name_) TEST_F(EmitterBatchTest, name_)
+
+static Listener ^CreateListener(Vector3 position)
+{
+	Listener ^listener = gcnew Listener();
+	listener->OrientFront = Vector3(0, 0, 1);
+	listener->OrientTop = Vector3(0, 1, 0);
+	listener->Position = position;
+	return listener;
+}
+
+static Emitter ^CreateEmitter(Vector3 position)
+{
+	Emitter ^emitter = gcnew Emitter();
+	emitter->OrientFront = Vector3(0, 0, 1);
+	emitter->OrientTop = Vector3(0, 1, 0);
+	emitter->Position = position;
+	emitter->ChannelCount = 1;
+	emitter->CurveDistance = 1.0f;
+	emitter->Doppler = 1.0f;
+	return emitter;
+}
+
+EMITTERBATCH_TEST(UnchangedEmittersAreSkipped)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Add(CreateEmitter(Vector3(-1, 0, 0)));
+
+	ASSERT_EQ(2, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+	ASSERT_EQ(0, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+	ASSERT_EQ(2, audio.Batch->LastSkippedCount);
+}
+
+EMITTERBATCH_TEST(MovedEmitterIsRecalculated)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Add(CreateEmitter(Vector3(-1, 0, 0)));
+	audio.Batch->Calculate(listener, CalculateFlags::Matrix);
+
+	audio.Batch->SetPosition(first, Vector3(2, 0, 0));
+	ASSERT_EQ(1, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+	ASSERT_EQ(1, audio.Batch->LastSkippedCount);
+}
+
+EMITTERBATCH_TEST(SamePositionDoesNotDirtyEmitter)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Calculate(listener, CalculateFlags::Matrix);
+
+	audio.Batch->SetPosition(first, Vector3(1, 0, 0));
+	ASSERT_EQ(0, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+}
+
+EMITTERBATCH_TEST(ListenerChangeRecalculatesEveryEmitter)
+{
+	AudioBatch audio;
+	audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Add(CreateEmitter(Vector3(-1, 0, 0)));
+	audio.Batch->Calculate(CreateListener(Vector3(0, 0, 0)), CalculateFlags::Matrix);
+
+	Listener ^moved = CreateListener(Vector3(0, 0, 1));
+	ASSERT_EQ(2, audio.Batch->Calculate(moved, CalculateFlags::Matrix));
+	ASSERT_EQ(2, audio.Batch->Calculate(moved, CalculateFlags::Matrix | CalculateFlags::Doppler));
+}
+
+EMITTERBATCH_TEST(EqualListenerWithoutConeIsUnchanged)
+{
+	AudioBatch audio;
+	audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Calculate(CreateListener(Vector3(0, 0, 0)), CalculateFlags::Matrix);
+
+	ASSERT_EQ(0, audio.Batch->Calculate(CreateListener(Vector3(0, 0, 0)), CalculateFlags::Matrix));
+}
+
+EMITTERBATCH_TEST(ListenerConeChangeRecalculates)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Calculate(listener, CalculateFlags::Matrix);
+
+	Cone ^cone = gcnew Cone();
+	cone->InnerAngle = 1.0f;
+	cone->OuterAngle = 2.0f;
+	cone->InnerVolume = 1.0f;
+	listener->Cone = cone;
+	ASSERT_EQ(1, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+	ASSERT_EQ(0, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+
+	cone->OuterVolume = 0.5f;
+	ASSERT_EQ(1, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+
+	listener->Cone = nullptr;
+	ASSERT_EQ(1, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+}
+
+EMITTERBATCH_TEST(InactiveEmitterIsNotCalculated)
+{
+	AudioBatch audio;
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Add(CreateEmitter(Vector3(-1, 0, 0)));
+	audio.Batch->SetActive(first, false);
+
+	ASSERT_EQ(1, audio.Batch->Calculate(CreateListener(Vector3(0, 0, 0)), CalculateFlags::Matrix));
+	ASSERT_EQ(0, audio.Batch->LastSkippedCount);
+}
+
+EMITTERBATCH_TEST(ReactivatedEmitterIsRecalculated)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Add(CreateEmitter(Vector3(-1, 0, 0)));
+	audio.Batch->Calculate(listener, CalculateFlags::Matrix);
+
+	audio.Batch->SetActive(first, false);
+	ASSERT_EQ(0, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+
+	audio.Batch->SetActive(first, true);
+	ASSERT_EQ(1, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+	ASSERT_EQ(1, audio.Batch->LastSkippedCount);
+}
+
+EMITTERBATCH_TEST(InactiveEmitterIsRecalculatedAfterListenerMoved)
+{
+	AudioBatch audio;
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Add(CreateEmitter(Vector3(-1, 0, 0)));
+	audio.Batch->Calculate(CreateListener(Vector3(0, 0, 0)), CalculateFlags::Matrix);
+
+	Listener ^moved = CreateListener(Vector3(0, 0, 1));
+	audio.Batch->SetActive(first, false);
+	ASSERT_EQ(1, audio.Batch->Calculate(moved, CalculateFlags::Matrix));
+
+	audio.Batch->SetActive(first, true);
+	ASSERT_EQ(1, audio.Batch->Calculate(moved, CalculateFlags::Matrix));
+}
+
+EMITTERBATCH_TEST(SetActiveOnActiveEmitterKeepsItClean)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Calculate(listener, CalculateFlags::Matrix);
+
+	audio.Batch->SetActive(first, true);
+	ASSERT_EQ(0, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+}
+
+EMITTERBATCH_TEST(ReusedSlotIsRecalculated)
+{
+	AudioBatch audio;
+	Listener ^listener = CreateListener(Vector3(0, 0, 0));
+	int first = audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0)));
+	audio.Batch->Calculate(listener, CalculateFlags::Matrix);
+
+	audio.Batch->Remove(first);
+	ASSERT_EQ(first, audio.Batch->Add(CreateEmitter(Vector3(1, 0, 0))));
+	ASSERT_EQ(1, audio.Batch->Calculate(listener, CalculateFlags::Matrix));
+}
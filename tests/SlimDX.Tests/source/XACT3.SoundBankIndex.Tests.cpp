@@ -0,0 +1,178 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace SlimDX;
+using namespace SlimDX::XACT3;
+
+static int const SoundBankHeaderSize = 138;
+static int const SoundBankNameLength = 64;
+
+static void PutUInt16(std::vector<unsigned char> &bytes, int offset, unsigned int value)
+{
+	bytes[offset] = static_cast<unsigned char>(value);
+	bytes[offset + 1] = static_cast<unsigned char>(value >> 8);
+}
+
+static void PutUInt32(std::vector<unsigned char> &bytes, int offset, unsigned int value)
+{
+	for (int i = 0; i < 4; ++i)
+		bytes[offset + i] = static_cast<unsigned char>(value >> (8*i));
+}
+
+// Builds the fixed sound bank header followed by the wave bank name table
+// and the back to back cue names, which is all the index reads.
+static std::vector<unsigned char> BuildSoundBank(int simpleCues, int complexCues, std::vector<std::string> const &waveBanks,
+	std::vector<std::string> const &cueNames)
+{
+	std::vector<unsigned char> bytes(SoundBankHeaderSize);
+	memcpy(&bytes[0], "SDBK", 4);
+	PutUInt16(bytes, 19, simpleCues);
+	PutUInt16(bytes, 21, complexCues);
+	bytes[27] = static_cast<unsigned char>(waveBanks.size());
+	memcpy(&bytes[74], "Effects", 7);
+
+	PutUInt32(bytes, 58, static_cast<unsigned int>(bytes.size()));
+	for (size_t i = 0; i < waveBanks.size(); ++i)
+	{
+		std::vector<unsigned char> name(SoundBankNameLength);
+		memcpy(&name[0], waveBanks[i].c_str(), waveBanks[i].size());
+		bytes.insert(bytes.end(), name.begin(), name.end());
+	}
+
+	if (cueNames.empty())
+	{
+		PutUInt32(bytes, 42, 0xFFFFFFFF);
+		return bytes;
+	}
+
+	size_t namesOffset = bytes.size();
+	for (size_t i = 0; i < cueNames.size(); ++i)
+		bytes.insert(bytes.end(), cueNames[i].c_str(), cueNames[i].c_str() + cueNames[i].size() + 1);
+
+	PutUInt32(bytes, 42, static_cast<unsigned int>(namesOffset));
+	PutUInt16(bytes, 30, static_cast<unsigned int>(bytes.size() - namesOffset));
+	return bytes;
+}
+
+static std::vector<unsigned char> EffectsBank()
+{
+	std::vector<std::string> waveBanks;
+	waveBanks.push_back("Drums");
+	waveBanks.push_back("Voices");
+	std::vector<std::string> cues;
+	cues.push_back("explode");
+	cues.push_back("step");
+	cues.push_back("explode");
+	return BuildSoundBank(2, 1, waveBanks, cues);
+}
+
+class SoundBankIndexTest : public SlimDXTest
+{
+protected:
+	static SoundBankIndex ^FromBytes(std::vector<unsigned char> const &bytes)
+	{
+		return gcnew SoundBankIndex(&bytes[0], static_cast<int>(bytes.size()));
+	}
+};
+
+#define SOUND_BANK_INDEX_TEST(name_) TEST_F(SoundBankIndexTest, name_)
+
+SOUND_BANK_INDEX_TEST(ReadsHeader)
+{
+	SoundBankIndex ^index = FromBytes(EffectsBank());
+	ASSERT_TRUE(gcnew String("Effects") == index->Name);
+	ASSERT_EQ(3, index->CueCount);
+	ASSERT_TRUE(index->HasNames);
+	ASSERT_EQ(2, index->WaveBankNames->Count);
+	ASSERT_TRUE(gcnew String("Drums") == index->WaveBankNames[0]);
+	ASSERT_TRUE(gcnew String("Voices") == index->WaveBankNames[1]);
+}
+
+SOUND_BANK_INDEX_TEST(LooksUpCueNames)
+{
+	SoundBankIndex ^index = FromBytes(EffectsBank());
+	ASSERT_EQ(0, index->GetCueIndex("explode"));
+	ASSERT_EQ(1, index->GetCueIndex("step"));
+	ASSERT_EQ(-1, index->GetCueIndex("Step"));
+	ASSERT_EQ(-1, index->GetCueIndex("jump"));
+	ASSERT_EQ(-1, index->GetCueIndex(nullptr));
+
+	ASSERT_TRUE(gcnew String("step") == index->GetCueName(1));
+	ASSERT_TRUE(gcnew String("explode") == index->GetCueName(2));
+	String ^name;
+	ASSERT_MANAGED_THROW(name = index->GetCueName(-1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(name = index->GetCueName(3), ArgumentOutOfRangeException);
+}
+
+SOUND_BANK_INDEX_TEST(BankWithoutNames)
+{
+	std::vector<std::string> waveBanks;
+	waveBanks.push_back("Drums");
+	SoundBankIndex ^index = FromBytes(BuildSoundBank(2, 0, waveBanks, std::vector<std::string>()));
+	ASSERT_EQ(2, index->CueCount);
+	ASSERT_FALSE(index->HasNames);
+	ASSERT_EQ(-1, index->GetCueIndex("explode"));
+	ASSERT_TRUE(nullptr == index->GetCueName(0));
+}
+
+SOUND_BANK_INDEX_TEST(ReadsFromStream)
+{
+	std::vector<unsigned char> bytes = EffectsBank();
+	array<Byte> ^data = gcnew array<Byte>(static_cast<int>(bytes.size()));
+	for (size_t i = 0; i < bytes.size(); ++i)
+		data[static_cast<int>(i)] = bytes[i];
+
+	SoundBankIndex ^index = gcnew SoundBankIndex(gcnew MemoryStream(data));
+	ASSERT_EQ(1, index->GetCueIndex("step"));
+
+	ASSERT_MANAGED_THROW(index = gcnew SoundBankIndex(static_cast<Stream ^>(nullptr)), ArgumentNullException);
+	ASSERT_MANAGED_THROW(index = gcnew SoundBankIndex(gcnew MemoryStream(gcnew array<Byte>(16))), InvalidDataException);
+}
+
+SOUND_BANK_INDEX_TEST(RejectsInvalidBanks)
+{
+	std::vector<unsigned char> bytes = EffectsBank();
+	SoundBankIndex ^index;
+
+	std::vector<unsigned char> badSignature = bytes;
+	badSignature[0] = 'X';
+	ASSERT_MANAGED_THROW(index = FromBytes(badSignature), InvalidDataException);
+
+	std::vector<unsigned char> truncatedHeader(bytes.begin(), bytes.begin() + SoundBankHeaderSize - 1);
+	ASSERT_MANAGED_THROW(index = FromBytes(truncatedHeader), InvalidDataException);
+
+	std::vector<unsigned char> truncatedNames(bytes.begin(), bytes.end() - 1);
+	ASSERT_MANAGED_THROW(index = FromBytes(truncatedNames), InvalidDataException);
+
+	std::vector<unsigned char> truncatedWaveBanks(bytes.begin(), bytes.begin() + SoundBankHeaderSize + SoundBankNameLength);
+	ASSERT_MANAGED_THROW(index = FromBytes(truncatedWaveBanks), InvalidDataException);
+}
@@ -0,0 +1,291 @@
+#include "stdafx.h"
+/*
+* Copyright (c) 2007-2012 SlimDX Group
+* 
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+* 
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+* 
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include <xact3.h>
+
+#include "Asserts.h"
+#include "SlimDXTest.h"
+
+using namespace testing;
+using namespace System;
+using namespace System::IO;
+using namespace SlimDX;
+using namespace SlimDX::XACT3;
+
+static DWORD const WaveDataOffset = 8192;
+
+// Lays out a wave bank the way XACT writes it: header, bank data, entry
+// metadata and entry names, followed (in a real file) by the wave data.
+static std::vector<unsigned char> BuildWaveBank(WAVEBANKDATA bank, void const *metadata, DWORD metadataLength,
+	std::vector<std::string> const &names, DWORD waveDataLength)
+{
+	if (!names.empty())
+	{
+		bank.dwFlags |= WAVEBANK_FLAGS_ENTRYNAMES;
+		bank.dwEntryNameElementSize = WAVEBANK_ENTRYNAME_LENGTH;
+	}
+
+	WAVEBANKHEADER header;
+	memset(&header, 0, sizeof(header));
+	header.dwSignature = WAVEBANK_HEADER_SIGNATURE;
+	header.dwVersion = XACT_CONTENT_VERSION;
+	header.dwHeaderVersion = WAVEBANK_HEADER_VERSION;
+
+	DWORD offset = sizeof(header);
+	header.Segments[WAVEBANK_SEGIDX_BANKDATA].dwOffset = offset;
+	header.Segments[WAVEBANK_SEGIDX_BANKDATA].dwLength = sizeof(bank);
+	offset += sizeof(bank);
+	header.Segments[WAVEBANK_SEGIDX_ENTRYMETADATA].dwOffset = offset;
+	header.Segments[WAVEBANK_SEGIDX_ENTRYMETADATA].dwLength = metadataLength;
+	offset += metadataLength;
+	header.Segments[WAVEBANK_SEGIDX_ENTRYNAMES].dwOffset = offset;
+	header.Segments[WAVEBANK_SEGIDX_ENTRYNAMES].dwLength = static_cast<DWORD>(names.size()) * WAVEBANK_ENTRYNAME_LENGTH;
+	header.Segments[WAVEBANK_SEGIDX_ENTRYWAVEDATA].dwOffset = WaveDataOffset;
+	header.Segments[WAVEBANK_SEGIDX_ENTRYWAVEDATA].dwLength = waveDataLength;
+
+	std::vector<unsigned char> bytes(reinterpret_cast<unsigned char const *>(&header), reinterpret_cast<unsigned char const *>(&header + 1));
+	bytes.insert(bytes.end(), reinterpret_cast<unsigned char const *>(&bank), reinterpret_cast<unsigned char const *>(&bank + 1));
+	bytes.insert(bytes.end(), static_cast<unsigned char const *>(metadata), static_cast<unsigned char const *>(metadata) + metadataLength);
+	for (size_t i = 0; i < names.size(); ++i)
+	{
+		std::vector<unsigned char> name(WAVEBANK_ENTRYNAME_LENGTH);
+		memcpy(&name[0], names[i].c_str(), names[i].size());
+		bytes.insert(bytes.end(), name.begin(), name.end());
+	}
+
+	return bytes;
+}
+
+static WAVEBANKDATA BankData(char const *name, DWORD flags, DWORD entryCount, DWORD alignment)
+{
+	WAVEBANKDATA bank;
+	memset(&bank, 0, sizeof(bank));
+	bank.dwFlags = flags;
+	bank.dwEntryCount = entryCount;
+	strcpy_s(bank.szBankName, name);
+	bank.dwEntryMetaDataElementSize = sizeof(WAVEBANKENTRY);
+	bank.dwAlignment = alignment;
+	return bank;
+}
+
+static WAVEBANKENTRY Entry(DWORD offset, DWORD length, DWORD duration)
+{
+	WAVEBANKENTRY entry;
+	memset(&entry, 0, sizeof(entry));
+	entry.Duration = duration;
+	entry.Format.wFormatTag = WAVEBANKMINIFORMAT_TAG_PCM;
+	entry.Format.nChannels = 2;
+	entry.Format.nSamplesPerSec = 44100;
+	entry.Format.wBlockAlign = 4;
+	entry.Format.wBitsPerSample = WAVEBANKMINIFORMAT_BITDEPTH_16;
+	entry.PlayRegion.dwOffset = offset;
+	entry.PlayRegion.dwLength = length;
+	entry.LoopRegion.dwStartSample = duration / 4;
+	entry.LoopRegion.dwTotalSamples = duration / 2;
+	return entry;
+}
+
+// A streaming bank with three waves; the third reuses the first's name.
+static std::vector<unsigned char> StreamingBank()
+{
+	WAVEBANKENTRY entries[] =
+	{
+		Entry(0, 1500, 375),
+		Entry(2048, 1000, 250),
+		Entry(4096, 3000, 750),
+	};
+	std::vector<std::string> names;
+	names.push_back("kick");
+	names.push_back("snare");
+	names.push_back("kick");
+	return BuildWaveBank(BankData("Drums", WAVEBANK_TYPE_STREAMING, 3, 2048), entries, sizeof(entries), names, 7096);
+}
+
+class WaveBankIndexTest : public SlimDXTest
+{
+protected:
+	static WaveBankIndex ^FromBytes(std::vector<unsigned char> const &bytes)
+	{
+		return gcnew WaveBankIndex(&bytes[0], static_cast<int>(bytes.size()));
+	}
+};
+
+#define WAVE_BANK_INDEX_TEST(name_) TEST_F(WaveBankIndexTest, name_)
+
+WAVE_BANK_INDEX_TEST(ReadsBankData)
+{
+	WaveBankIndex ^index = FromBytes(StreamingBank());
+	ASSERT_TRUE(gcnew String("Drums") == index->Name);
+	ASSERT_TRUE(index->IsStreaming);
+	ASSERT_TRUE(index->HasNames);
+	ASSERT_EQ(2048, index->Alignment);
+	ASSERT_EQ(3, index->WaveCount);
+}
+
+WAVE_BANK_INDEX_TEST(LooksUpNames)
+{
+	WaveBankIndex ^index = FromBytes(StreamingBank());
+	ASSERT_EQ(1, index->GetWaveIndex("snare"));
+	ASSERT_EQ(0, index->GetWaveIndex("kick"));
+	ASSERT_EQ(-1, index->GetWaveIndex("Kick"));
+	ASSERT_EQ(-1, index->GetWaveIndex("hat"));
+	ASSERT_EQ(-1, index->GetWaveIndex(nullptr));
+	ASSERT_TRUE(gcnew String("kick") == index->GetEntry(2).FriendlyName);
+}
+
+WAVE_BANK_INDEX_TEST(ReadsEntries)
+{
+	WaveBankIndex ^index = FromBytes(StreamingBank());
+	WaveBankEntry entry = index->GetEntry(1);
+	ASSERT_EQ(WaveDataOffset + 2048, entry.PlayOffset);
+	ASSERT_EQ(1000, entry.PlayLength);
+	ASSERT_EQ(250, entry.DurationInSamples);
+	ASSERT_EQ(62, entry.LoopRegion.StartSample);
+	ASSERT_EQ(125, entry.LoopRegion.TotalSamples);
+	ASSERT_EQ(static_cast<int>(WaveBankMiniFormatTag::Pcm), static_cast<int>(entry.Format.FormatTag));
+	ASSERT_EQ(2, entry.Format.Channels);
+	ASSERT_EQ(44100, entry.Format.SamplesPerSecond);
+	ASSERT_EQ(16, entry.Format.BitsPerSample);
+
+	WaveBankEntry result;
+	ASSERT_MANAGED_THROW(result = index->GetEntry(-1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(result = index->GetEntry(3), ArgumentOutOfRangeException);
+}
+
+WAVE_BANK_INDEX_TEST(ReadsCompactEntries)
+{
+	WAVEBANKENTRYCOMPACT entries[2];
+	memset(entries, 0, sizeof(entries));
+	entries[0].dwOffset = 0;
+	entries[1].dwOffset = 4;
+	entries[1].dwLengthDeviation = 2;
+
+	WAVEBANKDATA bank = BankData("Compact", WAVEBANK_TYPE_BUFFER | WAVEBANK_FLAGS_COMPACT, 2, 512);
+	bank.dwEntryMetaDataElementSize = sizeof(WAVEBANKENTRYCOMPACT);
+	bank.CompactFormat.wFormatTag = WAVEBANKMINIFORMAT_TAG_PCM;
+	bank.CompactFormat.nChannels = 1;
+	bank.CompactFormat.nSamplesPerSec = 22050;
+	bank.CompactFormat.wBlockAlign = 2;
+	bank.CompactFormat.wBitsPerSample = WAVEBANKMINIFORMAT_BITDEPTH_16;
+	std::vector<unsigned char> bytes = BuildWaveBank(bank, entries, sizeof(entries), std::vector<std::string>(), 3000);
+
+	WaveBankIndex ^index = FromBytes(bytes);
+	ASSERT_FALSE(index->IsStreaming);
+	ASSERT_FALSE(index->HasNames);
+	ASSERT_EQ(-1, index->GetWaveIndex("anything"));
+
+	WaveBankEntry first = index->GetEntry(0);
+	ASSERT_TRUE(nullptr == first.FriendlyName);
+	ASSERT_EQ(WaveDataOffset, first.PlayOffset);
+	ASSERT_EQ(2048, first.PlayLength);
+	ASSERT_EQ(1024, first.DurationInSamples);
+	ASSERT_EQ(22050, first.Format.SamplesPerSecond);
+
+	WaveBankEntry second = index->GetEntry(1);
+	ASSERT_EQ(WaveDataOffset + 2048, second.PlayOffset);
+	ASSERT_EQ(3000 - 2048 - 2, second.PlayLength);
+	ASSERT_EQ((3000 - 2048 - 2) / 2, second.DurationInSamples);
+}
+
+WAVE_BANK_INDEX_TEST(ReadsFromStream)
+{
+	std::vector<unsigned char> bytes = StreamingBank();
+	array<Byte> ^data = gcnew array<Byte>(static_cast<int>(bytes.size()) + 16);
+	for (size_t i = 0; i < bytes.size(); ++i)
+		data[static_cast<int>(i) + 16] = bytes[i];
+
+	MemoryStream ^stream = gcnew MemoryStream(data);
+	stream->Position = 16;
+	WaveBankIndex ^index = gcnew WaveBankIndex(stream);
+	ASSERT_EQ(3, index->WaveCount);
+	ASSERT_EQ(1, index->GetWaveIndex("snare"));
+	ASSERT_EQ(WaveDataOffset + 4096, index->GetEntry(2).PlayOffset);
+
+	ASSERT_MANAGED_THROW(index = gcnew WaveBankIndex(static_cast<Stream ^>(nullptr)), ArgumentNullException);
+}
+
+WAVE_BANK_INDEX_TEST(PlansAlignedPrefetchRanges)
+{
+	WaveBankIndex ^index = FromBytes(StreamingBank());
+
+	// the first 512 bytes of each wave round up to one aligned block, and adjacent blocks merge
+	array<WaveBankReadRange> ^ranges = index->PlanPrefetch(gcnew array<int> { 2, 0, 1 }, 512);
+	ASSERT_EQ(1, ranges->Length);
+	ASSERT_EQ(WaveDataOffset, ranges[0].Offset);
+	ASSERT_EQ(6144, ranges[0].Length);
+
+	ranges = index->PlanPrefetch(gcnew array<int> { 2, 0 }, 512);
+	ASSERT_EQ(2, ranges->Length);
+	ASSERT_EQ(WaveDataOffset, ranges[0].Offset);
+	ASSERT_EQ(2048, ranges[0].Length);
+	ASSERT_EQ(WaveDataOffset + 4096, ranges[1].Offset);
+	ASSERT_EQ(2048, ranges[1].Length);
+
+	// whole waves; the last one ends past its block
+	ranges = index->PlanPrefetch(gcnew array<int> { 2 }, 0);
+	ASSERT_EQ(1, ranges->Length);
+	ASSERT_EQ(WaveDataOffset + 4096, ranges[0].Offset);
+	ASSERT_EQ(4096, ranges[0].Length);
+
+	ASSERT_EQ(0, index->PlanPrefetch(gcnew array<int>(0), 512)->Length);
+	ASSERT_MANAGED_THROW(ranges = index->PlanPrefetch(nullptr, 512), ArgumentNullException);
+	ASSERT_MANAGED_THROW(ranges = index->PlanPrefetch(gcnew array<int> { 0 }, -1), ArgumentOutOfRangeException);
+	ASSERT_MANAGED_THROW(ranges = index->PlanPrefetch(gcnew array<int> { 3 }, 512), ArgumentOutOfRangeException);
+}
+
+WAVE_BANK_INDEX_TEST(RejectsInvalidHeaders)
+{
+	std::vector<unsigned char> bytes = StreamingBank();
+	WaveBankIndex ^index;
+
+	std::vector<unsigned char> badSignature = bytes;
+	badSignature[0] ^= 0xFF;
+	ASSERT_MANAGED_THROW(index = FromBytes(badSignature), InvalidDataException);
+
+	std::vector<unsigned char> badVersion = bytes;
+	reinterpret_cast<WAVEBANKHEADER *>(&badVersion[0])->dwHeaderVersion++;
+	ASSERT_MANAGED_THROW(index = FromBytes(badVersion), InvalidDataException);
+
+	std::vector<unsigned char> truncated(bytes.begin(), bytes.begin() + sizeof(WAVEBANKHEADER) - 1);
+	ASSERT_MANAGED_THROW(index = FromBytes(truncated), InvalidDataException);
+
+	std::vector<unsigned char> missingNames(bytes.begin(), bytes.end() - 1);
+	ASSERT_MANAGED_THROW(index = FromBytes(missingNames), InvalidDataException);
+}
+
+WAVE_BANK_INDEX_TEST(RejectsEntriesOutsideTheirRegions)
+{
+	WaveBankIndex ^index;
+
+	std::vector<unsigned char> tooManyEntries = StreamingBank();
+	WAVEBANKHEADER const *header = reinterpret_cast<WAVEBANKHEADER const *>(&tooManyEntries[0]);
+	reinterpret_cast<WAVEBANKDATA *>(&tooManyEntries[header->Segments[WAVEBANK_SEGIDX_BANKDATA].dwOffset])->dwEntryCount = 4;
+	ASSERT_MANAGED_THROW(index = FromBytes(tooManyEntries), InvalidDataException);
+
+	std::vector<unsigned char> shortWaveData = StreamingBank();
+	reinterpret_cast<WAVEBANKHEADER *>(&shortWaveData[0])->Segments[WAVEBANK_SEGIDX_ENTRYWAVEDATA].dwLength = 7095;
+	ASSERT_MANAGED_THROW(index = FromBytes(shortWaveData), InvalidDataException);
+}
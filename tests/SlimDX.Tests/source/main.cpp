@@ -21,8 +21,13 @@
 * THE SOFTWARE.
 */
 
+#include "Benchmark.h"
+
 int main(array<System::String ^> ^args)
 {
+	if (BenchmarkRunner::IsRequested(args))
+		return BenchmarkRunner::Run(args);
+
 	//TODO: Instead of sending empty values, we should
 	//      turn the managed args array into the appropriate
 	//      native data to send to Google Mock.
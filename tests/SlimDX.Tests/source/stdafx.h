@@ -52,6 +52,7 @@
 
 #include <dxgi.h>
 #include <d3d10.h>
+#include <d3d11.h>
 
 #pragma warning(push)
 #pragma warning(disable:4793) // 'compiled as native'